@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_
+#define LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+// Limits of the convolver partition rank
+#define LSP_DSP_CONVOLVER_RANK_MIN          5
+#define LSP_DSP_CONVOLVER_RANK_MAX          16
+
+// Limits of the zero-latency convolver head length
+#define LSP_DSP_HCONVOLVER_HEAD_MIN         (1 << (LSP_DSP_CONVOLVER_RANK_MIN - 1))
+#define LSP_DSP_HCONVOLVER_HEAD_MAX         (1 << (LSP_DSP_CONVOLVER_RANK_MAX - 1))
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Partitioned convolver. The impulse response is split into partitions which are
+ * processed in the frequency domain by the fastconv_* functions. The first partitions
+ * have the size of the processing block, the size of the next partitions is doubled
+ * after every two partitions until it reaches the maximum rank (non-uniform partitioning).
+ * If the maximum rank is equal to the minimum rank, the uniform partitioning is used.
+ * The partition boundaries of levels of different size are shifted relatively to each
+ * other, so each processing block computes the transforms of the smallest partition
+ * and at most one larger partition, and the multiplication of spectra is spread between
+ * processing blocks. The peak processing time of the block is therefore bounded by the
+ * transform of the largest partition, which is not split between processing blocks.
+ *
+ * The object is opaque, it should be created with convolver_create() and destroyed
+ * with convolver_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(convolver_t) LSP_DSP_LIB_TYPE(convolver_t);
+
+/**
+ * Zero-latency hybrid convolver. The head of the impulse response is applied in the
+ * time domain by the streaming FIR filter, the rest of the impulse response is applied
+ * by the partitioned convolver whose block latency is hidden by the head. The processing
+ * block of the partitioned convolver is the largest power of two not greater than the
+ * head length. The processing time of the tail is spread between blocks as described for
+ * the partitioned convolver, the peak is bounded by the transform of its largest partition.
+ *
+ * The object is opaque, it should be created with hconvolver_create() and destroyed
+ * with hconvolver_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(hconvolver_t) LSP_DSP_LIB_TYPE(hconvolver_t);
+
+/**
+ * Multi-input multi-output convolution matrix. Each output is the sum of all inputs
+ * convolved with the impulse responses of the corresponding row of the matrix. The
+ * impulse responses are uniformly partitioned into blocks of 2^(rank-1) samples.
+ * Each block of each input is transformed only once by fastconv_parse(), the products
+ * of spectra for all pairs of inputs and outputs are accumulated in the frequency domain
+ * by fastconv_fmadd() and each output is restored only once by fastconv_restore().
+ *
+ * The object is opaque, it should be created with mconvolver_create() and destroyed
+ * with mconvolver_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(mconvolver_t) LSP_DSP_LIB_TYPE(mconvolver_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create partitioned convolver. The convolver introduces the latency of 2^(rank-1)
+ * samples. The impulse response data is copied and not referenced by the convolver.
+ *
+ * @param ir impulse response
+ * @param length length of the impulse response in samples
+ * @param rank the fastconv rank of the smallest partition, the processing block is 2^(rank-1) samples,
+ *        should be in range of LSP_DSP_CONVOLVER_RANK_MIN to LSP_DSP_CONVOLVER_RANK_MAX
+ * @param max_rank the fastconv rank of the largest partition, should be not less than rank
+ *        and not greater than LSP_DSP_CONVOLVER_RANK_MAX
+ * @return pointer to the convolver or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(convolver_t) *, convolver_create,
+    const float *ir, size_t length, size_t rank, size_t max_rank);
+
+/**
+ * Destroy the convolver and free all allocated resources
+ *
+ * @param cv convolver to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_destroy, LSP_DSP_LIB_TYPE(convolver_t) *cv);
+
+/**
+ * Reset the internal state of the convolver (input history and pending output)
+ *
+ * @param cv convolver to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_reset, LSP_DSP_LIB_TYPE(convolver_t) *cv);
+
+/**
+ * Get the latency of the convolver
+ *
+ * @param cv convolver
+ * @return latency in samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, convolver_latency, const LSP_DSP_LIB_TYPE(convolver_t) *cv);
+
+/**
+ * Process the signal by the convolver. The output signal is delayed by the
+ * convolver latency. The source and destination buffers may be the same.
+ *
+ * @param cv convolver
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, convolver_process, LSP_DSP_LIB_TYPE(convolver_t) *cv,
+    float *dst, const float *src, size_t count);
+
+/**
+ * Create zero-latency hybrid convolver. The impulse response data is copied and not
+ * referenced by the convolver.
+ *
+ * @param ir impulse response
+ * @param length length of the impulse response in samples
+ * @param head number of impulse response samples processed in the time domain,
+ *        should be in range of LSP_DSP_HCONVOLVER_HEAD_MIN to LSP_DSP_HCONVOLVER_HEAD_MAX
+ * @param max_rank the fastconv rank of the largest partition, should be not greater
+ *        than LSP_DSP_CONVOLVER_RANK_MAX and not less than the rank of the partitioned
+ *        convolver block
+ * @return pointer to the convolver or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(hconvolver_t) *, hconvolver_create,
+    const float *ir, size_t length, size_t head, size_t max_rank);
+
+/**
+ * Destroy the zero-latency convolver and free all allocated resources
+ *
+ * @param cv convolver to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, hconvolver_destroy, LSP_DSP_LIB_TYPE(hconvolver_t) *cv);
+
+/**
+ * Reset the internal state of the zero-latency convolver
+ *
+ * @param cv convolver to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, hconvolver_reset, LSP_DSP_LIB_TYPE(hconvolver_t) *cv);
+
+/**
+ * Process the signal by the zero-latency convolver. The output signal is not delayed.
+ * The source and destination buffers may be the same.
+ *
+ * @param cv convolver
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, hconvolver_process, LSP_DSP_LIB_TYPE(hconvolver_t) *cv,
+    float *dst, const float *src, size_t count);
+
+/**
+ * Create multi-input multi-output convolution matrix. The convolver introduces the latency
+ * of 2^(rank-1) samples. The impulse response data is copied and not referenced by the convolver.
+ *
+ * @param ir array of inputs*outputs pointers to impulse responses, the impulse response
+ *        for the input i and the output o is stored at index (o * inputs + i), NULL
+ *        pointer means that the input is not mixed to the output
+ * @param inputs number of inputs
+ * @param outputs number of outputs
+ * @param length length of each impulse response in samples
+ * @param rank the fastconv rank of partitions, the processing block is 2^(rank-1) samples,
+ *        should be in range of LSP_DSP_CONVOLVER_RANK_MIN to LSP_DSP_CONVOLVER_RANK_MAX
+ * @return pointer to the convolver or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(mconvolver_t) *, mconvolver_create,
+    const float * const *ir, size_t inputs, size_t outputs, size_t length, size_t rank);
+
+/**
+ * Destroy the convolution matrix and free all allocated resources
+ *
+ * @param cv convolver to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_destroy, LSP_DSP_LIB_TYPE(mconvolver_t) *cv);
+
+/**
+ * Reset the internal state of the convolution matrix
+ *
+ * @param cv convolver to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_reset, LSP_DSP_LIB_TYPE(mconvolver_t) *cv);
+
+/**
+ * Get the latency of the convolution matrix
+ *
+ * @param cv convolver
+ * @return latency in samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, mconvolver_latency, const LSP_DSP_LIB_TYPE(mconvolver_t) *cv);
+
+/**
+ * Process the signals by the convolution matrix. The output signals are delayed by the
+ * convolver latency. The source and destination buffers may be the same.
+ *
+ * @param cv convolver
+ * @param dst array of destination buffers, one per output
+ * @param src array of source buffers, one per input
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, mconvolver_process, LSP_DSP_LIB_TYPE(mconvolver_t) *cv,
+    float * const *dst, const float * const *src, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_CONVOLVER_H_ */
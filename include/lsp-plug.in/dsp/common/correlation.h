@@ -46,6 +46,16 @@ typedef struct LSP_DSP_LIB_TYPE(correlation_t)
     float   b;      // the aggregated value of sum(b*b)
 } LSP_DSP_LIB_TYPE(correlation_t);
 
+/**
+ * Object to store double-precision correlation state.
+ */
+typedef struct LSP_DSP_LIB_TYPE(correlation_f64_t)
+{
+    double  v;      // the aggregated value of sum(a*b)
+    double  a;      // the aggregated value of sum(a*a)
+    double  b;      // the aggregated value of sum(b*b)
+} LSP_DSP_LIB_TYPE(correlation_f64_t);
+
 #pragma pack(pop)
 
 LSP_DSP_LIB_END_NAMESPACE
@@ -84,4 +94,38 @@ LSP_DSP_LIB_SYMBOL(void, corr_incr,
     const float *a_tail, const float *b_tail,
     size_t count);
 
+/**
+ * Compute the initial intermediate values of correlation between two signals
+ * with double precision, the function can be called multiple times, so the
+ * value of corr structure should be cleared before first call.
+ *
+ * @param corr the object to initialize with intermediate results
+ * @param a the pointer to the first signal buffer
+ * @param b the pointer to the second signal buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, corr_init_f64,
+    LSP_DSP_LIB_TYPE(correlation_f64_t) *corr,
+    const double *a, const double *b,
+    size_t count);
+
+/**
+ * Compute incremental value of normalized correlation between two signals
+ * with double precision
+ *
+ * @param corr the object that holds intermediate results
+ * @param dst destination buffer to store result
+ * @param a_head the pointer to the head of the first signal buffer
+ * @param b_head the pointer to the head of the second signal buffer
+ * @param a_tail the pointer to the tail of the first signal buffer
+ * @param b_tail the pointer to the tail of the second signal buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, corr_incr_f64,
+    LSP_DSP_LIB_TYPE(correlation_f64_t) *corr,
+    double *dst,
+    const double *a_head, const double *b_head,
+    const double *a_tail, const double *b_tail,
+    size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_CORRELATION_H_ */
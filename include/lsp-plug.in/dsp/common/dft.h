@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_DFT_H_
+#define LSP_PLUG_IN_DSP_COMMON_DFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Plan of the discrete Fourier transform of arbitrary size. The size is split into
+ * the power-of-two part which is processed by the packed FFT functions and the part
+ * that consists of factors 2, 3, 4, 5 and 7 which is processed by mixed-radix
+ * butterflies. Sizes that contain other prime factors are processed by the Bluestein
+ * algorithm.
+ *
+ * The plan contains temporary buffers, so the same plan should not be used by
+ * multiple threads simultaneously.
+ *
+ * The object is opaque, it should be created with dft_plan_create() and destroyed
+ * with dft_plan_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(dft_plan_t) LSP_DSP_LIB_TYPE(dft_plan_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create the plan of the discrete Fourier transform
+ *
+ * @param size size of the transform in complex samples, should be positive
+ * @return pointer to the plan or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(dft_plan_t) *, dft_plan_create, size_t size);
+
+/**
+ * Destroy the plan of the discrete Fourier transform and free all allocated resources
+ *
+ * @param plan plan to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, dft_plan_destroy, LSP_DSP_LIB_TYPE(dft_plan_t) *plan);
+
+/**
+ * Get the size of the discrete Fourier transform
+ *
+ * @param plan plan of the transform
+ * @return size of the transform in complex samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, dft_plan_size, const LSP_DSP_LIB_TYPE(dft_plan_t) *plan);
+
+/** Direct discrete Fourier transform with packed complex data.
+ * The source and destination buffers may be the same.
+ *
+ * @param plan plan of the transform
+ * @param dst complex spectrum [re, im, re, im ...]
+ * @param src complex signal [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_direct_dft, LSP_DSP_LIB_TYPE(dft_plan_t) *plan, float *dst, const float *src);
+
+/** Reverse discrete Fourier transform with packed complex data. The output
+ * is normalized in the same way as for the packed_reverse_fft() function.
+ * The source and destination buffers may be the same.
+ *
+ * @param plan plan of the transform
+ * @param dst complex signal [re, im, re, im ...]
+ * @param src complex spectrum [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, packed_reverse_dft, LSP_DSP_LIB_TYPE(dft_plan_t) *plan, float *dst, const float *src);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_DFT_H_ */
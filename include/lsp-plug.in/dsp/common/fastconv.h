@@ -23,6 +23,7 @@
 #define LSP_PLUG_IN_DSP_COMMON_FASTCONV_H_
 
 #include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/fft.h>
 
 /** Parse input real data to fast convolution data
  *
@@ -64,4 +65,65 @@ LSP_DSP_LIB_SYMBOL(void, fastconv_restore, float *dst, float *src, size_t rank);
  */
 LSP_DSP_LIB_SYMBOL(void, fastconv_apply, float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+/** Multiply two convolutions and add the result to the accumulator convolution
+ * without restoring data to the real domain. The accumulated result can be
+ * restored later by single fastconv_restore() call.
+ *
+ * The layout of fast convolution data is architecture-specific, so all
+ * convolution data should be produced by the fastconv_parse() function.
+ *
+ * @param dst fast convolution data of 2^(rank+1) floats to accumulate the product
+ * @param c1 fast convolution data of 2^(rank+1) floats
+ * @param c2 fast convolution data of 2^(rank+1) floats
+ * @param rank the convolution rank
+ */
+LSP_DSP_LIB_SYMBOL(void, fastconv_fmadd, float *dst, const float *c1, const float *c2, size_t rank);
+
+/** Parse input real data to fast convolution data using the precomputed FFT plan
+ * of the same rank as the convolution rank.
+ *
+ * Unlike fastconv_parse(), the produced data has the same layout on all architectures:
+ * it is the packed complex spectrum [re, im, re, im ...] of the source data padded with
+ * zeros, so it can be processed with pcomplex_* functions. The data is not compatible
+ * with other fastconv_* functions and should be used with plan_fastconv_* functions only.
+ * All plan_fastconv_* functions require the plan of rank 1 or above and do nothing
+ * for the plan of rank 0.
+ *
+ * @param plan FFT plan of the convolution rank
+ * @param dst destination buffer of 2^(rank+1) floats
+ * @param src source real data of 2^(rank-1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_fastconv_parse, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/** Parse input real data to fast convolution data, convolve with another convolution
+ * data produced by plan_fastconv_parse(), restore data to real data and add to output buffer
+ *
+ * @param plan FFT plan of the convolution rank
+ * @param dst target real data of 2^rank floats to store convolved data
+ * @param tmp temporary buffer of 2^(rank+1) floats to store intermediate data
+ * @param c fast convolution data of 2^(rank+1) floats to apply to the buffer
+ * @param src source real data of 2^(rank-1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_fastconv_parse_apply, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, float *tmp, const float *c, const float *src);
+
+/** Restore convolution data produced by plan_fastconv_parse() to real data,
+ * modifies the source fast convolution data
+ *
+ * @param plan FFT plan of the convolution rank
+ * @param dst destination real data of 2^rank floats
+ * @param src source fast convolution data of 2^(rank+1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_fastconv_restore, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, float *src);
+
+/** Convolve two convolutions produced by plan_fastconv_parse(), restore data
+ * to real data and add to output buffer
+ *
+ * @param plan FFT plan of the convolution rank
+ * @param dst target real data of 2^rank floats to apply convolved data
+ * @param tmp temporary buffer of 2^(rank+1) floats to store intermediate data
+ * @param c1 fast convolution data of 2^(rank+1) floats
+ * @param c2 fast convolution data of 2^(rank+1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_fastconv_apply, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, float *tmp, const float *c1, const float *c2);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FASTCONV_H_ */
@@ -56,6 +56,49 @@ LSP_DSP_LIB_SYMBOL(void, reverse_fft, float *dst_re, float *dst_im, const float
  */
 LSP_DSP_LIB_SYMBOL(void, packed_reverse_fft, float *dst, const float *src, size_t rank);
 
+/** Direct Fast Fourier Transform with double precision
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, direct_fft_f64, double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+
+/** Reverse Fast Fourier transform with double precision
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, reverse_fft_f64, double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+
+/** Direct Fast Fourier Transform of real data. Because the spectrum of the real
+ * signal is conjugate-symmetric, only 2^(rank-1)+1 harmonics are stored.
+ * ARM targets (NEON, ASIMD) deliberately use the generic implementation: it performs
+ * the half-size transform with the dispatched packed_direct_fft(), so only the linear
+ * split stage is computed by scalar code.
+ *
+ * @param dst complex spectrum [re, im, re, im ...] of 2^(rank-1)+1 harmonics (2^rank+2 floats),
+ *        the imaginary part of the first and the last harmonics is always zero
+ * @param src real signal of 2^rank samples
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, real_direct_fft, float *dst, const float *src, size_t rank);
+
+/** Reverse Fast Fourier Transform that produces real data from the
+ * conjugate-symmetric spectrum. ARM targets (NEON, ASIMD) deliberately use the generic
+ * implementation which performs the half-size transform with the dispatched
+ * packed_reverse_fft().
+ *
+ * @param dst real signal of 2^rank samples
+ * @param src complex spectrum [re, im, re, im ...] of 2^(rank-1)+1 harmonics (2^rank+2 floats),
+ *        the imaginary part of the first and the last harmonics is ignored
+ * @param rank the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(void, real_reverse_fft, float *dst, const float *src, size_t rank);
+
 /** Normalize FFT coefficients
  *
  * @param dst_re target array for real part of signal
@@ -102,4 +145,143 @@ LSP_DSP_LIB_SYMBOL(void, combine_fft, float *dst_re, float *dst_im, const float
  */
 LSP_DSP_LIB_SYMBOL(void, packed_combine_fft, float *dst, const float *src, size_t rank);
 
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Plan of the Fast Fourier Transform of the fixed rank. The plan holds precomputed
+ * twiddle factors of all butterfly stages laid out for SIMD processing and the
+ * bit-reversal permutation, so transforms do not spend time on the twiddle
+ * rotation and do not accumulate its rounding error. The same plan serves both
+ * the direct and the reverse transform. Large transforms that do not fit into
+ * the CPU cache are automatically processed block by block instead of stage by
+ * stage, which keeps the working set of butterflies in the cache. The functions
+ * without the plan (direct_fft(), packed_direct_fft() and their reverse
+ * counterparts) keep processing all stages over the whole buffer, so the plan
+ * functions should be preferred for transforms of rank above 13.
+ *
+ * The plan is not modified by transforms, so it can be shared between multiple
+ * threads. The object is opaque, it should be created with fft_plan_create()
+ * and destroyed with fft_plan_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fft_plan_t) LSP_DSP_LIB_TYPE(fft_plan_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create the plan of the Fast Fourier Transform
+ *
+ * @param rank the rank of FFT, should not be greater than 31
+ * @return pointer to the plan or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(fft_plan_t) *, fft_plan_create, size_t rank);
+
+/**
+ * Destroy the plan of the Fast Fourier Transform and free all allocated resources
+ *
+ * @param plan plan to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, fft_plan_destroy, LSP_DSP_LIB_TYPE(fft_plan_t) *plan);
+
+/**
+ * Get the rank of the Fast Fourier Transform
+ *
+ * @param plan plan of the transform
+ * @return the rank of FFT
+ */
+LSP_DSP_LIB_SYMBOL(size_t, fft_plan_rank, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan);
+
+/** Direct Fast Fourier Transform using the precomputed plan,
+ * produces the same result as the direct_fft() function
+ *
+ * @param plan plan of the transform
+ * @param dst_re real part of spectrum
+ * @param dst_im imaginary part of spectrum
+ * @param src_re real part of signal
+ * @param src_im imaginary part of signal
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_direct_fft, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+/** Reverse Fast Fourier Transform using the precomputed plan,
+ * produces the same result as the reverse_fft() function
+ *
+ * @param plan plan of the transform
+ * @param dst_re real part of signal
+ * @param dst_im imaginary part of signal
+ * @param src_re real part of spectrum
+ * @param src_im imaginary part of spectrum
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_reverse_fft, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+
+/** Direct Fast Fourier Transform with packed complex data using the precomputed plan,
+ * produces the same result as the packed_direct_fft() function
+ *
+ * @param plan plan of the transform
+ * @param dst complex spectrum [re, im, re, im ...]
+ * @param src complex signal [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_direct_fft, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/** Reverse Fast Fourier Transform with packed complex data using the precomputed plan,
+ * produces the same result as the packed_reverse_fft() function
+ *
+ * @param plan plan of the transform
+ * @param dst complex signal [re, im, re, im ...]
+ * @param src complex spectrum [re, im, re, im ...]
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_reverse_fft, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/** Direct Fast Fourier Transform of multiple buffers with packed complex data using the precomputed plan,
+ * produces the same result as the plan_packed_direct_fft() function called for each buffer.
+ * Transforms of small ranks are computed for several buffers at once, the function does not
+ * allocate memory.
+ *
+ * @param plan plan of the transform
+ * @param dst complex spectrums [re, im, re, im ...], each next spectrum is located stride floats after the previous one
+ * @param src complex signals [re, im, re, im ...], each next signal is located stride floats after the previous one
+ * @param stride distance between the beginnings of adjacent buffers in floats, at least 2^(rank+1)
+ * @param count number of buffers
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_direct_fft_batch, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float *dst, const float *src, size_t stride, size_t count);
+
+/** Reverse Fast Fourier Transform of multiple buffers with packed complex data using the precomputed plan,
+ * produces the same result as the plan_packed_reverse_fft() function called for each buffer.
+ * Transforms of small ranks are computed for several buffers at once, the function does not
+ * allocate memory.
+ *
+ * @param plan plan of the transform
+ * @param dst complex signals [re, im, re, im ...], each next signal is located stride floats after the previous one
+ * @param src complex spectrums [re, im, re, im ...], each next spectrum is located stride floats after the previous one
+ * @param stride distance between the beginnings of adjacent buffers in floats, at least 2^(rank+1)
+ * @param count number of buffers
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_reverse_fft_batch, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float *dst, const float *src, size_t stride, size_t count);
+
+/** Direct Fast Fourier Transform of multiple buffers with packed complex data using the precomputed plan,
+ * produces the same result as the plan_packed_direct_fft() function called for each buffer.
+ * Transforms of small ranks are computed for several buffers at once, the function does not
+ * allocate memory.
+ *
+ * @param plan plan of the transform
+ * @param dst array of count pointers to complex spectrums [re, im, re, im ...]
+ * @param src array of count pointers to complex signals [re, im, re, im ...]
+ * @param count number of buffers
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_direct_fft_batch_ptr, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float * const *dst, const float * const *src, size_t count);
+
+/** Reverse Fast Fourier Transform of multiple buffers with packed complex data using the precomputed plan,
+ * produces the same result as the plan_packed_reverse_fft() function called for each buffer.
+ * Transforms of small ranks are computed for several buffers at once, the function does not
+ * allocate memory.
+ *
+ * @param plan plan of the transform
+ * @param dst array of count pointers to complex signals [re, im, re, im ...]
+ * @param src array of count pointers to complex spectrums [re, im, re, im ...]
+ * @param count number of buffers
+ */
+LSP_DSP_LIB_SYMBOL(void, plan_packed_reverse_fft_batch_ptr, const LSP_DSP_LIB_TYPE(fft_plan_t) *plan,
+    float * const *dst, const float * const *src, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FFT_H_ */
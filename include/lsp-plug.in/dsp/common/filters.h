@@ -25,6 +25,7 @@
 #include <lsp-plug.in/dsp/common/types.h>
 
 #include <lsp-plug.in/dsp/common/filters/types.h>
+#include <lsp-plug.in/dsp/common/filters/design.h>
 #include <lsp-plug.in/dsp/common/filters/dynamic.h>
 #include <lsp-plug.in/dsp/common/filters/static.h>
 #include <lsp-plug.in/dsp/common/filters/transfer.h>
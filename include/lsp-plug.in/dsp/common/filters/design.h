@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FILTERS_DESIGN_H_
+#define LSP_PLUG_IN_DSP_COMMON_FILTERS_DESIGN_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/filters/types.h>
+
+/**
+ * Design analog cascades of the set of filters. Each filter produces 'slope' cascades
+ * normalized to the cutoff frequency of the filter. The cascades of the filter can be
+ * converted with bilinear_transform_x1() using kf = 1/tan(pi*freq) or with
+ * matched_transform_x1() using kf = freq*sample_rate and td = 2*pi/sample_rate.
+ *
+ * @param dst array to store cascades, should have enough space for all cascades
+ * @param p array of filter parameters
+ * @param count number of filters
+ * @return number of cascades written to dst
+ */
+LSP_DSP_LIB_SYMBOL(size_t, filter_design_cascades, LSP_DSP_LIB_TYPE(f_cascade_t) *dst, const LSP_DSP_LIB_TYPE(filter_params_t) *p, size_t count);
+
+/**
+ * Design analog cascades of the set of filters with the frequency pre-warping of the
+ * bilinear transform already applied. The whole output can be converted by a single
+ * call of bilinear_transform_xN() with kf = 1 and count = result/lanes. The output is
+ * padded with cascades that pass the signal unchanged up to the multiple of lanes.
+ *
+ * @param dst array to store cascades, should have enough space for all cascades and padding
+ * @param p array of filter parameters
+ * @param count number of filters
+ * @param lanes number of cascades in the filter bank: 1, 2, 4, 8 or 16
+ * @return number of cascades written to dst including padding
+ */
+LSP_DSP_LIB_SYMBOL(size_t, filter_design_bilinear, LSP_DSP_LIB_TYPE(f_cascade_t) *dst, const LSP_DSP_LIB_TYPE(filter_params_t) *p, size_t count, size_t lanes);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_DESIGN_H_ */
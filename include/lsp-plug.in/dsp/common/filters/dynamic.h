@@ -65,4 +65,65 @@ LSP_DSP_LIB_SYMBOL(void, dyn_biquad_process_x4, float *dst, const float *src, fl
  */
 LSP_DSP_LIB_SYMBOL(void, dyn_biquad_process_x8, float *dst, const float *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(biquad_x8_t) *f);
 
+/** Process sixteen dynamic bi-quadratic filters for multiple samples
+ *
+ * @param dst array of count destination samples to emit
+ * @param src array of count source samples to process
+ * @param d pointer to filter memory (32 floats)
+ * @param count number of samples to process
+ * @param f array matrix of (count+15)*16 memory-aligned bi-quadratic filters
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_process_x16, float *dst, const float *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(biquad_x16_t) *f);
+
+//---------------------------------------------------------------------------------------
+// Design of dynamic filters
+//---------------------------------------------------------------------------------------
+/** Compute per-sample coefficients of single dynamic bi-quadratic filter
+ * from the modulated filter parameters. The frequency pre-warping of the
+ * bilinear transform is computed with vectorized sine and cosine functions.
+ *
+ * @param bf array of count bi-quadratic filters to store coefficients
+ * @param p parameters of the filter
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_design_x1, LSP_DSP_LIB_TYPE(biquad_x1_t) *bf, const LSP_DSP_LIB_TYPE(dyn_filter_params_t) *p, size_t count);
+
+/** Compute per-sample coefficients of two dynamic bi-quadratic filters
+ * in the shifted layout accepted by dyn_biquad_process_x2(). Cells of the
+ * matrix that do not correspond to any sample are filled with the cascade
+ * that passes the signal unchanged.
+ *
+ * @param bf array matrix of (count+1)*2 bi-quadratic filters to store coefficients
+ * @param p array of parameters for 2 filter cascades
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_design_x2, LSP_DSP_LIB_TYPE(biquad_x2_t) *bf, const LSP_DSP_LIB_TYPE(dyn_filter_params_t) *p, size_t count);
+
+/** Compute per-sample coefficients of four dynamic bi-quadratic filters
+ * in the shifted layout accepted by dyn_biquad_process_x4()
+ *
+ * @param bf array matrix of (count+3)*4 bi-quadratic filters to store coefficients
+ * @param p array of parameters for 4 filter cascades
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_design_x4, LSP_DSP_LIB_TYPE(biquad_x4_t) *bf, const LSP_DSP_LIB_TYPE(dyn_filter_params_t) *p, size_t count);
+
+/** Compute per-sample coefficients of eight dynamic bi-quadratic filters
+ * in the shifted layout accepted by dyn_biquad_process_x8()
+ *
+ * @param bf array matrix of (count+7)*8 bi-quadratic filters to store coefficients
+ * @param p array of parameters for 8 filter cascades
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_design_x8, LSP_DSP_LIB_TYPE(biquad_x8_t) *bf, const LSP_DSP_LIB_TYPE(dyn_filter_params_t) *p, size_t count);
+
+/** Compute per-sample coefficients of sixteen dynamic bi-quadratic filters
+ * in the shifted layout accepted by dyn_biquad_process_x16()
+ *
+ * @param bf array matrix of (count+15)*16 bi-quadratic filters to store coefficients
+ * @param p array of parameters for 16 filter cascades
+ * @param count number of samples
+ */
+LSP_DSP_LIB_SYMBOL(void, dyn_biquad_design_x16, LSP_DSP_LIB_TYPE(biquad_x16_t) *bf, const LSP_DSP_LIB_TYPE(dyn_filter_params_t) *p, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_DYNAMIC_H_ */
@@ -61,4 +61,147 @@ LSP_DSP_LIB_SYMBOL(void, biquad_process_x4, float *dst, const float *src, size_t
  */
 LSP_DSP_LIB_SYMBOL(void, biquad_process_x8, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
 
+/** Process sixteen bi-quadratic filters for multiple samples simultaneously
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param d pointer to filter memory (32 floats): d0 of each filter followed by d1 of each filter
+ * @param count number of samples to process
+ * @param f bi-quadratic filter bank, should be aligned to 64-byte boundary for best performance
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x16, float *dst, const float *src, float *d, size_t count, const LSP_DSP_LIB_TYPE(biquad_x16_t) *f);
+
+/** Process four independent bi-quadratic filters applied to four interleaved channels,
+ * one filter per channel. The filter coefficients of the channel j are stored in the j'th
+ * element of the x4 bank, the filter memory of the channel j is stored in d[j] and d[j+4].
+ * Unused channels should have all coefficients set to zero.
+ *
+ * @param dst destination frames of four interleaved samples
+ * @param src source frames of four interleaved samples
+ * @param count number of frames to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_c4, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process eight independent bi-quadratic filters applied to eight interleaved channels,
+ * one filter per channel. The filter coefficients of the channel j are stored in the j'th
+ * element of the x8 bank, the filter memory of the channel j is stored in d[j] and d[j+8].
+ * Unused channels should have all coefficients set to zero.
+ *
+ * @param dst destination frames of eight interleaved samples
+ * @param src source frames of eight interleaved samples
+ * @param count number of frames to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_c8, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process sixteen independent bi-quadratic filters applied to sixteen interleaved channels,
+ * one filter per channel. The channels are served by two consecutive filter structures
+ * with the same layout as for the biquad_process_c8() function: channels 0-7 by the first
+ * structure and channels 8-15 by the second one.
+ * Unused channels should have all coefficients set to zero.
+ *
+ * @param dst destination frames of sixteen interleaved samples
+ * @param src source frames of sixteen interleaved samples
+ * @param count number of frames to process
+ * @param f array of two bi-quadratic filter structures
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_c16, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process eight independent bi-quadratic filters applied to eight chunks of the buffer
+ * placed at the same distance from each other, one filter per chunk: the chunk j starts
+ * at the sample j*stride. The layout of the filter structure is the same as for the
+ * biquad_process_c8() function.
+ *
+ * @param dst destination buffer, may be the same as src
+ * @param src source buffer
+ * @param stride distance between the beginnings of two consecutive chunks in samples
+ * @param count number of samples to process in each chunk, should not exceed stride
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_s8, float *dst, const float *src, size_t stride, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process one bi-quadratic filter per channel for the interleaved multichannel buffer.
+ * Channels are split into groups of eight, each group is processed by the separate filter
+ * structure with the same layout as for the biquad_process_c8() function, the last group
+ * may be incomplete. While more than eight channels remain, two consecutive groups are
+ * processed at once by the biquad_process_c16() function, the tail of at most four channels
+ * is processed by the biquad_process_c4() function.
+ *
+ * @param dst destination frames of interleaved samples, may be the same as src
+ * @param src source frames of interleaved samples
+ * @param channels number of channels in the frame
+ * @param count number of frames to process
+ * @param f array of (channels + 7)/8 bi-quadratic filter structures
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_imc, float *dst, const float *src, size_t channels, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process one bi-quadratic filter per channel for the set of separate channel buffers.
+ * Channels are split into groups of eight, each group is processed by the separate filter
+ * structure with the same layout as for the biquad_process_c8() function, the last group
+ * may be incomplete. While more than eight channels remain, two consecutive groups are
+ * processed at once by the biquad_process_c16() function, the tail of at most four channels
+ * is processed by the biquad_process_c4() function.
+ *
+ * @param dst array of destination buffers, each buffer may be the same as the source one
+ * @param src array of source buffers
+ * @param channels number of channels
+ * @param count number of samples to process for each channel
+ * @param f array of (channels + 7)/8 bi-quadratic filter structures
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_mc, float * const *dst, const float * const *src, size_t channels, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process single bi-quadratic filter for the long buffer in the block-parallel mode.
+ * The buffer is split into eight chunks which are processed simultaneously by the
+ * biquad_process_s8() function starting with the zero state,
+ * after that the actual state of the filter is propagated through the chunks using
+ * the state-transition matrix and the zero-input response of the filter is added
+ * to the output of each chunk. Short buffers are processed serially.
+ * The result matches the biquad_process_x1() function up to the rounding error.
+ *
+ * @param dst destination buffer, may be the same as src
+ * @param src source buffer
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure with the x1 layout
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x1_bp, float *dst, const float *src, size_t count, LSP_DSP_LIB_TYPE(biquad_t) *f);
+
+/** Process single bi-quadratic filter for multiple samples with double precision.
+ * The double-precision biquad functions are not vectorized for ARM (NEON, ASIMD),
+ * these targets use the generic implementation.
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x1_f64, double *dst, const double *src, size_t count, LSP_DSP_LIB_TYPE(biquad_f64_t) *f);
+
+/** Process two bi-quadratic filters for multiple samples simultaneously with double precision
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x2_f64, double *dst, const double *src, size_t count, LSP_DSP_LIB_TYPE(biquad_f64_t) *f);
+
+/** Process four bi-quadratic filters for multiple samples simultaneously with double precision
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x4_f64, double *dst, const double *src, size_t count, LSP_DSP_LIB_TYPE(biquad_f64_t) *f);
+
+/** Process eight bi-quadratic filters for multiple samples simultaneously with double precision
+ *
+ * @param dst destination samples
+ * @param src source samples
+ * @param count number of samples to process
+ * @param f bi-quadratic filter structure
+ */
+LSP_DSP_LIB_SYMBOL(void, biquad_process_x8_f64, double *dst, const double *src, size_t count, LSP_DSP_LIB_TYPE(biquad_f64_t) *f);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_FILTERS_STATIC_H_ */
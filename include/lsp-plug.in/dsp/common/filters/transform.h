@@ -64,6 +64,51 @@ LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x4, LSP_DSP_LIB_TYPE(biquad_x4_t) *b
  */
 LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x8, LSP_DSP_LIB_TYPE(biquad_x8_t) *bf, const LSP_DSP_LIB_TYPE(f_cascade_t) *bc, float kf, size_t count);
 
+/** Perform bilinear transformation of sixteen filter banks
+ *
+ * @param bf memory-aligned target transformed biquad x16 filters
+ * @param bc memory-aligned source analog bilinear filter cascades matrix
+ * @param kf frequency shift coefficient
+ * @param count number of matrix rows to process
+ */
+LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x16, LSP_DSP_LIB_TYPE(biquad_x16_t) *bf, const LSP_DSP_LIB_TYPE(f_cascade_t) *bc, float kf, size_t count);
+
+/** Perform bilinear transformation of one filter bank with double precision
+ *
+ * @param bf memory-aligned target transformed biquad x1 filters
+ * @param bc memory-aligned source analog bilinear filter cascades
+ * @param kf frequency shift coefficient
+ * @param count number of cascades to process
+ */
+LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x1_f64, LSP_DSP_LIB_TYPE(biquad_f64_x1_t) *bf, const LSP_DSP_LIB_TYPE(f64_cascade_t) *bc, double kf, size_t count);
+
+/** Perform bilinear transformation of two filter banks with double precision
+ *
+ * @param bf memory-aligned target transformed biquad x2 filters
+ * @param bc memory-aligned source analog bilinear filter cascades matrix
+ * @param kf frequency shift coefficient
+ * @param count number of matrix rows to process
+ */
+LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x2_f64, LSP_DSP_LIB_TYPE(biquad_f64_x2_t) *bf, const LSP_DSP_LIB_TYPE(f64_cascade_t) *bc, double kf, size_t count);
+
+/** Perform bilinear transformation of four filter banks with double precision
+ *
+ * @param bf memory-aligned target transformed biquad x4 filters
+ * @param bc memory-aligned source analog bilinear filter cascades matrix
+ * @param kf frequency shift coefficient
+ * @param count number of matrix rows to process
+ */
+LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x4_f64, LSP_DSP_LIB_TYPE(biquad_f64_x4_t) *bf, const LSP_DSP_LIB_TYPE(f64_cascade_t) *bc, double kf, size_t count);
+
+/** Perform bilinear transformation of eight filter banks with double precision
+ *
+ * @param bf memory-aligned target transformed biquad x8 filters
+ * @param bc memory-aligned source analog bilinear filter cascades matrix
+ * @param kf frequency shift coefficient
+ * @param count number of matrix rows to process
+ */
+LSP_DSP_LIB_SYMBOL(void, bilinear_transform_x8_f64, LSP_DSP_LIB_TYPE(biquad_f64_x8_t) *bf, const LSP_DSP_LIB_TYPE(f64_cascade_t) *bc, double kf, size_t count);
+
 //---------------------------------------------------------------------------------------
 // Matched Z transformation of dynamic filters
 //---------------------------------------------------------------------------------------
@@ -194,6 +194,52 @@
 #define LSP_DSP_BIQUAD_ALIGN            0x40
 #define LSP_DSP_BIQUAD_D_ITEMS          16
 
+/**
+ * The same constants for the double-precision biquad_f64_t structure
+ */
+#define LSP_DSP_BIQUAD_F64_XN_OFF       0x80
+#define LSP_DSP_BIQUAD_F64_XN_SOFF      "0x80"
+
+/**
+ * Types of second-order filters produced by the filter design functions.
+ * The analog prototypes of the filters with the normalized cutoff frequency are:
+ *
+ *   LOPASS     H(s) = G / (s^2 + s/Q + 1)
+ *   HIPASS     H(s) = G*s^2 / (s^2 + s/Q + 1)
+ *   BANDPASS   H(s) = G*s/Q / (s^2 + s/Q + 1)
+ *   NOTCH      H(s) = G*(s^2 + 1) / (s^2 + s/Q + 1)
+ *   ALLPASS    H(s) = G*(s^2 - s/Q + 1) / (s^2 + s/Q + 1)
+ *   PEAK       H(s) = (s^2 + s*A/Q + 1) / (s^2 + s/(A*Q) + 1)
+ *   LOSHELF    H(s) = A*(s^2 + s*sqrt(A)/Q + A) / (A*s^2 + s*sqrt(A)/Q + 1)
+ *   HISHELF    H(s) = A*(A*s^2 + s*sqrt(A)/Q + 1) / (s^2 + s*sqrt(A)/Q + A)
+ *
+ * where G is the linear gain of the filter and A = sqrt(G).
+ */
+#define LSP_DSP_FILTER_LOPASS           0
+#define LSP_DSP_FILTER_HIPASS           1
+#define LSP_DSP_FILTER_BANDPASS         2
+#define LSP_DSP_FILTER_NOTCH            3
+#define LSP_DSP_FILTER_ALLPASS          4
+#define LSP_DSP_FILTER_PEAK             5
+#define LSP_DSP_FILTER_LOSHELF          6
+#define LSP_DSP_FILTER_HISHELF          7
+
+/**
+ * Types of high-order filters built of the chain of second-order cascades,
+ * the order of the filter is twice the number of cascades:
+ *
+ *   BT_LOPASS, BT_HIPASS   Butterworth filters
+ *   CH_LOPASS, CH_HIPASS   Chebyshev type I filters with the passband ripple specified in decibels,
+ *                          the cutoff frequency is the edge of the passband
+ *   LR_LOPASS, LR_HIPASS   Linkwitz-Riley filters, squared Butterworth filters of the half order
+ */
+#define LSP_DSP_FILTER_BT_LOPASS        8
+#define LSP_DSP_FILTER_BT_HIPASS        9
+#define LSP_DSP_FILTER_CH_LOPASS        10
+#define LSP_DSP_FILTER_CH_HIPASS        11
+#define LSP_DSP_FILTER_LR_LOPASS        12
+#define LSP_DSP_FILTER_LR_HIPASS        13
+
 LSP_DSP_LIB_BEGIN_NAMESPACE
 
 #pragma pack(push, 1)
@@ -260,6 +306,19 @@ typedef struct LSP_DSP_LIB_TYPE(biquad_x8_t)
     float   a2[8];
 } LSP_DSP_LIB_TYPE(biquad_x8_t);
 
+/**
+ * Biquad filter bank for 16 digital biquad filters, has no place in the biquad_t
+ * structure and is used with the separately allocated filter memory of 32 floats
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_x16_t)
+{
+    float   b0[16];
+    float   b1[16];
+    float   b2[16];
+    float   a1[16];
+    float   a2[16];
+} LSP_DSP_LIB_TYPE(biquad_x16_t);
+
 /**
  * This is main filter structure with memory elements
  * It should be aligned at least to 16-byte boundary due to
@@ -279,6 +338,110 @@ typedef struct LSP_DSP_LIB_TYPE(biquad_t)
     float   __pad[8];
 } __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(biquad_t);
 
+/**
+ * Double-precision analog filter cascade transfer function
+ */
+typedef struct LSP_DSP_LIB_TYPE(f64_cascade_t)
+{
+    double      t[4];       // Top part of polynom (zeros): T[p] = t[0] + t[1] * p + t[2] * p^2
+    double      b[4];       // Bottom part of polynom (poles): B[p] = b[0] + b[1] * p + b[2] * p^2
+} LSP_DSP_LIB_TYPE(f64_cascade_t);
+
+/**
+ * Double-precision biquad filter bank for 1 digital biquad filter
+ * Non-used elements should be filled with zeros
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_f64_x1_t)
+{
+    double  b0, b1, b2;     //  b0 b1 b2
+    double  a1, a2;         //  a1 a2
+    double  p0, p1, p2;     //  padding (not used), SHOULD be zero
+} LSP_DSP_LIB_TYPE(biquad_f64_x1_t);
+
+/**
+ * Double-precision biquad filter bank for 2 digital biquad filters
+ * Non-used elements should be filled with zeros
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_f64_x2_t)
+{
+    double  b0[2];
+    double  b1[2];
+    double  b2[2];
+    double  a1[2];
+    double  a2[2];
+    double  p[2];           // padding (not used), SHOULD be zero
+} LSP_DSP_LIB_TYPE(biquad_f64_x2_t);
+
+/**
+ * Double-precision biquad filter bank for 4 digital biquad filters
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_f64_x4_t)
+{
+    double  b0[4];
+    double  b1[4];
+    double  b2[4];
+    double  a1[4];
+    double  a2[4];
+} LSP_DSP_LIB_TYPE(biquad_f64_x4_t);
+
+/**
+ * Double-precision biquad filter bank for 8 digital biquad filters
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_f64_x8_t)
+{
+    double  b0[8];
+    double  b1[8];
+    double  b2[8];
+    double  a1[8];
+    double  a2[8];
+} LSP_DSP_LIB_TYPE(biquad_f64_x8_t);
+
+/**
+ * Double-precision filter structure with memory elements,
+ * has the same layout as biquad_t with all elements twice wider.
+ * The double-precision filtering functions have SSE2 and AVX implementations,
+ * ARM targets (NEON, ASIMD) deliberately use the generic implementation.
+ */
+typedef struct LSP_DSP_LIB_TYPE(biquad_f64_t)
+{
+    double  d[LSP_DSP_BIQUAD_D_ITEMS];
+    union
+    {
+        LSP_DSP_LIB_TYPE(biquad_f64_x1_t) x1;
+        LSP_DSP_LIB_TYPE(biquad_f64_x2_t) x2;
+        LSP_DSP_LIB_TYPE(biquad_f64_x4_t) x4;
+        LSP_DSP_LIB_TYPE(biquad_f64_x8_t) x8;
+    };
+    double  __pad[8];
+} __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(biquad_f64_t);
+
+/**
+ * Per-sample parameters of the modulated filter cascade used by the dynamic filter
+ * design functions. Any parameter array may be NULL, the constant value is used then.
+ */
+typedef struct LSP_DSP_LIB_TYPE(dyn_filter_params_t)
+{
+    const float    *freq;       // Normalized frequency of the filter, f/sample_rate, should be in range (0, 0.5)
+    const float    *gain;       // Linear gain of the filter
+    const float    *q;          // Quality factor of the filter
+    float           k_freq;     // Constant normalized frequency if freq is NULL
+    float           k_gain;     // Constant gain if gain is NULL
+    float           k_q;        // Constant quality factor if q is NULL
+    uint32_t        type;       // Type of the second-order filter, LSP_DSP_FILTER_LOPASS .. LSP_DSP_FILTER_HISHELF
+} LSP_DSP_LIB_TYPE(dyn_filter_params_t);
+
+/**
+ * Parameters of the filter used by the batch filter design functions
+ */
+typedef struct LSP_DSP_LIB_TYPE(filter_params_t)
+{
+    uint32_t        type;       // Type of the filter, LSP_DSP_FILTER_*
+    uint32_t        slope;      // Number of second-order cascades of the filter, 0 is treated as 1
+    float           freq;       // Normalized frequency of the filter, f/sample_rate, should be in range (0, 0.5)
+    float           gain;       // Linear gain of the filter
+    float           q;          // Quality factor of the filter, passband ripple in decibels for Chebyshev filters
+} LSP_DSP_LIB_TYPE(filter_params_t);
+
 #pragma pack(pop)
 
 LSP_DSP_LIB_END_NAMESPACE
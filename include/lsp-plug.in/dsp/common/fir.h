@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_FIR_H_
+#define LSP_PLUG_IN_DSP_COMMON_FIR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Streaming FIR filter with zero latency. The filter keeps the pending tail of the
+ * convolution between calls, so the signal can be processed by blocks of any size
+ * without additional allocations and without shifting the history by the caller.
+ * Short kernels are applied in the time domain by the convolve() function, long kernels
+ * are applied by the fastconv_parse_apply() function for each full block of 2^(rank-1)
+ * samples where 2^(rank-1) is the smallest power of two not less than the kernel length.
+ *
+ * The object is opaque, it should be created with fir_create() and destroyed
+ * with fir_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(fir_t) LSP_DSP_LIB_TYPE(fir_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create streaming FIR filter. The kernel data is copied and not referenced by the filter.
+ *
+ * @param kernel filter kernel (impulse response)
+ * @param taps number of taps in the kernel, should be positive
+ * @return pointer to the FIR filter or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(fir_t) *, fir_create, const float *kernel, size_t taps);
+
+/**
+ * Destroy the FIR filter and free all allocated resources
+ *
+ * @param fir FIR filter to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_destroy, LSP_DSP_LIB_TYPE(fir_t) *fir);
+
+/**
+ * Reset the internal state of the FIR filter (pending tail of the convolution)
+ *
+ * @param fir FIR filter to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_reset, LSP_DSP_LIB_TYPE(fir_t) *fir);
+
+/**
+ * Process the signal by the FIR filter. The source and destination buffers may be the same.
+ *
+ * @param fir FIR filter
+ * @param dst destination buffer
+ * @param src source buffer
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_process, LSP_DSP_LIB_TYPE(fir_t) *fir,
+    float *dst, const float *src, size_t count);
+
+/**
+ * Design linear-phase FIR filter from the sampled magnitude response. The magnitude response
+ * is transformed to the impulse response by the inverse FFT, delayed by (taps-1)/2 samples,
+ * truncated to the desired number of taps and multiplied by the window. Filters with even
+ * number of taps always have zero response at the Nyquist frequency.
+ *
+ * @param dst destination buffer to store the kernel of the filter
+ * @param mag magnitude response at 2^(rank-1)+1 frequencies evenly spaced from zero to Nyquist frequency
+ * @param window window of taps samples to apply to the kernel, should be generated with
+ *        LSP_DSP_WINDOW_SYMMETRIC mode, may be NULL for no windowing
+ * @param taps number of taps in the kernel, should be in range of 1 to 2^rank
+ * @param rank the rank of FFT, should be at least 2
+ * @param tmp temporary buffer of 2^(rank+2) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_design_linear, float *dst, const float *mag, const float *window,
+    size_t taps, size_t rank, float *tmp);
+
+/**
+ * Design minimum-phase FIR filter from the sampled magnitude response using the real
+ * cepstrum (homomorphic method). Magnitudes below LSP_DSP_AMPLIFICATION_THRESH are
+ * limited to the threshold.
+ *
+ * @param dst destination buffer to store the kernel of the filter
+ * @param mag magnitude response at 2^(rank-1)+1 frequencies evenly spaced from zero to Nyquist frequency
+ * @param window window of taps samples to apply to the kernel, may be NULL for no windowing
+ * @param taps number of taps in the kernel, should be in range of 1 to 2^rank
+ * @param rank the rank of FFT, should be at least 2
+ * @param tmp temporary buffer of 2^(rank+2) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_design_minimum, float *dst, const float *mag, const float *window,
+    size_t taps, size_t rank, float *tmp);
+
+/**
+ * Convert the impulse response to minimum phase keeping the magnitude response sampled by
+ * the FFT of 2^rank points. The rank should be large enough (usually, at least four times
+ * of the impulse response length) to avoid time aliasing of the cepstrum.
+ *
+ * @param dst destination buffer to store taps samples of minimum-phase impulse response
+ * @param src source impulse response
+ * @param count number of samples in the source impulse response, should not be greater than 2^rank
+ * @param taps number of samples to store, should be in range of 1 to 2^rank
+ * @param rank the rank of FFT, should be at least 2
+ * @param tmp temporary buffer of 2^(rank+2) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_minimum_phase, float *dst, const float *src, size_t count,
+    size_t taps, size_t rank, float *tmp);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_FIR_H_ */
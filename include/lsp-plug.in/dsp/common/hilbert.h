@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_HILBERT_H_
+#define LSP_PLUG_IN_DSP_COMMON_HILBERT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/filters/types.h>
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * IIR Hilbert transformer built of two chains of four all-pass sections in z^-2:
+ *
+ *              c - z^-2
+ *     A[z] = ────────────
+ *             1 - c*z^-2
+ *
+ * Each chain is stored as x4 biquad filter bank with b0 = c, b2 = -1, a2 = c and processed
+ * by biquad_process_x4(). The output of the second chain is additionally delayed by one
+ * sample and lags the output of the first chain by 90 degrees within 0.7 degrees in range
+ * of 0.002 to 0.998 of Nyquist frequency (20 Hz to 22 kHz at 44.1 kHz sample rate).
+ */
+typedef struct LSP_DSP_LIB_TYPE(hilbert_t)
+{
+    LSP_DSP_LIB_TYPE(biquad_t)  re;         // All-pass chain of the real part of the analytic signal
+    LSP_DSP_LIB_TYPE(biquad_t)  im;         // All-pass chain of the imaginary part of the analytic signal
+    float                       delay;      // Delayed sample of the imaginary part
+    float                       __pad[15];
+} __lsp_aligned(LSP_DSP_BIQUAD_ALIGN) LSP_DSP_LIB_TYPE(hilbert_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Initialize the coefficients and clear the state of the IIR Hilbert transformer
+ *
+ * @param h Hilbert transformer to initialize
+ */
+LSP_DSP_LIB_SYMBOL(void, hilbert_init, LSP_DSP_LIB_TYPE(hilbert_t) *h);
+
+/**
+ * Compute the analytic signal by the IIR Hilbert transformer. The real part of the
+ * analytic signal is the phase-shifted source signal, the imaginary part is
+ * shifted by additional 90 degrees, so the envelope can be computed by the
+ * complex_mod() function and the frequency shifting can be performed by the
+ * complex_mul3() function. The real part may be stored to the source buffer.
+ *
+ * @param dst_re real part of the analytic signal
+ * @param dst_im imaginary part of the analytic signal, should not overlap with the source buffer
+ * @param src source signal
+ * @param count number of samples to process
+ * @param h Hilbert transformer
+ */
+LSP_DSP_LIB_SYMBOL(void, hilbert_process, float *dst_re, float *dst_im, const float *src, size_t count,
+    LSP_DSP_LIB_TYPE(hilbert_t) *h);
+
+/**
+ * Compute the analytic signal of the block of 2^rank samples by the FFT. The negative
+ * frequencies of the spectrum are removed, the positive frequencies are doubled. The
+ * signal is treated as periodic, so the block should be windowed or overlapped by the
+ * caller to avoid the discontinuity at the block boundaries. The real part is equal
+ * to the source signal, the imaginary part is its Hilbert transform.
+ *
+ * @param dst_re real part of the analytic signal, may be the same as the source buffer
+ * @param dst_im imaginary part of the analytic signal, should not overlap with the source buffer
+ * @param src source signal of 2^rank samples
+ * @param rank the rank of FFT, should be at least 2
+ */
+LSP_DSP_LIB_SYMBOL(void, hilbert_fft, float *dst_re, float *dst_im, const float *src, size_t rank);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_HILBERT_H_ */
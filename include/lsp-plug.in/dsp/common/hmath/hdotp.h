@@ -51,4 +51,13 @@ LSP_DSP_LIB_SYMBOL(float, h_sqr_dotp, const float *a, const float *b, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(float, h_abs_dotp, const float *a, const float *b, size_t count);
 
+/** Calculate dot product with double precision: sum {from 0 to count-1} (a[i] * b[i])
+ *
+ * @param a first vector
+ * @param b second vector
+ * @param count number of elements
+ * @return scalar multiplication
+ */
+LSP_DSP_LIB_SYMBOL(double, h_dotp_f64, const double *a, const double *b, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_HMATH_HDOTP_H_ */
@@ -48,4 +48,12 @@ LSP_DSP_LIB_SYMBOL(float, h_sqr_sum, const float *src, size_t count);
  */
 LSP_DSP_LIB_SYMBOL(float, h_abs_sum, const float *src, size_t count);
 
+/** Calculate horizontal sum with double precision: result = sum (i) from 0 to count-1 src[i]
+ *
+ * @param src vector to summarize
+ * @param count number of elements
+ * @return status of operation
+ */
+LSP_DSP_LIB_SYMBOL(double, h_sum_f64, const double *src, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_HMATH_HSUM_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_
+#define LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+#include <lsp-plug.in/dsp/common/fft.h>
+
+// Maximum number of threads in the pool of workers
+#define LSP_DSP_WORKERS_MAX                 256
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Pool of worker threads for the parallel execution of large offline (batch) jobs.
+ * Parallel functions allocate temporary memory and synchronize threads, so they
+ * should never be used for real-time processing: the regular single-threaded
+ * functions remain allocation-free.
+ *
+ * The pool executes one job at a time, so it should not be used by multiple
+ * threads simultaneously. The object is opaque, it should be created with
+ * workers_create() and destroyed with workers_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(workers_t) LSP_DSP_LIB_TYPE(workers_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create pool of worker threads
+ *
+ * @param threads overall number of threads that execute the job including the calling
+ *        thread, should be in range of 1 to LSP_DSP_WORKERS_MAX
+ * @return pointer to the pool or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(workers_t) *, workers_create, size_t threads);
+
+/**
+ * Stop all threads of the pool and free all allocated resources
+ *
+ * @param pool pool to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, workers_destroy, LSP_DSP_LIB_TYPE(workers_t) *pool);
+
+/**
+ * Get the overall number of threads that execute the job including the calling thread
+ *
+ * @param pool pool of workers
+ * @return number of threads
+ */
+LSP_DSP_LIB_SYMBOL(size_t, workers_threads, const LSP_DSP_LIB_TYPE(workers_t) *pool);
+
+/**
+ * Perform the direct FFT of the packed complex data using the pool of workers.
+ * The transform of 2^rank points is split into 2^(rank/2) and 2^(rank - rank/2)
+ * point sub-transforms (six-step algorithm) which are computed in parallel.
+ * The result is the same as the result of plan_packed_direct_fft() function.
+ * The pool keeps plans of the sub-transforms and the intermediate buffer for the
+ * rank of the last transform, so they are built only once for the series of
+ * transforms of the same rank and released by workers_destroy().
+ *
+ * @param pool pool of workers
+ * @param plan FFT plan
+ * @param dst destination buffer of 2^(rank+1) floats, may be the same as the source buffer
+ * @param src source buffer of 2^(rank+1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_packed_direct_fft, LSP_DSP_LIB_TYPE(workers_t) *pool,
+    const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/**
+ * Perform the reverse FFT of the packed complex data using the pool of workers.
+ * The result is the same as the result of plan_packed_reverse_fft() function.
+ * Plans of the sub-transforms are shared with parallel_packed_direct_fft().
+ *
+ * @param pool pool of workers
+ * @param plan FFT plan
+ * @param dst destination buffer of 2^(rank+1) floats, may be the same as the source buffer
+ * @param src source buffer of 2^(rank+1) floats
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_packed_reverse_fft, LSP_DSP_LIB_TYPE(workers_t) *pool,
+    const LSP_DSP_LIB_TYPE(fft_plan_t) *plan, float *dst, const float *src);
+
+/**
+ * Calculate convolution of the source signal and the convolution using the pool of workers
+ * and add the result to the destination buffer. The signal is split into blocks of 2^(rank-1)
+ * samples and the convolution into partitions of the same size, the output blocks are
+ * computed in parallel with the fastconv_* functions.
+ *
+ * @param pool pool of workers
+ * @param dst destination buffer of count + length - 1 samples to add the result of convolution
+ * @param src source signal
+ * @param conv convolution
+ * @param length length of convolution
+ * @param count the number of samples in source signal to process
+ * @param rank the fast convolution rank, should be in range of 5 to 16
+ */
+LSP_DSP_LIB_SYMBOL(void, parallel_convolve, LSP_DSP_LIB_TYPE(workers_t) *pool,
+    float *dst, const float *src, const float *conv, size_t length, size_t count, size_t rank);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_PARALLEL_H_ */
@@ -108,6 +108,17 @@ LSP_DSP_LIB_SYMBOL(void, pcomplex_fill_ri, float *dst, float re, float im, size_
  */
 LSP_DSP_LIB_SYMBOL(void, pcomplex_r2c, float *dst, const float *src, size_t count);
 
+/** Convert real to packed complex and apply the window in the same pass:
+ *  dst[i].re = src[i] * w[i]
+ *  dst[i].im = 0
+ *
+ * @param dst destination packed complex data, should not overlap with the source data
+ * @param src source real data
+ * @param w window
+ * @param count number of items to convert
+ */
+LSP_DSP_LIB_SYMBOL(void, pcomplex_r2c_mul3, float *dst, const float *src, const float *w, size_t count);
+
 /** Convert packed complex to real:
  *  dst[i] = src[i].re
  *
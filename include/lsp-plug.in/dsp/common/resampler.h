@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_
+#define LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+// Limits of the resampler kernel
+#define LSP_DSP_RESAMPLER_LOBES_MIN         2
+#define LSP_DSP_RESAMPLER_LOBES_MAX         64
+#define LSP_DSP_RESAMPLER_PHASES_MAX        1024
+#define LSP_DSP_RESAMPLER_RATIO_MAX         256
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Arbitrary-ratio polyphase resampler. The interpolation kernel is a lanczos filter
+ * which is tabulated once at the creation time for the set of fractional phases.
+ * For the rational ratio L/M with L not greater than LSP_DSP_RESAMPLER_PHASES_MAX
+ * the number of phases is a multiple of L and the nominal ratio is reproduced exactly,
+ * otherwise (and for the ratio changed by resampler_set_ratio()) the kernel is linearly
+ * interpolated between adjacent phases. The input history is
+ * kept between calls, so the signal can be processed by blocks of arbitrary size.
+ *
+ * The object is opaque, it should be created with resampler_create() and destroyed
+ * with resampler_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(resampler_t) LSP_DSP_LIB_TYPE(resampler_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create resampler. The ratio of the sample rates is reduced to the irreducible
+ * fraction, for example 44100 -> 48000 gives 147 -> 160. When the output sample
+ * rate is lower than the input one, the cutoff frequency of the kernel is lowered
+ * to the output Nyquist frequency and the kernel becomes respectively longer.
+ * The ratio of the sample rates should be in range of 1/LSP_DSP_RESAMPLER_RATIO_MAX
+ * to LSP_DSP_RESAMPLER_RATIO_MAX, which limits the kernel length to
+ * 2 * LSP_DSP_RESAMPLER_RATIO_MAX * lobes taps.
+ *
+ * @param in_rate input sample rate, should be positive
+ * @param out_rate output sample rate, should be positive
+ * @param lobes number of lanczos lobes at each side of the kernel, should be in range of
+ *        LSP_DSP_RESAMPLER_LOBES_MIN to LSP_DSP_RESAMPLER_LOBES_MAX
+ * @return pointer to the resampler or NULL on error or if the ratio is out of range
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(resampler_t) *, resampler_create,
+    size_t in_rate, size_t out_rate, size_t lobes);
+
+/**
+ * Destroy the resampler and free all allocated resources
+ *
+ * @param rs resampler to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_destroy, LSP_DSP_LIB_TYPE(resampler_t) *rs);
+
+/**
+ * Reset the internal state of the resampler (input history and phase), the
+ * resampling ratio is restored to the nominal one
+ *
+ * @param rs resampler to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_reset, LSP_DSP_LIB_TYPE(resampler_t) *rs);
+
+/**
+ * Change the resampling ratio without resetting the state, for example to compensate
+ * the clock drift. The kernel is not re-computed, so the ratio is limited to the range
+ * of 0.5 to 2.0 of the nominal ratio, and should be kept close to the nominal one
+ * when downsampling to avoid aliasing.
+ *
+ * @param rs resampler
+ * @param ratio ratio of output sample rate to input sample rate, should be positive
+ */
+LSP_DSP_LIB_SYMBOL(void, resampler_set_ratio, LSP_DSP_LIB_TYPE(resampler_t) *rs, double ratio);
+
+/**
+ * Get the actual resampling ratio
+ *
+ * @param rs resampler
+ * @return ratio of output sample rate to input sample rate
+ */
+LSP_DSP_LIB_SYMBOL(double, resampler_get_ratio, const LSP_DSP_LIB_TYPE(resampler_t) *rs);
+
+/**
+ * Get the latency of the resampler. The output signal is not delayed relatively
+ * to the input signal, but each output sample is emitted only after the specified
+ * number of input samples following it have been received.
+ *
+ * @param rs resampler
+ * @return latency in input samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, resampler_latency, const LSP_DSP_LIB_TYPE(resampler_t) *rs);
+
+/**
+ * Get the maximum number of samples that can be produced by the resampler
+ * for the specified number of input samples at the current ratio
+ *
+ * @param rs resampler
+ * @param count number of input samples
+ * @return maximum number of output samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, resampler_max_output, const LSP_DSP_LIB_TYPE(resampler_t) *rs, size_t count);
+
+/**
+ * Resample the signal. The source and destination buffers should not overlap.
+ *
+ * @param rs resampler
+ * @param dst destination buffer of at least resampler_max_output(rs, count) samples
+ * @param src source buffer
+ * @param count number of input samples to process
+ * @return number of samples written to the destination buffer
+ */
+LSP_DSP_LIB_SYMBOL(size_t, resampler_process, LSP_DSP_LIB_TYPE(resampler_t) *rs,
+    float *dst, const float *src, size_t count);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_RESAMPLER_H_ */
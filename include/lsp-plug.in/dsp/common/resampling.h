@@ -358,4 +358,321 @@ LSP_DSP_LIB_SYMBOL(void, downsample_6x, float *dst, const float *src, size_t cou
  */
 LSP_DSP_LIB_SYMBOL(void, downsample_8x, float *dst, const float *src, size_t count);
 
+/** Apply decimating FIR filter: compute each factor'th sample of the convolution
+ *
+ *   dst[i] = sum { k[j] * src[i*factor + j] } for j = 0 .. taps-1
+ *
+ * The function has SSE, AVX and AVX-512 implementations, ARM targets (NEON, ASIMD)
+ * deliberately use the generic implementation. The same applies to the lanczos_decimate_*
+ * functions which are built on top of fir_decimate().
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of (count - 1)*factor + taps samples
+ * @param k filter kernel
+ * @param taps number of kernel taps
+ * @param factor decimation factor
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, fir_decimate, float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+
+/** Perform 2x lanczos decimation (2 lobes): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 1 sample.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x2, float *dst, const float *src, size_t count);
+
+/** Perform 2x lanczos decimation (3 lobes): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 2 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x3, float *dst, const float *src, size_t count);
+
+/** Perform 2x lanczos decimation (4 lobes): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x4, float *dst, const float *src, size_t count);
+
+/** Perform 2x lanczos decimation (4 lobes for 12-bit sample precision): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x12bit, float *dst, const float *src, size_t count);
+
+/** Perform 2x lanczos decimation (10 lobes for 16-bit sample precision): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 9 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x16bit, float *dst, const float *src, size_t count);
+
+/** Perform 2x lanczos decimation (62 lobes for 24-bit sample precision): low-pass filter the signal and keep each 2nd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 61 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*2 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_2x24bit, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (2 lobes): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 1 sample.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x2, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (3 lobes): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 2 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x3, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (4 lobes): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x4, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (4 lobes for 12-bit sample precision): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x12bit, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (10 lobes for 16-bit sample precision): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 9 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x16bit, float *dst, const float *src, size_t count);
+
+/** Perform 3x lanczos decimation (62 lobes for 24-bit sample precision): low-pass filter the signal and keep each 3rd sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 61 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*3 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_3x24bit, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (2 lobes): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 1 sample.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x2, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (3 lobes): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 2 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x3, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (4 lobes): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x4, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (4 lobes for 12-bit sample precision): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x12bit, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (10 lobes for 16-bit sample precision): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 9 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x16bit, float *dst, const float *src, size_t count);
+
+/** Perform 4x lanczos decimation (62 lobes for 24-bit sample precision): low-pass filter the signal and keep each 4th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 61 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*4 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_4x24bit, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (2 lobes): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 1 sample.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x2, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (3 lobes): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 2 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x3, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (4 lobes): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x4, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (4 lobes for 12-bit sample precision): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x12bit, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (10 lobes for 16-bit sample precision): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 9 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x16bit, float *dst, const float *src, size_t count);
+
+/** Perform 6x lanczos decimation (62 lobes for 24-bit sample precision): low-pass filter the signal and keep each 6th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 61 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*6 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_6x24bit, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (2 lobes): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 1 sample.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x2, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (3 lobes): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 2 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x3, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (4 lobes): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x4, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (4 lobes for 12-bit sample precision): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 3 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x12bit, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (10 lobes for 16-bit sample precision): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 9 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x16bit, float *dst, const float *src, size_t count);
+
+/** Perform 8x lanczos decimation (62 lobes for 24-bit sample precision): low-pass filter the signal and keep each 8th sample.
+ * Only kept samples are computed. The LSP_DSP_RESAMPLING_RSV_SAMPLES samples preceding the source
+ * buffer should contain the previous input (or zeros), the output is delayed by 61 samples.
+ *
+ * @param dst destination buffer of count samples
+ * @param src source buffer of count*8 samples
+ * @param count number of samples to produce
+ */
+LSP_DSP_LIB_SYMBOL(void, lanczos_decimate_8x24bit, float *dst, const float *src, size_t count);
+
 #endif /* LSP_PLUG_IN_DSP_COMMON_RESAMPLING_H_ */
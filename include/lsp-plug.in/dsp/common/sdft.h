@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_SDFT_H_
+#define LSP_PLUG_IN_DSP_COMMON_SDFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+#define LSP_DSP_SDFT_ALIGN                  0x40
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+#pragma pack(push, 1)
+
+/**
+ * Sliding DFT bank for 8 frequency bins. Each bin is a complex resonator with the
+ * exponential window which is updated on each sample:
+ *
+ *   X[n] = r * exp(j*w) * X[n-1] + k * x[n]
+ *
+ * The rotation is implemented in the coupled (Gold-Rader) form with c = r*cos(w),
+ * s = r*sin(w), which has uniform precision of the pole placement over the whole
+ * frequency range. The poles are strictly inside the unit circle, so the rounding
+ * errors decay instead of accumulation like in the classic sliding DFT.
+ *
+ * Each coefficient is packed into distinct SIMD register as in biquad_x8_t:
+ *
+ *   re' = c*re - s*im + k*x
+ *   im' = s*re + c*im
+ *
+ * Non-used bins should be filled with zeros. Banks for more than 8 bins are arrays
+ * of sdft_x8_t structures, bin i is stored at lane (i & 7) of the bank (i >> 3).
+ */
+typedef struct LSP_DSP_LIB_TYPE(sdft_x8_t)
+{
+    float   re[8];          // Real part of the bin state
+    float   im[8];          // Imaginary part of the bin state
+    float   c[8];           // r * cos(w)
+    float   s[8];           // r * sin(w)
+    float   k[8];           // Input gain
+    float   __pad[8];       // padding (not used), SHOULD be zero
+} __lsp_aligned(LSP_DSP_SDFT_ALIGN) LSP_DSP_LIB_TYPE(sdft_x8_t);
+
+#pragma pack(pop)
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Initialize the sliding DFT bank and reset its state. The input gain is set to k = 2*(1 - r),
+ * so a sinusoid of amplitude A at the bin frequency yields the bin magnitude of A.
+ * Unused lanes of the last bank are filled with zeros.
+ *
+ * @param bank array of (bins + 7)/8 banks
+ * @param freq normalized frequencies of bins (frequency / sample rate), range of 0 to 0.5
+ * @param length time constant of the exponential window in samples (r = exp(-1/length)),
+ *        should be in range of 1 to 1e+6, longer windows give narrower bins
+ * @param bins number of bins
+ */
+LSP_DSP_LIB_SYMBOL(void, sdft_init, LSP_DSP_LIB_TYPE(sdft_x8_t) *bank, const float *freq, float length, size_t bins);
+
+/**
+ * Reset the state of the sliding DFT bank, the coefficients are kept
+ *
+ * @param bank array of (bins + 7)/8 banks
+ * @param bins number of bins
+ */
+LSP_DSP_LIB_SYMBOL(void, sdft_reset, LSP_DSP_LIB_TYPE(sdft_x8_t) *bank, size_t bins);
+
+/**
+ * Update all bins of the sliding DFT bank with the input samples, the state
+ * of the bins can be read at any time between calls
+ *
+ * @param bank array of (bins + 7)/8 banks
+ * @param src source samples
+ * @param bins number of bins
+ * @param count number of samples to process
+ */
+LSP_DSP_LIB_SYMBOL(void, sdft_process, LSP_DSP_LIB_TYPE(sdft_x8_t) *bank, const float *src, size_t bins, size_t count);
+
+/**
+ * Compute the magnitude of each bin of the sliding DFT bank: dst[i] = sqrt(re[i]^2 + im[i]^2)
+ *
+ * @param dst destination buffer to store bins magnitudes
+ * @param bank array of (bins + 7)/8 banks
+ * @param bins number of bins
+ */
+LSP_DSP_LIB_SYMBOL(void, sdft_amplitude, float *dst, const LSP_DSP_LIB_TYPE(sdft_x8_t) *bank, size_t bins);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_SDFT_H_ */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_SPECTRUM_H_
+#define LSP_PLUG_IN_DSP_COMMON_SPECTRUM_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+#define LSP_DSP_SPECTRUM_SMOOTH_MAX         0x3ff   /* Maximum half-width of the smoothing window in columns */
+
+/**
+ * Build the map of logarithmic frequency scale for displaying the spectrum.
+ * Column i of the display covers frequencies [fmin * (fmax/fmin)^(i/width), fmin * (fmax/fmin)^((i+1)/width))
+ * and the map stores the index of the first FFT bin of each column, so the map should contain
+ * (width + 1) elements. All indices are limited by the Nyquist bin (1 << (rank - 1)).
+ *
+ * @param map map to store (width + 1) indices of FFT bins
+ * @param fmin the frequency of the left edge of the display, should be positive
+ * @param fmax the frequency of the right edge of the display, should be greater than fmin
+ * @param srate sample rate
+ * @param rank the rank of the FFT
+ * @param width number of columns of the display
+ */
+LSP_DSP_LIB_SYMBOL(void, spectrum_log_map, uint32_t *map, float fmin, float fmax, float srate, size_t rank, size_t width);
+
+/**
+ * Convert the packed complex spectrum into per-column peak and average levels in decibels
+ * in a single pass over the spectrum. Column i takes bins [map[i], max(map[i+1], map[i]+1)),
+ * so each column has at least one bin even if it is narrower than the FFT bin.
+ *
+ * The peak level is the maximum magnitude of the column bins: peak[i] = 20*log10(max |X[k]|).
+ * The average level is the mean power of the column bins: avg[i] = 10*log10(sum |X[k]|^2 / n).
+ * The average level is optionally smoothed by the box window of (2*smooth + 1) columns.
+ * Because columns are equally spaced on the logarithmic scale, this gives the fractional-octave
+ * smoothing, the half-width for 1/N octave smoothing is:
+ *
+ *   smooth = width / (2 * N * log2(fmax / fmin))
+ *
+ * Levels below LSP_DSP_AMPLIFICATION_THRESH are limited to the threshold.
+ *
+ * @param peak destination buffer to store peak levels, width elements
+ * @param avg destination buffer to store average levels, width elements
+ * @param spec packed complex spectrum
+ * @param map map of FFT bins built by spectrum_log_map(), (width + 1) elements
+ * @param smooth half-width of the smoothing window in columns, 0 disables smoothing,
+ *        limited to LSP_DSP_SPECTRUM_SMOOTH_MAX
+ * @param width number of columns of the display
+ */
+LSP_DSP_LIB_SYMBOL(void, spectrum_display, float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_SPECTRUM_H_ */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_STFT_H_
+#define LSP_PLUG_IN_DSP_COMMON_STFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+// Limits of the STFT frame size
+#define LSP_DSP_STFT_RANK_MIN               2
+#define LSP_DSP_STFT_RANK_MAX               16
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * Short-time Fourier transform analysis/resynthesis engine. The input signal is split
+ * into overlapping frames of 2^rank samples with the distance of hop samples between
+ * adjacent frames. Each frame is multiplied by the analysis window and transformed with
+ * real_direct_fft(). The spectrum can be processed in place, then it is transformed back
+ * with real_reverse_fft(), multiplied by the synthesis window and added to the output
+ * signal (weighted overlap-add). The synthesis window is computed from the analysis window
+ * so that the signal is perfectly reconstructed if the spectrum is not modified.
+ *
+ * The windowing is fused with copying of the frame from the input history, and the
+ * synthesis windowing is fused with the overlap-add, so each frame passes the memory
+ * only once at each side of the transform. The input history and the overlap-add buffer
+ * are kept between calls, so the signal can be processed by blocks of arbitrary size.
+ *
+ * The object is opaque, it should be created with stft_create() and destroyed
+ * with stft_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(stft_t) LSP_DSP_LIB_TYPE(stft_t);
+
+/**
+ * Spectrum processing callback, called for each frame
+ *
+ * @param arg argument passed to the stft_process() function
+ * @param spectrum complex spectrum [re, im, re, im ...] of 2^(rank-1)+1 harmonics
+ *        (2^rank+2 floats) in the format of real_direct_fft(), may be modified in place
+ * @param rank the rank of FFT
+ */
+typedef void (* LSP_DSP_LIB_TYPE(stft_callback_t))(void *arg, float *spectrum, size_t rank);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create STFT engine
+ *
+ * @param rank the rank of FFT, should be in range of LSP_DSP_STFT_RANK_MIN to LSP_DSP_STFT_RANK_MAX
+ * @param hop distance between adjacent frames in samples, should be in range of 1 to 2^rank
+ * @param window analysis window of 2^rank samples, NULL means rectangular window
+ * @return pointer to the STFT engine or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(stft_t) *, stft_create, size_t rank, size_t hop, const float *window);
+
+/**
+ * Destroy the STFT engine and free all allocated resources
+ *
+ * @param st STFT engine to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, stft_destroy, LSP_DSP_LIB_TYPE(stft_t) *st);
+
+/**
+ * Reset the internal state of the STFT engine: clear the input history,
+ * the overlap-add buffer and the spectrum
+ *
+ * @param st STFT engine to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, stft_reset, LSP_DSP_LIB_TYPE(stft_t) *st);
+
+/**
+ * Get the latency of the STFT engine. The output signal is delayed by the size
+ * of the frame relatively to the input signal.
+ *
+ * @param st STFT engine
+ * @return latency in samples
+ */
+LSP_DSP_LIB_SYMBOL(size_t, stft_latency, const LSP_DSP_LIB_TYPE(stft_t) *st);
+
+/**
+ * Get the spectrum of the last processed frame. The buffer contains 2^(rank-1)+1 complex
+ * harmonics in the format of real_direct_fft() and remains valid until the engine is destroyed.
+ * If the callback has modified the spectrum, the modified spectrum is returned.
+ *
+ * @param st STFT engine
+ * @return pointer to the spectrum buffer
+ */
+LSP_DSP_LIB_SYMBOL(const float *, stft_spectrum, const LSP_DSP_LIB_TYPE(stft_t) *st);
+
+/**
+ * Process the signal: perform analysis of each complete frame, call the callback
+ * and resynthesize the output signal.
+ *
+ * @param st STFT engine
+ * @param dst destination buffer of count samples, may be the same as the source buffer,
+ *        NULL means analysis only: the reverse transform and overlap-add are not performed
+ * @param src source buffer of count samples
+ * @param count number of samples to process
+ * @param func spectrum processing callback, may be NULL
+ * @param arg argument passed to the callback
+ * @return number of frames processed
+ */
+LSP_DSP_LIB_SYMBOL(size_t, stft_process, LSP_DSP_LIB_TYPE(stft_t) *st,
+    float *dst, const float *src, size_t count,
+    LSP_DSP_LIB_TYPE(stft_callback_t) func, void *arg);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_STFT_H_ */
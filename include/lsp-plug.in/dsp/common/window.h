@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_WINDOW_H_
+#define LSP_PLUG_IN_DSP_COMMON_WINDOW_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+// Window modes
+#define LSP_DSP_WINDOW_PERIODIC             0       /* DFT-even window with the period of count samples, for spectral analysis */
+#define LSP_DSP_WINDOW_SYMMETRIC            1       /* Window symmetric around the center, for FIR filter design */
+
+/**
+ * Generate generalized cosine window:
+ *
+ *   dst[i] = a[0] - a[1]*cos(2*PI*i/N) + a[2]*cos(4*PI*i/N) - a[3]*cos(6*PI*i/N) ...
+ *
+ * where N = count for LSP_DSP_WINDOW_PERIODIC and N = count - 1 for LSP_DSP_WINDOW_SYMMETRIC mode.
+ * The window of one sample is always equal to 1.
+ *
+ * @param dst destination buffer
+ * @param a coefficients of the window
+ * @param terms number of coefficients
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_cosine_sum, float *dst, const float *a, size_t terms, size_t count, size_t mode);
+
+/**
+ * Generate sine window: dst[i] = sin(PI*i/N)
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_sine, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate Hann window, a[] = { 0.5, 0.5 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_hann, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate Hamming window, a[] = { 0.54, 0.46 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_hamming, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate Blackman window, a[] = { 0.42, 0.5, 0.08 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_blackman, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate 4-term Blackman-Harris window, a[] = { 0.35875, 0.48829, 0.14128, 0.01168 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_blackman_harris, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate 4-term Nuttall window, a[] = { 0.355768, 0.487396, 0.144232, 0.012604 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_nuttall, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate 5-term flat-top window,
+ * a[] = { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 }
+ *
+ * @param dst destination buffer
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_flat_top, float *dst, size_t count, size_t mode);
+
+/**
+ * Generate Kaiser window: dst[i] = I0(beta * sqrt(1 - (2*i/N - 1)^2)) / I0(beta),
+ * where I0 is the zeroth-order modified Bessel function of the first kind
+ *
+ * @param dst destination buffer
+ * @param beta shape parameter, should be non-negative
+ * @param count size of the window
+ * @param mode window mode
+ */
+LSP_DSP_LIB_SYMBOL(void, window_kaiser, float *dst, float beta, size_t count, size_t mode);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_WINDOW_H_ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_DSP_COMMON_XCORR_H_
+#define LSP_PLUG_IN_DSP_COMMON_XCORR_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+// Limits of the cross-correlation frame size
+#define LSP_DSP_XCORR_RANK_MIN              2
+#define LSP_DSP_XCORR_RANK_MAX              16
+
+// Weighting of the cross-spectrum
+#define LSP_DSP_XCORR_PLAIN                 0       /* No weighting, plain cross-correlation */
+#define LSP_DSP_XCORR_PHAT                  1       /* Phase transform (GCC-PHAT), only the phase of the cross-spectrum is kept */
+
+LSP_DSP_LIB_BEGIN_NAMESPACE
+
+/**
+ * FFT-based cross-correlation and time-delay estimation engine. Both signals are split
+ * into frames of 2^(rank-1) samples, each frame is padded with zeros to 2^rank samples
+ * and transformed with real_direct_fft(), so the frame gives the linear (not circular)
+ * cross-correlation for lags in range of -2^(rank-1)+1 to 2^(rank-1)-1. The cross-spectra
+ * of all frames are accumulated until the engine is reset, so the estimate improves with
+ * the amount of processed data.
+ *
+ * The object is opaque, it should be created with xcorr_create() and destroyed
+ * with xcorr_destroy() functions.
+ */
+typedef struct LSP_DSP_LIB_TYPE(xcorr_t) LSP_DSP_LIB_TYPE(xcorr_t);
+
+LSP_DSP_LIB_END_NAMESPACE
+
+/**
+ * Create cross-correlation engine
+ *
+ * @param rank the rank of FFT, should be in range of LSP_DSP_XCORR_RANK_MIN to LSP_DSP_XCORR_RANK_MAX
+ * @param mode weighting of the cross-spectrum: LSP_DSP_XCORR_PLAIN or LSP_DSP_XCORR_PHAT
+ * @return pointer to the cross-correlation engine or NULL on error
+ */
+LSP_DSP_LIB_SYMBOL(LSP_DSP_LIB_TYPE(xcorr_t) *, xcorr_create, size_t rank, size_t mode);
+
+/**
+ * Destroy the cross-correlation engine and free all allocated resources
+ *
+ * @param xc cross-correlation engine to destroy, may be NULL
+ */
+LSP_DSP_LIB_SYMBOL(void, xcorr_destroy, LSP_DSP_LIB_TYPE(xcorr_t) *xc);
+
+/**
+ * Reset the cross-correlation engine: drop the incomplete frame and the accumulated cross-spectrum
+ *
+ * @param xc cross-correlation engine to reset
+ */
+LSP_DSP_LIB_SYMBOL(void, xcorr_reset, LSP_DSP_LIB_TYPE(xcorr_t) *xc);
+
+/**
+ * Append the samples of both signals and accumulate the cross-spectrum of each complete frame
+ *
+ * @param xc cross-correlation engine
+ * @param a samples of the first signal
+ * @param b samples of the second signal
+ * @param count number of samples to process
+ * @return number of frames processed
+ */
+LSP_DSP_LIB_SYMBOL(size_t, xcorr_process, LSP_DSP_LIB_TYPE(xcorr_t) *xc, const float *a, const float *b, size_t count);
+
+/**
+ * Compute the cross-correlation function from the accumulated cross-spectrum and estimate
+ * the delay at the peak of its absolute value with the sub-sample precision (parabolic
+ * interpolation). The positive delay means that the signal a is delayed relatively to
+ * the signal b: a[i] = b[i - delay]. If no frames were accumulated, the delay is zero.
+ *
+ * @param xc cross-correlation engine
+ * @param corr buffer to store the cross-correlation function of 2^rank samples, may be NULL,
+ *        element i corresponds to the lag of (i - 2^(rank-1)) samples
+ * @return estimated delay in samples
+ */
+LSP_DSP_LIB_SYMBOL(float, xcorr_estimate, LSP_DSP_LIB_TYPE(xcorr_t) *xc, float *corr);
+
+#endif /* LSP_PLUG_IN_DSP_COMMON_XCORR_H_ */
@@ -154,15 +154,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = dst[0] + dst[2];
-                    float s1_re     = dst[0] - dst[2];
-                    float s0_im     = dst[1] + dst[3];
-                    float s1_im     = dst[1] - dst[3];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
 
-                    float s2_re     = dst[4] + dst[6];
-                    float s3_re     = dst[4] - dst[6];
-                    float s2_im     = dst[5] + dst[7];
-                    float s3_im     = dst[5] - dst[7];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = s0_re + s2_re;
                     dst[1]          = s0_im + s2_im;
@@ -209,15 +209,15 @@ namespace lsp
             {
                 if (rank == 2)
                 {
-                    float s0_re     = src[0] + src[2];
-                    float s1_re     = src[0] - src[2];
-                    float s2_re     = src[4] + src[6];
-                    float s3_re     = src[4] - src[6];
+                    float s0_re     = src[0] + src[4];
+                    float s1_re     = src[0] - src[4];
+                    float s2_re     = src[2] + src[6];
+                    float s3_re     = src[2] - src[6];
 
-                    float s0_im     = src[1] + src[3];
-                    float s1_im     = src[1] - src[3];
-                    float s2_im     = src[5] + src[7];
-                    float s3_im     = src[5] - src[7];
+                    float s0_im     = src[1] + src[5];
+                    float s1_im     = src[1] - src[5];
+                    float s2_im     = src[3] + src[7];
+                    float s3_im     = src[3] - src[7];
 
                     dst[0]          = (s0_re + s2_re)*0.25f;
                     dst[1]          = (s0_im + s2_im)*0.25f;
@@ -235,10 +235,10 @@ namespace lsp
                     // s1' = s0 - s1
                     float s1_re     = src[2];
                     float s1_im     = src[3];
-                    dst[2]          = src[0] - s1_re;
-                    dst[3]          = src[1] - s1_im;
-                    dst[0]          = src[0] + s1_re;
-                    dst[1]          = src[1] + s1_im;
+                    dst[2]          = (src[0] - s1_re) * 0.5f;
+                    dst[3]          = (src[1] - s1_im) * 0.5f;
+                    dst[0]          = (src[0] + s1_re) * 0.5f;
+                    dst[1]          = (src[1] + s1_im) * 0.5f;
                 }
                 else
                 {
@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * Single level of the partitioned convolver: set of partitions of the same size
+         */
+        typedef struct convolver_level_t
+        {
+            size_t      rank;           // Fast convolution rank
+            size_t      block;          // Size of the partition in samples
+            size_t      parts;          // Number of partitions
+            size_t      steps;          // Number of processing blocks per one partition
+            size_t      step;           // Current processing block
+            size_t      phase;          // Number of processing blocks the partition boundary is deferred by
+            size_t      head;           // Index of the most recent spectrum in frequency-domain delay line
+            size_t      delay;          // Offset of the output relative to the current output block
+            float      *ir;             // Impulse response spectrums: parts * 2^(rank+1) floats
+            float      *fdl;            // Frequency-domain delay line: parts * 2^(rank+1) floats
+            float      *acc;            // Spectrum accumulator: 2^(rank+1) floats
+        } convolver_level_t;
+
+        struct convolver_t
+        {
+            size_t              block;          // Size of processing block
+            size_t              fill;           // Number of samples in current processing block
+            size_t              in_size;        // Size of input buffer
+            size_t              in_pos;         // Position of the current processing block in the input buffer
+            size_t              out_size;       // Size of output ring buffer
+            size_t              out_pos;        // Position of the current processing block in the output buffer
+            size_t              nlevels;        // Number of levels
+            uint8_t            *data;           // Allocated data
+            float              *in;             // Input buffer
+            float              *out;            // Output ring buffer
+            float              *tmp;            // Temporary buffer
+            convolver_level_t   levels[LSP_DSP_CONVOLVER_RANK_MAX];
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t CONVOLVER_ALIGN     = 0x40;
+
+        static inline float *convolver_alloc(float * &ptr, size_t count)
+        {
+            float *res      = ptr;
+            ptr            += count;
+            return res;
+        }
+
+        void convolver_reset(dsp::convolver_t *cv)
+        {
+            cv->fill        = 0;
+            cv->in_pos      = 0;
+            cv->out_pos     = 0;
+            dsp::fill_zero(cv->in, cv->in_size);
+            dsp::fill_zero(cv->out, cv->out_size);
+
+            for (size_t i=0; i<cv->nlevels; ++i)
+            {
+                dsp::convolver_level_t *lv  = &cv->levels[i];
+                size_t bins     = lv->block << 2;
+
+                lv->step        = (lv->steps - lv->phase) % lv->steps;
+                lv->head        = 0;
+                dsp::fill_zero(lv->fdl, lv->parts * bins);
+                dsp::fill_zero(lv->acc, bins);
+            }
+        }
+
+        dsp::convolver_t *convolver_create(const float *ir, size_t length, size_t rank, size_t max_rank)
+        {
+            if ((rank < LSP_DSP_CONVOLVER_RANK_MIN) || (rank > max_rank) || (max_rank > LSP_DSP_CONVOLVER_RANK_MAX))
+                return NULL;
+            if ((ir == NULL) && (length > 0))
+                return NULL;
+
+            dsp::convolver_t hdr;
+            size_t block        = size_t(1) << (rank - 1);
+            size_t in_size      = block;
+            size_t out_size     = block;
+            size_t tmp_size     = block << 2;
+            size_t to_alloc     = 0;
+            size_t offset       = 0;
+
+            // Compute partitioning of the impulse response. The output of the level of 2^k blocks
+            // is needed 2^k - 1 blocks after its partition boundary, so the boundary of each level
+            // is deferred by 2^(k-1) blocks. That puts boundaries of different levels to different
+            // processing blocks, and each block computes the FFTs of at most two levels
+            hdr.nlevels         = 0;
+            for (size_t r = rank; offset < length; ++r)
+            {
+                dsp::convolver_level_t *lv  = &hdr.levels[hdr.nlevels++];
+                size_t n            = size_t(1) << (r - 1);
+                size_t parts        = (length - offset + n - 1) / n;
+                if ((r < max_rank) && (parts > 2))
+                    parts               = 2;
+
+                lv->rank            = r;
+                lv->block           = n;
+                lv->parts           = parts;
+                lv->steps           = n / block;
+                lv->phase           = lv->steps >> 1;
+                lv->delay           = offset + block - n - lv->phase * block;
+
+                in_size             = lsp_max(in_size, n + lv->phase * block);
+                tmp_size            = lsp_max(tmp_size, n << 2);
+                out_size            = lsp_max(out_size, lv->delay + (n << 1));
+                to_alloc           += (parts * 2 + 1) * (n << 2);
+                offset             += parts * n;
+
+                if (r >= max_rank)
+                    break;
+            }
+
+            // The input and output buffers should be of power of 2 size
+            size_t in_cap       = block;
+            while (in_cap < in_size)
+                in_cap            <<= 1;
+            in_size             = in_cap;
+
+            size_t out_cap      = block;
+            while (out_cap < out_size)
+                out_cap           <<= 1;
+
+            to_alloc           += in_size + out_cap + tmp_size;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::convolver_t) + CONVOLVER_ALIGN - 1) & ~(CONVOLVER_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + CONVOLVER_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + CONVOLVER_ALIGN - 1) & ~uintptr_t(CONVOLVER_ALIGN - 1));
+            dsp::convolver_t *cv= reinterpret_cast<dsp::convolver_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            *cv                 = hdr;
+            cv->data            = data;
+            cv->block           = block;
+            cv->in_size         = in_size;
+            cv->out_size        = out_cap;
+            cv->in              = convolver_alloc(fptr, in_size);
+            cv->out             = convolver_alloc(fptr, out_cap);
+            cv->tmp             = convolver_alloc(fptr, tmp_size);
+
+            // Prepare impulse response spectrums
+            offset              = 0;
+            for (size_t i=0; i<cv->nlevels; ++i)
+            {
+                dsp::convolver_level_t *lv  = &cv->levels[i];
+                size_t n            = lv->block;
+                size_t bins         = n << 2;
+
+                lv->ir              = convolver_alloc(fptr, lv->parts * bins);
+                lv->fdl             = convolver_alloc(fptr, lv->parts * bins);
+                lv->acc             = convolver_alloc(fptr, bins);
+
+                for (size_t j=0; j<lv->parts; ++j, offset += n)
+                {
+                    size_t count        = lsp_min(length - offset, n);
+                    dsp::copy(cv->tmp, &ir[offset], count);
+                    if (count < n)
+                        dsp::fill_zero(&cv->tmp[count], n - count);
+                    dsp::fastconv_parse(&lv->ir[j * bins], cv->tmp, lv->rank);
+                }
+            }
+
+            convolver_reset(cv);
+
+            return cv;
+        }
+
+        void convolver_destroy(dsp::convolver_t *cv)
+        {
+            if (cv != NULL)
+                free(cv->data);
+        }
+
+        size_t convolver_latency(const dsp::convolver_t *cv)
+        {
+            return cv->block;
+        }
+
+        static void convolver_tick(dsp::convolver_t *cv)
+        {
+            size_t block    = cv->block;
+            size_t out_mask = cv->out_size - 1;
+            size_t in_mask  = cv->in_size - 1;
+
+            // Cleanup the emitted block and move to the next one
+            dsp::fill_zero(&cv->out[cv->out_pos], block);
+            cv->out_pos     = (cv->out_pos + block) & out_mask;
+
+            for (size_t i=0; i<cv->nlevels; ++i)
+            {
+                dsp::convolver_level_t *lv  = &cv->levels[i];
+                size_t n        = lv->block;
+                size_t bins     = n << 2;
+                size_t parts    = lv->parts;
+
+                // Partition boundary: transform the input block, apply the first
+                // partition and emit the accumulated result to the output buffer
+                if ((++lv->step) >= lv->steps)
+                {
+                    lv->step        = 0;
+                    if ((++lv->head) >= parts)
+                        lv->head        = 0;
+
+                    float *fdl      = &lv->fdl[lv->head * bins];
+                    dsp::fastconv_parse(fdl, &cv->in[(cv->in_pos + block - n - lv->phase * block) & in_mask], lv->rank);
+                    dsp::fastconv_fmadd(lv->acc, fdl, lv->ir, lv->rank);
+                    dsp::fastconv_restore(cv->tmp, lv->acc, lv->rank);
+                    dsp::fill_zero(lv->acc, bins);
+
+                    size_t count    = n << 1;
+                    size_t off      = (cv->out_pos + lv->delay) & out_mask;
+                    size_t head     = lsp_min(count, cv->out_size - off);
+                    dsp::add2(&cv->out[off], cv->tmp, head);
+                    if (head < count)
+                        dsp::add2(cv->out, &cv->tmp[head], count - head);
+                }
+
+                // Spread the multiplication by the rest partitions between processing blocks
+                size_t first    = 1 + (lv->step * (parts - 1)) / lv->steps;
+                size_t last     = 1 + ((lv->step + 1) * (parts - 1)) / lv->steps;
+                for (size_t k=first; k<last; ++k)
+                {
+                    size_t slot     = (lv->head + parts + 1 - k) % parts;
+                    dsp::fastconv_fmadd(lv->acc, &lv->fdl[slot * bins], &lv->ir[k * bins], lv->rank);
+                }
+            }
+
+            cv->in_pos      = (cv->in_pos + block) & in_mask;
+        }
+
+        void convolver_process(dsp::convolver_t *cv, float *dst, const float *src, size_t count)
+        {
+            while (count > 0)
+            {
+                size_t to_do    = lsp_min(count, cv->block - cv->fill);
+
+                // Source should be read before the destination is written, so in-place processing is possible
+                dsp::copy(&cv->in[cv->in_pos + cv->fill], src, to_do);
+                dsp::copy(dst, &cv->out[cv->out_pos + cv->fill], to_do);
+
+                cv->fill       += to_do;
+                if (cv->fill >= cv->block)
+                {
+                    convolver_tick(cv);
+                    cv->fill        = 0;
+                }
+
+                dst            += to_do;
+                src            += to_do;
+                count          -= to_do;
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_CONVOLVER_H_ */
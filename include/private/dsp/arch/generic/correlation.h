@@ -190,6 +190,165 @@ namespace lsp
             corr->b     = vb;
         }
 
+        void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count)
+        {
+            double xv = 0.0;
+            double xa = 0.0;
+            double xb = 0.0;
+
+            if (count >= 4)
+            {
+                double T[4], A[4], B[4];
+
+                T[0]    = 0.0;
+                T[1]    = 0.0;
+                T[2]    = 0.0;
+                T[3]    = 0.0;
+
+                A[0]    = 0.0;
+                A[1]    = 0.0;
+                A[2]    = 0.0;
+                A[3]    = 0.0;
+
+                B[0]    = 0.0;
+                B[1]    = 0.0;
+                B[2]    = 0.0;
+                B[3]    = 0.0;
+
+                for ( ; count >= 4; count -= 4)
+                {
+                    T[0]       += a[0] * b[0];
+                    T[1]       += a[1] * b[1];
+                    T[2]       += a[2] * b[2];
+                    T[3]       += a[3] * b[3];
+
+                    A[0]       += a[0] * a[0];
+                    A[1]       += a[1] * a[1];
+                    A[2]       += a[2] * a[2];
+                    A[3]       += a[3] * a[3];
+
+                    B[0]       += b[0] * b[0];
+                    B[1]       += b[1] * b[1];
+                    B[2]       += b[2] * b[2];
+                    B[3]       += b[3] * b[3];
+
+                    a          += 4;
+                    b          += 4;
+                }
+
+                xv          = T[0] + T[1] + T[2] + T[3];
+                xa          = A[0] + A[1] + A[2] + A[3];
+                xb          = B[0] + B[1] + B[2] + B[3];
+            }
+
+            for ( ; count > 0; --count)
+            {
+                xv         += a[0] * b[0];
+                xa         += a[0] * a[0];
+                xb         += b[0] * b[0];
+
+                a          += 1;
+                b          += 1;
+            }
+
+            corr->v    += xv;
+            corr->a    += xa;
+            corr->b    += xb;
+        }
+
+        void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+            const double *a_head, const double *b_head,
+            const double *a_tail, const double *b_tail,
+            size_t count)
+        {
+            double T[4], BA[4], BB[4], B[4], DV[4], DA[4], DB[4];
+
+            double vv   = corr->v;
+            double va   = corr->a;
+            double vb   = corr->b;
+
+            for ( ; count >= 4; count -= 4)
+            {
+                DV[0]       = a_head[0]*b_head[0] - a_tail[0]*b_tail[0];
+                DV[1]       = a_head[1]*b_head[1] - a_tail[1]*b_tail[1];
+                DV[2]       = a_head[2]*b_head[2] - a_tail[2]*b_tail[2];
+                DV[3]       = a_head[3]*b_head[3] - a_tail[3]*b_tail[3];
+
+                DA[0]       = a_head[0]*a_head[0] - a_tail[0]*a_tail[0];
+                DA[1]       = a_head[1]*a_head[1] - a_tail[1]*a_tail[1];
+                DA[2]       = a_head[2]*a_head[2] - a_tail[2]*a_tail[2];
+                DA[3]       = a_head[3]*a_head[3] - a_tail[3]*a_tail[3];
+
+                DB[0]       = b_head[0]*b_head[0] - b_tail[0]*b_tail[0];
+                DB[1]       = b_head[1]*b_head[1] - b_tail[1]*b_tail[1];
+                DB[2]       = b_head[2]*b_head[2] - b_tail[2]*b_tail[2];
+                DB[3]       = b_head[3]*b_head[3] - b_tail[3]*b_tail[3];
+
+                T[0]        = vv + DV[0];
+                T[1]        = T[0] + DV[1];
+                T[2]        = T[1] + DV[2];
+                T[3]        = T[2] + DV[3];
+
+                BA[0]       = va + DA[0];
+                BA[1]       = BA[0] + DA[1];
+                BA[2]       = BA[1] + DA[2];
+                BA[3]       = BA[2] + DA[3];
+
+                BB[0]       = vb + DB[0];
+                BB[1]       = BB[0] + DB[1];
+                BB[2]       = BB[1] + DB[2];
+                BB[3]       = BB[2] + DB[3];
+
+                B[0]        = BA[0] * BB[0];
+                B[1]        = BA[1] * BB[1];
+                B[2]        = BA[2] * BB[2];
+                B[3]        = BA[3] * BB[3];
+
+                dst[0]      = (B[0] >= 1e-18f) ? T[0] / sqrt(B[0]) : 0.0;
+                dst[1]      = (B[1] >= 1e-18f) ? T[1] / sqrt(B[1]) : 0.0;
+                dst[2]      = (B[2] >= 1e-18f) ? T[2] / sqrt(B[2]) : 0.0;
+                dst[3]      = (B[3] >= 1e-18f) ? T[3] / sqrt(B[3]) : 0.0;
+
+                vv          = T[3];
+                va          = BA[3];
+                vb          = BB[3];
+
+                a_head     += 4;
+                b_head     += 4;
+                a_tail     += 4;
+                b_tail     += 4;
+                dst        += 4;
+            }
+
+            for (; count > 0; --count)
+            {
+                DV[0]       = a_head[0]*b_head[0] - a_tail[0]*b_tail[0];
+                DA[0]       = a_head[0]*a_head[0] - a_tail[0]*a_tail[0];
+                DB[0]       = b_head[0]*b_head[0] - b_tail[0]*b_tail[0];
+
+                T[0]        = vv + DV[0];
+                BA[0]       = va + DA[0];
+                BB[0]       = vb + DB[0];
+                B[0]        = BA[0] * BB[0];
+
+                dst[0]      = (B[0] >= 1e-18f) ? T[0] / sqrt(B[0]) : 0.0;
+
+                vv          = T[0];
+                va          = BA[0];
+                vb          = BB[0];
+
+                a_head     += 1;
+                b_head     += 1;
+                a_tail     += 1;
+                b_tail     += 1;
+                dst        += 1;
+            }
+
+            corr->v     = vv;
+            corr->a     = va;
+            corr->b     = vb;
+        }
+
     } /* namespace generic */
 } /* namespace lsp */
 
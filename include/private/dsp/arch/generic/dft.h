@@ -0,0 +1,628 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_DFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_DFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <private/dsp/dft.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        static constexpr size_t DFT_ALIGN           = 0x40;
+        static constexpr size_t DFT_RANK_MIN        = 3;
+        static constexpr size_t DFT_RANK_MAX        = 16;
+
+        static const float DFT_C3   = -0.5000000000000000f;     // cos(2*pi/3)
+        static const float DFT_S3   = 0.8660254037844386f;      // sin(2*pi/3)
+        static const float DFT_C5_1 = 0.3090169943749474f;      // cos(2*pi/5)
+        static const float DFT_C5_2 = -0.8090169943749474f;     // cos(4*pi/5)
+        static const float DFT_S5_1 = 0.9510565162951535f;      // sin(2*pi/5)
+        static const float DFT_S5_2 = 0.5877852522924731f;      // sin(4*pi/5)
+        static const float DFT_C7_1 = 0.6234898018587336f;      // cos(2*pi/7)
+        static const float DFT_C7_2 = -0.2225209339563144f;     // cos(4*pi/7)
+        static const float DFT_C7_3 = -0.9009688679024191f;     // cos(6*pi/7)
+        static const float DFT_S7_1 = 0.7818314824680298f;      // sin(2*pi/7)
+        static const float DFT_S7_2 = 0.9749279121818236f;      // sin(4*pi/7)
+        static const float DFT_S7_3 = 0.4338837391175581f;      // sin(6*pi/7)
+
+        void packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+        void packed_reverse_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+
+        static inline float *dft_alloc(float * &ptr, size_t count)
+        {
+            float *res      = ptr;
+            ptr            += count;
+            return res;
+        }
+
+        /*
+         * Mixed-radix butterflies of the self-sorting (Stockham) algorithm.
+         * The butterfly takes 'radix' contiguous blocks of 'count' complex numbers
+         * from src, applies twiddle factors tw[0..radix-2] to the blocks 1..radix-1,
+         * computes the DFT of size 'radix' and stores results to blocks of dst
+         * spaced by 'stride' floats.
+         */
+        static void dft_butterfly2(float *dst, size_t stride, const float *src, const float *tw, size_t count)
+        {
+            const float *s1 = &src[count << 1];
+            float *d1       = &dst[stride];
+
+            for (size_t i=0; i<count; ++i, src += 2, s1 += 2, dst += 2, d1 += 2)
+            {
+                float a1r       = s1[0]*tw[0] - s1[1]*tw[1];
+                float a1i       = s1[0]*tw[1] + s1[1]*tw[0];
+
+                float a0r       = src[0];
+                float a0i       = src[1];
+
+                dst[0]          = a0r + a1r;
+                dst[1]          = a0i + a1i;
+                d1[0]           = a0r - a1r;
+                d1[1]           = a0i - a1i;
+            }
+        }
+
+        static void dft_butterfly3(float *dst, size_t stride, const float *src, const float *tw, size_t count)
+        {
+            const float *s1 = &src[count << 1];
+            const float *s2 = &s1[count << 1];
+            float *d1       = &dst[stride];
+            float *d2       = &d1[stride];
+
+            for (size_t i=0; i<count; ++i, src += 2, s1 += 2, s2 += 2, dst += 2, d1 += 2, d2 += 2)
+            {
+                float a1r       = s1[0]*tw[0] - s1[1]*tw[1];
+                float a1i       = s1[0]*tw[1] + s1[1]*tw[0];
+                float a2r       = s2[0]*tw[2] - s2[1]*tw[3];
+                float a2i       = s2[0]*tw[3] + s2[1]*tw[2];
+
+                float t1r       = a1r + a2r;
+                float t1i       = a1i + a2i;
+                float t2r       = (a1r - a2r) * DFT_S3;
+                float t2i       = (a1i - a2i) * DFT_S3;
+                float mr        = src[0] + t1r * DFT_C3;
+                float mi        = src[1] + t1i * DFT_C3;
+
+                dst[0]          = src[0] + t1r;
+                dst[1]          = src[1] + t1i;
+                d1[0]           = mr + t2i;
+                d1[1]           = mi - t2r;
+                d2[0]           = mr - t2i;
+                d2[1]           = mi + t2r;
+            }
+        }
+
+        static void dft_butterfly4(float *dst, size_t stride, const float *src, const float *tw, size_t count)
+        {
+            const float *s1 = &src[count << 1];
+            const float *s2 = &s1[count << 1];
+            const float *s3 = &s2[count << 1];
+            float *d1       = &dst[stride];
+            float *d2       = &d1[stride];
+            float *d3       = &d2[stride];
+
+            for (size_t i=0; i<count; ++i, src += 2, s1 += 2, s2 += 2, s3 += 2, dst += 2, d1 += 2, d2 += 2, d3 += 2)
+            {
+                float a1r       = s1[0]*tw[0] - s1[1]*tw[1];
+                float a1i       = s1[0]*tw[1] + s1[1]*tw[0];
+                float a2r       = s2[0]*tw[2] - s2[1]*tw[3];
+                float a2i       = s2[0]*tw[3] + s2[1]*tw[2];
+                float a3r       = s3[0]*tw[4] - s3[1]*tw[5];
+                float a3i       = s3[0]*tw[5] + s3[1]*tw[4];
+
+                float t0r       = src[0] + a2r;
+                float t0i       = src[1] + a2i;
+                float t1r       = src[0] - a2r;
+                float t1i       = src[1] - a2i;
+                float t2r       = a1r + a3r;
+                float t2i       = a1i + a3i;
+                float t3r       = a1r - a3r;
+                float t3i       = a1i - a3i;
+
+                dst[0]          = t0r + t2r;
+                dst[1]          = t0i + t2i;
+                d1[0]           = t1r + t3i;
+                d1[1]           = t1i - t3r;
+                d2[0]           = t0r - t2r;
+                d2[1]           = t0i - t2i;
+                d3[0]           = t1r - t3i;
+                d3[1]           = t1i + t3r;
+            }
+        }
+
+        static void dft_butterfly5(float *dst, size_t stride, const float *src, const float *tw, size_t count)
+        {
+            const float *s1 = &src[count << 1];
+            const float *s2 = &s1[count << 1];
+            const float *s3 = &s2[count << 1];
+            const float *s4 = &s3[count << 1];
+            float *d1       = &dst[stride];
+            float *d2       = &d1[stride];
+            float *d3       = &d2[stride];
+            float *d4       = &d3[stride];
+
+            for (size_t i=0; i<count; ++i, src += 2, s1 += 2, s2 += 2, s3 += 2, s4 += 2,
+                dst += 2, d1 += 2, d2 += 2, d3 += 2, d4 += 2)
+            {
+                float a1r       = s1[0]*tw[0] - s1[1]*tw[1];
+                float a1i       = s1[0]*tw[1] + s1[1]*tw[0];
+                float a2r       = s2[0]*tw[2] - s2[1]*tw[3];
+                float a2i       = s2[0]*tw[3] + s2[1]*tw[2];
+                float a3r       = s3[0]*tw[4] - s3[1]*tw[5];
+                float a3i       = s3[0]*tw[5] + s3[1]*tw[4];
+                float a4r       = s4[0]*tw[6] - s4[1]*tw[7];
+                float a4i       = s4[0]*tw[7] + s4[1]*tw[6];
+
+                float t1r       = a1r + a4r;
+                float t1i       = a1i + a4i;
+                float t2r       = a2r + a3r;
+                float t2i       = a2i + a3i;
+                float t3r       = a1r - a4r;
+                float t3i       = a1i - a4i;
+                float t4r       = a2r - a3r;
+                float t4i       = a2i - a3i;
+
+                float m1r       = src[0] + t1r * DFT_C5_1 + t2r * DFT_C5_2;
+                float m1i       = src[1] + t1i * DFT_C5_1 + t2i * DFT_C5_2;
+                float m2r       = src[0] + t1r * DFT_C5_2 + t2r * DFT_C5_1;
+                float m2i       = src[1] + t1i * DFT_C5_2 + t2i * DFT_C5_1;
+                float n1r       = t3r * DFT_S5_1 + t4r * DFT_S5_2;
+                float n1i       = t3i * DFT_S5_1 + t4i * DFT_S5_2;
+                float n2r       = t3r * DFT_S5_2 - t4r * DFT_S5_1;
+                float n2i       = t3i * DFT_S5_2 - t4i * DFT_S5_1;
+
+                dst[0]          = src[0] + t1r + t2r;
+                dst[1]          = src[1] + t1i + t2i;
+                d1[0]           = m1r + n1i;
+                d1[1]           = m1i - n1r;
+                d4[0]           = m1r - n1i;
+                d4[1]           = m1i + n1r;
+                d2[0]           = m2r + n2i;
+                d2[1]           = m2i - n2r;
+                d3[0]           = m2r - n2i;
+                d3[1]           = m2i + n2r;
+            }
+        }
+
+        static void dft_butterfly7(float *dst, size_t stride, const float *src, const float *tw, size_t count)
+        {
+            const float *s1 = &src[count << 1];
+            const float *s2 = &s1[count << 1];
+            const float *s3 = &s2[count << 1];
+            const float *s4 = &s3[count << 1];
+            const float *s5 = &s4[count << 1];
+            const float *s6 = &s5[count << 1];
+            float *d1       = &dst[stride];
+            float *d2       = &d1[stride];
+            float *d3       = &d2[stride];
+            float *d4       = &d3[stride];
+            float *d5       = &d4[stride];
+            float *d6       = &d5[stride];
+
+            for (size_t i=0; i<count; ++i, src += 2, s1 += 2, s2 += 2, s3 += 2, s4 += 2, s5 += 2, s6 += 2,
+                dst += 2, d1 += 2, d2 += 2, d3 += 2, d4 += 2, d5 += 2, d6 += 2)
+            {
+                float a1r       = s1[0]*tw[0] - s1[1]*tw[1];
+                float a1i       = s1[0]*tw[1] + s1[1]*tw[0];
+                float a2r       = s2[0]*tw[2] - s2[1]*tw[3];
+                float a2i       = s2[0]*tw[3] + s2[1]*tw[2];
+                float a3r       = s3[0]*tw[4] - s3[1]*tw[5];
+                float a3i       = s3[0]*tw[5] + s3[1]*tw[4];
+                float a4r       = s4[0]*tw[6] - s4[1]*tw[7];
+                float a4i       = s4[0]*tw[7] + s4[1]*tw[6];
+                float a5r       = s5[0]*tw[8] - s5[1]*tw[9];
+                float a5i       = s5[0]*tw[9] + s5[1]*tw[8];
+                float a6r       = s6[0]*tw[10] - s6[1]*tw[11];
+                float a6i       = s6[0]*tw[11] + s6[1]*tw[10];
+
+                float p1r       = a1r + a6r;
+                float p1i       = a1i + a6i;
+                float p2r       = a2r + a5r;
+                float p2i       = a2i + a5i;
+                float p3r       = a3r + a4r;
+                float p3i       = a3i + a4i;
+                float q1r       = a1r - a6r;
+                float q1i       = a1i - a6i;
+                float q2r       = a2r - a5r;
+                float q2i       = a2i - a5i;
+                float q3r       = a3r - a4r;
+                float q3i       = a3i - a4i;
+
+                float m1r       = src[0] + p1r * DFT_C7_1 + p2r * DFT_C7_2 + p3r * DFT_C7_3;
+                float m1i       = src[1] + p1i * DFT_C7_1 + p2i * DFT_C7_2 + p3i * DFT_C7_3;
+                float m2r       = src[0] + p1r * DFT_C7_2 + p2r * DFT_C7_3 + p3r * DFT_C7_1;
+                float m2i       = src[1] + p1i * DFT_C7_2 + p2i * DFT_C7_3 + p3i * DFT_C7_1;
+                float m3r       = src[0] + p1r * DFT_C7_3 + p2r * DFT_C7_1 + p3r * DFT_C7_2;
+                float m3i       = src[1] + p1i * DFT_C7_3 + p2i * DFT_C7_1 + p3i * DFT_C7_2;
+                float n1r       = q1r * DFT_S7_1 + q2r * DFT_S7_2 + q3r * DFT_S7_3;
+                float n1i       = q1i * DFT_S7_1 + q2i * DFT_S7_2 + q3i * DFT_S7_3;
+                float n2r       = q1r * DFT_S7_2 - q2r * DFT_S7_3 - q3r * DFT_S7_1;
+                float n2i       = q1i * DFT_S7_2 - q2i * DFT_S7_3 - q3i * DFT_S7_1;
+                float n3r       = q1r * DFT_S7_3 - q2r * DFT_S7_1 + q3r * DFT_S7_2;
+                float n3i       = q1i * DFT_S7_3 - q2i * DFT_S7_1 + q3i * DFT_S7_2;
+
+                dst[0]          = src[0] + p1r + p2r + p3r;
+                dst[1]          = src[1] + p1i + p2i + p3i;
+                d1[0]           = m1r + n1i;
+                d1[1]           = m1i - n1r;
+                d6[0]           = m1r - n1i;
+                d6[1]           = m1i + n1r;
+                d2[0]           = m2r + n2i;
+                d2[1]           = m2i - n2r;
+                d5[0]           = m2r - n2i;
+                d5[1]           = m2i + n2r;
+                d3[0]           = m3r + n3i;
+                d3[1]           = m3i - n3r;
+                d4[0]           = m3r - n3i;
+                d4[1]           = m3i + n3r;
+            }
+        }
+
+        void dft_plan_destroy(dsp::dft_plan_t *plan)
+        {
+            if (plan == NULL)
+                return;
+
+            dft_plan_destroy(plan->conv);
+            free(plan->data);
+        }
+
+        size_t dft_plan_size(const dsp::dft_plan_t *plan)
+        {
+            return plan->size;
+        }
+
+        dsp::dft_plan_t *dft_plan_create(size_t size)
+        {
+            if (size == 0)
+                return NULL;
+
+            dsp::dft_plan_t hdr;
+            hdr.size            = size;
+            hdr.rank            = 0;
+            hdr.nstages         = 0;
+            hdr.bsize           = 0;
+            hdr.conv            = NULL;
+
+            // The power-of-two part is processed by the packed FFT, small
+            // power-of-two parts are processed by mixed-radix stages
+            while ((hdr.rank < DFT_RANK_MAX) && (!(size & (size_t(1) << hdr.rank))))
+                ++hdr.rank;
+            if (hdr.rank < DFT_RANK_MIN)
+                hdr.rank            = 0;
+            hdr.rows            = size >> hdr.rank;
+
+            // Factorize the rest part
+            static const size_t radixes[] = { 4, 2, 3, 5, 7 };
+            size_t rest         = hdr.rows;
+            size_t length       = 1;
+            size_t tw_count     = 0;
+
+            for (size_t i=0; i<sizeof(radixes)/sizeof(size_t); ++i)
+            {
+                size_t p            = radixes[i];
+                while ((rest % p) == 0)
+                {
+                    dsp::dft_stage_t *st    = &hdr.stages[hdr.nstages++];
+                    st->radix           = p;
+                    st->length          = length;
+                    rest               /= p;
+                    length             *= p;
+                    st->residues        = hdr.rows / length;
+                    tw_count           += st->length * (p - 1);
+                }
+            }
+
+            // Use Bluestein algorithm if there are other prime factors
+            size_t to_alloc     = 0;
+            if (rest > 1)
+            {
+                hdr.rank            = 0;
+                hdr.rows            = 0;
+                hdr.nstages         = 0;
+                tw_count            = 0;
+                hdr.bsize           = 1;
+                while (hdr.bsize < (size << 1) - 1)
+                    hdr.bsize         <<= 1;
+
+                to_alloc           += (size + hdr.bsize * 3) * 2;
+            }
+            else
+                to_alloc           += (tw_count + size * 2) * 2;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::dft_plan_t) + DFT_ALIGN - 1) & ~(DFT_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + DFT_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + DFT_ALIGN - 1) & ~uintptr_t(DFT_ALIGN - 1));
+            dsp::dft_plan_t *plan   = reinterpret_cast<dsp::dft_plan_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            *plan               = hdr;
+            plan->data          = data;
+            plan->tw            = NULL;
+            plan->tmp           = NULL;
+            plan->chirp         = NULL;
+            plan->kernel        = NULL;
+            plan->buf           = NULL;
+            plan->spec          = NULL;
+
+            if (plan->bsize > 0)
+            {
+                plan->chirp         = dft_alloc(fptr, size * 2);
+                plan->kernel        = dft_alloc(fptr, plan->bsize * 2);
+                plan->buf           = dft_alloc(fptr, plan->bsize * 2);
+                plan->spec          = dft_alloc(fptr, plan->bsize * 2);
+                plan->conv          = dft_plan_create(plan->bsize);
+                if (plan->conv == NULL)
+                {
+                    free(data);
+                    return NULL;
+                }
+
+                // Chirp: c[n] = exp(-i*pi*n^2/N), the index is computed modulo 2*N to keep precision
+                uint64_t period     = uint64_t(size) << 1;
+                for (size_t i=0; i<size; ++i)
+                {
+                    double a            = (M_PI * ((uint64_t(i) * uint64_t(i)) % period)) / size;
+                    plan->chirp[i*2]    = cos(a);
+                    plan->chirp[i*2+1]  = -sin(a);
+                }
+
+                // Kernel: spectrum of conj(c[n]) wrapped around the convolution buffer
+                float *k            = plan->kernel;
+                dsp::fill_zero(k, plan->bsize * 2);
+                k[0]                = plan->chirp[0];
+                k[1]                = -plan->chirp[1];
+                for (size_t i=1; i<size; ++i)
+                {
+                    size_t j            = plan->bsize - i;
+                    k[i*2]              = plan->chirp[i*2];
+                    k[i*2+1]            = -plan->chirp[i*2+1];
+                    k[j*2]              = k[i*2];
+                    k[j*2+1]            = k[i*2+1];
+                }
+                packed_direct_dft(plan->conv, k, k);
+
+                return plan;
+            }
+
+            plan->tw            = dft_alloc(fptr, size * 2);
+            plan->tmp           = dft_alloc(fptr, size * 2);
+
+            // Four-step twiddle factors: W_N^(n2*k1)
+            size_t n1           = size_t(1) << plan->rank;
+            for (size_t i=0; i<plan->rows; ++i)
+            {
+                float *row          = &plan->tw[i * n1 * 2];
+                for (size_t j=0; j<n1; ++j)
+                {
+                    double a            = (2.0 * M_PI * ((uint64_t(i) * uint64_t(j)) % size)) / size;
+                    row[j*2]            = cos(a);
+                    row[j*2+1]          = -sin(a);
+                }
+            }
+
+            // Twiddle factors of mixed-radix stages: W_(L*p)^(t*j)
+            for (size_t i=0; i<plan->nstages; ++i)
+            {
+                dsp::dft_stage_t *st    = &plan->stages[i];
+                size_t p            = st->radix;
+                size_t len          = st->length * p;
+                st->tw              = dft_alloc(fptr, st->length * (p - 1) * 2);
+
+                for (size_t j=0; j<st->length; ++j)
+                {
+                    float *w            = &st->tw[j * (p - 1) * 2];
+                    for (size_t t=1; t<p; ++t, w += 2)
+                    {
+                        double a            = (2.0 * M_PI * ((t * j) % len)) / len;
+                        w[0]                = cos(a);
+                        w[1]                = -sin(a);
+                    }
+                }
+            }
+
+            return plan;
+        }
+
+        static void dft_bluestein(dsp::dft_plan_t *plan, float *dst, const float *src, bool reverse)
+        {
+            size_t n            = plan->size;
+            float *buf          = plan->buf;
+            const float *c      = plan->chirp;
+
+            // Reverse transform is computed as conj(DFT(conj(x))) / N
+            if (reverse)
+            {
+                for (size_t i=0; i<n; ++i)
+                {
+                    float re            = src[i*2];
+                    float im            = -src[i*2+1];
+                    buf[i*2]            = re*c[i*2] - im*c[i*2+1];
+                    buf[i*2+1]          = re*c[i*2+1] + im*c[i*2];
+                }
+            }
+            else
+                dsp::pcomplex_mul3(buf, src, c, n);
+            dsp::fill_zero(&buf[n*2], (plan->bsize - n) * 2);
+
+            // Perform the convolution with the conjugate chirp
+            packed_direct_dft(plan->conv, plan->spec, buf);
+            dsp::pcomplex_mul2(plan->spec, plan->kernel, plan->bsize);
+            packed_reverse_dft(plan->conv, buf, plan->spec);
+
+            if (reverse)
+            {
+                float k             = 1.0f / n;
+                for (size_t i=0; i<n; ++i)
+                {
+                    float re            = buf[i*2]*c[i*2] - buf[i*2+1]*c[i*2+1];
+                    float im            = buf[i*2]*c[i*2+1] + buf[i*2+1]*c[i*2];
+                    dst[i*2]            = re * k;
+                    dst[i*2+1]          = -im * k;
+                }
+            }
+            else
+                dsp::pcomplex_mul3(dst, buf, c, n);
+        }
+
+        static void dft_execute(dsp::dft_plan_t *plan, float *dst, const float *src, bool reverse)
+        {
+            if (plan->bsize > 0)
+            {
+                dft_bluestein(plan, dst, src, reverse);
+                return;
+            }
+
+            size_t n1           = size_t(1) << plan->rank;
+            size_t rows         = plan->rows;
+            size_t row_size     = n1 * 2;
+            if (plan->nstages == 0)
+            {
+                if (reverse)
+                    dsp::packed_reverse_fft(dst, src, plan->rank);
+                else
+                    dsp::packed_direct_fft(dst, src, plan->rank);
+                return;
+            }
+
+            // Select buffers so that the last pass stores data to the destination
+            size_t passes       = plan->nstages + ((n1 > 1) ? 1 : 0);
+            float *a            = (passes & 1) ? plan->tmp : dst;
+            float *b            = (passes & 1) ? dst : plan->tmp;
+            if (a == src)
+            {
+                a                   = b;
+                b                   = dst;
+            }
+
+            // Gather columns into rows: row[n2][n1] = x[n1*rows + n2]
+            if (reverse)
+            {
+                for (size_t i=0; i<rows; ++i)
+                {
+                    float *row          = &a[i * row_size];
+                    const float *s      = &src[i*2];
+                    for (size_t j=0; j<n1; ++j, s += rows*2)
+                    {
+                        row[j*2]            = s[0];
+                        row[j*2+1]          = -s[1];
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i=0; i<rows; ++i)
+                {
+                    float *row          = &a[i * row_size];
+                    const float *s      = &src[i*2];
+                    for (size_t j=0; j<n1; ++j, s += rows*2)
+                    {
+                        row[j*2]            = s[0];
+                        row[j*2+1]          = s[1];
+                    }
+                }
+            }
+
+            // Transform rows and apply four-step twiddle factors
+            if (n1 > 1)
+            {
+                dsp::packed_direct_fft(b, a, plan->rank);
+                for (size_t i=1; i<rows; ++i)
+                {
+                    float *row          = &b[i * row_size];
+                    dsp::packed_direct_fft(row, &a[i * row_size], plan->rank);
+                    dsp::pcomplex_mul2(row, &plan->tw[i * row_size], n1);
+                }
+
+                float *t            = a;
+                a                   = b;
+                b                   = t;
+            }
+
+            // Perform mixed-radix stages on columns
+            for (size_t i=0; i<plan->nstages; ++i)
+            {
+                const dsp::dft_stage_t *st  = &plan->stages[i];
+                size_t p            = st->radix;
+                size_t count        = st->residues * n1;
+                size_t in_step      = count * p * 2;
+                size_t out_step     = count * 2;
+                size_t stride       = st->length * count * 2;
+                const float *tw     = st->tw;
+
+                for (size_t j=0; j<st->length; ++j, tw += (p - 1) * 2)
+                {
+                    const float *s      = &a[j * in_step];
+                    float *d            = &b[j * out_step];
+
+                    switch (p)
+                    {
+                        case 2: dft_butterfly2(d, stride, s, tw, count); break;
+                        case 3: dft_butterfly3(d, stride, s, tw, count); break;
+                        case 4: dft_butterfly4(d, stride, s, tw, count); break;
+                        case 5: dft_butterfly5(d, stride, s, tw, count); break;
+                        default: dft_butterfly7(d, stride, s, tw, count); break;
+                    }
+                }
+
+                float *t            = a;
+                a                   = b;
+                b                   = t;
+            }
+
+            // Copy data if the last stage has been performed to the temporary buffer
+            if (a != dst)
+                dsp::copy(dst, a, plan->size * 2);
+
+            if (reverse)
+            {
+                float k             = 1.0f / plan->size;
+                for (size_t i=0, n=plan->size*2; i<n; i += 2)
+                {
+                    dst[i]              = dst[i] * k;
+                    dst[i+1]            = -dst[i+1] * k;
+                }
+            }
+        }
+
+        void packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src)
+        {
+            dft_execute(plan, dst, src, false);
+        }
+
+        void packed_reverse_dft(dsp::dft_plan_t *plan, float *dst, const float *src)
+        {
+            dft_execute(plan, dst, src, true);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_DFT_H_ */
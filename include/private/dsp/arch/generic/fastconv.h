@@ -1092,6 +1092,42 @@ namespace lsp
             // Do reverse FFT transformation
             fastconv_restore_internal(dst, tmp, rank);
         }
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+
+            float rx[4], ix[4];
+
+            // All complex numbers are stored in the following format:
+            // [r0 r1 r2 r3 i0 i1 i2 i3  r4 r5 r6 r7 i4 i5 i6 i7  ... ]
+            for (size_t i=0; i<items; i += 8)
+            {
+                rx[0]       = c1[0]*c2[0] - c1[4]*c2[4];
+                rx[1]       = c1[1]*c2[1] - c1[5]*c2[5];
+                rx[2]       = c1[2]*c2[2] - c1[6]*c2[6];
+                rx[3]       = c1[3]*c2[3] - c1[7]*c2[7];
+
+                ix[0]       = c1[0]*c2[4] + c1[4]*c2[0];
+                ix[1]       = c1[1]*c2[5] + c1[5]*c2[1];
+                ix[2]       = c1[2]*c2[6] + c1[6]*c2[2];
+                ix[3]       = c1[3]*c2[7] + c1[7]*c2[3];
+
+                dst[0]     += rx[0];
+                dst[1]     += rx[1];
+                dst[2]     += rx[2];
+                dst[3]     += rx[3];
+
+                dst[4]     += ix[0];
+                dst[5]     += ix[1];
+                dst[6]     += ix[2];
+                dst[7]     += ix[3];
+
+                dst        += 8;
+                c1         += 8;
+                c2         += 8;
+            }
+        }
     }
 }
 
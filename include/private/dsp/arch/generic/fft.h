@@ -887,10 +887,10 @@ namespace lsp
                     // s1' = s0 - s1
                     float s1_re     = src[2];
                     float s1_im     = src[3];
-                    dst[2]          = src[0] - s1_re;
-                    dst[3]          = src[1] - s1_im;
-                    dst[0]          = src[0] + s1_re;
-                    dst[1]          = src[1] + s1_im;
+                    dst[2]          = (src[0] - s1_re) * 0.5f;
+                    dst[3]          = (src[1] - s1_im) * 0.5f;
+                    dst[0]          = (src[0] + s1_re) * 0.5f;
+                    dst[1]          = (src[1] + s1_im) * 0.5f;
                 }
                 else
                 {
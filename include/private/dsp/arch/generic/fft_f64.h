@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFT_F64_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFT_F64_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        // Maximum number of twiddle factor rotations before computing it from the exact value
+        static constexpr size_t FFT_F64_RESEED      = 0x100;
+
+        // Rotation step of twiddle factors for the butterfly of size N: cos(pi/N), sin(pi/N)
+        static const double XFFT_F64_DW[] __lsp_aligned16 =
+        {
+            -1.0, 0.0,                                     // N = 2^0
+            0.0, 1.0,                                      // N = 2^1
+            0.7071067811865476, 0.7071067811865476,        // N = 2^2
+            0.9238795325112867, 0.3826834323650898,        // N = 2^3
+            0.9807852804032304, 0.19509032201612828,       // N = 2^4
+            0.9951847266721969, 0.0980171403295606,        // N = 2^5
+            0.9987954562051724, 0.049067674327418015,      // N = 2^6
+            0.9996988186962042, 0.024541228522912288,      // N = 2^7
+            0.9999247018391445, 0.012271538285719925,      // N = 2^8
+            0.9999811752826011, 0.006135884649154475,      // N = 2^9
+            0.9999952938095762, 0.003067956762965976,      // N = 2^10
+            0.9999988234517019, 0.0015339801862847657,     // N = 2^11
+            0.9999997058628822, 0.0007669903187427045,     // N = 2^12
+            0.9999999264657179, 0.00038349518757139556,    // N = 2^13
+            0.9999999816164293, 0.00019174759731070332,    // N = 2^14
+            0.9999999954041073, 9.587379909597734e-05,     // N = 2^15
+            0.9999999988510269, 4.793689960306688e-05,     // N = 2^16
+            0.9999999997127567, 2.396844980841822e-05,     // N = 2^17
+            0.9999999999281892, 1.1984224905069707e-05,    // N = 2^18
+            0.9999999999820472, 5.9921124526424275e-06,    // N = 2^19
+            0.9999999999955118, 2.996056226334661e-06,     // N = 2^20
+            0.999999999998878, 1.4980281131690111e-06,     // N = 2^21
+            0.9999999999997194, 7.490140565847157e-07,     // N = 2^22
+            0.9999999999999298, 3.7450702829238413e-07,    // N = 2^23
+            0.9999999999999825, 1.8725351414619535e-07,    // N = 2^24
+            0.9999999999999957, 9.362675707309808e-08,     // N = 2^25
+            0.9999999999999989, 4.6813378536549095e-08,    // N = 2^26
+            0.9999999999999998, 2.3406689268274554e-08,    // N = 2^27
+            0.9999999999999999, 1.1703344634137277e-08,    // N = 2^28
+            1.0, 5.8516723170686385e-09,                   // N = 2^29
+            1.0, 2.9258361585343192e-09,                   // N = 2^30
+            1.0, 1.4629180792671596e-09,                   // N = 2^31
+        };
+
+        static void scramble_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            size_t items    = size_t(1) << rank;
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                // First copy data, then swap elements at bit-reversed positions
+                if (dst_re != src_re)
+                    ::memmove(dst_re, src_re, items * sizeof(double));
+                if (dst_im != src_im)
+                    ::memmove(dst_im, src_im, items * sizeof(double));
+
+                for (size_t i = 1; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    if (i >= j)
+                        continue;
+
+                    double re       = dst_re[i];
+                    double im       = dst_im[i];
+                    dst_re[i]       = dst_re[j];
+                    dst_im[i]       = dst_im[j];
+                    dst_re[j]       = re;
+                    dst_im[j]       = im;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    dst_re[i]       = src_re[j];
+                    dst_im[i]       = src_im[j];
+                }
+            }
+        }
+
+        static void butterfly_fft_f64(double *dst_re, double *dst_im, size_t rank, double dir)
+        {
+            size_t items    = size_t(1) << rank;
+
+            for (size_t k = 0; k < rank; ++k)
+            {
+                size_t n        = size_t(1) << k;
+                double dw_re    = XFFT_F64_DW[k*2];
+                double dw_im    = dir * XFFT_F64_DW[k*2 + 1];
+
+                // Twiddle factors are rotated at most FFT_F64_RESEED times and then computed from exact value,
+                // so the rounding error does not grow with the size of the butterfly
+                for (size_t j0 = 0; j0 < n; j0 += FFT_F64_RESEED)
+                {
+                    size_t len      = lsp_min(n - j0, FFT_F64_RESEED);
+                    double angle    = (M_PI * double(j0)) / double(n);
+                    double s_re     = cos(angle);
+                    double s_im     = dir * sin(angle);
+
+                    for (size_t p = j0; p < items; p += (n << 1))
+                    {
+                        double *a_re    = &dst_re[p];
+                        double *a_im    = &dst_im[p];
+                        double *b_re    = &a_re[n];
+                        double *b_im    = &a_im[n];
+                        double w_re     = s_re;
+                        double w_im     = s_im;
+
+                        for (size_t j = 0; j < len; ++j)
+                        {
+                            // Direct transform uses conjugate twiddle factors, dir = -1
+                            double c_re     = w_re * b_re[j] - w_im * b_im[j];
+                            double c_im     = w_re * b_im[j] + w_im * b_re[j];
+
+                            b_re[j]         = a_re[j] - c_re;
+                            b_im[j]         = a_im[j] - c_im;
+                            a_re[j]        += c_re;
+                            a_im[j]        += c_im;
+
+                            // Rotate twiddle factor
+                            double t_re     = w_re * dw_re - w_im * dw_im;
+                            w_im            = w_re * dw_im + w_im * dw_re;
+                            w_re            = t_re;
+                        }
+                    }
+                }
+            }
+        }
+
+        void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, -1.0);
+        }
+
+        void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, 1.0);
+
+            size_t items    = size_t(1) << rank;
+            double k        = 1.0 / double(items);
+            for (size_t i = 0; i < items; ++i)
+            {
+                dst_re[i]      *= k;
+                dst_im[i]      *= k;
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFT_F64_H_ */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFTBATCH_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFTBATCH_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        /*
+         * Without SIMD lanes there is no gain in interleaving the buffers, so the
+         * generic implementation simply computes the transforms buffer by buffer.
+         */
+        void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, dst += stride, src += stride)
+                plan_packed_direct_fft(plan, dst, src);
+        }
+
+        void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, dst += stride, src += stride)
+                plan_packed_reverse_fft(plan, dst, src);
+        }
+
+        void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                plan_packed_direct_fft(plan, dst[i], src[i]);
+        }
+
+        void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                plan_packed_reverse_fft(plan, dst[i], src[i]);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFTBATCH_H_ */
@@ -0,0 +1,403 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FFTPLAN_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FFTPLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <private/dsp/fft.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        static constexpr size_t FFT_PLAN_ALIGN      = 0x40;
+        static constexpr size_t FFT_PLAN_RANK_MIN   = 3;
+        static constexpr size_t FFT_PLAN_RANK_MAX   = 31;
+
+        dsp::fft_plan_t *fft_plan_create(size_t rank)
+        {
+            if (rank > FFT_PLAN_RANK_MAX)
+                return NULL;
+
+            size_t items        = size_t(1) << rank;
+            size_t tw_count     = (rank >= FFT_PLAN_RANK_MIN) ? (items << 1) - 8 : 0;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::fft_plan_t) + FFT_PLAN_ALIGN - 1) & ~(FFT_PLAN_ALIGN - 1);
+            size_t szof_tw      = (tw_count * sizeof(float) + FFT_PLAN_ALIGN - 1) & ~(FFT_PLAN_ALIGN - 1);
+            size_t szof_rev     = items * sizeof(uint32_t);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + szof_tw + szof_rev + FFT_PLAN_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + FFT_PLAN_ALIGN - 1) & ~uintptr_t(FFT_PLAN_ALIGN - 1));
+            dsp::fft_plan_t *plan   = reinterpret_cast<dsp::fft_plan_t *>(ptr);
+            ptr                += szof_hdr;
+
+            plan->rank          = rank;
+            plan->data          = data;
+            plan->tw            = reinterpret_cast<float *>(ptr);
+            ptr                += szof_tw;
+            plan->rev           = reinterpret_cast<uint32_t *>(ptr);
+
+            // Bit-reversal permutation
+            plan->rev[0]        = 0;
+            for (size_t i=1; i<items; ++i)
+                plan->rev[i]        = (plan->rev[i >> 1] >> 1) | ((i & 1) << (rank - 1));
+
+            // Twiddle factors of butterfly stages: cos(pi*j/N) and sin(pi*j/N)
+            for (size_t n=4; n < items; n <<= 1)
+            {
+                float *w_re         = &plan->tw[(n << 1) - 8];
+                float *w_im         = &w_re[n];
+                for (size_t j=0; j<n; ++j)
+                {
+                    double a            = (M_PI * j) / n;
+                    w_re[j]             = cos(a);
+                    w_im[j]             = sin(a);
+                }
+            }
+
+            return plan;
+        }
+
+        void fft_plan_destroy(dsp::fft_plan_t *plan)
+        {
+            if (plan != NULL)
+                free(plan->data);
+        }
+
+        size_t fft_plan_rank(const dsp::fft_plan_t *plan)
+        {
+            return plan->rank;
+        }
+
+        static void plan_scramble_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            const uint32_t *rev = plan->rev;
+
+            if ((dst_re != src_re) && (dst_im != src_im))
+            {
+                for (size_t i=0; i<items; ++i)
+                {
+                    size_t j        = rev[i];
+                    dst_re[i]       = src_re[j];
+                    dst_im[i]       = src_im[j];
+                }
+                return;
+            }
+
+            dsp::move(dst_re, src_re, items);
+            dsp::move(dst_im, src_im, items);
+
+            for (size_t i=1; i<items; ++i)
+            {
+                size_t j        = rev[i];
+                if (i >= j)
+                    continue;
+
+                float re        = dst_re[i];
+                float im        = dst_im[i];
+                dst_re[i]       = dst_re[j];
+                dst_im[i]       = dst_im[j];
+                dst_re[j]       = re;
+                dst_im[j]       = im;
+            }
+        }
+
+        static void plan_packed_scramble_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            const uint32_t *rev = plan->rev;
+
+            if (dst != src)
+            {
+                for (size_t i=0; i<items; ++i)
+                {
+                    size_t j        = rev[i];
+                    dst[i*2]        = src[j*2];
+                    dst[i*2+1]      = src[j*2+1];
+                }
+                return;
+            }
+
+            for (size_t i=1; i<items; ++i)
+            {
+                size_t j        = rev[i];
+                if (i >= j)
+                    continue;
+
+                float re        = dst[i*2];
+                float im        = dst[i*2+1];
+                dst[i*2]        = dst[j*2];
+                dst[i*2+1]      = dst[j*2+1];
+                dst[j*2]        = re;
+                dst[j*2+1]      = im;
+            }
+        }
+
+        static inline void plan_butterfly(float *dst_re, float *dst_im, const float *tw_re, size_t n, size_t count, size_t blocks, float dir)
+        {
+            float c_re[4], c_im[4], w_im[4];
+            const float *tw_im  = &tw_re[n];
+
+            for (size_t p=0; p<blocks; ++p, dst_re += (n << 1), dst_im += (n << 1))
+            {
+                float *a_re         = dst_re;
+                float *a_im         = dst_im;
+                float *b_re         = &a_re[n];
+                float *b_im         = &a_im[n];
+
+                for (size_t k=0; k<count; k += 4)
+                {
+                    const float *w_re   = &tw_re[k];
+                    for (size_t i=0; i<4; ++i)
+                        w_im[i]             = dir * tw_im[k + i];
+
+                    // Calculate complex c = w * b
+                    for (size_t i=0; i<4; ++i)
+                    {
+                        c_re[i]             = w_re[i] * b_re[i] + w_im[i] * b_im[i];
+                        c_im[i]             = w_re[i] * b_im[i] - w_im[i] * b_re[i];
+                    }
+
+                    // Calculate the output values:
+                    // a'   = a + c
+                    // b'   = a - c
+                    for (size_t i=0; i<4; ++i)
+                    {
+                        b_re[i]             = a_re[i] - c_re[i];
+                        b_im[i]             = a_im[i] - c_im[i];
+                        a_re[i]             = a_re[i] + c_re[i];
+                        a_im[i]             = a_im[i] + c_im[i];
+                    }
+
+                    // Update pointers
+                    a_re               += 4;
+                    a_im               += 4;
+                    b_re               += 4;
+                    b_im               += 4;
+                }
+            }
+        }
+
+        static inline void plan_packed_butterfly(float *dst, const float *tw_re, size_t n, size_t count, size_t blocks, float dir)
+        {
+            float c_re[4], c_im[4], w_im[4];
+            const float *tw_im  = &tw_re[n];
+
+            for (size_t p=0; p<blocks; ++p, dst += (n << 2))
+            {
+                float *a            = dst;
+                float *b            = &a[n << 1];
+
+                for (size_t k=0; k<count; k += 4)
+                {
+                    const float *w_re   = &tw_re[k];
+                    for (size_t i=0; i<4; ++i)
+                        w_im[i]             = dir * tw_im[k + i];
+
+                    // Calculate complex c = w * b
+                    for (size_t i=0; i<4; ++i)
+                    {
+                        c_re[i]             = w_re[i] * b[i] + w_im[i] * b[i+4];
+                        c_im[i]             = w_re[i] * b[i+4] - w_im[i] * b[i];
+                    }
+
+                    // Calculate the output values:
+                    // a'   = a + c
+                    // b'   = a - c
+                    for (size_t i=0; i<4; ++i)
+                    {
+                        b[i]                = a[i] - c_re[i];
+                        b[i+4]              = a[i+4] - c_im[i];
+                        a[i]                = a[i] + c_re[i];
+                        a[i+4]              = a[i+4] + c_im[i];
+                    }
+
+                    // Update pointers
+                    a                  += 8;
+                    b                  += 8;
+                }
+            }
+        }
+
+        static void plan_butterfly_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, float dir)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            size_t block        = lsp_min(items, size_t(1) << dsp::FFT_BLOCK_RANK);
+
+            // Lower stages: process each block of data with all stages before switching to the next block
+            for (size_t off=0; off < items; off += block)
+                for (size_t n=4; n < block; n <<= 1)
+                    plan_butterfly(&dst_re[off], &dst_im[off], dsp::fft_plan_twiddles(plan, n), n, n, block / (n << 1), dir);
+
+            // Upper stages: process groups of stages column strip by column strip
+            for (size_t s=block; s < items; s <<= dsp::FFT_GROUP_RANK)
+            {
+                size_t last         = lsp_min(items, s << dsp::FFT_GROUP_RANK);
+                for (size_t off=0; off < items; off += last)
+                    for (size_t c=0; c < s; c += dsp::FFT_STRIP_SIZE)
+                        for (size_t n=s; n < last; n <<= 1)
+                            for (size_t r=c; r < n; r += s)
+                                plan_butterfly(&dst_re[off + r], &dst_im[off + r], &dsp::fft_plan_twiddles(plan, n)[r], n, dsp::FFT_STRIP_SIZE, last / (n << 1), dir);
+            }
+        }
+
+        static void plan_packed_butterfly_fft(const dsp::fft_plan_t *plan, float *dst, float dir)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            size_t block        = lsp_min(items, size_t(1) << dsp::FFT_BLOCK_RANK);
+
+            // Lower stages: process each block of data with all stages before switching to the next block
+            for (size_t off=0; off < items; off += block)
+                for (size_t n=4; n < block; n <<= 1)
+                    plan_packed_butterfly(&dst[off << 1], dsp::fft_plan_twiddles(plan, n), n, n, block / (n << 1), dir);
+
+            // Upper stages: process groups of stages column strip by column strip
+            for (size_t s=block; s < items; s <<= dsp::FFT_GROUP_RANK)
+            {
+                size_t last         = lsp_min(items, s << dsp::FFT_GROUP_RANK);
+                for (size_t off=0; off < items; off += last)
+                    for (size_t c=0; c < s; c += dsp::FFT_STRIP_SIZE)
+                        for (size_t n=s; n < last; n <<= 1)
+                            for (size_t r=c; r < n; r += s)
+                                plan_packed_butterfly(&dst[(off + r) << 1], &dsp::fft_plan_twiddles(plan, n)[r], n, dsp::FFT_STRIP_SIZE, last / (n << 1), dir);
+            }
+        }
+
+        void plan_direct_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank < FFT_PLAN_RANK_MIN)
+            {
+                direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            plan_scramble_fft(plan, dst_re, dst_im, src_re, src_im);
+            start_direct_fft(dst_re, dst_im, rank);
+            plan_butterfly_fft(plan, dst_re, dst_im, 1.0f);
+        }
+
+        void plan_reverse_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank         = plan->rank;
+            if (rank < FFT_PLAN_RANK_MIN)
+            {
+                reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            plan_scramble_fft(plan, dst_re, dst_im, src_re, src_im);
+            start_reverse_fft(dst_re, dst_im, rank);
+            plan_butterfly_fft(plan, dst_re, dst_im, -1.0f);
+            do_normalize_fft(dst_re, dst_im, rank);
+        }
+
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank < FFT_PLAN_RANK_MIN)
+            {
+                packed_direct_fft(dst, src, rank);
+                return;
+            }
+
+            plan_packed_scramble_fft(plan, dst, src);
+            start_packed_direct_fft(dst, rank);
+            plan_packed_butterfly_fft(plan, dst, 1.0f);
+            repack_fft(dst, rank);
+        }
+
+        void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank         = plan->rank;
+            if (rank < FFT_PLAN_RANK_MIN)
+            {
+                packed_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            plan_packed_scramble_fft(plan, dst, src);
+            start_packed_reverse_fft(dst, rank);
+            plan_packed_butterfly_fft(plan, dst, -1.0f);
+            repack_normalize_fft(dst, rank);
+        }
+
+        void plan_fastconv_parse(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            // The convolution of rank 0 has no input data
+            if (plan->rank < 1)
+                return;
+
+            size_t half         = size_t(1) << (plan->rank - 1);
+
+            // Pad the signal with zeros and perform the direct FFT
+            dsp::pcomplex_r2c(dst, src, half);
+            dsp::fill_zero(&dst[half << 1], half << 1);
+            dsp::plan_packed_direct_fft(plan, dst, dst);
+        }
+
+        void plan_fastconv_restore(const dsp::fft_plan_t *plan, float *dst, float *src)
+        {
+            if (plan->rank < 1)
+                return;
+
+            size_t items        = size_t(1) << plan->rank;
+
+            dsp::plan_packed_reverse_fft(plan, src, src);
+            dsp::pcomplex_c2r(dst, src, items);
+        }
+
+        void plan_fastconv_apply(const dsp::fft_plan_t *plan, float *dst, float *tmp, const float *c1, const float *c2)
+        {
+            if (plan->rank < 1)
+                return;
+
+            size_t items        = size_t(1) << plan->rank;
+
+            dsp::pcomplex_mul3(tmp, c1, c2, items);
+            dsp::plan_packed_reverse_fft(plan, tmp, tmp);
+            dsp::pcomplex_c2r_add2(dst, tmp, items);
+        }
+
+        void plan_fastconv_parse_apply(const dsp::fft_plan_t *plan, float *dst, float *tmp, const float *c, const float *src)
+        {
+            if (plan->rank < 1)
+                return;
+
+            size_t items        = size_t(1) << plan->rank;
+
+            dsp::plan_fastconv_parse(plan, tmp, src);
+            dsp::pcomplex_mul2(tmp, c, items);
+            dsp::plan_packed_reverse_fft(plan, tmp, tmp);
+            dsp::pcomplex_c2r_add2(dst, tmp, items);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FFTPLAN_H_ */
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FILTERS_DESIGN_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FILTERS_DESIGN_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static constexpr size_t FILTER_DESIGN_BLOCK     = 0x40;
+
+        static inline f_cascade_t *filter_design_store(f_cascade_t *c,
+            float t0, float t1, float t2, float b0, float b1, float b2, float kf)
+        {
+            float kf2       = kf * kf;
+
+            c->t[0]         = t0;
+            c->t[1]         = t1 * kf;
+            c->t[2]         = t2 * kf2;
+            c->t[3]         = 0.0f;
+
+            c->b[0]         = b0;
+            c->b[1]         = b1 * kf;
+            c->b[2]         = b2 * kf2;
+            c->b[3]         = 0.0f;
+
+            return c + 1;
+        }
+
+        /**
+         * Design cascades of the single filter
+         *
+         * @param c destination cascades
+         * @param p filter parameters
+         * @param a square root of the gain of each cascade for peak and shelving filters
+         * @param kf frequency scaling factor of the polynoms
+         * @return pointer to the cascade following the last written one
+         */
+        static f_cascade_t *filter_design_filter(f_cascade_t *c, const filter_params_t *p, float a, float kf)
+        {
+            const size_t slope  = lsp_max(p->slope, 1u);
+            float g             = p->gain;
+            float q             = p->q;
+
+            switch (p->type)
+            {
+                case LSP_DSP_FILTER_LOPASS:
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                        c   = filter_design_store(c, g, 0.0f, 0.0f, 1.0f, 1.0f / q, 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_HIPASS:
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                        c   = filter_design_store(c, 0.0f, 0.0f, g, 1.0f, 1.0f / q, 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_BANDPASS:
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                        c   = filter_design_store(c, 0.0f, g / q, 0.0f, 1.0f, 1.0f / q, 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_NOTCH:
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                        c   = filter_design_store(c, g, 0.0f, g, 1.0f, 1.0f / q, 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_ALLPASS:
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                        c   = filter_design_store(c, g, -g / q, g, 1.0f, 1.0f / q, 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_PEAK:
+                    for (size_t i=0; i<slope; ++i)
+                        c   = filter_design_store(c, 1.0f, a / q, 1.0f, 1.0f, 1.0f / (a * q), 1.0f, kf);
+                    break;
+
+                case LSP_DSP_FILTER_LOSHELF:
+                {
+                    float k     = sqrtf(a) / q;
+                    for (size_t i=0; i<slope; ++i)
+                        c   = filter_design_store(c, a*a, a*k, a, 1.0f, k, a, kf);
+                    break;
+                }
+
+                case LSP_DSP_FILTER_HISHELF:
+                {
+                    float k     = sqrtf(a) / q;
+                    for (size_t i=0; i<slope; ++i)
+                        c   = filter_design_store(c, a, a*k, a*a, a, k, 1.0f, kf);
+                    break;
+                }
+
+                case LSP_DSP_FILTER_BT_LOPASS:
+                case LSP_DSP_FILTER_BT_HIPASS:
+                {
+                    // Poles of the filter of order n lie on the unit circle:
+                    //   s^2 + 2*sin((2*k+1)*pi/(2*n))*s + 1
+                    float d     = M_PI / (4 * slope);
+                    float sn    = sinf(d), cs = cosf(d);
+                    float sn2   = 2.0f * sn * cs, cs2 = cs*cs - sn*sn;
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                    {
+                        c   = (p->type == LSP_DSP_FILTER_BT_LOPASS) ?
+                            filter_design_store(c, g, 0.0f, 0.0f, 1.0f, 2.0f * sn, 1.0f, kf) :
+                            filter_design_store(c, 0.0f, 0.0f, g, 1.0f, 2.0f * sn, 1.0f, kf);
+
+                        // Rotate the angle
+                        float t     = sn*cs2 + cs*sn2;
+                        cs          = cs*cs2 - sn*sn2;
+                        sn          = t;
+                    }
+                    break;
+                }
+
+                case LSP_DSP_FILTER_CH_LOPASS:
+                case LSP_DSP_FILTER_CH_HIPASS:
+                {
+                    // Poles of the filter of order n lie on the ellipse:
+                    //   s = -sinh(mu)*sin(theta) + j*cosh(mu)*cos(theta), theta = (2*k+1)*pi/(2*n)
+                    float eps   = sqrtf(expf(q * (M_LN10 * 0.1f)) - 1.0f);
+                    eps         = lsp_max(eps, 1e-4f);
+                    float mu    = asinhf(1.0f / eps) / (2 * slope);
+                    float em    = expf(mu);
+                    float sh    = 0.5f * (em - 1.0f / em);
+                    float ch    = 0.5f * (em + 1.0f / em);
+
+                    float d     = M_PI / (4 * slope);
+                    float sn    = sinf(d), cs = cosf(d);
+                    float sn2   = 2.0f * sn * cs, cs2 = cs*cs - sn*sn;
+                    for (size_t i=0; i<slope; ++i, g = 1.0f)
+                    {
+                        // Normalize cascade to the unit gain in the passband
+                        float re    = sh * sn;
+                        float im    = ch * cs;
+                        float w2    = 1.0f / (re*re + im*im);
+
+                        c   = (p->type == LSP_DSP_FILTER_CH_LOPASS) ?
+                            filter_design_store(c, g, 0.0f, 0.0f, 1.0f, 2.0f * re * w2, w2, kf) :
+                            filter_design_store(c, 0.0f, 0.0f, g, w2, 2.0f * re * w2, 1.0f, kf);
+
+                        // Rotate the angle
+                        float t     = sn*cs2 + cs*sn2;
+                        cs          = cs*cs2 - sn*sn2;
+                        sn          = t;
+                    }
+                    break;
+                }
+
+                case LSP_DSP_FILTER_LR_LOPASS:
+                case LSP_DSP_FILTER_LR_HIPASS:
+                {
+                    // Each cascade of the Butterworth filter of order 'slope' is doubled,
+                    // the first-order cascade of the odd order becomes (s + 1)^2
+                    const bool lo   = (p->type == LSP_DSP_FILTER_LR_LOPASS);
+                    float d         = M_PI / (2 * slope);
+                    float sn        = sinf(d), cs = cosf(d);
+                    float sn2       = 2.0f * sn * cs, cs2 = cs*cs - sn*sn;
+                    for (size_t i=0; i < (slope >> 1); ++i)
+                    {
+                        for (size_t j=0; j<2; ++j, g = 1.0f)
+                            c   = (lo) ?
+                                filter_design_store(c, g, 0.0f, 0.0f, 1.0f, 2.0f * sn, 1.0f, kf) :
+                                filter_design_store(c, 0.0f, 0.0f, g, 1.0f, 2.0f * sn, 1.0f, kf);
+
+                        // Rotate the angle
+                        float t     = sn*cs2 + cs*sn2;
+                        cs          = cs*cs2 - sn*sn2;
+                        sn          = t;
+                    }
+                    if (slope & 1)
+                        c   = (lo) ?
+                            filter_design_store(c, g, 0.0f, 0.0f, 1.0f, 2.0f, 1.0f, kf) :
+                            filter_design_store(c, 0.0f, 0.0f, g, 1.0f, 2.0f, 1.0f, kf);
+                    break;
+                }
+
+                default:
+                    // Unknown filter type: pass the signal unchanged
+                    for (size_t i=0; i<slope; ++i)
+                        c   = filter_design_store(c, 1.0f, 2.0f, 1.0f, 1.0f, 2.0f, 1.0f, 1.0f);
+                    break;
+            }
+
+            return c;
+        }
+
+        static size_t filter_design_internal(f_cascade_t *dst, const filter_params_t *p, size_t count, bool prewarp)
+        {
+            float kf[FILTER_DESIGN_BLOCK] __lsp_aligned16;
+            float ka[FILTER_DESIGN_BLOCK] __lsp_aligned16;
+            float tmp[FILTER_DESIGN_BLOCK] __lsp_aligned16;
+
+            f_cascade_t *c  = dst;
+
+            for (size_t off=0; off < count; )
+            {
+                size_t n        = lsp_min(count - off, FILTER_DESIGN_BLOCK);
+                const filter_params_t *fp = &p[off];
+
+                // Compute frequency scaling factors kf = 1/tan(pi*f)
+                if (prewarp)
+                {
+                    for (size_t i=0; i<n; ++i)
+                        tmp[i]          = M_PI * fp[i].freq;
+                    dsp::cosf2(kf, tmp, n);
+                    dsp::sinf2(tmp, tmp, n);
+                    dsp::div2(kf, tmp, n);
+                }
+                else
+                    dsp::fill(kf, 1.0f, n);
+
+                // Compute square root of the gain of each cascade a = gain^(1/(2*slope))
+                for (size_t i=0; i<n; ++i)
+                {
+                    ka[i]           = fp[i].gain;
+                    tmp[i]          = 0.5f / lsp_max(fp[i].slope, 1u);
+                }
+                dsp::powvx1(ka, tmp, n);
+
+                // Design filters
+                for (size_t i=0; i<n; ++i)
+                    c               = filter_design_filter(c, &fp[i], ka[i], kf[i]);
+
+                off            += n;
+            }
+
+            return c - dst;
+        }
+
+        size_t filter_design_cascades(f_cascade_t *dst, const filter_params_t *p, size_t count)
+        {
+            return filter_design_internal(dst, p, count, false);
+        }
+
+        size_t filter_design_bilinear(f_cascade_t *dst, const filter_params_t *p, size_t count, size_t lanes)
+        {
+            size_t n        = filter_design_internal(dst, p, count, true);
+            if (lanes <= 1)
+                return n;
+
+            // Pad with the cascades that pass the signal unchanged. The (s+1)^2 polynom
+            // is used because the bilinear transform of it with kf=1 gives exactly b0=1
+            // while the constant polynom gives double zero and double pole at z=-1
+            for (f_cascade_t *c = &dst[n]; n % lanes; ++n)
+                c               = filter_design_store(c, 1.0f, 2.0f, 1.0f, 1.0f, 2.0f, 1.0f, 1.0f);
+
+            return n;
+        }
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FILTERS_DESIGN_H_ */
@@ -30,6 +30,252 @@ namespace lsp
 {
     namespace generic
     {
+        static constexpr size_t DYN_BIQUAD_DESIGN_BLOCK     = 0x40;
+
+        /**
+         * Compute coefficients of the dynamic filter for each sample. The coefficient k
+         * of the sample i is stored at dst[i*stride + k*step]
+         */
+        static void dyn_biquad_design_internal(float *dst, size_t step, size_t stride, const dyn_filter_params_t *p, size_t count)
+        {
+            float sn[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float cs[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float kg[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float kq[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float ka[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float al[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float a0[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float b0[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float b1[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float b2[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float a1[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+            float a2[DYN_BIQUAD_DESIGN_BLOCK] __lsp_aligned16;
+
+            const float *fg = p->gain;
+            const float *fq = p->q;
+            if (fg == NULL)
+                dsp::fill(kg, p->k_gain, DYN_BIQUAD_DESIGN_BLOCK);
+            if (fq == NULL)
+                dsp::fill(kq, p->k_q, DYN_BIQUAD_DESIGN_BLOCK);
+
+            for (size_t off=0; off < count; )
+            {
+                size_t n        = lsp_min(count - off, DYN_BIQUAD_DESIGN_BLOCK);
+                const float *g  = (fg != NULL) ? &fg[off] : kg;
+                const float *q  = (fq != NULL) ? &fq[off] : kq;
+
+                // Compute sine and cosine of the angular frequency
+                if (p->freq != NULL)
+                    dsp::mul_k3(cs, &p->freq[off], 2.0f * M_PI, n);
+                else
+                    dsp::fill(cs, 2.0f * M_PI * p->k_freq, n);
+                dsp::sinf2(sn, cs, n);
+                dsp::cosf2(cs, cs, n);
+
+                switch (p->type)
+                {
+                    case LSP_DSP_FILTER_LOPASS:
+                    case LSP_DSP_FILTER_HIPASS:
+                    case LSP_DSP_FILTER_BANDPASS:
+                    case LSP_DSP_FILTER_NOTCH:
+                    case LSP_DSP_FILTER_ALLPASS:
+                    case LSP_DSP_FILTER_PEAK:
+                        // alpha = sin(w) / (2*q)
+                        dsp::div3(al, sn, q, n);
+                        dsp::mul_k2(al, 0.5f, n);
+                        break;
+                    default:
+                        break;
+                }
+
+                switch (p->type)
+                {
+                    case LSP_DSP_FILTER_LOPASS:
+                    case LSP_DSP_FILTER_HIPASS:
+                    case LSP_DSP_FILTER_BANDPASS:
+                    case LSP_DSP_FILTER_NOTCH:
+                    case LSP_DSP_FILTER_ALLPASS:
+                        // a0 = 1 / (1 + alpha), a1 = 2*c*a0, a2 = (alpha - 1)*a0
+                        dsp::add_k3(a0, al, 1.0f, n);
+                        dsp::rdiv_k2(a0, 1.0f, n);
+                        dsp::fmmul_k4(a1, cs, a0, 2.0f, n);
+                        dsp::sub_k3(a2, al, 1.0f, n);
+                        dsp::mul2(a2, a0, n);
+                        break;
+                    default:
+                        break;
+                }
+
+                switch (p->type)
+                {
+                    case LSP_DSP_FILTER_LOPASS:
+                        // b1 = g*(1 - c)*a0, b0 = b2 = b1/2
+                        dsp::rsub_k3(b1, cs, 1.0f, n);
+                        dsp::fmmul3(b1, g, a0, n);
+                        dsp::mul_k3(b0, b1, 0.5f, n);
+                        dsp::copy(b2, b0, n);
+                        break;
+
+                    case LSP_DSP_FILTER_HIPASS:
+                        // b0 = b2 = g*(1 + c)*a0/2, b1 = -g*(1 + c)*a0
+                        dsp::add_k3(b0, cs, 1.0f, n);
+                        dsp::fmmul3(b0, g, a0, n);
+                        dsp::mul_k3(b1, b0, -1.0f, n);
+                        dsp::mul_k2(b0, 0.5f, n);
+                        dsp::copy(b2, b0, n);
+                        break;
+
+                    case LSP_DSP_FILTER_BANDPASS:
+                        // b0 = g*alpha*a0, b1 = 0, b2 = -b0
+                        dsp::fmmul4(b0, g, al, a0, n);
+                        dsp::fill_zero(b1, n);
+                        dsp::mul_k3(b2, b0, -1.0f, n);
+                        break;
+
+                    case LSP_DSP_FILTER_NOTCH:
+                        // b0 = b2 = g*a0, b1 = -2*c*b0
+                        dsp::mul3(b0, g, a0, n);
+                        dsp::fmmul_k4(b1, b0, cs, -2.0f, n);
+                        dsp::copy(b2, b0, n);
+                        break;
+
+                    case LSP_DSP_FILTER_ALLPASS:
+                        // b0 = g*a0*(1 - alpha), b1 = -2*c*g*a0, b2 = g*a0*(1 + alpha)
+                        dsp::mul3(sn, g, a0, n);
+                        dsp::rsub_k3(b0, al, 1.0f, n);
+                        dsp::mul2(b0, sn, n);
+                        dsp::fmmul_k4(b1, sn, cs, -2.0f, n);
+                        dsp::add_k3(b2, al, 1.0f, n);
+                        dsp::mul2(b2, sn, n);
+                        break;
+
+                    case LSP_DSP_FILTER_PEAK:
+                        // A = sqrt(g), a0 = 1 / (1 + alpha/A), a1 = -b1 = 2*c*a0, a2 = (alpha/A - 1)*a0
+                        dsp::ssqrt2(ka, g, n);
+                        dsp::div3(sn, al, ka, n);
+                        dsp::add_k3(a0, sn, 1.0f, n);
+                        dsp::rdiv_k2(a0, 1.0f, n);
+                        dsp::fmmul_k4(a1, cs, a0, 2.0f, n);
+                        dsp::mul_k3(b1, a1, -1.0f, n);
+                        dsp::sub_k3(a2, sn, 1.0f, n);
+                        dsp::mul2(a2, a0, n);
+                        // b0 = (1 + alpha*A)*a0, b2 = (1 - alpha*A)*a0
+                        dsp::mul3(sn, al, ka, n);
+                        dsp::add_k3(b0, sn, 1.0f, n);
+                        dsp::mul2(b0, a0, n);
+                        dsp::rsub_k3(b2, sn, 1.0f, n);
+                        dsp::mul2(b2, a0, n);
+                        break;
+
+                    case LSP_DSP_FILTER_LOSHELF:
+                    case LSP_DSP_FILTER_HISHELF:
+                        // A = sqrt(g), beta = sqrt(A)*sin(w)/q
+                        dsp::ssqrt2(ka, g, n);
+                        dsp::ssqrt2(al, ka, n);
+                        dsp::mul2(al, sn, n);
+                        dsp::div2(al, q, n);
+
+                        // ap = A + 1 is kept in a1, am = A - 1 in a2, am*c in sn
+                        dsp::add_k3(a1, ka, 1.0f, n);
+                        dsp::sub_k3(a2, ka, 1.0f, n);
+                        dsp::mul3(sn, a2, cs, n);
+
+                        // tp is kept in b0, bp in b2, then a1 becomes ap*c
+                        if (p->type == LSP_DSP_FILTER_LOSHELF)
+                        {
+                            dsp::sub3(b0, a1, sn, n);
+                            dsp::add3(b2, a1, sn, n);
+                        }
+                        else
+                        {
+                            dsp::add3(b0, a1, sn, n);
+                            dsp::sub3(b2, a1, sn, n);
+                        }
+                        dsp::mul2(a1, cs, n);
+
+                        // a0 = 1 / (bp + beta)
+                        dsp::add3(a0, b2, al, n);
+                        dsp::rdiv_k2(a0, 1.0f, n);
+
+                        if (p->type == LSP_DSP_FILTER_LOSHELF)
+                        {
+                            // b1 = 2*A*(am - ap*c)*a0, a1 = 2*(am + ap*c)*a0
+                            dsp::sub3(b1, a2, a1, n);
+                            dsp::mul2(b1, ka, n);
+                            dsp::fmmul_k3(b1, a0, 2.0f, n);
+                            dsp::add2(a1, a2, n);
+                        }
+                        else
+                        {
+                            // b1 = -2*A*(am + ap*c)*a0, a1 = 2*(ap*c - am)*a0
+                            dsp::add3(b1, a2, a1, n);
+                            dsp::mul2(b1, ka, n);
+                            dsp::fmmul_k3(b1, a0, -2.0f, n);
+                            dsp::sub2(a1, a2, n);
+                        }
+                        dsp::fmmul_k3(a1, a0, 2.0f, n);
+
+                        // a2 = (beta - bp)*a0, b2 = A*(tp - beta)*a0, b0 = A*(tp + beta)*a0
+                        dsp::sub3(a2, al, b2, n);
+                        dsp::mul2(a2, a0, n);
+                        dsp::sub3(b2, b0, al, n);
+                        dsp::fmmul3(b2, ka, a0, n);
+                        dsp::add2(b0, al, n);
+                        dsp::fmmul3(b0, ka, a0, n);
+                        break;
+
+                    default:
+                        // Unknown filter type: pass the signal unchanged
+                        dsp::fill_one(b0, n);
+                        dsp::fill_zero(b1, n);
+                        dsp::fill_zero(b2, n);
+                        dsp::fill_zero(a1, n);
+                        dsp::fill_zero(a2, n);
+                        break;
+                }
+
+                // Store coefficients to the destination
+                float *d        = &dst[off * stride];
+                for (size_t i=0; i<n; ++i, d += stride)
+                {
+                    d[0]        = b0[i];
+                    d[step]     = b1[i];
+                    d[step*2]   = b2[i];
+                    d[step*3]   = a1[i];
+                    d[step*4]   = a2[i];
+                }
+
+                off            += n;
+            }
+        }
+
+        /**
+         * Fill the cells of the shifted matrix of dynamic filters that do not correspond
+         * to any sample with the cascade that passes the signal unchanged
+         */
+        static void dyn_biquad_design_bypass(float *dst, size_t lanes, size_t stride, size_t count)
+        {
+            // Lane j holds the sample i at the bank i+j, the coefficient k is stored at dst[k*lanes]
+            for (size_t j=0; j<lanes; ++j, ++dst)
+            {
+                float *head     = dst;
+                float *tail     = &dst[(count + j) * stride];
+
+                for (size_t i=0; i<j; ++i, head += stride)
+                {
+                    head[0]         = 1.0f;
+                    for (size_t k=1; k<5; ++k)
+                        head[k*lanes]   = 0.0f;
+                }
+                for (size_t i=j+1; i<lanes; ++i, tail += stride)
+                {
+                    tail[0]         = 1.0f;
+                    for (size_t k=1; k<5; ++k)
+                        tail[k*lanes]   = 0.0f;
+                }
+            }
+        }
+
         void dyn_biquad_process_x1(float *dst, const float *src, float *d, size_t count, const biquad_x1_t *f)
         {
             while (count--)
@@ -401,6 +647,88 @@ namespace lsp
                 d          += 4;   // Shift memory pointer by 4 floats
             }
         }
+
+        void dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const biquad_x16_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            // Apply cascades one after another: the cascade j takes the
+            // coefficients for the sample i from the bank f[i + j]
+            const float *sp = src;
+            for (size_t j=0; j<16; ++j)
+            {
+                const biquad_x16_t *bq  = &f[j];
+                float d0                = d[j];
+                float d1                = d[j + 16];
+
+                for (size_t i=0; i<count; ++i, ++bq)
+                {
+                    float s     = sp[i];
+                    float s2    = bq->b0[j]*s + d0;
+                    float p1    = bq->b1[j]*s + bq->a1[j]*s2;
+                    float p2    = bq->b2[j]*s + bq->a2[j]*s2;
+
+                    dst[i]      = s2;
+
+                    // Shift buffer
+                    d0          = d1 + p1;
+                    d1          = p2;
+                }
+
+                d[j]        = d0;
+                d[j + 16]   = d1;
+                sp          = dst;
+            }
+        }
+
+        void dyn_biquad_design_x1(biquad_x1_t *bf, const dyn_filter_params_t *p, size_t count)
+        {
+            dyn_biquad_design_internal(&bf->b0, 1, sizeof(biquad_x1_t)/sizeof(float), p, count);
+            for (size_t i=0; i<count; ++i, ++bf)
+            {
+                bf->p0          = 0.0f;
+                bf->p1          = 0.0f;
+                bf->p2          = 0.0f;
+            }
+        }
+
+        void dyn_biquad_design_x2(biquad_x2_t *bf, const dyn_filter_params_t *p, size_t count)
+        {
+            const size_t stride = sizeof(biquad_x2_t)/sizeof(float);
+            for (size_t j=0; j<2; ++j)
+                dyn_biquad_design_internal(&bf[j].b0[j], 2, stride, &p[j], count);
+            dyn_biquad_design_bypass(bf->b0, 2, stride, count);
+            for (size_t i=0; i<=count; ++i)
+            {
+                bf[i].p[0]      = 0.0f;
+                bf[i].p[1]      = 0.0f;
+            }
+        }
+
+        void dyn_biquad_design_x4(biquad_x4_t *bf, const dyn_filter_params_t *p, size_t count)
+        {
+            const size_t stride = sizeof(biquad_x4_t)/sizeof(float);
+            for (size_t j=0; j<4; ++j)
+                dyn_biquad_design_internal(&bf[j].b0[j], 4, stride, &p[j], count);
+            dyn_biquad_design_bypass(bf->b0, 4, stride, count);
+        }
+
+        void dyn_biquad_design_x8(biquad_x8_t *bf, const dyn_filter_params_t *p, size_t count)
+        {
+            const size_t stride = sizeof(biquad_x8_t)/sizeof(float);
+            for (size_t j=0; j<8; ++j)
+                dyn_biquad_design_internal(&bf[j].b0[j], 8, stride, &p[j], count);
+            dyn_biquad_design_bypass(bf->b0, 8, stride, count);
+        }
+
+        void dyn_biquad_design_x16(biquad_x16_t *bf, const dyn_filter_params_t *p, size_t count)
+        {
+            const size_t stride = sizeof(biquad_x16_t)/sizeof(float);
+            for (size_t j=0; j<16; ++j)
+                dyn_biquad_design_internal(&bf[j].b0[j], 16, stride, &p[j], count);
+            dyn_biquad_design_bypass(bf->b0, 16, stride, count);
+        }
     }
 }
 
@@ -388,6 +388,829 @@ namespace lsp
                 d          += 4;
             }
         }
+
+        void biquad_process_x16(float *dst, const float *src, float *d, size_t count, const biquad_x16_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            // Apply cascades one after another, the result is the same as for pipelined processing
+            const float *sp = src;
+            for (size_t j=0; j<16; ++j)
+            {
+                const float b0  = f->b0[j], b1 = f->b1[j], b2 = f->b2[j];
+                const float a1  = f->a1[j], a2 = f->a2[j];
+                float d0        = d[j];
+                float d1        = d[j + 16];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    float s     = sp[i];
+                    float s2    = b0*s + d0;
+                    float p1    = b1*s + a1*s2;
+                    float p2    = b2*s + a2*s2;
+
+                    dst[i]      = s2;
+
+                    // Shift buffer
+                    d0          = d1 + p1;
+                    d1          = p2;
+                }
+
+                d[j]        = d0;
+                d[j + 16]   = d1;
+                sp          = dst;
+            }
+        }
+
+        void biquad_process_x1_f64(double *dst, const double *src, size_t count, biquad_f64_t *f)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                double s    = src[i];
+                //   a: a0 a1 a2 0
+                //   b: b1 b2 0  0
+                double s2   = f->x1.b0*s + f->d[0];
+                double p1   = f->x1.b1*s + f->x1.a1*s2;
+                double p2   = f->x1.b2*s + f->x1.a2*s2;
+
+                dst[i]      = s2;
+
+                // Shift buffer
+                f->d[0]     = f->d[1] + p1;
+                f->d[1]     = p2;
+            }
+        }
+
+        void biquad_process_x2_f64(double *dst, const double *src, size_t count, biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            double s, r, s2, r2, p1, q1, p2, q2;
+
+            // First filter only
+            s           = *(src++);
+            s2          = f->x2.b0[0]*s + f->d[0];
+            p1          = f->x2.b1[0]*s + f->x2.a1[0]*s2;
+            p2          = f->x2.b2[0]*s + f->x2.a2[0]*s2;
+            r           = s2;
+            f->d[0]     = f->d[2] + p1;
+            f->d[2]     = p2;
+
+            // Both filters
+            for (size_t i=1; i<count; ++i)
+            {
+                s           = *(src++);
+                r2          = f->x2.b0[1]*r + f->d[1];
+                s2          = f->x2.b0[0]*s + f->d[0];
+
+                q1          = f->x2.b1[1]*r + f->x2.a1[1]*r2;
+                p1          = f->x2.b1[0]*s + f->x2.a1[0]*s2;
+                q2          = f->x2.b2[1]*r + f->x2.a2[1]*r2;
+                p2          = f->x2.b2[0]*s + f->x2.a2[0]*s2;
+
+                r           = s2;
+                *(dst++)    = r2;
+
+                // Shift buffers
+                f->d[1]     = f->d[3] + q1;
+                f->d[0]     = f->d[2] + p1;
+                f->d[3]     = q2;
+                f->d[2]     = p2;
+            }
+
+            // Second filter only
+            r2          = f->x2.b0[1]*r + f->d[1];
+            q1          = f->x2.b1[1]*r + f->x2.a1[1]*r2;
+            q2          = f->x2.b2[1]*r + f->x2.a2[1]*r2;
+            *dst        = r2;
+            f->d[1]     = f->d[3] + q1;
+            f->d[3]     = q2;
+        }
+
+        void biquad_process_x4_f64(double *dst, const double *src, size_t count, biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            double s[4], s2[4], p1[4], p2[4];
+            s[0]        = 0.0;
+            s[1]        = 0.0;
+            s[2]        = 0.0;
+            s[3]        = 0.0;
+            s2[0]       = 0.0;
+            s2[1]       = 0.0;
+            s2[2]       = 0.0;
+            s2[3]       = 0.0;
+
+            size_t mask = 1;
+
+            // Start filters, mask enables the specific filter
+            do
+            {
+                // Push sample
+                s[0]        = *(src++);
+
+                // Calculate filters by mask and shift buffers
+                s2[0]       = f->x4.b0[0]*s[0] + f->d[0];
+                p1[0]       = f->x4.b1[0]*s[0] + f->x4.a1[0]*s2[0];
+                p2[0]       = f->x4.b2[0]*s[0] + f->x4.a2[0]*s2[0];
+                f->d[0]     = f->d[4] + p1[0];
+                f->d[4]     = p2[0];
+
+                if (mask & 0x2)
+                {
+                    s2[1]       = f->x4.b0[1]*s[1] + f->d[1];
+                    p1[1]       = f->x4.b1[1]*s[1] + f->x4.a1[1]*s2[1];
+                    p2[1]       = f->x4.b2[1]*s[1] + f->x4.a2[1]*s2[1];
+                    f->d[1]     = f->d[5] + p1[1];
+                    f->d[5]     = p2[1];
+                }
+                if (mask & 0x4)
+                {
+                    s2[2]       = f->x4.b0[2]*s[2] + f->d[2];
+                    p1[2]       = f->x4.b1[2]*s[2] + f->x4.a1[2]*s2[2];
+                    p2[2]       = f->x4.b2[2]*s[2] + f->x4.a2[2]*s2[2];
+                    f->d[2]     = f->d[6] + p1[2];
+                    f->d[6]     = p2[2];
+                }
+
+                // Shift buffer
+                s[3]        = s2[2];
+                s[2]        = s2[1];
+                s[1]        = s2[0];
+
+                if ((--count) <= 0)
+                    break;
+                mask        = (mask << 1) | 1;
+            } while (mask != 0x0f);
+
+            // Process all filters simultaneously, mask = 0x0f
+            for ( ; count > 0; --count)
+            {
+                // Push sample
+                s[0]        = *(src++);
+
+                // Calculate filters by mask and shift buffers
+                s2[0]       = f->x4.b0[0]*s[0] + f->d[0];
+                s2[1]       = f->x4.b0[1]*s[1] + f->d[1];
+                s2[2]       = f->x4.b0[2]*s[2] + f->d[2];
+                s2[3]       = f->x4.b0[3]*s[3] + f->d[3];
+
+                p1[0]       = f->x4.b1[0]*s[0] + f->x4.a1[0]*s2[0];
+                p1[1]       = f->x4.b1[1]*s[1] + f->x4.a1[1]*s2[1];
+                p1[2]       = f->x4.b1[2]*s[2] + f->x4.a1[2]*s2[2];
+                p1[3]       = f->x4.b1[3]*s[3] + f->x4.a1[3]*s2[3];
+
+                p2[0]       = f->x4.b2[0]*s[0] + f->x4.a2[0]*s2[0];
+                p2[1]       = f->x4.b2[1]*s[1] + f->x4.a2[1]*s2[1];
+                p2[2]       = f->x4.b2[2]*s[2] + f->x4.a2[2]*s2[2];
+                p2[3]       = f->x4.b2[3]*s[3] + f->x4.a2[3]*s2[3];
+
+                f->d[0]     = f->d[4] + p1[0];
+                f->d[1]     = f->d[5] + p1[1];
+                f->d[2]     = f->d[6] + p1[2];
+                f->d[3]     = f->d[7] + p1[3];
+
+                f->d[4]     = p2[0];
+                f->d[5]     = p2[1];
+                f->d[6]     = p2[2];
+                f->d[7]     = p2[3];
+
+                // Shift buffer
+                *(dst++)    = s2[3];
+                s[3]        = s2[2];
+                s[2]        = s2[1];
+                s[1]        = s2[0];
+            }
+
+            // Finish processing
+            mask      <<= 1;
+            do
+            {
+                // Calculate filters by mask and shift buffers
+                if (mask & 0x2)
+                {
+                    s2[1]       = f->x4.b0[1]*s[1] + f->d[1];
+                    p1[1]       = f->x4.b1[1]*s[1] + f->x4.a1[1]*s2[1];
+                    p2[1]       = f->x4.b2[1]*s[1] + f->x4.a2[1]*s2[1];
+                    f->d[1]     = f->d[5] + p1[1];
+                    f->d[5]     = p2[1];
+                }
+                if (mask & 0x4)
+                {
+                    s2[2]       = f->x4.b0[2]*s[2] + f->d[2];
+                    p1[2]       = f->x4.b1[2]*s[2] + f->x4.a1[2]*s2[2];
+                    p2[2]       = f->x4.b2[2]*s[2] + f->x4.a2[2]*s2[2];
+                    f->d[2]     = f->d[6] + p1[2];
+                    f->d[6]     = p2[2];
+                }
+                if (mask & 0x08)
+                {
+                    s2[3]       = f->x4.b0[3]*s[3] + f->d[3];
+                    p1[3]       = f->x4.b1[3]*s[3] + f->x4.a1[3]*s2[3];
+                    p2[3]       = f->x4.b2[3]*s[3] + f->x4.a2[3]*s2[3];
+                    f->d[3]     = f->d[7] + p1[3];
+                    f->d[7]     = p2[3];
+
+                    *(dst++)    = s2[3];
+                }
+
+                // Shift buffer
+                s[3]        = s2[2];
+                s[2]        = s2[1];
+                s[1]        = s2[0];
+
+                // Update mask
+                mask      <<= 1;
+            } while (mask & 0x0f);
+        }
+
+        void biquad_process_x8_f64(double *dst, const double *src, size_t count, biquad_f64_t *f)
+        {
+            // This code already works badly instead of biquad_process_x4
+            if (count <= 0)
+                return;
+
+            double s[4], s2[4], p1[4], p2[4];
+            s[0]            = 0.0;
+            s[1]            = 0.0;
+            s[2]            = 0.0;
+            s[3]            = 0.0;
+            s2[0]           = 0.0;
+            s2[1]           = 0.0;
+            s2[2]           = 0.0;
+            s2[3]           = 0.0;
+
+            const double *sp = src;
+            double *d       = f->d;
+
+            // Calculate as two passes of x4 filters
+            for (size_t n=0; n<=4; n += 4)
+            {
+                // two x4 filters are in parallel, shift by 4 floats stride
+                biquad_f64_x8_t *bq = reinterpret_cast<biquad_f64_x8_t *>(&f->x8.b0[n]);
+                size_t mask     = 1;
+                size_t i        = 0;
+                double *dp      = dst;
+
+                // Start filters, mask enables the specific filter
+                do
+                {
+                    // Push sample
+                    s[0]        = *(sp++);
+
+                    // Calculate filters by mask and shift buffers
+                    s2[0]       = bq->b0[0]*s[0] + d[0];
+                    p1[0]       = bq->b1[0]*s[0] + bq->a1[0]*s2[0];
+                    p2[0]       = bq->b2[0]*s[0] + bq->a2[0]*s2[0];
+                    d[0]        = d[8]   + p1[0];
+                    d[8]        = p2[0];
+
+                    if (mask & 0x2)
+                    {
+                        s2[1]       = bq->b0[1]*s[1] + d[1];
+                        p1[1]       = bq->b1[1]*s[1] + bq->a1[1]*s2[1];
+                        p2[1]       = bq->b2[1]*s[1] + bq->a2[1]*s2[1];
+                        d[1]        = d[9]   + p1[1];
+                        d[9]        = p2[1];
+                    }
+                    if (mask & 0x4)
+                    {
+                        s2[2]       = bq->b0[2]*s[2] + d[2];
+                        p1[2]       = bq->b1[2]*s[2] + bq->a1[2]*s2[2];
+                        p2[2]       = bq->b2[2]*s[2] + bq->a2[2]*s2[2];
+                        d[2]        = d[10]  + p1[2];
+                        d[10]       = p2[2];
+                    }
+
+                    // Shift buffer
+                    s[3]        = s2[2];
+                    s[2]        = s2[1];
+                    s[1]        = s2[0];
+
+                    // Update mask
+                    if ((++i) >= count)
+                        break;
+                    mask        = (mask << 1) | 1;
+                } while (mask != 0x0f);
+
+                // Process all filters simultaneously
+                for ( ; i < count; ++i)
+                {
+                    // Push sample
+                    s[0]        = *(sp++);
+
+                    // Calculate filters by mask and shift buffers
+                    s2[0]       = bq->b0[0]*s[0] + d[0];
+                    s2[1]       = bq->b0[1]*s[1] + d[1];
+                    s2[2]       = bq->b0[2]*s[2] + d[2];
+                    s2[3]       = bq->b0[3]*s[3] + d[3];
+
+                    p1[0]       = bq->b1[0]*s[0] + bq->a1[0]*s2[0];
+                    p1[1]       = bq->b1[1]*s[1] + bq->a1[1]*s2[1];
+                    p1[2]       = bq->b1[2]*s[2] + bq->a1[2]*s2[2];
+                    p1[3]       = bq->b1[3]*s[3] + bq->a1[3]*s2[3];
+
+                    p2[0]       = bq->b2[0]*s[0] + bq->a2[0]*s2[0];
+                    p2[1]       = bq->b2[1]*s[1] + bq->a2[1]*s2[1];
+                    p2[2]       = bq->b2[2]*s[2] + bq->a2[2]*s2[2];
+                    p2[3]       = bq->b2[3]*s[3] + bq->a2[3]*s2[3];
+
+                    d[0]        = d[8]   + p1[0];
+                    d[1]        = d[9]   + p1[1];
+                    d[2]        = d[10]  + p1[2];
+                    d[3]        = d[11]  + p1[3];
+
+                    d[8]        = p2[0];
+                    d[9]        = p2[1];
+                    d[10]       = p2[2];
+                    d[11]       = p2[3];
+
+                    // Shift buffer
+                    *(dp++)     = s2[3];
+                    s[3]        = s2[2];
+                    s[2]        = s2[1];
+                    s[1]        = s2[0];
+                }
+
+                // Finish processing
+                mask      <<= 1;
+                do
+                {
+                    // Calculate filters by mask and shift buffers
+                    if (mask & 0x2)
+                    {
+                        s2[1]       = bq->b0[1]*s[1] + d[1];
+                        p1[1]       = bq->b1[1]*s[1] + bq->a1[1]*s2[1];
+                        p2[1]       = bq->b2[1]*s[1] + bq->a2[1]*s2[1];
+                        d[1]        = d[9]   + p1[1];
+                        d[9]        = p2[1];
+                    }
+                    if (mask & 0x4)
+                    {
+                        s2[2]       = bq->b0[2]*s[2] + d[2];
+                        p1[2]       = bq->b1[2]*s[2] + bq->a1[2]*s2[2];
+                        p2[2]       = bq->b2[2]*s[2] + bq->a2[2]*s2[2];
+                        d[2]        = d[10]  + p1[2];
+                        d[10]       = p2[2];
+                    }
+                    if (mask & 0x08)
+                    {
+                        s2[3]       = bq->b0[3]*s[3] + d[3];
+                        p1[3]       = bq->b1[3]*s[3] + bq->a1[3]*s2[3];
+                        p2[3]       = bq->b2[3]*s[3] + bq->a2[3]*s2[3];
+                        d[3]        = d[11]  + p1[3];
+                        d[11]       = p2[3];
+
+                        *(dp++)     = s2[3];
+                    }
+
+                    // Shift buffer
+                    s[3]        = s2[2];
+                    s[2]        = s2[1];
+                    s[1]        = s2[0];
+
+                    // Update mask
+                    mask      <<= 1;
+                } while (mask & 0x0f);
+
+                // Now all data is in the destination buffer
+                sp          = dst;
+                d          += 4;
+            }
+        }
+
+        static constexpr size_t BIQUAD_MC_LANES     = 8;        // Number of channels processed by one filter bank
+        static constexpr size_t BIQUAD_MC_NARROW    = 4;        // Number of channels processed by the narrow kernel
+        static constexpr size_t BIQUAD_MC_WIDE      = 16;       // Number of channels processed by the wide kernel
+        static constexpr size_t BIQUAD_MC_BLOCK     = 0x80;     // Number of frames gathered at once for processing
+
+        void biquad_process_c4(float *dst, const float *src, size_t count, biquad_t *f)
+        {
+            float *d0   = &f->d[0];
+            float *d1   = &f->d[BIQUAD_MC_NARROW];
+
+            for (size_t i=0; i<count; ++i)
+            {
+                for (size_t j=0; j<BIQUAD_MC_NARROW; ++j)
+                {
+                    float s     = src[j];
+                    float s2    = f->x4.b0[j]*s + d0[j];
+                    float p1    = f->x4.b1[j]*s + f->x4.a1[j]*s2;
+                    float p2    = f->x4.b2[j]*s + f->x4.a2[j]*s2;
+
+                    dst[j]      = s2;
+
+                    // Shift buffer
+                    d0[j]       = d1[j] + p1;
+                    d1[j]       = p2;
+                }
+
+                src        += BIQUAD_MC_NARROW;
+                dst        += BIQUAD_MC_NARROW;
+            }
+        }
+
+        void biquad_process_c8(float *dst, const float *src, size_t count, biquad_t *f)
+        {
+            float *d0   = &f->d[0];
+            float *d1   = &f->d[BIQUAD_MC_LANES];
+
+            for (size_t i=0; i<count; ++i)
+            {
+                for (size_t j=0; j<BIQUAD_MC_LANES; ++j)
+                {
+                    float s     = src[j];
+                    float s2    = f->x8.b0[j]*s + d0[j];
+                    float p1    = f->x8.b1[j]*s + f->x8.a1[j]*s2;
+                    float p2    = f->x8.b2[j]*s + f->x8.a2[j]*s2;
+
+                    dst[j]      = s2;
+
+                    // Shift buffer
+                    d0[j]       = d1[j] + p1;
+                    d1[j]       = p2;
+                }
+
+                src        += BIQUAD_MC_LANES;
+                dst        += BIQUAD_MC_LANES;
+            }
+        }
+
+        void biquad_process_c16(float *dst, const float *src, size_t count, biquad_t *f)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                // Each half of the frame is served by its own bank
+                for (size_t k=0; k<2; ++k)
+                {
+                    biquad_t *b = &f[k];
+                    float *d0   = &b->d[0];
+                    float *d1   = &b->d[BIQUAD_MC_LANES];
+
+                    for (size_t j=0; j<BIQUAD_MC_LANES; ++j)
+                    {
+                        float s     = src[j];
+                        float s2    = b->x8.b0[j]*s + d0[j];
+                        float p1    = b->x8.b1[j]*s + b->x8.a1[j]*s2;
+                        float p2    = b->x8.b2[j]*s + b->x8.a2[j]*s2;
+
+                        dst[j]      = s2;
+
+                        // Shift buffer
+                        d0[j]       = d1[j] + p1;
+                        d1[j]       = p2;
+                    }
+
+                    src        += BIQUAD_MC_LANES;
+                    dst        += BIQUAD_MC_LANES;
+                }
+            }
+        }
+
+        void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, biquad_t *f)
+        {
+            float buf[BIQUAD_MC_BLOCK * BIQUAD_MC_LANES] __lsp_aligned64;
+
+            for (size_t off=0; off<count; )
+            {
+                const size_t to_do  = lsp_min(count - off, BIQUAD_MC_BLOCK);
+
+                // Interleave the chunks, four lanes at once
+                for (size_t j=0; j<BIQUAD_MC_LANES; j += BIQUAD_MC_NARROW)
+                {
+                    const float *s  = &src[j * stride + off];
+                    float *p        = &buf[j];
+                    for (size_t i=0; i<to_do; ++i, p += BIQUAD_MC_LANES)
+                    {
+                        p[0]            = s[i];
+                        p[1]            = s[i + stride];
+                        p[2]            = s[i + stride*2];
+                        p[3]            = s[i + stride*3];
+                    }
+                }
+
+                dsp::biquad_process_c8(buf, buf, to_do, f);
+
+                // De-interleave the processed frames
+                for (size_t j=0; j<BIQUAD_MC_LANES; j += BIQUAD_MC_NARROW)
+                {
+                    float *d        = &dst[j * stride + off];
+                    const float *p  = &buf[j];
+                    for (size_t i=0; i<to_do; ++i, p += BIQUAD_MC_LANES)
+                    {
+                        d[i]            = p[0];
+                        d[i + stride]   = p[1];
+                        d[i + stride*2] = p[2];
+                        d[i + stride*3] = p[3];
+                    }
+                }
+
+                off        += to_do;
+            }
+        }
+
+        typedef void (* biquad_process_cn_t)(float *dst, const float *src, size_t count, biquad_t *f);
+
+        /**
+         * Select the kernel for the group of channels starting with the bank f,
+         * the narrow kernel works with the x4 copy of the first half of the bank
+         * which should be written back by biquad_mc_release() after processing.
+         *
+         * @param func pointer to store the kernel
+         * @param f pointer to the bank, replaced with the pointer to the narrow copy if needed
+         * @param narrow storage for the narrow copy of the bank
+         * @param channels number of remaining channels
+         * @return number of lanes of the kernel
+         */
+        static size_t biquad_mc_select(biquad_process_cn_t *func, biquad_t **f, biquad_t *narrow, size_t channels)
+        {
+            if (channels > BIQUAD_MC_LANES)
+            {
+                *func           = dsp::biquad_process_c16;
+                return BIQUAD_MC_WIDE;
+            }
+            if (channels > BIQUAD_MC_NARROW)
+            {
+                *func           = dsp::biquad_process_c8;
+                return BIQUAD_MC_LANES;
+            }
+
+            const biquad_t *b   = *f;
+            for (size_t j=0; j<BIQUAD_MC_NARROW; ++j)
+            {
+                narrow->x4.b0[j]    = b->x8.b0[j];
+                narrow->x4.b1[j]    = b->x8.b1[j];
+                narrow->x4.b2[j]    = b->x8.b2[j];
+                narrow->x4.a1[j]    = b->x8.a1[j];
+                narrow->x4.a2[j]    = b->x8.a2[j];
+                narrow->d[j]        = b->d[j];
+                narrow->d[j + BIQUAD_MC_NARROW] = b->d[j + BIQUAD_MC_LANES];
+            }
+
+            *func           = dsp::biquad_process_c4;
+            *f              = narrow;
+            return BIQUAD_MC_NARROW;
+        }
+
+        static void biquad_mc_release(biquad_t *f, const biquad_t *narrow)
+        {
+            for (size_t j=0; j<BIQUAD_MC_NARROW; ++j)
+            {
+                f->d[j]                     = narrow->d[j];
+                f->d[j + BIQUAD_MC_LANES]   = narrow->d[j + BIQUAD_MC_NARROW];
+            }
+        }
+
+        void biquad_process_imc(float *dst, const float *src, size_t channels, size_t count, biquad_t *f)
+        {
+            float buf[BIQUAD_MC_BLOCK * BIQUAD_MC_WIDE] __lsp_aligned64;
+            biquad_t narrow __lsp_aligned64;
+            biquad_process_cn_t func;
+
+            for (size_t ch=0; ch<channels; )
+            {
+                biquad_t *bank      = f;
+                const size_t width  = biquad_mc_select(&func, &bank, &narrow, channels - ch);
+                const size_t lanes  = lsp_min(channels - ch, width);
+
+                if (width == channels)
+                {
+                    // The frame matches the kernel, no need to gather the channels
+                    func(dst, src, count, bank);
+                }
+                else
+                {
+                    const float *sp     = &src[ch];
+                    float *dp           = &dst[ch];
+
+                    for (size_t off=0; off<count; )
+                    {
+                        const size_t to_do  = lsp_min(count - off, BIQUAD_MC_BLOCK);
+
+                        // Gather the channels of the group into the frames, unused lanes are fed with zeros
+                        for (size_t i=0; i<to_do; ++i, sp += channels)
+                        {
+                            float *p    = &buf[i * width];
+                            size_t j    = 0;
+                            for ( ; j<lanes; ++j)
+                                p[j]        = sp[j];
+                            for ( ; j<width; ++j)
+                                p[j]        = 0.0f;
+                        }
+
+                        func(buf, buf, to_do, bank);
+
+                        // Scatter the processed frames back
+                        for (size_t i=0; i<to_do; ++i, dp += channels)
+                        {
+                            const float *p  = &buf[i * width];
+                            for (size_t j=0; j<lanes; ++j)
+                                dp[j]       = p[j];
+                        }
+
+                        off        += to_do;
+                    }
+                }
+
+                if (bank == &narrow)
+                    biquad_mc_release(f, &narrow);
+
+                ch         += lanes;
+                f          += (width + BIQUAD_MC_LANES - 1) / BIQUAD_MC_LANES;
+            }
+        }
+
+        void biquad_process_mc(float * const *dst, const float * const *src, size_t channels, size_t count, biquad_t *f)
+        {
+            float buf[BIQUAD_MC_BLOCK * BIQUAD_MC_WIDE] __lsp_aligned64;
+            biquad_t narrow __lsp_aligned64;
+            biquad_process_cn_t func;
+
+            for (size_t ch=0; ch<channels; )
+            {
+                biquad_t *bank      = f;
+                const size_t width  = biquad_mc_select(&func, &bank, &narrow, channels - ch);
+                const size_t lanes  = lsp_min(channels - ch, width);
+
+                for (size_t off=0; off<count; )
+                {
+                    const size_t to_do  = lsp_min(count - off, BIQUAD_MC_BLOCK);
+
+                    if (lanes == width)
+                    {
+                        // Interleave the channels of the full group frame by frame, four lanes at once
+                        for (size_t j=0; j<width; j += BIQUAD_MC_NARROW)
+                        {
+                            const float *s0 = &src[ch + j][off];
+                            const float *s1 = &src[ch + j + 1][off];
+                            const float *s2 = &src[ch + j + 2][off];
+                            const float *s3 = &src[ch + j + 3][off];
+                            float *p        = &buf[j];
+                            for (size_t i=0; i<to_do; ++i, p += width)
+                            {
+                                p[0]            = s0[i];
+                                p[1]            = s1[i];
+                                p[2]            = s2[i];
+                                p[3]            = s3[i];
+                            }
+                        }
+
+                        func(buf, buf, to_do, bank);
+
+                        // De-interleave the processed frames
+                        for (size_t j=0; j<width; j += BIQUAD_MC_NARROW)
+                        {
+                            float *d0       = &dst[ch + j][off];
+                            float *d1       = &dst[ch + j + 1][off];
+                            float *d2       = &dst[ch + j + 2][off];
+                            float *d3       = &dst[ch + j + 3][off];
+                            const float *p  = &buf[j];
+                            for (size_t i=0; i<to_do; ++i, p += width)
+                            {
+                                d0[i]           = p[0];
+                                d1[i]           = p[1];
+                                d2[i]           = p[2];
+                                d3[i]           = p[3];
+                            }
+                        }
+
+                        off        += to_do;
+                        continue;
+                    }
+
+                    // Interleave the channels of the group, unused lanes are fed with zeros
+                    size_t j    = 0;
+                    for ( ; j<lanes; ++j)
+                    {
+                        const float *sp = &src[ch + j][off];
+                        float *p        = &buf[j];
+                        for (size_t i=0; i<to_do; ++i, p += width)
+                            *p              = sp[i];
+                    }
+                    for ( ; j<width; ++j)
+                    {
+                        float *p        = &buf[j];
+                        for (size_t i=0; i<to_do; ++i, p += width)
+                            *p              = 0.0f;
+                    }
+
+                    func(buf, buf, to_do, bank);
+
+                    // De-interleave the processed frames
+                    for (j=0; j<lanes; ++j)
+                    {
+                        float *dp       = &dst[ch + j][off];
+                        const float *p  = &buf[j];
+                        for (size_t i=0; i<to_do; ++i, p += width)
+                            dp[i]           = *p;
+                    }
+
+                    off        += to_do;
+                }
+
+                if (bank == &narrow)
+                    biquad_mc_release(f, &narrow);
+
+                ch         += lanes;
+                f          += (width + BIQUAD_MC_LANES - 1) / BIQUAD_MC_LANES;
+            }
+        }
+
+        static constexpr size_t BIQUAD_BP_CHUNK     = 0x400;    // Maximum size of the chunk processed by one lane
+        static constexpr size_t BIQUAD_BP_MIN       = 0x40;     // Minimum size of the chunk, shorter tails are processed serially
+        static constexpr float  BIQUAD_BP_EPS       = 1e-30f;   // Threshold of the decayed zero-input response
+
+        void biquad_process_x1_bp(float *dst, const float *src, size_t count, biquad_t *f)
+        {
+            if (count < BIQUAD_BP_MIN * BIQUAD_MC_LANES)
+            {
+                dsp::biquad_process_x1(dst, src, count, f);
+                return;
+            }
+
+            const float a1      = f->x1.a1;
+            const float a2      = f->x1.a2;
+
+            // Zero-input response of the filter: g[0] = 0, g[1] = 1, g[k+1] = a1*g[k] + a2*g[k-1].
+            // The output of the filter with the initial state (d0, d1) and zero input
+            // is y[n] = d0*g[n+1] + d1*g[n], the filter memory after L samples is:
+            //   d0' = d0*g[L+1] + d1*g[L]
+            //   d1' = a2*(d0*g[L] + d1*g[L-1])
+            float g[BIQUAD_BP_CHUNK + 2] __lsp_aligned16;
+            const size_t items  = lsp_min(count / BIQUAD_MC_LANES, BIQUAD_BP_CHUNK) + 2;
+            size_t span         = items - 1;
+            g[0]                = 0.0f;
+            g[1]                = 1.0f;
+            for (size_t i=2; i<items; ++i)
+            {
+                g[i]                = a1*g[i-1] + a2*g[i-2];
+                if ((fabsf(g[i]) + fabsf(g[i-1])) < BIQUAD_BP_EPS)
+                {
+                    // The response has decayed, flush it to zero to avoid denormals and
+                    // do not apply it further
+                    span                = i - 1;
+                    for ( ; i<items; ++i)
+                        g[i]                = 0.0f;
+                    break;
+                }
+            }
+
+            // Each lane of the bank processes its own chunk of the buffer
+            biquad_t bank __lsp_aligned64;
+            for (size_t j=0; j<BIQUAD_MC_LANES; ++j)
+            {
+                bank.x8.b0[j]   = f->x1.b0;
+                bank.x8.b1[j]   = f->x1.b1;
+                bank.x8.b2[j]   = f->x1.b2;
+                bank.x8.a1[j]   = a1;
+                bank.x8.a2[j]   = a2;
+            }
+
+            while (count >= BIQUAD_BP_MIN * BIQUAD_MC_LANES)
+            {
+                const size_t len    = lsp_min(count / BIQUAD_MC_LANES, BIQUAD_BP_CHUNK);
+                const size_t fix    = lsp_min(len, span);
+
+                // Compute zero-state responses of all chunks except the first one
+                // which starts with the actual state of the filter
+                for (size_t j=0; j<BIQUAD_MC_LANES; ++j)
+                {
+                    bank.d[j]       = 0.0f;
+                    bank.d[j + BIQUAD_MC_LANES] = 0.0f;
+                }
+                bank.d[0]       = f->d[0];
+                bank.d[BIQUAD_MC_LANES] = f->d[1];
+
+                dsp::biquad_process_s8(dst, src, len, len, &bank);
+
+                // Propagate the actual state of the filter through the chunks
+                float d0        = bank.d[0];
+                float d1        = bank.d[BIQUAD_MC_LANES];
+                for (size_t j=1; j<BIQUAD_MC_LANES; ++j)
+                {
+                    dsp::mix_add2(&dst[j * len], &g[1], &g[0], d0, d1, fix);
+
+                    float t0        = d0*g[len+1] + d1*g[len];
+                    float t1        = a2*(d0*g[len] + d1*g[len-1]);
+                    d0              = t0 + bank.d[j];
+                    d1              = t1 + bank.d[j + BIQUAD_MC_LANES];
+                }
+
+                f->d[0]         = d0;
+                f->d[1]         = d1;
+
+                const size_t done   = len * BIQUAD_MC_LANES;
+                src            += done;
+                dst            += done;
+                count          -= done;
+            }
+
+            dsp::biquad_process_x1(dst, src, count, f);
+        }
+
     }
 }
 
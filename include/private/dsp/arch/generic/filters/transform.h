@@ -296,6 +296,40 @@ namespace lsp
             }
         }
 
+        void bilinear_transform_x16(biquad_x16_t *bf, const f_cascade_t *bc, float kf, size_t count)
+        {
+            float T[3], B[3], N;
+            float kf2       = kf * kf;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                for (size_t j=0; j<16; ++j)
+                {
+                    // Calculate top and bottom coefficients
+                    T[0]            = bc->t[0];
+                    T[1]            = bc->t[1]*kf;
+                    T[2]            = bc->t[2]*kf2;
+                    B[0]            = bc->b[0];
+                    B[1]            = bc->b[1]*kf;
+                    B[2]            = bc->b[2]*kf2;
+
+                    // Calculate the convolution
+                    N               = 1.0 / (B[0] + B[1] + B[2]);
+
+                    // Initialize filter parameters
+                    bf->b0[j]       = (T[0] + T[1] + T[2]) * N;
+                    bf->b1[j]       = 2.0 * (T[0] - T[2]) * N;
+                    bf->b2[j]       = (T[0] - T[1] + T[2]) * N;
+                    bf->a1[j]       = 2.0 * (B[2] - B[0]) * N;  // Sign negated
+                    bf->a2[j]       = (B[1] - B[2] - B[0]) * N; // Sign negated
+
+                    ++bc;
+                }
+
+                ++bf;
+            }
+        }
+
         static void matched_solve(float *p, float kf, float td, size_t count, size_t stride)
         {
             if (p[2] == 0.0) // Test polynom for second-order
@@ -770,6 +804,273 @@ namespace lsp
                 bc          += 8;
             } // for i
         }
+
+        void bilinear_transform_x1_f64(biquad_f64_x1_t *bf, const f64_cascade_t *bc, double kf, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            double T[4], B[4], N;
+            double kf2      = kf * kf;
+
+            while (count--)
+            {
+                // Calculate top coefficients
+                T[0]            = bc->t[0];
+                T[1]            = bc->t[1]*kf;
+                T[2]            = bc->t[2]*kf2;
+
+                // Calculate bottom coefficients
+                B[0]            = bc->b[0];
+                B[1]            = bc->b[1]*kf;
+                B[2]            = bc->b[2]*kf2;
+
+                // Calculate the convolution
+                N               = 1.0 / (B[0] + B[1] + B[2]);
+
+                // Initialize filter parameters
+                bf->b0          = (T[0] + T[1] + T[2]) * N;
+                bf->b1          = 2.0 * (T[0] - T[2]) * N;
+                bf->b2          = (T[0] - T[1] + T[2]) * N;
+                bf->a1          = 2.0 * (B[2] - B[0]) * N;  // Sign negated
+                bf->a2          = (B[1] - B[2] - B[0]) * N; // Sign negated
+                bf->p0          = 0.0;
+                bf->p1          = 0.0;
+                bf->p2          = 0.0;
+
+                // Increment pointers
+                bc              ++;
+                bf              ++;
+            }
+        }
+
+        void bilinear_transform_x2_f64(biquad_f64_x2_t *bf, const f64_cascade_t *bc, double kf, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            double T[8], B[8], N[2];
+            double kf2      = kf * kf;
+
+            while (count--)
+            {
+                // Calculate top coefficients
+                T[0]            = bc[0].t[0];
+                T[4]            = bc[1].t[0];
+
+                T[1]            = bc[0].t[1]*kf;
+                T[5]            = bc[1].t[1]*kf;
+
+                T[2]            = bc[0].t[2]*kf2;
+                T[6]            = bc[1].t[2]*kf2;
+
+                // Calculate bottom coefficients
+                B[0]            = bc[0].b[0];
+                B[4]            = bc[1].b[0];
+
+                B[1]            = bc[0].b[1]*kf;
+                B[5]            = bc[1].b[1]*kf;
+
+                B[2]            = bc[0].b[2]*kf2;
+                B[6]            = bc[1].b[2]*kf2;
+
+                // Calculate the convolution
+                N[0]            = 1.0 / (B[0] + B[1] + B[2]);
+                N[1]            = 1.0 / (B[4] + B[5] + B[6]);
+
+                // Initialize filter top coefficients
+                bf->b0[0]        = (T[0] + T[1] + T[2]) * N[0];
+                bf->b0[1]        = (T[4] + T[5] + T[6]) * N[1];
+                bf->b1[0]        = 2.0 * (T[0] - T[2]) * N[0];
+                bf->b1[1]        = 2.0 * (T[4] - T[6]) * N[1];
+                bf->b2[0]        = (T[0] - T[1] + T[2]) * N[0];
+                bf->b2[1]        = (T[4] - T[5] + T[6]) * N[1];
+
+                // Initialize filter bottom coefficients
+                bf->a1[0]        = 2.0 * (B[2] - B[0]) * N[0];  // Sign negated
+                bf->a1[1]        = 2.0 * (B[6] - B[4]) * N[1];  // Sign negated
+                bf->a2[0]        = (B[1] - B[2] - B[0]) * N[0]; // Sign negated
+                bf->a2[1]        = (B[5] - B[6] - B[4]) * N[1]; // Sign negated
+
+                bf->p[0]        = 0.0;
+                bf->p[1]        = 0.0;
+
+                // Increment pointers
+                bc             += 2;
+                bf              ++;
+            }
+        }
+
+        void bilinear_transform_x4_f64(biquad_f64_x4_t *bf, const f64_cascade_t *bc, double kf, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            double T0[4], T1[4], T2[4];
+            double B0[4], B1[4], B2[4], N[4];
+            double kf2      = kf * kf;
+
+            while (count--)
+            {
+                // Calculate top coefficients
+                T0[0]           = bc[0].t[0];
+                T0[1]           = bc[1].t[0];
+                T0[2]           = bc[2].t[0];
+                T0[3]           = bc[3].t[0];
+
+                T1[0]           = bc[0].t[1]*kf;
+                T1[1]           = bc[1].t[1]*kf;
+                T1[2]           = bc[2].t[1]*kf;
+                T1[3]           = bc[3].t[1]*kf;
+
+                T2[0]           = bc[0].t[2]*kf2;
+                T2[1]           = bc[1].t[2]*kf2;
+                T2[2]           = bc[2].t[2]*kf2;
+                T2[3]           = bc[3].t[2]*kf2;
+
+                // Calculate bottom coefficients
+                B0[0]           = bc[0].b[0];
+                B0[1]           = bc[1].b[0];
+                B0[2]           = bc[2].b[0];
+                B0[3]           = bc[3].b[0];
+
+                B1[0]           = bc[0].b[1]*kf;
+                B1[1]           = bc[1].b[1]*kf;
+                B1[2]           = bc[2].b[1]*kf;
+                B1[3]           = bc[3].b[1]*kf;
+
+                B2[0]           = bc[0].b[2]*kf2;
+                B2[1]           = bc[1].b[2]*kf2;
+                B2[2]           = bc[2].b[2]*kf2;
+                B2[3]           = bc[3].b[2]*kf2;
+
+                // Calculate the convolution
+                N[0]            = 1.0 / (B0[0] + B1[0] + B2[0]);
+                N[1]            = 1.0 / (B0[1] + B1[1] + B2[1]);
+                N[2]            = 1.0 / (B0[2] + B1[2] + B2[2]);
+                N[3]            = 1.0 / (B0[3] + B1[3] + B2[3]);
+
+                // Initialize filter parameters
+                bf->b0[0]       = (T0[0] + T1[0] + T2[0]) * N[0];
+                bf->b0[1]       = (T0[1] + T1[1] + T2[1]) * N[1];
+                bf->b0[2]       = (T0[2] + T1[2] + T2[2]) * N[2];
+                bf->b0[3]       = (T0[3] + T1[3] + T2[3]) * N[3];
+
+                bf->b1[0]       = 2.0 * (T0[0] - T2[0]) * N[0];
+                bf->b1[1]       = 2.0 * (T0[1] - T2[1]) * N[1];
+                bf->b1[2]       = 2.0 * (T0[2] - T2[2]) * N[2];
+                bf->b1[3]       = 2.0 * (T0[3] - T2[3]) * N[3];
+
+                bf->b2[0]       = (T0[0] - T1[0] + T2[0]) * N[0];
+                bf->b2[1]       = (T0[1] - T1[1] + T2[1]) * N[1];
+                bf->b2[2]       = (T0[2] - T1[2] + T2[2]) * N[2];
+                bf->b2[3]       = (T0[3] - T1[3] + T2[3]) * N[3];
+
+                bf->a1[0]       = 2.0 * (B2[0] - B0[0]) * N[0];     // Sign negated
+                bf->a1[1]       = 2.0 * (B2[1] - B0[1]) * N[1];     // Sign negated
+                bf->a1[2]       = 2.0 * (B2[2] - B0[2]) * N[2];     // Sign negated
+                bf->a1[3]       = 2.0 * (B2[3] - B0[3]) * N[3];     // Sign negated
+
+                bf->a2[0]       = (B1[0] - B2[0] - B0[0]) * N[0];   // Sign negated
+                bf->a2[1]       = (B1[1] - B2[1] - B0[1]) * N[1];   // Sign negated
+                bf->a2[2]       = (B1[2] - B2[2] - B0[2]) * N[2];   // Sign negated
+                bf->a2[3]       = (B1[3] - B2[3] - B0[3]) * N[3];   // Sign negated
+
+                // Increment pointers
+                bc             += 4;
+                bf              ++;
+            }
+        }
+
+        void bilinear_transform_x8_f64(biquad_f64_x8_t *bf, const f64_cascade_t *bc, double kf, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            double T0[4], T1[4], T2[4];
+            double B0[4], B1[4], B2[4], N[4];
+            double kf2      = kf * kf;
+
+            // Calculate as two passes of x4 filters
+            for (size_t n=0; n<=4; n+=4)
+            {
+                // two x4 filters are in parallel, shift by 4 floats stride
+                biquad_f64_x8_t *bq         = reinterpret_cast<biquad_f64_x8_t *>(&bf->b0[n]);
+                const f64_cascade_t *fc   = &bc[n];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    // Calculate top coefficients
+                    T0[0]           = fc[0].t[0];
+                    T0[1]           = fc[1].t[0];
+                    T0[2]           = fc[2].t[0];
+                    T0[3]           = fc[3].t[0];
+
+                    T1[0]           = fc[0].t[1]*kf;
+                    T1[1]           = fc[1].t[1]*kf;
+                    T1[2]           = fc[2].t[1]*kf;
+                    T1[3]           = fc[3].t[1]*kf;
+
+                    T2[0]           = fc[0].t[2]*kf2;
+                    T2[1]           = fc[1].t[2]*kf2;
+                    T2[2]           = fc[2].t[2]*kf2;
+                    T2[3]           = fc[3].t[2]*kf2;
+
+                    // Calculate bottom coefficients
+                    B0[0]           = fc[0].b[0];
+                    B0[1]           = fc[1].b[0];
+                    B0[2]           = fc[2].b[0];
+                    B0[3]           = fc[3].b[0];
+
+                    B1[0]           = fc[0].b[1]*kf;
+                    B1[1]           = fc[1].b[1]*kf;
+                    B1[2]           = fc[2].b[1]*kf;
+                    B1[3]           = fc[3].b[1]*kf;
+
+                    B2[0]           = fc[0].b[2]*kf2;
+                    B2[1]           = fc[1].b[2]*kf2;
+                    B2[2]           = fc[2].b[2]*kf2;
+                    B2[3]           = fc[3].b[2]*kf2;
+
+                    // Calculate the convolution
+                    N[0]            = 1.0 / (B0[0] + B1[0] + B2[0]);
+                    N[1]            = 1.0 / (B0[1] + B1[1] + B2[1]);
+                    N[2]            = 1.0 / (B0[2] + B1[2] + B2[2]);
+                    N[3]            = 1.0 / (B0[3] + B1[3] + B2[3]);
+
+                    // Initialize filter parameters
+                    bq->b0[0]       = (T0[0] + T1[0] + T2[0]) * N[0];
+                    bq->b0[1]       = (T0[1] + T1[1] + T2[1]) * N[1];
+                    bq->b0[2]       = (T0[2] + T1[2] + T2[2]) * N[2];
+                    bq->b0[3]       = (T0[3] + T1[3] + T2[3]) * N[3];
+
+                    bq->b1[0]       = 2.0 * (T0[0] - T2[0]) * N[0];
+                    bq->b1[1]       = 2.0 * (T0[1] - T2[1]) * N[1];
+                    bq->b1[2]       = 2.0 * (T0[2] - T2[2]) * N[2];
+                    bq->b1[3]       = 2.0 * (T0[3] - T2[3]) * N[3];
+
+                    bq->b2[0]       = (T0[0] - T1[0] + T2[0]) * N[0];
+                    bq->b2[1]       = (T0[1] - T1[1] + T2[1]) * N[1];
+                    bq->b2[2]       = (T0[2] - T1[2] + T2[2]) * N[2];
+                    bq->b2[3]       = (T0[3] - T1[3] + T2[3]) * N[3];
+
+                    bq->a1[0]       = 2.0 * (B2[0] - B0[0]) * N[0];     // Sign negated
+                    bq->a1[1]       = 2.0 * (B2[1] - B0[1]) * N[1];     // Sign negated
+                    bq->a1[2]       = 2.0 * (B2[2] - B0[2]) * N[2];     // Sign negated
+                    bq->a1[3]       = 2.0 * (B2[3] - B0[3]) * N[3];     // Sign negated
+
+                    bq->a2[0]       = (B1[0] - B2[0] - B0[0]) * N[0];   // Sign negated
+                    bq->a2[1]       = (B1[1] - B2[1] - B0[1]) * N[1];   // Sign negated
+                    bq->a2[2]       = (B1[2] - B2[2] - B0[2]) * N[2];   // Sign negated
+                    bq->a2[3]       = (B1[3] - B2[3] - B0[3]) * N[3];   // Sign negated
+
+                    // Increment pointers
+                    fc             += 8;
+                    bq              ++;
+                }
+            }
+        }
+
     }
 }
 
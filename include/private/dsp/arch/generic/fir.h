@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_FIR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_FIR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The accumulator holds the pending tail of the convolution at the current position,
+         * all other samples of the accumulator are kept zero. The tail is moved to the beginning
+         * of the accumulator only when there is no more space after it, so the move happens
+         * once per many processed blocks instead of shifting the history on each call.
+         */
+        struct fir_t
+        {
+            size_t      taps;           // Number of taps in the kernel
+            size_t      rank;           // Fast convolution rank, 0 if only direct convolution is used
+            size_t      block;          // Maximum number of samples processed at once
+            size_t      tail;           // Length of the pending tail of convolution
+            size_t      size;           // Size of the accumulator
+            size_t      pos;            // Position of the pending tail in the accumulator
+            uint8_t    *data;           // Allocated data
+            float      *kernel;         // Kernel of the filter
+            float      *spec;           // Fast convolution data of the kernel
+            float      *tmp;            // Temporary buffer for the fast convolution
+            float      *acc;            // Output accumulator
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t FIR_ALIGN           = 0x40;
+        static constexpr size_t FIR_BLOCK           = 0x400;    // Maximum block for the direct convolution
+        static constexpr size_t FIR_FFT_TAPS        = 128;      // Minimum number of taps to use the fast convolution
+        static constexpr size_t FIR_RANK_MIN        = 5;
+        static constexpr size_t FIR_RANK_MAX        = 16;
+
+        void fir_reset(dsp::fir_t *fir)
+        {
+            fir->pos        = 0;
+            dsp::fill_zero(fir->acc, fir->size);
+        }
+
+        dsp::fir_t *fir_create(const float *kernel, size_t taps)
+        {
+            if ((kernel == NULL) || (taps <= 0))
+                return NULL;
+
+            // Select the fast convolution rank: the kernel should fit into 2^(rank-1) samples
+            size_t rank         = 0;
+            if (taps >= FIR_FFT_TAPS)
+            {
+                rank                = FIR_RANK_MIN;
+                while ((size_t(1) << (rank - 1)) < taps)
+                    ++rank;
+                if (rank > FIR_RANK_MAX)
+                    rank                = 0;
+            }
+
+            // Compute the size of buffers, each buffer is aligned to the size of the cache line
+            const size_t half   = (rank > 0) ? size_t(1) << (rank - 1) : 0;
+            const size_t klen   = (taps + 0x0f) & ~size_t(0x0f);
+            const size_t block  = lsp_max(FIR_BLOCK, half);
+            const size_t tail   = lsp_max(taps - 1, half);
+            const size_t size   = ((block + tail) * 2 + 0x0f) & ~size_t(0x0f);
+            size_t to_alloc     = klen + half * 8 + size;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::fir_t) + FIR_ALIGN - 1) & ~(FIR_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + FIR_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + FIR_ALIGN - 1) & ~uintptr_t(FIR_ALIGN - 1));
+            dsp::fir_t *fir     = reinterpret_cast<dsp::fir_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            fir->taps           = taps;
+            fir->rank           = rank;
+            fir->block          = block;
+            fir->tail           = tail;
+            fir->size           = size;
+            fir->data           = data;
+            fir->kernel         = fptr;
+            fir->spec           = &fptr[klen];
+            fir->tmp            = &fir->spec[half * 4];
+            fir->acc            = &fir->tmp[half * 4];
+
+            dsp::copy(fir->kernel, kernel, taps);
+            if (rank > 0)
+            {
+                // The accumulator is used as a temporary buffer for the kernel padded with zeros
+                dsp::copy(fir->acc, kernel, taps);
+                dsp::fill_zero(&fir->acc[taps], half - taps);
+                dsp::fastconv_parse(fir->spec, fir->acc, rank);
+            }
+
+            fir_reset(fir);
+
+            return fir;
+        }
+
+        void fir_destroy(dsp::fir_t *fir)
+        {
+            if (fir != NULL)
+                free(fir->data);
+        }
+
+        void fir_process(dsp::fir_t *fir, float *dst, const float *src, size_t count)
+        {
+            const size_t half   = (fir->rank > 0) ? size_t(1) << (fir->rank - 1) : 0;
+            const size_t tail   = fir->tail;
+
+            while (count > 0)
+            {
+                // Use the fast convolution for full blocks, the direct convolution for the rest
+                const bool fast     = (half > 0) && (count >= half);
+                const size_t to_do  = (fast) ? half : lsp_min(count, fir->block);
+
+                // Move the pending tail to the beginning of the accumulator if there is no space after it,
+                // the tail does not overlap with its new location because the accumulator is large enough
+                if ((fir->pos + to_do + tail) > fir->size)
+                {
+                    float *last         = &fir->acc[fir->pos];
+                    dsp::copy(fir->acc, last, tail);
+                    dsp::fill_zero(last, tail);
+                    fir->pos            = 0;
+                }
+
+                // Source should be read before the destination is written, so in-place processing is possible
+                float *acc          = &fir->acc[fir->pos];
+                if (fast)
+                    dsp::fastconv_parse_apply(acc, fir->tmp, fir->spec, src, fir->rank);
+                else
+                    dsp::convolve(acc, src, fir->kernel, fir->taps, to_do);
+
+                dsp::copy(dst, acc, to_do);
+                dsp::fill_zero(acc, to_do);
+
+                fir->pos           += to_do;
+                dst                += to_do;
+                src                += to_do;
+                count              -= to_do;
+            }
+        }
+
+        void fir_design_linear(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp)
+        {
+            const size_t n      = size_t(1) << rank;
+            const size_t half   = n >> 1;
+            const size_t shift  = (taps - 1) >> 1;
+            float *a_re         = tmp;
+            float *a_im         = &a_re[n];
+            float *b_re         = &a_im[n];
+            float *b_im         = &b_re[n];
+
+            // Build the conjugate-symmetric spectrum. For even number of taps
+            // the center of the kernel lies between samples, so the spectrum is
+            // additionally delayed by the half of the sample
+            if (taps & 1)
+            {
+                dsp::copy(a_re, mag, half + 1);
+                dsp::fill_zero(a_im, n);
+            }
+            else
+            {
+                dsp::cosf_kp1(a_re, -M_PI / n, 0.0f, half + 1);
+                dsp::sinf_kp1(a_im, -M_PI / n, 0.0f, half + 1);
+                dsp::mul2(a_re, mag, half + 1);
+                dsp::mul2(a_im, mag, half + 1);
+                dsp::reverse2(&a_im[half + 1], &a_im[1], half - 1);
+                dsp::mul_k2(&a_im[half + 1], -1.0f, half - 1);
+            }
+            dsp::reverse2(&a_re[half + 1], &a_re[1], half - 1);
+
+            // Compute the zero-phase impulse response and make it causal
+            dsp::reverse_fft(b_re, b_im, a_re, a_im, rank);
+            dsp::copy(dst, &b_re[n - shift], shift);
+            dsp::copy(&dst[shift], b_re, taps - shift);
+            if (window != NULL)
+                dsp::mul2(dst, window, taps);
+        }
+
+        static void fir_minimum_phase_internal(float *dst, const float *window, size_t taps, size_t rank, float *tmp)
+        {
+            const size_t n      = size_t(1) << rank;
+            const size_t half   = n >> 1;
+            float *a_re         = tmp;
+            float *a_im         = &a_re[n];
+            float *b_re         = &a_im[n];
+            float *b_im         = &b_re[n];
+
+            // Compute the real cepstrum from the logarithm of magnitude stored in a_re
+            dsp::fill_zero(a_im, n);
+            dsp::reverse_fft(b_re, b_im, a_re, a_im, rank);
+
+            // Fold the cepstrum to make it causal
+            dsp::mul_k2(&b_re[1], 2.0f, half - 1);
+            dsp::fill_zero(&b_re[half + 1], half - 1);
+            dsp::fill_zero(b_im, n);
+
+            // Compute the spectrum of minimum-phase filter: exp(re + j*im)
+            dsp::direct_fft(a_re, a_im, b_re, b_im, rank);
+            dsp::exp1(a_re, n);
+            dsp::cosf2(b_re, a_im, n);
+            dsp::sinf2(b_im, a_im, n);
+            dsp::mul2(b_re, a_re, n);
+            dsp::mul2(b_im, a_re, n);
+
+            // Restore the impulse response
+            dsp::reverse_fft(a_re, a_im, b_re, b_im, rank);
+            dsp::copy(dst, a_re, taps);
+            if (window != NULL)
+                dsp::mul2(dst, window, taps);
+        }
+
+        void fir_design_minimum(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp)
+        {
+            const size_t half   = size_t(1) << (rank - 1);
+
+            // Compute the logarithm of magnitude response
+            dsp::limit2(tmp, mag, LSP_DSP_AMPLIFICATION_THRESH, 1e+10f, half + 1);
+            dsp::loge1(tmp, half + 1);
+            dsp::reverse2(&tmp[half + 1], &tmp[1], half - 1);
+
+            fir_minimum_phase_internal(dst, window, taps, rank, tmp);
+        }
+
+        void fir_minimum_phase(float *dst, const float *src, size_t count, size_t taps, size_t rank, float *tmp)
+        {
+            const size_t n      = size_t(1) << rank;
+            float *a_re         = tmp;
+            float *a_im         = &a_re[n];
+            float *b_re         = &a_im[n];
+            float *b_im         = &b_re[n];
+
+            // Compute the logarithm of magnitude response of the source impulse response
+            dsp::copy(a_re, src, count);
+            dsp::fill_zero(&a_re[count], n - count);
+            dsp::fill_zero(a_im, n);
+            dsp::direct_fft(b_re, b_im, a_re, a_im, rank);
+            dsp::complex_mod(a_re, b_re, b_im, n);
+            dsp::limit1(a_re, LSP_DSP_AMPLIFICATION_THRESH, 1e+10f, n);
+            dsp::loge1(a_re, n);
+
+            fir_minimum_phase_internal(dst, NULL, taps, rank, tmp);
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_FIR_H_ */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_HCONVOLVER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_HCONVOLVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The partitioned convolver processes the impulse response starting at the sample
+         * 'block' with the samples before 'head' replaced by zeros, so its output delayed
+         * by the block latency joins the output of the head without a gap.
+         */
+        struct hconvolver_t
+        {
+            fir_t              *head;           // Time-domain head of the impulse response
+            convolver_t        *tail;           // Frequency-domain tail of the impulse response, may be NULL
+            uint8_t            *data;           // Allocated data
+            float              *buf;            // Buffer for the output of the tail
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t HCONVOLVER_ALIGN    = 0x40;
+        static constexpr size_t HCONVOLVER_BLOCK    = 0x400;
+
+        void hconvolver_destroy(dsp::hconvolver_t *cv)
+        {
+            if (cv == NULL)
+                return;
+
+            fir_destroy(cv->head);
+            convolver_destroy(cv->tail);
+            free(cv->data);
+        }
+
+        dsp::hconvolver_t *hconvolver_create(const float *ir, size_t length, size_t head, size_t max_rank)
+        {
+            if ((ir == NULL) || (length <= 0))
+                return NULL;
+            if ((head < LSP_DSP_HCONVOLVER_HEAD_MIN) || (head > LSP_DSP_HCONVOLVER_HEAD_MAX))
+                return NULL;
+
+            // The block of the partitioned convolver should not exceed the head length
+            size_t rank         = LSP_DSP_CONVOLVER_RANK_MIN;
+            while ((size_t(1) << rank) <= head)
+                ++rank;
+            if ((max_rank < rank) || (max_rank > LSP_DSP_CONVOLVER_RANK_MAX))
+                return NULL;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::hconvolver_t) + HCONVOLVER_ALIGN - 1) & ~(HCONVOLVER_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + HCONVOLVER_BLOCK * sizeof(float) + HCONVOLVER_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + HCONVOLVER_ALIGN - 1) & ~uintptr_t(HCONVOLVER_ALIGN - 1));
+            dsp::hconvolver_t *cv = reinterpret_cast<dsp::hconvolver_t *>(ptr);
+
+            cv->head            = NULL;
+            cv->tail            = NULL;
+            cv->data            = data;
+            cv->buf             = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            // Create the head of the impulse response
+            cv->head            = fir_create(ir, lsp_min(length, head));
+            if (cv->head == NULL)
+            {
+                hconvolver_destroy(cv);
+                return NULL;
+            }
+
+            // Create the tail of the impulse response
+            if (length > head)
+            {
+                size_t block        = size_t(1) << (rank - 1);
+                size_t count        = length - block;
+                float *tail         = static_cast<float *>(malloc(count * sizeof(float)));
+                if (tail == NULL)
+                {
+                    hconvolver_destroy(cv);
+                    return NULL;
+                }
+
+                dsp::fill_zero(tail, head - block);
+                dsp::copy(&tail[head - block], &ir[head], length - head);
+                cv->tail            = convolver_create(tail, count, rank, max_rank);
+                free(tail);
+
+                if (cv->tail == NULL)
+                {
+                    hconvolver_destroy(cv);
+                    return NULL;
+                }
+            }
+
+            return cv;
+        }
+
+        void hconvolver_reset(dsp::hconvolver_t *cv)
+        {
+            fir_reset(cv->head);
+            if (cv->tail != NULL)
+                convolver_reset(cv->tail);
+        }
+
+        void hconvolver_process(dsp::hconvolver_t *cv, float *dst, const float *src, size_t count)
+        {
+            if (cv->tail == NULL)
+            {
+                fir_process(cv->head, dst, src, count);
+                return;
+            }
+
+            while (count > 0)
+            {
+                size_t to_do    = lsp_min(count, HCONVOLVER_BLOCK);
+
+                // The tail should read the source before the head writes the destination
+                convolver_process(cv->tail, cv->buf, src, to_do);
+                fir_process(cv->head, dst, src, to_do);
+                dsp::add2(dst, cv->buf, to_do);
+
+                dst            += to_do;
+                src            += to_do;
+                count          -= to_do;
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_HCONVOLVER_H_ */
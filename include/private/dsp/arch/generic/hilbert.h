@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_HILBERT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_HILBERT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        // Squared coefficients of the all-pass pair by Olli Niemitalo
+        static const float hilbert_re_coeffs[] =
+        {
+            0.4021921162426f * 0.4021921162426f,
+            0.8561710882420f * 0.8561710882420f,
+            0.9722909545651f * 0.9722909545651f,
+            0.9952884791278f * 0.9952884791278f
+        };
+
+        static const float hilbert_im_coeffs[] =
+        {
+            0.6923878000000f * 0.6923878000000f,
+            0.9360654322959f * 0.9360654322959f,
+            0.9882295226860f * 0.9882295226860f,
+            0.9987488452737f * 0.9987488452737f
+        };
+
+        static void hilbert_init_chain(dsp::biquad_t *f, const float *c)
+        {
+            dsp::biquad_x4_t *x4    = &f->x4;
+
+            for (size_t i=0; i<4; ++i)
+            {
+                x4->b0[i]       = c[i];
+                x4->b1[i]       = 0.0f;
+                x4->b2[i]       = -1.0f;
+                x4->a1[i]       = 0.0f;
+                x4->a2[i]       = c[i];
+            }
+
+            for (size_t i=0; i<LSP_DSP_BIQUAD_D_ITEMS; ++i)
+                f->d[i]         = 0.0f;
+            for (size_t i=0; i<8; ++i)
+                f->__pad[i]     = 0.0f;
+        }
+
+        void hilbert_init(dsp::hilbert_t *h)
+        {
+            hilbert_init_chain(&h->re, hilbert_re_coeffs);
+            hilbert_init_chain(&h->im, hilbert_im_coeffs);
+
+            h->delay        = 0.0f;
+            for (size_t i=0; i<15; ++i)
+                h->__pad[i]     = 0.0f;
+        }
+
+        void hilbert_process(float *dst_re, float *dst_im, const float *src, size_t count, dsp::hilbert_t *h)
+        {
+            if (count <= 0)
+                return;
+
+            // Imaginary part is delayed by one sample, the last output sample is kept for the next call
+            dst_im[0]       = h->delay;
+            dsp::biquad_process_x4(&dst_im[1], src, count - 1, &h->im);
+            dsp::biquad_process_x4(&h->delay, &src[count - 1], 1, &h->im);
+
+            // Real part may overwrite the source
+            dsp::biquad_process_x4(dst_re, src, count, &h->re);
+        }
+
+        void hilbert_fft(float *dst_re, float *dst_im, const float *src, size_t rank)
+        {
+            const size_t n      = size_t(1) << rank;
+            const size_t half   = n >> 1;
+
+            // Compute the spectrum of the real signal
+            dsp::copy(dst_re, src, n);
+            dsp::fill_zero(dst_im, n);
+            dsp::direct_fft(dst_re, dst_im, dst_re, dst_im, rank);
+
+            // Double positive frequencies and remove negative frequencies
+            dsp::mul_k2(&dst_re[1], 2.0f, half - 1);
+            dsp::mul_k2(&dst_im[1], 2.0f, half - 1);
+            dsp::fill_zero(&dst_re[half + 1], half - 1);
+            dsp::fill_zero(&dst_im[half + 1], half - 1);
+
+            dsp::reverse_fft(dst_re, dst_im, dst_re, dst_im, rank);
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_HILBERT_H_ */
@@ -56,6 +56,14 @@ namespace lsp
             }
             return result;
         }
+
+        double h_dotp_f64(const double *a, const double *b, size_t count)
+        {
+            double result = 0;
+            while (count--)
+                result += *(a++) * *(b++);
+            return result;
+        }
     }
 }
 
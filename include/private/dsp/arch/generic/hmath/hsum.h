@@ -56,6 +56,14 @@ namespace lsp
                 result         += fabsf(src[i]);
             return result;
         }
+
+        double h_sum_f64(const double *src, size_t count)
+        {
+            double result   = 0.0;
+            for (size_t i=0; i<count; ++i)
+                result         += src[i];
+            return result;
+        }
     } /* namespace generic */
 } /* namespace lsp */
 
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_MCONVOLVER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_MCONVOLVER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The frequency-domain delay line of each input holds the spectra of the last 'parts'
+         * input blocks, the spectra of impulse responses are stored for each pair of input
+         * and output as 'parts' consecutive partitions.
+         */
+        struct mconvolver_t
+        {
+            size_t      rank;           // Fast convolution rank
+            size_t      block;          // Size of processing block
+            size_t      inputs;         // Number of inputs
+            size_t      outputs;        // Number of outputs
+            size_t      parts;          // Number of partitions in each impulse response
+            size_t      fill;           // Number of samples in current processing block
+            size_t      head;           // Index of the most recent spectrum in frequency-domain delay lines
+            uint8_t    *data;           // Allocated data
+            uint8_t    *active;         // Flags of non-empty pairs of input and output: outputs * inputs
+            float      *in;             // Input buffers: inputs * block
+            float      *out;            // Output buffers: outputs * block
+            float      *tail;           // Pending tails of the output: outputs * block
+            float      *fdl;            // Frequency-domain delay lines: inputs * parts * 2^(rank+1)
+            float      *ir;             // Impulse response spectra: outputs * inputs * parts * 2^(rank+1)
+            float      *acc;            // Spectrum accumulator: 2^(rank+1)
+            float      *tmp;            // Temporary buffer: 2^(rank+1)
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t MCONVOLVER_ALIGN    = 0x40;
+
+        void mconvolver_reset(dsp::mconvolver_t *cv)
+        {
+            size_t bins     = cv->block << 2;
+
+            cv->fill        = 0;
+            cv->head        = 0;
+            dsp::fill_zero(cv->in, cv->inputs * cv->block);
+            dsp::fill_zero(cv->out, cv->outputs * cv->block);
+            dsp::fill_zero(cv->tail, cv->outputs * cv->block);
+            dsp::fill_zero(cv->fdl, cv->inputs * cv->parts * bins);
+        }
+
+        dsp::mconvolver_t *mconvolver_create(const float * const *ir, size_t inputs, size_t outputs, size_t length, size_t rank)
+        {
+            if ((rank < LSP_DSP_CONVOLVER_RANK_MIN) || (rank > LSP_DSP_CONVOLVER_RANK_MAX))
+                return NULL;
+            if ((ir == NULL) || (inputs <= 0) || (outputs <= 0) || (length <= 0))
+                return NULL;
+
+            const size_t block  = size_t(1) << (rank - 1);
+            const size_t bins   = block << 2;
+            const size_t parts  = (length + block - 1) / block;
+            const size_t pairs  = inputs * outputs;
+            size_t to_alloc     = (inputs + outputs * 2) * block + (inputs + pairs) * parts * bins + bins * 2;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::mconvolver_t) + MCONVOLVER_ALIGN - 1) & ~(MCONVOLVER_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + pairs + MCONVOLVER_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + MCONVOLVER_ALIGN - 1) & ~uintptr_t(MCONVOLVER_ALIGN - 1));
+            dsp::mconvolver_t *cv = reinterpret_cast<dsp::mconvolver_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            cv->rank            = rank;
+            cv->block           = block;
+            cv->inputs          = inputs;
+            cv->outputs         = outputs;
+            cv->parts           = parts;
+            cv->data            = data;
+            cv->in              = convolver_alloc(fptr, inputs * block);
+            cv->out             = convolver_alloc(fptr, outputs * block);
+            cv->tail            = convolver_alloc(fptr, outputs * block);
+            cv->fdl             = convolver_alloc(fptr, inputs * parts * bins);
+            cv->ir              = convolver_alloc(fptr, pairs * parts * bins);
+            cv->acc             = convolver_alloc(fptr, bins);
+            cv->tmp             = convolver_alloc(fptr, bins);
+            cv->active          = reinterpret_cast<uint8_t *>(fptr);
+
+            // Prepare impulse response spectra
+            for (size_t i=0; i<pairs; ++i)
+            {
+                const float *src    = ir[i];
+                float *dst          = &cv->ir[i * parts * bins];
+                cv->active[i]       = (src != NULL) ? 1 : 0;
+                if (src == NULL)
+                    continue;
+
+                for (size_t j=0, offset=0; j<parts; ++j, offset += block)
+                {
+                    size_t count        = lsp_min(length - offset, block);
+                    dsp::copy(cv->tmp, &src[offset], count);
+                    if (count < block)
+                        dsp::fill_zero(&cv->tmp[count], block - count);
+                    dsp::fastconv_parse(&dst[j * bins], cv->tmp, rank);
+                }
+            }
+
+            mconvolver_reset(cv);
+
+            return cv;
+        }
+
+        void mconvolver_destroy(dsp::mconvolver_t *cv)
+        {
+            if (cv != NULL)
+                free(cv->data);
+        }
+
+        size_t mconvolver_latency(const dsp::mconvolver_t *cv)
+        {
+            return cv->block;
+        }
+
+        static void mconvolver_tick(dsp::mconvolver_t *cv)
+        {
+            const size_t block  = cv->block;
+            const size_t bins   = block << 2;
+            const size_t parts  = cv->parts;
+            const size_t inputs = cv->inputs;
+
+            // Transform each input block only once
+            if ((++cv->head) >= parts)
+                cv->head            = 0;
+            for (size_t i=0; i<inputs; ++i)
+                dsp::fastconv_parse(&cv->fdl[(i * parts + cv->head) * bins], &cv->in[i * block], cv->rank);
+
+            for (size_t o=0; o<cv->outputs; ++o)
+            {
+                const uint8_t *active   = &cv->active[o * inputs];
+                const float *ir         = &cv->ir[o * inputs * parts * bins];
+                float *out              = &cv->out[o * block];
+                float *tail             = &cv->tail[o * block];
+
+                // Accumulate products of spectra for all partitions of all inputs
+                bool empty              = true;
+                dsp::fill_zero(cv->acc, bins);
+                for (size_t i=0; i<inputs; ++i)
+                {
+                    if (!active[i])
+                        continue;
+
+                    const float *fdl        = &cv->fdl[i * parts * bins];
+                    const float *c          = &ir[i * parts * bins];
+                    for (size_t k=0; k<parts; ++k)
+                    {
+                        size_t slot             = (cv->head + parts - k) % parts;
+                        dsp::fastconv_fmadd(cv->acc, &fdl[slot * bins], &c[k * bins], cv->rank);
+                    }
+                    empty                   = false;
+                }
+
+                // Restore the output only once and apply the overlap-add
+                if (empty)
+                {
+                    dsp::copy(out, tail, block);
+                    dsp::fill_zero(tail, block);
+                    continue;
+                }
+
+                dsp::fastconv_restore(cv->tmp, cv->acc, cv->rank);
+                dsp::add3(out, cv->tmp, tail, block);
+                dsp::copy(tail, &cv->tmp[block], block);
+            }
+        }
+
+        void mconvolver_process(dsp::mconvolver_t *cv, float * const *dst, const float * const *src, size_t count)
+        {
+            const size_t block  = cv->block;
+
+            for (size_t off=0; off < count; )
+            {
+                size_t to_do    = lsp_min(count - off, block - cv->fill);
+
+                // All sources should be read before destinations are written, so in-place processing is possible
+                for (size_t i=0; i<cv->inputs; ++i)
+                    dsp::copy(&cv->in[i * block + cv->fill], &src[i][off], to_do);
+                for (size_t o=0; o<cv->outputs; ++o)
+                    dsp::copy(&dst[o][off], &cv->out[o * block + cv->fill], to_do);
+
+                cv->fill       += to_do;
+                if (cv->fill >= block)
+                {
+                    mconvolver_tick(cv);
+                    cv->fill        = 0;
+                }
+
+                off            += to_do;
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_MCONVOLVER_H_ */
@@ -0,0 +1,582 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_
+#define PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+#include <private/dsp/fft.h>
+
+#include <pthread.h>
+
+namespace lsp
+{
+    namespace dsp
+    {
+        typedef void (* workers_task_t)(void *arg, size_t index, size_t count);
+
+        typedef struct worker_t
+        {
+            workers_t          *pool;           // Pool of workers
+            size_t              index;          // Index of the worker
+            pthread_t           thread;         // Thread of the worker
+        } worker_t;
+
+        struct workers_t
+        {
+            size_t              threads;        // Overall number of threads including the calling thread
+            size_t              pending;        // Number of workers that did not complete the current task
+            size_t              generation;     // Sequential number of the current task
+            bool                shutdown;       // Shutdown request
+            workers_task_t      task;           // Current task
+            void               *arg;            // Argument of the current task
+            worker_t           *workers;        // Worker threads: threads - 1 items
+            pthread_mutex_t     lock;           // Lock of the pool state
+            pthread_cond_t      start;          // Signalled when new task is submitted
+            pthread_cond_t      done;           // Signalled when the last worker completes the task
+            size_t              fft_rank;       // Rank of the six-step FFT of cached plans, 0 if none
+            fft_plan_t         *fft_plan1;      // Cached plan of N1-point FFT
+            fft_plan_t         *fft_plan2;      // Cached plan of N2-point FFT
+            uint8_t            *fft_data;       // Allocated data of the FFT buffers
+            float              *fft_buf;        // Intermediate N1 x N2 matrix followed by tile buffers
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t PARALLEL_ALIGN      = 0x40;
+        // Smaller transforms are not worth splitting between threads
+        static constexpr size_t PARALLEL_FFT_RANK_MIN       = 12;
+        // Number of complex numbers in the tile row, one 64-byte cache line
+        static constexpr size_t PARALLEL_FFT_TILE           = 8;
+
+        static inline float *parallel_alloc(uint8_t * &data, size_t count)
+        {
+            data                = static_cast<uint8_t *>(malloc(count * sizeof(float) + PARALLEL_ALIGN));
+            if (data == NULL)
+                return NULL;
+            return reinterpret_cast<float *>((uintptr_t(data) + PARALLEL_ALIGN - 1) & ~uintptr_t(PARALLEL_ALIGN - 1));
+        }
+
+        static void *workers_main(void *arg)
+        {
+            dsp::worker_t *w        = static_cast<dsp::worker_t *>(arg);
+            dsp::workers_t *pool    = w->pool;
+            size_t generation       = 0;
+
+            pthread_mutex_lock(&pool->lock);
+            while (true)
+            {
+                while ((!pool->shutdown) && (pool->generation == generation))
+                    pthread_cond_wait(&pool->start, &pool->lock);
+                if (pool->shutdown)
+                    break;
+
+                generation              = pool->generation;
+                dsp::workers_task_t task= pool->task;
+                void *task_arg          = pool->arg;
+                pthread_mutex_unlock(&pool->lock);
+
+                task(task_arg, w->index, pool->threads);
+
+                pthread_mutex_lock(&pool->lock);
+                if ((--pool->pending) == 0)
+                    pthread_cond_signal(&pool->done);
+            }
+            pthread_mutex_unlock(&pool->lock);
+
+            return NULL;
+        }
+
+        static void parallel_fft_release(dsp::workers_t *pool)
+        {
+            fft_plan_destroy(pool->fft_plan1);
+            fft_plan_destroy(pool->fft_plan2);
+            if (pool->fft_data != NULL)
+                free(pool->fft_data);
+
+            pool->fft_rank      = 0;
+            pool->fft_plan1     = NULL;
+            pool->fft_plan2     = NULL;
+            pool->fft_data      = NULL;
+            pool->fft_buf       = NULL;
+        }
+
+        static void workers_stop(dsp::workers_t *pool, size_t started)
+        {
+            pthread_mutex_lock(&pool->lock);
+            pool->shutdown      = true;
+            pthread_cond_broadcast(&pool->start);
+            pthread_mutex_unlock(&pool->lock);
+
+            for (size_t i=0; i<started; ++i)
+                pthread_join(pool->workers[i].thread, NULL);
+
+            pthread_cond_destroy(&pool->done);
+            pthread_cond_destroy(&pool->start);
+            pthread_mutex_destroy(&pool->lock);
+            parallel_fft_release(pool);
+            free(pool);
+        }
+
+        dsp::workers_t *workers_create(size_t threads)
+        {
+            if ((threads < 1) || (threads > LSP_DSP_WORKERS_MAX))
+                return NULL;
+
+            size_t szof_pool    = (sizeof(dsp::workers_t) + PARALLEL_ALIGN - 1) & ~(PARALLEL_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_pool + (threads - 1) * sizeof(dsp::worker_t)));
+            if (data == NULL)
+                return NULL;
+
+            dsp::workers_t *pool= reinterpret_cast<dsp::workers_t *>(data);
+            pool->threads       = threads;
+            pool->pending       = 0;
+            pool->generation    = 0;
+            pool->shutdown      = false;
+            pool->task          = NULL;
+            pool->arg           = NULL;
+            pool->workers       = reinterpret_cast<dsp::worker_t *>(&data[szof_pool]);
+            pool->fft_rank      = 0;
+            pool->fft_plan1     = NULL;
+            pool->fft_plan2     = NULL;
+            pool->fft_data      = NULL;
+            pool->fft_buf       = NULL;
+
+            pthread_mutex_init(&pool->lock, NULL);
+            pthread_cond_init(&pool->start, NULL);
+            pthread_cond_init(&pool->done, NULL);
+
+            for (size_t i=0; i<threads-1; ++i)
+            {
+                dsp::worker_t *w    = &pool->workers[i];
+                w->pool             = pool;
+                w->index            = i + 1;
+                if (pthread_create(&w->thread, NULL, workers_main, w) != 0)
+                {
+                    workers_stop(pool, i);
+                    return NULL;
+                }
+            }
+
+            return pool;
+        }
+
+        void workers_destroy(dsp::workers_t *pool)
+        {
+            if (pool != NULL)
+                workers_stop(pool, pool->threads - 1);
+        }
+
+        size_t workers_threads(const dsp::workers_t *pool)
+        {
+            return pool->threads;
+        }
+
+        /**
+         * Execute the task by all threads of the pool, the calling thread executes the task
+         * with index 0. The function returns when all threads have completed the task.
+         */
+        static void workers_run(dsp::workers_t *pool, dsp::workers_task_t task, void *arg)
+        {
+            if (pool->threads > 1)
+            {
+                pthread_mutex_lock(&pool->lock);
+                pool->task          = task;
+                pool->arg           = arg;
+                pool->pending       = pool->threads - 1;
+                ++pool->generation;
+                pthread_cond_broadcast(&pool->start);
+                pthread_mutex_unlock(&pool->lock);
+            }
+
+            task(arg, 0, pool->threads);
+
+            if (pool->threads > 1)
+            {
+                pthread_mutex_lock(&pool->lock);
+                while (pool->pending > 0)
+                    pthread_cond_wait(&pool->done, &pool->lock);
+                pthread_mutex_unlock(&pool->lock);
+            }
+        }
+
+        /**
+         * Six-step FFT of N = N1 * N2 points: the input index is n = n1 + N1*n2,
+         * the output index is k = k2 + N2*k1.
+         *   1. For each n1 compute the N2-point FFT over n2, multiply the result by W_N^(n1*k2)
+         *      and store as the row n1 of the N1 x N2 matrix;
+         *   2. For each k2 compute the N1-point FFT over the column k2 of the matrix and store
+         *      the result to the output with the stride N2.
+         * Columns are gathered by tiles of PARALLEL_FFT_TILE, so each access to memory
+         * touches the whole cache line.
+         */
+        typedef struct parallel_fft_t
+        {
+            float              *dst;            // Destination buffer
+            const float        *src;            // Source buffer
+            float              *buf;            // Intermediate N1 x N2 matrix
+            float              *tiles;          // Tile buffers of each thread
+            const float        *tw;             // Twiddle factors W_N^m: N/2 cosines followed by N/2 sines
+            dsp::fft_plan_t    *plan1;          // Plan of N1-point FFT
+            dsp::fft_plan_t    *plan2;          // Plan of N2-point FFT
+            size_t              tile_size;      // Size of the tile buffer in floats
+            float               dir;            // Direction: 1 for direct FFT, -1 for reverse FFT
+        } parallel_fft_t;
+
+        static inline void parallel_fft_sub(const dsp::fft_plan_t *plan, float *buf, float dir)
+        {
+            if (dir > 0.0f)
+                dsp::plan_packed_direct_fft(plan, buf, buf);
+            else
+                dsp::plan_packed_reverse_fft(plan, buf, buf);
+        }
+
+        static void parallel_fft_rows(void *arg, size_t index, size_t count)
+        {
+            parallel_fft_t *p   = static_cast<parallel_fft_t *>(arg);
+            size_t n1_items     = size_t(1) << p->plan1->rank;
+            size_t n2_items     = size_t(1) << p->plan2->rank;
+            size_t half         = (n1_items * n2_items) >> 1;
+            size_t tiles        = n1_items / PARALLEL_FFT_TILE;
+            float *tile         = &p->tiles[index * p->tile_size];
+            const float *w_re   = p->tw;
+            const float *w_im   = &p->tw[half];
+
+            for (size_t t=(tiles * index) / count, last=(tiles * (index + 1)) / count; t < last; ++t)
+            {
+                size_t n1           = t * PARALLEL_FFT_TILE;
+
+                // Gather columns n1 ... n1 + PARALLEL_FFT_TILE - 1 of the input
+                for (size_t n2=0; n2 < n2_items; ++n2)
+                {
+                    const float *s      = &p->src[(n1 + n2 * n1_items) << 1];
+                    for (size_t i=0; i<PARALLEL_FFT_TILE; ++i)
+                    {
+                        float *d            = &tile[(i * n2_items + n2) << 1];
+                        d[0]                = s[i*2];
+                        d[1]                = s[i*2 + 1];
+                    }
+                }
+
+                // Compute N2-point FFTs, apply twiddle factors and store rows of the matrix
+                for (size_t i=0; i<PARALLEL_FFT_TILE; ++i)
+                {
+                    float *row          = &tile[(i * n2_items) << 1];
+                    float *d            = &p->buf[((n1 + i) * n2_items) << 1];
+                    parallel_fft_sub(p->plan2, row, p->dir);
+
+                    for (size_t k2=0, m=0; k2 < n2_items; ++k2, m += n1 + i)
+                    {
+                        float c, s;
+                        if (m < half)
+                        {
+                            c                   = w_re[m];
+                            s                   = p->dir * w_im[m];
+                        }
+                        else
+                        {
+                            c                   = -w_re[m - half];
+                            s                   = -p->dir * w_im[m - half];
+                        }
+
+                        float re            = row[k2*2];
+                        float im            = row[k2*2 + 1];
+                        d[k2*2]             = re * c + im * s;
+                        d[k2*2 + 1]         = im * c - re * s;
+                    }
+                }
+            }
+        }
+
+        static void parallel_fft_columns(void *arg, size_t index, size_t count)
+        {
+            parallel_fft_t *p   = static_cast<parallel_fft_t *>(arg);
+            size_t n1_items     = size_t(1) << p->plan1->rank;
+            size_t n2_items     = size_t(1) << p->plan2->rank;
+            size_t tiles        = n2_items / PARALLEL_FFT_TILE;
+            float *tile         = &p->tiles[index * p->tile_size];
+
+            for (size_t t=(tiles * index) / count, last=(tiles * (index + 1)) / count; t < last; ++t)
+            {
+                size_t k2           = t * PARALLEL_FFT_TILE;
+
+                // Gather columns k2 ... k2 + PARALLEL_FFT_TILE - 1 of the matrix
+                for (size_t n1=0; n1 < n1_items; ++n1)
+                {
+                    const float *s      = &p->buf[(k2 + n1 * n2_items) << 1];
+                    for (size_t i=0; i<PARALLEL_FFT_TILE; ++i)
+                    {
+                        float *d            = &tile[(i * n1_items + n1) << 1];
+                        d[0]                = s[i*2];
+                        d[1]                = s[i*2 + 1];
+                    }
+                }
+
+                // Compute N1-point FFTs
+                for (size_t i=0; i<PARALLEL_FFT_TILE; ++i)
+                    parallel_fft_sub(p->plan1, &tile[(i * n1_items) << 1], p->dir);
+
+                // Scatter the result to the output with the stride N2
+                for (size_t k1=0; k1 < n1_items; ++k1)
+                {
+                    float *d            = &p->dst[(k2 + k1 * n2_items) << 1];
+                    for (size_t i=0; i<PARALLEL_FFT_TILE; ++i)
+                    {
+                        const float *s      = &tile[(i * n1_items + k1) << 1];
+                        d[i*2]              = s[0];
+                        d[i*2 + 1]          = s[1];
+                    }
+                }
+            }
+        }
+
+        /**
+         * Get plans of sub-transforms and buffers of the six-step FFT of the specified rank.
+         * They are cached by the pool and rebuilt only when the rank changes.
+         */
+        static bool parallel_fft_prepare(dsp::workers_t *pool, size_t rank)
+        {
+            if (pool->fft_rank == rank)
+                return true;
+
+            parallel_fft_release(pool);
+
+            size_t rank2        = rank >> 1;
+            size_t rank1        = rank - rank2;
+            size_t items        = size_t(1) << rank;
+            size_t tile_size    = (PARALLEL_FFT_TILE * 2) << rank1;
+
+            pool->fft_plan1     = fft_plan_create(rank1);
+            pool->fft_plan2     = fft_plan_create(rank2);
+            pool->fft_buf       = ((pool->fft_plan1 != NULL) && (pool->fft_plan2 != NULL)) ?
+                                  parallel_alloc(pool->fft_data, (items << 1) + tile_size * pool->threads) : NULL;
+            if (pool->fft_buf == NULL)
+            {
+                parallel_fft_release(pool);
+                return false;
+            }
+
+            pool->fft_rank      = rank;
+            return true;
+        }
+
+        static bool parallel_packed_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src, float dir)
+        {
+            size_t rank         = plan->rank;
+            if ((pool->threads <= 1) || (rank < PARALLEL_FFT_RANK_MIN))
+                return false;
+            if (!parallel_fft_prepare(pool, rank))
+                return false;
+
+            size_t items        = size_t(1) << rank;
+
+            parallel_fft_t p;
+            p.dst               = dst;
+            p.src               = src;
+            p.buf               = pool->fft_buf;
+            p.plan1             = pool->fft_plan1;
+            p.plan2             = pool->fft_plan2;
+            p.tile_size         = (PARALLEL_FFT_TILE * 2) << p.plan1->rank;
+            p.tiles             = &p.buf[items << 1];
+            p.tw                = dsp::fft_plan_twiddles(plan, items >> 1);
+            p.dir               = dir;
+
+            workers_run(pool, parallel_fft_rows, &p);
+            workers_run(pool, parallel_fft_columns, &p);
+
+            return true;
+        }
+
+        void parallel_packed_direct_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            if (!parallel_packed_fft(pool, plan, dst, src, 1.0f))
+                dsp::plan_packed_direct_fft(plan, dst, src);
+        }
+
+        void parallel_packed_reverse_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            if (!parallel_packed_fft(pool, plan, dst, src, -1.0f))
+                dsp::plan_packed_reverse_fft(plan, dst, src);
+        }
+
+        /**
+         * Block-parallel fast convolution: each thread computes the contiguous range of output
+         * blocks, the tail of the last block of the range overlaps with the first block of
+         * the next range, so it is stored separately and added after all threads complete.
+         */
+        typedef struct parallel_conv_t
+        {
+            float              *dst;            // Destination buffer
+            const float        *src;            // Source signal
+            const float        *conv;           // Convolution
+            float              *ir;             // Convolution partitions: parts * bins floats
+            float              *state;          // Per-thread state: state_size floats per thread
+            size_t              length;         // Length of convolution
+            size_t              count;          // Length of source signal
+            size_t              rank;           // Fast convolution rank
+            size_t              parts;          // Number of convolution partitions
+            size_t              blocks;         // Number of source signal blocks
+            size_t              state_size;     // Size of the state of the thread in floats
+        } parallel_conv_t;
+
+        static void parallel_conv_parse(float *dst, float *pad, const float *src, size_t count, size_t rank)
+        {
+            size_t block        = size_t(1) << (rank - 1);
+            if (count < block)
+            {
+                dsp::copy(pad, src, count);
+                dsp::fill_zero(&pad[count], block - count);
+                src                 = pad;
+            }
+            dsp::fastconv_parse(dst, src, rank);
+        }
+
+        static void parallel_conv_prepare(void *arg, size_t index, size_t count)
+        {
+            parallel_conv_t *p  = static_cast<parallel_conv_t *>(arg);
+            size_t block        = size_t(1) << (p->rank - 1);
+            size_t bins         = block << 2;
+            float *pad          = &p->state[index * p->state_size];
+
+            for (size_t j=(p->parts * index) / count, last=(p->parts * (index + 1)) / count; j < last; ++j)
+            {
+                size_t off          = j * block;
+                parallel_conv_parse(&p->ir[j * bins], pad, &p->conv[off], lsp_min(p->length - off, block), p->rank);
+            }
+        }
+
+        static void parallel_conv_process(void *arg, size_t index, size_t count)
+        {
+            parallel_conv_t *p  = static_cast<parallel_conv_t *>(arg);
+            size_t block        = size_t(1) << (p->rank - 1);
+            size_t bins         = block << 2;
+            size_t parts        = p->parts;
+            size_t outputs      = p->blocks + parts - 1;
+            size_t total        = p->count + p->length - 1;
+
+            float *acc          = &p->state[index * p->state_size];
+            float *tmp          = &acc[bins];
+            float *tail         = &tmp[block << 1];
+            float *fdl          = &tail[block];
+
+            size_t first        = (outputs * index) / count;
+            size_t last         = (outputs * (index + 1)) / count;
+            dsp::fill_zero(tail, block);
+
+            // Frequency-domain delay line contains spectrums of source blocks k-parts+1 ... k
+            for (size_t k=(first >= parts) ? first - parts + 1 : 0; k < last; ++k)
+            {
+                if (k < p->blocks)
+                {
+                    size_t off          = k * block;
+                    parallel_conv_parse(&fdl[(k % parts) * bins], tmp, &p->src[off], lsp_min(p->count - off, block), p->rank);
+                }
+                if (k < first)
+                    continue;
+
+                // Accumulate products of source blocks and convolution partitions
+                dsp::fill_zero(acc, bins);
+                for (size_t j=0; j<parts; ++j)
+                {
+                    if (j > k)
+                        break;
+                    if ((k - j) < p->blocks)
+                        dsp::fastconv_fmadd(acc, &fdl[((k - j) % parts) * bins], &p->ir[j * bins], p->rank);
+                }
+                dsp::fastconv_restore(tmp, acc, p->rank);
+
+                // Emit the result, the tail of the last block is deferred
+                size_t off          = k * block;
+                size_t n            = lsp_min(total - off, block);
+                dsp::add2(&p->dst[off], tmp, n);
+                if ((off + block) >= total)
+                    continue;
+
+                n                   = lsp_min(total - off - block, block);
+                dsp::add2((k + 1 < last) ? &p->dst[off + block] : tail, &tmp[block], n);
+            }
+        }
+
+        void parallel_convolve(dsp::workers_t *pool, float *dst, const float *src, const float *conv, size_t length, size_t count, size_t rank)
+        {
+            if ((length == 0) || (count == 0))
+                return;
+            if ((rank < LSP_DSP_CONVOLVER_RANK_MIN) || (rank > LSP_DSP_CONVOLVER_RANK_MAX))
+            {
+                dsp::convolve(dst, src, conv, length, count);
+                return;
+            }
+
+            size_t block        = size_t(1) << (rank - 1);
+            size_t bins         = block << 2;
+            size_t threads      = pool->threads;
+
+            parallel_conv_t p;
+            p.dst               = dst;
+            p.src               = src;
+            p.conv              = conv;
+            p.length            = length;
+            p.count             = count;
+            p.rank              = rank;
+            p.parts             = (length + block - 1) / block;
+            p.blocks            = (count + block - 1) / block;
+            p.state_size        = (p.parts + 1) * bins + block * 3;
+
+            uint8_t *data       = NULL;
+            p.ir                = parallel_alloc(data, p.parts * bins + p.state_size * threads);
+            if (p.ir == NULL)
+            {
+                dsp::convolve(dst, src, conv, length, count);
+                return;
+            }
+            p.state             = &p.ir[p.parts * bins];
+
+            workers_run(pool, parallel_conv_prepare, &p);
+            workers_run(pool, parallel_conv_process, &p);
+
+            // Add deferred tails of the last blocks of each thread
+            size_t outputs      = p.blocks + p.parts - 1;
+            size_t total        = count + length - 1;
+            for (size_t i=0; i<threads; ++i)
+            {
+                size_t last         = (outputs * (i + 1)) / threads;
+                size_t first        = (outputs * i) / threads;
+                if (first >= last)
+                    continue;
+
+                size_t off          = last * block;
+                if (off >= total)
+                    continue;
+
+                const float *tail   = &p.state[i * p.state_size + bins + block * 2];
+                dsp::add2(&dst[off], tail, lsp_min(total - off, block));
+            }
+
+            free(data);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_PARALLEL_H_ */
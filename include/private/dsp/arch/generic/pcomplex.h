@@ -119,6 +119,15 @@ namespace lsp
             }
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, dst += 2)
+            {
+                dst[0]      = src[i] * w[i];
+                dst[1]      = 0.0f;
+            }
+        }
+
         void pcomplex_fill_ri(float *dst, float re, float im, size_t count)
         {
             while (count --)
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_
+#define PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The position of the resampler is stored as integer index of the first kernel tap
+         * in the history buffer and the fraction in units of 1/den
+         */
+        struct resampler_t
+        {
+            size_t      taps;           // Number of kernel taps
+            size_t      stride;         // Distance between kernel phases in the table
+            size_t      phases;         // Number of kernel phases
+            size_t      cap;            // Capacity of the history buffer
+            size_t      fill;           // Number of samples in the history buffer
+            size_t      ipos;           // Integer part of the position
+            uint64_t    frac;           // Fractional part of the position
+            uint64_t    den;            // Denominator of the fractional part
+            uint64_t    nominal;        // Nominal position step in units of 1/den
+            uint64_t    step;           // Actual position step in units of 1/den
+            uint8_t    *data;           // Allocated data
+            float      *kernel;         // Kernel table: (phases + 1) * stride floats
+            float      *hist;           // History buffer
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t RESAMPLER_ALIGN     = 0x40;
+        static constexpr size_t RESAMPLER_BLOCK     = 0x400;
+        static constexpr size_t RESAMPLER_SHIFT     = 20;
+        static constexpr size_t RESAMPLER_PHASES    = 0x100;
+
+        static size_t resampler_gcd(size_t a, size_t b)
+        {
+            while (b > 0)
+            {
+                size_t t        = a % b;
+                a               = b;
+                b               = t;
+            }
+            return a;
+        }
+
+        void resampler_reset(dsp::resampler_t *rs)
+        {
+            // The history is prepended with zeros, so the first output sample
+            // matches the first input sample
+            rs->fill        = (rs->taps >> 1) - 1;
+            rs->ipos        = 0;
+            rs->frac        = 0;
+            rs->step        = rs->nominal;
+            dsp::fill_zero(rs->hist, rs->cap);
+        }
+
+        dsp::resampler_t *resampler_create(size_t in_rate, size_t out_rate, size_t lobes)
+        {
+            if ((in_rate <= 0) || (out_rate <= 0))
+                return NULL;
+            if ((lobes < LSP_DSP_RESAMPLER_LOBES_MIN) || (lobes > LSP_DSP_RESAMPLER_LOBES_MAX))
+                return NULL;
+
+            // Reduce the ratio to the irreducible fraction L/M
+            size_t gcd          = resampler_gcd(in_rate, out_rate);
+            size_t up           = out_rate / gcd;
+            size_t down         = in_rate / gcd;
+            if ((uint64_t(up) > uint64_t(down) * LSP_DSP_RESAMPLER_RATIO_MAX) ||
+                (uint64_t(down) > uint64_t(up) * LSP_DSP_RESAMPLER_RATIO_MAX))
+                return NULL;
+
+            dsp::resampler_t hdr;
+            if (up <= LSP_DSP_RESAMPLER_PHASES_MAX)
+            {
+                // The number of phases is a multiple of L, so nominal positions always hit the
+                // tabulated phases while the drift compensation still has enough resolution
+                hdr.phases          = up * ((RESAMPLER_PHASES + up - 1) / up);
+                hdr.den             = uint64_t(up) << RESAMPLER_SHIFT;
+                hdr.nominal         = uint64_t(down) << RESAMPLER_SHIFT;
+            }
+            else
+            {
+                hdr.phases          = LSP_DSP_RESAMPLER_PHASES_MAX;
+                hdr.den             = uint64_t(1) << 32;
+                hdr.nominal         = uint64_t(double(down) * double(hdr.den) / double(up) + 0.5);
+            }
+
+            // Compute the kernel size, for downsampling the kernel is stretched
+            float cutoff        = (up < down) ? float(up) / float(down) : 1.0f;
+            size_t half         = size_t(ceilf(float(lobes) / cutoff));
+            hdr.taps            = half << 1;
+            hdr.stride          = (hdr.taps + 0x0f) & ~size_t(0x0f);
+            hdr.cap             = hdr.taps + RESAMPLER_BLOCK;
+
+            size_t to_alloc     = (hdr.phases + 1) * hdr.stride + hdr.cap;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::resampler_t) + RESAMPLER_ALIGN - 1) & ~(RESAMPLER_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + RESAMPLER_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + RESAMPLER_ALIGN - 1) & ~uintptr_t(RESAMPLER_ALIGN - 1));
+            dsp::resampler_t *rs= reinterpret_cast<dsp::resampler_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            *rs                 = hdr;
+            rs->data            = data;
+            rs->kernel          = fptr;
+            rs->hist            = &fptr[(hdr.phases + 1) * hdr.stride];
+
+            // Tabulate kernel phases, the last one is used for interpolation only.
+            // Each phase is normalized to unity gain at DC
+            const float k       = M_PI * cutoff;
+            for (size_t i=0; i<=hdr.phases; ++i)
+            {
+                float *row          = &rs->kernel[i * hdr.stride];
+                float shift         = float(half - 1) + float(i) / float(hdr.phases);
+
+                dsp::lanczos1(row, k, k * shift, M_PI * lobes, 1.0f / lobes, hdr.taps);
+                dsp::fill_zero(&row[hdr.taps], hdr.stride - hdr.taps);
+                float gain          = dsp::h_sum(row, hdr.taps);
+                if (gain != 0.0f)
+                    dsp::mul_k2(row, 1.0f / gain, hdr.taps);
+            }
+
+            resampler_reset(rs);
+
+            return rs;
+        }
+
+        void resampler_destroy(dsp::resampler_t *rs)
+        {
+            if (rs != NULL)
+                free(rs->data);
+        }
+
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio)
+        {
+            if (!(ratio > 0.0))
+                return;
+
+            double step         = double(rs->den) / ratio;
+            step                = lsp_max(step, double(rs->nominal) * 0.5);
+            step                = lsp_min(step, double(rs->nominal) * 2.0);
+            rs->step            = lsp_max(uint64_t(step + 0.5), uint64_t(1));
+        }
+
+        double resampler_get_ratio(const dsp::resampler_t *rs)
+        {
+            return double(rs->den) / double(rs->step);
+        }
+
+        size_t resampler_latency(const dsp::resampler_t *rs)
+        {
+            return rs->taps >> 1;
+        }
+
+        size_t resampler_max_output(const dsp::resampler_t *rs, size_t count)
+        {
+            return size_t(double(count + 1) * double(rs->den) / double(rs->step)) + 1;
+        }
+
+        static size_t resampler_run(dsp::resampler_t *rs, float *dst)
+        {
+            const size_t taps   = rs->taps;
+            const size_t stride = rs->stride;
+            const uint64_t den  = rs->den;
+            const uint64_t di   = rs->step / den;
+            const uint64_t df   = rs->step % den;
+            const float kf      = 1.0f / float(den);
+            size_t n            = 0;
+
+            while ((rs->ipos + taps) <= rs->fill)
+            {
+                const float *s      = &rs->hist[rs->ipos];
+                uint64_t phase      = rs->frac * rs->phases;
+                size_t row          = phase / den;
+                uint64_t rem        = phase - row * den;
+                const float *k      = &rs->kernel[row * stride];
+
+                // Interpolate between adjacent phases only if the position is between them
+                float v             = dsp::h_dotp(k, s, taps);
+                if (rem > 0)
+                    v                  += (dsp::h_dotp(&k[stride], s, taps) - v) * (float(rem) * kf);
+                dst[n++]            = v;
+
+                // Move to the next position
+                rs->ipos           += di;
+                rs->frac           += df;
+                if (rs->frac >= den)
+                {
+                    rs->frac           -= den;
+                    ++rs->ipos;
+                }
+            }
+
+            return n;
+        }
+
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count)
+        {
+            size_t n            = 0;
+
+            while (count > 0)
+            {
+                // Append the input data to the history
+                size_t to_do        = lsp_min(count, rs->cap - rs->fill);
+                dsp::copy(&rs->hist[rs->fill], src, to_do);
+                rs->fill           += to_do;
+                src                += to_do;
+                count              -= to_do;
+
+                // Produce output and drop samples that are not needed anymore
+                n                  += resampler_run(rs, &dst[n]);
+                size_t shift        = lsp_min(rs->ipos, rs->fill);
+                if (shift > 0)
+                {
+                    dsp::move(rs->hist, &rs->hist[shift], rs->fill - shift);
+                    rs->fill           -= shift;
+                    rs->ipos           -= shift;
+                }
+            }
+
+            return n;
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_RESAMPLER_H_ */
@@ -3441,6 +3441,3808 @@ namespace lsp
             -0.0000039770996537f
         };
 
+        // Decimation kernels pre-scaled by 1/N for unity gain at DC
+        static const float lanczos_dec_2x2[] =
+        {
+            -0.0318421760139309f,
+            +0.0000000000000000f,
+            +0.2865795841253782f,
+            +0.5000000000000000f,
+            +0.2865795841253782f,
+            +0.0000000000000000f,
+            -0.0318421760139309f
+        };
+
+        static const float lanczos_dec_2x3[] =
+        {
+            +0.0121585420370806f,
+            -0.0000000000000000f,
+            -0.0675474557615585f,
+            +0.0000000000000000f,
+            +0.3039635509270133f,
+            +0.5000000000000000f,
+            +0.3039635509270133f,
+            +0.0000000000000000f,
+            -0.0675474557615585f,
+            -0.0000000000000000f,
+            +0.0121585420370806f
+        };
+
+        static const float lanczos_dec_2x4[] =
+        {
+            -0.0063304389106193f,
+            +0.0000000000000000f,
+            +0.0299547416886315f,
+            -0.0000000000000000f,
+            -0.0832076158017540f,
+            +0.0000000000000000f,
+            +0.3101915066203473f,
+            +0.5000000000000000f,
+            +0.3101915066203473f,
+            +0.0000000000000000f,
+            -0.0832076158017540f,
+            -0.0000000000000000f,
+            +0.0299547416886315f,
+            +0.0000000000000000f,
+            -0.0063304389106193f
+        };
+
+        static const float lanczos_dec_2x16bit[] =
+        {
+            -0.0008781232775808f,
+            +0.0000000000000000f,
+            +0.0031833117505873f,
+            -0.0000000000000000f,
+            -0.0063684352027862f,
+            +0.0000000000000000f,
+            +0.0106837675341788f,
+            -0.0000000000000000f,
+            -0.0165411159898902f,
+            +0.0000000000000000f,
+            +0.0247095683305768f,
+            -0.0000000000000000f,
+            -0.0368480961893105f,
+            +0.0000000000000000f,
+            +0.0573159168250756f,
+            -0.0000000000000000f,
+            -0.1022196773244163f,
+            +0.0000000000000000f,
+            +0.3170025032066420f,
+            +0.5000000000000000f,
+            +0.3170025032066420f,
+            +0.0000000000000000f,
+            -0.1022196773244163f,
+            -0.0000000000000000f,
+            +0.0573159168250756f,
+            +0.0000000000000000f,
+            -0.0368480961893105f,
+            -0.0000000000000000f,
+            +0.0247095683305768f,
+            +0.0000000000000000f,
+            -0.0165411159898902f,
+            -0.0000000000000000f,
+            +0.0106837675341788f,
+            +0.0000000000000000f,
+            -0.0063684352027862f,
+            -0.0000000000000000f,
+            +0.0031833117505873f,
+            +0.0000000000000000f,
+            -0.0008781232775808f
+        };
+
+        static const float lanczos_dec_2x24bit[] =
+        {
+            -0.0000210374667385f,
+            +0.0000000000000000f,
+            +0.0000651602003523f,
+            -0.0000000000000000f,
+            -0.0001120892748518f,
+            +0.0000000000000000f,
+            +0.0001619188678762f,
+            +0.0000000000000000f,
+            -0.0002147469792725f,
+            +0.0000000000000000f,
+            +0.0002706758482419f,
+            -0.0000000000000000f,
+            -0.0003298124212250f,
+            -0.0000000000000000f,
+            +0.0003922688768909f,
+            -0.0000000000000000f,
+            -0.0004581632155363f,
+            +0.0000000000000000f,
+            +0.0005276199213054f,
+            +0.0000000000000000f,
+            -0.0006007707069290f,
+            +0.0000000000000000f,
+            +0.0006777553522148f,
+            +0.0000000000000000f,
+            -0.0007587226493161f,
+            +0.0000000000000000f,
+            +0.0008438314699503f,
+            -0.0000000000000000f,
+            -0.0009332519722777f,
+            -0.0000000000000000f,
+            +0.0010271669681913f,
+            -0.0000000000000000f,
+            -0.0011257734754034f,
+            +0.0000000000000000f,
+            +0.0012292844830899f,
+            -0.0000000000000000f,
+            -0.0013379309651327f,
+            +0.0000000000000000f,
+            +0.0014519641813995f,
+            +0.0000000000000000f,
+            -0.0015716583152853f,
+            +0.0000000000000000f,
+            +0.0016973135052600f,
+            -0.0000000000000000f,
+            -0.0018292593398518f,
+            +0.0000000000000000f,
+            +0.0019678588999155f,
+            -0.0000000000000000f,
+            -0.0021135134499203f,
+            +0.0000000000000000f,
+            +0.0022666679022780f,
+            -0.0000000000000000f,
+            -0.0024278172066814f,
+            +0.0000000000000000f,
+            +0.0025975138516540f,
+            +0.0000000000000000f,
+            -0.0027763767102168f,
+            +0.0000000000000000f,
+            +0.0029651015186583f,
+            -0.0000000000000000f,
+            -0.0031644733507854f,
+            +0.0000000000000000f,
+            +0.0033753815450867f,
+            -0.0000000000000000f,
+            -0.0035988376662831f,
+            -0.0000000000000000f,
+            +0.0038359972459722f,
+            -0.0000000000000000f,
+            -0.0040881862637107f,
+            +0.0000000000000000f,
+            +0.0043569336201071f,
+            +0.0000000000000000f,
+            -0.0046440112461513f,
+            -0.0000000000000000f,
+            +0.0049514840299049f,
+            -0.0000000000000000f,
+            -0.0052817724842005f,
+            +0.0000000000000000f,
+            +0.0056377321185259f,
+            -0.0000000000000000f,
+            -0.0060227549529536f,
+            -0.0000000000000000f,
+            +0.0064409007340869f,
+            -0.0000000000000000f,
+            -0.0068970685145374f,
+            +0.0000000000000000f,
+            +0.0073972238678524f,
+            -0.0000000000000000f,
+            -0.0079487039922902f,
+            -0.0000000000000000f,
+            +0.0085606337463876f,
+            -0.0000000000000000f,
+            -0.0092445027137219f,
+            +0.0000000000000000f,
+            +0.0100149810342524f,
+            -0.0000000000000000f,
+            -0.0108910978062588f,
+            -0.0000000000000000f,
+            +0.0118979850975165f,
+            -0.0000000000000000f,
+            -0.0130695318486643f,
+            +0.0000000000000000f,
+            +0.0144525542626080f,
+            -0.0000000000000000f,
+            -0.0161136000897284f,
+            +0.0000000000000000f,
+            +0.0181505558985317f,
+            -0.0000000000000000f,
+            -0.0207135401170685f,
+            +0.0000000000000000f,
+            +0.0240450819048174f,
+            -0.0000000000000000f,
+            -0.0285641314562110f,
+            +0.0000000000000000f,
+            +0.0350620839614781f,
+            -0.0000000000000000f,
+            -0.0452348445379197f,
+            +0.0000000000000000f,
+            +0.0634918488470111f,
+            -0.0000000000000000f,
+            -0.1060011659286554f,
+            +0.0000000000000000f,
+            +0.3182758342865887f,
+            +0.5000000000000000f,
+            +0.3182758342865887f,
+            +0.0000000000000000f,
+            -0.1060011659286554f,
+            -0.0000000000000000f,
+            +0.0634918488470111f,
+            +0.0000000000000000f,
+            -0.0452348445379197f,
+            -0.0000000000000000f,
+            +0.0350620839614781f,
+            +0.0000000000000000f,
+            -0.0285641314562110f,
+            -0.0000000000000000f,
+            +0.0240450819048174f,
+            +0.0000000000000000f,
+            -0.0207135401170685f,
+            -0.0000000000000000f,
+            +0.0181505558985317f,
+            +0.0000000000000000f,
+            -0.0161136000897284f,
+            -0.0000000000000000f,
+            +0.0144525542626080f,
+            +0.0000000000000000f,
+            -0.0130695318486643f,
+            -0.0000000000000000f,
+            +0.0118979850975165f,
+            -0.0000000000000000f,
+            -0.0108910978062588f,
+            -0.0000000000000000f,
+            +0.0100149810342524f,
+            +0.0000000000000000f,
+            -0.0092445027137219f,
+            -0.0000000000000000f,
+            +0.0085606337463876f,
+            -0.0000000000000000f,
+            -0.0079487039922902f,
+            -0.0000000000000000f,
+            +0.0073972238678524f,
+            +0.0000000000000000f,
+            -0.0068970685145374f,
+            -0.0000000000000000f,
+            +0.0064409007340869f,
+            -0.0000000000000000f,
+            -0.0060227549529536f,
+            -0.0000000000000000f,
+            +0.0056377321185259f,
+            +0.0000000000000000f,
+            -0.0052817724842005f,
+            -0.0000000000000000f,
+            +0.0049514840299049f,
+            -0.0000000000000000f,
+            -0.0046440112461513f,
+            +0.0000000000000000f,
+            +0.0043569336201071f,
+            +0.0000000000000000f,
+            -0.0040881862637107f,
+            -0.0000000000000000f,
+            +0.0038359972459722f,
+            -0.0000000000000000f,
+            -0.0035988376662831f,
+            -0.0000000000000000f,
+            +0.0033753815450867f,
+            +0.0000000000000000f,
+            -0.0031644733507854f,
+            -0.0000000000000000f,
+            +0.0029651015186583f,
+            +0.0000000000000000f,
+            -0.0027763767102168f,
+            +0.0000000000000000f,
+            +0.0025975138516540f,
+            +0.0000000000000000f,
+            -0.0024278172066814f,
+            -0.0000000000000000f,
+            +0.0022666679022780f,
+            +0.0000000000000000f,
+            -0.0021135134499203f,
+            -0.0000000000000000f,
+            +0.0019678588999155f,
+            +0.0000000000000000f,
+            -0.0018292593398518f,
+            -0.0000000000000000f,
+            +0.0016973135052600f,
+            +0.0000000000000000f,
+            -0.0015716583152853f,
+            +0.0000000000000000f,
+            +0.0014519641813995f,
+            +0.0000000000000000f,
+            -0.0013379309651327f,
+            -0.0000000000000000f,
+            +0.0012292844830899f,
+            +0.0000000000000000f,
+            -0.0011257734754034f,
+            -0.0000000000000000f,
+            +0.0010271669681913f,
+            -0.0000000000000000f,
+            -0.0009332519722777f,
+            -0.0000000000000000f,
+            +0.0008438314699503f,
+            +0.0000000000000000f,
+            -0.0007587226493161f,
+            +0.0000000000000000f,
+            +0.0006777553522148f,
+            +0.0000000000000000f,
+            -0.0006007707069290f,
+            +0.0000000000000000f,
+            +0.0005276199213054f,
+            +0.0000000000000000f,
+            -0.0004581632155363f,
+            -0.0000000000000000f,
+            +0.0003922688768909f,
+            -0.0000000000000000f,
+            -0.0003298124212250f,
+            -0.0000000000000000f,
+            +0.0002706758482419f,
+            +0.0000000000000000f,
+            -0.0002147469792725f,
+            +0.0000000000000000f,
+            +0.0001619188678762f,
+            +0.0000000000000000f,
+            -0.0001120892748518f,
+            -0.0000000000000000f,
+            +0.0000651602003523f,
+            +0.0000000000000000f,
+            -0.0000210374667385f
+        };
+
+        static const float lanczos_dec_3x2[] =
+        {
+            -0.0105296062770927f,
+            -0.0284965828994075f,
+            +0.0000000000000000f,
+            +0.1139863315976300f,
+            +0.2632401569273185f,
+            +0.3333333333333333f,
+            +0.2632401569273185f,
+            +0.1139863315976300f,
+            +0.0000000000000000f,
+            -0.0284965828994075f,
+            -0.0105296062770927f
+        };
+
+        static const float lanczos_dec_3x3[] =
+        {
+            +0.0042203173219384f,
+            +0.0103596435456013f,
+            -0.0000000000000000f,
+            -0.0311089136935408f,
+            -0.0486076776461575f,
+            +0.0000000000000000f,
+            +0.1269056334336154f,
+            +0.2701003086040590f,
+            +0.3333333333333333f,
+            +0.2701003086040590f,
+            +0.1269056334336154f,
+            +0.0000000000000000f,
+            -0.0486076776461575f,
+            -0.0311089136935408f,
+            -0.0000000000000000f,
+            +0.0103596435456013f,
+            +0.0042203173219384f
+        };
+
+        static const float lanczos_dec_3x4[] =
+        {
+            -0.0022522831751592f,
+            -0.0052648031385464f,
+            +0.0000000000000000f,
+            +0.0142482914497038f,
+            +0.0207567727422436f,
+            -0.0000000000000000f,
+            -0.0406832745747975f,
+            -0.0569931657988150f,
+            +0.0000000000000000f,
+            +0.1316200784636593f,
+            +0.2725262641942652f,
+            +0.3333333333333333f,
+            +0.2725262641942652f,
+            +0.1316200784636593f,
+            +0.0000000000000000f,
+            -0.0569931657988150f,
+            -0.0406832745747975f,
+            -0.0000000000000000f,
+            +0.0207567727422436f,
+            +0.0142482914497038f,
+            +0.0000000000000000f,
+            -0.0052648031385464f,
+            -0.0022522831751592f
+        };
+
+        static const float lanczos_dec_3x16bit[] =
+        {
+            -0.0003271829854215f,
+            -0.0006980957412996f,
+            +0.0000000000000000f,
+            +0.0015838671264995f,
+            +0.0021059212554185f,
+            -0.0000000000000000f,
+            -0.0033297173123398f,
+            -0.0040418504231073f,
+            +0.0000000000000000f,
+            +0.0056993165798815f,
+            +0.0066615470811656f,
+            -0.0000000000000000f,
+            -0.0089096099624653f,
+            -0.0102264882736093f,
+            +0.0000000000000000f,
+            +0.0133570459083877f,
+            +0.0152359602316714f,
+            -0.0000000000000000f,
+            -0.0198745330272791f,
+            -0.0227972663195260f,
+            +0.0000000000000000f,
+            +0.0305664938247491f,
+            +0.0359473562903628f,
+            -0.0000000000000000f,
+            -0.0526480313854637f,
+            -0.0669183860946027f,
+            +0.0000000000000000f,
+            +0.1368267652947278f,
+            +0.2751608907394855f,
+            +0.3333333333333333f,
+            +0.2751608907394855f,
+            +0.1368267652947278f,
+            +0.0000000000000000f,
+            -0.0669183860946027f,
+            -0.0526480313854637f,
+            -0.0000000000000000f,
+            +0.0359473562903628f,
+            +0.0305664938247491f,
+            +0.0000000000000000f,
+            -0.0227972663195260f,
+            -0.0198745330272791f,
+            -0.0000000000000000f,
+            +0.0152359602316714f,
+            +0.0133570459083877f,
+            +0.0000000000000000f,
+            -0.0102264882736093f,
+            -0.0089096099624653f,
+            -0.0000000000000000f,
+            +0.0066615470811656f,
+            +0.0056993165798815f,
+            +0.0000000000000000f,
+            -0.0040418504231073f,
+            -0.0033297173123398f,
+            -0.0000000000000000f,
+            +0.0021059212554185f,
+            +0.0015838671264995f,
+            +0.0000000000000000f,
+            -0.0006980957412996f,
+            -0.0003271829854215f
+        };
+
+        static const float lanczos_dec_3x24bit[] =
+        {
+            -0.0000080540932329f,
+            -0.0000162814285618f,
+            +0.0000000000000000f,
+            +0.0000332634686071f,
+            +0.0000420220520574f,
+            -0.0000000000000000f,
+            -0.0000600842225109f,
+            -0.0000693918356359f,
+            +0.0000000000000000f,
+            +0.0000885703821783f,
+            +0.0000984455049933f,
+            +0.0000000000000000f,
+            -0.0001187781440719f,
+            -0.0001292400308257f,
+            +0.0000000000000000f,
+            +0.0001507661101647f,
+            +0.0001618348743163f,
+            -0.0000000000000000f,
+            -0.0001845955529493f,
+            -0.0001962922624950f,
+            -0.0000000000000000f,
+            +0.0002203307127685f,
+            +0.0002326774972303f,
+            -0.0000000000000000f,
+            -0.0002580391315887f,
+            -0.0002710593021698f,
+            +0.0000000000000000f,
+            +0.0002977920279577f,
+            +0.0003115102126030f,
+            +0.0000000000000000f,
+            -0.0003396647186159f,
+            -0.0003541070139814f,
+            +0.0000000000000000f,
+            +0.0003837370930846f,
+            +0.0003989312357428f,
+            +0.0000000000000000f,
+            -0.0004300941485710f,
+            -0.0004460697081522f,
+            +0.0000000000000000f,
+            +0.0004788265937247f,
+            +0.0004956151911460f,
+            -0.0000000000000000f,
+            -0.0005300315312101f,
+            -0.0005476670856754f,
+            -0.0000000000000000f,
+            +0.0005838132307603f,
+            +0.0006023322398533f,
+            -0.0000000000000000f,
+            -0.0006402840064126f,
+            -0.0006597258643731f,
+            +0.0000000000000000f,
+            +0.0006995652140797f,
+            +0.0007199725742732f,
+            -0.0000000000000000f,
+            -0.0007617883885577f,
+            -0.0007832075772679f,
+            +0.0000000000000000f,
+            +0.0008270965426533f,
+            +0.0008495780326797f,
+            +0.0000000000000000f,
+            -0.0008956456554596f,
+            -0.0009192446096583f,
+            +0.0000000000000000f,
+            +0.0009676063821236f,
+            +0.0009923832790519f,
+            -0.0000000000000000f,
+            -0.0010431660239671f,
+            -0.0010691873802860f,
+            +0.0000000000000000f,
+            +0.0011225308058566f,
+            +0.0011498700132290f,
+            -0.0000000000000000f,
+            -0.0012059285176794f,
+            -0.0012346668157304f,
+            +0.0000000000000000f,
+            +0.0012936115891774f,
+            +0.0013238392008769f,
+            -0.0000000000000000f,
+            -0.0013858606829287f,
+            -0.0014176781447743f,
+            +0.0000000000000000f,
+            +0.0014829889098234f,
+            +0.0015165086368176f,
+            +0.0000000000000000f,
+            -0.0015853467961803f,
+            -0.0016206949312850f,
+            +0.0000000000000000f,
+            +0.0016933281632730f,
+            +0.0017306467734357f,
+            -0.0000000000000000f,
+            -0.0018073771206502f,
+            -0.0018468268175147f,
+            +0.0000000000000000f,
+            +0.0019279964271691f,
+            +0.0019697595113957f,
+            -0.0000000000000000f,
+            -0.0020557575421357f,
+            -0.0021000417975302f,
+            -0.0000000000000000f,
+            +0.0021913127789143f,
+            +0.0022383560785930f,
+            -0.0000000000000000f,
+            -0.0023354100926112f,
+            -0.0023854860274612f,
+            +0.0000000000000000f,
+            +0.0024889111929193f,
+            +0.0025423359972521f,
+            +0.0000000000000000f,
+            -0.0026528138886184f,
+            -0.0027099550258045f,
+            -0.0000000000000000f,
+            +0.0028282798642297f,
+            +0.0028895667559106f,
+            -0.0000000000000000f,
+            -0.0030166694951307f,
+            -0.0030826070456340f,
+            +0.0000000000000000f,
+            +0.0032195858743733f,
+            +0.0032907716786361f,
+            -0.0000000000000000f,
+            -0.0034389310268872f,
+            -0.0035160774881661f,
+            -0.0000000000000000f,
+            +0.0036769784386332f,
+            +0.0037609415121085f,
+            -0.0000000000000000f,
+            -0.0039364677072943f,
+            -0.0040282847071437f,
+            +0.0000000000000000f,
+            +0.0042207296096389f,
+            +0.0043216695986904f,
+            -0.0000000000000000f,
+            -0.0045338536369952f,
+            -0.0046454855710114f,
+            -0.0000000000000000f,
+            +0.0048809158349779f,
+            +0.0050052022142265f,
+            -0.0000000000000000f,
+            -0.0052682938914466f,
+            -0.0054077217972123f,
+            +0.0000000000000000f,
+            +0.0057041111134084f,
+            +0.0058618792762120f,
+            -0.0000000000000000f,
+            -0.0061988753086522f,
+            -0.0063791672948966f,
+            -0.0000000000000000f,
+            +0.0067664202821088f,
+            +0.0069748138732102f,
+            -0.0000000000000000f,
+            -0.0074253315152413f,
+            -0.0076694306216494f,
+            +0.0000000000000000f,
+            +0.0082011737730301f,
+            +0.0084916179653974f,
+            -0.0000000000000000f,
+            -0.0091301013441746f,
+            -0.0094822451351238f,
+            +0.0000000000000000f,
+            +0.0102649676561346f,
+            +0.0107018117278566f,
+            -0.0000000000000000f,
+            -0.0116862163022887f,
+            -0.0122438323359957f,
+            +0.0000000000000000f,
+            +0.0135225739632833f,
+            +0.0142609013191230f,
+            -0.0000000000000000f,
+            -0.0159936534441083f,
+            -0.0170200804053124f,
+            +0.0000000000000000f,
+            +0.0195073319997339f,
+            +0.0210349767688083f,
+            -0.0000000000000000f,
+            -0.0249164759538912f,
+            -0.0274355615835539f,
+            +0.0000000000000000f,
+            +0.0343532956294866f,
+            +0.0392889504790212f,
+            -0.0000000000000000f,
+            -0.0550673778981512f,
+            -0.0688636958838386f,
+            +0.0000000000000000f,
+            +0.1378060113470901f,
+            +0.2756513408958580f,
+            +0.3333333333333333f,
+            +0.2756513408958580f,
+            +0.1378060113470901f,
+            +0.0000000000000000f,
+            -0.0688636958838386f,
+            -0.0550673778981512f,
+            -0.0000000000000000f,
+            +0.0392889504790212f,
+            +0.0343532956294866f,
+            +0.0000000000000000f,
+            -0.0274355615835539f,
+            -0.0249164759538912f,
+            -0.0000000000000000f,
+            +0.0210349767688083f,
+            +0.0195073319997339f,
+            +0.0000000000000000f,
+            -0.0170200804053124f,
+            -0.0159936534441083f,
+            -0.0000000000000000f,
+            +0.0142609013191230f,
+            +0.0135225739632833f,
+            +0.0000000000000000f,
+            -0.0122438323359957f,
+            -0.0116862163022887f,
+            -0.0000000000000000f,
+            +0.0107018117278566f,
+            +0.0102649676561346f,
+            +0.0000000000000000f,
+            -0.0094822451351238f,
+            -0.0091301013441746f,
+            -0.0000000000000000f,
+            +0.0084916179653974f,
+            +0.0082011737730301f,
+            +0.0000000000000000f,
+            -0.0076694306216494f,
+            -0.0074253315152413f,
+            -0.0000000000000000f,
+            +0.0069748138732102f,
+            +0.0067664202821088f,
+            -0.0000000000000000f,
+            -0.0063791672948966f,
+            -0.0061988753086522f,
+            -0.0000000000000000f,
+            +0.0058618792762120f,
+            +0.0057041111134084f,
+            +0.0000000000000000f,
+            -0.0054077217972123f,
+            -0.0052682938914466f,
+            -0.0000000000000000f,
+            +0.0050052022142265f,
+            +0.0048809158349779f,
+            -0.0000000000000000f,
+            -0.0046454855710114f,
+            -0.0045338536369952f,
+            -0.0000000000000000f,
+            +0.0043216695986904f,
+            +0.0042207296096389f,
+            +0.0000000000000000f,
+            -0.0040282847071437f,
+            -0.0039364677072943f,
+            -0.0000000000000000f,
+            +0.0037609415121085f,
+            +0.0036769784386332f,
+            -0.0000000000000000f,
+            -0.0035160774881661f,
+            -0.0034389310268872f,
+            -0.0000000000000000f,
+            +0.0032907716786361f,
+            +0.0032195858743733f,
+            +0.0000000000000000f,
+            -0.0030826070456340f,
+            -0.0030166694951307f,
+            -0.0000000000000000f,
+            +0.0028895667559106f,
+            +0.0028282798642297f,
+            -0.0000000000000000f,
+            -0.0027099550258045f,
+            -0.0026528138886184f,
+            +0.0000000000000000f,
+            +0.0025423359972521f,
+            +0.0024889111929193f,
+            +0.0000000000000000f,
+            -0.0023854860274612f,
+            -0.0023354100926112f,
+            -0.0000000000000000f,
+            +0.0022383560785930f,
+            +0.0021913127789143f,
+            -0.0000000000000000f,
+            -0.0021000417975302f,
+            -0.0020557575421357f,
+            -0.0000000000000000f,
+            +0.0019697595113957f,
+            +0.0019279964271691f,
+            +0.0000000000000000f,
+            -0.0018468268175147f,
+            -0.0018073771206502f,
+            -0.0000000000000000f,
+            +0.0017306467734357f,
+            +0.0016933281632730f,
+            +0.0000000000000000f,
+            -0.0016206949312850f,
+            -0.0015853467961803f,
+            +0.0000000000000000f,
+            +0.0015165086368176f,
+            +0.0014829889098234f,
+            +0.0000000000000000f,
+            -0.0014176781447743f,
+            -0.0013858606829287f,
+            -0.0000000000000000f,
+            +0.0013238392008769f,
+            +0.0012936115891774f,
+            +0.0000000000000000f,
+            -0.0012346668157304f,
+            -0.0012059285176794f,
+            -0.0000000000000000f,
+            +0.0011498700132290f,
+            +0.0011225308058566f,
+            +0.0000000000000000f,
+            -0.0010691873802860f,
+            -0.0010431660239671f,
+            -0.0000000000000000f,
+            +0.0009923832790519f,
+            +0.0009676063821236f,
+            +0.0000000000000000f,
+            -0.0009192446096583f,
+            -0.0008956456554596f,
+            +0.0000000000000000f,
+            +0.0008495780326797f,
+            +0.0008270965426533f,
+            +0.0000000000000000f,
+            -0.0007832075772679f,
+            -0.0007617883885577f,
+            -0.0000000000000000f,
+            +0.0007199725742732f,
+            +0.0006995652140797f,
+            +0.0000000000000000f,
+            -0.0006597258643731f,
+            -0.0006402840064126f,
+            -0.0000000000000000f,
+            +0.0006023322398533f,
+            +0.0005838132307603f,
+            -0.0000000000000000f,
+            -0.0005476670856754f,
+            -0.0005300315312101f,
+            -0.0000000000000000f,
+            +0.0004956151911460f,
+            +0.0004788265937247f,
+            +0.0000000000000000f,
+            -0.0004460697081522f,
+            -0.0004300941485710f,
+            +0.0000000000000000f,
+            +0.0003989312357428f,
+            +0.0003837370930846f,
+            +0.0000000000000000f,
+            -0.0003541070139814f,
+            -0.0003396647186159f,
+            +0.0000000000000000f,
+            +0.0003115102126030f,
+            +0.0002977920279577f,
+            +0.0000000000000000f,
+            -0.0002710593021698f,
+            -0.0002580391315887f,
+            -0.0000000000000000f,
+            +0.0002326774972303f,
+            +0.0002203307127685f,
+            -0.0000000000000000f,
+            -0.0001962922624950f,
+            -0.0001845955529493f,
+            -0.0000000000000000f,
+            +0.0001618348743163f,
+            +0.0001507661101647f,
+            +0.0000000000000000f,
+            -0.0001292400308257f,
+            -0.0001187781440719f,
+            +0.0000000000000000f,
+            +0.0000984455049933f,
+            +0.0000885703821783f,
+            +0.0000000000000000f,
+            -0.0000693918356359f,
+            -0.0000600842225109f,
+            -0.0000000000000000f,
+            +0.0000420220520574f,
+            +0.0000332634686071f,
+            +0.0000000000000000f,
+            -0.0000162814285618f,
+            -0.0000080540932329f
+        };
+
+        static const float lanczos_dec_4x2[] =
+        {
+            -0.0044762962815861f,
+            -0.0159210880069654f,
+            -0.0211812009767227f,
+            +0.0000000000000000f,
+            +0.0588366693797852f,
+            +0.1432897920626891f,
+            +0.2193385177977194f,
+            +0.2500000000000000f,
+            +0.2193385177977194f,
+            +0.1432897920626891f,
+            +0.0588366693797852f,
+            +0.0000000000000000f,
+            -0.0211812009767227f,
+            -0.0159210880069654f,
+            -0.0044762962815861f
+        };
+
+        static const float lanczos_dec_4x3[] =
+        {
+            +0.0018389815117986f,
+            +0.0060792710185403f,
+            +0.0075052728623954f,
+            -0.0000000000000000f,
+            -0.0169478339751357f,
+            -0.0337737278807793f,
+            -0.0332177545912660f,
+            +0.0000000000000000f,
+            +0.0675474557615585f,
+            +0.1519817754635066f,
+            +0.2225167629276237f,
+            +0.2500000000000000f,
+            +0.2225167629276237f,
+            +0.1519817754635066f,
+            +0.0675474557615585f,
+            +0.0000000000000000f,
+            -0.0332177545912660f,
+            -0.0337737278807793f,
+            -0.0169478339751357f,
+            -0.0000000000000000f,
+            +0.0075052728623954f,
+            +0.0060792710185403f,
+            +0.0018389815117986f
+        };
+
+        static const float lanczos_dec_4x4[] =
+        {
+            -0.0009939360595603f,
+            -0.0031652194553097f,
+            -0.0037684044102059f,
+            +0.0000000000000000f,
+            +0.0078770980398861f,
+            +0.0149773708443157f,
+            +0.0138801500135432f,
+            -0.0000000000000000f,
+            -0.0229447377774898f,
+            -0.0416038079008770f,
+            -0.0381251545130485f,
+            +0.0000000000000000f,
+            +0.0707622605916431f,
+            +0.1550957533101736f,
+            +0.2236356134010725f,
+            +0.2500000000000000f,
+            +0.2236356134010725f,
+            +0.1550957533101736f,
+            +0.0707622605916431f,
+            +0.0000000000000000f,
+            -0.0381251545130485f,
+            -0.0416038079008770f,
+            -0.0229447377774898f,
+            -0.0000000000000000f,
+            +0.0138801500135432f,
+            +0.0149773708443157f,
+            +0.0078770980398861f,
+            +0.0000000000000000f,
+            -0.0037684044102059f,
+            -0.0031652194553097f,
+            -0.0009939360595603f
+        };
+
+        static const float lanczos_dec_4x16bit[] =
+        {
+            -0.0001478288956248f,
+            -0.0004390616387904f,
+            -0.0004886827997796f,
+            +0.0000000000000000f,
+            +0.0008952592563172f,
+            +0.0015916558752937f,
+            +0.0013749992780753f,
+            -0.0000000000000000f,
+            -0.0019367174984548f,
+            -0.0031842176013931f,
+            -0.0025911632031880f,
+            +0.0000000000000000f,
+            +0.0033518417518408f,
+            +0.0053418837670894f,
+            +0.0042362401953445f,
+            -0.0000000000000000f,
+            -0.0052677007070623f,
+            -0.0082705579949451f,
+            -0.0064783708596059f,
+            +0.0000000000000000f,
+            +0.0079140209115962f,
+            +0.0123547841652884f,
+            +0.0096422618478752f,
+            -0.0000000000000000f,
+            -0.0117673338759570f,
+            -0.0184240480946553f,
+            -0.0144585363141532f,
+            +0.0000000000000000f,
+            +0.0180096549907532f,
+            +0.0286579584125378f,
+            +0.0229775989631484f,
+            -0.0000000000000000f,
+            -0.0305586574249803f,
+            -0.0511098386622081f,
+            -0.0438677035595439f,
+            +0.0000000000000000f,
+            +0.0743340836553588f,
+            +0.1585012516033210f,
+            +0.2248477502453904f,
+            +0.2500000000000000f,
+            +0.2248477502453904f,
+            +0.1585012516033210f,
+            +0.0743340836553588f,
+            +0.0000000000000000f,
+            -0.0438677035595439f,
+            -0.0511098386622081f,
+            -0.0305586574249803f,
+            -0.0000000000000000f,
+            +0.0229775989631484f,
+            +0.0286579584125378f,
+            +0.0180096549907532f,
+            +0.0000000000000000f,
+            -0.0144585363141532f,
+            -0.0184240480946553f,
+            -0.0117673338759570f,
+            -0.0000000000000000f,
+            +0.0096422618478752f,
+            +0.0123547841652884f,
+            +0.0079140209115962f,
+            +0.0000000000000000f,
+            -0.0064783708596059f,
+            -0.0082705579949451f,
+            -0.0052677007070623f,
+            -0.0000000000000000f,
+            +0.0042362401953445f,
+            +0.0053418837670894f,
+            +0.0033518417518408f,
+            +0.0000000000000000f,
+            -0.0025911632031880f,
+            -0.0031842176013931f,
+            -0.0019367174984548f,
+            -0.0000000000000000f,
+            +0.0013749992780753f,
+            +0.0015916558752937f,
+            +0.0008952592563172f,
+            +0.0000000000000000f,
+            -0.0004886827997796f,
+            -0.0004390616387904f,
+            -0.0001478288956248f
+        };
+
+        static const float lanczos_dec_4x24bit[] =
+        {
+            -0.0000036891779789f,
+            -0.0000105187333693f,
+            -0.0000112465591825f,
+            +0.0000000000000000f,
+            +0.0000190459292154f,
+            +0.0000325801001761f,
+            +0.0000270912963285f,
+            -0.0000000000000000f,
+            -0.0000353867429933f,
+            -0.0000560446374259f,
+            -0.0000439364297744f,
+            +0.0000000000000000f,
+            +0.0000527445994310f,
+            +0.0000809594339381f,
+            +0.0000618155812603f,
+            +0.0000000000000000f,
+            -0.0000711537956968f,
+            -0.0001073734896363f,
+            -0.0000807637591824f,
+            +0.0000000000000000f,
+            +0.0000906500893259f,
+            +0.0001353379241210f,
+            +0.0001008175103658f,
+            -0.0000000000000000f,
+            -0.0001112708589588f,
+            -0.0001649062106125f,
+            -0.0001220150903115f,
+            -0.0000000000000000f,
+            +0.0001330552846776f,
+            +0.0001961344384454f,
+            +0.0001443966542447f,
+            -0.0000000000000000f,
+            -0.0001560445504340f,
+            -0.0002290816077682f,
+            -0.0001680044716402f,
+            +0.0000000000000000f,
+            +0.0001802820714408f,
+            +0.0002638099606527f,
+            +0.0001928831673046f,
+            +0.0000000000000000f,
+            -0.0002058137498337f,
+            -0.0003003853534645f,
+            -0.0002190799925734f,
+            +0.0000000000000000f,
+            +0.0002326882624306f,
+            +0.0003388776761074f,
+            +0.0002466451307401f,
+            +0.0000000000000000f,
+            -0.0002609573850256f,
+            -0.0003793613246581f,
+            -0.0002756320415031f,
+            +0.0000000000000000f,
+            +0.0002906763583795f,
+            +0.0004219157349752f,
+            +0.0003060978500032f,
+            -0.0000000000000000f,
+            -0.0003219043019291f,
+            -0.0004666259861389f,
+            -0.0003381037869638f,
+            -0.0000000000000000f,
+            +0.0003547046822646f,
+            +0.0005135834840957f,
+            +0.0003717156875710f,
+            -0.0000000000000000f,
+            -0.0003891458446535f,
+            -0.0005628867377017f,
+            -0.0004070045580749f,
+            +0.0000000000000000f,
+            +0.0004253016173642f,
+            +0.0006146422415450f,
+            +0.0004440472207147f,
+            -0.0000000000000000f,
+            -0.0004632520003266f,
+            -0.0006689654825664f,
+            -0.0004829270495277f,
+            +0.0000000000000000f,
+            +0.0005030839518154f,
+            +0.0007259820906998f,
+            +0.0005237348119781f,
+            +0.0000000000000000f,
+            -0.0005448922894707f,
+            -0.0007858291576426f,
+            -0.0005665696342329f,
+            +0.0000000000000000f,
+            +0.0005887807251604f,
+            +0.0008486567526300f,
+            +0.0006115401114566f,
+            -0.0000000000000000f,
+            -0.0006348630571202f,
+            -0.0009146296699259f,
+            -0.0006587655888443f,
+            +0.0000000000000000f,
+            +0.0006832645476362f,
+            +0.0009839294499578f,
+            +0.0007083776444956f,
+            -0.0000000000000000f,
+            -0.0007341235205273f,
+            -0.0010567567249601f,
+            -0.0007605218119037f,
+            +0.0000000000000000f,
+            +0.0007875932201370f,
+            +0.0011333339511390f,
+            +0.0008153595881734f,
+            -0.0000000000000000f,
+            -0.0008438439828777f,
+            -0.0012139086033407f,
+            -0.0008730707845411f,
+            +0.0000000000000000f,
+            +0.0009030657841190f,
+            +0.0012987569258270f,
+            +0.0009338562889868f,
+            +0.0000000000000000f,
+            -0.0009654712380955f,
+            -0.0013881883551084f,
+            -0.0009979413275157f,
+            +0.0000000000000000f,
+            +0.0010312991474796f,
+            +0.0014825507593291f,
+            +0.0010655793321640f,
+            -0.0000000000000000f,
+            -0.0011008187236223f,
+            -0.0015822366753927f,
+            -0.0011370565514449f,
+            +0.0000000000000000f,
+            +0.0011743346299377f,
+            +0.0016876907725433f,
+            +0.0012126975748450f,
+            -0.0000000000000000f,
+            -0.0012521930419138f,
+            -0.0017994188331415f,
+            -0.0012928719899114f,
+            -0.0000000000000000f,
+            +0.0013347889710719f,
+            +0.0019179986229861f,
+            +0.0013780024523682f,
+            -0.0000000000000000f,
+            -0.0014225751714953f,
+            -0.0020440931318553f,
+            -0.0014685745320229f,
+            +0.0000000000000000f,
+            +0.0015160730428388f,
+            +0.0021784668100535f,
+            +0.0015651488077883f,
+            +0.0000000000000000f,
+            -0.0016158860723297f,
+            -0.0023220056230756f,
+            -0.0016683758351084f,
+            -0.0000000000000000f,
+            +0.0017227165336266f,
+            +0.0024757420149524f,
+            +0.0017790148147033f,
+            -0.0000000000000000f,
+            -0.0018373864022157f,
+            -0.0026408862421002f,
+            -0.0018979570767672f,
+            +0.0000000000000000f,
+            +0.0019608637844975f,
+            +0.0028188660592630f,
+            +0.0020262558953485f,
+            -0.0000000000000000f,
+            -0.0020942966348351f,
+            -0.0030113774764768f,
+            -0.0021651647178943f,
+            -0.0000000000000000f,
+            +0.0022390562188985f,
+            +0.0032204503670435f,
+            +0.0023161867186477f,
+            -0.0000000000000000f,
+            -0.0023967937774245f,
+            -0.0034485342572687f,
+            -0.0024811397933943f,
+            +0.0000000000000000f,
+            +0.0025695153182784f,
+            +0.0036986119339262f,
+            +0.0026622429179962f,
+            -0.0000000000000000f,
+            -0.0027596816857311f,
+            -0.0039743519961451f,
+            -0.0028622325397958f,
+            -0.0000000000000000f,
+            +0.0029703444702810f,
+            +0.0042803168731938f,
+            +0.0030845219388401f,
+            -0.0000000000000000f,
+            -0.0032053336878600f,
+            -0.0046222513568609f,
+            -0.0033334232824810f,
+            +0.0000000000000000f,
+            +0.0034695217966485f,
+            +0.0050074905171262f,
+            +0.0036144631697985f,
+            -0.0000000000000000f,
+            -0.0037692029139736f,
+            -0.0054455489031294f,
+            -0.0039348410563834f,
+            -0.0000000000000000f,
+            +0.0041126504800829f,
+            +0.0059489925487582f,
+            +0.0043041122050811f,
+            -0.0000000000000000f,
+            -0.0045109596772435f,
+            -0.0065347659243322f,
+            -0.0047352348674090f,
+            +0.0000000000000000f,
+            +0.0049793600259051f,
+            +0.0072262771313040f,
+            +0.0052462304382059f,
+            -0.0000000000000000f,
+            -0.0055393357206007f,
+            -0.0080568000448642f,
+            -0.0058629204547952f,
+            +0.0000000000000000f,
+            +0.0062221998970146f,
+            +0.0090752779492658f,
+            +0.0066236541265476f,
+            -0.0000000000000000f,
+            -0.0070754360579910f,
+            -0.0103567700585343f,
+            -0.0075879482858767f,
+            +0.0000000000000000f,
+            +0.0081746763043950f,
+            +0.0120225409524087f,
+            +0.0088534216722638f,
+            -0.0000000000000000f,
+            -0.0096481785676156f,
+            -0.0142820657281055f,
+            -0.0105920826595747f,
+            +0.0000000000000000f,
+            +0.0117322224246124f,
+            +0.0175310419807391f,
+            +0.0131378466857266f,
+            -0.0000000000000000f,
+            -0.0149151381824141f,
+            -0.0226174222689599f,
+            -0.0172356242815170f,
+            +0.0000000000000000f,
+            +0.0203955811900518f,
+            +0.0317459244235056f,
+            +0.0249546437842106f,
+            -0.0000000000000000f,
+            -0.0321120322868790f,
+            -0.0530005829643277f,
+            -0.0449857229695080f,
+            +0.0000000000000000f,
+            +0.0750083016586542f,
+            +0.1591379171432943f,
+            +0.2250730593125235f,
+            +0.2500000000000000f,
+            +0.2250730593125235f,
+            +0.1591379171432943f,
+            +0.0750083016586542f,
+            +0.0000000000000000f,
+            -0.0449857229695080f,
+            -0.0530005829643277f,
+            -0.0321120322868790f,
+            -0.0000000000000000f,
+            +0.0249546437842106f,
+            +0.0317459244235056f,
+            +0.0203955811900518f,
+            +0.0000000000000000f,
+            -0.0172356242815170f,
+            -0.0226174222689599f,
+            -0.0149151381824141f,
+            -0.0000000000000000f,
+            +0.0131378466857266f,
+            +0.0175310419807391f,
+            +0.0117322224246124f,
+            +0.0000000000000000f,
+            -0.0105920826595747f,
+            -0.0142820657281055f,
+            -0.0096481785676156f,
+            -0.0000000000000000f,
+            +0.0088534216722638f,
+            +0.0120225409524087f,
+            +0.0081746763043950f,
+            +0.0000000000000000f,
+            -0.0075879482858767f,
+            -0.0103567700585343f,
+            -0.0070754360579910f,
+            -0.0000000000000000f,
+            +0.0066236541265476f,
+            +0.0090752779492658f,
+            +0.0062221998970146f,
+            +0.0000000000000000f,
+            -0.0058629204547952f,
+            -0.0080568000448642f,
+            -0.0055393357206007f,
+            -0.0000000000000000f,
+            +0.0052462304382059f,
+            +0.0072262771313040f,
+            +0.0049793600259051f,
+            +0.0000000000000000f,
+            -0.0047352348674090f,
+            -0.0065347659243322f,
+            -0.0045109596772435f,
+            -0.0000000000000000f,
+            +0.0043041122050811f,
+            +0.0059489925487582f,
+            +0.0041126504800829f,
+            -0.0000000000000000f,
+            -0.0039348410563834f,
+            -0.0054455489031294f,
+            -0.0037692029139736f,
+            -0.0000000000000000f,
+            +0.0036144631697985f,
+            +0.0050074905171262f,
+            +0.0034695217966485f,
+            +0.0000000000000000f,
+            -0.0033334232824810f,
+            -0.0046222513568609f,
+            -0.0032053336878600f,
+            -0.0000000000000000f,
+            +0.0030845219388401f,
+            +0.0042803168731938f,
+            +0.0029703444702810f,
+            -0.0000000000000000f,
+            -0.0028622325397958f,
+            -0.0039743519961451f,
+            -0.0027596816857311f,
+            -0.0000000000000000f,
+            +0.0026622429179962f,
+            +0.0036986119339262f,
+            +0.0025695153182784f,
+            +0.0000000000000000f,
+            -0.0024811397933943f,
+            -0.0034485342572687f,
+            -0.0023967937774245f,
+            -0.0000000000000000f,
+            +0.0023161867186477f,
+            +0.0032204503670435f,
+            +0.0022390562188985f,
+            -0.0000000000000000f,
+            -0.0021651647178943f,
+            -0.0030113774764768f,
+            -0.0020942966348351f,
+            -0.0000000000000000f,
+            +0.0020262558953485f,
+            +0.0028188660592630f,
+            +0.0019608637844975f,
+            +0.0000000000000000f,
+            -0.0018979570767672f,
+            -0.0026408862421002f,
+            -0.0018373864022157f,
+            -0.0000000000000000f,
+            +0.0017790148147033f,
+            +0.0024757420149524f,
+            +0.0017227165336266f,
+            -0.0000000000000000f,
+            -0.0016683758351084f,
+            -0.0023220056230756f,
+            -0.0016158860723297f,
+            +0.0000000000000000f,
+            +0.0015651488077883f,
+            +0.0021784668100535f,
+            +0.0015160730428388f,
+            +0.0000000000000000f,
+            -0.0014685745320229f,
+            -0.0020440931318553f,
+            -0.0014225751714953f,
+            -0.0000000000000000f,
+            +0.0013780024523682f,
+            +0.0019179986229861f,
+            +0.0013347889710719f,
+            -0.0000000000000000f,
+            -0.0012928719899114f,
+            -0.0017994188331415f,
+            -0.0012521930419138f,
+            -0.0000000000000000f,
+            +0.0012126975748450f,
+            +0.0016876907725433f,
+            +0.0011743346299377f,
+            +0.0000000000000000f,
+            -0.0011370565514449f,
+            -0.0015822366753927f,
+            -0.0011008187236223f,
+            -0.0000000000000000f,
+            +0.0010655793321640f,
+            +0.0014825507593291f,
+            +0.0010312991474796f,
+            +0.0000000000000000f,
+            -0.0009979413275157f,
+            -0.0013881883551084f,
+            -0.0009654712380955f,
+            +0.0000000000000000f,
+            +0.0009338562889868f,
+            +0.0012987569258270f,
+            +0.0009030657841190f,
+            +0.0000000000000000f,
+            -0.0008730707845411f,
+            -0.0012139086033407f,
+            -0.0008438439828777f,
+            -0.0000000000000000f,
+            +0.0008153595881734f,
+            +0.0011333339511390f,
+            +0.0007875932201370f,
+            +0.0000000000000000f,
+            -0.0007605218119037f,
+            -0.0010567567249601f,
+            -0.0007341235205273f,
+            -0.0000000000000000f,
+            +0.0007083776444956f,
+            +0.0009839294499578f,
+            +0.0006832645476362f,
+            +0.0000000000000000f,
+            -0.0006587655888443f,
+            -0.0009146296699259f,
+            -0.0006348630571202f,
+            -0.0000000000000000f,
+            +0.0006115401114566f,
+            +0.0008486567526300f,
+            +0.0005887807251604f,
+            +0.0000000000000000f,
+            -0.0005665696342329f,
+            -0.0007858291576426f,
+            -0.0005448922894707f,
+            +0.0000000000000000f,
+            +0.0005237348119781f,
+            +0.0007259820906998f,
+            +0.0005030839518154f,
+            +0.0000000000000000f,
+            -0.0004829270495277f,
+            -0.0006689654825664f,
+            -0.0004632520003266f,
+            -0.0000000000000000f,
+            +0.0004440472207147f,
+            +0.0006146422415450f,
+            +0.0004253016173642f,
+            +0.0000000000000000f,
+            -0.0004070045580749f,
+            -0.0005628867377017f,
+            -0.0003891458446535f,
+            -0.0000000000000000f,
+            +0.0003717156875710f,
+            +0.0005135834840957f,
+            +0.0003547046822646f,
+            -0.0000000000000000f,
+            -0.0003381037869638f,
+            -0.0004666259861389f,
+            -0.0003219043019291f,
+            -0.0000000000000000f,
+            +0.0003060978500032f,
+            +0.0004219157349752f,
+            +0.0002906763583795f,
+            +0.0000000000000000f,
+            -0.0002756320415031f,
+            -0.0003793613246581f,
+            -0.0002609573850256f,
+            +0.0000000000000000f,
+            +0.0002466451307401f,
+            +0.0003388776761074f,
+            +0.0002326882624306f,
+            +0.0000000000000000f,
+            -0.0002190799925734f,
+            -0.0003003853534645f,
+            -0.0002058137498337f,
+            +0.0000000000000000f,
+            +0.0001928831673046f,
+            +0.0002638099606527f,
+            +0.0001802820714408f,
+            +0.0000000000000000f,
+            -0.0001680044716402f,
+            -0.0002290816077682f,
+            -0.0001560445504340f,
+            -0.0000000000000000f,
+            +0.0001443966542447f,
+            +0.0001961344384454f,
+            +0.0001330552846776f,
+            -0.0000000000000000f,
+            -0.0001220150903115f,
+            -0.0001649062106125f,
+            -0.0001112708589588f,
+            -0.0000000000000000f,
+            +0.0001008175103658f,
+            +0.0001353379241210f,
+            +0.0000906500893259f,
+            +0.0000000000000000f,
+            -0.0000807637591824f,
+            -0.0001073734896363f,
+            -0.0000711537956968f,
+            +0.0000000000000000f,
+            +0.0000618155812603f,
+            +0.0000809594339381f,
+            +0.0000527445994310f,
+            +0.0000000000000000f,
+            -0.0000439364297744f,
+            -0.0000560446374259f,
+            -0.0000353867429933f,
+            -0.0000000000000000f,
+            +0.0000270912963285f,
+            +0.0000325801001761f,
+            +0.0000190459292154f,
+            +0.0000000000000000f,
+            -0.0000112465591825f,
+            -0.0000105187333693f,
+            -0.0000036891779789f
+        };
+
+        static const float lanczos_dec_6x2[] =
+        {
+            -0.0013003562974694f,
+            -0.0052648031385464f,
+            -0.0106140586713103f,
+            -0.0142482914497037f,
+            -0.0119839283302422f,
+            +0.0000000000000000f,
+            +0.0234884995272748f,
+            +0.0569931657988150f,
+            +0.0955265280417927f,
+            +0.1316200784636593f,
+            +0.1573431119938020f,
+            +0.1666666666666667f,
+            +0.1573431119938020f,
+            +0.1316200784636593f,
+            +0.0955265280417927f,
+            +0.0569931657988150f,
+            +0.0234884995272748f,
+            +0.0000000000000000f,
+            -0.0119839283302422f,
+            -0.0142482914497037f,
+            -0.0106140586713103f,
+            -0.0052648031385464f,
+            -0.0013003562974694f
+        };
+
+        static const float lanczos_dec_6x3[] =
+        {
+            +0.0005479174743493f,
+            +0.0021101586609692f,
+            +0.0040528473456935f,
+            +0.0051798217728006f,
+            +0.0041334246585506f,
+            -0.0000000000000000f,
+            -0.0070817927056363f,
+            -0.0155544568467704f,
+            -0.0225158185871862f,
+            -0.0243038388230788f,
+            -0.0174876921914691f,
+            +0.0000000000000000f,
+            +0.0279419506918021f,
+            +0.0634528167168077f,
+            +0.1013211836423378f,
+            +0.1350501543020295f,
+            +0.1583481500869351f,
+            +0.1666666666666667f,
+            +0.1583481500869351f,
+            +0.1350501543020295f,
+            +0.1013211836423378f,
+            +0.0634528167168077f,
+            +0.0279419506918021f,
+            +0.0000000000000000f,
+            -0.0174876921914691f,
+            -0.0243038388230788f,
+            -0.0225158185871862f,
+            -0.0155544568467704f,
+            -0.0070817927056363f,
+            -0.0000000000000000f,
+            +0.0041334246585506f,
+            +0.0051798217728006f,
+            +0.0040528473456935f,
+            +0.0021101586609692f,
+            +0.0005479174743493f
+        };
+
+        static const float lanczos_dec_6x4[] =
+        {
+            -0.0003000015491583f,
+            -0.0011261415875796f,
+            -0.0021101463035398f,
+            -0.0026324015692732f,
+            -0.0020503189543368f,
+            +0.0000000000000000f,
+            +0.0033377231620032f,
+            +0.0071241457248519f,
+            +0.0099849138962105f,
+            +0.0103783863711218f,
+            +0.0071328544523438f,
+            -0.0000000000000000f,
+            -0.0099624165491413f,
+            -0.0203416372873987f,
+            -0.0277358719339180f,
+            -0.0284965828994075f,
+            -0.0196857549758964f,
+            +0.0000000000000000f,
+            +0.0296066057006230f,
+            +0.0658100392318296f,
+            +0.1033971688734491f,
+            +0.1362631320971326f,
+            +0.1587008195047551f,
+            +0.1666666666666667f,
+            +0.1587008195047551f,
+            +0.1362631320971326f,
+            +0.1033971688734491f,
+            +0.0658100392318296f,
+            +0.0296066057006230f,
+            +0.0000000000000000f,
+            -0.0196857549758964f,
+            -0.0284965828994075f,
+            -0.0277358719339180f,
+            -0.0203416372873987f,
+            -0.0099624165491413f,
+            -0.0000000000000000f,
+            +0.0071328544523438f,
+            +0.0103783863711218f,
+            +0.0099849138962105f,
+            +0.0071241457248519f,
+            +0.0033377231620032f,
+            +0.0000000000000000f,
+            -0.0020503189543368f,
+            -0.0026324015692732f,
+            -0.0021101463035398f,
+            -0.0011261415875796f,
+            -0.0003000015491583f
+        };
+
+        static const float lanczos_dec_6x16bit[] =
+        {
+            -0.0000457001525446f,
+            -0.0001635914927107f,
+            -0.0002927077591936f,
+            -0.0003490478706498f,
+            -0.0002600712594939f,
+            +0.0000000000000000f,
+            +0.0003877920771884f,
+            +0.0007919335632497f,
+            +0.0010611039168624f,
+            +0.0010529606277093f,
+            +0.0006895061018602f,
+            -0.0000000000000000f,
+            -0.0008659595325228f,
+            -0.0016648586561699f,
+            -0.0021228117342621f,
+            -0.0020209252115536f,
+            -0.0012775773176476f,
+            +0.0000000000000000f,
+            +0.0015165097197541f,
+            +0.0028496582899407f,
+            +0.0035612558447263f,
+            +0.0033307735405828f,
+            +0.0020728591783349f,
+            -0.0000000000000000f,
+            -0.0023967856660485f,
+            -0.0044548049812326f,
+            -0.0055137053299634f,
+            -0.0051132441368046f,
+            -0.0031586574343870f,
+            +0.0000000000000000f,
+            +0.0036093576628370f,
+            +0.0066785229541939f,
+            +0.0082365227768589f,
+            +0.0076179801158357f,
+            +0.0046976999054549f,
+            -0.0000000000000000f,
+            -0.0053643557942164f,
+            -0.0099372665136396f,
+            -0.0122826987297702f,
+            -0.0113986331597630f,
+            -0.0070616422130378f,
+            +0.0000000000000000f,
+            +0.0081738424232889f,
+            +0.0152832469123745f,
+            +0.0191053056083586f,
+            +0.0179736781451814f,
+            +0.0113189621736263f,
+            -0.0000000000000000f,
+            -0.0136818524840190f,
+            -0.0263240156927319f,
+            -0.0340732257748054f,
+            -0.0334591930473014f,
+            -0.0222307743841270f,
+            +0.0000000000000000f,
+            +0.0314686223987604f,
+            +0.0684133826473639f,
+            +0.1056675010688807f,
+            +0.1375804453697427f,
+            +0.1590822310076600f,
+            +0.1666666666666667f,
+            +0.1590822310076600f,
+            +0.1375804453697427f,
+            +0.1056675010688807f,
+            +0.0684133826473639f,
+            +0.0314686223987604f,
+            +0.0000000000000000f,
+            -0.0222307743841270f,
+            -0.0334591930473014f,
+            -0.0340732257748054f,
+            -0.0263240156927319f,
+            -0.0136818524840190f,
+            -0.0000000000000000f,
+            +0.0113189621736263f,
+            +0.0179736781451814f,
+            +0.0191053056083586f,
+            +0.0152832469123745f,
+            +0.0081738424232889f,
+            +0.0000000000000000f,
+            -0.0070616422130378f,
+            -0.0113986331597630f,
+            -0.0122826987297702f,
+            -0.0099372665136396f,
+            -0.0053643557942164f,
+            -0.0000000000000000f,
+            +0.0046976999054549f,
+            +0.0076179801158357f,
+            +0.0082365227768589f,
+            +0.0066785229541939f,
+            +0.0036093576628370f,
+            +0.0000000000000000f,
+            -0.0031586574343870f,
+            -0.0051132441368046f,
+            -0.0055137053299634f,
+            -0.0044548049812326f,
+            -0.0023967856660485f,
+            -0.0000000000000000f,
+            +0.0020728591783349f,
+            +0.0033307735405828f,
+            +0.0035612558447263f,
+            +0.0028496582899407f,
+            +0.0015165097197541f,
+            +0.0000000000000000f,
+            -0.0012775773176476f,
+            -0.0020209252115536f,
+            -0.0021228117342621f,
+            -0.0016648586561699f,
+            -0.0008659595325228f,
+            -0.0000000000000000f,
+            +0.0006895061018602f,
+            +0.0010529606277093f,
+            +0.0010611039168624f,
+            +0.0007919335632497f,
+            +0.0003877920771884f,
+            +0.0000000000000000f,
+            -0.0002600712594939f,
+            -0.0003490478706498f,
+            -0.0002927077591936f,
+            -0.0001635914927107f,
+            -0.0000457001525446f
+        };
+
+        static const float lanczos_dec_6x24bit[] =
+        {
+            -0.0000011562910126f,
+            -0.0000040270466165f,
+            -0.0000070124889128f,
+            -0.0000081407142809f,
+            -0.0000059064827673f,
+            +0.0000000000000000f,
+            +0.0000083575591396f,
+            +0.0000166317343035f,
+            +0.0000217200667841f,
+            +0.0000210110260287f,
+            +0.0000134144721945f,
+            -0.0000000000000000f,
+            -0.0000160214493037f,
+            -0.0000300421112555f,
+            -0.0000373630916173f,
+            -0.0000346959178179f,
+            -0.0000213953503845f,
+            +0.0000000000000000f,
+            +0.0000241634595575f,
+            +0.0000442851910892f,
+            +0.0000539729559587f,
+            +0.0000492227524967f,
+            +0.0000298650187130f,
+            +0.0000000000000000f,
+            -0.0000327997035286f,
+            -0.0000593890720360f,
+            -0.0000715823264242f,
+            -0.0000646200154129f,
+            -0.0000388400378852f,
+            +0.0000000000000000f,
+            +0.0000419469773377f,
+            +0.0000753830550823f,
+            +0.0000902252827473f,
+            +0.0000809174371581f,
+            +0.0000483377001699f,
+            -0.0000000000000000f,
+            -0.0000516228346498f,
+            -0.0000922977764746f,
+            -0.0001099374737417f,
+            -0.0000981461312475f,
+            -0.0000583761104279f,
+            -0.0000000000000000f,
+            +0.0000618456708726f,
+            +0.0001101653563842f,
+            +0.0001307562922970f,
+            +0.0001163387486151f,
+            +0.0000689742770444f,
+            -0.0000000000000000f,
+            -0.0000726348176655f,
+            -0.0001290195657944f,
+            -0.0001527210718455f,
+            -0.0001355296510849f,
+            -0.0000801522140423f,
+            +0.0000000000000000f,
+            +0.0000840106490958f,
+            +0.0001488960139789f,
+            +0.0001758733071018f,
+            +0.0001557551063015f,
+            +0.0000919310558452f,
+            +0.0000000000000000f,
+            -0.0000959947009826f,
+            -0.0001698323593080f,
+            -0.0002002569023097f,
+            -0.0001770535069907f,
+            -0.0001043331863872f,
+            +0.0000000000000000f,
+            +0.0001086098052120f,
+            +0.0001918685465423f,
+            +0.0002259184507383f,
+            +0.0001994656178714f,
+            +0.0001173823845359f,
+            +0.0000000000000000f,
+            -0.0001218802410869f,
+            -0.0002150470742855f,
+            -0.0002529075497721f,
+            -0.0002230348540761f,
+            -0.0001311039881118f,
+            +0.0000000000000000f,
+            +0.0001358319061169f,
+            +0.0002394132968623f,
+            +0.0002812771566501f,
+            +0.0002478075955730f,
+            +0.0001455250791656f,
+            -0.0000000000000000f,
+            -0.0001504925090482f,
+            -0.0002650157656051f,
+            -0.0003110839907592f,
+            -0.0002738335428377f,
+            -0.0001606746936249f,
+            -0.0000000000000000f,
+            +0.0001658917884141f,
+            +0.0002919066153801f,
+            +0.0003423889893971f,
+            +0.0003011661199267f,
+            +0.0001765840589570f,
+            -0.0000000000000000f,
+            -0.0001820617604561f,
+            -0.0003201420032063f,
+            -0.0003752578251345f,
+            -0.0003298629321865f,
+            -0.0001932868641419f,
+            +0.0000000000000000f,
+            +0.0001990370009496f,
+            +0.0003497826070398f,
+            +0.0004097614943633f,
+            +0.0003599862871366f,
+            +0.0002108195670231f,
+            -0.0000000000000000f,
+            -0.0002168549662976f,
+            -0.0003808941942789f,
+            -0.0004459769883776f,
+            -0.0003916037886339f,
+            -0.0002292217450421f,
+            +0.0000000000000000f,
+            +0.0002355563602510f,
+            +0.0004135482713267f,
+            +0.0004839880604665f,
+            +0.0004247890163399f,
+            +0.0002485364965016f,
+            +0.0000000000000000f,
+            -0.0002551855538338f,
+            -0.0004478228277298f,
+            -0.0005238861050951f,
+            -0.0004596223048292f,
+            -0.0002688109008878f,
+            +0.0000000000000000f,
+            +0.0002757910675304f,
+            +0.0004838031910618f,
+            +0.0005657711684200f,
+            +0.0004961916395259f,
+            +0.0002900965484804f,
+            -0.0000000000000000f,
+            -0.0002974261266128f,
+            -0.0005215830119835f,
+            -0.0006097531132839f,
+            -0.0005345936901430f,
+            -0.0003124501515681f,
+            +0.0000000000000000f,
+            +0.0003201493027243f,
+            +0.0005612654029283f,
+            +0.0006559529666385f,
+            +0.0005749350066145f,
+            +0.0003359342521659f,
+            -0.0000000000000000f,
+            -0.0003440252576074f,
+            -0.0006029642588397f,
+            -0.0007045044833068f,
+            -0.0006173334078652f,
+            -0.0003606180443382f,
+            +0.0000000000000000f,
+            +0.0003691256083170f,
+            +0.0006468057945887f,
+            +0.0007555559674260f,
+            +0.0006619196004384f,
+            +0.0003865783332336f,
+            -0.0000000000000000f,
+            -0.0003955299375721f,
+            -0.0006929303414643f,
+            -0.0008092724022271f,
+            -0.0007088390723871f,
+            -0.0004139006579656f,
+            +0.0000000000000000f,
+            +0.0004233269783352f,
+            +0.0007414944549117f,
+            +0.0008658379505513f,
+            +0.0007582543184088f,
+            +0.0004426806118278f,
+            +0.0000000000000000f,
+            -0.0004526160085840f,
+            -0.0007926733980901f,
+            -0.0009254589034056f,
+            -0.0008103474656425f,
+            -0.0004730254014078f,
+            +0.0000000000000000f,
+            +0.0004835085010029f,
+            +0.0008466640816365f,
+            +0.0009883671728861f,
+            +0.0008653233867178f,
+            +0.0005050556964993f,
+            -0.0000000000000000f,
+            -0.0005161300835622f,
+            -0.0009036885603251f,
+            -0.0010548244502618f,
+            -0.0009234134087573f,
+            -0.0005389078360393f,
+            +0.0000000000000000f,
+            +0.0005506228814743f,
+            +0.0009639982135846f,
+            +0.0011251271816955f,
+            +0.0009848797556979f,
+            +0.0005747364725873f,
+            -0.0000000000000000f,
+            -0.0005871483299180f,
+            -0.0010278787710679f,
+            -0.0011996125554277f,
+            -0.0010500208987651f,
+            -0.0006127177605035f,
+            -0.0000000000000000f,
+            +0.0006258905717247f,
+            +0.0010956563894571f,
+            +0.0012786657486574f,
+            +0.0011191780392965f,
+            +0.0006530532228471f,
+            -0.0000000000000000f,
+            -0.0006670605870438f,
+            -0.0011677050463056f,
+            -0.0013627287545702f,
+            -0.0011927430137306f,
+            -0.0006959744717776f,
+            +0.0000000000000000f,
+            +0.0007109012458349f,
+            +0.0012444555964597f,
+            +0.0014523112067024f,
+            +0.0012711679986261f,
+            +0.0007417490106808f,
+            +0.0000000000000000f,
+            -0.0007576935331379f,
+            -0.0013264069443092f,
+            -0.0015480037487171f,
+            -0.0013549775129022f,
+            -0.0007906874187892f,
+            -0.0000000000000000f,
+            +0.0008077642775954f,
+            +0.0014141399321149f,
+            +0.0016504946766350f,
+            +0.0014447833779553f,
+            +0.0008431523186327f,
+            -0.0000000000000000f,
+            -0.0008614958246286f,
+            -0.0015083347475653f,
+            -0.0017605908280668f,
+            -0.0015413035228170f,
+            -0.0008995696649034f,
+            +0.0000000000000000f,
+            +0.0009193382503248f,
+            +0.0016097929371867f,
+            +0.0018792440395086f,
+            +0.0016453858393181f,
+            +0.0009604430876958f,
+            -0.0000000000000000f,
+            -0.0009818249304989f,
+            -0.0017194655134436f,
+            -0.0020075849843179f,
+            -0.0017580387440830f,
+            -0.0010263723001122f,
+            -0.0000000000000000f,
+            +0.0010495925921450f,
+            +0.0018384892193166f,
+            +0.0021469669113623f,
+            +0.0018804707560543f,
+            +0.0010980769808811f,
+            -0.0000000000000000f,
+            -0.0011234074291769f,
+            -0.0019682338536471f,
+            -0.0022990228381791f,
+            -0.0020141423535719f,
+            -0.0011764281314340f,
+            +0.0000000000000000f,
+            +0.0012041995363120f,
+            +0.0021103648048194f,
+            +0.0024657412892841f,
+            +0.0021608347993452f,
+            +0.0012624897873778f,
+            -0.0000000000000000f,
+            -0.0012931089260367f,
+            -0.0022669268184976f,
+            -0.0026495679974301f,
+            -0.0023227427855057f,
+            -0.0013575753064110f,
+            -0.0000000000000000f,
+            +0.0013915479452449f,
+            +0.0024404579174889f,
+            +0.0028535445821292f,
+            +0.0025026011071132f,
+            +0.0014633245439996f,
+            -0.0000000000000000f,
+            -0.0015012873417959f,
+            -0.0026341469457233f,
+            -0.0030815009045740f,
+            -0.0027038608986062f,
+            -0.0015818115571753f,
+            +0.0000000000000000f,
+            +0.0016245771414876f,
+            +0.0028520555567042f,
+            +0.0033383270114175f,
+            +0.0029309396381060f,
+            +0.0017156979208012f,
+            -0.0000000000000000f,
+            -0.0017643199502091f,
+            -0.0030994376543261f,
+            -0.0036303659354196f,
+            -0.0031895836474483f,
+            -0.0018684559058207f,
+            -0.0000000000000000f,
+            +0.0019243252766784f,
+            +0.0033832101410544f,
+            +0.0039659950325055f,
+            +0.0034874069366051f,
+            +0.0020447017139063f,
+            -0.0000000000000000f,
+            -0.0021096928032803f,
+            -0.0037126657576207f,
+            -0.0043565106162214f,
+            -0.0038347153108247f,
+            -0.0022507077589316f,
+            +0.0000000000000000f,
+            +0.0023274079251610f,
+            +0.0041005868865150f,
+            +0.0048175180875360f,
+            +0.0042458089826987f,
+            +0.0024952172732446f,
+            -0.0000000000000000f,
+            -0.0025873006636301f,
+            -0.0045650506720873f,
+            -0.0053712000299095f,
+            -0.0047411225675619f,
+            -0.0027907921047892f,
+            +0.0000000000000000f,
+            +0.0029036559107018f,
+            +0.0051324838280673f,
+            +0.0060501852995106f,
+            +0.0053509058639283f,
+            +0.0031561507256257f,
+            -0.0000000000000000f,
+            -0.0032980570451876f,
+            -0.0058431081511444f,
+            -0.0069045133723562f,
+            -0.0061219161679978f,
+            -0.0036204636348952f,
+            +0.0000000000000000f,
+            +0.0038047263739421f,
+            +0.0067612869816417f,
+            +0.0080150273016058f,
+            +0.0071304506595615f,
+            +0.0042318280632403f,
+            -0.0000000000000000f,
+            -0.0044813585882438f,
+            -0.0079968267220541f,
+            -0.0095213771520703f,
+            -0.0085100402026562f,
+            -0.0050755842578646f,
+            +0.0000000000000000f,
+            +0.0054334026363275f,
+            +0.0097536659998669f,
+            +0.0116873613204927f,
+            +0.0105174883844042f,
+            +0.0063190072034756f,
+            -0.0000000000000000f,
+            -0.0068763499891475f,
+            -0.0124582379769456f,
+            -0.0150782815126399f,
+            -0.0137177807917770f,
+            -0.0083406773739528f,
+            +0.0000000000000000f,
+            +0.0093299274470728f,
+            +0.0171766478147433f,
+            +0.0211639496156704f,
+            +0.0196444752395106f,
+            +0.0122181089213722f,
+            -0.0000000000000000f,
+            -0.0144478300070633f,
+            -0.0275336889490756f,
+            -0.0353337219762185f,
+            -0.0344318479419193f,
+            -0.0227231799260140f,
+            +0.0000000000000000f,
+            +0.0318215302977192f,
+            +0.0689030056735450f,
+            +0.1060919447621962f,
+            +0.1378256704479290f,
+            +0.1591530512658590f,
+            +0.1666666666666667f,
+            +0.1591530512658590f,
+            +0.1378256704479290f,
+            +0.1060919447621962f,
+            +0.0689030056735450f,
+            +0.0318215302977192f,
+            +0.0000000000000000f,
+            -0.0227231799260140f,
+            -0.0344318479419193f,
+            -0.0353337219762185f,
+            -0.0275336889490756f,
+            -0.0144478300070633f,
+            -0.0000000000000000f,
+            +0.0122181089213722f,
+            +0.0196444752395106f,
+            +0.0211639496156704f,
+            +0.0171766478147433f,
+            +0.0093299274470728f,
+            +0.0000000000000000f,
+            -0.0083406773739528f,
+            -0.0137177807917770f,
+            -0.0150782815126399f,
+            -0.0124582379769456f,
+            -0.0068763499891475f,
+            -0.0000000000000000f,
+            +0.0063190072034756f,
+            +0.0105174883844042f,
+            +0.0116873613204927f,
+            +0.0097536659998669f,
+            +0.0054334026363275f,
+            +0.0000000000000000f,
+            -0.0050755842578646f,
+            -0.0085100402026562f,
+            -0.0095213771520703f,
+            -0.0079968267220541f,
+            -0.0044813585882438f,
+            -0.0000000000000000f,
+            +0.0042318280632403f,
+            +0.0071304506595615f,
+            +0.0080150273016058f,
+            +0.0067612869816417f,
+            +0.0038047263739421f,
+            +0.0000000000000000f,
+            -0.0036204636348952f,
+            -0.0061219161679978f,
+            -0.0069045133723562f,
+            -0.0058431081511444f,
+            -0.0032980570451876f,
+            -0.0000000000000000f,
+            +0.0031561507256257f,
+            +0.0053509058639283f,
+            +0.0060501852995106f,
+            +0.0051324838280673f,
+            +0.0029036559107018f,
+            +0.0000000000000000f,
+            -0.0027907921047892f,
+            -0.0047411225675619f,
+            -0.0053712000299095f,
+            -0.0045650506720873f,
+            -0.0025873006636301f,
+            -0.0000000000000000f,
+            +0.0024952172732446f,
+            +0.0042458089826987f,
+            +0.0048175180875360f,
+            +0.0041005868865150f,
+            +0.0023274079251610f,
+            +0.0000000000000000f,
+            -0.0022507077589316f,
+            -0.0038347153108247f,
+            -0.0043565106162214f,
+            -0.0037126657576207f,
+            -0.0021096928032803f,
+            -0.0000000000000000f,
+            +0.0020447017139063f,
+            +0.0034874069366051f,
+            +0.0039659950325055f,
+            +0.0033832101410544f,
+            +0.0019243252766784f,
+            -0.0000000000000000f,
+            -0.0018684559058207f,
+            -0.0031895836474483f,
+            -0.0036303659354196f,
+            -0.0030994376543261f,
+            -0.0017643199502091f,
+            -0.0000000000000000f,
+            +0.0017156979208012f,
+            +0.0029309396381060f,
+            +0.0033383270114175f,
+            +0.0028520555567042f,
+            +0.0016245771414876f,
+            +0.0000000000000000f,
+            -0.0015818115571753f,
+            -0.0027038608986062f,
+            -0.0030815009045740f,
+            -0.0026341469457233f,
+            -0.0015012873417959f,
+            -0.0000000000000000f,
+            +0.0014633245439996f,
+            +0.0025026011071132f,
+            +0.0028535445821292f,
+            +0.0024404579174889f,
+            +0.0013915479452449f,
+            -0.0000000000000000f,
+            -0.0013575753064110f,
+            -0.0023227427855057f,
+            -0.0026495679974301f,
+            -0.0022669268184976f,
+            -0.0012931089260367f,
+            -0.0000000000000000f,
+            +0.0012624897873778f,
+            +0.0021608347993452f,
+            +0.0024657412892841f,
+            +0.0021103648048194f,
+            +0.0012041995363120f,
+            +0.0000000000000000f,
+            -0.0011764281314340f,
+            -0.0020141423535719f,
+            -0.0022990228381791f,
+            -0.0019682338536471f,
+            -0.0011234074291769f,
+            -0.0000000000000000f,
+            +0.0010980769808811f,
+            +0.0018804707560543f,
+            +0.0021469669113623f,
+            +0.0018384892193166f,
+            +0.0010495925921450f,
+            -0.0000000000000000f,
+            -0.0010263723001122f,
+            -0.0017580387440830f,
+            -0.0020075849843179f,
+            -0.0017194655134436f,
+            -0.0009818249304989f,
+            -0.0000000000000000f,
+            +0.0009604430876958f,
+            +0.0016453858393181f,
+            +0.0018792440395086f,
+            +0.0016097929371867f,
+            +0.0009193382503248f,
+            +0.0000000000000000f,
+            -0.0008995696649034f,
+            -0.0015413035228170f,
+            -0.0017605908280668f,
+            -0.0015083347475653f,
+            -0.0008614958246286f,
+            -0.0000000000000000f,
+            +0.0008431523186327f,
+            +0.0014447833779553f,
+            +0.0016504946766350f,
+            +0.0014141399321149f,
+            +0.0008077642775954f,
+            -0.0000000000000000f,
+            -0.0007906874187892f,
+            -0.0013549775129022f,
+            -0.0015480037487171f,
+            -0.0013264069443092f,
+            -0.0007576935331379f,
+            +0.0000000000000000f,
+            +0.0007417490106808f,
+            +0.0012711679986261f,
+            +0.0014523112067024f,
+            +0.0012444555964597f,
+            +0.0007109012458349f,
+            +0.0000000000000000f,
+            -0.0006959744717776f,
+            -0.0011927430137306f,
+            -0.0013627287545702f,
+            -0.0011677050463056f,
+            -0.0006670605870438f,
+            -0.0000000000000000f,
+            +0.0006530532228471f,
+            +0.0011191780392965f,
+            +0.0012786657486574f,
+            +0.0010956563894571f,
+            +0.0006258905717247f,
+            -0.0000000000000000f,
+            -0.0006127177605035f,
+            -0.0010500208987651f,
+            -0.0011996125554277f,
+            -0.0010278787710679f,
+            -0.0005871483299180f,
+            -0.0000000000000000f,
+            +0.0005747364725873f,
+            +0.0009848797556979f,
+            +0.0011251271816955f,
+            +0.0009639982135846f,
+            +0.0005506228814743f,
+            +0.0000000000000000f,
+            -0.0005389078360393f,
+            -0.0009234134087573f,
+            -0.0010548244502618f,
+            -0.0009036885603251f,
+            -0.0005161300835622f,
+            -0.0000000000000000f,
+            +0.0005050556964993f,
+            +0.0008653233867178f,
+            +0.0009883671728861f,
+            +0.0008466640816365f,
+            +0.0004835085010029f,
+            +0.0000000000000000f,
+            -0.0004730254014078f,
+            -0.0008103474656425f,
+            -0.0009254589034056f,
+            -0.0007926733980901f,
+            -0.0004526160085840f,
+            +0.0000000000000000f,
+            +0.0004426806118278f,
+            +0.0007582543184088f,
+            +0.0008658379505513f,
+            +0.0007414944549117f,
+            +0.0004233269783352f,
+            +0.0000000000000000f,
+            -0.0004139006579656f,
+            -0.0007088390723871f,
+            -0.0008092724022271f,
+            -0.0006929303414643f,
+            -0.0003955299375721f,
+            -0.0000000000000000f,
+            +0.0003865783332336f,
+            +0.0006619196004384f,
+            +0.0007555559674260f,
+            +0.0006468057945887f,
+            +0.0003691256083170f,
+            +0.0000000000000000f,
+            -0.0003606180443382f,
+            -0.0006173334078652f,
+            -0.0007045044833068f,
+            -0.0006029642588397f,
+            -0.0003440252576074f,
+            -0.0000000000000000f,
+            +0.0003359342521659f,
+            +0.0005749350066145f,
+            +0.0006559529666385f,
+            +0.0005612654029283f,
+            +0.0003201493027243f,
+            +0.0000000000000000f,
+            -0.0003124501515681f,
+            -0.0005345936901430f,
+            -0.0006097531132839f,
+            -0.0005215830119835f,
+            -0.0002974261266128f,
+            -0.0000000000000000f,
+            +0.0002900965484804f,
+            +0.0004961916395259f,
+            +0.0005657711684200f,
+            +0.0004838031910618f,
+            +0.0002757910675304f,
+            +0.0000000000000000f,
+            -0.0002688109008878f,
+            -0.0004596223048292f,
+            -0.0005238861050951f,
+            -0.0004478228277298f,
+            -0.0002551855538338f,
+            +0.0000000000000000f,
+            +0.0002485364965016f,
+            +0.0004247890163399f,
+            +0.0004839880604665f,
+            +0.0004135482713267f,
+            +0.0002355563602510f,
+            +0.0000000000000000f,
+            -0.0002292217450421f,
+            -0.0003916037886339f,
+            -0.0004459769883776f,
+            -0.0003808941942789f,
+            -0.0002168549662976f,
+            -0.0000000000000000f,
+            +0.0002108195670231f,
+            +0.0003599862871366f,
+            +0.0004097614943633f,
+            +0.0003497826070398f,
+            +0.0001990370009496f,
+            +0.0000000000000000f,
+            -0.0001932868641419f,
+            -0.0003298629321865f,
+            -0.0003752578251345f,
+            -0.0003201420032063f,
+            -0.0001820617604561f,
+            -0.0000000000000000f,
+            +0.0001765840589570f,
+            +0.0003011661199267f,
+            +0.0003423889893971f,
+            +0.0002919066153801f,
+            +0.0001658917884141f,
+            -0.0000000000000000f,
+            -0.0001606746936249f,
+            -0.0002738335428377f,
+            -0.0003110839907592f,
+            -0.0002650157656051f,
+            -0.0001504925090482f,
+            -0.0000000000000000f,
+            +0.0001455250791656f,
+            +0.0002478075955730f,
+            +0.0002812771566501f,
+            +0.0002394132968623f,
+            +0.0001358319061169f,
+            +0.0000000000000000f,
+            -0.0001311039881118f,
+            -0.0002230348540761f,
+            -0.0002529075497721f,
+            -0.0002150470742855f,
+            -0.0001218802410869f,
+            +0.0000000000000000f,
+            +0.0001173823845359f,
+            +0.0001994656178714f,
+            +0.0002259184507383f,
+            +0.0001918685465423f,
+            +0.0001086098052120f,
+            +0.0000000000000000f,
+            -0.0001043331863872f,
+            -0.0001770535069907f,
+            -0.0002002569023097f,
+            -0.0001698323593080f,
+            -0.0000959947009826f,
+            +0.0000000000000000f,
+            +0.0000919310558452f,
+            +0.0001557551063015f,
+            +0.0001758733071018f,
+            +0.0001488960139789f,
+            +0.0000840106490958f,
+            +0.0000000000000000f,
+            -0.0000801522140423f,
+            -0.0001355296510849f,
+            -0.0001527210718455f,
+            -0.0001290195657944f,
+            -0.0000726348176655f,
+            -0.0000000000000000f,
+            +0.0000689742770444f,
+            +0.0001163387486151f,
+            +0.0001307562922970f,
+            +0.0001101653563842f,
+            +0.0000618456708726f,
+            -0.0000000000000000f,
+            -0.0000583761104279f,
+            -0.0000981461312475f,
+            -0.0001099374737417f,
+            -0.0000922977764746f,
+            -0.0000516228346498f,
+            -0.0000000000000000f,
+            +0.0000483377001699f,
+            +0.0000809174371581f,
+            +0.0000902252827473f,
+            +0.0000753830550823f,
+            +0.0000419469773377f,
+            +0.0000000000000000f,
+            -0.0000388400378852f,
+            -0.0000646200154129f,
+            -0.0000715823264242f,
+            -0.0000593890720360f,
+            -0.0000327997035286f,
+            +0.0000000000000000f,
+            +0.0000298650187130f,
+            +0.0000492227524967f,
+            +0.0000539729559587f,
+            +0.0000442851910892f,
+            +0.0000241634595575f,
+            +0.0000000000000000f,
+            -0.0000213953503845f,
+            -0.0000346959178179f,
+            -0.0000373630916173f,
+            -0.0000300421112555f,
+            -0.0000160214493037f,
+            -0.0000000000000000f,
+            +0.0000134144721945f,
+            +0.0000210110260287f,
+            +0.0000217200667841f,
+            +0.0000166317343035f,
+            +0.0000083575591396f,
+            +0.0000000000000000f,
+            -0.0000059064827673f,
+            -0.0000081407142809f,
+            -0.0000070124889128f,
+            -0.0000040270466165f,
+            -0.0000011562910126f
+        };
+
+        static const float lanczos_dec_8x2[] =
+        {
+            -0.0005379143192287f,
+            -0.0022381481407931f,
+            -0.0049236576390518f,
+            -0.0079605440034827f,
+            -0.0102919245696154f,
+            -0.0105906004883613f,
+            -0.0075118830567738f,
+            +0.0000000000000000f,
+            +0.0124176026040546f,
+            +0.0294183346898926f,
+            +0.0498129149169386f,
+            +0.0716448960313445f,
+            +0.0924553489999720f,
+            +0.1096692588988597f,
+            +0.1210307218264631f,
+            +0.1250000000000000f,
+            +0.1210307218264631f,
+            +0.1096692588988597f,
+            +0.0924553489999720f,
+            +0.0716448960313445f,
+            +0.0498129149169386f,
+            +0.0294183346898926f,
+            +0.0124176026040546f,
+            +0.0000000000000000f,
+            -0.0075118830567738f,
+            -0.0105906004883613f,
+            -0.0102919245696154f,
+            -0.0079605440034827f,
+            -0.0049236576390518f,
+            -0.0022381481407931f,
+            -0.0005379143192287f
+        };
+
+        static const float lanczos_dec_8x3[] =
+        {
+            +0.0002296112450935f,
+            +0.0009194907558993f,
+            +0.0019495209804448f,
+            +0.0030396355092701f,
+            +0.0037884954340634f,
+            +0.0037526364311977f,
+            +0.0025545827118397f,
+            -0.0000000000000000f,
+            -0.0038210611216717f,
+            -0.0084739169875679f,
+            -0.0131797964738048f,
+            -0.0168868639403896f,
+            -0.0184081454882067f,
+            -0.0166088772956330f,
+            -0.0106140586713103f,
+            +0.0000000000000000f,
+            +0.0150668245657484f,
+            +0.0337737278807793f,
+            +0.0547058740678751f,
+            +0.0759908877317533f,
+            +0.0955265280417927f,
+            +0.1112583814638118f,
+            +0.1214643486544645f,
+            +0.1250000000000000f,
+            +0.1214643486544645f,
+            +0.1112583814638118f,
+            +0.0955265280417927f,
+            +0.0759908877317533f,
+            +0.0547058740678751f,
+            +0.0337737278807793f,
+            +0.0150668245657484f,
+            +0.0000000000000000f,
+            -0.0106140586713103f,
+            -0.0166088772956330f,
+            -0.0184081454882067f,
+            -0.0168868639403896f,
+            -0.0131797964738048f,
+            -0.0084739169875679f,
+            -0.0038210611216717f,
+            -0.0000000000000000f,
+            +0.0025545827118397f,
+            +0.0037526364311977f,
+            +0.0037884954340634f,
+            +0.0030396355092701f,
+            +0.0019495209804448f,
+            +0.0009194907558993f,
+            +0.0002296112450935f
+        };
+
+        static const float lanczos_dec_8x4[] =
+        {
+            -0.0001265518602849f,
+            -0.0004969680297802f,
+            -0.0010339360907640f,
+            -0.0015826097276548f,
+            -0.0019369777070626f,
+            -0.0018842022051029f,
+            -0.0012594138150691f,
+            +0.0000000000000000f,
+            +0.0018130909426228f,
+            +0.0039385490199430f,
+            +0.0059904135290853f,
+            +0.0074886854221579f,
+            +0.0079404156698866f,
+            +0.0069400750067716f,
+            +0.0042726345983669f,
+            -0.0000000000000000f,
+            -0.0054879617730135f,
+            -0.0114723688887449f,
+            -0.0169614796262074f,
+            -0.0208019039504385f,
+            -0.0218328294737737f,
+            -0.0190625772565242f,
+            -0.0118410507240427f,
+            +0.0000000000000000f,
+            +0.0160639517228205f,
+            +0.0353811302958216f,
+            +0.0564822699379462f,
+            +0.0775478766550868f,
+            +0.0966155835925018f,
+            +0.1118178067005363f,
+            +0.1216163377337776f,
+            +0.1250000000000000f,
+            +0.1216163377337776f,
+            +0.1118178067005363f,
+            +0.0966155835925018f,
+            +0.0775478766550868f,
+            +0.0564822699379462f,
+            +0.0353811302958216f,
+            +0.0160639517228205f,
+            +0.0000000000000000f,
+            -0.0118410507240427f,
+            -0.0190625772565242f,
+            -0.0218328294737737f,
+            -0.0208019039504385f,
+            -0.0169614796262074f,
+            -0.0114723688887449f,
+            -0.0054879617730135f,
+            -0.0000000000000000f,
+            +0.0042726345983669f,
+            +0.0069400750067716f,
+            +0.0079404156698866f,
+            +0.0074886854221579f,
+            +0.0059904135290853f,
+            +0.0039385490199430f,
+            +0.0018130909426228f,
+            +0.0000000000000000f,
+            -0.0012594138150691f,
+            -0.0018842022051029f,
+            -0.0019369777070626f,
+            -0.0015826097276548f,
+            -0.0010339360907640f,
+            -0.0004969680297802f,
+            -0.0001265518602849f
+        };
+
+        static const float lanczos_dec_8x16bit[] =
+        {
+            -0.0000195129969555f,
+            -0.0000739144478124f,
+            -0.0001484568384046f,
+            -0.0002195308193952f,
+            -0.0002597280089753f,
+            -0.0002443413998898f,
+            -0.0001580006044311f,
+            +0.0000000000000000f,
+            +0.0002129787173217f,
+            +0.0004476296281586f,
+            +0.0006585194440960f,
+            +0.0007958279376468f,
+            +0.0008151327173435f,
+            +0.0006874996390377f,
+            +0.0004078891541154f,
+            -0.0000000000000000f,
+            -0.0004838440032148f,
+            -0.0009683587492274f,
+            -0.0013661180455852f,
+            -0.0015921088006965f,
+            -0.0015797501498344f,
+            -0.0012955816015940f,
+            -0.0007497649798842f,
+            +0.0000000000000000f,
+            +0.0008526109479311f,
+            +0.0016759208759204f,
+            +0.0023260406297818f,
+            +0.0026709418835447f,
+            +0.0026146861003676f,
+            +0.0021181200976723f,
+            +0.0012120740690877f,
+            -0.0000000000000000f,
+            -0.0013514958798108f,
+            -0.0026338503535311f,
+            -0.0036270579909248f,
+            -0.0041352789974725f,
+            -0.0040220536921596f,
+            -0.0032391854298030f,
+            -0.0018438569911380f,
+            +0.0000000000000000f,
+            +0.0020378195937561f,
+            +0.0039570104557981f,
+            +0.0054322697420038f,
+            +0.0061773920826442f,
+            +0.0059957489237736f,
+            +0.0048211309239376f,
+            +0.0027414640941249f,
+            -0.0000000000000000f,
+            -0.0030282932777102f,
+            -0.0058836669379785f,
+            -0.0080865618871059f,
+            -0.0092120240473276f,
+            -0.0089627546351948f,
+            -0.0072292681570766f,
+            -0.0041266369879866f,
+            +0.0000000000000000f,
+            +0.0046048892620863f,
+            +0.0090048274953766f,
+            +0.0124696378040213f,
+            +0.0143289792062689f,
+            +0.0140812333729153f,
+            +0.0114887994815742f,
+            +0.0066449025908636f,
+            -0.0000000000000000f,
+            -0.0076592518939453f,
+            -0.0152793287124902f,
+            -0.0216516613500291f,
+            -0.0255549193311041f,
+            -0.0259108353168675f,
+            -0.0219338517797719f,
+            -0.0132546384446751f,
+            +0.0000000000000000f,
+            +0.0171833718574188f,
+            +0.0371670418276794f,
+            +0.0584388020194505f,
+            +0.0792506258016605f,
+            +0.0978000661000981f,
+            +0.1124238751226952f,
+            +0.1217806139994275f,
+            +0.1250000000000000f,
+            +0.1217806139994275f,
+            +0.1124238751226952f,
+            +0.0978000661000981f,
+            +0.0792506258016605f,
+            +0.0584388020194505f,
+            +0.0371670418276794f,
+            +0.0171833718574188f,
+            +0.0000000000000000f,
+            -0.0132546384446751f,
+            -0.0219338517797719f,
+            -0.0259108353168675f,
+            -0.0255549193311041f,
+            -0.0216516613500291f,
+            -0.0152793287124902f,
+            -0.0076592518939453f,
+            -0.0000000000000000f,
+            +0.0066449025908636f,
+            +0.0114887994815742f,
+            +0.0140812333729153f,
+            +0.0143289792062689f,
+            +0.0124696378040213f,
+            +0.0090048274953766f,
+            +0.0046048892620863f,
+            +0.0000000000000000f,
+            -0.0041266369879866f,
+            -0.0072292681570766f,
+            -0.0089627546351948f,
+            -0.0092120240473276f,
+            -0.0080865618871059f,
+            -0.0058836669379785f,
+            -0.0030282932777102f,
+            -0.0000000000000000f,
+            +0.0027414640941249f,
+            +0.0048211309239376f,
+            +0.0059957489237736f,
+            +0.0061773920826442f,
+            +0.0054322697420038f,
+            +0.0039570104557981f,
+            +0.0020378195937561f,
+            +0.0000000000000000f,
+            -0.0018438569911380f,
+            -0.0032391854298030f,
+            -0.0040220536921596f,
+            -0.0041352789974725f,
+            -0.0036270579909248f,
+            -0.0026338503535311f,
+            -0.0013514958798108f,
+            -0.0000000000000000f,
+            +0.0012120740690877f,
+            +0.0021181200976723f,
+            +0.0026146861003676f,
+            +0.0026709418835447f,
+            +0.0023260406297818f,
+            +0.0016759208759204f,
+            +0.0008526109479311f,
+            +0.0000000000000000f,
+            -0.0007497649798842f,
+            -0.0012955816015940f,
+            -0.0015797501498344f,
+            -0.0015921088006965f,
+            -0.0013661180455852f,
+            -0.0009683587492274f,
+            -0.0004838440032148f,
+            -0.0000000000000000f,
+            +0.0004078891541154f,
+            +0.0006874996390377f,
+            +0.0008151327173435f,
+            +0.0007958279376468f,
+            +0.0006585194440960f,
+            +0.0004476296281586f,
+            +0.0002129787173217f,
+            +0.0000000000000000f,
+            -0.0001580006044311f,
+            -0.0002443413998898f,
+            -0.0002597280089753f,
+            -0.0002195308193952f,
+            -0.0001484568384046f,
+            -0.0000739144478124f,
+            -0.0000195129969555f
+        };
+
+        static const float lanczos_dec_8x24bit[] =
+        {
+            -0.0000004971374567f,
+            -0.0000018445889894f,
+            -0.0000036296667638f,
+            -0.0000052593666846f,
+            -0.0000060981751717f,
+            -0.0000056232795912f,
+            -0.0000035647396212f,
+            +0.0000000000000000f,
+            +0.0000046199698370f,
+            +0.0000095229646077f,
+            +0.0000137411557532f,
+            +0.0000162900500881f,
+            +0.0000163690587629f,
+            +0.0000135456481643f,
+            +0.0000078856471148f,
+            -0.0000000000000000f,
+            -0.0000090079953715f,
+            -0.0000176933714967f,
+            -0.0000244981636325f,
+            -0.0000280223187129f,
+            -0.0000272907963566f,
+            -0.0000219682148872f,
+            -0.0000124783779152f,
+            +0.0000000000000000f,
+            +0.0000136700963795f,
+            +0.0000263722997155f,
+            +0.0000359223384901f,
+            +0.0000404797169691f,
+            +0.0000388852456022f,
+            +0.0000309077906302f,
+            +0.0000173520748138f,
+            +0.0000000000000000f,
+            -0.0000186155070291f,
+            -0.0000355768978484f,
+            -0.0000480361999439f,
+            -0.0000536867448181f,
+            -0.0000511751584117f,
+            -0.0000403818795912f,
+            -0.0000225162607085f,
+            +0.0000000000000000f,
+            +0.0000238538515663f,
+            +0.0000453250446629f,
+            +0.0000608632341187f,
+            +0.0000676689620605f,
+            +0.0000641842787000f,
+            +0.0000504087551829f,
+            +0.0000279808802661f,
+            -0.0000000000000000f,
+            -0.0000293951871910f,
+            -0.0000556354294794f,
+            -0.0000744280001720f,
+            -0.0000824531053063f,
+            -0.0000779374520157f,
+            -0.0000610075451557f,
+            -0.0000337563466580f,
+            -0.0000000000000000f,
+            +0.0000352500521577f,
+            +0.0000665276423388f,
+            +0.0000887562498147f,
+            +0.0000980672192227f,
+            +0.0000924607485604f,
+            +0.0000721983271224f,
+            +0.0000398535940105f,
+            -0.0000000000000000f,
+            -0.0000414295197647f,
+            -0.0000780222752170f,
+            -0.0001038750614848f,
+            -0.0001145408038841f,
+            -0.0001077816013132f,
+            -0.0000840022358201f,
+            -0.0000462841363046f,
+            +0.0000000000000000f,
+            +0.0000479452589949f,
+            +0.0000901410357204f,
+            +0.0001198129910809f,
+            +0.0001319049803264f,
+            +0.0001239289612358f,
+            +0.0000964415836523f,
+            +0.0000530601335759f,
+            +0.0000000000000000f,
+            -0.0000548096026877f,
+            -0.0001029068749168f,
+            -0.0001366002414591f,
+            -0.0001501926767323f,
+            -0.0001409334718428f,
+            -0.0001095399962867f,
+            -0.0000601944663931f,
+            +0.0000000000000000f,
+            +0.0000620356242585f,
+            +0.0001163441312153f,
+            +0.0001542688532360f,
+            +0.0001694388380537f,
+            +0.0001588276657759f,
+            +0.0001233225653700f,
+            +0.0000677008197521f,
+            +0.0000000000000000f,
+            -0.0000696372241440f,
+            -0.0001304786925128f,
+            -0.0001728529198546f,
+            -0.0001896806623290f,
+            -0.0001776461864510f,
+            -0.0001378160207516f,
+            -0.0000755937777031f,
+            +0.0000000000000000f,
+            +0.0000776292273444f,
+            +0.0001453381791898f,
+            +0.0001923888303475f,
+            +0.0002109578674876f,
+            +0.0001974260383488f,
+            +0.0001530489250016f,
+            +0.0000838889302500f,
+            -0.0000000000000000f,
+            -0.0000860274936602f,
+            -0.0001609521509646f,
+            -0.0002129155438114f,
+            -0.0002333129930694f,
+            -0.0002182068701208f,
+            -0.0001690518934819f,
+            -0.0000926029943186f,
+            -0.0000000000000000f,
+            +0.0000948490424932f,
+            +0.0001773523411323f,
+            +0.0002344749002890f,
+            +0.0002567917420478f,
+            +0.0002400312954002f,
+            +0.0001858578437855f,
+            +0.0001017539509021f,
+            -0.0000000000000000f,
+            -0.0001041121944084f,
+            -0.0001945729223267f,
+            -0.0002571119735782f,
+            -0.0002814433688509f,
+            -0.0002629452570670f,
+            -0.0002035022790374f,
+            -0.0001113612008644f,
+            +0.0000000000000000f,
+            +0.0001138367320401f,
+            +0.0002126508086821f,
+            +0.0002808754724746f,
+            +0.0003073211207725f,
+            +0.0002869984417494f,
+            +0.0002220236103573f,
+            +0.0001214457423326f,
+            -0.0000000000000000f,
+            -0.0001240440833999f,
+            -0.0002316260001633f,
+            -0.0003058181981436f,
+            -0.0003344827412832f,
+            -0.0003122447525941f,
+            -0.0002414635247639f,
+            -0.0001320303731485f,
+            +0.0000000000000000f,
+            +0.0001347575312110f,
+            +0.0002515419759077f,
+            +0.0003319975667618f,
+            +0.0003629910453499f,
+            +0.0003387428498504f,
+            +0.0002618674059890f,
+            +0.0001431399225125f,
+            +0.0000000000000000f,
+            -0.0001460024525853f,
+            -0.0002724461447353f,
+            -0.0003594762083217f,
+            -0.0003929145788213f,
+            -0.0003665567706595f,
+            -0.0002832848171165f,
+            -0.0001548015167531f,
+            +0.0000000000000000f,
+            +0.0001578065942058f,
+            +0.0002943903625802f,
+            +0.0003883226546362f,
+            +0.0004243283763150f,
+            +0.0003957566416915f,
+            +0.0003057700557283f,
+            +0.0001670448851374f,
+            -0.0000000000000000f,
+            -0.0001702003892082f,
+            -0.0003174315285601f,
+            -0.0004186121322106f,
+            -0.0004573148349630f,
+            -0.0004264195010471f,
+            -0.0003293827944222f,
+            -0.0001799027128504f,
+            +0.0000000000000000f,
+            +0.0001832173232333f,
+            +0.0003416322738181f,
+            +0.0004504274788923f,
+            +0.0004919647249789f,
+            +0.0004586302492577f,
+            +0.0003541888222478f,
+            +0.0001934110497615f,
+            -0.0000000000000000f,
+            -0.0001968943586961f,
+            -0.0003670617602637f,
+            -0.0004838602072298f,
+            -0.0005283783624801f,
+            -0.0004924827534656f,
+            -0.0003802609059519f,
+            -0.0002076097854579f,
+            +0.0000000000000000f,
+            +0.0002112724282823f,
+            +0.0003937966100685f,
+            +0.0005190117424762f,
+            +0.0005666669755695f,
+            +0.0005280811341568f,
+            +0.0004076797940867f,
+            +0.0002225432033396f,
+            -0.0000000000000000f,
+            -0.0002263970111346f,
+            -0.0004219219914388f,
+            -0.0005559948694486f,
+            -0.0006069543016703f,
+            -0.0005655412704635f,
+            -0.0004365353922705f,
+            -0.0002382606294891f,
+            +0.0000000000000000f,
+            +0.0002423188082830f,
+            +0.0004515328920595f,
+            +0.0005949354303566f,
+            +0.0006493784629135f,
+            +0.0006049925684341f,
+            +0.0004669281444934f,
+            +0.0002548171957094f,
+            +0.0000000000000000f,
+            -0.0002590945377778f,
+            -0.0004827356190477f,
+            -0.0006359743257303f,
+            -0.0006940941775542f,
+            -0.0006465800473074f,
+            -0.0004989706637579f,
+            -0.0002722747408081f,
+            +0.0000000000000000f,
+            +0.0002767878749657f,
+            +0.0005156495737398f,
+            +0.0006792698833635f,
+            +0.0007412753796646f,
+            +0.0006904668124321f,
+            +0.0005327896660820f,
+            +0.0002907028802017f,
+            -0.0000000000000000f,
+            -0.0002954705697335f,
+            -0.0005504093618112f,
+            -0.0007250006766072f,
+            -0.0007911183376964f,
+            -0.0007368370009684f,
+            -0.0005685282757225f,
+            -0.0003101802816432f,
+            +0.0000000000000000f,
+            +0.0003152237807891f,
+            +0.0005871673149688f,
+            +0.0007733688945941f,
+            +0.0008438453862717f,
+            +0.0007858993091999f,
+            +0.0006063487874225f,
+            +0.0003307961949161f,
+            -0.0000000000000000f,
+            -0.0003361396777795f,
+            -0.0006260965209569f,
+            -0.0008246043946796f,
+            -0.0008997094165708f,
+            -0.0008378912399204f,
+            -0.0006464359949557f,
+            -0.0003526522964782f,
+            -0.0000000000000000f,
+            +0.0003583233761221f,
+            +0.0006673944855360f,
+            +0.0008789696037928f,
+            +0.0009589993114930f,
+            +0.0008930842473979f,
+            +0.0006890012261841f,
+            +0.0003758649273865f,
+            -0.0000000000000000f,
+            -0.0003818952880418f,
+            -0.0007112875857477f,
+            -0.0009367654836680f,
+            -0.0010220465659277f,
+            -0.0009517900092957f,
+            -0.0007342872660114f,
+            -0.0004005678259372f,
+            +0.0000000000000000f,
+            +0.0004069939981631f,
+            +0.0007580365214194f,
+            +0.0009983388395194f,
+            +0.0010892334050268f,
+            +0.0010143681245022f,
+            +0.0007825744038941f,
+            +0.0004269154875150f,
+            +0.0000000000000000f,
+            -0.0004337798055060f,
+            -0.0008079430361648f,
+            -0.0010640913390013f,
+            -0.0011610028115378f,
+            -0.0010812356300768f,
+            -0.0008341879175542f,
+            -0.0004550873263351f,
+            -0.0000000000000000f,
+            +0.0004624391193519f,
+            +0.0008613582668133f,
+            +0.0011344907274750f,
+            +0.0012378710074762f,
+            +0.0011528788595720f,
+            +0.0008895074073516f,
+            +0.0004852928716888f,
+            -0.0000000000000000f,
+            -0.0004931899592681f,
+            -0.0009186932011079f,
+            -0.0012100848901846f,
+            -0.0013204431210501f,
+            -0.0012298683437363f,
+            -0.0009489785383836f,
+            -0.0005177783117735f,
+            +0.0000000000000000f,
+            +0.0005262888971076f,
+            +0.0009804318922488f,
+            +0.0012915196419949f,
+            +0.0014094330296315f,
+            +0.0013128777052435f,
+            +0.0010131279476743f,
+            +0.0005528348113957f,
+            -0.0000000000000000f,
+            -0.0005620399023494f,
+            -0.0010471483174176f,
+            -0.0013795614511355f,
+            -0.0015056887382384f,
+            -0.0014027078552701f,
+            -0.0010825823589471f,
+            -0.0005908091912688f,
+            -0.0000000000000000f,
+            +0.0006008057289568f,
+            +0.0011195281094493f,
+            +0.0014751267713582f,
+            +0.0016102251835217f,
+            +0.0015003183132443f,
+            +0.0011580933593238f,
+            +0.0006321177902620f,
+            -0.0000000000000000f,
+            -0.0006430227388087f,
+            -0.0011983968887123f,
+            -0.0015793203394726f,
+            -0.0017242671286343f,
+            -0.0016068682231271f,
+            -0.0012405698966971f,
+            -0.0006772646755281f,
+            +0.0000000000000000f,
+            +0.0006892204361210f,
+            +0.0012847576591392f,
+            +0.0016934858076258f,
+            +0.0018493059669631f,
+            +0.0017237707599651f,
+            +0.0013311214589981f,
+            +0.0007268658796173f,
+            -0.0000000000000000f,
+            -0.0007400475576470f,
+            -0.0013798408428655f,
+            -0.0018192736090474f,
+            -0.0019871759980726f,
+            -0.0018527663211747f,
+            -0.0014311162698979f,
+            -0.0007816821280867f,
+            -0.0000000000000000f,
+            +0.0007963074380166f,
+            +0.0014851722351405f,
+            +0.0019587333132715f,
+            +0.0021401584365969f,
+            +0.0019960225324838f,
+            +0.0015422609694200f,
+            +0.0008426637433252f,
+            -0.0000000000000000f,
+            -0.0008590067399575f,
+            -0.0016026668439300f,
+            -0.0021144414419313f,
+            -0.0023111256784305f,
+            -0.0021562732766411f,
+            -0.0016667116412405f,
+            -0.0009110133597850f,
+            +0.0000000000000000f,
+            +0.0009294238386776f,
+            +0.0017347608983242f,
+            +0.0022896817175120f,
+            +0.0025037452585631f,
+            +0.0023370157470855f,
+            +0.0018072315848992f,
+            +0.0009882752774314f,
+            -0.0000000000000000f,
+            -0.0010092067759363f,
+            -0.0018846014569868f,
+            -0.0024887046828943f,
+            -0.0027227744515647f,
+            -0.0025427958945771f,
+            -0.0019674205281917f,
+            -0.0010764656603760f,
+            -0.0000000000000000f,
+            +0.0011005168604461f,
+            +0.0020563252400415f,
+            +0.0027171106990509f,
+            +0.0029744962743791f,
+            +0.0027796322666422f,
+            +0.0021520561025406f,
+            +0.0011782671613291f,
+            -0.0000000000000000f,
+            -0.0012062448218244f,
+            -0.0022554798386218f,
+            -0.0029824306129023f,
+            -0.0032673829621661f,
+            -0.0030556634044242f,
+            -0.0023676174337045f,
+            -0.0012973285093790f,
+            +0.0000000000000000f,
+            +0.0013303462191455f,
+            +0.0024896800129526f,
+            +0.0032950343248657f,
+            +0.0036131385656520f,
+            +0.0033821696306336f,
+            +0.0026231152191029f,
+            +0.0014387416282411f,
+            -0.0000000000000000f,
+            -0.0014783806389004f,
+            -0.0027696678603004f,
+            -0.0036696057283726f,
+            -0.0040284000224321f,
+            -0.0037752487737201f,
+            -0.0029314602273976f,
+            -0.0016098324726400f,
+            +0.0000000000000000f,
+            +0.0016584154175805f,
+            +0.0031110999485073f,
+            +0.0041276436853250f,
+            +0.0045376389746329f,
+            +0.0042586924015862f,
+            +0.0033118270632738f,
+            +0.0018215358629618f,
+            -0.0000000000000000f,
+            -0.0018826179106673f,
+            -0.0035377180289955f,
+            -0.0047019309718758f,
+            -0.0051783850292671f,
+            -0.0048692020312747f,
+            -0.0037939741429384f,
+            -0.0020909280707565f,
+            +0.0000000000000000f,
+            +0.0021702373733548f,
+            +0.0040873381521975f,
+            +0.0054450505591401f,
+            +0.0060112704762044f,
+            +0.0056665146997499f,
+            +0.0044267108361319f,
+            +0.0024462402988106f,
+            -0.0000000000000000f,
+            -0.0025536321604880f,
+            -0.0048240892838078f,
+            -0.0064469859120307f,
+            -0.0071410328640527f,
+            -0.0067548314820236f,
+            -0.0052960413297873f,
+            -0.0029377415945904f,
+            +0.0000000000000000f,
+            +0.0030917150116463f,
+            +0.0058661112123062f,
+            +0.0078755540900982f,
+            +0.0087655209903695f,
+            +0.0083336336720721f,
+            +0.0065689233428633f,
+            +0.0036644514474939f,
+            -0.0000000000000000f,
+            -0.0039042168331117f,
+            -0.0074575690912070f,
+            -0.0100837625780464f,
+            -0.0113087111344799f,
+            -0.0108388388156718f,
+            -0.0086178121407585f,
+            -0.0048521405614911f,
+            +0.0000000000000000f,
+            +0.0052774574907123f,
+            +0.0101977905950259f,
+            +0.0139625531246409f,
+            +0.0158729622117528f,
+            +0.0154405614214396f,
+            +0.0124773218921053f,
+            +0.0071515690865860f,
+            -0.0000000000000000f,
+            -0.0081085831206037f,
+            -0.0160560161434395f,
+            -0.0225959843179320f,
+            -0.0265002914821638f,
+            -0.0267129203475722f,
+            -0.0224928614847540f,
+            -0.0135273287192568f,
+            +0.0000000000000000f,
+            +0.0173960021011260f,
+            +0.0375041508293271f,
+            +0.0588061667423253f,
+            +0.0795689585716472f,
+            +0.0980207641422035f,
+            +0.1125365296562617f,
+            +0.1218111053324922f,
+            +0.1250000000000000f,
+            +0.1218111053324922f,
+            +0.1125365296562617f,
+            +0.0980207641422035f,
+            +0.0795689585716472f,
+            +0.0588061667423253f,
+            +0.0375041508293271f,
+            +0.0173960021011260f,
+            +0.0000000000000000f,
+            -0.0135273287192568f,
+            -0.0224928614847540f,
+            -0.0267129203475722f,
+            -0.0265002914821638f,
+            -0.0225959843179320f,
+            -0.0160560161434395f,
+            -0.0081085831206037f,
+            -0.0000000000000000f,
+            +0.0071515690865860f,
+            +0.0124773218921053f,
+            +0.0154405614214396f,
+            +0.0158729622117528f,
+            +0.0139625531246409f,
+            +0.0101977905950259f,
+            +0.0052774574907123f,
+            +0.0000000000000000f,
+            -0.0048521405614911f,
+            -0.0086178121407585f,
+            -0.0108388388156718f,
+            -0.0113087111344799f,
+            -0.0100837625780464f,
+            -0.0074575690912070f,
+            -0.0039042168331117f,
+            -0.0000000000000000f,
+            +0.0036644514474939f,
+            +0.0065689233428633f,
+            +0.0083336336720721f,
+            +0.0087655209903695f,
+            +0.0078755540900982f,
+            +0.0058661112123062f,
+            +0.0030917150116463f,
+            +0.0000000000000000f,
+            -0.0029377415945904f,
+            -0.0052960413297873f,
+            -0.0067548314820236f,
+            -0.0071410328640527f,
+            -0.0064469859120307f,
+            -0.0048240892838078f,
+            -0.0025536321604880f,
+            -0.0000000000000000f,
+            +0.0024462402988106f,
+            +0.0044267108361319f,
+            +0.0056665146997499f,
+            +0.0060112704762044f,
+            +0.0054450505591401f,
+            +0.0040873381521975f,
+            +0.0021702373733548f,
+            +0.0000000000000000f,
+            -0.0020909280707565f,
+            -0.0037939741429384f,
+            -0.0048692020312747f,
+            -0.0051783850292671f,
+            -0.0047019309718758f,
+            -0.0035377180289955f,
+            -0.0018826179106673f,
+            -0.0000000000000000f,
+            +0.0018215358629618f,
+            +0.0033118270632738f,
+            +0.0042586924015862f,
+            +0.0045376389746329f,
+            +0.0041276436853250f,
+            +0.0031110999485073f,
+            +0.0016584154175805f,
+            +0.0000000000000000f,
+            -0.0016098324726400f,
+            -0.0029314602273976f,
+            -0.0037752487737201f,
+            -0.0040284000224321f,
+            -0.0036696057283726f,
+            -0.0027696678603004f,
+            -0.0014783806389004f,
+            -0.0000000000000000f,
+            +0.0014387416282411f,
+            +0.0026231152191029f,
+            +0.0033821696306336f,
+            +0.0036131385656520f,
+            +0.0032950343248657f,
+            +0.0024896800129526f,
+            +0.0013303462191455f,
+            +0.0000000000000000f,
+            -0.0012973285093790f,
+            -0.0023676174337045f,
+            -0.0030556634044242f,
+            -0.0032673829621661f,
+            -0.0029824306129023f,
+            -0.0022554798386218f,
+            -0.0012062448218244f,
+            -0.0000000000000000f,
+            +0.0011782671613291f,
+            +0.0021520561025406f,
+            +0.0027796322666422f,
+            +0.0029744962743791f,
+            +0.0027171106990509f,
+            +0.0020563252400415f,
+            +0.0011005168604461f,
+            -0.0000000000000000f,
+            -0.0010764656603760f,
+            -0.0019674205281917f,
+            -0.0025427958945771f,
+            -0.0027227744515647f,
+            -0.0024887046828943f,
+            -0.0018846014569868f,
+            -0.0010092067759363f,
+            -0.0000000000000000f,
+            +0.0009882752774314f,
+            +0.0018072315848992f,
+            +0.0023370157470855f,
+            +0.0025037452585631f,
+            +0.0022896817175120f,
+            +0.0017347608983242f,
+            +0.0009294238386776f,
+            +0.0000000000000000f,
+            -0.0009110133597850f,
+            -0.0016667116412405f,
+            -0.0021562732766411f,
+            -0.0023111256784305f,
+            -0.0021144414419313f,
+            -0.0016026668439300f,
+            -0.0008590067399575f,
+            -0.0000000000000000f,
+            +0.0008426637433252f,
+            +0.0015422609694200f,
+            +0.0019960225324838f,
+            +0.0021401584365969f,
+            +0.0019587333132715f,
+            +0.0014851722351405f,
+            +0.0007963074380166f,
+            -0.0000000000000000f,
+            -0.0007816821280867f,
+            -0.0014311162698979f,
+            -0.0018527663211747f,
+            -0.0019871759980726f,
+            -0.0018192736090474f,
+            -0.0013798408428655f,
+            -0.0007400475576470f,
+            -0.0000000000000000f,
+            +0.0007268658796173f,
+            +0.0013311214589981f,
+            +0.0017237707599651f,
+            +0.0018493059669631f,
+            +0.0016934858076258f,
+            +0.0012847576591392f,
+            +0.0006892204361210f,
+            +0.0000000000000000f,
+            -0.0006772646755281f,
+            -0.0012405698966971f,
+            -0.0016068682231271f,
+            -0.0017242671286343f,
+            -0.0015793203394726f,
+            -0.0011983968887123f,
+            -0.0006430227388087f,
+            -0.0000000000000000f,
+            +0.0006321177902620f,
+            +0.0011580933593238f,
+            +0.0015003183132443f,
+            +0.0016102251835217f,
+            +0.0014751267713582f,
+            +0.0011195281094493f,
+            +0.0006008057289568f,
+            -0.0000000000000000f,
+            -0.0005908091912688f,
+            -0.0010825823589471f,
+            -0.0014027078552701f,
+            -0.0015056887382384f,
+            -0.0013795614511355f,
+            -0.0010471483174176f,
+            -0.0005620399023494f,
+            -0.0000000000000000f,
+            +0.0005528348113957f,
+            +0.0010131279476743f,
+            +0.0013128777052435f,
+            +0.0014094330296315f,
+            +0.0012915196419949f,
+            +0.0009804318922488f,
+            +0.0005262888971076f,
+            +0.0000000000000000f,
+            -0.0005177783117735f,
+            -0.0009489785383836f,
+            -0.0012298683437363f,
+            -0.0013204431210501f,
+            -0.0012100848901846f,
+            -0.0009186932011079f,
+            -0.0004931899592681f,
+            -0.0000000000000000f,
+            +0.0004852928716888f,
+            +0.0008895074073516f,
+            +0.0011528788595720f,
+            +0.0012378710074762f,
+            +0.0011344907274750f,
+            +0.0008613582668133f,
+            +0.0004624391193519f,
+            -0.0000000000000000f,
+            -0.0004550873263351f,
+            -0.0008341879175542f,
+            -0.0010812356300768f,
+            -0.0011610028115378f,
+            -0.0010640913390013f,
+            -0.0008079430361648f,
+            -0.0004337798055060f,
+            +0.0000000000000000f,
+            +0.0004269154875150f,
+            +0.0007825744038941f,
+            +0.0010143681245022f,
+            +0.0010892334050268f,
+            +0.0009983388395194f,
+            +0.0007580365214194f,
+            +0.0004069939981631f,
+            +0.0000000000000000f,
+            -0.0004005678259372f,
+            -0.0007342872660114f,
+            -0.0009517900092957f,
+            -0.0010220465659277f,
+            -0.0009367654836680f,
+            -0.0007112875857477f,
+            -0.0003818952880418f,
+            -0.0000000000000000f,
+            +0.0003758649273865f,
+            +0.0006890012261841f,
+            +0.0008930842473979f,
+            +0.0009589993114930f,
+            +0.0008789696037928f,
+            +0.0006673944855360f,
+            +0.0003583233761221f,
+            -0.0000000000000000f,
+            -0.0003526522964782f,
+            -0.0006464359949557f,
+            -0.0008378912399204f,
+            -0.0008997094165708f,
+            -0.0008246043946796f,
+            -0.0006260965209569f,
+            -0.0003361396777795f,
+            -0.0000000000000000f,
+            +0.0003307961949161f,
+            +0.0006063487874225f,
+            +0.0007858993091999f,
+            +0.0008438453862717f,
+            +0.0007733688945941f,
+            +0.0005871673149688f,
+            +0.0003152237807891f,
+            +0.0000000000000000f,
+            -0.0003101802816432f,
+            -0.0005685282757225f,
+            -0.0007368370009684f,
+            -0.0007911183376964f,
+            -0.0007250006766072f,
+            -0.0005504093618112f,
+            -0.0002954705697335f,
+            -0.0000000000000000f,
+            +0.0002907028802017f,
+            +0.0005327896660820f,
+            +0.0006904668124321f,
+            +0.0007412753796646f,
+            +0.0006792698833635f,
+            +0.0005156495737398f,
+            +0.0002767878749657f,
+            +0.0000000000000000f,
+            -0.0002722747408081f,
+            -0.0004989706637579f,
+            -0.0006465800473074f,
+            -0.0006940941775542f,
+            -0.0006359743257303f,
+            -0.0004827356190477f,
+            -0.0002590945377778f,
+            +0.0000000000000000f,
+            +0.0002548171957094f,
+            +0.0004669281444934f,
+            +0.0006049925684341f,
+            +0.0006493784629135f,
+            +0.0005949354303566f,
+            +0.0004515328920595f,
+            +0.0002423188082830f,
+            +0.0000000000000000f,
+            -0.0002382606294891f,
+            -0.0004365353922705f,
+            -0.0005655412704635f,
+            -0.0006069543016703f,
+            -0.0005559948694486f,
+            -0.0004219219914388f,
+            -0.0002263970111346f,
+            -0.0000000000000000f,
+            +0.0002225432033396f,
+            +0.0004076797940867f,
+            +0.0005280811341568f,
+            +0.0005666669755695f,
+            +0.0005190117424762f,
+            +0.0003937966100685f,
+            +0.0002112724282823f,
+            +0.0000000000000000f,
+            -0.0002076097854579f,
+            -0.0003802609059519f,
+            -0.0004924827534656f,
+            -0.0005283783624801f,
+            -0.0004838602072298f,
+            -0.0003670617602637f,
+            -0.0001968943586961f,
+            -0.0000000000000000f,
+            +0.0001934110497615f,
+            +0.0003541888222478f,
+            +0.0004586302492577f,
+            +0.0004919647249789f,
+            +0.0004504274788923f,
+            +0.0003416322738181f,
+            +0.0001832173232333f,
+            +0.0000000000000000f,
+            -0.0001799027128504f,
+            -0.0003293827944222f,
+            -0.0004264195010471f,
+            -0.0004573148349630f,
+            -0.0004186121322106f,
+            -0.0003174315285601f,
+            -0.0001702003892082f,
+            -0.0000000000000000f,
+            +0.0001670448851374f,
+            +0.0003057700557283f,
+            +0.0003957566416915f,
+            +0.0004243283763150f,
+            +0.0003883226546362f,
+            +0.0002943903625802f,
+            +0.0001578065942058f,
+            +0.0000000000000000f,
+            -0.0001548015167531f,
+            -0.0002832848171165f,
+            -0.0003665567706595f,
+            -0.0003929145788213f,
+            -0.0003594762083217f,
+            -0.0002724461447353f,
+            -0.0001460024525853f,
+            +0.0000000000000000f,
+            +0.0001431399225125f,
+            +0.0002618674059890f,
+            +0.0003387428498504f,
+            +0.0003629910453499f,
+            +0.0003319975667618f,
+            +0.0002515419759077f,
+            +0.0001347575312110f,
+            +0.0000000000000000f,
+            -0.0001320303731485f,
+            -0.0002414635247639f,
+            -0.0003122447525941f,
+            -0.0003344827412832f,
+            -0.0003058181981436f,
+            -0.0002316260001633f,
+            -0.0001240440833999f,
+            -0.0000000000000000f,
+            +0.0001214457423326f,
+            +0.0002220236103573f,
+            +0.0002869984417494f,
+            +0.0003073211207725f,
+            +0.0002808754724746f,
+            +0.0002126508086821f,
+            +0.0001138367320401f,
+            +0.0000000000000000f,
+            -0.0001113612008644f,
+            -0.0002035022790374f,
+            -0.0002629452570670f,
+            -0.0002814433688509f,
+            -0.0002571119735782f,
+            -0.0001945729223267f,
+            -0.0001041121944084f,
+            -0.0000000000000000f,
+            +0.0001017539509021f,
+            +0.0001858578437855f,
+            +0.0002400312954002f,
+            +0.0002567917420478f,
+            +0.0002344749002890f,
+            +0.0001773523411323f,
+            +0.0000948490424932f,
+            -0.0000000000000000f,
+            -0.0000926029943186f,
+            -0.0001690518934819f,
+            -0.0002182068701208f,
+            -0.0002333129930694f,
+            -0.0002129155438114f,
+            -0.0001609521509646f,
+            -0.0000860274936602f,
+            -0.0000000000000000f,
+            +0.0000838889302500f,
+            +0.0001530489250016f,
+            +0.0001974260383488f,
+            +0.0002109578674876f,
+            +0.0001923888303475f,
+            +0.0001453381791898f,
+            +0.0000776292273444f,
+            +0.0000000000000000f,
+            -0.0000755937777031f,
+            -0.0001378160207516f,
+            -0.0001776461864510f,
+            -0.0001896806623290f,
+            -0.0001728529198546f,
+            -0.0001304786925128f,
+            -0.0000696372241440f,
+            +0.0000000000000000f,
+            +0.0000677008197521f,
+            +0.0001233225653700f,
+            +0.0001588276657759f,
+            +0.0001694388380537f,
+            +0.0001542688532360f,
+            +0.0001163441312153f,
+            +0.0000620356242585f,
+            +0.0000000000000000f,
+            -0.0000601944663931f,
+            -0.0001095399962867f,
+            -0.0001409334718428f,
+            -0.0001501926767323f,
+            -0.0001366002414591f,
+            -0.0001029068749168f,
+            -0.0000548096026877f,
+            +0.0000000000000000f,
+            +0.0000530601335759f,
+            +0.0000964415836523f,
+            +0.0001239289612358f,
+            +0.0001319049803264f,
+            +0.0001198129910809f,
+            +0.0000901410357204f,
+            +0.0000479452589949f,
+            +0.0000000000000000f,
+            -0.0000462841363046f,
+            -0.0000840022358201f,
+            -0.0001077816013132f,
+            -0.0001145408038841f,
+            -0.0001038750614848f,
+            -0.0000780222752170f,
+            -0.0000414295197647f,
+            -0.0000000000000000f,
+            +0.0000398535940105f,
+            +0.0000721983271224f,
+            +0.0000924607485604f,
+            +0.0000980672192227f,
+            +0.0000887562498147f,
+            +0.0000665276423388f,
+            +0.0000352500521577f,
+            -0.0000000000000000f,
+            -0.0000337563466580f,
+            -0.0000610075451557f,
+            -0.0000779374520157f,
+            -0.0000824531053063f,
+            -0.0000744280001720f,
+            -0.0000556354294794f,
+            -0.0000293951871910f,
+            -0.0000000000000000f,
+            +0.0000279808802661f,
+            +0.0000504087551829f,
+            +0.0000641842787000f,
+            +0.0000676689620605f,
+            +0.0000608632341187f,
+            +0.0000453250446629f,
+            +0.0000238538515663f,
+            +0.0000000000000000f,
+            -0.0000225162607085f,
+            -0.0000403818795912f,
+            -0.0000511751584117f,
+            -0.0000536867448181f,
+            -0.0000480361999439f,
+            -0.0000355768978484f,
+            -0.0000186155070291f,
+            +0.0000000000000000f,
+            +0.0000173520748138f,
+            +0.0000309077906302f,
+            +0.0000388852456022f,
+            +0.0000404797169691f,
+            +0.0000359223384901f,
+            +0.0000263722997155f,
+            +0.0000136700963795f,
+            +0.0000000000000000f,
+            -0.0000124783779152f,
+            -0.0000219682148872f,
+            -0.0000272907963566f,
+            -0.0000280223187129f,
+            -0.0000244981636325f,
+            -0.0000176933714967f,
+            -0.0000090079953715f,
+            -0.0000000000000000f,
+            +0.0000078856471148f,
+            +0.0000135456481643f,
+            +0.0000163690587629f,
+            +0.0000162900500881f,
+            +0.0000137411557532f,
+            +0.0000095229646077f,
+            +0.0000046199698370f,
+            +0.0000000000000000f,
+            -0.0000035647396212f,
+            -0.0000056232795912f,
+            -0.0000060981751717f,
+            -0.0000052593666846f,
+            -0.0000036296667638f,
+            -0.0000018445889894f,
+            -0.0000004971374567f
+        };
+
         void lanczos_resample_2x2(float *dst, const float *src, size_t count)
         {
             while (count--)
@@ -4158,6 +7960,144 @@ namespace lsp
                 src     += 8;
             }
         }
+
+        void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count)
+        {
+            for (size_t i=0; i<count; ++i, src += factor)
+            {
+                float s     = 0.0f;
+                for (size_t j=0; j<taps; ++j)
+                    s          += k[j] * src[j];
+                dst[i]      = s;
+            }
+        }
+
+        // Decimation kernels are the oversampling kernels which have the gain of N at DC,
+        // the filter ends at the last sample of each N-sample block and reads history before src
+        void lanczos_decimate_2x2(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-5], lanczos_dec_2x2, 7, 2, count);
+        }
+
+        void lanczos_decimate_2x3(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-9], lanczos_dec_2x3, 11, 2, count);
+        }
+
+        void lanczos_decimate_2x4(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-13], lanczos_dec_2x4, 15, 2, count);
+        }
+
+        void lanczos_decimate_2x16bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-37], lanczos_dec_2x16bit, 39, 2, count);
+        }
+
+        void lanczos_decimate_2x24bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-245], lanczos_dec_2x24bit, 247, 2, count);
+        }
+
+        void lanczos_decimate_3x2(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-8], lanczos_dec_3x2, 11, 3, count);
+        }
+
+        void lanczos_decimate_3x3(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-14], lanczos_dec_3x3, 17, 3, count);
+        }
+
+        void lanczos_decimate_3x4(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-20], lanczos_dec_3x4, 23, 3, count);
+        }
+
+        void lanczos_decimate_3x16bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-56], lanczos_dec_3x16bit, 59, 3, count);
+        }
+
+        void lanczos_decimate_3x24bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-368], lanczos_dec_3x24bit, 371, 3, count);
+        }
+
+        void lanczos_decimate_4x2(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-11], lanczos_dec_4x2, 15, 4, count);
+        }
+
+        void lanczos_decimate_4x3(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-19], lanczos_dec_4x3, 23, 4, count);
+        }
+
+        void lanczos_decimate_4x4(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-27], lanczos_dec_4x4, 31, 4, count);
+        }
+
+        void lanczos_decimate_4x16bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-75], lanczos_dec_4x16bit, 79, 4, count);
+        }
+
+        void lanczos_decimate_4x24bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-491], lanczos_dec_4x24bit, 495, 4, count);
+        }
+
+        void lanczos_decimate_6x2(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-17], lanczos_dec_6x2, 23, 6, count);
+        }
+
+        void lanczos_decimate_6x3(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-29], lanczos_dec_6x3, 35, 6, count);
+        }
+
+        void lanczos_decimate_6x4(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-41], lanczos_dec_6x4, 47, 6, count);
+        }
+
+        void lanczos_decimate_6x16bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-113], lanczos_dec_6x16bit, 119, 6, count);
+        }
+
+        void lanczos_decimate_6x24bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-737], lanczos_dec_6x24bit, 743, 6, count);
+        }
+
+        void lanczos_decimate_8x2(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-23], lanczos_dec_8x2, 31, 8, count);
+        }
+
+        void lanczos_decimate_8x3(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-39], lanczos_dec_8x3, 47, 8, count);
+        }
+
+        void lanczos_decimate_8x4(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-55], lanczos_dec_8x4, 63, 8, count);
+        }
+
+        void lanczos_decimate_8x16bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-151], lanczos_dec_8x16bit, 159, 8, count);
+        }
+
+        void lanczos_decimate_8x24bit(float *dst, const float *src, size_t count)
+        {
+            dsp::fir_decimate(dst, &src[-983], lanczos_dec_8x24bit, 991, 8, count);
+        }
     } /* namespace generic */
 } /* namespace lsp */
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_RFFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static const float XRFFT_SMALL_W[] __lsp_aligned16 =
+        {
+            // cos(2*pi*k/16)
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f,
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            // sin(2*pi*k/16)
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f
+        };
+
+        static void real_small_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[16];
+            size_t items    = size_t(1) << rank;
+            size_t shift    = 4 - rank;
+            for (size_t i=0; i<items; ++i)
+                buf[i]          = src[i];
+
+            for (size_t k=0; k <= (items >> 1); ++k)
+            {
+                float re        = 0.0f;
+                float im        = 0.0f;
+                for (size_t i=0; i<items; ++i)
+                {
+                    size_t idx      = ((k * i) << shift) & 0xf;
+                    re             += buf[i] * XRFFT_SMALL_W[idx];
+                    im             -= buf[i] * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[k*2]        = re;
+                dst[k*2 + 1]    = im;
+            }
+        }
+
+        static void real_small_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[18];
+            size_t items    = size_t(1) << rank;
+            size_t half     = items >> 1;
+            size_t shift    = 4 - rank;
+            float k         = 1.0f / items;
+            for (size_t i=0; i<=half; ++i)
+            {
+                buf[i*2]        = src[i*2];
+                buf[i*2 + 1]    = src[i*2 + 1];
+            }
+
+            for (size_t i=0; i<items; ++i)
+            {
+                float re        = 0.0f;
+                for (size_t j=0; j<items; ++j)
+                {
+                    size_t idx      = ((i * j) << shift) & 0xf;
+                    float xr        = (j <= half) ? buf[j*2] : buf[(items - j)*2];
+                    float xi        = (j <= half) ? buf[j*2 + 1] : -buf[(items - j)*2 + 1];
+                    re             += xr * XRFFT_SMALL_W[idx] - xi * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[i]          = re * k;
+            }
+        }
+
+        /*
+         * The real FFT of 2^rank samples is computed as a complex FFT of 2^(rank-1) samples
+         * where even samples are considered as real part and odd samples as imaginary part.
+         * After that the spectrum is split into even and odd parts:
+         *   E[k] = (Z[k] + Z*[M-k])/2, O[k] = (Z[k] - Z*[M-k])/2, M = 2^(rank-1)
+         *   X[k] = E[k] - i * W^k * O[k], W = exp(-2*pi*i/N), N = 2^rank
+         * Each iteration processes the pair of harmonics k and M-k simultaneously.
+         */
+        static inline void real_fft_split_direct(float *a, float *b, float w_re, float w_im)
+        {
+            float er        = (a[0] + b[0]) * 0.5f;
+            float ei        = (a[1] - b[1]) * 0.5f;
+            float or_       = (a[0] - b[0]) * 0.5f;
+            float oi        = (a[1] + b[1]) * 0.5f;
+
+            float tr        = w_re * or_ + w_im * oi;
+            float ti        = w_re * oi - w_im * or_;
+
+            a[0]            = er + ti;
+            a[1]            = ei - tr;
+            b[0]            = er - ti;
+            b[1]            = -ei - tr;
+        }
+
+        static inline void real_fft_split_reverse(float *a, float *b, const float *sa, const float *sb, float w_re, float w_im)
+        {
+            float er        = (sa[0] + sb[0]) * 0.5f;
+            float ei        = (sa[1] - sb[1]) * 0.5f;
+            float dr        = (sa[0] - sb[0]) * 0.5f;
+            float di        = (sa[1] + sb[1]) * 0.5f;
+
+            float or_       = - w_re * di - w_im * dr;
+            float oi        = w_re * dr - w_im * di;
+
+            a[0]            = er + or_;
+            a[1]            = ei + oi;
+            b[0]            = er - or_;
+            b[1]            = oi - ei;
+        }
+
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 3)
+            {
+                real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            // Perform complex FFT of the half size
+            dsp::packed_direct_fft(dst, src, rank - 1);
+
+            // Compute the first and the middle harmonics
+            size_t half     = size_t(1) << (rank - 1);
+            float re        = dst[0];
+            float im        = dst[1];
+            dst[0]          = re + im;
+            dst[1]          = 0.0f;
+            dst[half*2]     = re - im;
+            dst[half*2 + 1] = 0.0f;
+            dst[half + 1]   = -dst[half + 1];
+
+            // Process the rest harmonics
+            const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+            const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+            const float *dw     = &XFFT_DW[(rank - 3) << 1];
+            float w_re[4], w_im[4], c_re, c_im;
+
+            w_re[0]         = iw_re[1];
+            w_re[1]         = iw_re[2];
+            w_re[2]         = iw_re[3];
+            w_re[3]         = dw[0];
+            w_im[0]         = iw_im[1];
+            w_im[1]         = iw_im[2];
+            w_im[2]         = iw_im[3];
+            w_im[3]         = dw[1];
+
+            float *a        = &dst[2];
+            float *b        = &dst[half*2 - 2];
+
+            for (size_t k=1, n=half >> 1; k < n; k += 4)
+            {
+                for (size_t i=0; (i < 4) && ((k + i) < n); ++i, a += 2, b -= 2)
+                    real_fft_split_direct(a, b, w_re[i], w_im[i]);
+
+                // Rotate w vector
+                for (size_t i=0; i<4; ++i)
+                {
+                    c_re            = w_re[i]*dw[0] - w_im[i]*dw[1];
+                    c_im            = w_re[i]*dw[1] + w_im[i]*dw[0];
+                    w_re[i]         = c_re;
+                    w_im[i]         = c_im;
+                }
+            }
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 3)
+            {
+                real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            // Compute the first and the middle harmonics
+            size_t half     = size_t(1) << (rank - 1);
+            float re        = src[0];
+            float im        = src[half*2];
+            dst[half]       = src[half];
+            dst[half + 1]   = -src[half + 1];
+            dst[0]          = (re + im) * 0.5f;
+            dst[1]          = (re - im) * 0.5f;
+
+            // Process the rest harmonics
+            const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+            const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+            const float *dw     = &XFFT_DW[(rank - 3) << 1];
+            float w_re[4], w_im[4], c_re, c_im;
+
+            w_re[0]         = iw_re[1];
+            w_re[1]         = iw_re[2];
+            w_re[2]         = iw_re[3];
+            w_re[3]         = dw[0];
+            w_im[0]         = iw_im[1];
+            w_im[1]         = iw_im[2];
+            w_im[2]         = iw_im[3];
+            w_im[3]         = dw[1];
+
+            float *a        = &dst[2];
+            float *b        = &dst[half*2 - 2];
+            const float *sa = &src[2];
+            const float *sb = &src[half*2 - 2];
+
+            for (size_t k=1, n=half >> 1; k < n; k += 4)
+            {
+                for (size_t i=0; (i < 4) && ((k + i) < n); ++i, a += 2, b -= 2, sa += 2, sb -= 2)
+                    real_fft_split_reverse(a, b, sa, sb, w_re[i], w_im[i]);
+
+                // Rotate w vector
+                for (size_t i=0; i<4; ++i)
+                {
+                    c_re            = w_re[i]*dw[0] - w_im[i]*dw[1];
+                    c_im            = w_re[i]*dw[1] + w_im[i]*dw[0];
+                    w_re[i]         = c_re;
+                    w_im[i]         = c_im;
+                }
+            }
+
+            // Perform reverse complex FFT of the half size
+            dsp::packed_reverse_fft(dst, dst, rank - 1);
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_RFFT_H_ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_SDFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_SDFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        void sdft_init(dsp::sdft_x8_t *bank, const float *freq, float length, size_t bins)
+        {
+            const double r      = exp(-1.0 / length);
+            const float k       = 2.0 * (1.0 - r);
+            const size_t banks  = (bins + 7) >> 3;
+
+            for (size_t i=0; i<banks; ++i)
+            {
+                dsp::sdft_x8_t *b   = &bank[i];
+                for (size_t j=0; j<8; ++j)
+                {
+                    size_t idx          = (i << 3) + j;
+                    b->re[j]            = 0.0f;
+                    b->im[j]            = 0.0f;
+                    b->__pad[j]         = 0.0f;
+                    if (idx < bins)
+                    {
+                        const double w      = 2.0 * M_PI * freq[idx];
+                        b->c[j]             = r * cos(w);
+                        b->s[j]             = r * sin(w);
+                        b->k[j]             = k;
+                    }
+                    else
+                    {
+                        b->c[j]             = 0.0f;
+                        b->s[j]             = 0.0f;
+                        b->k[j]             = 0.0f;
+                    }
+                }
+            }
+        }
+
+        void sdft_reset(dsp::sdft_x8_t *bank, size_t bins)
+        {
+            const size_t banks  = (bins + 7) >> 3;
+            for (size_t i=0; i<banks; ++i)
+            {
+                dsp::sdft_x8_t *b   = &bank[i];
+                for (size_t j=0; j<8; ++j)
+                {
+                    b->re[j]            = 0.0f;
+                    b->im[j]            = 0.0f;
+                }
+            }
+        }
+
+        void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count)
+        {
+            const size_t banks  = (bins + 7) >> 3;
+            for (size_t i=0; i<banks; ++i)
+            {
+                dsp::sdft_x8_t *b   = &bank[i];
+                for (size_t j=0; j<8; ++j)
+                {
+                    float re            = b->re[j];
+                    float im            = b->im[j];
+                    const float c       = b->c[j];
+                    const float s       = b->s[j];
+                    const float k       = b->k[j];
+
+                    for (size_t n=0; n<count; ++n)
+                    {
+                        float t             = c*re - s*im + k*src[n];
+                        im                  = s*re + c*im;
+                        re                  = t;
+                    }
+
+                    b->re[j]            = re;
+                    b->im[j]            = im;
+                }
+            }
+        }
+
+        void sdft_amplitude(float *dst, const dsp::sdft_x8_t *bank, size_t bins)
+        {
+            for (size_t i=0; i<bins; ++i)
+            {
+                const dsp::sdft_x8_t *b = &bank[i >> 3];
+                const size_t j      = i & 7;
+                dst[i]              = sqrtf(b->re[j]*b->re[j] + b->im[j]*b->im[j]);
+            }
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_SDFT_H_ */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_SPECTRUM_H_
+#define PRIVATE_DSP_ARCH_GENERIC_SPECTRUM_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static constexpr size_t SPECTRUM_BLOCK      = LSP_DSP_SPECTRUM_SMOOTH_MAX + 1;
+        static constexpr size_t SPECTRUM_NARROW     = 16;
+
+        void spectrum_log_map(uint32_t *map, float fmin, float fmax, float srate, size_t rank, size_t width)
+        {
+            const size_t nyquist    = size_t(1) << (rank - 1);
+            const double kf         = double(size_t(1) << rank) / srate;
+            const double kl         = log(double(fmax) / double(fmin)) / double(width);
+
+            for (size_t i=0; i<=width; ++i)
+            {
+                double bin          = kf * fmin * exp(kl * i) + 0.5;
+                map[i]              = (bin < double(nyquist)) ? uint32_t(bin) : uint32_t(nyquist);
+            }
+        }
+
+        /**
+         * Apply the box filter of (2*h + 1) samples to the buffer in place.
+         * The ring buffer keeps (h + 1) original values which are already overwritten.
+         */
+        static void spectrum_smooth(float *v, float *ring, size_t h, size_t width)
+        {
+            const size_t hi         = lsp_min(h, width - 1);
+            double sum              = 0.0;
+            for (size_t i=0; i<=hi; ++i)
+                sum                    += v[i];
+            size_t n                = hi + 1;
+
+            for (size_t i=0, r=0; i<width; ++i)
+            {
+                ring[r]                 = v[i];
+                v[i]                    = sum / n;
+                if ((i + h + 1) < width)
+                {
+                    sum                    += v[i + h + 1];
+                    ++n;
+                }
+                r                       = (r < h) ? r + 1 : 0;
+                if (i >= h)
+                {
+                    sum                    -= ring[r];
+                    --n;
+                }
+            }
+        }
+
+        void spectrum_display(float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width)
+        {
+            if (width <= 0)
+                return;
+
+            float buf[SPECTRUM_BLOCK] __lsp_aligned64;
+            const size_t end        = lsp_max(map[width], map[width-1] + 1);
+            size_t head             = 0;    // First bin stored in buffer
+            size_t tail             = 0;    // Last bin stored in buffer (exclusive)
+
+            // Magnitudes are computed block by block, wide columns take maximum and sum
+            // of squares of their range with the vectorized functions, narrow columns at
+            // low frequencies are processed inline to avoid the call overhead
+            for (size_t i=0; i<width; ++i)
+            {
+                const size_t first      = map[i];
+                const size_t last       = lsp_max(size_t(map[i+1]), first + 1);
+                float vmax, vsum;
+
+                if ((last <= tail) && ((last - first) < SPECTRUM_NARROW))
+                {
+                    // Narrow column, all bins are already in the buffer
+                    const float *v          = &buf[first - head];
+                    vmax                    = v[0];
+                    vsum                    = v[0] * v[0];
+                    for (size_t j=1, n=last-first; j<n; ++j)
+                    {
+                        vmax                    = lsp_max(vmax, v[j]);
+                        vsum                   += v[j] * v[j];
+                    }
+                }
+                else
+                {
+                    // Wide column, may span multiple blocks
+                    vmax                    = 0.0f;
+                    vsum                    = 0.0f;
+                    for (size_t k=first; k < last; )
+                    {
+                        if ((k < head) || (k >= tail))
+                        {
+                            head                    = k;
+                            tail                    = lsp_min(k + SPECTRUM_BLOCK, end);
+                            dsp::pcomplex_mod(buf, &spec[head * 2], tail - head);
+                        }
+
+                        const float *v          = &buf[k - head];
+                        const size_t n          = lsp_min(last, tail) - k;
+                        vmax                    = lsp_max(vmax, dsp::max(v, n));
+                        vsum                   += dsp::h_sqr_sum(v, n);
+                        k                      += n;
+                    }
+                }
+
+                peak[i]                 = vmax;
+                avg[i]                  = vsum / float(ssize_t(last - first));
+            }
+
+            // Fractional-octave smoothing of the average power
+            if (smooth > 0)
+                spectrum_smooth(avg, buf, lsp_min(smooth, LSP_DSP_SPECTRUM_SMOOTH_MAX), width);
+
+            // Convert to decibels
+            dsp::limit1(peak, LSP_DSP_AMPLIFICATION_THRESH, 1e+10f, width);
+            dsp::limit1(avg, LSP_DSP_AMPLIFICATION_THRESH * LSP_DSP_AMPLIFICATION_THRESH, 1e+20f, width);
+            dsp::logd1(peak, width);
+            dsp::logd1(avg, width);
+            dsp::mul_k2(peak, 20.0f, width);
+            dsp::mul_k2(avg, 10.0f, width);
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_SPECTRUM_H_ */
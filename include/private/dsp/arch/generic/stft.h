@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_STFT_H_
+#define PRIVATE_DSP_ARCH_GENERIC_STFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The input history and the overlap-add buffer have double size of the frame,
+         * so the data is moved to the beginning only once per 2^rank/hop frames
+         */
+        struct stft_t
+        {
+            size_t      rank;           // The rank of FFT
+            size_t      size;           // Size of the frame
+            size_t      hop;            // Distance between adjacent frames
+            size_t      fill;           // Number of input samples received since the last frame
+            size_t      ipos;           // Position of the end of the current frame in the input history
+            size_t      opos;           // Position of the current frame in the overlap-add buffer
+            uint8_t    *data;           // Allocated data
+            float      *awnd;           // Analysis window
+            float      *swnd;           // Synthesis window
+            float      *in;             // Input history
+            float      *ola;            // Overlap-add buffer
+            float      *frame;          // Time-domain frame
+            float      *spectrum;       // Spectrum of the frame
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t STFT_ALIGN          = 0x40;
+
+        void stft_reset(dsp::stft_t *st)
+        {
+            const size_t n  = st->size;
+
+            st->fill        = 0;
+            st->ipos        = n;
+            st->opos        = 0;
+            dsp::fill_zero(st->in, n * 2);
+            dsp::fill_zero(st->ola, n * 2);
+            dsp::fill_zero(st->spectrum, n + 2);
+        }
+
+        dsp::stft_t *stft_create(size_t rank, size_t hop, const float *window)
+        {
+            if ((rank < LSP_DSP_STFT_RANK_MIN) || (rank > LSP_DSP_STFT_RANK_MAX))
+                return NULL;
+            const size_t n      = size_t(1) << rank;
+            if ((hop <= 0) || (hop > n))
+                return NULL;
+
+            // Each buffer is aligned to the size of the cache line
+            const size_t spsize = (n + 2 + 0x0f) & ~size_t(0x0f);
+            size_t to_alloc     = n * 7 + spsize;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::stft_t) + STFT_ALIGN - 1) & ~(STFT_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + STFT_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + STFT_ALIGN - 1) & ~uintptr_t(STFT_ALIGN - 1));
+            dsp::stft_t *st     = reinterpret_cast<dsp::stft_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            st->rank            = rank;
+            st->size            = n;
+            st->hop             = hop;
+            st->data            = data;
+            st->awnd            = fptr;
+            st->swnd            = &fptr[n];
+            st->in              = &fptr[n * 2];
+            st->ola             = &fptr[n * 4];
+            st->frame           = &fptr[n * 6];
+            st->spectrum        = &fptr[n * 7];
+
+            // Compute the synthesis window: the sum of products of analysis and synthesis
+            // windows over all frames that overlap the same sample should be equal to 1
+            if (window != NULL)
+                dsp::copy(st->awnd, window, n);
+            else
+                dsp::fill_one(st->awnd, n);
+
+            for (size_t i=0; i<hop; ++i)
+            {
+                float norm          = 0.0f;
+                for (size_t j=i; j<n; j += hop)
+                    norm               += st->awnd[j] * st->awnd[j];
+                norm                = (norm > 0.0f) ? 1.0f / norm : 0.0f;
+                for (size_t j=i; j<n; j += hop)
+                    st->swnd[j]         = st->awnd[j] * norm;
+            }
+
+            stft_reset(st);
+
+            return st;
+        }
+
+        void stft_destroy(dsp::stft_t *st)
+        {
+            if (st != NULL)
+                free(st->data);
+        }
+
+        size_t stft_latency(const dsp::stft_t *st)
+        {
+            return st->size;
+        }
+
+        const float *stft_spectrum(const dsp::stft_t *st)
+        {
+            return st->spectrum;
+        }
+
+        size_t stft_process(dsp::stft_t *st, float *dst, const float *src, size_t count, dsp::stft_callback_t func, void *arg)
+        {
+            const size_t n      = st->size;
+            const size_t hop    = st->hop;
+            size_t frames       = 0;
+
+            while (count > 0)
+            {
+                // Append the input data to the history, the history should always contain the whole frame
+                size_t to_do        = lsp_min(count, hop - st->fill);
+                if ((st->ipos + to_do) > (n * 2))
+                {
+                    dsp::move(st->in, &st->in[st->ipos - n], n);
+                    st->ipos            = n;
+                }
+                dsp::copy(&st->in[st->ipos], src, to_do);
+
+                // Emit the output data which is not affected by the following frames anymore
+                if (dst != NULL)
+                {
+                    dsp::copy(dst, &st->ola[st->opos + st->fill], to_do);
+                    dst                += to_do;
+                }
+
+                st->ipos           += to_do;
+                st->fill           += to_do;
+                src                += to_do;
+                count              -= to_do;
+                if (st->fill < hop)
+                    break;
+
+                // Perform analysis of the frame
+                dsp::mul3(st->frame, &st->in[st->ipos - n], st->awnd, n);
+                dsp::real_direct_fft(st->spectrum, st->frame, st->rank);
+                if (func != NULL)
+                    func(arg, st->spectrum, st->rank);
+                st->fill            = 0;
+                ++frames;
+
+                // Perform synthesis of the frame and overlap-add it to the output
+                st->opos           += hop;
+                if ((st->opos + n) > (n * 2))
+                {
+                    size_t tail         = n * 2 - st->opos;
+                    dsp::move(st->ola, &st->ola[st->opos], tail);
+                    dsp::fill_zero(&st->ola[tail], st->opos);
+                    st->opos            = 0;
+                }
+
+                if (dst == NULL)
+                    continue;
+
+                dsp::real_reverse_fft(st->frame, st->spectrum, st->rank);
+                dsp::fmadd3(&st->ola[st->opos], st->frame, st->swnd, n);
+            }
+
+            return frames;
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_STFT_H_ */
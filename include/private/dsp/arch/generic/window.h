@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_WINDOW_H_
+#define PRIVATE_DSP_ARCH_GENERIC_WINDOW_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace generic
+    {
+        static constexpr size_t WINDOW_BLOCK        = 0x100;
+
+        static const float window_hann_coeffs[]             = { 0.5f, 0.5f };
+        static const float window_hamming_coeffs[]          = { 0.54f, 0.46f };
+        static const float window_blackman_coeffs[]         = { 0.42f, 0.5f, 0.08f };
+        static const float window_blackman_harris_coeffs[]  = { 0.35875f, 0.48829f, 0.14128f, 0.01168f };
+        static const float window_nuttall_coeffs[]          = { 0.355768f, 0.487396f, 0.144232f, 0.012604f };
+        static const float window_flat_top_coeffs[]         = { 0.21557895f, 0.41663158f, 0.277263158f, 0.083578947f, 0.006947368f };
+
+        static inline size_t window_period(size_t count, size_t mode)
+        {
+            return (mode == LSP_DSP_WINDOW_SYMMETRIC) ? count - 1 : count;
+        }
+
+        void window_cosine_sum(float *dst, const float *a, size_t terms, size_t count, size_t mode)
+        {
+            if (count <= 1)
+            {
+                if (count > 0)
+                    dst[0]          = 1.0f;
+                return;
+            }
+
+            float tmp[WINDOW_BLOCK] __lsp_aligned64;
+            const size_t period = window_period(count, mode);
+            const double kw     = (2.0 * M_PI) / double(period);
+
+            // The window is computed by blocks, each cosine term is generated by the vectorized
+            // cosf_kp1() function with the initial phase reduced to the single period
+            for (size_t off=0; off < count; off += WINDOW_BLOCK)
+            {
+                float *d            = &dst[off];
+                size_t to_do        = lsp_min(count - off, WINDOW_BLOCK);
+
+                dsp::fill(d, (terms > 0) ? a[0] : 0.0f, to_do);
+                for (size_t m=1; m<terms; ++m)
+                {
+                    dsp::cosf_kp1(tmp, kw * m, kw * ((m * off) % period), to_do);
+                    dsp::fmadd_k3(d, tmp, (m & 1) ? -a[m] : a[m], to_do);
+                }
+            }
+        }
+
+        void window_sine(float *dst, size_t count, size_t mode)
+        {
+            if (count <= 1)
+            {
+                if (count > 0)
+                    dst[0]          = 1.0f;
+                return;
+            }
+
+            dsp::sinf_kp1(dst, M_PI / double(window_period(count, mode)), 0.0f, count);
+        }
+
+        void window_hann(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_hann_coeffs, 2, count, mode);
+        }
+
+        void window_hamming(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_hamming_coeffs, 2, count, mode);
+        }
+
+        void window_blackman(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_blackman_coeffs, 3, count, mode);
+        }
+
+        void window_blackman_harris(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_blackman_harris_coeffs, 4, count, mode);
+        }
+
+        void window_nuttall(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_nuttall_coeffs, 4, count, mode);
+        }
+
+        void window_flat_top(float *dst, size_t count, size_t mode)
+        {
+            window_cosine_sum(dst, window_flat_top_coeffs, 5, count, mode);
+        }
+
+        static double window_bessel_i0(double x)
+        {
+            // Power series: I0(x) = sum { ((x/2)^k / k!)^2 }
+            const double q      = x * x * 0.25;
+            double s            = 1.0;
+            double t            = 1.0;
+
+            for (size_t k=1; k<256; ++k)
+            {
+                t                  *= q / double(k * k);
+                s                  += t;
+                if (t < s * 1e-12)
+                    break;
+            }
+
+            return s;
+        }
+
+        void window_kaiser(float *dst, float beta, size_t count, size_t mode)
+        {
+            if (count <= 1)
+            {
+                if (count > 0)
+                    dst[0]          = 1.0f;
+                return;
+            }
+
+            const double kn     = 2.0 / double(window_period(count, mode));
+            const double norm   = 1.0 / window_bessel_i0(beta);
+            for (size_t i=0; i<count; ++i)
+            {
+                double r            = double(i) * kn - 1.0;
+                double x            = 1.0 - r * r;
+                dst[i]              = window_bessel_i0(beta * sqrt(lsp_max(x, 0.0))) * norm;
+            }
+        }
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_WINDOW_H_ */
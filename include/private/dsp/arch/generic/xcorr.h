@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_XCORR_H_
+#define PRIVATE_DSP_ARCH_GENERIC_XCORR_H_
+
+#ifndef PRIVATE_DSP_ARCH_GENERIC_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_GENERIC_IMPL */
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * The second signal is stored time-reversed in the frame, so the product of spectra
+         * gives the cross-spectrum A*conj(B) with the ordinary complex multiplication
+         */
+        struct xcorr_t
+        {
+            size_t      rank;           // The rank of FFT
+            size_t      size;           // Size of the FFT frame
+            size_t      half;           // Number of signal samples in the frame
+            size_t      mode;           // Weighting of the cross-spectrum
+            size_t      fill;           // Number of samples received since the last frame
+            size_t      frames;         // Number of accumulated frames
+            uint8_t    *data;           // Allocated data
+            float      *ina;            // Input buffer of the first signal
+            float      *inb;            // Input buffer of the second signal
+            float      *frame;          // Time-domain frame
+            float      *sa;             // Spectrum of the first signal
+            float      *sb;             // Spectrum of the second signal
+            float      *acc;            // Accumulated cross-spectrum
+            float      *corr;           // Cross-correlation function
+        };
+    } /* namespace dsp */
+
+    namespace generic
+    {
+        static constexpr size_t XCORR_ALIGN         = 0x40;
+        static constexpr float  XCORR_PHAT_THRESH   = 1e-20f;
+
+        void xcorr_reset(dsp::xcorr_t *xc)
+        {
+            xc->fill        = 0;
+            xc->frames      = 0;
+            dsp::fill_zero(xc->acc, xc->size + 2);
+        }
+
+        dsp::xcorr_t *xcorr_create(size_t rank, size_t mode)
+        {
+            if ((rank < LSP_DSP_XCORR_RANK_MIN) || (rank > LSP_DSP_XCORR_RANK_MAX))
+                return NULL;
+            if ((mode != LSP_DSP_XCORR_PLAIN) && (mode != LSP_DSP_XCORR_PHAT))
+                return NULL;
+
+            // Each buffer is aligned to the size of the cache line
+            const size_t n      = size_t(1) << rank;
+            const size_t spsize = (n + 2 + 0x0f) & ~size_t(0x0f);
+            size_t to_alloc     = n * 3 + spsize * 3;
+
+            // Allocate memory
+            size_t szof_hdr     = (sizeof(dsp::xcorr_t) + XCORR_ALIGN - 1) & ~(XCORR_ALIGN - 1);
+            uint8_t *data       = static_cast<uint8_t *>(malloc(szof_hdr + to_alloc * sizeof(float) + XCORR_ALIGN));
+            if (data == NULL)
+                return NULL;
+
+            uint8_t *ptr        = reinterpret_cast<uint8_t *>((uintptr_t(data) + XCORR_ALIGN - 1) & ~uintptr_t(XCORR_ALIGN - 1));
+            dsp::xcorr_t *xc    = reinterpret_cast<dsp::xcorr_t *>(ptr);
+            float *fptr         = reinterpret_cast<float *>(ptr + szof_hdr);
+
+            xc->rank            = rank;
+            xc->size            = n;
+            xc->half            = n >> 1;
+            xc->mode            = mode;
+            xc->data            = data;
+            xc->ina             = fptr;
+            xc->inb             = &fptr[n >> 1];
+            xc->frame           = &fptr[n];
+            xc->corr            = &fptr[n * 2];
+            xc->sa              = &fptr[n * 3];
+            xc->sb              = &xc->sa[spsize];
+            xc->acc             = &xc->sb[spsize];
+
+            xcorr_reset(xc);
+
+            return xc;
+        }
+
+        void xcorr_destroy(dsp::xcorr_t *xc)
+        {
+            if (xc != NULL)
+                free(xc->data);
+        }
+
+        size_t xcorr_process(dsp::xcorr_t *xc, const float *a, const float *b, size_t count)
+        {
+            const size_t n      = xc->size;
+            const size_t m      = xc->half;
+            size_t frames       = 0;
+
+            while (count > 0)
+            {
+                // Append the input data
+                size_t to_do        = lsp_min(count, m - xc->fill);
+                dsp::copy(&xc->ina[xc->fill], a, to_do);
+                dsp::copy(&xc->inb[xc->fill], b, to_do);
+
+                xc->fill           += to_do;
+                a                  += to_do;
+                b                  += to_do;
+                count              -= to_do;
+                if (xc->fill < m)
+                    break;
+
+                // Spectrum of the first signal padded with zeros
+                dsp::copy(xc->frame, xc->ina, m);
+                dsp::fill_zero(&xc->frame[m], m);
+                dsp::real_direct_fft(xc->sa, xc->frame, xc->rank);
+
+                // Spectrum of the second signal reversed in time: frame[(n - i) % n] = b[i]
+                xc->frame[0]        = xc->inb[0];
+                dsp::fill_zero(&xc->frame[1], m);
+                dsp::reverse2(&xc->frame[m + 1], &xc->inb[1], m - 1);
+                dsp::real_direct_fft(xc->sb, xc->frame, xc->rank);
+
+                // Accumulate the cross-spectrum
+                dsp::pcomplex_mul3(xc->sa, xc->sa, xc->sb, m + 1);
+                dsp::add2(xc->acc, xc->sa, n + 2);
+
+                xc->fill            = 0;
+                ++xc->frames;
+                ++frames;
+            }
+
+            return frames;
+        }
+
+        float xcorr_estimate(dsp::xcorr_t *xc, float *corr)
+        {
+            const size_t n      = xc->size;
+            const size_t m      = xc->half;
+            if (corr == NULL)
+                corr                = xc->corr;
+
+            if (xc->frames <= 0)
+            {
+                dsp::fill_zero(corr, n);
+                return 0.0f;
+            }
+
+            // Apply weighting to the cross-spectrum and compute the cross-correlation function
+            dsp::copy(xc->sa, xc->acc, n + 2);
+            if (xc->mode == LSP_DSP_XCORR_PHAT)
+            {
+                dsp::pcomplex_mod(xc->sb, xc->sa, m + 1);
+                dsp::add_k2(xc->sb, XCORR_PHAT_THRESH, m + 1);
+                dsp::pcomplex_r2c_div2(xc->sa, xc->sb, m + 1);
+            }
+            dsp::real_reverse_fft(xc->frame, xc->sa, xc->rank);
+
+            // Reorder lags from -m to m-1
+            dsp::copy(corr, &xc->frame[m], m);
+            dsp::copy(&corr[m], xc->frame, m);
+
+            // Find the peak and refine its position with the parabolic interpolation
+            const size_t idx    = dsp::abs_max_index(corr, n);
+            float delta         = 0.0f;
+            if ((idx > 0) && (idx < (n - 1)))
+            {
+                const float y0      = corr[idx - 1];
+                const float y1      = corr[idx];
+                const float y2      = corr[idx + 1];
+                const float d       = y0 - 2.0f * y1 + y2;
+                if (d != 0.0f)
+                    delta               = lsp_max(-0.5f, lsp_min(0.5f * (y0 - y2) / d, 0.5f));
+            }
+
+            return float(ssize_t(idx) - ssize_t(m)) + delta;
+        }
+
+    } /* namespace generic */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_GENERIC_XCORR_H_ */
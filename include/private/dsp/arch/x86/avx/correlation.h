@@ -747,6 +747,265 @@ namespace lsp
             );
         }
 
+        void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count)
+        {
+            IF_ARCH_X86(
+                size_t off;
+            );
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("vxorpd          %%ymm0, %%ymm0, %%ymm0")        /* xv = 0 */
+                __ASM_EMIT("vxorpd          %%ymm1, %%ymm1, %%ymm1")        /* xa = 0 */
+                __ASM_EMIT("vxorpd          %%ymm2, %%ymm2, %%ymm2")        /* xb = 0 */
+                /* 8x blocks */
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm3")    /* ymm3 = a0 */
+                __ASM_EMIT("vmovupd         0x20(%[a], %[off]), %%ymm4")    /* ymm4 = a1 */
+                __ASM_EMIT("vmovupd         0x00(%[b], %[off]), %%ymm5")    /* ymm5 = b0 */
+                __ASM_EMIT("vmovupd         0x20(%[b], %[off]), %%ymm6")    /* ymm6 = b1 */
+                __ASM_EMIT("vmulpd          %%ymm5, %%ymm3, %%ymm7")        /* ymm7 = a0*b0 */
+                __ASM_EMIT("vmulpd          %%ymm3, %%ymm3, %%ymm3")        /* ymm3 = a0*a0 */
+                __ASM_EMIT("vmulpd          %%ymm5, %%ymm5, %%ymm5")        /* ymm5 = b0*b0 */
+                __ASM_EMIT("vaddpd          %%ymm7, %%ymm0, %%ymm0")        /* ymm0 = xv + a0*b0 */
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")        /* ymm1 = xa + a0*a0 */
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm2, %%ymm2")        /* ymm2 = xb + b0*b0 */
+                __ASM_EMIT("vmulpd          %%ymm6, %%ymm4, %%ymm7")        /* ymm7 = a1*b1 */
+                __ASM_EMIT("vmulpd          %%ymm4, %%ymm4, %%ymm4")        /* ymm4 = a1*a1 */
+                __ASM_EMIT("vmulpd          %%ymm6, %%ymm6, %%ymm6")        /* ymm6 = b1*b1 */
+                __ASM_EMIT("vaddpd          %%ymm7, %%ymm0, %%ymm0")        /* ymm0 = xv + a1*b1 */
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm1, %%ymm1")        /* ymm1 = xa + a1*a1 */
+                __ASM_EMIT("vaddpd          %%ymm6, %%ymm2, %%ymm2")        /* ymm2 = xb + b1*b1 */
+                __ASM_EMIT("add             $0x40, %[off]")                 /* ++off */
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                /* 4x block */
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm3")    /* ymm3 = a0 */
+                __ASM_EMIT("vmovupd         0x00(%[b], %[off]), %%ymm5")    /* ymm5 = b0 */
+                __ASM_EMIT("vmulpd          %%ymm5, %%ymm3, %%ymm7")        /* ymm7 = a0*b0 */
+                __ASM_EMIT("vmulpd          %%ymm3, %%ymm3, %%ymm3")        /* ymm3 = a0*a0 */
+                __ASM_EMIT("vmulpd          %%ymm5, %%ymm5, %%ymm5")        /* ymm5 = b0*b0 */
+                __ASM_EMIT("vaddpd          %%ymm7, %%ymm0, %%ymm0")        /* ymm0 = xv + a0*b0 */
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")        /* ymm1 = xa + a0*a0 */
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm2, %%ymm2")        /* ymm2 = xb + b0*b0 */
+                __ASM_EMIT("add             $0x20, %[off]")                 /* ++off */
+                __ASM_EMIT("sub             $4, %[count]")
+                __ASM_EMIT("4:")
+                /* Do horizontal sum */
+                __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm4")            /* xmm4 = xv2 xv3 */
+                __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm5")            /* xmm5 = xa2 xa3 */
+                __ASM_EMIT("vextractf128    $1, %%ymm2, %%xmm6")            /* xmm6 = xb2 xb3 */
+                __ASM_EMIT("vaddpd          %%xmm4, %%xmm0, %%xmm0")        /* xmm0 = xv0+xv2 xv1+xv3 */
+                __ASM_EMIT("vaddpd          %%xmm5, %%xmm1, %%xmm1")        /* xmm1 = xa0+xa2 xa1+xa3 */
+                __ASM_EMIT("vaddpd          %%xmm6, %%xmm2, %%xmm2")        /* xmm2 = xb0+xb2 xb1+xb3 */
+                __ASM_EMIT("vhaddpd         %%xmm0, %%xmm0, %%xmm0")        /* xmm0 = xv0+xv1+xv2+xv3 */
+                __ASM_EMIT("vhaddpd         %%xmm1, %%xmm1, %%xmm1")        /* xmm1 = xa0+xa1+xa2+xa3 */
+                __ASM_EMIT("vhaddpd         %%xmm2, %%xmm2, %%xmm2")        /* xmm2 = xb0+xb1+xb2+xb3 */
+                /* 1x blocks */
+                __ASM_EMIT("add             $3, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovsd          0x00(%[a], %[off]), %%xmm3")    /* xmm3 = a0 */
+                __ASM_EMIT("vmovsd          0x00(%[b], %[off]), %%xmm5")    /* xmm5 = b0 */
+                __ASM_EMIT("vmulsd          %%xmm5, %%xmm3, %%xmm7")        /* xmm7 = a0*b0 */
+                __ASM_EMIT("vmulsd          %%xmm3, %%xmm3, %%xmm3")        /* xmm3 = a0*a0 */
+                __ASM_EMIT("vmulsd          %%xmm5, %%xmm5, %%xmm5")        /* xmm5 = b0*b0 */
+                __ASM_EMIT("vaddsd          %%xmm7, %%xmm0, %%xmm0")        /* xmm0 = xv + a0*b0 */
+                __ASM_EMIT("vaddsd          %%xmm3, %%xmm1, %%xmm1")        /* xmm1 = xa + a0*a0 */
+                __ASM_EMIT("vaddsd          %%xmm5, %%xmm2, %%xmm2")        /* xmm2 = xb + b0*b0 */
+                __ASM_EMIT("add             $0x08, %[off]")                 /* ++off */
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jge             5b")
+                __ASM_EMIT("6:")
+                /* Store result */
+                __ASM_EMIT("vaddsd          0x00(%[corr]), %%xmm0, %%xmm0")
+                __ASM_EMIT("vaddsd          0x08(%[corr]), %%xmm1, %%xmm1")
+                __ASM_EMIT("vaddsd          0x10(%[corr]), %%xmm2, %%xmm2")
+                __ASM_EMIT("vmovsd          %%xmm0, 0x00(%[corr])")
+                __ASM_EMIT("vmovsd          %%xmm1, 0x08(%[corr])")
+                __ASM_EMIT("vmovsd          %%xmm2, 0x10(%[corr])")
+
+                : [corr] "+r" (corr), [off] "=&r" (off), [count] "+r" (count)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static const double corr_f64_const[] __lsp_aligned32 =
+        {
+            1e-18, 1e-18, 1e-18, 1e-18
+        };
+
+        void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+            const double *a_head, const double *b_head,
+            const double *a_tail, const double *b_tail,
+            size_t count)
+        {
+            IF_ARCH_I386(
+                void *ptr;
+            );
+
+            ARCH_X86_ASM
+            (
+                /* 4x blocks */
+                __ASM_EMIT32("subl          $4, %[count]")
+                __ASM_EMIT64("sub           $4, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovupd         0x00(%[a_head]), %%ymm0")       /* ymm0 = ah */
+                __ASM_EMIT("vmovupd         0x00(%[b_head]), %%ymm1")       /* ymm1 = bh */
+                __ASM_EMIT("vmovupd         0x00(%[a_tail]), %%ymm3")       /* ymm3 = at */
+                __ASM_EMIT("vmovupd         0x00(%[b_tail]), %%ymm4")       /* ymm4 = bt */
+                __ASM_EMIT("vmulpd          %%ymm1, %%ymm0, %%ymm2")        /* ymm2 = ah*bh */
+                __ASM_EMIT("vmulpd          %%ymm4, %%ymm3, %%ymm5")        /* ymm5 = at*bt */
+                __ASM_EMIT("vmulpd          %%ymm0, %%ymm0, %%ymm0")        /* ymm0 = ah*ah */
+                __ASM_EMIT("vmulpd          %%ymm1, %%ymm1, %%ymm1")        /* ymm1 = bh*bh */
+                __ASM_EMIT("vmulpd          %%ymm3, %%ymm3, %%ymm3")        /* ymm3 = at*at */
+                __ASM_EMIT("vmulpd          %%ymm4, %%ymm4, %%ymm4")        /* ymm4 = bt*bt */
+                __ASM_EMIT("vsubpd          %%ymm5, %%ymm2, %%ymm2")        /* ymm2 = DV = ah*bh - at*bt */
+                __ASM_EMIT("vsubpd          %%ymm3, %%ymm0, %%ymm0")        /* ymm0 = DA = ah*ah - at*at */
+                __ASM_EMIT("vsubpd          %%ymm4, %%ymm1, %%ymm1")        /* ymm1 = DB = bh*bh - bt*bt */
+
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm0, %%ymm0, %%ymm3") /* ymm3 = 0 0 DA[0] DA[1] */
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm1, %%ymm1, %%ymm4") /* ymm4 = 0 0 DB[0] DB[1] */
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm2, %%ymm2, %%ymm5") /* ymm5 = 0 0 DV[0] DV[1] */
+                __ASM_EMIT("vshufpd         $0x04, %%ymm0, %%ymm3, %%ymm3") /* ymm3 = 0 DA[0] DA[1] DA[2] */
+                __ASM_EMIT("vshufpd         $0x04, %%ymm1, %%ymm4, %%ymm4") /* ymm4 = 0 DB[0] DB[1] DB[2] */
+                __ASM_EMIT("vshufpd         $0x04, %%ymm2, %%ymm5, %%ymm5") /* ymm5 = 0 DV[0] DV[1] DV[2] */
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm0, %%ymm0")        /* ymm0 = DA[0] DA[0]+DA[1] DA[1]+DA[2] DA[2]+DA[3] */
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm1, %%ymm1")        /* ymm1 = DB[0] DB[0]+DB[1] DB[1]+DB[2] DB[2]+DB[3] */
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm2, %%ymm2")        /* ymm2 = DV[0] DV[0]+DV[1] DV[1]+DV[2] DV[2]+DV[3] */
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm0, %%ymm0, %%ymm3") /* ymm3 = 0 0 DA[0] DA[0]+DA[1] */
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm1, %%ymm1, %%ymm4") /* ymm4 = 0 0 DB[0] DB[0]+DB[1] */
+                __ASM_EMIT("vperm2f128      $0x08, %%ymm2, %%ymm2, %%ymm5") /* ymm5 = 0 0 DV[0] DV[0]+DV[1] */
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm0, %%ymm3")        /* ymm3 = DA[0] DA[0]+DA[1] DA[0]+DA[1]+DA[2] DA[0]+DA[1]+DA[2]+DA[3] */
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm1, %%ymm4")        /* ymm4 = DB[0] DB[0]+DB[1] DB[0]+DB[1]+DB[2] DB[0]+DB[1]+DB[2]+DB[3] */
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm2, %%ymm5")        /* ymm5 = DV[0] DV[0]+DV[1] DV[0]+DV[1]+DV[2] DV[0]+DV[1]+DV[2]+DV[3] */
+
+                __ASM_EMIT32("mov           %[corr], %[ptr]")
+                __ASM_EMIT32("vbroadcastsd  0x00(%[ptr]), %%ymm0")
+                __ASM_EMIT32("vbroadcastsd  0x08(%[ptr]), %%ymm1")
+                __ASM_EMIT32("vbroadcastsd  0x10(%[ptr]), %%ymm2")
+                __ASM_EMIT64("vbroadcastsd  0x00(%[corr]), %%ymm0")
+                __ASM_EMIT64("vbroadcastsd  0x08(%[corr]), %%ymm1")
+                __ASM_EMIT64("vbroadcastsd  0x10(%[corr]), %%ymm2")
+
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")        /* ymm1 = BA = xa+DA[0] xa+DA[0]+DA[1] ... */
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm2, %%ymm2")        /* ymm2 = BB = xb+DB[0] xb+DB[0]+DB[1] ... */
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm0, %%ymm0")        /* ymm0 = T = xv+DV[0] xv+DV[0]+DV[1] ... */
+                __ASM_EMIT("vmulpd          %%ymm2, %%ymm1, %%ymm7")        /* ymm7 = B = BA*BB */
+                __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm3")            /* xmm3 = T[2] T[3] */
+                __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm4")            /* xmm4 = BA[2] BA[3] */
+                __ASM_EMIT("vextractf128    $1, %%ymm2, %%xmm5")            /* xmm5 = BB[2] BB[3] */
+
+                __ASM_EMIT32("vmovhpd       %%xmm3, 0x00(%[ptr])")
+                __ASM_EMIT32("vmovhpd       %%xmm4, 0x08(%[ptr])")
+                __ASM_EMIT32("vmovhpd       %%xmm5, 0x10(%[ptr])")
+                __ASM_EMIT64("vmovhpd       %%xmm3, 0x00(%[corr])")
+                __ASM_EMIT64("vmovhpd       %%xmm4, 0x08(%[corr])")
+                __ASM_EMIT64("vmovhpd       %%xmm5, 0x10(%[corr])")
+
+                __ASM_EMIT("vsqrtpd         %%ymm7, %%ymm6")                /* ymm6 = sqrt(B) */
+                __ASM_EMIT("vcmppd          $5, %[CORR_CC], %%ymm7, %%ymm1")/* ymm1 = B >= threshold */
+                __ASM_EMIT("vdivpd          %%ymm6, %%ymm0, %%ymm0")        /* ymm0 = T/sqrt(B) */
+                __ASM_EMIT32("mov           %[dst], %[ptr]")
+                __ASM_EMIT("vandpd          %%ymm1, %%ymm0, %%ymm0")        /* ymm0 = (B >= threshold) ? T/sqrt(B) : 0 */
+                __ASM_EMIT("add             $0x20, %[a_head]")              /* ++a_head */
+                __ASM_EMIT("add             $0x20, %[b_head]")              /* ++b_head */
+                __ASM_EMIT32("vmovupd       %%ymm0, 0x00(%[ptr])")
+                __ASM_EMIT64("vmovupd       %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x20, %[a_tail]")              /* ++a_tail */
+                __ASM_EMIT("add             $0x20, %[b_tail]")              /* ++b_tail */
+                __ASM_EMIT32("add           $0x20, %[ptr]")
+                __ASM_EMIT64("add           $0x20, %[dst]")
+                __ASM_EMIT32("mov           %[ptr], %[dst]")
+                __ASM_EMIT32("subl          $4, %[count]")
+                __ASM_EMIT64("sub           $4, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                /* 1x blocks */
+                __ASM_EMIT32("addl          $3, %[count]")
+                __ASM_EMIT64("add           $3, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovsd          0x00(%[a_head]), %%xmm0")       /* xmm0 = ah */
+                __ASM_EMIT("vmovsd          0x00(%[b_head]), %%xmm1")       /* xmm1 = bh */
+                __ASM_EMIT("vmovsd          0x00(%[a_tail]), %%xmm3")       /* xmm3 = at */
+                __ASM_EMIT("vmovsd          0x00(%[b_tail]), %%xmm4")       /* xmm4 = bt */
+                __ASM_EMIT("vmulsd          %%xmm1, %%xmm0, %%xmm2")        /* xmm2 = ah*bh */
+                __ASM_EMIT("vmulsd          %%xmm4, %%xmm3, %%xmm5")        /* xmm5 = at*bt */
+                __ASM_EMIT("vmulsd          %%xmm0, %%xmm0, %%xmm0")        /* xmm0 = ah*ah */
+                __ASM_EMIT("vmulsd          %%xmm1, %%xmm1, %%xmm1")        /* xmm1 = bh*bh */
+                __ASM_EMIT("vmulsd          %%xmm3, %%xmm3, %%xmm3")        /* xmm3 = at*at */
+                __ASM_EMIT("vmulsd          %%xmm4, %%xmm4, %%xmm4")        /* xmm4 = bt*bt */
+                __ASM_EMIT("vsubsd          %%xmm5, %%xmm2, %%xmm2")        /* xmm2 = DV = ah*bh - at*bt */
+                __ASM_EMIT("vsubsd          %%xmm3, %%xmm0, %%xmm0")        /* xmm0 = DA = ah*ah - at*at */
+                __ASM_EMIT("vsubsd          %%xmm4, %%xmm1, %%xmm1")        /* xmm1 = DB = bh*bh - bt*bt */
+
+                __ASM_EMIT32("mov           %[corr], %[ptr]")
+                __ASM_EMIT32("vaddsd        0x00(%[ptr]), %%xmm2, %%xmm2")  /* xmm2 = T = xv+DV */
+                __ASM_EMIT32("vaddsd        0x08(%[ptr]), %%xmm0, %%xmm0")  /* xmm0 = BA = xa+DA */
+                __ASM_EMIT32("vaddsd        0x10(%[ptr]), %%xmm1, %%xmm1")  /* xmm1 = BB = xb+DB */
+                __ASM_EMIT64("vaddsd        0x00(%[corr]), %%xmm2, %%xmm2") /* xmm2 = T = xv+DV */
+                __ASM_EMIT64("vaddsd        0x08(%[corr]), %%xmm0, %%xmm0") /* xmm0 = BA = xa+DA */
+                __ASM_EMIT64("vaddsd        0x10(%[corr]), %%xmm1, %%xmm1") /* xmm1 = BB = xb+DB */
+                __ASM_EMIT("vmulsd          %%xmm1, %%xmm0, %%xmm7")        /* xmm7 = B = BA*BB */
+
+                __ASM_EMIT32("vmovsd        %%xmm2, 0x00(%[ptr])")
+                __ASM_EMIT32("vmovsd        %%xmm0, 0x08(%[ptr])")
+                __ASM_EMIT32("vmovsd        %%xmm1, 0x10(%[ptr])")
+                __ASM_EMIT64("vmovsd        %%xmm2, 0x00(%[corr])")
+                __ASM_EMIT64("vmovsd        %%xmm0, 0x08(%[corr])")
+                __ASM_EMIT64("vmovsd        %%xmm1, 0x10(%[corr])")
+
+                __ASM_EMIT("vsqrtsd         %%xmm7, %%xmm7, %%xmm6")        /* xmm6 = sqrt(B) */
+                __ASM_EMIT("vcmpsd          $5, %[CORR_CC], %%xmm7, %%xmm1")/* xmm1 = B >= threshold */
+                __ASM_EMIT("vdivsd          %%xmm6, %%xmm2, %%xmm0")        /* xmm0 = T/sqrt(B) */
+                __ASM_EMIT32("mov           %[dst], %[ptr]")
+                __ASM_EMIT("vandpd          %%xmm1, %%xmm0, %%xmm0")        /* xmm0 = (B >= threshold) ? T/sqrt(B) : 0 */
+                __ASM_EMIT("add             $0x08, %[a_head]")              /* ++a_head */
+                __ASM_EMIT("add             $0x08, %[b_head]")              /* ++b_head */
+                __ASM_EMIT32("vmovsd        %%xmm0, 0x00(%[ptr])")
+                __ASM_EMIT64("vmovsd        %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add             $0x08, %[a_tail]")              /* ++a_tail */
+                __ASM_EMIT("add             $0x08, %[b_tail]")              /* ++b_tail */
+                __ASM_EMIT32("add           $0x08, %[ptr]")
+                __ASM_EMIT64("add           $0x08, %[dst]")
+                __ASM_EMIT32("mov           %[ptr], %[dst]")
+                __ASM_EMIT32("decl          %[count]")
+                __ASM_EMIT64("dec           %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+
+                : __IF_32(
+                    [ptr] "=&r" (ptr),
+                    [corr] "+m" (corr), [dst] "+m" (dst),
+                    [a_head] "+r" (a_head), [b_head] "+r" (b_head),
+                    [a_tail] "+r" (a_tail), [b_tail] "+r" (b_tail),
+                    [count] "+m" (count)
+                  )
+                  __IF_64(
+                    [dst] "+r" (dst),
+                    [a_head] "+r" (a_head), [b_head] "+r" (b_head),
+                    [a_tail] "+r" (a_tail), [b_tail] "+r" (b_tail),
+                    [count] "+r" (count)
+                  )
+                : __IF_64( [corr] "r" (corr), )
+                  [CORR_CC] "o" (corr_f64_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
     } /* namespace avx */
 } /* namespace lsp */
 
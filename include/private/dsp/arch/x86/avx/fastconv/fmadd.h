@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        #define FMA_OFF(a, b)       a
+        #define FMA_ON(a, b)        b
+
+        #define FASTCONV_FMADD_CORE(FMA_SEL) \
+            size_t items    = size_t(1) << (rank + 1); \
+            ARCH_X86_ASM( \
+                __ASM_EMIT("1:") \
+                    __ASM_EMIT("vmovups         0x00(%[c1]), %%ymm0")                           /* ymm0 = r0 */ \
+                    __ASM_EMIT("vmovups         0x20(%[c1]), %%ymm1")                           /* ymm1 = i0 */ \
+                    /* Apply convolution */ \
+                    __ASM_EMIT("vmulps          0x20(%[c2]), %%ymm1, %%ymm3")                   /* ymm3 = i0*I */ \
+                    __ASM_EMIT("vmulps          0x20(%[c2]), %%ymm0, %%ymm2")                   /* ymm2 = r0*I */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2]), %%ymm0, %%ymm0", ""))              /* ymm0 = r0*R */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2]), %%ymm1, %%ymm1", ""))              /* ymm1 = i0*R */ \
+                    __ASM_EMIT(FMA_SEL("vsubps  %%ymm3, %%ymm0, %%ymm0", "vfmsub132ps 0x00(%[c2]), %%ymm3, %%ymm0")) /* ymm0 = r0*R - i0*I */ \
+                    __ASM_EMIT(FMA_SEL("vaddps  %%ymm2, %%ymm1, %%ymm1", "vfmadd132ps 0x00(%[c2]), %%ymm2, %%ymm1")) /* ymm1 = r0*I + i0*R */ \
+                    /* Accumulate */ \
+                    __ASM_EMIT("vaddps          0x00(%[dst]), %%ymm0, %%ymm0") \
+                    __ASM_EMIT("vaddps          0x20(%[dst]), %%ymm1, %%ymm1") \
+                    __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])") \
+                    __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])") \
+                __ASM_EMIT("add             $0x40, %[c1]") \
+                __ASM_EMIT("add             $0x40, %[c2]") \
+                __ASM_EMIT("add             $0x40, %[dst]") \
+                __ASM_EMIT("sub             $16, %[items]") \
+                __ASM_EMIT("jnz             1b") \
+                : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2), \
+                  [items] "+r" (items) \
+                : \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3" \
+            )
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            FASTCONV_FMADD_CORE(FMA_OFF);
+        }
+
+        void fastconv_fmadd_fma3(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            FASTCONV_FMADD_CORE(FMA_ON);
+        }
+
+    #undef FASTCONV_FMADD_CORE
+    #undef FMA_ON
+    #undef FMA_OFF
+    }
+}
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FASTCONV_FMADD_H_ */
@@ -43,6 +43,14 @@
 #define FFT_FMA(a, b)                   a
 #include <private/dsp/arch/x86/avx/fft/scramble.h>
 
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME   scramble_self_direct32
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME  scramble_self_reverse32
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME   scramble_copy_direct32
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME  scramble_copy_reverse32
+#define FFT_TYPE                        uint32_t
+#define FFT_FMA(a, b)                   a
+#include <private/dsp/arch/x86/avx/fft/scramble.h>
+
 #define FFT_SCRAMBLE_SELF_DIRECT_NAME   scramble_self_direct8_fma3
 #define FFT_SCRAMBLE_SELF_REVERSE_NAME  scramble_self_reverse8_fma3
 #define FFT_SCRAMBLE_COPY_DIRECT_NAME   scramble_copy_direct8_fma3
@@ -59,6 +67,14 @@
 #define FFT_FMA(a, b)                   b
 #include <private/dsp/arch/x86/avx/fft/scramble.h>
 
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME   scramble_self_direct32_fma3
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME  scramble_self_reverse32_fma3
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME   scramble_copy_direct32_fma3
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME  scramble_copy_reverse32_fma3
+#define FFT_TYPE                        uint32_t
+#define FFT_FMA(a, b)                   b
+#include <private/dsp/arch/x86/avx/fft/scramble.h>
+
 namespace lsp
 {
     namespace avx
@@ -162,15 +178,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_direct8(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_direct16(dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 12)
                     scramble_copy_direct8(dst_re, dst_im, src_re, src_im, rank-4);
-                else
+                else if (rank <= 20)
                     scramble_copy_direct16(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_direct32(dst_re, dst_im, src_re, src_im, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -192,15 +212,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_direct8_fma3(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_direct16_fma3(dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32_fma3(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 12)
                     scramble_copy_direct8_fma3(dst_re, dst_im, src_re, src_im, rank-4);
-                else
+                else if (rank <= 20)
                     scramble_copy_direct16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_direct32_fma3(dst_re, dst_im, src_re, src_im, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -222,15 +246,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_reverse8(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_reverse16(dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 12)
                     scramble_copy_reverse8(dst_re, dst_im, src_re, src_im, rank-4);
-                else
+                else if (rank <= 20)
                     scramble_copy_reverse16(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_reverse32(dst_re, dst_im, src_re, src_im, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -254,15 +282,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_reverse8_fma3(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_reverse16_fma3(dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32_fma3(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 12)
                     scramble_copy_reverse8_fma3(dst_re, dst_im, src_re, src_im, rank-4);
-                else
+                else if (rank <= 20)
                     scramble_copy_reverse16_fma3(dst_re, dst_im, src_re, src_im, rank-4);
+                else
+                    scramble_copy_reverse32_fma3(dst_re, dst_im, src_re, src_im, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FFT_F64_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FFT_F64_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        // Maximum number of twiddle factor rotations before computing it from the exact value
+        static constexpr size_t FFT_F64_RESEED      = 0x100;
+
+        // Rotation step of twiddle factors for the butterfly of size N: cos(pi/N), sin(pi/N)
+        static const double XFFT_F64_DW[] __lsp_aligned32 =
+        {
+            -1.0, 0.0,                                     // N = 2^0
+            0.0, 1.0,                                      // N = 2^1
+            0.7071067811865476, 0.7071067811865476,        // N = 2^2
+            0.9238795325112867, 0.3826834323650898,        // N = 2^3
+            0.9807852804032304, 0.19509032201612828,       // N = 2^4
+            0.9951847266721969, 0.0980171403295606,        // N = 2^5
+            0.9987954562051724, 0.049067674327418015,      // N = 2^6
+            0.9996988186962042, 0.024541228522912288,      // N = 2^7
+            0.9999247018391445, 0.012271538285719925,      // N = 2^8
+            0.9999811752826011, 0.006135884649154475,      // N = 2^9
+            0.9999952938095762, 0.003067956762965976,      // N = 2^10
+            0.9999988234517019, 0.0015339801862847657,     // N = 2^11
+            0.9999997058628822, 0.0007669903187427045,     // N = 2^12
+            0.9999999264657179, 0.00038349518757139556,    // N = 2^13
+            0.9999999816164293, 0.00019174759731070332,    // N = 2^14
+            0.9999999954041073, 9.587379909597734e-05,     // N = 2^15
+            0.9999999988510269, 4.793689960306688e-05,     // N = 2^16
+            0.9999999997127567, 2.396844980841822e-05,     // N = 2^17
+            0.9999999999281892, 1.1984224905069707e-05,    // N = 2^18
+            0.9999999999820472, 5.9921124526424275e-06,    // N = 2^19
+            0.9999999999955118, 2.996056226334661e-06,     // N = 2^20
+            0.999999999998878, 1.4980281131690111e-06,     // N = 2^21
+            0.9999999999997194, 7.490140565847157e-07,     // N = 2^22
+            0.9999999999999298, 3.7450702829238413e-07,    // N = 2^23
+            0.9999999999999825, 1.8725351414619535e-07,    // N = 2^24
+            0.9999999999999957, 9.362675707309808e-08,     // N = 2^25
+            0.9999999999999989, 4.6813378536549095e-08,    // N = 2^26
+            0.9999999999999998, 2.3406689268274554e-08,    // N = 2^27
+            0.9999999999999999, 1.1703344634137277e-08,    // N = 2^28
+            1.0, 5.8516723170686385e-09,                   // N = 2^29
+            1.0, 2.9258361585343192e-09,                   // N = 2^30
+            1.0, 1.4629180792671596e-09,                   // N = 2^31
+        };
+
+        static void scramble_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            size_t items    = size_t(1) << rank;
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                // First copy data, then swap elements at bit-reversed positions
+                if (dst_re != src_re)
+                    ::memmove(dst_re, src_re, items * sizeof(double));
+                if (dst_im != src_im)
+                    ::memmove(dst_im, src_im, items * sizeof(double));
+
+                for (size_t i = 1; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    if (i >= j)
+                        continue;
+
+                    double re       = dst_re[i];
+                    double im       = dst_im[i];
+                    dst_re[i]       = dst_re[j];
+                    dst_im[i]       = dst_im[j];
+                    dst_re[j]       = re;
+                    dst_im[j]       = im;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    dst_re[i]       = src_re[j];
+                    dst_im[i]       = src_im[j];
+                }
+            }
+        }
+
+    /*
+     * Butterfly stage for four butterflies per iteration:
+     * ymm6 = wr, ymm7 = wi, 0x40(w) = dr, 0x60(w) = di
+     */
+    #define FFT_F64_BUTTERFLY_STAGE(FMA_SEL) \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vmovapd     0x00(%[w]), %%ymm6")                        /* ymm6 = wr */ \
+        __ASM_EMIT("vmovapd     0x20(%[w]), %%ymm7")                        /* ymm7 = wi */ \
+        __ASM_EMIT("mov         %[len], %[count]")                          /* count = len */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("vmovupd     0x00(%[re], %[n], 8), %%ymm0")              /* ymm0 = br */ \
+        __ASM_EMIT("vmovupd     0x00(%[im], %[n], 8), %%ymm1")              /* ymm1 = bi */ \
+        __ASM_EMIT("vmulpd      %%ymm7, %%ymm1, %%ymm2")                    /* ymm2 = wi*bi */ \
+        __ASM_EMIT("vmulpd      %%ymm7, %%ymm0, %%ymm3")                    /* ymm3 = wi*br */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      %%ymm6, %%ymm0, %%ymm0", ""))       /* ymm0 = wr*br */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      %%ymm6, %%ymm1, %%ymm1", ""))       /* ymm1 = wr*bi */ \
+        __ASM_EMIT(FMA_SEL("vsubpd      %%ymm2, %%ymm0, %%ymm0", "vfmsub132pd %%ymm6, %%ymm2, %%ymm0"))   /* ymm0 = cr = wr*br - wi*bi */ \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm3, %%ymm1, %%ymm1", "vfmadd132pd %%ymm6, %%ymm3, %%ymm1"))   /* ymm1 = ci = wr*bi + wi*br */ \
+        __ASM_EMIT("vmovupd     0x00(%[re]), %%ymm4")                       /* ymm4 = ar */ \
+        __ASM_EMIT("vmovupd     0x00(%[im]), %%ymm5")                       /* ymm5 = ai */ \
+        __ASM_EMIT("vsubpd      %%ymm0, %%ymm4, %%ymm2")                    /* ymm2 = ar - cr */ \
+        __ASM_EMIT("vsubpd      %%ymm1, %%ymm5, %%ymm3")                    /* ymm3 = ai - ci */ \
+        __ASM_EMIT("vaddpd      %%ymm0, %%ymm4, %%ymm4")                    /* ymm4 = ar + cr */ \
+        __ASM_EMIT("vaddpd      %%ymm1, %%ymm5, %%ymm5")                    /* ymm5 = ai + ci */ \
+        __ASM_EMIT("vmovupd     %%ymm4, 0x00(%[re])") \
+        __ASM_EMIT("vmovupd     %%ymm5, 0x00(%[im])") \
+        __ASM_EMIT("vmovupd     %%ymm2, 0x00(%[re], %[n], 8)") \
+        __ASM_EMIT("vmovupd     %%ymm3, 0x00(%[im], %[n], 8)") \
+        /* Rotate twiddle factors */ \
+        __ASM_EMIT("vmulpd      0x60(%[w]), %%ymm7, %%ymm0")                /* ymm0 = wi*di */ \
+        __ASM_EMIT("vmulpd      0x60(%[w]), %%ymm6, %%ymm1")                /* ymm1 = wr*di */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      0x40(%[w]), %%ymm6, %%ymm6", "vfmsub132pd 0x40(%[w]), %%ymm0, %%ymm6"))   /* ymm6 = wr*dr - wi*di */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      0x40(%[w]), %%ymm7, %%ymm7", "vfmadd132pd 0x40(%[w]), %%ymm1, %%ymm7"))   /* ymm7 = wi*dr + wr*di */ \
+        __ASM_EMIT(FMA_SEL("vsubpd      %%ymm0, %%ymm6, %%ymm6", "")) \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm1, %%ymm7, %%ymm7", "")) \
+        __ASM_EMIT("add         $0x20, %[re]") \
+        __ASM_EMIT("add         $0x20, %[im]") \
+        __ASM_EMIT("sub         $4, %[count]") \
+        __ASM_EMIT("jnz         2b") \
+        /* Move to the same butterflies of the next block */ \
+        __ASM_EMIT("add         %[skip], %[re]") \
+        __ASM_EMIT("add         %[skip], %[im]") \
+        __ASM_EMIT("dec         %[blocks]") \
+        __ASM_EMIT("jnz         1b")
+
+    #define FFT_F64_BUTTERFLY(FMA_SEL) \
+        size_t items    = size_t(1) << rank; \
+        size_t count    = items; \
+        double *re      = dst_re; \
+        double *im      = dst_im; \
+        double w[16] __lsp_aligned32; \
+        \
+        /* First two stages: radix-4 butterflies, the twiddle factors are 1 and -dir*j */ \
+        for (size_t i=0; i < count; i += 4) \
+        { \
+            double r0 = re[i] + re[i+1], r1 = re[i] - re[i+1]; \
+            double r2 = re[i+2] + re[i+3], r3 = re[i+2] - re[i+3]; \
+            double i0 = im[i] + im[i+1], i1 = im[i] - im[i+1]; \
+            double i2 = im[i+2] + im[i+3], i3 = im[i+2] - im[i+3]; \
+            \
+            re[i]           = r0 + r2; \
+            im[i]           = i0 + i2; \
+            re[i+2]         = r0 - r2; \
+            im[i+2]         = i0 - i2; \
+            re[i+1]         = r1 - dir * i3; \
+            im[i+1]         = i1 + dir * r3; \
+            re[i+3]         = r1 + dir * i3; \
+            im[i+3]         = i1 - dir * r3; \
+        } \
+        \
+        /* Next stages: four butterflies per iteration */ \
+        for (size_t k = 2; k < rank; ++k) \
+        { \
+            size_t n        = size_t(1) << k; \
+            \
+            /* Rotation step for four butterflies */ \
+            w[8]            = XFFT_F64_DW[k*2 - 4]; \
+            w[12]           = dir * XFFT_F64_DW[k*2 - 3]; \
+            w[9]            = w[8]; \
+            w[10]           = w[8]; \
+            w[11]           = w[8]; \
+            w[13]           = w[12]; \
+            w[14]           = w[12]; \
+            w[15]           = w[12]; \
+            \
+            /* Twiddle factors are rotated at most FFT_F64_RESEED times and then computed from exact value */ \
+            for (size_t j0 = 0; j0 < n; j0 += FFT_F64_RESEED) \
+            { \
+                size_t len      = lsp_min(n - j0, FFT_F64_RESEED); \
+                size_t skip     = ((n << 1) - len) * sizeof(double); \
+                size_t blocks   = items >> (k + 1); \
+                \
+                /* Twiddle factors for j = j0 .. j0 + 3 */ \
+                for (size_t j=0; j<4; ++j) \
+                { \
+                    double angle    = (M_PI * double(j0 + j)) / double(n); \
+                    w[j]            = cos(angle); \
+                    w[j + 4]        = dir * sin(angle); \
+                } \
+                re              = &dst_re[j0]; \
+                im              = &dst_im[j0]; \
+                \
+                ARCH_X86_ASM \
+                ( \
+                    FFT_F64_BUTTERFLY_STAGE(FMA_SEL) \
+                    : [re] "+r" (re), [im] "+r" (im), \
+                      [count] "=&r" (count), [blocks] "+rm" (blocks) \
+                    : [n] "r" (n), [w] "r" (w), \
+                      [len] "rm" (len), [skip] "rm" (skip) \
+                    : "cc", "memory", \
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+                ); \
+            } \
+        }
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+        static void butterfly_fft_f64(double *dst_re, double *dst_im, size_t rank, double dir)
+        {
+            FFT_F64_BUTTERFLY(FMA_OFF);
+        }
+
+        static void butterfly_fft_f64_fma3(double *dst_re, double *dst_im, size_t rank, double dir)
+        {
+            FFT_F64_BUTTERFLY(FMA_ON);
+        }
+
+    #undef FMA_OFF
+    #undef FMA_ON
+    #undef FFT_F64_BUTTERFLY
+    #undef FFT_F64_BUTTERFLY_STAGE
+
+        static void small_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank <= 0)
+            {
+                dst_re[0]       = src_re[0];
+                dst_im[0]       = src_im[0];
+                return;
+            }
+
+            double r0 = src_re[0], r1 = src_re[1];
+            double i0 = src_im[0], i1 = src_im[1];
+            dst_re[0]       = r0 + r1;
+            dst_re[1]       = r0 - r1;
+            dst_im[0]       = i0 + i1;
+            dst_im[1]       = i0 - i1;
+        }
+
+        static void normalize_fft_f64(double *dst_re, double *dst_im, size_t rank)
+        {
+            size_t count    = size_t(1) << rank;
+            double k        = 1.0 / double(count);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastsd %[k], %%ymm0")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmulpd      0x00(%[re]), %%ymm0, %%ymm1")
+                __ASM_EMIT("vmulpd      0x00(%[im]), %%ymm0, %%ymm2")
+                __ASM_EMIT("vmovupd     %%ymm1, 0x00(%[re])")
+                __ASM_EMIT("vmovupd     %%ymm2, 0x00(%[im])")
+                __ASM_EMIT("add         $0x20, %[re]")
+                __ASM_EMIT("add         $0x20, %[im]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [re] "+r" (dst_re), [im] "+r" (dst_im), [count] "+r" (count)
+                : [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2"
+            );
+        }
+
+        void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, -1.0);
+        }
+
+        void direct_fft_f64_fma3(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64_fma3(dst_re, dst_im, rank, -1.0);
+        }
+
+        void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                if (rank > 0)
+                {
+                    dst_re[0]      *= 0.5;
+                    dst_re[1]      *= 0.5;
+                    dst_im[0]      *= 0.5;
+                    dst_im[1]      *= 0.5;
+                }
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, 1.0);
+            normalize_fft_f64(dst_re, dst_im, rank);
+        }
+
+        void reverse_fft_f64_fma3(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                if (rank > 0)
+                {
+                    dst_re[0]      *= 0.5;
+                    dst_re[1]      *= 0.5;
+                    dst_im[0]      *= 0.5;
+                    dst_im[1]      *= 0.5;
+                }
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64_fma3(dst_re, dst_im, rank, 1.0);
+            normalize_fft_f64(dst_re, dst_im, rank);
+        }
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FFT_F64_H_ */
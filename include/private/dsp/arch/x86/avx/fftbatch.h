@@ -0,0 +1,408 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FFTBATCH_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FFTBATCH_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+#include <private/dsp/fft.h>
+
+namespace lsp
+{
+    namespace avx
+    {
+        // Number of buffers processed at once: one buffer per lane of the YMM register
+        static constexpr size_t FFT_BATCH_LANES     = 8;
+        // Ranks of transforms computed for several buffers at once. The upper bound is taken from
+        // the dsp.fft.fftbatch ptest, 64 transforms per call, batch vs per-buffer plan FFT (it/s):
+        //   rank 8:    26382 vs 23996, 27367 vs 24026 (fma3)
+        //   rank 9:    10210 vs 10925, 10262 vs 12003
+        //   rank 10:    4356 vs  4785,  3889 vs  4576
+        // Above rank 8 the eight transposed buffers do not fit L1 anymore, and the batch
+        // loses to the per-buffer transform which keeps its data in cache between passes
+        static constexpr size_t FFT_BATCH_RANK_MIN  = 3;
+        static constexpr size_t FFT_BATCH_RANK_MAX  = 8;
+        // Size of the scratch kept on the stack: the transposed buffers and the sink for results
+        // of unused lanes for the maximum batch rank, 18 KB
+        static constexpr size_t FFT_BATCH_SCRATCH_SIZE  = (FFT_BATCH_LANES * 2 + 2) << FFT_BATCH_RANK_MAX;
+
+        // Transpose of 4x4 matrix: xmm0..xmm3 = rows, result: xmm0, xmm1, xmm2, xmm3 = columns
+        #define FFT_BATCH_TRANSPOSE \
+            __ASM_EMIT("vunpcklps       %%xmm1, %%xmm0, %%xmm4")        /* xmm4 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("vunpckhps       %%xmm1, %%xmm0, %%xmm5")        /* xmm5 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("vunpcklps       %%xmm3, %%xmm2, %%xmm6")        /* xmm6 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("vunpckhps       %%xmm3, %%xmm2, %%xmm7")        /* xmm7 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("vshufps         $0x44, %%xmm6, %%xmm4, %%xmm0") /* xmm0 = a0 b0 c0 d0 */ \
+            __ASM_EMIT("vshufps         $0xee, %%xmm6, %%xmm4, %%xmm1") /* xmm1 = a1 b1 c1 d1 */ \
+            __ASM_EMIT("vshufps         $0x44, %%xmm7, %%xmm5, %%xmm2") /* xmm2 = a2 b2 c2 d2 */ \
+            __ASM_EMIT("vshufps         $0xee, %%xmm7, %%xmm5, %%xmm3") /* xmm3 = a3 b3 c3 d3 */
+
+        /**
+         * Load two adjacent complex numbers j, j+1 of four buffers and store them to four lanes
+         * of the lane-interleaved layout at dst and dst + half: the bit-reversed index of j+1
+         * differs from the bit-reversed index of j by N/2 for even j.
+         */
+        static inline void plan_batch_gather_pair8(float *dst, size_t half,
+            const float *s0, const float *s1, const float *s2, const float *s3)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vmovups         0x00(%[s0]), %%xmm0")           /* xmm0 = r0 i0 r1 i1 of buffer 0 */
+                __ASM_EMIT("vmovups         0x00(%[s1]), %%xmm1")           /* xmm1 = r0 i0 r1 i1 of buffer 1 */
+                __ASM_EMIT("vmovups         0x00(%[s2]), %%xmm2")           /* xmm2 = r0 i0 r1 i1 of buffer 2 */
+                __ASM_EMIT("vmovups         0x00(%[s3]), %%xmm3")           /* xmm3 = r0 i0 r1 i1 of buffer 3 */
+                FFT_BATCH_TRANSPOSE
+                __ASM_EMIT("vmovaps         %%xmm0, 0x00(%[d])")            /* re[j] */
+                __ASM_EMIT("vmovaps         %%xmm1, 0x20(%[d])")            /* im[j] */
+                __ASM_EMIT("add             %[half], %[d]")
+                __ASM_EMIT("vmovaps         %%xmm2, 0x00(%[d])")            /* re[j+1] */
+                __ASM_EMIT("vmovaps         %%xmm3, 0x20(%[d])")            /* im[j+1] */
+                : [d] "+r" (dst)
+                : [half] "m" (half),
+                  [s0] "r" (s0), [s1] "r" (s1), [s2] "r" (s2), [s3] "r" (s3)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /**
+         * Load two adjacent complex numbers from four lanes of the lane-interleaved layout,
+         * apply normalization and store them to four buffers
+         */
+        static inline void plan_batch_scatter_pair8(const float *src, float norm,
+            float *d0, float *d1, float *d2, float *d3)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vbroadcastss    %[norm], %%xmm7")               /* xmm7 = k */
+                __ASM_EMIT("vmulps          0x00(%[s]), %%xmm7, %%xmm0")    /* xmm0 = re[j] */
+                __ASM_EMIT("vmulps          0x20(%[s]), %%xmm7, %%xmm1")    /* xmm1 = im[j] */
+                __ASM_EMIT("vmulps          0x40(%[s]), %%xmm7, %%xmm2")    /* xmm2 = re[j+1] */
+                __ASM_EMIT("vmulps          0x60(%[s]), %%xmm7, %%xmm3")    /* xmm3 = im[j+1] */
+                FFT_BATCH_TRANSPOSE
+                __ASM_EMIT("vmovups         %%xmm0, 0x00(%[d0])")
+                __ASM_EMIT("vmovups         %%xmm1, 0x00(%[d1])")
+                __ASM_EMIT("vmovups         %%xmm2, 0x00(%[d2])")
+                __ASM_EMIT("vmovups         %%xmm3, 0x00(%[d3])")
+                :
+                : [s] "r" (src), [norm] "m" (norm),
+                  [d0] "r" (d0), [d1] "r" (d1), [d2] "r" (d2), [d3] "r" (d3)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        #undef FFT_BATCH_TRANSPOSE
+
+        // First two butterfly stages, each complex number is stored as [re0..re7 im0..im7]
+        #define FFT_BATCH_START_BODY8(add_b, sub_b) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                    /* Real parts */ \
+                    __ASM_EMIT("vmovaps         0x00(%[a]), %%ymm0")            /* ymm0 = r0 */ \
+                    __ASM_EMIT("vmovaps         0x40(%[a]), %%ymm1")            /* ymm1 = r1 */ \
+                    __ASM_EMIT("vmovaps         0x80(%[a]), %%ymm2")            /* ymm2 = r2 */ \
+                    __ASM_EMIT("vmovaps         0xc0(%[a]), %%ymm3")            /* ymm3 = r3 */ \
+                    __ASM_EMIT("vsubps          %%ymm1, %%ymm0, %%ymm4")        /* ymm4 = r0 - r1 */ \
+                    __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm0")        /* ymm0 = r0 + r1 */ \
+                    __ASM_EMIT("vsubps          %%ymm3, %%ymm2, %%ymm5")        /* ymm5 = r2 - r3 */ \
+                    __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm2")        /* ymm2 = r2 + r3 */ \
+                    __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm1")        /* ymm1 = r0 + r1 - r2 - r3 */ \
+                    __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")        /* ymm0 = r0 + r1 + r2 + r3 */ \
+                    __ASM_EMIT("vmovaps         %%ymm0, 0x00(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm1, 0x80(%[a])") \
+                    /* Imaginary parts */ \
+                    __ASM_EMIT("vmovaps         0x20(%[a]), %%ymm2")            /* ymm2 = i0 */ \
+                    __ASM_EMIT("vmovaps         0x60(%[a]), %%ymm3")            /* ymm3 = i1 */ \
+                    __ASM_EMIT("vmovaps         0xa0(%[a]), %%ymm6")            /* ymm6 = i2 */ \
+                    __ASM_EMIT("vmovaps         0xe0(%[a]), %%ymm7")            /* ymm7 = i3 */ \
+                    __ASM_EMIT("vsubps          %%ymm3, %%ymm2, %%ymm0")        /* ymm0 = i0 - i1 */ \
+                    __ASM_EMIT("vaddps          %%ymm3, %%ymm2, %%ymm2")        /* ymm2 = i0 + i1 */ \
+                    __ASM_EMIT("vsubps          %%ymm7, %%ymm6, %%ymm1")        /* ymm1 = i2 - i3 */ \
+                    __ASM_EMIT("vaddps          %%ymm7, %%ymm6, %%ymm6")        /* ymm6 = i2 + i3 */ \
+                    __ASM_EMIT("vsubps          %%ymm6, %%ymm2, %%ymm3")        /* ymm3 = i0 + i1 - i2 - i3 */ \
+                    __ASM_EMIT("vaddps          %%ymm6, %%ymm2, %%ymm2")        /* ymm2 = i0 + i1 + i2 + i3 */ \
+                    __ASM_EMIT("vmovaps         %%ymm2, 0x20(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm3, 0xa0(%[a])") \
+                    /* Odd outputs: ymm4 = t1_re, ymm0 = t1_im, ymm5 = t3_re, ymm1 = t3_im */ \
+                    __ASM_EMIT(add_b "          %%ymm1, %%ymm4, %%ymm2")        /* ymm2 = t1_re +- t3_im */ \
+                    __ASM_EMIT(sub_b "          %%ymm1, %%ymm4, %%ymm3")        /* ymm3 = t1_re -+ t3_im */ \
+                    __ASM_EMIT(sub_b "          %%ymm5, %%ymm0, %%ymm6")        /* ymm6 = t1_im -+ t3_re */ \
+                    __ASM_EMIT(add_b "          %%ymm5, %%ymm0, %%ymm7")        /* ymm7 = t1_im +- t3_re */ \
+                    __ASM_EMIT("vmovaps         %%ymm2, 0x40(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm6, 0x60(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm3, 0xc0(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm7, 0xe0(%[a])") \
+                    __ASM_EMIT("add             $0x100, %[a]") \
+                    __ASM_EMIT("dec             %[count]") \
+                __ASM_EMIT("jnz             1b") \
+                : [a] "+r" (dst), [count] "+r" (count) \
+                : \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        static inline void plan_batch_start_direct8(float *dst, size_t count)
+        {
+            FFT_BATCH_START_BODY8("vaddps", "vsubps");
+        }
+
+        static inline void plan_batch_start_reverse8(float *dst, size_t count)
+        {
+            FFT_BATCH_START_BODY8("vsubps", "vaddps");
+        }
+
+        #undef FFT_BATCH_START_BODY8
+
+        // Butterflies of the block, each complex number is stored as [re0..re7 im0..im7],
+        // the b half is addressed as (a + bb), the imaginary part of twiddle factors as (w + nb).
+        #define FFT_BATCH_BUTTERFLY_BODY8(add_b, add_a, FMA_SEL) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                    __ASM_EMIT("vbroadcastss    0x00(%[w]), %%ymm6")            /* ymm6 = w_re */ \
+                    __ASM_EMIT("vbroadcastss    0x00(%[w], %[nb]), %%ymm7")     /* ymm7 = w_im */ \
+                    __ASM_EMIT("vmovaps         0x00(%[a], %[bb]), %%ymm2")     /* ymm2 = b_re */ \
+                    __ASM_EMIT("vmovaps         0x20(%[a], %[bb]), %%ymm3")     /* ymm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm4")        /* ymm4 = w_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm3, %%ymm5")        /* ymm5 = w_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm2, %%ymm2", ""))   /* ymm2 = w_re * b_re */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm3, %%ymm3", ""))   /* ymm3 = w_re * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_b "  %%ymm5, %%ymm2, %%ymm5", add_b " %%ymm6, %%ymm2, %%ymm5")) /* ymm5 = c_re = w_re * b_re +- w_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_a "  %%ymm4, %%ymm3, %%ymm4", add_a " %%ymm6, %%ymm3, %%ymm4")) /* ymm4 = c_im = w_re * b_im -+ w_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vmovaps         0x00(%[a]), %%ymm0")            /* ymm0 = a_re */ \
+                    __ASM_EMIT("vmovaps         0x20(%[a]), %%ymm1")            /* ymm1 = a_im */ \
+                    __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm2")        /* ymm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%ymm4, %%ymm1, %%ymm3")        /* ymm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm0")        /* ymm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm1")        /* ymm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovaps         %%ymm0, 0x00(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm1, 0x20(%[a])") \
+                    __ASM_EMIT("vmovaps         %%ymm2, 0x00(%[a], %[bb])") \
+                    __ASM_EMIT("vmovaps         %%ymm3, 0x20(%[a], %[bb])") \
+                    __ASM_EMIT("add             $0x40, %[a]") \
+                    __ASM_EMIT("add             $0x04, %[w]") \
+                    __ASM_EMIT("dec             %[p]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [a] "+r" (a), [w] "+r" (w), [p] "+r" (p) \
+                : [nb] "r" (nb), [bb] "r" (bb) \
+                : "cc", "memory",  \
+                "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+    #define FFT_BATCH_BUTTERFLY_LOOP8(add_b, add_a, FMA_SEL) \
+            size_t nb       = n * sizeof(float); \
+            size_t bb       = n * FFT_BATCH_LANES * 2 * sizeof(float); \
+            for (size_t blk=0; blk<blocks; ++blk, dst += n * FFT_BATCH_LANES * 4) \
+            { \
+                float *a        = dst; \
+                const float *w  = tw; \
+                size_t p        = n; \
+                FFT_BATCH_BUTTERFLY_BODY8(add_b, add_a, FMA_SEL); \
+            }
+
+        static inline void plan_batch_butterfly_direct8(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            FFT_BATCH_BUTTERFLY_LOOP8("vaddps", "vsubps", FMA_OFF);
+        }
+
+        static inline void plan_batch_butterfly_reverse8(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            FFT_BATCH_BUTTERFLY_LOOP8("vsubps", "vaddps", FMA_OFF);
+        }
+
+        static inline void plan_batch_butterfly_direct8_fma3(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            FFT_BATCH_BUTTERFLY_LOOP8("vfmadd231ps", "vfmsub231ps", FMA_ON);
+        }
+
+        static inline void plan_batch_butterfly_reverse8_fma3(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            FFT_BATCH_BUTTERFLY_LOOP8("vfmsub231ps", "vfmadd231ps", FMA_ON);
+        }
+
+    #undef FFT_BATCH_BUTTERFLY_LOOP8
+    #undef FMA_OFF
+    #undef FMA_ON
+
+        #undef FFT_BATCH_BUTTERFLY_BODY8
+
+        typedef void (* plan_batch_start8_t)(float *dst, size_t count);
+        typedef void (* plan_batch_butterfly8_t)(float *dst, const float *tw, size_t n, size_t blocks);
+        typedef void (* plan_packed_fft_t)(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+        static void plan_batch_gather8(const dsp::fft_plan_t *plan, float *dst, const float * const *src)
+        {
+            const uint32_t *rev = plan->rev;
+            size_t items        = size_t(1) << plan->rank;
+            size_t half         = items * FFT_BATCH_LANES * sizeof(float);
+
+            for (size_t j=0; j<items; j += 2)
+            {
+                float *d            = &dst[rev[j] * FFT_BATCH_LANES * 2];
+                plan_batch_gather_pair8(d, half, &src[0][j*2], &src[1][j*2], &src[2][j*2], &src[3][j*2]);
+                plan_batch_gather_pair8(&d[4], half, &src[4][j*2], &src[5][j*2], &src[6][j*2], &src[7][j*2]);
+            }
+        }
+
+        static void plan_batch_scatter8(float * const *dst, const float *src, size_t rank, float norm)
+        {
+            size_t items        = size_t(1) << rank;
+
+            for (size_t j=0; j<items; j += 2, src += FFT_BATCH_LANES * 4)
+            {
+                plan_batch_scatter_pair8(src, norm, &dst[0][j*2], &dst[1][j*2], &dst[2][j*2], &dst[3][j*2]);
+                plan_batch_scatter_pair8(&src[4], norm, &dst[4][j*2], &dst[5][j*2], &dst[6][j*2], &dst[7][j*2]);
+            }
+        }
+
+        static void plan_packed_fft_batch8(const dsp::fft_plan_t *plan, float *buf, float * const *dst, const float * const *src,
+            size_t count, plan_batch_start8_t start, plan_batch_butterfly8_t butterfly, float norm)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            float *vdst[FFT_BATCH_LANES];
+            const float *vsrc[FFT_BATCH_LANES];
+            float *dummy        = &buf[(FFT_BATCH_LANES * 2) << plan->rank];
+
+            for (size_t i=0; i<count; i += FFT_BATCH_LANES)
+            {
+                // Unused lanes transform the first buffer once more and discard the result
+                size_t lanes        = lsp_min(count - i, FFT_BATCH_LANES);
+                for (size_t k=0; k<FFT_BATCH_LANES; ++k)
+                {
+                    vdst[k]             = (k < lanes) ? dst[i + k] : dummy;
+                    vsrc[k]             = (k < lanes) ? src[i + k] : src[i];
+                }
+
+                plan_batch_gather8(plan, buf, vsrc);
+                start(buf, items >> 2);
+                for (size_t n=4; n < items; n <<= 1)
+                    butterfly(buf, dsp::fft_plan_twiddles(plan, n), n, items / (n << 1));
+                plan_batch_scatter8(vdst, buf, plan->rank, norm);
+            }
+        }
+
+        static void plan_packed_fft_batch8(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src,
+            size_t count, plan_packed_fft_t fft, plan_batch_start8_t start, plan_batch_butterfly8_t butterfly, float norm)
+        {
+            if ((plan->rank < FFT_BATCH_RANK_MIN) || (plan->rank > FFT_BATCH_RANK_MAX))
+            {
+                for (size_t i=0; i<count; ++i)
+                    fft(plan, dst[i], src[i]);
+                return;
+            }
+
+            float buf[FFT_BATCH_SCRATCH_SIZE] __lsp_aligned32;
+            plan_packed_fft_batch8(plan, buf, dst, src, count, start, butterfly, norm);
+        }
+
+        static void plan_packed_fft_batch8(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride,
+            size_t count, plan_packed_fft_t fft, plan_batch_start8_t start, plan_batch_butterfly8_t butterfly, float norm)
+        {
+            if ((plan->rank < FFT_BATCH_RANK_MIN) || (plan->rank > FFT_BATCH_RANK_MAX))
+            {
+                for (size_t i=0; i<count; ++i, dst += stride, src += stride)
+                    fft(plan, dst, src);
+                return;
+            }
+
+            float buf[FFT_BATCH_SCRATCH_SIZE] __lsp_aligned32;
+            float *vdst[FFT_BATCH_LANES];
+            const float *vsrc[FFT_BATCH_LANES];
+
+            for (size_t i=0; i<count; i += FFT_BATCH_LANES)
+            {
+                size_t lanes        = lsp_min(count - i, FFT_BATCH_LANES);
+                for (size_t k=0; k<lanes; ++k, dst += stride, src += stride)
+                {
+                    vdst[k]             = dst;
+                    vsrc[k]             = src;
+                }
+                plan_packed_fft_batch8(plan, buf, vdst, vsrc, lanes, start, butterfly, norm);
+            }
+        }
+
+        void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, stride, count,
+                plan_packed_direct_fft, plan_batch_start_direct8, plan_batch_butterfly_direct8, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, stride, count,
+                plan_packed_reverse_fft, plan_batch_start_reverse8, plan_batch_butterfly_reverse8, 1.0f / float(size_t(1) << plan->rank));
+        }
+
+        void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, count,
+                plan_packed_direct_fft, plan_batch_start_direct8, plan_batch_butterfly_direct8, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, count,
+                plan_packed_reverse_fft, plan_batch_start_reverse8, plan_batch_butterfly_reverse8, 1.0f / float(size_t(1) << plan->rank));
+        }
+
+        void plan_packed_direct_fft_batch_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, stride, count,
+                plan_packed_direct_fft_fma3, plan_batch_start_direct8, plan_batch_butterfly_direct8_fma3, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, stride, count,
+                plan_packed_reverse_fft_fma3, plan_batch_start_reverse8, plan_batch_butterfly_reverse8_fma3, 1.0f / float(size_t(1) << plan->rank));
+        }
+
+        void plan_packed_direct_fft_batch_ptr_fma3(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, count,
+                plan_packed_direct_fft_fma3, plan_batch_start_direct8, plan_batch_butterfly_direct8_fma3, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch_ptr_fma3(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch8(plan, dst, src, count,
+                plan_packed_reverse_fft_fma3, plan_batch_start_reverse8, plan_batch_butterfly_reverse8_fma3, 1.0f / float(size_t(1) << plan->rank));
+        }
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FFTBATCH_H_ */
@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_FFTPLAN_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_FFTPLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+#include <private/dsp/fft.h>
+
+namespace lsp
+{
+    namespace avx
+    {
+        // Butterfly stage over [re0..re7, im0..im7] blocks, half of the butterfly contains n complex numbers,
+        // count complex numbers of the half are processed. The b half is addressed as (a + 2*nb), the
+        // imaginary part of twiddle factors as (w + nb).
+        #define FFT_PLAN_BUTTERFLY_BODY8(add_b, add_a, FMA_SEL) \
+            float *a        = dst; \
+            const float *w  = tw; \
+            size_t p        = count; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                    __ASM_EMIT("vmovaps         0x00(%[w]), %%ymm6")                /* ymm6 = w_re */ \
+                    __ASM_EMIT("vmovaps         0x00(%[w], %[nb]), %%ymm7")         /* ymm7 = w_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[a]), %%ymm0")                /* ymm0 = a_re */ \
+                    __ASM_EMIT("vmovups         0x20(%[a]), %%ymm1")                /* ymm1 = a_im */ \
+                    __ASM_EMIT("vmovups         0x00(%[a], %[nb], 2), %%ymm2")      /* ymm2 = b_re */ \
+                    __ASM_EMIT("vmovups         0x20(%[a], %[nb], 2), %%ymm3")      /* ymm3 = b_im */ \
+                    /* Calculate complex multiplication */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm2, %%ymm4")            /* ymm4 = w_im * b_re */ \
+                    __ASM_EMIT("vmulps          %%ymm7, %%ymm3, %%ymm5")            /* ymm5 = w_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm2, %%ymm2", ""))       /* ymm2 = w_re * b_re */ \
+                    __ASM_EMIT(FMA_SEL("vmulps  %%ymm6, %%ymm3, %%ymm3", ""))       /* ymm3 = w_re * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_b "  %%ymm5, %%ymm2, %%ymm5", add_b " %%ymm6, %%ymm2, %%ymm5")) /* ymm5 = c_re = w_re * b_re +- w_im * b_im */ \
+                    __ASM_EMIT(FMA_SEL(add_a "  %%ymm4, %%ymm3, %%ymm4", add_a " %%ymm6, %%ymm3, %%ymm4")) /* ymm4 = c_im = w_re * b_im -+ w_im * b_re */ \
+                    /* Perform butterfly */ \
+                    __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm2")            /* ymm2 = a_re - c_re */ \
+                    __ASM_EMIT("vsubps          %%ymm4, %%ymm1, %%ymm3")            /* ymm3 = a_im - c_im */ \
+                    __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm0")            /* ymm0 = a_re + c_re */ \
+                    __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm1")            /* ymm1 = a_im + c_im */ \
+                    /* Store values */ \
+                    __ASM_EMIT("vmovups         %%ymm0, 0x00(%[a])") \
+                    __ASM_EMIT("vmovups         %%ymm1, 0x20(%[a])") \
+                    __ASM_EMIT("vmovups         %%ymm2, 0x00(%[a], %[nb], 2)") \
+                    __ASM_EMIT("vmovups         %%ymm3, 0x20(%[a], %[nb], 2)") \
+                    __ASM_EMIT("add             $0x40, %[a]") \
+                    __ASM_EMIT("add             $0x20, %[w]") \
+                    __ASM_EMIT("sub             $8, %[p]") \
+                __ASM_EMIT("jnz             1b") \
+                \
+                : [a] "+r" (a), [w] "+r" (w), [p] "+r" (p) \
+                : [nb] "r" (nb) \
+                : "cc", "memory",  \
+                "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                "%xmm4", "%xmm5", "%xmm6", "%xmm7"  \
+            );
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+        static inline void plan_packed_butterfly_direct8(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_BUTTERFLY_BODY8("vaddps", "vsubps", FMA_OFF);
+            }
+        }
+
+        static inline void plan_packed_butterfly_reverse8(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_BUTTERFLY_BODY8("vsubps", "vaddps", FMA_OFF);
+            }
+        }
+
+        static inline void plan_packed_butterfly_direct8_fma3(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_BUTTERFLY_BODY8("vfmadd231ps", "vfmsub231ps", FMA_ON);
+            }
+        }
+
+        static inline void plan_packed_butterfly_reverse8_fma3(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_BUTTERFLY_BODY8("vfmsub231ps", "vfmadd231ps", FMA_ON);
+            }
+        }
+
+    #undef FMA_OFF
+    #undef FMA_ON
+
+        #undef FFT_PLAN_BUTTERFLY_BODY8
+
+        typedef void (* plan_packed_butterfly8_t)(float *dst, const float *tw, size_t n, size_t count, size_t blocks);
+
+        static inline void plan_packed_butterflies8(const dsp::fft_plan_t *plan, float *dst, plan_packed_butterfly8_t butterfly)
+        {
+            size_t items    = size_t(1) << plan->rank;
+            size_t block    = lsp_min(items, size_t(1) << dsp::FFT_BLOCK_RANK);
+
+            // Lower stages: process each block of data with all stages before switching to the next block
+            for (size_t off=0; off < items; off += block)
+                for (size_t n=8; n < block; n <<= 1)
+                    butterfly(&dst[off << 1], dsp::fft_plan_twiddles(plan, n), n, n, block / (n << 1));
+
+            // Upper stages: process groups of stages column strip by column strip
+            for (size_t s=block; s < items; s <<= dsp::FFT_GROUP_RANK)
+            {
+                size_t last     = lsp_min(items, s << dsp::FFT_GROUP_RANK);
+                for (size_t off=0; off < items; off += last)
+                    for (size_t c=0; c < s; c += dsp::FFT_STRIP_SIZE)
+                        for (size_t n=s; n < last; n <<= 1)
+                            for (size_t r=c; r < n; r += s)
+                                butterfly(&dst[(off + r) << 1], &dsp::fft_plan_twiddles(plan, n)[r], n, dsp::FFT_STRIP_SIZE, last / (n << 1));
+            }
+        }
+
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, 2 << rank); // 1 << rank + 1
+                if (rank <= 8)
+                    packed_scramble_self_direct8(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_direct16(dst, rank);
+                else
+                    packed_scramble_self_direct32(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_direct8(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_direct16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32(dst, src, rank-4);
+            }
+
+            plan_packed_butterflies8(plan, dst, plan_packed_butterfly_direct8);
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, 2 << rank); // 1 << rank + 1
+                if (rank <= 8)
+                    packed_scramble_self_reverse8(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_reverse16(dst, rank);
+                else
+                    packed_scramble_self_reverse32(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_reverse8(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_reverse16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32(dst, src, rank-4);
+            }
+
+            plan_packed_butterflies8(plan, dst, plan_packed_butterfly_reverse8);
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+
+        void plan_packed_direct_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, 2 << rank); // 1 << rank + 1
+                if (rank <= 8)
+                    packed_scramble_self_direct8_fma3(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_direct16_fma3(dst, rank);
+                else
+                    packed_scramble_self_direct32_fma3(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_direct8_fma3(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_direct16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32_fma3(dst, src, rank-4);
+            }
+
+            plan_packed_butterflies8(plan, dst, plan_packed_butterfly_direct8_fma3);
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void plan_packed_reverse_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            if ((dst == src) || (rank < 4))
+            {
+                dsp::move(dst, src, 2 << rank); // 1 << rank + 1
+                if (rank <= 8)
+                    packed_scramble_self_reverse8_fma3(dst, rank);
+                else if (rank <= 16)
+                    packed_scramble_self_reverse16_fma3(dst, rank);
+                else
+                    packed_scramble_self_reverse32_fma3(dst, rank);
+            }
+            else
+            {
+                if (rank <= 12)
+                    packed_scramble_copy_reverse8_fma3(dst, src, rank-4);
+                else if (rank <= 20)
+                    packed_scramble_copy_reverse16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32_fma3(dst, src, rank-4);
+            }
+
+            plan_packed_butterflies8(plan, dst, plan_packed_butterfly_reverse8_fma3);
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_FFTPLAN_H_ */
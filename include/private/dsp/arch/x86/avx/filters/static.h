@@ -778,6 +778,578 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        IF_ARCH_X86(
+            static const uint64_t biquad_f64_mask[4] __lsp_aligned32 =
+            {
+                0xffffffffffffffffULL, 0, 0, 0
+            };
+        )
+
+    /*
+     * One step of four filters, ymm0 = s on input, on output:
+     * ymm1 = s', ymm2 = d0', ymm3 = d1'
+     */
+    #define BIQUAD_F64_X4_STEP(B0, B1, B2, A1, A2, FMA_SEL) \
+        __ASM_EMIT(FMA_SEL("vmulpd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B0 "(%[f]), %%ymm0, %%ymm1", "vmovapd     %%ymm6, %%ymm1"))      /* ymm1 = b0*s */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B1 "(%[f]), %%ymm0, %%ymm2", "vmovapd     %%ymm7, %%ymm2"))      /* ymm2 = b1*s */ \
+        __ASM_EMIT("vmulpd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B2 "(%[f]), %%ymm0, %%ymm3")                                         /* ymm3 = b2*s */ \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm6, %%ymm1, %%ymm1", "vfmadd231pd " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B0 "(%[f]), %%ymm0, %%ymm1"))  /* ymm1 = s' = b0*s + d0 */ \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm7, %%ymm2, %%ymm2", "vfmadd231pd " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B1 "(%[f]), %%ymm0, %%ymm2"))  /* ymm2 = d1 + b1*s */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A1 "(%[f]), %%ymm1, %%ymm4", "vfmadd231pd " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A1 "(%[f]), %%ymm1, %%ymm2"))  /* ymm4 = a1*s' */ \
+        __ASM_EMIT(FMA_SEL("vmulpd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A2 "(%[f]), %%ymm1, %%ymm5", "vfmadd231pd " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A2 "(%[f]), %%ymm1, %%ymm3"))  /* ymm5 = a2*s' */ \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm4, %%ymm2, %%ymm2", ""))                                                                     /* ymm2 = d0' = d1 + b1*s + a1*s' */ \
+        __ASM_EMIT(FMA_SEL("vaddpd      %%ymm5, %%ymm3, %%ymm3", ""))                                                                     /* ymm3 = d1' = b2*s + a2*s' */ \
+        __ASM_EMIT("vperm2f128  $0x01, %%ymm1, %%ymm1, %%ymm4")         /* ymm4 = s2[2] s2[3] s2[0] s2[1] */ \
+        __ASM_EMIT("vshufpd     $0x05, %%ymm1, %%ymm4, %%ymm0")         /* ymm0 = s2[3] s2[0] s2[1] s2[2] */
+
+    /*
+     * Four cascaded filters processed as a pipeline, each next filter gets the delayed
+     * output of the previous one. Arguments are the string offsets of coefficients and
+     * of d0/d1 state vectors.
+     */
+    #define BIQUAD_F64_X4_BODY(B0, B1, B2, A1, A2, D0, D1, FMA_SEL) \
+        /* Initialize mask */ \
+        /* ymm0=s[4], ymm1=s2[4], ymm2=d0'[4], ymm3=d1'[4], ymm6=d0[4], ymm7=d1[4] */ \
+        __ASM_EMIT("mov         $1, %[mask]") \
+        __ASM_EMIT("vmovapd     %[X_MASK], %%ymm5") \
+        __ASM_EMIT("vxorpd      %%ymm0, %%ymm0, %%ymm0") \
+        __ASM_EMIT("vmovapd     %%ymm5, %[MASK]") \
+        /* Load delay buffer */ \
+        __ASM_EMIT("vmovapd     " D0 "(%[f]), %%ymm6")                  /* ymm6 = d0 */ \
+        __ASM_EMIT("vmovapd     " D1 "(%[f]), %%ymm7")                  /* ymm7 = d1 */ \
+        /* Process first 3 steps */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vmovsd      0x00(%[src]), %%xmm4")                  /* xmm4 = *src */ \
+        __ASM_EMIT("add         $0x08, %[src]")                         /* src++ */ \
+        __ASM_EMIT("vblendpd    $0x01, %%ymm4, %%ymm0, %%ymm0")         /* ymm0 = s */ \
+        BIQUAD_F64_X4_STEP(B0, B1, B2, A1, A2, FMA_SEL) \
+        __ASM_EMIT("vmovapd     %[MASK], %%ymm5")                       /* ymm5 = mask */ \
+        __ASM_EMIT("vblendvpd   %%ymm5, %%ymm2, %%ymm6, %%ymm6")        /* ymm6 = (d0' & MASK) | (d0 & ~MASK) */ \
+        __ASM_EMIT("vblendvpd   %%ymm5, %%ymm3, %%ymm7, %%ymm7")        /* ymm7 = (d1' & MASK) | (d1 & ~MASK) */ \
+        __ASM_EMIT("dec         %[count]") \
+        __ASM_EMIT("jz          4f")                                    /* jump to completion */ \
+        __ASM_EMIT("vperm2f128  $0x01, %%ymm5, %%ymm5, %%ymm4")         /* ymm4 = m[2] m[3] m[0] m[1] */ \
+        __ASM_EMIT("vshufpd     $0x05, %%ymm5, %%ymm4, %%ymm4")         /* ymm4 = m[3] m[0] m[1] m[2] */ \
+        __ASM_EMIT("lea         0x01(,%[mask], 2), %[mask]")            /* mask = (mask << 1) | 1 */ \
+        __ASM_EMIT("vblendpd    $0x01, %%ymm5, %%ymm4, %%ymm5")         /* ymm5 = m[0] m[0] m[1] m[2] */ \
+        __ASM_EMIT("vmovapd     %%ymm5, %[MASK]")                       /* store mask */ \
+        __ASM_EMIT("cmp         $0x0f, %[mask]") \
+        __ASM_EMIT("jne         1b") \
+        /* 4x filter processing without mask */ \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("vmovsd      0x00(%[src]), %%xmm4")                  /* xmm4 = *src */ \
+        __ASM_EMIT("add         $0x08, %[src]")                         /* src++ */ \
+        __ASM_EMIT("vblendpd    $0x01, %%ymm4, %%ymm0, %%ymm0")         /* ymm0 = s */ \
+        BIQUAD_F64_X4_STEP(B0, B1, B2, A1, A2, FMA_SEL) \
+        __ASM_EMIT("vmovapd     %%ymm2, %%ymm6")                        /* ymm6 = d0' */ \
+        __ASM_EMIT("vmovapd     %%ymm3, %%ymm7")                        /* ymm7 = d1' */ \
+        __ASM_EMIT("vmovsd      %%xmm0, 0x00(%[dst])")                  /* *dst = s2[3] */ \
+        __ASM_EMIT("add         $0x08, %[dst]")                         /* dst++ */ \
+        __ASM_EMIT("dec         %[count]") \
+        __ASM_EMIT("jnz         3b") \
+        __ASM_EMIT("4:") \
+        /* Prepare last loop */ \
+        __ASM_EMIT("vmovapd     %[MASK], %%ymm5")                       /* ymm5 = m[0] m[1] m[2] m[3] */ \
+        __ASM_EMIT("vxorpd      %%ymm2, %%ymm2, %%ymm2")                /* ymm2 = 0 0 0 0 */ \
+        __ASM_EMIT("vperm2f128  $0x01, %%ymm5, %%ymm5, %%ymm4")         /* ymm4 = m[2] m[3] m[0] m[1] */ \
+        __ASM_EMIT("shl         $1, %[mask]")                           /* mask = mask << 1 */ \
+        __ASM_EMIT("vshufpd     $0x05, %%ymm5, %%ymm4, %%ymm4")         /* ymm4 = m[3] m[0] m[1] m[2] */ \
+        __ASM_EMIT("and         $0x0f, %[mask]")                        /* mask = (mask << 1) & 0x0f */ \
+        __ASM_EMIT("vblendpd    $0x01, %%ymm2, %%ymm4, %%ymm5")         /* ymm5 = 0 m[0] m[1] m[2] */ \
+        __ASM_EMIT("vmovapd     %%ymm5, %[MASK]") \
+        /* Process steps */ \
+        __ASM_EMIT("5:") \
+        BIQUAD_F64_X4_STEP(B0, B1, B2, A1, A2, FMA_SEL) \
+        __ASM_EMIT("vmovapd     %[MASK], %%ymm5")                       /* ymm5 = mask */ \
+        __ASM_EMIT("test        $0x08, %[mask]") \
+        __ASM_EMIT("jz          7f") \
+        __ASM_EMIT("vmovsd      %%xmm0, 0x00(%[dst])")                  /* *dst = s2[3] */ \
+        __ASM_EMIT("add         $0x08, %[dst]")                         /* dst++ */ \
+        __ASM_EMIT("7:") \
+        __ASM_EMIT("vblendvpd   %%ymm5, %%ymm2, %%ymm6, %%ymm6")        /* ymm6 = (d0' & MASK) | (d0 & ~MASK) */ \
+        __ASM_EMIT("vblendvpd   %%ymm5, %%ymm3, %%ymm7, %%ymm7")        /* ymm7 = (d1' & MASK) | (d1 & ~MASK) */ \
+        /* Repeat loop */ \
+        __ASM_EMIT("vxorpd      %%ymm2, %%ymm2, %%ymm2")                /* ymm2 = 0 0 0 0 */ \
+        __ASM_EMIT("vperm2f128  $0x01, %%ymm5, %%ymm5, %%ymm4")         /* ymm4 = m[2] m[3] m[0] m[1] */ \
+        __ASM_EMIT("vshufpd     $0x05, %%ymm5, %%ymm4, %%ymm4")         /* ymm4 = m[3] m[0] m[1] m[2] */ \
+        __ASM_EMIT("vblendpd    $0x01, %%ymm2, %%ymm4, %%ymm5")         /* ymm5 = 0 m[0] m[1] m[2] */ \
+        __ASM_EMIT("vmovapd     %%ymm5, %[MASK]") \
+        __ASM_EMIT("shl         $1, %[mask]")                           /* mask = mask << 1 */ \
+        __ASM_EMIT("and         $0x0f, %[mask]")                        /* mask = (mask << 1) & 0x0f */ \
+        __ASM_EMIT("jnz         5b")                                    /* check that mask is not zero */ \
+        /* Store delay buffer */ \
+        __ASM_EMIT("vmovapd     %%ymm6, " D0 "(%[f])") \
+        __ASM_EMIT("vmovapd     %%ymm7, " D1 "(%[f])")
+
+    #define BIQUAD_F64_X4_PASS(DST, SRC, B0, B1, B2, A1, A2, D0, D1, FMA_SEL) \
+        { \
+            double *dp      = DST; \
+            const double *sp= SRC; \
+            size_t n        = count; \
+            ARCH_X86_ASM \
+            ( \
+                BIQUAD_F64_X4_BODY(B0, B1, B2, A1, A2, D0, D1, FMA_SEL) \
+                : [dst] "+r" (dp), [src] "+r" (sp), \
+                  [mask] "=&r"(mask), [count] "+r" (n) \
+                : [f] "r" (f), \
+                  [X_MASK] "m" (biquad_f64_mask), \
+                  [MASK] "m" (MASK) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            ); \
+        }
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+        void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            IF_ARCH_X86(
+                double  MASK[4] __lsp_aligned32;
+                size_t  mask;
+            );
+
+            BIQUAD_F64_X4_PASS(dst, src, "0x00", "0x20", "0x40", "0x60", "0x80", "0x00", "0x20", FMA_OFF);
+        }
+
+        void biquad_process_x4_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            IF_ARCH_X86(
+                double  MASK[4] __lsp_aligned32;
+                size_t  mask;
+            );
+
+            BIQUAD_F64_X4_PASS(dst, src, "0x00", "0x20", "0x40", "0x60", "0x80", "0x00", "0x20", FMA_ON);
+        }
+
+        // The x8 bank is a cascade, so it is computed as two passes of the x4 pipeline
+        void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            IF_ARCH_X86(
+                double  MASK[4] __lsp_aligned32;
+                size_t  mask;
+            );
+
+            BIQUAD_F64_X4_PASS(dst, src, "0x00", "0x40", "0x80", "0xc0", "0x100", "0x00", "0x40", FMA_OFF);
+            BIQUAD_F64_X4_PASS(dst, dst, "0x20", "0x60", "0xa0", "0xe0", "0x120", "0x20", "0x60", FMA_OFF);
+        }
+
+        void biquad_process_x8_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            IF_ARCH_X86(
+                double  MASK[4] __lsp_aligned32;
+                size_t  mask;
+            );
+
+            BIQUAD_F64_X4_PASS(dst, src, "0x00", "0x40", "0x80", "0xc0", "0x100", "0x00", "0x40", FMA_ON);
+            BIQUAD_F64_X4_PASS(dst, dst, "0x20", "0x60", "0xa0", "0xe0", "0x120", "0x20", "0x60", FMA_ON);
+        }
+
+
+    /*
+     * Process the vector of independent lanes of the channel-parallel bank:
+     *  V - vector register type (xmm or ymm)
+     *  D1 - offset of the second delay of the lanes
+     *  B0, B1, B2, A1, A2 - offsets of coefficient rows
+     *  STEP - size of the frame in bytes
+     */
+    #define BIQUAD_CN_BODY(V, D1, B0, B1, B2, A1, A2, STEP, FMA_SEL) \
+            __ASM_EMIT("test                %[count], %[count]") \
+            __ASM_EMIT("jz                  2f") \
+            \
+            /* Load delay buffer */ \
+            __ASM_EMIT("vmovaps             0x00(%[f]), %%" V "6")                              /* v6       = d0 */ \
+            __ASM_EMIT("vmovaps             " D1 "(%[f]), %%" V "7")                            /* v7       = d1 */ \
+            \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("vmovups             (%[src]), %%" V "0")                                /* v0       = s */ \
+            __ASM_EMIT("vmulps              " B1 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "1")    /* v1       = b1*s */ \
+            __ASM_EMIT("vmulps              " B2 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "2")    /* v2       = b2*s */ \
+            __ASM_EMIT(FMA_SEL("vmulps      " B0 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "0", "")) \
+            __ASM_EMIT(FMA_SEL("vaddps      %%" V "6, %%" V "0, %%" V "0", "vfmadd132ps " B0 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "6, %%" V "0"))   /* v0       = s2 = b0*s + d0 */ \
+            __ASM_EMIT("vaddps              %%" V "7, %%" V "1, %%" V "1")                      /* v1       = b1*s + d1 */ \
+            __ASM_EMIT("vmovups             %%" V "0, (%[dst])")                                /* *dst     = s2 */ \
+            __ASM_EMIT(FMA_SEL("vmulps      " A1 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "6", "")) \
+            __ASM_EMIT(FMA_SEL("vmulps      " A2 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "7", "")) \
+            __ASM_EMIT(FMA_SEL("vaddps      %%" V "1, %%" V "6, %%" V "6", "vfmadd231ps " A1 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "1"))  /* d0'  = b1*s + a1*s2 + d1 */ \
+            __ASM_EMIT(FMA_SEL("vaddps      %%" V "2, %%" V "7, %%" V "7", "vfmadd231ps " A2 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" V "0, %%" V "2"))  /* d1'  = b2*s + a2*s2 */ \
+            __ASM_EMIT(FMA_SEL("", "vmovaps     %%" V "1, %%" V "6")) \
+            __ASM_EMIT(FMA_SEL("", "vmovaps     %%" V "2, %%" V "7")) \
+            __ASM_EMIT("add                 $" STEP ", %[src]") \
+            __ASM_EMIT("add                 $" STEP ", %[dst]") \
+            __ASM_EMIT("dec                 %[count]") \
+            __ASM_EMIT("jnz                 1b") \
+            \
+            /* Store delay buffer */ \
+            __ASM_EMIT("vmovaps             %%" V "6, 0x00(%[f])") \
+            __ASM_EMIT("vmovaps             %%" V "7, " D1 "(%[f])") \
+            \
+            __ASM_EMIT("2:") \
+            \
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count) \
+            : [f] "r" (f) \
+            : "cc", "memory", \
+              "%xmm0", "%xmm1", "%xmm2", \
+              "%xmm6", "%xmm7"
+
+        void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                BIQUAD_CN_BODY("xmm", "0x10", "0x00", "0x10", "0x20", "0x30", "0x40", "0x10", FMA_OFF)
+            );
+        }
+
+        void biquad_process_c4_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                BIQUAD_CN_BODY("xmm", "0x10", "0x00", "0x10", "0x20", "0x30", "0x40", "0x10", FMA_ON)
+            );
+        }
+
+        void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                BIQUAD_CN_BODY("ymm", "0x20", "0x00", "0x20", "0x40", "0x60", "0x80", "0x20", FMA_OFF)
+            );
+        }
+
+        void biquad_process_c8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                BIQUAD_CN_BODY("ymm", "0x20", "0x00", "0x20", "0x40", "0x60", "0x80", "0x20", FMA_ON)
+            );
+        }
+
+        // Both halves of the frame are processed simultaneously: channels 0-7 by the bank
+        // at 0x000(f), channels 8-15 by the bank at 0x100(f)
+        void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  2f")
+
+                // Load delay buffers
+                __ASM_EMIT("vmovaps             0x000(%[f]), %%ymm4")                       // ymm4     = d0 (lo)
+                __ASM_EMIT("vmovaps             0x020(%[f]), %%ymm5")                       // ymm5     = d1 (lo)
+                __ASM_EMIT("vmovaps             0x100(%[f]), %%ymm6")                       // ymm6     = d0 (hi)
+                __ASM_EMIT("vmovaps             0x120(%[f]), %%ymm7")                       // ymm7     = d1 (hi)
+
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups             0x00(%[src]), %%ymm0")                      // ymm0     = s (lo)
+                __ASM_EMIT("vmovups             0x20(%[src]), %%ymm3")                      // ymm3     = s (hi)
+                __ASM_EMIT("vmulps              0x000 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm1") // ymm1 = b0*s
+                __ASM_EMIT("vmulps              0x100 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm2") // ymm2 = b0*s
+                __ASM_EMIT("vaddps              %%ymm4, %%ymm1, %%ymm1")                    // ymm1     = s2 = b0*s + d0
+                __ASM_EMIT("vaddps              %%ymm6, %%ymm2, %%ymm2")                    // ymm2     = s2 = b0*s + d0
+                __ASM_EMIT("vmovups             %%ymm1, 0x00(%[dst])")                      // *dst     = s2
+                __ASM_EMIT("vmovups             %%ymm2, 0x20(%[dst])")
+                __ASM_EMIT("vmulps              0x020 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm4") // ymm4 = b1*s
+                __ASM_EMIT("vmulps              0x120 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm6") // ymm6 = b1*s
+                __ASM_EMIT("vaddps              %%ymm5, %%ymm4, %%ymm4")                    // ymm4     = b1*s + d1
+                __ASM_EMIT("vaddps              %%ymm7, %%ymm6, %%ymm6")                    // ymm6     = b1*s + d1
+                __ASM_EMIT("vmulps              0x040 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm5") // ymm5 = b2*s
+                __ASM_EMIT("vmulps              0x140 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm7") // ymm7 = b2*s
+                __ASM_EMIT("vmulps              0x060 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm1, %%ymm0") // ymm0 = a1*s2
+                __ASM_EMIT("vmulps              0x160 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm2, %%ymm3") // ymm3 = a1*s2
+                __ASM_EMIT("vaddps              %%ymm0, %%ymm4, %%ymm4")                    // ymm4     = d0' = b1*s + a1*s2 + d1
+                __ASM_EMIT("vaddps              %%ymm3, %%ymm6, %%ymm6")                    // ymm6     = d0' = b1*s + a1*s2 + d1
+                __ASM_EMIT("vmulps              0x080 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm1, %%ymm1") // ymm1 = a2*s2
+                __ASM_EMIT("vmulps              0x180 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm2, %%ymm2") // ymm2 = a2*s2
+                __ASM_EMIT("vaddps              %%ymm1, %%ymm5, %%ymm5")                    // ymm5     = d1' = b2*s + a2*s2
+                __ASM_EMIT("vaddps              %%ymm2, %%ymm7, %%ymm7")                    // ymm7     = d1' = b2*s + a2*s2
+                __ASM_EMIT("add                 $0x40, %[src]")
+                __ASM_EMIT("add                 $0x40, %[dst]")
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 1b")
+
+                // Store delay buffers
+                __ASM_EMIT("vmovaps             %%ymm4, 0x000(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm5, 0x020(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm6, 0x100(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm7, 0x120(%[f])")
+
+                __ASM_EMIT("2:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void biquad_process_c16_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  2f")
+
+                // Load delay buffers
+                __ASM_EMIT("vmovaps             0x000(%[f]), %%ymm4")                       // ymm4     = d0 (lo)
+                __ASM_EMIT("vmovaps             0x020(%[f]), %%ymm5")                       // ymm5     = d1 (lo)
+                __ASM_EMIT("vmovaps             0x100(%[f]), %%ymm6")                       // ymm6     = d0 (hi)
+                __ASM_EMIT("vmovaps             0x120(%[f]), %%ymm7")                       // ymm7     = d1 (hi)
+
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups             0x00(%[src]), %%ymm0")                      // ymm0     = s (lo)
+                __ASM_EMIT("vmovups             0x20(%[src]), %%ymm3")                      // ymm3     = s (hi)
+                __ASM_EMIT("vfmadd231ps         0x000 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm4") // ymm4 = s2 = b0*s + d0
+                __ASM_EMIT("vfmadd231ps         0x100 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm6") // ymm6 = s2 = b0*s + d0
+                __ASM_EMIT("vmovups             %%ymm4, 0x00(%[dst])")                      // *dst     = s2
+                __ASM_EMIT("vmovups             %%ymm6, 0x20(%[dst])")
+                __ASM_EMIT("vfmadd231ps         0x020 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm5") // ymm5 = b1*s + d1
+                __ASM_EMIT("vfmadd231ps         0x120 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm7") // ymm7 = b1*s + d1
+                __ASM_EMIT("vmulps              0x040 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm0, %%ymm1") // ymm1 = b2*s
+                __ASM_EMIT("vmulps              0x140 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3, %%ymm2") // ymm2 = b2*s
+                __ASM_EMIT("vfmadd231ps         0x060 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm4, %%ymm5") // ymm5 = d0' = b1*s + a1*s2 + d1
+                __ASM_EMIT("vfmadd231ps         0x160 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm6, %%ymm7") // ymm7 = d0' = b1*s + a1*s2 + d1
+                __ASM_EMIT("vfmadd231ps         0x080 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm4, %%ymm1") // ymm1 = d1' = b2*s + a2*s2
+                __ASM_EMIT("vfmadd231ps         0x180 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm6, %%ymm2") // ymm2 = d1' = b2*s + a2*s2
+                __ASM_EMIT("vmovaps             %%ymm5, %%ymm4")                            // ymm4     = d0
+                __ASM_EMIT("vmovaps             %%ymm7, %%ymm6")
+                __ASM_EMIT("vmovaps             %%ymm1, %%ymm5")                            // ymm5     = d1
+                __ASM_EMIT("vmovaps             %%ymm2, %%ymm7")
+                __ASM_EMIT("add                 $0x40, %[src]")
+                __ASM_EMIT("add                 $0x40, %[dst]")
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 1b")
+
+                // Store delay buffers
+                __ASM_EMIT("vmovaps             %%ymm4, 0x000(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm5, 0x020(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm6, 0x100(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm7, 0x120(%[f])")
+
+                __ASM_EMIT("2:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    /*
+     * Process one frame of eight lanes stored in the register X:
+     *  ymm10 = b0, ymm11 = b1, ymm12 = b2, ymm13 = a1, ymm14 = d0, ymm15 = d1
+     *  ymm0, ymm4 - temporary registers
+     */
+    #define BIQUAD_S8_STEP(X, FMA_SEL) \
+            __ASM_EMIT(FMA_SEL("vmulps      %%ymm11, %%" X ", %%ymm0", ""))                                /* ymm0     = b1*s */ \
+            __ASM_EMIT("vmulps              %%ymm12, %%" X ", %%ymm4")                                      /* ymm4     = b2*s */ \
+            __ASM_EMIT(FMA_SEL("vaddps      %%ymm15, %%ymm0, %%ymm0", "vfmadd231ps %%ymm11, %%" X ", %%ymm15"))    /* b1*s + d1 */ \
+            __ASM_EMIT(FMA_SEL("vmulps      %%ymm10, %%" X ", %%" X, "vfmadd132ps %%ymm10, %%ymm14, %%" X)) \
+            __ASM_EMIT(FMA_SEL("vaddps      %%ymm14, %%" X ", %%" X, ""))                                 /* X        = s2 = b0*s + d0 */ \
+            __ASM_EMIT(FMA_SEL("vmulps      %%ymm13, %%" X ", %%ymm14", "vfmadd231ps %%ymm13, %%" X ", %%ymm15")) \
+            __ASM_EMIT(FMA_SEL("vmulps      0x80 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" X ", %%ymm15", "vfmadd231ps 0x80 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%" X ", %%ymm4")) \
+            __ASM_EMIT(FMA_SEL("vaddps      %%ymm0, %%ymm14, %%ymm14", "vmovaps %%ymm15, %%ymm14"))     /* ymm14    = d0' = b1*s + a1*s2 + d1 */ \
+            __ASM_EMIT(FMA_SEL("vaddps      %%ymm4, %%ymm15, %%ymm15", "vmovaps %%ymm4, %%ymm15"))      /* ymm15    = d1' = b2*s + a2*s2 */
+
+    /*
+     * Each iteration loads eight rows of eight samples from the chunks, transposes them
+     * to eight frames in registers, processes the frames and transposes them back
+     */
+    #define BIQUAD_S8_BODY(FMA_SEL) \
+            __ASM_EMIT("lea                 (%[step], %[step], 2), %[step3]") \
+            \
+            /* Load delay buffer and coefficients */ \
+            __ASM_EMIT("vmovaps             0x00 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm10")  /* ymm10    = b0 */ \
+            __ASM_EMIT("vmovaps             0x20 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm11")  /* ymm11    = b1 */ \
+            __ASM_EMIT("vmovaps             0x40 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm12")  /* ymm12    = b2 */ \
+            __ASM_EMIT("vmovaps             0x60 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm13")  /* ymm13    = a1 */ \
+            __ASM_EMIT("vmovaps             0x00(%[f]), %%ymm14")                               /* ymm14    = d0 */ \
+            __ASM_EMIT("vmovaps             0x20(%[f]), %%ymm15")                               /* ymm15    = d1 */ \
+            \
+            __ASM_EMIT("1:") \
+            /* Load rows r0..r7 */ \
+            __ASM_EMIT("lea                 (%[src], %[step], 4), %[tmp]") \
+            __ASM_EMIT("vmovups             (%[src]), %%ymm0") \
+            __ASM_EMIT("vmovups             (%[src], %[step]), %%ymm1") \
+            __ASM_EMIT("vmovups             (%[src], %[step], 2), %%ymm2") \
+            __ASM_EMIT("vmovups             (%[src], %[step3]), %%ymm3") \
+            __ASM_EMIT("vmovups             (%[tmp]), %%ymm4") \
+            __ASM_EMIT("vmovups             (%[tmp], %[step]), %%ymm5") \
+            __ASM_EMIT("vmovups             (%[tmp], %[step], 2), %%ymm6") \
+            __ASM_EMIT("vmovups             (%[tmp], %[step3]), %%ymm7") \
+            /* Transpose rows to frames f0..f7 */ \
+            __ASM_EMIT("vunpcklps           %%ymm1, %%ymm0, %%ymm8")                            /* ymm8     = t0 = r0 r1 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm1, %%ymm0, %%ymm9")                            /* ymm9     = t1 = r0 r1 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm3, %%ymm2, %%ymm0")                            /* ymm0     = t2 = r2 r3 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm3, %%ymm2, %%ymm1")                            /* ymm1     = t3 = r2 r3 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm5, %%ymm4, %%ymm2")                            /* ymm2     = t4 = r4 r5 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm5, %%ymm4, %%ymm3")                            /* ymm3     = t5 = r4 r5 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm7, %%ymm6, %%ymm4")                            /* ymm4     = t6 = r6 r7 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm7, %%ymm6, %%ymm5")                            /* ymm5     = t7 = r6 r7 hi */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm0, %%ymm8, %%ymm6")                     /* ymm6     = u0 = f0 f4 lo */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm0, %%ymm8, %%ymm7")                     /* ymm7     = u1 = f1 f5 lo */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm1, %%ymm9, %%ymm8")                     /* ymm8     = u2 = f2 f6 lo */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm1, %%ymm9, %%ymm0")                     /* ymm0     = u3 = f3 f7 lo */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm4, %%ymm2, %%ymm9")                     /* ymm9     = u4 = f0 f4 hi */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm4, %%ymm2, %%ymm1")                     /* ymm1     = u5 = f1 f5 hi */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm5, %%ymm3, %%ymm2")                     /* ymm2     = u6 = f2 f6 hi */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm5, %%ymm3, %%ymm4")                     /* ymm4     = u7 = f3 f7 hi */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm9, %%ymm6, %%ymm3")                     /* ymm3     = f0 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm9, %%ymm6, %%ymm5")                     /* ymm5     = f4 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm1, %%ymm7, %%ymm6")                     /* ymm6     = f1 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm1, %%ymm7, %%ymm9")                     /* ymm9     = f5 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm2, %%ymm8, %%ymm7")                     /* ymm7     = f2 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm2, %%ymm8, %%ymm1")                     /* ymm1     = f6 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm4, %%ymm0, %%ymm8")                     /* ymm8     = f3 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm4, %%ymm0, %%ymm2")                     /* ymm2     = f7 */ \
+            /* Process frames */ \
+            BIQUAD_S8_STEP("ymm3", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm6", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm7", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm8", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm5", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm9", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm1", FMA_SEL) \
+            BIQUAD_S8_STEP("ymm2", FMA_SEL) \
+            /* Transpose frames back to rows r0..r7 */ \
+            __ASM_EMIT("vunpcklps           %%ymm6, %%ymm3, %%ymm0")                            /* ymm0     = t0 = f0 f1 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm6, %%ymm3, %%ymm4")                            /* ymm4     = t1 = f0 f1 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm8, %%ymm7, %%ymm3")                            /* ymm3     = t2 = f2 f3 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm8, %%ymm7, %%ymm6")                            /* ymm6     = t3 = f2 f3 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm9, %%ymm5, %%ymm7")                            /* ymm7     = t4 = f4 f5 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm9, %%ymm5, %%ymm8")                            /* ymm8     = t5 = f4 f5 hi */ \
+            __ASM_EMIT("vunpcklps           %%ymm2, %%ymm1, %%ymm5")                            /* ymm5     = t6 = f6 f7 lo */ \
+            __ASM_EMIT("vunpckhps           %%ymm2, %%ymm1, %%ymm9")                            /* ymm9     = t7 = f6 f7 hi */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm3, %%ymm0, %%ymm1")                     /* ymm1     = u0 = r0 r4 lo */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm3, %%ymm0, %%ymm2")                     /* ymm2     = u1 = r1 r5 lo */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm6, %%ymm4, %%ymm0")                     /* ymm0     = u2 = r2 r6 lo */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm6, %%ymm4, %%ymm3")                     /* ymm3     = u3 = r3 r7 lo */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm5, %%ymm7, %%ymm4")                     /* ymm4     = u4 = r0 r4 hi */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm5, %%ymm7, %%ymm6")                     /* ymm6     = u5 = r1 r5 hi */ \
+            __ASM_EMIT("vshufps             $0x44, %%ymm9, %%ymm8, %%ymm7")                     /* ymm7     = u6 = r2 r6 hi */ \
+            __ASM_EMIT("vshufps             $0xee, %%ymm9, %%ymm8, %%ymm5")                     /* ymm5     = u7 = r3 r7 hi */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm4, %%ymm1, %%ymm8")                     /* ymm8     = r0 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm4, %%ymm1, %%ymm9")                     /* ymm9     = r4 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm6, %%ymm2, %%ymm1")                     /* ymm1     = r1 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm6, %%ymm2, %%ymm4")                     /* ymm4     = r5 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm7, %%ymm0, %%ymm2")                     /* ymm2     = r2 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm7, %%ymm0, %%ymm6")                     /* ymm6     = r6 */ \
+            __ASM_EMIT("vperm2f128          $0x20, %%ymm5, %%ymm3, %%ymm0")                     /* ymm0     = r3 */ \
+            __ASM_EMIT("vperm2f128          $0x31, %%ymm5, %%ymm3, %%ymm7")                     /* ymm7     = r7 */ \
+            /* Store rows r0..r7 */ \
+            __ASM_EMIT("lea                 (%[dst], %[step], 4), %[tmp]") \
+            __ASM_EMIT("vmovups             %%ymm8, (%[dst])") \
+            __ASM_EMIT("vmovups             %%ymm1, (%[dst], %[step])") \
+            __ASM_EMIT("vmovups             %%ymm2, (%[dst], %[step], 2)") \
+            __ASM_EMIT("vmovups             %%ymm0, (%[dst], %[step3])") \
+            __ASM_EMIT("vmovups             %%ymm9, (%[tmp])") \
+            __ASM_EMIT("vmovups             %%ymm4, (%[tmp], %[step])") \
+            __ASM_EMIT("vmovups             %%ymm6, (%[tmp], %[step], 2)") \
+            __ASM_EMIT("vmovups             %%ymm7, (%[tmp], %[step3])") \
+            __ASM_EMIT("add                 $0x20, %[src]") \
+            __ASM_EMIT("add                 $0x20, %[dst]") \
+            __ASM_EMIT("sub                 $8, %[count]") \
+            __ASM_EMIT("jnz                 1b") \
+            \
+            /* Store delay buffer */ \
+            __ASM_EMIT("vmovaps             %%ymm14, 0x00(%[f])") \
+            __ASM_EMIT("vmovaps             %%ymm15, 0x20(%[f])") \
+            \
+            : [dst] "+r" (p), [src] "+r" (s), [count] "+r" (n), \
+              [step3] "=&r" (step3), [tmp] "=&r" (tmp) \
+            : [f] "r" (f), [step] "r" (step) \
+            : "cc", "memory", \
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7", \
+              "%xmm8", "%xmm9", "%xmm10", "%xmm11", \
+              "%xmm12", "%xmm13", "%xmm14", "%xmm15"
+
+    /*
+     * Process the tail of each chunk which is shorter than eight samples
+     * as the interleaved frames
+     */
+    #define BIQUAD_S8_TAIL(C8) \
+            const size_t tail   = count - blocks; \
+            if (tail > 0) \
+            { \
+                float buf[8 * 8] __lsp_aligned32; \
+                for (size_t j=0; j<8; ++j) \
+                    for (size_t i=0; i<tail; ++i) \
+                        buf[i*8 + j]    = src[j*stride + blocks + i]; \
+                \
+                C8(buf, buf, tail, f); \
+                \
+                for (size_t j=0; j<8; ++j) \
+                    for (size_t i=0; i<tail; ++i) \
+                        dst[j*stride + blocks + i]  = buf[i*8 + j]; \
+            }
+
+        void x64_biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f)
+        {
+            const size_t step   = stride * sizeof(float);
+            const size_t blocks = count & ~size_t(7);
+
+            if (blocks > 0)
+            {
+                const float *s      = src;
+                float *p            = dst;
+                size_t n            = blocks;
+                IF_ARCH_X86_64(size_t step3, tmp);
+
+                ARCH_X86_64_ASM
+                (
+                    BIQUAD_S8_BODY(FMA_OFF)
+                );
+            }
+
+            BIQUAD_S8_TAIL(biquad_process_c8)
+        }
+
+        void x64_biquad_process_s8_fma3(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f)
+        {
+            const size_t step   = stride * sizeof(float);
+            const size_t blocks = count & ~size_t(7);
+
+            if (blocks > 0)
+            {
+                const float *s      = src;
+                float *p            = dst;
+                size_t n            = blocks;
+                IF_ARCH_X86_64(size_t step3, tmp);
+
+                ARCH_X86_64_ASM
+                (
+                    BIQUAD_S8_BODY(FMA_ON)
+                );
+            }
+
+            BIQUAD_S8_TAIL(biquad_process_c8_fma3)
+        }
+
+    #undef BIQUAD_S8_TAIL
+    #undef BIQUAD_S8_BODY
+    #undef BIQUAD_S8_STEP
+    #undef BIQUAD_CN_BODY
+    #undef FMA_OFF
+    #undef FMA_ON
+    #undef BIQUAD_F64_X4_PASS
+    #undef BIQUAD_F64_X4_BODY
+    #undef BIQUAD_F64_X4_STEP
     }
 }
 
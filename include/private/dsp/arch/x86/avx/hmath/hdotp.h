@@ -340,6 +340,114 @@ namespace lsp
 
             return result;
         }
+
+        double h_dotp_f64(const double *a, const double *b, size_t count)
+        {
+            IF_ARCH_X86(
+                double result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vxorpd          %%ymm0, %%ymm0, %%ymm0")
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("vxorpd          %%ymm1, %%ymm1, %%ymm1")
+                __ASM_EMIT("sub             $24, %[count]")
+                __ASM_EMIT("jb              2f")
+                /* x24 blocks */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm2")
+                __ASM_EMIT("vmovupd         0x20(%[a], %[off]), %%ymm3")
+                __ASM_EMIT("vmovupd         0x40(%[a], %[off]), %%ymm4")
+                __ASM_EMIT("vmovupd         0x60(%[a], %[off]), %%ymm5")
+                __ASM_EMIT("vmovupd         0x80(%[a], %[off]), %%ymm6")
+                __ASM_EMIT("vmovupd         0xa0(%[a], %[off]), %%ymm7")
+                __ASM_EMIT("vmulpd          0x00(%[b], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vmulpd          0x20(%[b], %[off]), %%ymm3, %%ymm3")
+                __ASM_EMIT("vmulpd          0x40(%[b], %[off]), %%ymm4, %%ymm4")
+                __ASM_EMIT("vmulpd          0x60(%[b], %[off]), %%ymm5, %%ymm5")
+                __ASM_EMIT("vmulpd          0x80(%[b], %[off]), %%ymm6, %%ymm6")
+                __ASM_EMIT("vmulpd          0xa0(%[b], %[off]), %%ymm7, %%ymm7")
+                __ASM_EMIT("vaddpd          %%ymm2, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          %%ymm6, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm7, %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0xc0, %[off]")
+                __ASM_EMIT("sub             $24, %[count]")
+                __ASM_EMIT("jae             1b")
+                /* x16 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm2")
+                __ASM_EMIT("vmovupd         0x20(%[a], %[off]), %%ymm3")
+                __ASM_EMIT("vmovupd         0x40(%[a], %[off]), %%ymm4")
+                __ASM_EMIT("vmovupd         0x60(%[a], %[off]), %%ymm5")
+                __ASM_EMIT("vmulpd          0x00(%[b], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vmulpd          0x20(%[b], %[off]), %%ymm3, %%ymm3")
+                __ASM_EMIT("vmulpd          0x40(%[b], %[off]), %%ymm4, %%ymm4")
+                __ASM_EMIT("vmulpd          0x60(%[b], %[off]), %%ymm5, %%ymm5")
+                __ASM_EMIT("vaddpd          %%ymm2, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          %%ymm4, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm5, %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0x80, %[off]")
+                __ASM_EMIT("sub             $16, %[count]")
+                /* x8 block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm2")
+                __ASM_EMIT("vmovupd         0x20(%[a], %[off]), %%ymm3")
+                __ASM_EMIT("vmulpd          0x00(%[b], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vmulpd          0x20(%[b], %[off]), %%ymm3, %%ymm3")
+                __ASM_EMIT("vaddpd          %%ymm2, %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          %%ymm3, %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0x40, %[off]")
+                __ASM_EMIT("sub             $8, %[count]")
+                /* x4 block */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("vaddpd          %%ymm1, %%ymm0, %%ymm0")
+                __ASM_EMIT("jl              8f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm2")
+                __ASM_EMIT("vmulpd          0x00(%[b], %[off]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vaddpd          %%ymm2, %%ymm0, %%ymm0")
+                __ASM_EMIT("add             $0x20, %[off]")
+                __ASM_EMIT("sub             $4, %[count]")
+                /* x2 block */
+                __ASM_EMIT("8:")
+                __ASM_EMIT("vextractf128    $0x01, %%ymm0, %%xmm1")
+                __ASM_EMIT("add             $2, %[count]")
+                __ASM_EMIT("vaddpd          %%xmm1, %%xmm0, %%xmm0")
+                __ASM_EMIT("jl              10f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%xmm2")
+                __ASM_EMIT("vmulpd          0x00(%[b], %[off]), %%xmm2, %%xmm2")
+                __ASM_EMIT("vaddpd          %%xmm2, %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $0x10, %[off]")
+                __ASM_EMIT("sub             $2, %[count]")
+                /* x1 block */
+                __ASM_EMIT("10:")
+                __ASM_EMIT("vhaddpd         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $1, %[count]")
+                __ASM_EMIT("jl              12f")
+                __ASM_EMIT("vmovsd          0x00(%[a], %[off]), %%xmm2")
+                __ASM_EMIT("vmulsd          0x00(%[b], %[off]), %%xmm2, %%xmm2")
+                __ASM_EMIT("vaddsd          %%xmm2, %%xmm0, %%xmm0")
+                /* end */
+                __ASM_EMIT("12:")
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
     }
 }
 
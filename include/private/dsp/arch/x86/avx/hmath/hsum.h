@@ -398,6 +398,81 @@ namespace lsp
 
             return result;
         }
+
+        double h_sum_f64(const double *src, size_t count)
+        {
+            IF_ARCH_X86(double result);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vxorpd          %%ymm0, %%ymm0, %%ymm0")
+                __ASM_EMIT("vxorpd          %%ymm1, %%ymm1, %%ymm1")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jb              2f")
+                /* x32 blocks */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0x20(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          0x40(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0x60(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          0x80(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0xa0(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          0xc0(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0xe0(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0x100, %[src]")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jae             1b")
+                /* x16 block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add             $16, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0x20(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("vaddpd          0x40(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0x60(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0x80, %[src]")
+                __ASM_EMIT("sub             $16, %[count]")
+                /* x8 block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("vaddpd          0x20(%[src]), %%ymm1, %%ymm1")
+                __ASM_EMIT("add             $0x40, %[src]")
+                __ASM_EMIT("sub             $8, %[count]")
+                /* x4 block */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("vaddpd          %%ymm1, %%ymm0, %%ymm0")
+                __ASM_EMIT("jl              8f")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("add             $0x20, %[src]")
+                __ASM_EMIT("sub             $4, %[count]")
+                /* x2 block */
+                __ASM_EMIT("8:")
+                __ASM_EMIT("vextractf128    $0x01, %%ymm0, %%xmm1")
+                __ASM_EMIT("add             $2, %[count]")
+                __ASM_EMIT("vaddpd          %%xmm1, %%xmm0, %%xmm0")
+                __ASM_EMIT("jl              10f")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $0x10, %[src]")
+                __ASM_EMIT("sub             $2, %[count]")
+                /* x1 block */
+                __ASM_EMIT("10:")
+                __ASM_EMIT("vhaddpd         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $1, %[count]")
+                __ASM_EMIT("jl              12f")
+                __ASM_EMIT("vaddsd          0x00(%[src]), %%xmm0, %%xmm0")
+                /* end */
+                __ASM_EMIT("12:")
+                : [src] "+r" (src), [count] "+r" (count),
+                  [res] "=Yz" (result)
+                :
+                : "cc", "memory",
+                  "%xmm1"
+            );
+
+            return result;
+        }
     } /* namespace avx */
 } /* namespace lsp */
 
@@ -1287,6 +1287,75 @@ namespace lsp
             );
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vxorps                  %%ymm6, %%ymm6, %%ymm6")
+                /* x16 blocks */
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jb                      2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups                 0x00(%[src]), %%ymm0")                      /* ymm0 = s0 s1 s2 s3 s4 s5 s6 s7 */
+                __ASM_EMIT("vmovups                 0x20(%[src]), %%ymm2")
+                __ASM_EMIT("vmulps                  0x00(%[w]), %%ymm0, %%ymm0")                /* ymm0 = r0 r1 r2 r3 r4 r5 r6 r7 */
+                __ASM_EMIT("vmulps                  0x20(%[w]), %%ymm2, %%ymm2")
+                __ASM_EMIT("vunpckhps               %%ymm6, %%ymm0, %%ymm1")                    /* ymm1 = r2 0 r3 0 r6 0 r7 0 */
+                __ASM_EMIT("vunpckhps               %%ymm6, %%ymm2, %%ymm3")
+                __ASM_EMIT("vunpcklps               %%ymm6, %%ymm0, %%ymm0")                    /* ymm0 = r0 0 r1 0 r4 0 r5 0 */
+                __ASM_EMIT("vunpcklps               %%ymm6, %%ymm2, %%ymm2")
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm1, %%ymm0, %%ymm4")             /* ymm4 = r4 0 r5 0 r6 0 r7 0 */
+                __ASM_EMIT("vperm2f128              $0x31, %%ymm3, %%ymm2, %%ymm5")
+                __ASM_EMIT("vinsertf128             $1, %%xmm1, %%ymm0, %%ymm0")                /* ymm0 = r0 0 r1 0 r2 0 r3 0 */
+                __ASM_EMIT("vinsertf128             $1, %%xmm3, %%ymm2, %%ymm2")
+                __ASM_EMIT("vmovups                 %%ymm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovups                 %%ymm4, 0x20(%[dst])")
+                __ASM_EMIT("vmovups                 %%ymm2, 0x40(%[dst])")
+                __ASM_EMIT("vmovups                 %%ymm5, 0x60(%[dst])")
+                __ASM_EMIT("add                     $0x40, %[src]")
+                __ASM_EMIT("add                     $0x40, %[w]")
+                __ASM_EMIT("add                     $0x80, %[dst]")
+                __ASM_EMIT("sub                     $16, %[count]")
+                __ASM_EMIT("jae                     1b")
+                __ASM_EMIT("2:")
+                /* x4 blocks */
+                __ASM_EMIT("add                     $12, %[count]")
+                __ASM_EMIT("jl                      4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovups                 0x00(%[src]), %%xmm0")                      /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("vmulps                  0x00(%[w]), %%xmm0, %%xmm0")                /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("vunpckhps               %%xmm6, %%xmm0, %%xmm1")                    /* xmm1 = r2 0 r3 0 */
+                __ASM_EMIT("vunpcklps               %%xmm6, %%xmm0, %%xmm0")                    /* xmm0 = r0 0 r1 0 */
+                __ASM_EMIT("vmovups                 %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("vmovups                 %%xmm1, 0x10(%[dst])")
+                __ASM_EMIT("add                     $0x10, %[src]")
+                __ASM_EMIT("add                     $0x10, %[w]")
+                __ASM_EMIT("add                     $0x20, %[dst]")
+                __ASM_EMIT("sub                     $4, %[count]")
+                __ASM_EMIT("jge                     3b")
+                __ASM_EMIT("4:")
+                /* x1 blocks */
+                __ASM_EMIT("add                     $3, %[count]")
+                __ASM_EMIT("jl                      6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovss                  0x00(%[src]), %%xmm0")
+                __ASM_EMIT("vmulss                  0x00(%[w]), %%xmm0, %%xmm0")
+                __ASM_EMIT("vmovlps                 %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add                     $0x04, %[src]")
+                __ASM_EMIT("add                     $0x04, %[w]")
+                __ASM_EMIT("add                     $0x08, %[dst]")
+                __ASM_EMIT("dec                     %[count]")
+                __ASM_EMIT("jge                     5b")
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [w] "+r" (w), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6"
+            );
+        }
+
         IF_ARCH_X86(
             static const float pcomplex_corr_const[] __lsp_aligned32 =
             {
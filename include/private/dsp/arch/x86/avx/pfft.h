@@ -47,6 +47,14 @@
 #define FFT_FMA(a, b)                       a
 #include <private/dsp/arch/x86/avx/fft/p_scramble.h>
 
+#define FFT_PSCRAMBLE_SELF_DIRECT_NAME      packed_scramble_self_direct32
+#define FFT_PSCRAMBLE_SELF_REVERSE_NAME     packed_scramble_self_reverse32
+#define FFT_PSCRAMBLE_COPY_DIRECT_NAME      packed_scramble_copy_direct32
+#define FFT_PSCRAMBLE_COPY_REVERSE_NAME     packed_scramble_copy_reverse32
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       a
+#include <private/dsp/arch/x86/avx/fft/p_scramble.h>
+
 #define FFT_PSCRAMBLE_SELF_DIRECT_NAME      packed_scramble_self_direct8_fma3
 #define FFT_PSCRAMBLE_SELF_REVERSE_NAME     packed_scramble_self_reverse8_fma3
 #define FFT_PSCRAMBLE_COPY_DIRECT_NAME      packed_scramble_copy_direct8_fma3
@@ -63,6 +71,14 @@
 #define FFT_FMA(a, b)                       b
 #include <private/dsp/arch/x86/avx/fft/p_scramble.h>
 
+#define FFT_PSCRAMBLE_SELF_DIRECT_NAME      packed_scramble_self_direct32_fma3
+#define FFT_PSCRAMBLE_SELF_REVERSE_NAME     packed_scramble_self_reverse32_fma3
+#define FFT_PSCRAMBLE_COPY_DIRECT_NAME      packed_scramble_copy_direct32_fma3
+#define FFT_PSCRAMBLE_COPY_REVERSE_NAME     packed_scramble_copy_reverse32_fma3
+#define FFT_TYPE                            uint32_t
+#define FFT_FMA(a, b)                       b
+#include <private/dsp/arch/x86/avx/fft/p_scramble.h>
+
 namespace lsp
 {
     namespace avx
@@ -71,15 +87,15 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = dst[0] + dst[2];
-                float s1_re     = dst[0] - dst[2];
-                float s0_im     = dst[1] + dst[3];
-                float s1_im     = dst[1] - dst[3];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
 
-                float s2_re     = dst[4] + dst[6];
-                float s3_re     = dst[4] - dst[6];
-                float s2_im     = dst[5] + dst[7];
-                float s3_im     = dst[5] - dst[7];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = s0_re + s2_re;
                 dst[1]          = s0_im + s2_im;
@@ -113,15 +129,15 @@ namespace lsp
         {
             if (rank == 2)
             {
-                float s0_re     = src[0] + src[2];
-                float s1_re     = src[0] - src[2];
-                float s2_re     = src[4] + src[6];
-                float s3_re     = src[4] - src[6];
+                float s0_re     = src[0] + src[4];
+                float s1_re     = src[0] - src[4];
+                float s2_re     = src[2] + src[6];
+                float s3_re     = src[2] - src[6];
 
-                float s0_im     = src[1] + src[3];
-                float s1_im     = src[1] - src[3];
-                float s2_im     = src[5] + src[7];
-                float s3_im     = src[5] - src[7];
+                float s0_im     = src[1] + src[5];
+                float s1_im     = src[1] - src[5];
+                float s2_im     = src[3] + src[7];
+                float s3_im     = src[3] - src[7];
 
                 dst[0]          = (s0_re + s2_re)*0.25f;
                 dst[1]          = (s0_im + s2_im)*0.25f;
@@ -139,10 +155,10 @@ namespace lsp
                 // s1' = s0 - s1
                 float s1_re     = src[2];
                 float s1_im     = src[3];
-                dst[2]          = src[0] - s1_re;
-                dst[3]          = src[1] - s1_im;
-                dst[0]          = src[0] + s1_re;
-                dst[1]          = src[1] + s1_im;
+                dst[2]          = (src[0] - s1_re) * 0.5f;
+                dst[3]          = (src[1] - s1_im) * 0.5f;
+                dst[0]          = (src[0] + s1_re) * 0.5f;
+                dst[1]          = (src[1] + s1_im) * 0.5f;
             }
             else
             {
@@ -165,15 +181,19 @@ namespace lsp
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
                 if (rank <= 8)
                     packed_scramble_self_direct8(dst, rank);
-                else
+                else if (rank <= 16)
                     packed_scramble_self_direct16(dst, rank);
+                else
+                    packed_scramble_self_direct32(dst, rank);
             }
             else
             {
                 if (rank <= 12)
                     packed_scramble_copy_direct8(dst, src, rank-4);
-                else
+                else if (rank <= 20)
                     packed_scramble_copy_direct16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32(dst, src, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -195,15 +215,19 @@ namespace lsp
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
                 if (rank <= 8)
                     packed_scramble_self_reverse8(dst, rank);
-                else
+                else if (rank <= 16)
                     packed_scramble_self_reverse16(dst, rank);
+                else
+                    packed_scramble_self_reverse32(dst, rank);
             }
             else
             {
                 if (rank <= 12)
                     packed_scramble_copy_reverse8(dst, src, rank-4);
-                else
+                else if (rank <= 20)
                     packed_scramble_copy_reverse16(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32(dst, src, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -225,15 +249,19 @@ namespace lsp
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
                 if (rank <= 8)
                     packed_scramble_self_direct8_fma3(dst, rank);
-                else
+                else if (rank <= 16)
                     packed_scramble_self_direct16_fma3(dst, rank);
+                else
+                    packed_scramble_self_direct32_fma3(dst, rank);
             }
             else
             {
                 if (rank <= 12)
                     packed_scramble_copy_direct8_fma3(dst, src, rank-4);
-                else
+                else if (rank <= 20)
                     packed_scramble_copy_direct16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_direct32_fma3(dst, src, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
@@ -255,15 +283,19 @@ namespace lsp
                 dsp::move(dst, src, 2 << rank); // 1 << rank + 1
                 if (rank <= 8)
                     packed_scramble_self_reverse8_fma3(dst, rank);
-                else
+                else if (rank <= 16)
                     packed_scramble_self_reverse16_fma3(dst, rank);
+                else
+                    packed_scramble_self_reverse32_fma3(dst, rank);
             }
             else
             {
                 if (rank <= 12)
                     packed_scramble_copy_reverse8_fma3(dst, src, rank-4);
-                else
+                else if (rank <= 20)
                     packed_scramble_copy_reverse16_fma3(dst, src, rank-4);
+                else
+                    packed_scramble_copy_reverse32_fma3(dst, src, rank-4);
             }
 
             for (size_t i=3; i < rank; ++i)
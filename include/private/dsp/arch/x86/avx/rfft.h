@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+        static const float XRFFT_SMALL_W[] __lsp_aligned32 =
+        {
+            // cos(2*pi*k/16)
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f,
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            // sin(2*pi*k/16)
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f
+        };
+
+        static void real_small_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[16];
+            size_t items    = size_t(1) << rank;
+            size_t shift    = 4 - rank;
+            for (size_t i=0; i<items; ++i)
+                buf[i]          = src[i];
+
+            for (size_t k=0; k <= (items >> 1); ++k)
+            {
+                float re        = 0.0f;
+                float im        = 0.0f;
+                for (size_t i=0; i<items; ++i)
+                {
+                    size_t idx      = ((k * i) << shift) & 0xf;
+                    re             += buf[i] * XRFFT_SMALL_W[idx];
+                    im             -= buf[i] * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[k*2]        = re;
+                dst[k*2 + 1]    = im;
+            }
+        }
+
+        static void real_small_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[18];
+            size_t items    = size_t(1) << rank;
+            size_t half     = items >> 1;
+            size_t shift    = 4 - rank;
+            float k         = 1.0f / items;
+            for (size_t i=0; i<=half; ++i)
+            {
+                buf[i*2]        = src[i*2];
+                buf[i*2 + 1]    = src[i*2 + 1];
+            }
+
+            for (size_t i=0; i<items; ++i)
+            {
+                float re        = 0.0f;
+                for (size_t j=0; j<items; ++j)
+                {
+                    size_t idx      = ((i * j) << shift) & 0xf;
+                    float xr        = (j <= half) ? buf[j*2] : buf[(items - j)*2];
+                    float xi        = (j <= half) ? buf[j*2 + 1] : -buf[(items - j)*2 + 1];
+                    re             += xr * XRFFT_SMALL_W[idx] - xi * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[i]          = re * k;
+            }
+        }
+
+        /*
+         * Prepare the twiddle factors for the split stage. The order of harmonics
+         * in lanes matches the order produced by vshufps: k+0 k+1 k+4 k+5 k+2 k+3 k+6 k+7
+         *   tw[0..7]   = w_re * 0.5
+         *   tw[8..15]  = w_im * 0.5
+         *   tw[16..23] = dw_re
+         *   tw[24..31] = dw_im
+         *   tw[32..39] = 0.5
+         */
+        static inline void real_fft_split_init(float *tw, size_t rank)
+        {
+            static const uint8_t lanes[] = { 1, 2, 5, 6, 3, 4, 7, 8 };
+            const float *iw     = &FFT_A[(rank - 3) << 4];
+            const float *dw     = &FFT_DW[(rank - 3) << 4];
+
+            for (size_t i=0; i<8; ++i)
+            {
+                size_t k        = lanes[i];
+                tw[i]           = ((k < 8) ? iw[k] : dw[0]) * 0.5f;
+                tw[i + 8]       = ((k < 8) ? iw[k + 8] : dw[8]) * 0.5f;
+                tw[i + 16]      = dw[0];
+                tw[i + 24]      = dw[8];
+                tw[i + 32]      = 0.5f;
+            }
+        }
+
+        #define RFFT_LOAD_PAIR(a, b) \
+            /* Load front and back blocks and de-interleave them */ \
+            __ASM_EMIT("vmovups         0x00(" a "), %%ymm0")                       /* ymm0 = a1 a2 a3 a4 */ \
+            __ASM_EMIT("vmovups         0x20(" a "), %%ymm4")                       /* ymm4 = a5 a6 a7 a8 */ \
+            __ASM_EMIT("vmovups         0x00(" b "), %%ymm2")                       /* ymm2 = b8 b7 b6 b5 */ \
+            __ASM_EMIT("vmovups         0x20(" b "), %%ymm6")                       /* ymm6 = b4 b3 b2 b1 */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm4, %%ymm0, %%ymm1")             /* ymm1 = ai1 ai2 ai5 ai6 ai3 ai4 ai7 ai8 */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm4, %%ymm0, %%ymm0")             /* ymm0 = ar1 ar2 ar5 ar6 ar3 ar4 ar7 ar8 */ \
+            __ASM_EMIT("vshufps         $0xdd, %%ymm6, %%ymm2, %%ymm3")             /* ymm3 = bi8 bi7 bi4 bi3 bi6 bi5 bi2 bi1 */ \
+            __ASM_EMIT("vshufps         $0x88, %%ymm6, %%ymm2, %%ymm2")             /* ymm2 = br8 br7 br4 br3 br6 br5 br2 br1 */ \
+            __ASM_EMIT("vperm2f128      $0x01, %%ymm3, %%ymm3, %%ymm3")             /* ymm3 = bi6 bi5 bi2 bi1 bi8 bi7 bi4 bi3 */ \
+            __ASM_EMIT("vperm2f128      $0x01, %%ymm2, %%ymm2, %%ymm2")             /* ymm2 = br6 br5 br2 br1 br8 br7 br4 br3 */ \
+            __ASM_EMIT("vshufps         $0x1b, %%ymm3, %%ymm3, %%ymm3")             /* ymm3 = bi1 bi2 bi5 bi6 bi3 bi4 bi7 bi8 */ \
+            __ASM_EMIT("vshufps         $0x1b, %%ymm2, %%ymm2, %%ymm2")             /* ymm2 = br1 br2 br5 br6 br3 br4 br7 br8 */
+
+        #define RFFT_STORE_PAIR(a, b) \
+            /* Interleave front and back blocks and store them */ \
+            __ASM_EMIT("vunpcklps       %%ymm1, %%ymm0, %%ymm4")                    /* ymm4 = a1 a2 a3 a4 */ \
+            __ASM_EMIT("vunpckhps       %%ymm1, %%ymm0, %%ymm5")                    /* ymm5 = a5 a6 a7 a8 */ \
+            __ASM_EMIT("vshufps         $0x1b, %%ymm2, %%ymm2, %%ymm2")             /* ymm2 = br6 br5 br2 br1 br8 br7 br4 br3 */ \
+            __ASM_EMIT("vshufps         $0x1b, %%ymm3, %%ymm3, %%ymm3")             /* ymm3 = bi6 bi5 bi2 bi1 bi8 bi7 bi4 bi3 */ \
+            __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm0")                    /* ymm0 = b6 b5 b8 b7 */ \
+            __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm1")                    /* ymm1 = b2 b1 b4 b3 */ \
+            __ASM_EMIT("vperm2f128      $0x01, %%ymm0, %%ymm0, %%ymm0")             /* ymm0 = b8 b7 b6 b5 */ \
+            __ASM_EMIT("vperm2f128      $0x01, %%ymm1, %%ymm1, %%ymm1")             /* ymm1 = b4 b3 b2 b1 */ \
+            __ASM_EMIT("vmovups         %%ymm4, 0x00(" a ")") \
+            __ASM_EMIT("vmovups         %%ymm5, 0x20(" a ")") \
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(" b ")") \
+            __ASM_EMIT("vmovups         %%ymm1, 0x20(" b ")")
+
+        #define RFFT_ROTATE(FMA_SEL) \
+            /* Rotate twiddle factors */ \
+            __ASM_EMIT("vmovaps         0x00(%[tw]), %%ymm0")                       /* ymm0 = w_re */ \
+            __ASM_EMIT("vmovaps         0x20(%[tw]), %%ymm1")                       /* ymm1 = w_im */ \
+            __ASM_EMIT("vmulps          0x60(%[tw]), %%ymm1, %%ymm2")               /* ymm2 = w_im*dw_im */ \
+            __ASM_EMIT("vmulps          0x40(%[tw]), %%ymm1, %%ymm3")               /* ymm3 = w_im*dw_re */ \
+            __ASM_EMIT(FMA_SEL("vmulps  0x40(%[tw]), %%ymm0, %%ymm4", ""))          /* ymm4 = w_re*dw_re */ \
+            __ASM_EMIT(FMA_SEL("vmulps  0x60(%[tw]), %%ymm0, %%ymm5", ""))          /* ymm5 = w_re*dw_im */ \
+            __ASM_EMIT(FMA_SEL("vsubps  %%ymm2, %%ymm4, %%ymm2", "vfmsub231ps 0x40(%[tw]), %%ymm0, %%ymm2"))  /* ymm2 = w_re*dw_re - w_im*dw_im */ \
+            __ASM_EMIT(FMA_SEL("vaddps  %%ymm5, %%ymm3, %%ymm3", "vfmadd231ps 0x60(%[tw]), %%ymm0, %%ymm3"))  /* ymm3 = w_re*dw_im + w_im*dw_re */ \
+            __ASM_EMIT("vmovaps         %%ymm2, 0x00(%[tw])") \
+            __ASM_EMIT("vmovaps         %%ymm3, 0x20(%[tw])")
+
+        #define RFFT_LOOP \
+            __ASM_EMIT("add             $0x40, %[off]") \
+            __ASM_EMIT("sub             $0x40, %[boff]") \
+            __ASM_EMIT("cmp             %[boff], %[off]") \
+            __ASM_EMIT("jb              1b")
+
+        #define REAL_DIRECT_FFT_CORE(FMA_SEL, PACKED_FFT) \
+            /* Check bounds */ \
+            if (rank <= 4) \
+            { \
+                real_small_direct_fft(dst, src, rank); \
+                return; \
+            } \
+            \
+            /* Perform complex FFT of the half size */ \
+            PACKED_FFT(dst, src, rank - 1); \
+            \
+            /* Compute the first and the last harmonics */ \
+            size_t half     = size_t(1) << (rank - 1); \
+            float re        = dst[0]; \
+            float im        = dst[1]; \
+            dst[0]          = re + im; \
+            dst[1]          = 0.0f; \
+            dst[half*2]     = re - im; \
+            dst[half*2 + 1] = 0.0f; \
+            \
+            /* Process harmonic pairs k and M-k, the middle harmonic is processed by both */ \
+            float tw[40] __lsp_aligned32; \
+            real_fft_split_init(tw, rank); \
+            size_t off      = 2 * sizeof(float); \
+            size_t boff     = (half - 8) * 2 * sizeof(float); \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                RFFT_LOAD_PAIR("%[dst], %[off]", "%[dst], %[boff]") \
+                /* Compute even and odd parts */ \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")                /* ymm4 = ar-br = 2*or */ \
+                __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")                /* ymm0 = ar+br */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm5")                /* ymm5 = ai+bi = 2*oi */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1")                /* ymm1 = ai-bi */ \
+                __ASM_EMIT("vmulps          0x80(%[tw]), %%ymm0, %%ymm0")           /* ymm0 = er */ \
+                __ASM_EMIT("vmulps          0x80(%[tw]), %%ymm1, %%ymm1")           /* ymm1 = ei */ \
+                /* Apply twiddle factors */ \
+                __ASM_EMIT("vmulps          0x20(%[tw]), %%ymm5, %%ymm3")           /* ymm3 = s*oi */ \
+                __ASM_EMIT("vmulps          0x20(%[tw]), %%ymm4, %%ymm2")           /* ymm2 = s*or */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[tw]), %%ymm4, %%ymm4", ""))      /* ymm4 = c*or */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[tw]), %%ymm5, %%ymm5", ""))      /* ymm5 = c*oi */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm3, %%ymm4, %%ymm4", "vfmadd132ps 0x00(%[tw]), %%ymm3, %%ymm4"))  /* ymm4 = tr = c*or + s*oi */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm2, %%ymm5, %%ymm5", "vfmsub132ps 0x00(%[tw]), %%ymm2, %%ymm5"))  /* ymm5 = ti = c*oi - s*or */ \
+                /* Compute the output */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm2")                /* ymm2 = er - ti */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm0")                /* ymm0 = er + ti */ \
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm3")                /* ymm3 = ei + tr */ \
+                __ASM_EMIT("vsubps          %%ymm4, %%ymm1, %%ymm1")                /* ymm1 = ei - tr */ \
+                __ASM_EMIT("vxorps          %%ymm4, %%ymm4, %%ymm4")                /* ymm4 = 0 */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm4, %%ymm3")                /* ymm3 = -ei - tr */ \
+                RFFT_STORE_PAIR("%[dst], %[off]", "%[dst], %[boff]") \
+                RFFT_ROTATE(FMA_SEL) \
+                RFFT_LOOP \
+                : [off] "+r" (off), [boff] "+r" (boff) \
+                : [dst] "r" (dst), [tw] "r" (&tw[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        #define REAL_REVERSE_FFT_CORE(FMA_SEL, PACKED_FFT) \
+            /* Check bounds */ \
+            if (rank <= 4) \
+            { \
+                real_small_reverse_fft(dst, src, rank); \
+                return; \
+            } \
+            \
+            /* Compute the first harmonic */ \
+            size_t half     = size_t(1) << (rank - 1); \
+            float re        = src[0]; \
+            float im        = src[half*2]; \
+            \
+            /* Process harmonic pairs k and M-k, the middle harmonic is processed by both */ \
+            float tw[40] __lsp_aligned32; \
+            real_fft_split_init(tw, rank); \
+            size_t off      = 2 * sizeof(float); \
+            size_t boff     = (half - 8) * 2 * sizeof(float); \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("1:") \
+                RFFT_LOAD_PAIR("%[src], %[off]", "%[src], %[boff]") \
+                /* Compute even and odd parts */ \
+                __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm4")                /* ymm4 = ar-br = 2*dr */ \
+                __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")                /* ymm0 = ar+br */ \
+                __ASM_EMIT("vaddps          %%ymm3, %%ymm1, %%ymm5")                /* ymm5 = ai+bi = 2*di */ \
+                __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm1")                /* ymm1 = ai-bi */ \
+                __ASM_EMIT("vmulps          0x80(%[tw]), %%ymm0, %%ymm0")           /* ymm0 = er */ \
+                __ASM_EMIT("vmulps          0x80(%[tw]), %%ymm1, %%ymm1")           /* ymm1 = ei */ \
+                /* Apply twiddle factors */ \
+                __ASM_EMIT("vmulps          0x20(%[tw]), %%ymm4, %%ymm3")           /* ymm3 = s*dr */ \
+                __ASM_EMIT("vmulps          0x20(%[tw]), %%ymm5, %%ymm2")           /* ymm2 = s*di */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[tw]), %%ymm5, %%ymm5", ""))      /* ymm5 = c*di */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[tw]), %%ymm4, %%ymm4", ""))      /* ymm4 = c*dr */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm3, %%ymm5, %%ymm5", "vfmadd132ps 0x00(%[tw]), %%ymm3, %%ymm5"))  /* ymm5 = -or = c*di + s*dr */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm2, %%ymm4, %%ymm4", "vfmsub132ps 0x00(%[tw]), %%ymm2, %%ymm4"))  /* ymm4 = oi = c*dr - s*di */ \
+                /* Compute the output */ \
+                __ASM_EMIT("vaddps          %%ymm5, %%ymm0, %%ymm2")                /* ymm2 = er - or */ \
+                __ASM_EMIT("vsubps          %%ymm5, %%ymm0, %%ymm0")                /* ymm0 = er + or */ \
+                __ASM_EMIT("vsubps          %%ymm1, %%ymm4, %%ymm3")                /* ymm3 = oi - ei */ \
+                __ASM_EMIT("vaddps          %%ymm4, %%ymm1, %%ymm1")                /* ymm1 = ei + oi */ \
+                RFFT_STORE_PAIR("%[dst], %[off]", "%[dst], %[boff]") \
+                RFFT_ROTATE(FMA_SEL) \
+                RFFT_LOOP \
+                : [off] "+r" (off), [boff] "+r" (boff) \
+                : [dst] "r" (dst), [src] "r" (src), [tw] "r" (&tw[0]) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            ); \
+            \
+            dst[0]          = (re + im) * 0.5f; \
+            dst[1]          = (re - im) * 0.5f; \
+            \
+            /* Perform reverse complex FFT of the half size */ \
+            PACKED_FFT(dst, dst, rank - 1);
+
+        #define FMA_OFF(a, b)       a
+        #define FMA_ON(a, b)        b
+
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            REAL_DIRECT_FFT_CORE(FMA_OFF, packed_direct_fft);
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            REAL_REVERSE_FFT_CORE(FMA_OFF, packed_reverse_fft);
+        }
+
+        void real_direct_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            REAL_DIRECT_FFT_CORE(FMA_ON, packed_direct_fft_fma3);
+        }
+
+        void real_reverse_fft_fma3(float *dst, const float *src, size_t rank)
+        {
+            REAL_REVERSE_FFT_CORE(FMA_ON, packed_reverse_fft_fma3);
+        }
+
+        #undef REAL_DIRECT_FFT_CORE
+        #undef REAL_REVERSE_FFT_CORE
+        #undef RFFT_LOAD_PAIR
+        #undef RFFT_STORE_PAIR
+        #undef RFFT_ROTATE
+        #undef RFFT_LOOP
+        #undef FMA_OFF
+        #undef FMA_ON
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_RFFT_H_ */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_SDFT_H_
+#define PRIVATE_DSP_ARCH_X86_AVX_SDFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_IMPL */
+
+namespace lsp
+{
+    namespace avx
+    {
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+    /* Update one sdft_x8_t bank for single sample, ymm4 = x */
+    #define SDFT_X8_STEP(B, RE, IM, FMA_SEL) \
+        __ASM_EMIT(FMA_SEL("vmulps      0x40(%[" B "]), %%" RE ", %%ymm5", "vmulps      0x80(%[" B "]), %%ymm4, %%ymm7"))         /* ymm5 = c*re, ymm7 = k*x */ \
+        __ASM_EMIT(FMA_SEL("vmulps      0x60(%[" B "]), %%" IM ", %%ymm6", "vmulps      0x60(%[" B "]), %%" RE ", %%ymm5"))       /* ymm6 = s*im, ymm5 = s*re */ \
+        __ASM_EMIT(FMA_SEL("vmulps      0x60(%[" B "]), %%" RE ", %%" RE, "vfnmadd231ps 0x60(%[" B "]), %%" IM ", %%ymm7"))    /* re = s*re, ymm7 = k*x - s*im */ \
+        __ASM_EMIT(FMA_SEL("vmulps      0x40(%[" B "]), %%" IM ", %%" IM, "vfmadd231ps 0x40(%[" B "]), %%" IM ", %%ymm5"))     /* im = c*im, ymm5 = im' = s*re + c*im */ \
+        __ASM_EMIT(FMA_SEL("vmulps      0x80(%[" B "]), %%ymm4, %%ymm7", "vfmadd231ps 0x40(%[" B "]), %%" RE ", %%ymm7"))      /* ymm7 = k*x, ymm7 = re' = c*re - s*im + k*x */ \
+        __ASM_EMIT(FMA_SEL("vsubps      %%ymm6, %%ymm5, %%ymm5", "vmovaps     %%ymm5, %%" IM))                                  /* ymm5 = c*re - s*im, im' */ \
+        __ASM_EMIT(FMA_SEL("vaddps      %%" RE ", %%" IM ", %%" IM, "vmovaps     %%ymm7, %%" RE))                               /* im' = s*re + c*im, re' */ \
+        __ASM_EMIT(FMA_SEL("vaddps      %%ymm7, %%ymm5, %%" RE, ""))                                                            /* re' = c*re - s*im + k*x */
+
+    /* Process two banks in parallel to hide the latency of the recursion, then the last bank if present */
+    #define SDFT_PROCESS(FMA_SEL) \
+        const dsp::sdft_x8_t *b2; \
+        size_t banks = (bins + 7) >> 3; \
+        for ( ; banks >= 2; banks -= 2, bank += 2) \
+        { \
+            const float *s  = src; \
+            size_t n        = count; \
+            b2              = &bank[1]; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("vmovaps     0x00(%[b1]), %%ymm0")                   /* ymm0 = re1 */ \
+                __ASM_EMIT("vmovaps     0x20(%[b1]), %%ymm1")                   /* ymm1 = im1 */ \
+                __ASM_EMIT("vmovaps     0x00(%[b2]), %%ymm2")                   /* ymm2 = re2 */ \
+                __ASM_EMIT("vmovaps     0x20(%[b2]), %%ymm3")                   /* ymm3 = im2 */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("vbroadcastss (%[src]), %%ymm4")                     /* ymm4 = x */ \
+                SDFT_X8_STEP("b1", "ymm0", "ymm1", FMA_SEL) \
+                SDFT_X8_STEP("b2", "ymm2", "ymm3", FMA_SEL) \
+                __ASM_EMIT("add         $4, %[src]") \
+                __ASM_EMIT("dec         %[count]") \
+                __ASM_EMIT("jnz         1b") \
+                __ASM_EMIT("vmovaps     %%ymm0, 0x00(%[b1])") \
+                __ASM_EMIT("vmovaps     %%ymm1, 0x20(%[b1])") \
+                __ASM_EMIT("vmovaps     %%ymm2, 0x00(%[b2])") \
+                __ASM_EMIT("vmovaps     %%ymm3, 0x20(%[b2])") \
+                : [src] "+r" (s), [count] "+r" (n) \
+                : [b1] "r" (bank), [b2] "r" (b2) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            ); \
+        } \
+        \
+        if (banks > 0) \
+        { \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT("vmovaps     0x00(%[b1]), %%ymm0")                   /* ymm0 = re */ \
+                __ASM_EMIT("vmovaps     0x20(%[b1]), %%ymm1")                   /* ymm1 = im */ \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("vbroadcastss (%[src]), %%ymm4")                     /* ymm4 = x */ \
+                SDFT_X8_STEP("b1", "ymm0", "ymm1", FMA_SEL) \
+                __ASM_EMIT("add         $4, %[src]") \
+                __ASM_EMIT("dec         %[count]") \
+                __ASM_EMIT("jnz         1b") \
+                __ASM_EMIT("vmovaps     %%ymm0, 0x00(%[b1])") \
+                __ASM_EMIT("vmovaps     %%ymm1, 0x20(%[b1])") \
+                : [src] "+r" (src), [count] "+r" (count) \
+                : [b1] "r" (bank) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            ); \
+        }
+
+        void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count)
+        {
+            if (count <= 0)
+                return;
+            SDFT_PROCESS(FMA_OFF);
+        }
+
+        void sdft_process_fma3(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count)
+        {
+            if (count <= 0)
+                return;
+            SDFT_PROCESS(FMA_ON);
+        }
+
+    #undef SDFT_PROCESS
+    #undef SDFT_X8_STEP
+    #undef FMA_OFF
+    #undef FMA_ON
+
+    } /* namespace avx */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX_SDFT_H_ */
@@ -44,6 +44,13 @@
 #define FFT_TYPE                        uint16_t
 #include <private/dsp/arch/x86/avx512/fft/scramble.h>
 
+#define FFT_SCRAMBLE_SELF_DIRECT_NAME   scramble_self_direct32
+#define FFT_SCRAMBLE_SELF_REVERSE_NAME  scramble_self_reverse32
+#define FFT_SCRAMBLE_COPY_DIRECT_NAME   scramble_copy_direct32
+#define FFT_SCRAMBLE_COPY_REVERSE_NAME  scramble_copy_reverse32
+#define FFT_TYPE                        uint32_t
+#include <private/dsp/arch/x86/avx512/fft/scramble.h>
+
 namespace lsp
 {
     namespace avx512
@@ -148,15 +155,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_direct8(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_direct16(dst_re, dst_im, rank);
+                else
+                    scramble_self_direct32(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 13)
                     scramble_copy_direct8(dst_re, dst_im, src_re, src_im, rank - 5);
-                else
+                else if (rank <= 21)
                     scramble_copy_direct16(dst_re, dst_im, src_re, src_im, rank - 5);
+                else
+                    scramble_copy_direct32(dst_re, dst_im, src_re, src_im, rank - 5);
             }
 
             for (size_t i=4; i < rank; ++i)
@@ -178,15 +189,19 @@ namespace lsp
                 dsp::move(dst_im, src_im, 1 << rank);
                 if (rank <= 8)
                     scramble_self_reverse8(dst_re, dst_im, rank);
-                else
+                else if (rank <= 16)
                     scramble_self_reverse16(dst_re, dst_im, rank);
+                else
+                    scramble_self_reverse32(dst_re, dst_im, rank);
             }
             else
             {
                 if (rank <= 13)
                     scramble_copy_reverse8(dst_re, dst_im, src_re, src_im, rank - 5);
-                else
+                else if (rank <= 21)
                     scramble_copy_reverse16(dst_re, dst_im, src_re, src_im, rank - 5);
+                else
+                    scramble_copy_reverse32(dst_re, dst_im, src_re, src_im, rank - 5);
             }
 
             for (size_t i=4; i < rank; ++i)
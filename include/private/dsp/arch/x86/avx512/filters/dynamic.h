@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_DYNAMIC_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_DYNAMIC_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/avx512/filters/pipeline.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        void x64_dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f)
+        {
+            IF_ARCH_X86_64(size_t mask);
+
+            ARCH_X86_64_ASM
+            (
+                BIQUAD_XN_BODY("ymm", "d", "0x00", "0x20",
+                    "0x00", "0x20", "0x40", "0x60", "0x80",
+                    "7", "0xff", "0x80",
+                    __ASM_EMIT("add                 $0xa0, %[f]"))
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r" (mask), [count] "+r" (count),
+                  [f] "+r" (f)
+                : [d] "r" (d)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        void x64_dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f)
+        {
+            IF_ARCH_X86_64(size_t mask);
+
+            ARCH_X86_64_ASM
+            (
+                BIQUAD_XN_BODY("zmm", "d", "0x00", "0x40",
+                    "0x000", "0x040", "0x080", "0x0c0", "0x100",
+                    "15", "0xffff", "0x8000",
+                    __ASM_EMIT("add                 $0x140, %[f]"))
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r" (mask), [count] "+r" (count),
+                  [f] "+r" (f)
+                : [d] "r" (d)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_DYNAMIC_H_ */
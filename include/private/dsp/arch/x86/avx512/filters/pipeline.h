@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_PIPELINE_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_PIPELINE_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+/*
+ * Pipelined processing of the biquad filter bank where each SIMD lane holds one
+ * cascade and the output of the cascade is passed to the next lane on the next step.
+ * The pipeline is started and stopped by the k2 mask of the active lanes, the k1 mask
+ * selects the lane 0 which receives the input sample.
+ *
+ * Registers:
+ *   V1 = input of each cascade, V2 = d0', V3 = d1', V6 = d0, V7 = d1
+ *
+ * Parameters:
+ *   V      - name of the vector register (ymm or zmm)
+ *   MEM    - name of the operand pointing to the filter memory
+ *   D0, D1 - offsets of the filter memory
+ *   B0..A2 - offsets of the filter coefficients relative to the %[f] operand
+ *   ROT    - number of lanes minus 1
+ *   FULL   - mask with all lanes active
+ *   TOP    - mask of the last lane
+ *   FSTEP  - instruction that moves the coefficient pointer to the next bank, can be empty
+ */
+#define BIQUAD_XN_STEP(V, B0, B1, B2, A1, A2) \
+    __ASM_EMIT("vmulps              " B1 "(%[f]), %%" V "1, %%" V "2")          /* v2   = b1*s */ \
+    __ASM_EMIT("vmulps              " B2 "(%[f]), %%" V "1, %%" V "3")          /* v3   = b2*s */ \
+    __ASM_EMIT("vaddps              %%" V "7, %%" V "2, %%" V "2")              /* v2   = b1*s + d1 */ \
+    __ASM_EMIT("vfmadd132ps         " B0 "(%[f]), %%" V "6, %%" V "1")          /* v1   = s2 = b0*s + d0 */ \
+    __ASM_EMIT("vfmadd231ps         " A1 "(%[f]), %%" V "1, %%" V "2")          /* v2   = d0' = b1*s + a1*s2 + d1 */ \
+    __ASM_EMIT("vfmadd231ps         " A2 "(%[f]), %%" V "1, %%" V "3")          /* v3   = d1' = b2*s + a2*s2 */
+
+#define BIQUAD_XN_BODY(V, MEM, D0, D1, B0, B1, B2, A1, A2, ROT, FULL, TOP, FSTEP) \
+    __ASM_EMIT("test                %[count], %[count]") \
+    __ASM_EMIT("jz                  8f") \
+    \
+    /* Initialize masks and load filter memory */ \
+    __ASM_EMIT("mov                 $1, %[mask]") \
+    __ASM_EMIT("kmovw               %k[mask], %%k1")                            /* k1   = lane 0 */ \
+    __ASM_EMIT("kmovw               %k[mask], %%k2")                            /* k2   = active lanes */ \
+    __ASM_EMIT("vxorps              %%" V "1, %%" V "1, %%" V "1")              /* v1   = 0 */ \
+    __ASM_EMIT("vmovups             " D0 "(%[" MEM "]), %%" V "6")              /* v6   = d0 */ \
+    __ASM_EMIT("vmovups             " D1 "(%[" MEM "]), %%" V "7")              /* v7   = d1 */ \
+    \
+    /* Fill the pipeline */ \
+    __ASM_EMIT("1:") \
+    __ASM_EMIT("vbroadcastss        (%[src]), %%" V "1 %{%%k1%}")               /* v1[0] = s */ \
+    __ASM_EMIT("add                 $4, %[src]") \
+    BIQUAD_XN_STEP(V, B0, B1, B2, A1, A2) \
+    __ASM_EMIT("vmovaps             %%" V "2, %%" V "6 %{%%k2%}")               /* v6   = d0' for active lanes */ \
+    __ASM_EMIT("vmovaps             %%" V "3, %%" V "7 %{%%k2%}")               /* v7   = d1' for active lanes */ \
+    __ASM_EMIT("valignd             $" ROT ", %%" V "1, %%" V "1, %%" V "1")    /* v1   = s2[N-1] s2[0] ... s2[N-2] */ \
+    FSTEP \
+    __ASM_EMIT("dec                 %[count]") \
+    __ASM_EMIT("jz                  4f") \
+    __ASM_EMIT("lea                 0x01(,%[mask], 2), %[mask]")                /* mask = (mask << 1) | 1 */ \
+    __ASM_EMIT("kmovw               %k[mask], %%k2") \
+    __ASM_EMIT("cmp                 $" FULL ", %[mask]") \
+    __ASM_EMIT("jne                 1b") \
+    \
+    /* All lanes are active */ \
+    __ASM_EMIT(".align 16") \
+    __ASM_EMIT("3:") \
+    __ASM_EMIT("vbroadcastss        (%[src]), %%" V "1 %{%%k1%}")               /* v1[0] = s */ \
+    __ASM_EMIT("add                 $4, %[src]") \
+    BIQUAD_XN_STEP(V, B0, B1, B2, A1, A2) \
+    __ASM_EMIT("vmovaps             %%" V "2, %%" V "6")                        /* v6   = d0' */ \
+    __ASM_EMIT("vmovaps             %%" V "3, %%" V "7")                        /* v7   = d1' */ \
+    __ASM_EMIT("valignd             $" ROT ", %%" V "1, %%" V "1, %%" V "1")    /* v1   = s2[N-1] s2[0] ... s2[N-2] */ \
+    __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                          /* *dst = s2[N-1] */ \
+    __ASM_EMIT("add                 $4, %[dst]") \
+    FSTEP \
+    __ASM_EMIT("dec                 %[count]") \
+    __ASM_EMIT("jnz                 3b") \
+    \
+    /* Drain the pipeline */ \
+    __ASM_EMIT("4:") \
+    __ASM_EMIT("shl                 $1, %[mask]") \
+    __ASM_EMIT("and                 $" FULL ", %[mask]") \
+    __ASM_EMIT("5:") \
+    __ASM_EMIT("kmovw               %k[mask], %%k2") \
+    BIQUAD_XN_STEP(V, B0, B1, B2, A1, A2) \
+    __ASM_EMIT("vmovaps             %%" V "2, %%" V "6 %{%%k2%}")               /* v6   = d0' for active lanes */ \
+    __ASM_EMIT("vmovaps             %%" V "3, %%" V "7 %{%%k2%}")               /* v7   = d1' for active lanes */ \
+    __ASM_EMIT("valignd             $" ROT ", %%" V "1, %%" V "1, %%" V "1")    /* v1   = s2[N-1] s2[0] ... s2[N-2] */ \
+    FSTEP \
+    __ASM_EMIT("test                $" TOP ", %[mask]") \
+    __ASM_EMIT("jz                  6f") \
+    __ASM_EMIT("vmovss              %%xmm1, (%[dst])")                          /* *dst = s2[N-1] */ \
+    __ASM_EMIT("add                 $4, %[dst]") \
+    __ASM_EMIT("6:") \
+    __ASM_EMIT("shl                 $1, %[mask]") \
+    __ASM_EMIT("and                 $" FULL ", %[mask]") \
+    __ASM_EMIT("jnz                 5b") \
+    \
+    /* Store filter memory */ \
+    __ASM_EMIT("vmovups             %%" V "6, " D0 "(%[" MEM "])") \
+    __ASM_EMIT("vmovups             %%" V "7, " D1 "(%[" MEM "])") \
+    __ASM_EMIT("8:")
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_PIPELINE_H_ */
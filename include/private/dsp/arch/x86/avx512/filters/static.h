@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+#include <private/dsp/arch/x86/avx512/filters/pipeline.h>
+
+namespace lsp
+{
+    namespace avx512
+    {
+        void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            IF_ARCH_X86_64(size_t mask);
+
+            ARCH_X86_64_ASM
+            (
+                BIQUAD_XN_BODY("ymm", "f", "0x00", "0x20",
+                    "0x00 + " LSP_DSP_BIQUAD_XN_SOFF, "0x20 + " LSP_DSP_BIQUAD_XN_SOFF, "0x40 + " LSP_DSP_BIQUAD_XN_SOFF,
+                    "0x60 + " LSP_DSP_BIQUAD_XN_SOFF, "0x80 + " LSP_DSP_BIQUAD_XN_SOFF,
+                    "7", "0xff", "0x80", "")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r" (mask), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        void x64_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f)
+        {
+            IF_ARCH_X86_64(size_t mask);
+
+            ARCH_X86_64_ASM
+            (
+                BIQUAD_XN_BODY("zmm", "d", "0x00", "0x40",
+                    "0x000", "0x040", "0x080", "0x0c0", "0x100",
+                    "15", "0xffff", "0x8000", "")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [mask] "=&r" (mask), [count] "+r" (count)
+                : [f] "r" (f), [d] "r" (d)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7",
+                  "%k1", "%k2"
+            );
+        }
+
+        // Each zmm register holds the row of the bank at 0x000(f) in the low half
+        // and the row of the bank at 0x100(f) in the high half
+        void x64_biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            ARCH_X86_64_ASM
+            (
+                __ASM_EMIT("test                %[count], %[count]")
+                __ASM_EMIT("jz                  2f")
+
+                // Load delay buffers and coefficients
+                __ASM_EMIT("vmovaps             0x000(%[f]), %%ymm6")
+                __ASM_EMIT("vmovaps             0x020(%[f]), %%ymm7")
+                __ASM_EMIT("vmovaps             0x000 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm1")
+                __ASM_EMIT("vmovaps             0x020 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm2")
+                __ASM_EMIT("vmovaps             0x040 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm3")
+                __ASM_EMIT("vmovaps             0x060 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm4")
+                __ASM_EMIT("vmovaps             0x080 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%ymm5")
+                __ASM_EMIT("vinsertf64x4        $1, 0x100(%[f]), %%zmm6, %%zmm6")                                   // zmm6     = d0
+                __ASM_EMIT("vinsertf64x4        $1, 0x120(%[f]), %%zmm7, %%zmm7")                                   // zmm7     = d1
+                __ASM_EMIT("vinsertf64x4        $1, 0x100 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%zmm1, %%zmm1")      // zmm1     = b0
+                __ASM_EMIT("vinsertf64x4        $1, 0x120 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%zmm2, %%zmm2")      // zmm2     = b1
+                __ASM_EMIT("vinsertf64x4        $1, 0x140 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%zmm3, %%zmm3")      // zmm3     = b2
+                __ASM_EMIT("vinsertf64x4        $1, 0x160 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%zmm4, %%zmm4")      // zmm4     = a1
+                __ASM_EMIT("vinsertf64x4        $1, 0x180 + " LSP_DSP_BIQUAD_XN_SOFF "(%[f]), %%zmm5, %%zmm5")      // zmm5     = a2
+
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups             (%[src]), %%zmm0")                          // zmm0     = s
+                __ASM_EMIT("vfmadd231ps         %%zmm2, %%zmm0, %%zmm7")                    // zmm7     = b1*s + d1
+                __ASM_EMIT("vmulps              %%zmm3, %%zmm0, %%zmm8")                    // zmm8     = b2*s
+                __ASM_EMIT("vfmadd132ps         %%zmm1, %%zmm6, %%zmm0")                    // zmm0     = s2 = b0*s + d0
+                __ASM_EMIT("vmovups             %%zmm0, (%[dst])")                          // *dst     = s2
+                __ASM_EMIT("vfmadd231ps         %%zmm4, %%zmm0, %%zmm7")                    // zmm7     = d0' = b1*s + a1*s2 + d1
+                __ASM_EMIT("vfmadd231ps         %%zmm5, %%zmm0, %%zmm8")                    // zmm8     = d1' = b2*s + a2*s2
+                __ASM_EMIT("vmovaps             %%zmm7, %%zmm6")                            // zmm6     = d0
+                __ASM_EMIT("vmovaps             %%zmm8, %%zmm7")                            // zmm7     = d1
+                __ASM_EMIT("add                 $0x40, %[src]")
+                __ASM_EMIT("add                 $0x40, %[dst]")
+                __ASM_EMIT("dec                 %[count]")
+                __ASM_EMIT("jnz                 1b")
+
+                // Store delay buffers
+                __ASM_EMIT("vmovaps             %%ymm6, 0x000(%[f])")
+                __ASM_EMIT("vmovaps             %%ymm7, 0x020(%[f])")
+                __ASM_EMIT("vextractf64x4       $1, %%zmm6, 0x100(%[f])")
+                __ASM_EMIT("vextractf64x4       $1, %%zmm7, 0x120(%[f])")
+
+                __ASM_EMIT("2:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8"
+            );
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_STATIC_H_ */
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_TRANSFORM_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_TRANSFORM_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        static const float bilinear_transform_x16_one[] __lsp_aligned64 =
+        {
+            LSP_DSP_VEC16(1.0f)
+        };
+
+        static const uint32_t bilinear_transform_x16_idx[] __lsp_aligned64 =
+        {
+            // Top part of four cascades
+            0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x11, 0x12, 0x13, 0x18, 0x19, 0x1a, 0x1b,
+            // Bottom part of four cascades
+            0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x14, 0x15, 0x16, 0x17, 0x1c, 0x1d, 0x1e, 0x1f,
+            // Coefficients 0 and 1 of eight cascades
+            0x00, 0x04, 0x08, 0x0c, 0x10, 0x14, 0x18, 0x1c, 0x01, 0x05, 0x09, 0x0d, 0x11, 0x15, 0x19, 0x1d,
+            // Coefficients 2 and 3 of eight cascades
+            0x02, 0x06, 0x0a, 0x0e, 0x12, 0x16, 0x1a, 0x1e, 0x03, 0x07, 0x0b, 0x0f, 0x13, 0x17, 0x1b, 0x1f,
+            // Low halves of sixteen cascades
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            // High halves of sixteen cascades
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+        };
+
+        void x64_bilinear_transform_x16(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count)
+        {
+            ARCH_X86_64_ASM(
+                __ASM_EMIT("test            %[count], %[count]")
+                __ASM_EMIT("jz              100f")
+
+                // Prepare values
+                __ASM_EMIT("vbroadcastss    %[kf], %%zmm0")                     // zmm0  = kf
+                __ASM_EMIT("vmovaps         %[ONE], %%zmm2")                    // zmm2  = 1
+                __ASM_EMIT("vmulps          %%zmm0, %%zmm0, %%zmm1")            // zmm1  = kf*kf = kf2
+                __ASM_EMIT("vmovdqa32       0x000(%[IDX]), %%zmm16")            // zmm16 = top part of four cascades
+                __ASM_EMIT("vmovdqa32       0x040(%[IDX]), %%zmm17")            // zmm17 = bottom part of four cascades
+                __ASM_EMIT("vmovdqa32       0x080(%[IDX]), %%zmm18")            // zmm18 = coefficients 0 and 1 of eight cascades
+                __ASM_EMIT("vmovdqa32       0x0c0(%[IDX]), %%zmm19")            // zmm19 = coefficients 2 and 3 of eight cascades
+                __ASM_EMIT("vmovdqa32       0x100(%[IDX]), %%zmm20")            // zmm20 = low halves
+                __ASM_EMIT("vmovdqa32       0x140(%[IDX]), %%zmm21")            // zmm21 = high halves
+
+                // Do a loop
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups         0x000(%[bc]), %%zmm8")              // zmm8  = c0 c1
+                __ASM_EMIT("vmovups         0x040(%[bc]), %%zmm9")              // zmm9  = c2 c3
+                __ASM_EMIT("vmovups         0x080(%[bc]), %%zmm10")             // zmm10 = c4 c5
+                __ASM_EMIT("vmovups         0x0c0(%[bc]), %%zmm11")             // zmm11 = c6 c7
+                __ASM_EMIT("vmovups         0x100(%[bc]), %%zmm12")             // zmm12 = c8 c9
+                __ASM_EMIT("vmovups         0x140(%[bc]), %%zmm13")             // zmm13 = c10 c11
+                __ASM_EMIT("vmovups         0x180(%[bc]), %%zmm14")             // zmm14 = c12 c13
+                __ASM_EMIT("vmovups         0x1c0(%[bc]), %%zmm15")             // zmm15 = c14 c15
+
+                // Transpose, step 1: split top and bottom parts of each four cascades
+                __ASM_EMIT("vmovaps         %%zmm8, %%zmm22")
+                __ASM_EMIT("vmovaps         %%zmm10, %%zmm23")
+                __ASM_EMIT("vmovaps         %%zmm12, %%zmm24")
+                __ASM_EMIT("vmovaps         %%zmm14, %%zmm25")
+                __ASM_EMIT("vpermt2ps       %%zmm9, %%zmm16, %%zmm22")          // zmm22 = t[c0..c3]
+                __ASM_EMIT("vpermt2ps       %%zmm9, %%zmm17, %%zmm8")           // zmm8  = b[c0..c3]
+                __ASM_EMIT("vpermt2ps       %%zmm11, %%zmm16, %%zmm23")         // zmm23 = t[c4..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm11, %%zmm17, %%zmm10")         // zmm10 = b[c4..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm13, %%zmm16, %%zmm24")         // zmm24 = t[c8..c11]
+                __ASM_EMIT("vpermt2ps       %%zmm13, %%zmm17, %%zmm12")         // zmm12 = b[c8..c11]
+                __ASM_EMIT("vpermt2ps       %%zmm15, %%zmm16, %%zmm25")         // zmm25 = t[c12..c15]
+                __ASM_EMIT("vpermt2ps       %%zmm15, %%zmm17, %%zmm14")         // zmm14 = b[c12..c15]
+
+                // Transpose, step 2: group coefficients of each eight cascades
+                __ASM_EMIT("vmovaps         %%zmm22, %%zmm9")
+                __ASM_EMIT("vmovaps         %%zmm24, %%zmm11")
+                __ASM_EMIT("vmovaps         %%zmm8, %%zmm13")
+                __ASM_EMIT("vmovaps         %%zmm12, %%zmm15")
+                __ASM_EMIT("vpermt2ps       %%zmm23, %%zmm18, %%zmm9")          // zmm9  = t0[c0..c7] t1[c0..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm23, %%zmm19, %%zmm22")         // zmm22 = t2[c0..c7] t3[c0..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm25, %%zmm18, %%zmm11")         // zmm11 = t0[c8..c15] t1[c8..c15]
+                __ASM_EMIT("vpermt2ps       %%zmm25, %%zmm19, %%zmm24")         // zmm24 = t2[c8..c15] t3[c8..c15]
+                __ASM_EMIT("vpermt2ps       %%zmm10, %%zmm18, %%zmm13")         // zmm13 = b0[c0..c7] b1[c0..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm10, %%zmm19, %%zmm8")          // zmm8  = b2[c0..c7] b3[c0..c7]
+                __ASM_EMIT("vpermt2ps       %%zmm14, %%zmm18, %%zmm15")         // zmm15 = b0[c8..c15] b1[c8..c15]
+                __ASM_EMIT("vpermt2ps       %%zmm14, %%zmm19, %%zmm12")         // zmm12 = b2[c8..c15] b3[c8..c15]
+
+                // Transpose, step 3: join coefficients of all sixteen cascades
+                __ASM_EMIT("vmovaps         %%zmm9, %%zmm3")
+                __ASM_EMIT("vmovaps         %%zmm13, %%zmm5")
+                __ASM_EMIT("vpermt2ps       %%zmm11, %%zmm20, %%zmm3")          // zmm3  = t0
+                __ASM_EMIT("vpermt2ps       %%zmm11, %%zmm21, %%zmm9")          // zmm9  = t1
+                __ASM_EMIT("vpermt2ps       %%zmm24, %%zmm20, %%zmm22")         // zmm22 = t2
+                __ASM_EMIT("vpermt2ps       %%zmm15, %%zmm20, %%zmm5")          // zmm5  = b0
+                __ASM_EMIT("vpermt2ps       %%zmm15, %%zmm21, %%zmm13")         // zmm13 = b1
+                __ASM_EMIT("vpermt2ps       %%zmm12, %%zmm20, %%zmm8")          // zmm8  = b2
+
+                // Now we are ready to perform calculations of top and bottom part
+                // zmm3 = T0
+                // zmm5 = B0
+                __ASM_EMIT("vmulps          %%zmm0, %%zmm9, %%zmm4")            // zmm4  = T1 = t1 * kf
+                __ASM_EMIT("vmulps          %%zmm1, %%zmm22, %%zmm6")           // zmm6  = T2 = t2 * kf2
+                __ASM_EMIT("vmulps          %%zmm0, %%zmm13, %%zmm7")           // zmm7  = B1 = b1 * kf
+                __ASM_EMIT("vmulps          %%zmm1, %%zmm8, %%zmm8")            // zmm8  = B2 = b2 * kf2
+
+                __ASM_EMIT("vaddps          %%zmm6, %%zmm3, %%zmm10")           // zmm10 = T0 + T2
+                __ASM_EMIT("vsubps          %%zmm5, %%zmm8, %%zmm11")           // zmm11 = B2 - B0
+                __ASM_EMIT("vsubps          %%zmm6, %%zmm3, %%zmm3")            // zmm3  = T0 - T2
+                __ASM_EMIT("vaddps          %%zmm5, %%zmm8, %%zmm5")            // zmm5  = B2 + B0
+                __ASM_EMIT("vaddps          %%zmm4, %%zmm10, %%zmm12")          // zmm12 = T0 + T1 + T2
+                __ASM_EMIT("vaddps          %%zmm11, %%zmm11, %%zmm11")         // zmm11 = 2 * (B2 - B0)
+                __ASM_EMIT("vaddps          %%zmm3, %%zmm3, %%zmm3")            // zmm3  = 2 * (T0 - T2)
+                __ASM_EMIT("vaddps          %%zmm5, %%zmm7, %%zmm9")            // zmm9  = B0 + B1 + B2
+                __ASM_EMIT("vsubps          %%zmm4, %%zmm10, %%zmm4")           // zmm4  = T0 - T1 + T2
+                __ASM_EMIT("vdivps          %%zmm9, %%zmm2, %%zmm9")            // zmm9  = N = 1 / (B0 + B1 + B2)
+                __ASM_EMIT("vsubps          %%zmm5, %%zmm7, %%zmm5")            // zmm5  = B1 - B2 - B0
+
+                __ASM_EMIT("vmulps          %%zmm9, %%zmm12, %%zmm12")          // zmm12 = (T0 + T1 + T2) * N
+                __ASM_EMIT("vmulps          %%zmm9, %%zmm3, %%zmm3")            // zmm3  = 2 * (T0 - T2) * N
+                __ASM_EMIT("vmulps          %%zmm9, %%zmm4, %%zmm4")            // zmm4  = (T0 - T1 + T2) * N
+                __ASM_EMIT("vmulps          %%zmm9, %%zmm11, %%zmm11")          // zmm11 = 2 * (B2 - B0) * N
+                __ASM_EMIT("vmulps          %%zmm9, %%zmm5, %%zmm5")            // zmm5  = (B1 - B2 - B0) * N
+
+                // Store values
+                __ASM_EMIT("vmovups         %%zmm12, 0x000(%[bf])")
+                __ASM_EMIT("vmovups         %%zmm3,  0x040(%[bf])")
+                __ASM_EMIT("vmovups         %%zmm4,  0x080(%[bf])")
+                __ASM_EMIT("vmovups         %%zmm11, 0x0c0(%[bf])")
+                __ASM_EMIT("vmovups         %%zmm5,  0x100(%[bf])")
+
+                // Repeat cycle
+                __ASM_EMIT("add             $0x200, %[bc]")
+                __ASM_EMIT("add             $0x140, %[bf]")
+                __ASM_EMIT("dec             %[count]")
+                __ASM_EMIT("jnz             1b")
+
+                __ASM_EMIT("100:")
+                : [count] "+r" (count), [bc] "+r" (bc), [bf] "+r" (bf)
+                : [ONE] "m" (bilinear_transform_x16_one),
+                  [kf] "m" (kf),
+                  [IDX] "r" (bilinear_transform_x16_idx)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8", "%xmm9", "%xmm10", "%xmm11",
+                  "%xmm12", "%xmm13", "%xmm14", "%xmm15",
+                  "%xmm16", "%xmm17", "%xmm18", "%xmm19",
+                  "%xmm20", "%xmm21", "%xmm22", "%xmm23",
+                  "%xmm24", "%xmm25"
+            );
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_FILTERS_TRANSFORM_H_ */
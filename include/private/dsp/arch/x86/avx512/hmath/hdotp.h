@@ -317,6 +317,83 @@ namespace lsp
 
             return result;
         }
+
+        double h_dotp_f64(const double *a, const double *b, size_t count)
+        {
+            IF_ARCH_X86(
+                double result;
+                size_t off;
+            );
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vxorpd          %%zmm0, %%zmm0, %%zmm0")
+                __ASM_EMIT("xor             %[off], %[off]")
+                __ASM_EMIT("vxorpd          %%zmm1, %%zmm1, %%zmm1")
+                /* x32 blocks */
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%zmm2")
+                __ASM_EMIT("vmovupd         0x40(%[a], %[off]), %%zmm3")
+                __ASM_EMIT("vmovupd         0x80(%[a], %[off]), %%zmm4")
+                __ASM_EMIT("vmovupd         0xc0(%[a], %[off]), %%zmm5")
+                __ASM_EMIT("vfmadd231pd     0x00(%[b], %[off]), %%zmm2, %%zmm0")
+                __ASM_EMIT("vfmadd231pd     0x40(%[b], %[off]), %%zmm3, %%zmm1")
+                __ASM_EMIT("vfmadd231pd     0x80(%[b], %[off]), %%zmm4, %%zmm0")
+                __ASM_EMIT("vfmadd231pd     0xc0(%[b], %[off]), %%zmm5, %%zmm1")
+                __ASM_EMIT("add             $0x100, %[off]")
+                __ASM_EMIT("sub             $32, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                /* x8 blocks */
+                __ASM_EMIT("add             $24, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%zmm2")
+                __ASM_EMIT("vfmadd231pd     0x00(%[b], %[off]), %%zmm2, %%zmm0")
+                __ASM_EMIT("add             $0x40, %[off]")
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                __ASM_EMIT("vaddpd          %%zmm1, %%zmm0, %%zmm0")
+                __ASM_EMIT("vextractf64x4   $1, %%zmm0, %%ymm1")
+                __ASM_EMIT("vaddpd          %%ymm1, %%ymm0, %%ymm0")
+                /* x4 block */
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%ymm2")
+                __ASM_EMIT("vfmadd231pd     0x00(%[b], %[off]), %%ymm2, %%ymm0")
+                __ASM_EMIT("add             $0x20, %[off]")
+                __ASM_EMIT("sub             $4, %[count]")
+                __ASM_EMIT("6:")
+                __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm1")
+                __ASM_EMIT("vaddpd          %%xmm1, %%xmm0, %%xmm0")
+                /* x2 block */
+                __ASM_EMIT("add             $2, %[count]")
+                __ASM_EMIT("jl              8f")
+                __ASM_EMIT("vmovupd         0x00(%[a], %[off]), %%xmm2")
+                __ASM_EMIT("vfmadd231pd     0x00(%[b], %[off]), %%xmm2, %%xmm0")
+                __ASM_EMIT("add             $0x10, %[off]")
+                __ASM_EMIT("sub             $2, %[count]")
+                __ASM_EMIT("8:")
+                /* x1 block */
+                __ASM_EMIT("vhaddpd         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $1, %[count]")
+                __ASM_EMIT("jl              10f")
+                __ASM_EMIT("vmovsd          0x00(%[a], %[off]), %%xmm2")
+                __ASM_EMIT("vfmadd231sd     0x00(%[b], %[off]), %%xmm2, %%xmm0")
+                __ASM_EMIT("10:")
+                /* end */
+                : [count] "+r" (count), [off] "=&r" (off),
+                  [res] "=Yz" (result)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+
+            return result;
+        }
     } /* namespace avx512 */
 } /* namespace lsp */
 
@@ -318,6 +318,82 @@ namespace lsp
             return result;
         }
 
+        double h_sum_f64(const double *src, size_t count)
+        {
+            IF_ARCH_X86(double result);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("vxorpd          %%zmm0, %%zmm0, %%zmm0")
+                __ASM_EMIT("vxorpd          %%zmm1, %%zmm1, %%zmm1")
+                /* x64 blocks */
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jb              2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vaddpd          0x000(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("vaddpd          0x040(%[src]), %%zmm1, %%zmm1")
+                __ASM_EMIT("vaddpd          0x080(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("vaddpd          0x0c0(%[src]), %%zmm1, %%zmm1")
+                __ASM_EMIT("vaddpd          0x100(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("vaddpd          0x140(%[src]), %%zmm1, %%zmm1")
+                __ASM_EMIT("vaddpd          0x180(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("vaddpd          0x1c0(%[src]), %%zmm1, %%zmm1")
+                __ASM_EMIT("add             $0x200, %[src]")
+                __ASM_EMIT("sub             $64, %[count]")
+                __ASM_EMIT("jae             1b")
+                __ASM_EMIT("2:")
+                /* x16 blocks */
+                __ASM_EMIT("add             $48, %[count]")
+                __ASM_EMIT("jl              4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vaddpd          0x000(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("vaddpd          0x040(%[src]), %%zmm1, %%zmm1")
+                __ASM_EMIT("add             $0x80, %[src]")
+                __ASM_EMIT("sub             $16, %[count]")
+                __ASM_EMIT("jge             3b")
+                __ASM_EMIT("4:")
+                __ASM_EMIT("vaddpd          %%zmm1, %%zmm0, %%zmm0")
+                /* x8 block */
+                __ASM_EMIT("add             $8, %[count]")
+                __ASM_EMIT("jl              6f")
+                __ASM_EMIT("vaddpd          0x000(%[src]), %%zmm0, %%zmm0")
+                __ASM_EMIT("add             $0x40, %[src]")
+                __ASM_EMIT("sub             $8, %[count]")
+                __ASM_EMIT("6:")
+                __ASM_EMIT("vextractf64x4   $1, %%zmm0, %%ymm2")
+                __ASM_EMIT("vaddpd          %%ymm2, %%ymm0, %%ymm0")
+                /* x4 block */
+                __ASM_EMIT("add             $4, %[count]")
+                __ASM_EMIT("jl              8f")
+                __ASM_EMIT("vaddpd          0x000(%[src]), %%ymm0, %%ymm0")
+                __ASM_EMIT("add             $0x20, %[src]")
+                __ASM_EMIT("sub             $4, %[count]")
+                __ASM_EMIT("8:")
+                __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm2")
+                __ASM_EMIT("vaddpd          %%xmm2, %%xmm0, %%xmm0")
+                /* x2 block */
+                __ASM_EMIT("add             $2, %[count]")
+                __ASM_EMIT("jl              10f")
+                __ASM_EMIT("vaddpd          0x00(%[src]), %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $0x10, %[src]")
+                __ASM_EMIT("sub             $2, %[count]")
+                __ASM_EMIT("10:")
+                /* x1 block */
+                __ASM_EMIT("vhaddpd         %%xmm0, %%xmm0, %%xmm0")
+                __ASM_EMIT("add             $1, %[count]")
+                __ASM_EMIT("jl              12f")
+                __ASM_EMIT("vaddsd          0x00(%[src]), %%xmm0, %%xmm0")
+                __ASM_EMIT("12:")
+                /* end */
+                : [src] "+r" (src), [count] "+r" (count),
+                  [res] "=Yz" (result)
+                :
+                : "cc", "memory",
+                  "%xmm1", "%xmm2"
+            );
+
+            return result;
+        }
+
     } /* namespace avx512 */
 } /* namespace lsp */
 
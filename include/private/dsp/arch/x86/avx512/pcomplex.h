@@ -1228,6 +1228,72 @@ namespace lsp
             );
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86(size_t off);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor                     %[off], %[off]")
+                /* x32 blocks */
+                __ASM_EMIT("sub                     $32, %[count]")
+                __ASM_EMIT("jb                      2f")
+                __ASM_EMIT("kmovw                   %[CC], %%k4")                               /* k4 = 0x5555 */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("vmovups                 0x00(%[src], %[off]), %%zmm0")              /* zmm0 = s0 s1 ... s15 */
+                __ASM_EMIT("vmovups                 0x40(%[src], %[off]), %%zmm2")
+                __ASM_EMIT("vmulps                  0x00(%[w], %[off]), %%zmm0, %%zmm0")        /* zmm0 = r0 r1 ... r15 */
+                __ASM_EMIT("vmulps                  0x40(%[w], %[off]), %%zmm2, %%zmm2")
+                __ASM_EMIT("vextractf64x4           $1, %%zmm0, %%ymm1")                        /* ymm1 = r8 r9 ... r15 */
+                __ASM_EMIT("vextractf64x4           $1, %%zmm2, %%ymm3")
+                __ASM_EMIT("vexpandps               %%zmm0, %%zmm0 %{%%k4%}%{z%}")              /* zmm0 = r0 0 r1 0 ... r7 0 */
+                __ASM_EMIT("vexpandps               %%zmm1, %%zmm1 %{%%k4%}%{z%}")              /* zmm1 = r8 0 r9 0 ... r15 0 */
+                __ASM_EMIT("vexpandps               %%zmm2, %%zmm2 %{%%k4%}%{z%}")
+                __ASM_EMIT("vexpandps               %%zmm3, %%zmm3 %{%%k4%}%{z%}")
+                __ASM_EMIT("vmovups                 %%zmm0, 0x000(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%zmm1, 0x040(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%zmm2, 0x080(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%zmm3, 0x0c0(%[dst], %[off], 2)")
+                __ASM_EMIT("add                     $0x80, %[off]")
+                __ASM_EMIT("sub                     $32, %[count]")
+                __ASM_EMIT("jae                     1b")
+                __ASM_EMIT("2:")
+                /* x4 blocks */
+                __ASM_EMIT("vxorps                  %%xmm6, %%xmm6, %%xmm6")                    /* xmm6 = 0 */
+                __ASM_EMIT("add                     $28, %[count]")
+                __ASM_EMIT("jl                      4f")
+                __ASM_EMIT("3:")
+                __ASM_EMIT("vmovups                 0x00(%[src], %[off]), %%xmm0")              /* xmm0 = s0 s1 s2 s3 */
+                __ASM_EMIT("vmulps                  0x00(%[w], %[off]), %%xmm0, %%xmm0")        /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("vunpckhps               %%xmm6, %%xmm0, %%xmm1")                    /* xmm1 = r2 0 r3 0 */
+                __ASM_EMIT("vunpcklps               %%xmm6, %%xmm0, %%xmm0")                    /* xmm0 = r0 0 r1 0 */
+                __ASM_EMIT("vmovups                 %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("vmovups                 %%xmm1, 0x10(%[dst], %[off], 2)")
+                __ASM_EMIT("add                     $0x10, %[off]")
+                __ASM_EMIT("sub                     $4, %[count]")
+                __ASM_EMIT("jge                     3b")
+                __ASM_EMIT("4:")
+                /* x1 blocks */
+                __ASM_EMIT("add                     $3, %[count]")
+                __ASM_EMIT("jl                      6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("vmovss                  0x00(%[src], %[off]), %%xmm0")              /* xmm0 = s0 */
+                __ASM_EMIT("vmulss                  0x00(%[w], %[off]), %%xmm0, %%xmm0")        /* xmm0 = r0 */
+                __ASM_EMIT("vmovlps                 %%xmm0, 0x00(%[dst], %[off], 2)")
+                __ASM_EMIT("add                     $0x04, %[off]")
+                __ASM_EMIT("dec                     %[count]")
+                __ASM_EMIT("jge                     5b")
+                __ASM_EMIT("6:")
+
+                : [count] "+r" (count), [off] "=&r" (off)
+                : [dst] "r" (dst), [src] "r" (src), [w] "r" (w),
+                  [CC] "o" (pcomplex_r2c_expand)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6",
+                  "%k4"
+            );
+        }
+
         void pcomplex_c2r(float *dst, const float *src, size_t count)
         {
             IF_ARCH_X86(size_t off);
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_
+#define PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_IMPL */
+
+namespace lsp
+{
+    namespace avx512
+    {
+        void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count)
+        {
+            size_t stride   = factor * sizeof(float);
+            const float *s, *s3, *kp;
+            size_t n;
+
+            // Compute 4 output samples at once, each output sample reads its own row of input
+            for ( ; count >= 4; count -= 4)
+            {
+                s               = src;
+                kp              = k;
+                n               = taps;
+
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("lea             (%[s], %[stride], 2), %[s3]")
+                    __ASM_EMIT("vxorps          %%zmm0, %%zmm0, %%zmm0")
+                    __ASM_EMIT("vxorps          %%zmm1, %%zmm1, %%zmm1")
+                    __ASM_EMIT("add             %[stride], %[s3]")                          /* s3 = s + 3*stride */
+                    __ASM_EMIT("vxorps          %%zmm2, %%zmm2, %%zmm2")
+                    __ASM_EMIT("vxorps          %%zmm3, %%zmm3, %%zmm3")
+                    /* 16x blocks */
+                    __ASM_EMIT("sub             $16, %[n]")
+                    __ASM_EMIT("jb              2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("vmovups         0x00(%[k]), %%zmm4")                        /* zmm4 = k */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s]), %%zmm4, %%zmm0")                /* zmm0 += k*a */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 1), %%zmm4, %%zmm1")  /* zmm1 += k*b */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 2), %%zmm4, %%zmm2")  /* zmm2 += k*c */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s3]), %%zmm4, %%zmm3")               /* zmm3 += k*d */
+                    __ASM_EMIT("add             $0x40, %[k]")
+                    __ASM_EMIT("add             $0x40, %[s]")
+                    __ASM_EMIT("add             $0x40, %[s3]")
+                    __ASM_EMIT("sub             $16, %[n]")
+                    __ASM_EMIT("jae             1b")
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("vextractf64x4   $1, %%zmm0, %%ymm4")
+                    __ASM_EMIT("vextractf64x4   $1, %%zmm1, %%ymm5")
+                    __ASM_EMIT("vextractf64x4   $1, %%zmm2, %%ymm6")
+                    __ASM_EMIT("vextractf64x4   $1, %%zmm3, %%ymm7")
+                    __ASM_EMIT("vaddps          %%ymm4, %%ymm0, %%ymm0")
+                    __ASM_EMIT("vaddps          %%ymm5, %%ymm1, %%ymm1")
+                    __ASM_EMIT("vaddps          %%ymm6, %%ymm2, %%ymm2")
+                    __ASM_EMIT("vaddps          %%ymm7, %%ymm3, %%ymm3")
+                    /* 8x block */
+                    __ASM_EMIT("add             $8, %[n]")
+                    __ASM_EMIT("jl              4f")
+                    __ASM_EMIT("vmovups         0x00(%[k]), %%ymm4")                        /* ymm4 = k */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s]), %%ymm4, %%ymm0")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 1), %%ymm4, %%ymm1")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 2), %%ymm4, %%ymm2")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s3]), %%ymm4, %%ymm3")
+                    __ASM_EMIT("add             $0x20, %[k]")
+                    __ASM_EMIT("add             $0x20, %[s]")
+                    __ASM_EMIT("add             $0x20, %[s3]")
+                    __ASM_EMIT("sub             $8, %[n]")
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("vextractf128    $1, %%ymm0, %%xmm4")
+                    __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm5")
+                    __ASM_EMIT("vextractf128    $1, %%ymm2, %%xmm6")
+                    __ASM_EMIT("vextractf128    $1, %%ymm3, %%xmm7")
+                    __ASM_EMIT("vaddps          %%xmm4, %%xmm0, %%xmm0")
+                    __ASM_EMIT("vaddps          %%xmm5, %%xmm1, %%xmm1")
+                    __ASM_EMIT("vaddps          %%xmm6, %%xmm2, %%xmm2")
+                    __ASM_EMIT("vaddps          %%xmm7, %%xmm3, %%xmm3")
+                    /* 4x block */
+                    __ASM_EMIT("add             $4, %[n]")
+                    __ASM_EMIT("jl              6f")
+                    __ASM_EMIT("vmovups         0x00(%[k]), %%xmm4")                        /* xmm4 = k */
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s]), %%xmm4, %%xmm0")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 1), %%xmm4, %%xmm1")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s], %[stride], 2), %%xmm4, %%xmm2")
+                    __ASM_EMIT("vfmadd231ps     0x00(%[s3]), %%xmm4, %%xmm3")
+                    __ASM_EMIT("add             $0x10, %[k]")
+                    __ASM_EMIT("add             $0x10, %[s]")
+                    __ASM_EMIT("add             $0x10, %[s3]")
+                    __ASM_EMIT("sub             $4, %[n]")
+                    /* 1x blocks */
+                    __ASM_EMIT("6:")
+                    __ASM_EMIT("add             $3, %[n]")
+                    __ASM_EMIT("jl              8f")
+                    __ASM_EMIT("7:")
+                    __ASM_EMIT("vmovss          0x00(%[k]), %%xmm4")                        /* xmm4 = k */
+                    __ASM_EMIT("vfmadd231ss     0x00(%[s]), %%xmm4, %%xmm0")
+                    __ASM_EMIT("vfmadd231ss     0x00(%[s], %[stride], 1), %%xmm4, %%xmm1")
+                    __ASM_EMIT("vfmadd231ss     0x00(%[s], %[stride], 2), %%xmm4, %%xmm2")
+                    __ASM_EMIT("vfmadd231ss     0x00(%[s3]), %%xmm4, %%xmm3")
+                    __ASM_EMIT("add             $0x04, %[k]")
+                    __ASM_EMIT("add             $0x04, %[s]")
+                    __ASM_EMIT("add             $0x04, %[s3]")
+                    __ASM_EMIT("dec             %[n]")
+                    __ASM_EMIT("jge             7b")
+                    /* Transpose and sum */
+                    __ASM_EMIT("8:")
+                    __ASM_EMIT("vunpcklps       %%xmm1, %%xmm0, %%xmm4")                    /* xmm4 = a0 b0 a1 b1 */
+                    __ASM_EMIT("vunpckhps       %%xmm1, %%xmm0, %%xmm5")                    /* xmm5 = a2 b2 a3 b3 */
+                    __ASM_EMIT("vunpcklps       %%xmm3, %%xmm2, %%xmm6")                    /* xmm6 = c0 d0 c1 d1 */
+                    __ASM_EMIT("vunpckhps       %%xmm3, %%xmm2, %%xmm7")                    /* xmm7 = c2 d2 c3 d3 */
+                    __ASM_EMIT("vaddps          %%xmm5, %%xmm4, %%xmm4")                    /* xmm4 = a02 b02 a13 b13 */
+                    __ASM_EMIT("vaddps          %%xmm7, %%xmm6, %%xmm6")                    /* xmm6 = c02 d02 c13 d13 */
+                    __ASM_EMIT("vmovlhps        %%xmm6, %%xmm4, %%xmm0")                    /* xmm0 = a02 b02 c02 d02 */
+                    __ASM_EMIT("vmovhlps        %%xmm4, %%xmm6, %%xmm1")                    /* xmm1 = a13 b13 c13 d13 */
+                    __ASM_EMIT("vaddps          %%xmm1, %%xmm0, %%xmm0")                    /* xmm0 = a b c d */
+                    __ASM_EMIT("mov             %[dst], %[s3]")
+                    __ASM_EMIT("vmovups         %%xmm0, 0x00(%[s3])")
+
+                    : [s] "+r" (s), [s3] "=&r" (s3), [k] "+r" (kp), [n] "+r" (n)
+                    : [stride] "r" (stride), [dst] "m" (dst)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // Tail
+            for ( ; count > 0; --count, ++dst, src += factor)
+                *dst            = h_dotp(k, src, taps);
+        }
+    } /* namespace avx512 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_AVX512_RESAMPLING_H_ */
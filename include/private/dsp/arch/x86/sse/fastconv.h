@@ -56,6 +56,71 @@ namespace lsp
             // Do reverse FFT
             fastconv_restore_internal(dst, tmp, rank);
         }
+
+        void fastconv_fmadd(float *dst, const float *c1, const float *c2, size_t rank)
+        {
+            size_t items    = size_t(1) << (rank + 1);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+
+                // Load data
+                __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")       /* xmm0 = r0 r1 r2 r3 */
+                __ASM_EMIT("movups      0x10(%[c1]), %%xmm2")       /* xmm2 = i0 i1 i2 i3 */
+                __ASM_EMIT("movups      0x20(%[c1]), %%xmm4")       /* xmm4 = r4 r5 r6 r7 */
+                __ASM_EMIT("movups      0x30(%[c1]), %%xmm6")       /* xmm6 = i4 i5 i6 i7 */
+
+                // Do complex multiplication
+                __ASM_EMIT("movups      0x00(%[c2]), %%xmm1")       /* xmm1 = rc0 rc1 rc2 rc3 */
+                __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")       /* xmm3 = ic0 ic1 ic2 ic3 */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")            /* xmm5 = rc0 rc1 rc2 rc3 */
+                __ASM_EMIT("movaps      %%xmm3, %%xmm7")            /* xmm7 = ic0 ic1 ic2 ic3 */
+                __ASM_EMIT("mulps       %%xmm0, %%xmm1")            /* xmm1 = rc0*r0 rc1*r1 rc2*r2 rc3*r3 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm7")            /* xmm7 = ic0*i0 ic1*i1 ic2*i2 ic3*i3 */
+                __ASM_EMIT("mulps       %%xmm0, %%xmm3")            /* xmm3 = ic0*r0 ic1*r1 ic2*r2 ic3*r3 */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm5")            /* xmm5 = rc0*i0 rc1*i1 rc2*i2 rc3*i3 */
+                __ASM_EMIT("subps       %%xmm7, %%xmm1")            /* xmm1 = rc0*r0-ic0*i0 rc1*r1-ic1*i1 rc2*r2-ic2*i2 rc3*r3-ic3*i3 */
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")            /* xmm3 = ic0*r0+rc0*i0 ic1*r1+rc1*i1 ic2*r2+rc2*i2 ic3*r3+rc3*i3 */
+
+                __ASM_EMIT("movups      0x20(%[c2]), %%xmm0")       /* xmm0 = rc4 rc5 rc6 rc7 */
+                __ASM_EMIT("movups      0x30(%[c2]), %%xmm2")       /* xmm2 = ic4 ic5 ic6 ic7 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm5")            /* xmm5 = rc4 rc5 rc6 rc7 */
+                __ASM_EMIT("movaps      %%xmm2, %%xmm7")            /* xmm7 = ic4 ic5 ic6 ic7 */
+                __ASM_EMIT("mulps       %%xmm4, %%xmm5")            /* xmm5 = rc4*r4 rc5*r5 rc6*r6 rc7*r7 */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")            /* xmm2 = ic4*i4 ic5*i5 ic6*i6 ic7*i7 */
+                __ASM_EMIT("mulps       %%xmm4, %%xmm7")            /* xmm7 = ic4*r4 ic5*r5 ic6*r6 ic7*r7 */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm0")            /* xmm0 = rc4*i4 rc5*i5 rc6*i6 rc7*i7 */
+                __ASM_EMIT("subps       %%xmm2, %%xmm5")            /* xmm5 = rc4*r4-ic4*i4 rc5*r5-ic5*i5 rc6*r6-ic6*i6 rc7*r7-ic7*i7 */
+                __ASM_EMIT("addps       %%xmm0, %%xmm7")            /* xmm7 = ic4*r4+rc4*i4 ic5*r5+rc5*i5 ic6*r6+rc6*i6 ic7*r7+rc7*i7 */
+
+                // Accumulate result
+                __ASM_EMIT("movups      0x00(%[dst]), %%xmm0")
+                __ASM_EMIT("movups      0x10(%[dst]), %%xmm2")
+                __ASM_EMIT("movups      0x20(%[dst]), %%xmm4")
+                __ASM_EMIT("movups      0x30(%[dst]), %%xmm6")
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")
+                __ASM_EMIT("addps       %%xmm5, %%xmm4")
+                __ASM_EMIT("addps       %%xmm7, %%xmm6")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm2, 0x10(%[dst])")
+                __ASM_EMIT("movups      %%xmm4, 0x20(%[dst])")
+                __ASM_EMIT("movups      %%xmm6, 0x30(%[dst])")
+
+                __ASM_EMIT("add         $0x40, %[dst]")
+                __ASM_EMIT("add         $0x40, %[c1]")
+                __ASM_EMIT("add         $0x40, %[c2]")
+                __ASM_EMIT("sub         $16, %[k]")
+                __ASM_EMIT("jnz         1b")
+
+                : [dst] "+r" (dst), [k] "+r" (items), [c1] "+r" (c1), [c2] "+r" (c2)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
     }
 }
 
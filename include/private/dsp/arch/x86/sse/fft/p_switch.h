@@ -40,8 +40,10 @@ namespace lsp
             {
                 if (rank <= 8)
                     SSE_CALL_NAME(FFT_SCRAMBLE_SELF_DIRECT_NAME, 8);
-                else //if (rank <= 16)
+                else if (rank <= 16)
                     SSE_CALL_NAME(FFT_SCRAMBLE_SELF_DIRECT_NAME, 16);
+                else
+                    SSE_CALL_NAME(FFT_SCRAMBLE_SELF_DIRECT_NAME, 32);
             }
             else
             {
@@ -49,8 +51,10 @@ namespace lsp
 
                 if (rank <= 8)
                     SSE_CALL_NAME(FFT_SCRAMBLE_COPY_DIRECT_NAME, 8);
-                else //if (rank <= 16)
+                else if (rank <= 16)
                     SSE_CALL_NAME(FFT_SCRAMBLE_COPY_DIRECT_NAME, 16);
+                else
+                    SSE_CALL_NAME(FFT_SCRAMBLE_COPY_DIRECT_NAME, 32);
             }
         }
 
@@ -61,8 +65,10 @@ namespace lsp
             {
                 if (rank <= 8)
                     SSE_CALL_NAME(FFT_SCRAMBLE_SELF_REVERSE_NAME, 8);
-                else //if (rank <= 16)
+                else if (rank <= 16)
                     SSE_CALL_NAME(FFT_SCRAMBLE_SELF_REVERSE_NAME, 16);
+                else
+                    SSE_CALL_NAME(FFT_SCRAMBLE_SELF_REVERSE_NAME, 32);
             }
             else
             {
@@ -70,8 +76,10 @@ namespace lsp
 
                 if (rank <= 8)
                     SSE_CALL_NAME(FFT_SCRAMBLE_COPY_REVERSE_NAME, 8);
-                else //if (rank <= 16)
+                else if (rank <= 16)
                     SSE_CALL_NAME(FFT_SCRAMBLE_COPY_REVERSE_NAME, 16);
+                else
+                    SSE_CALL_NAME(FFT_SCRAMBLE_COPY_REVERSE_NAME, 32);
             }
         }
 
@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FFTBATCH_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FFTBATCH_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+#include <private/dsp/fft.h>
+
+namespace lsp
+{
+    namespace sse
+    {
+        // Number of buffers processed at once: one buffer per lane of the XMM register
+        static constexpr size_t FFT_BATCH_LANES     = 4;
+        // Ranks of transforms computed for several buffers at once. The upper bound is taken from
+        // the dsp.fft.fftbatch ptest, 64 transforms per call, batch vs per-buffer plan FFT (it/s):
+        //   rank 8:    15413 vs 13419, 13434 vs 12471
+        //   rank 9:     6147 vs  5517, 10154 vs  9737
+        //   rank 10:    2565 vs  2452,  2368 vs  2865
+        // At rank 10 the four transposed buffers fill the whole L1 cache and the gain is within
+        // the noise of the measurement, sometimes turning into a loss
+        static constexpr size_t FFT_BATCH_RANK_MIN  = 3;
+        static constexpr size_t FFT_BATCH_RANK_MAX  = 9;
+        // Size of the scratch kept on the stack: the transposed buffers and the sink for results
+        // of unused lanes for the maximum batch rank, 20 KB
+        static constexpr size_t FFT_BATCH_SCRATCH_SIZE  = (FFT_BATCH_LANES * 2 + 2) << FFT_BATCH_RANK_MAX;
+
+        // Transpose of 4x4 matrix: xmm0..xmm3 = rows, result: xmm0, xmm2, xmm4, xmm5 = columns
+        #define FFT_BATCH_TRANSPOSE \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = a0 a1 a2 a3 */ \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")            /* xmm5 = c0 c1 c2 c3 */ \
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")            /* xmm0 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")            /* xmm4 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")            /* xmm2 = c0 d0 c1 d1 */ \
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")            /* xmm5 = c2 d2 c3 d3 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")            /* xmm1 = a0 b0 a1 b1 */ \
+            __ASM_EMIT("movaps      %%xmm4, %%xmm3")            /* xmm3 = a2 b2 a3 b3 */ \
+            __ASM_EMIT("movlhps     %%xmm2, %%xmm0")            /* xmm0 = a0 b0 c0 d0 */ \
+            __ASM_EMIT("movhlps     %%xmm1, %%xmm2")            /* xmm2 = a1 b1 c1 d1 */ \
+            __ASM_EMIT("movlhps     %%xmm5, %%xmm4")            /* xmm4 = a2 b2 c2 d2 */ \
+            __ASM_EMIT("movhlps     %%xmm3, %%xmm5")            /* xmm5 = a3 b3 c3 d3 */
+
+        /**
+         * Load two adjacent complex numbers j, j+1 of four buffers and store them in the
+         * lane-interleaved layout at dst and dst + half: the bit-reversed index of j+1 differs
+         * from the bit-reversed index of j by N/2 for even j.
+         */
+        static inline void plan_batch_gather_pair(float *dst, size_t half,
+            const float *s0, const float *s1, const float *s2, const float *s3)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movups      0x00(%[s0]), %%xmm0")       /* xmm0 = r0 i0 r1 i1 of buffer 0 */
+                __ASM_EMIT("movups      0x00(%[s1]), %%xmm1")       /* xmm1 = r0 i0 r1 i1 of buffer 1 */
+                __ASM_EMIT("movups      0x00(%[s2]), %%xmm2")       /* xmm2 = r0 i0 r1 i1 of buffer 2 */
+                __ASM_EMIT("movups      0x00(%[s3]), %%xmm3")       /* xmm3 = r0 i0 r1 i1 of buffer 3 */
+                FFT_BATCH_TRANSPOSE
+                __ASM_EMIT("movaps      %%xmm0, 0x00(%[d])")        /* re[j] */
+                __ASM_EMIT("movaps      %%xmm2, 0x10(%[d])")        /* im[j] */
+                __ASM_EMIT("add         %[half], %[d]")
+                __ASM_EMIT("movaps      %%xmm4, 0x00(%[d])")        /* re[j+1] */
+                __ASM_EMIT("movaps      %%xmm5, 0x10(%[d])")        /* im[j+1] */
+                : [d] "+r" (dst)
+                : [half] "m" (half),
+                  [s0] "r" (s0), [s1] "r" (s1), [s2] "r" (s2), [s3] "r" (s3)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5"
+            );
+        }
+
+        /**
+         * Load two adjacent complex numbers of the lane-interleaved layout, apply normalization
+         * and store them to four buffers
+         */
+        static inline void plan_batch_scatter_pair(const float *src, float norm,
+            float *d0, float *d1, float *d2, float *d3)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movss       %[norm], %%xmm6")
+                __ASM_EMIT("movaps      0x00(%[s]), %%xmm0")        /* xmm0 = re[j] */
+                __ASM_EMIT("movaps      0x10(%[s]), %%xmm1")        /* xmm1 = im[j] */
+                __ASM_EMIT("shufps      $0x00, %%xmm6, %%xmm6")     /* xmm6 = k */
+                __ASM_EMIT("movaps      0x20(%[s]), %%xmm2")        /* xmm2 = re[j+1] */
+                __ASM_EMIT("movaps      0x30(%[s]), %%xmm3")        /* xmm3 = im[j+1] */
+                __ASM_EMIT("mulps       %%xmm6, %%xmm0")
+                __ASM_EMIT("mulps       %%xmm6, %%xmm1")
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3")
+                FFT_BATCH_TRANSPOSE
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[d0])")
+                __ASM_EMIT("movups      %%xmm2, 0x00(%[d1])")
+                __ASM_EMIT("movups      %%xmm4, 0x00(%[d2])")
+                __ASM_EMIT("movups      %%xmm5, 0x00(%[d3])")
+                :
+                : [s] "r" (src), [norm] "m" (norm),
+                  [d0] "r" (d0), [d1] "r" (d1), [d2] "r" (d2), [d3] "r" (d3)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6"
+            );
+        }
+
+        #undef FFT_BATCH_TRANSPOSE
+
+        // First two butterfly stages, each complex number is stored as [re0 re1 re2 re3 im0 im1 im2 im3]
+        #define FFT_BATCH_START_BODY(add_b, sub_b) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT(".align 16") \
+                __ASM_EMIT("1:") \
+                /* Real parts */ \
+                __ASM_EMIT("movaps      0x00(%[a]), %%xmm0")        /* xmm0 = r0 */ \
+                __ASM_EMIT("movaps      0x20(%[a]), %%xmm1")        /* xmm1 = r1 */ \
+                __ASM_EMIT("movaps      0x40(%[a]), %%xmm2")        /* xmm2 = r2 */ \
+                __ASM_EMIT("movaps      0x60(%[a]), %%xmm3")        /* xmm3 = r3 */ \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+                __ASM_EMIT("movaps      %%xmm2, %%xmm5") \
+                __ASM_EMIT("addps       %%xmm1, %%xmm0")            /* xmm0 = r0 + r1 */ \
+                __ASM_EMIT("subps       %%xmm1, %%xmm4")            /* xmm4 = r0 - r1 */ \
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")            /* xmm2 = r2 + r3 */ \
+                __ASM_EMIT("subps       %%xmm3, %%xmm5")            /* xmm5 = r2 - r3 */ \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")            /* xmm0 = r0 + r1 + r2 + r3 */ \
+                __ASM_EMIT("subps       %%xmm2, %%xmm1")            /* xmm1 = r0 + r1 - r2 - r3 */ \
+                /* Imaginary parts */ \
+                __ASM_EMIT("movaps      0x10(%[a]), %%xmm2")        /* xmm2 = i0 */ \
+                __ASM_EMIT("movaps      0x30(%[a]), %%xmm3")        /* xmm3 = i1 */ \
+                __ASM_EMIT("movaps      0x50(%[a]), %%xmm6")        /* xmm6 = i2 */ \
+                __ASM_EMIT("movaps      0x70(%[a]), %%xmm7")        /* xmm7 = i3 */ \
+                __ASM_EMIT("movaps      %%xmm0, 0x00(%[a])") \
+                __ASM_EMIT("movaps      %%xmm1, 0x40(%[a])") \
+                __ASM_EMIT("movaps      %%xmm2, %%xmm0") \
+                __ASM_EMIT("movaps      %%xmm6, %%xmm1") \
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")            /* xmm2 = i0 + i1 */ \
+                __ASM_EMIT("subps       %%xmm3, %%xmm0")            /* xmm0 = i0 - i1 */ \
+                __ASM_EMIT("addps       %%xmm7, %%xmm6")            /* xmm6 = i2 + i3 */ \
+                __ASM_EMIT("subps       %%xmm7, %%xmm1")            /* xmm1 = i2 - i3 */ \
+                __ASM_EMIT("movaps      %%xmm2, %%xmm3") \
+                __ASM_EMIT("addps       %%xmm6, %%xmm2")            /* xmm2 = i0 + i1 + i2 + i3 */ \
+                __ASM_EMIT("subps       %%xmm6, %%xmm3")            /* xmm3 = i0 + i1 - i2 - i3 */ \
+                __ASM_EMIT("movaps      %%xmm2, 0x10(%[a])") \
+                __ASM_EMIT("movaps      %%xmm3, 0x50(%[a])") \
+                /* Odd outputs: xmm4 = t1_re, xmm0 = t1_im, xmm5 = t3_re, xmm1 = t3_im */ \
+                __ASM_EMIT("movaps      %%xmm4, %%xmm2") \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm3") \
+                __ASM_EMIT(add_b "      %%xmm1, %%xmm4")            /* xmm4 = t1_re +- t3_im */ \
+                __ASM_EMIT(sub_b "      %%xmm1, %%xmm2")            /* xmm2 = t1_re -+ t3_im */ \
+                __ASM_EMIT(sub_b "      %%xmm5, %%xmm0")            /* xmm0 = t1_im -+ t3_re */ \
+                __ASM_EMIT(add_b "      %%xmm5, %%xmm3")            /* xmm3 = t1_im +- t3_re */ \
+                __ASM_EMIT("movaps      %%xmm4, 0x20(%[a])") \
+                __ASM_EMIT("movaps      %%xmm0, 0x30(%[a])") \
+                __ASM_EMIT("movaps      %%xmm2, 0x60(%[a])") \
+                __ASM_EMIT("movaps      %%xmm3, 0x70(%[a])") \
+                __ASM_EMIT("add         $0x80, %[a]") \
+                __ASM_EMIT("dec         %[count]") \
+                __ASM_EMIT("jnz         1b") \
+                : [a] "+r" (dst), [count] "+r" (count) \
+                : \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        static inline void plan_batch_start_direct(float *dst, size_t count)
+        {
+            FFT_BATCH_START_BODY("addps", "subps");
+        }
+
+        static inline void plan_batch_start_reverse(float *dst, size_t count)
+        {
+            FFT_BATCH_START_BODY("subps", "addps");
+        }
+
+        #undef FFT_BATCH_START_BODY
+
+        // Butterflies of the block, each complex number is stored as [re0 re1 re2 re3 im0 im1 im2 im3],
+        // the b half is addressed as (a + 8*nb), the imaginary part of twiddle factors as (w + nb).
+        #define FFT_BATCH_BUTTERFLY_BODY(add_b, add_a) \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT(".align 16") \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("movss       0x00(%[w]), %%xmm6") \
+                __ASM_EMIT("movss       0x00(%[w], %[nb]), %%xmm7") \
+                __ASM_EMIT("movaps      0x00(%[a], %[nb], 8), %%xmm2") /* xmm2 = b_re[0..3] */ \
+                __ASM_EMIT("movaps      0x10(%[a], %[nb], 8), %%xmm3") /* xmm3 = b_im[0..3] */ \
+                __ASM_EMIT("shufps      $0x00, %%xmm6, %%xmm6")     /* xmm6 = w_re */ \
+                __ASM_EMIT("shufps      $0x00, %%xmm7, %%xmm7")     /* xmm7 = w_im */ \
+                __ASM_EMIT("movaps      %%xmm2, %%xmm4")            /* xmm4 = b_re */ \
+                __ASM_EMIT("movaps      %%xmm3, %%xmm5")            /* xmm5 = b_im */ \
+                __ASM_EMIT("mulps       %%xmm6, %%xmm2")            /* xmm2 = w_re * b_re */ \
+                __ASM_EMIT("mulps       %%xmm7, %%xmm4")            /* xmm4 = w_im * b_re */ \
+                __ASM_EMIT("mulps       %%xmm6, %%xmm3")            /* xmm3 = w_re * b_im */ \
+                __ASM_EMIT("mulps       %%xmm7, %%xmm5")            /* xmm5 = w_im * b_im */ \
+                __ASM_EMIT("movaps      0x00(%[a]), %%xmm0")        /* xmm0 = a_re[0..3] */ \
+                __ASM_EMIT("movaps      0x10(%[a]), %%xmm1")        /* xmm1 = a_im[0..3] */ \
+                __ASM_EMIT(add_a "      %%xmm4, %%xmm3")            /* xmm3 = c_im = w_re * b_im -+ w_im * b_re */ \
+                __ASM_EMIT(add_b "      %%xmm5, %%xmm2")            /* xmm2 = c_re = w_re * b_re +- w_im * b_im */ \
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = a_re */ \
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")            /* xmm5 = a_im */ \
+                __ASM_EMIT("subps       %%xmm2, %%xmm0")            /* xmm0 = a_re - c_re */ \
+                __ASM_EMIT("subps       %%xmm3, %%xmm1")            /* xmm1 = a_im - c_im */ \
+                __ASM_EMIT("addps       %%xmm4, %%xmm2")            /* xmm2 = a_re + c_re */ \
+                __ASM_EMIT("addps       %%xmm5, %%xmm3")            /* xmm3 = a_im + c_im */ \
+                __ASM_EMIT("movaps      %%xmm2, 0x00(%[a])") \
+                __ASM_EMIT("movaps      %%xmm3, 0x10(%[a])") \
+                __ASM_EMIT("movaps      %%xmm0, 0x00(%[a], %[nb], 8)") \
+                __ASM_EMIT("movaps      %%xmm1, 0x10(%[a], %[nb], 8)") \
+                __ASM_EMIT("add         $0x20, %[a]") \
+                __ASM_EMIT("add         $0x04, %[w]") \
+                __ASM_EMIT("dec         %[p]") \
+                __ASM_EMIT("jnz         1b") \
+                : [a] "+r" (a), [w] "+r" (w), [p] "+r" (p) \
+                : [nb] "r" (nb) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        static inline void plan_batch_butterfly_direct(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += n * FFT_BATCH_LANES * 4)
+            {
+                float *a        = dst;
+                const float *w  = tw;
+                size_t p        = n;
+                FFT_BATCH_BUTTERFLY_BODY("addps", "subps");
+            }
+        }
+
+        static inline void plan_batch_butterfly_reverse(float *dst, const float *tw, size_t n, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += n * FFT_BATCH_LANES * 4)
+            {
+                float *a        = dst;
+                const float *w  = tw;
+                size_t p        = n;
+                FFT_BATCH_BUTTERFLY_BODY("subps", "addps");
+            }
+        }
+
+        #undef FFT_BATCH_BUTTERFLY_BODY
+
+        typedef void (* plan_batch_start_t)(float *dst, size_t count);
+        typedef void (* plan_batch_butterfly_t)(float *dst, const float *tw, size_t n, size_t blocks);
+        typedef void (* plan_packed_fft_t)(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+        static void plan_batch_gather(const dsp::fft_plan_t *plan, float *dst, const float * const *src)
+        {
+            const uint32_t *rev = plan->rev;
+            size_t items        = size_t(1) << plan->rank;
+            size_t half         = items * FFT_BATCH_LANES * sizeof(float);
+
+            for (size_t j=0; j<items; j += 2)
+                plan_batch_gather_pair(&dst[rev[j] * FFT_BATCH_LANES * 2], half,
+                    &src[0][j*2], &src[1][j*2], &src[2][j*2], &src[3][j*2]);
+        }
+
+        static void plan_batch_scatter(float * const *dst, const float *src, size_t rank, float norm)
+        {
+            size_t items        = size_t(1) << rank;
+
+            for (size_t j=0; j<items; j += 2, src += FFT_BATCH_LANES * 4)
+                plan_batch_scatter_pair(src, norm,
+                    &dst[0][j*2], &dst[1][j*2], &dst[2][j*2], &dst[3][j*2]);
+        }
+
+        static void plan_packed_fft_batch(const dsp::fft_plan_t *plan, float *buf, float * const *dst, const float * const *src,
+            size_t count, plan_batch_start_t start, plan_batch_butterfly_t butterfly, float norm)
+        {
+            size_t items        = size_t(1) << plan->rank;
+            float *vdst[FFT_BATCH_LANES];
+            const float *vsrc[FFT_BATCH_LANES];
+            float *dummy        = &buf[(FFT_BATCH_LANES * 2) << plan->rank];
+
+            for (size_t i=0; i<count; i += FFT_BATCH_LANES)
+            {
+                // Unused lanes transform the first buffer once more and discard the result
+                size_t lanes        = lsp_min(count - i, FFT_BATCH_LANES);
+                for (size_t k=0; k<FFT_BATCH_LANES; ++k)
+                {
+                    vdst[k]             = (k < lanes) ? dst[i + k] : dummy;
+                    vsrc[k]             = (k < lanes) ? src[i + k] : src[i];
+                }
+
+                plan_batch_gather(plan, buf, vsrc);
+                start(buf, items >> 2);
+                for (size_t n=4; n < items; n <<= 1)
+                    butterfly(buf, dsp::fft_plan_twiddles(plan, n), n, items / (n << 1));
+                plan_batch_scatter(vdst, buf, plan->rank, norm);
+            }
+        }
+
+        static void plan_packed_fft_batch(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src,
+            size_t count, plan_packed_fft_t fft, plan_batch_start_t start, plan_batch_butterfly_t butterfly, float norm)
+        {
+            if ((plan->rank < FFT_BATCH_RANK_MIN) || (plan->rank > FFT_BATCH_RANK_MAX))
+            {
+                for (size_t i=0; i<count; ++i)
+                    fft(plan, dst[i], src[i]);
+                return;
+            }
+
+            float buf[FFT_BATCH_SCRATCH_SIZE] __lsp_aligned16;
+            plan_packed_fft_batch(plan, buf, dst, src, count, start, butterfly, norm);
+        }
+
+        static void plan_packed_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride,
+            size_t count, plan_packed_fft_t fft, plan_batch_start_t start, plan_batch_butterfly_t butterfly, float norm)
+        {
+            if ((plan->rank < FFT_BATCH_RANK_MIN) || (plan->rank > FFT_BATCH_RANK_MAX))
+            {
+                for (size_t i=0; i<count; ++i, dst += stride, src += stride)
+                    fft(plan, dst, src);
+                return;
+            }
+
+            float buf[FFT_BATCH_SCRATCH_SIZE] __lsp_aligned16;
+            float *vdst[FFT_BATCH_LANES];
+            const float *vsrc[FFT_BATCH_LANES];
+
+            for (size_t i=0; i<count; i += FFT_BATCH_LANES)
+            {
+                size_t lanes        = lsp_min(count - i, FFT_BATCH_LANES);
+                for (size_t k=0; k<lanes; ++k, dst += stride, src += stride)
+                {
+                    vdst[k]             = dst;
+                    vsrc[k]             = src;
+                }
+                plan_packed_fft_batch(plan, buf, vdst, vsrc, lanes, start, butterfly, norm);
+            }
+        }
+
+        void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch(plan, dst, src, stride, count,
+                plan_packed_direct_fft, plan_batch_start_direct, plan_batch_butterfly_direct, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count)
+        {
+            plan_packed_fft_batch(plan, dst, src, stride, count,
+                plan_packed_reverse_fft, plan_batch_start_reverse, plan_batch_butterfly_reverse, 1.0f / float(size_t(1) << plan->rank));
+        }
+
+        void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch(plan, dst, src, count,
+                plan_packed_direct_fft, plan_batch_start_direct, plan_batch_butterfly_direct, 1.0f);
+        }
+
+        void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count)
+        {
+            plan_packed_fft_batch(plan, dst, src, count,
+                plan_packed_reverse_fft, plan_batch_start_reverse, plan_batch_butterfly_reverse, 1.0f / float(size_t(1) << plan->rank));
+        }
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FFTBATCH_H_ */
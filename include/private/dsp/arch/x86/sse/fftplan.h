@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_FFTPLAN_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_FFTPLAN_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+#include <private/dsp/fft.h>
+
+namespace lsp
+{
+    namespace sse
+    {
+        // Complex multiplication c = w * b and butterfly a' = a + c, b' = a - c:
+        //   xmm0 = a_re, xmm1 = a_im, xmm2 = b_re, xmm3 = b_im, xmm6 = w_re, xmm7 = w_im
+        #define FFT_PLAN_BUTTERFLY(add_b, add_a) \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm4")    /* xmm4 = b_re[0..3] */ \
+            __ASM_EMIT("movaps      %%xmm3, %%xmm5")    /* xmm5 = b_im[0..3] */ \
+            __ASM_EMIT("mulps       %%xmm6, %%xmm2")    /* xmm2 = w_re[0..3] * b_re[0..3] */ \
+            __ASM_EMIT("mulps       %%xmm7, %%xmm4")    /* xmm4 = w_im[0..3] * b_re[0..3] */ \
+            __ASM_EMIT("mulps       %%xmm6, %%xmm3")    /* xmm3 = w_re[0..3] * b_im[0..3] */ \
+            __ASM_EMIT("mulps       %%xmm7, %%xmm5")    /* xmm5 = w_im[0..3] * b_im[0..3] */ \
+            __ASM_EMIT(add_a "      %%xmm4, %%xmm3")    /* xmm3 = c_im[0..3] = w_re[0..3] * b_im[0..3] -+ w_im[0..3] * b_re[0..3] */ \
+            __ASM_EMIT(add_b "      %%xmm5, %%xmm2")    /* xmm2 = c_re[0..3] = w_re[0..3] * b_re[0..3] +- w_im[0..3] * b_im[0..3] */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")    /* xmm4 = a_re[0..3] */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm5")    /* xmm5 = a_im[0..3] */ \
+            __ASM_EMIT("subps       %%xmm2, %%xmm0")    /* xmm0 = a_re[0..3] - c_re[0..3] */ \
+            __ASM_EMIT("subps       %%xmm3, %%xmm1")    /* xmm1 = a_im[0..3] - c_im[0..3] */ \
+            __ASM_EMIT("addps       %%xmm4, %%xmm2")    /* xmm2 = a_re[0..3] + c_re[0..3] */ \
+            __ASM_EMIT("addps       %%xmm5, %%xmm3")    /* xmm3 = a_im[0..3] + c_im[0..3] */
+
+        // Butterfly stage over [re0..re3, im0..im3] blocks, half of the butterfly contains n complex numbers,
+        // count complex numbers of the half are processed. The b half is addressed as (a + 2*nb), the
+        // imaginary part of twiddle factors as (w + nb).
+        #define FFT_PLAN_PACKED_BUTTERFLY_BODY(add_b, add_a) \
+            float *a        = dst; \
+            const float *w  = tw; \
+            size_t p        = count; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT(".align 16") \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")                /* xmm6 = w_re[0..3] */ \
+                __ASM_EMIT("movaps      0x00(%[w], %[nb]), %%xmm7")         /* xmm7 = w_im[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a]), %%xmm0")                /* xmm0 = a_re[0..3] */ \
+                __ASM_EMIT("movups      0x10(%[a]), %%xmm1")                /* xmm1 = a_im[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a], %[nb], 2), %%xmm2")      /* xmm2 = b_re[0..3] */ \
+                __ASM_EMIT("movups      0x10(%[a], %[nb], 2), %%xmm3")      /* xmm3 = b_im[0..3] */ \
+                FFT_PLAN_BUTTERFLY(add_b, add_a) \
+                __ASM_EMIT("movups      %%xmm2, 0x00(%[a])") \
+                __ASM_EMIT("movups      %%xmm3, 0x10(%[a])") \
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[a], %[nb], 2)") \
+                __ASM_EMIT("movups      %%xmm1, 0x10(%[a], %[nb], 2)") \
+                __ASM_EMIT("add         $0x20, %[a]") \
+                __ASM_EMIT("add         $0x10, %[w]") \
+                __ASM_EMIT("sub         $4, %[p]") \
+                __ASM_EMIT("jnz         1b") \
+                : [a] "+r" (a), [w] "+r" (w), [p] "+r" (p) \
+                : [nb] "r" (nb) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        // Butterfly stage over separate real and imaginary parts, half of the butterfly contains n complex numbers,
+        // count complex numbers of the half are processed. The b half is addressed as (a + nb), the imaginary
+        // part of twiddle factors as (w + nb).
+        #define FFT_PLAN_BUTTERFLY_BODY(add_b, add_a) \
+            float *a_re     = dst_re; \
+            float *a_im     = dst_im; \
+            const float *w  = tw; \
+            size_t p        = count; \
+            \
+            ARCH_X86_ASM \
+            ( \
+                __ASM_EMIT(".align 16") \
+                __ASM_EMIT("1:") \
+                __ASM_EMIT("movaps      0x00(%[w]), %%xmm6")                /* xmm6 = w_re[0..3] */ \
+                __ASM_EMIT("movaps      0x00(%[w], %[nb]), %%xmm7")         /* xmm7 = w_im[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a_re]), %%xmm0")             /* xmm0 = a_re[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a_im]), %%xmm1")             /* xmm1 = a_im[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a_re], %[nb]), %%xmm2")      /* xmm2 = b_re[0..3] */ \
+                __ASM_EMIT("movups      0x00(%[a_im], %[nb]), %%xmm3")      /* xmm3 = b_im[0..3] */ \
+                FFT_PLAN_BUTTERFLY(add_b, add_a) \
+                __ASM_EMIT("movups      %%xmm2, 0x00(%[a_re])") \
+                __ASM_EMIT("movups      %%xmm3, 0x00(%[a_im])") \
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[a_re], %[nb])") \
+                __ASM_EMIT("movups      %%xmm1, 0x00(%[a_im], %[nb])") \
+                __ASM_EMIT("add         $0x10, %[a_re]") \
+                __ASM_EMIT("add         $0x10, %[a_im]") \
+                __ASM_EMIT("add         $0x10, %[w]") \
+                __ASM_EMIT("sub         $4, %[p]") \
+                __ASM_EMIT("jnz         1b") \
+                : [a_re] "+r" (a_re), [a_im] "+r" (a_im), [w] "+r" (w), [p] "+r" (p) \
+                : [nb] "r" (nb) \
+                : "cc", "memory", \
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+            );
+
+        static inline void plan_packed_butterfly_direct(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_PACKED_BUTTERFLY_BODY("addps", "subps");
+            }
+        }
+
+        static inline void plan_packed_butterfly_reverse(float *dst, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst += (n << 2))
+            {
+                FFT_PLAN_PACKED_BUTTERFLY_BODY("subps", "addps");
+            }
+        }
+
+        static inline void plan_butterfly_direct(float *dst_re, float *dst_im, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst_re += (n << 1), dst_im += (n << 1))
+            {
+                FFT_PLAN_BUTTERFLY_BODY("addps", "subps");
+            }
+        }
+
+        static inline void plan_butterfly_reverse(float *dst_re, float *dst_im, const float *tw, size_t n, size_t count, size_t blocks)
+        {
+            size_t nb       = n * sizeof(float);
+            for (size_t blk=0; blk<blocks; ++blk, dst_re += (n << 1), dst_im += (n << 1))
+            {
+                FFT_PLAN_BUTTERFLY_BODY("subps", "addps");
+            }
+        }
+
+        #undef FFT_PLAN_BUTTERFLY_BODY
+        #undef FFT_PLAN_PACKED_BUTTERFLY_BODY
+        #undef FFT_PLAN_BUTTERFLY
+
+        typedef void (* plan_packed_butterfly_t)(float *dst, const float *tw, size_t n, size_t count, size_t blocks);
+        typedef void (* plan_butterfly_t)(float *dst_re, float *dst_im, const float *tw, size_t n, size_t count, size_t blocks);
+
+        static inline void plan_packed_butterflies(const dsp::fft_plan_t *plan, float *dst, plan_packed_butterfly_t butterfly)
+        {
+            size_t items    = size_t(1) << plan->rank;
+            size_t block    = lsp_min(items, size_t(1) << dsp::FFT_BLOCK_RANK);
+
+            // Lower stages: process each block of data with all stages before switching to the next block
+            for (size_t off=0; off < items; off += block)
+                for (size_t n=4; n < block; n <<= 1)
+                    butterfly(&dst[off << 1], dsp::fft_plan_twiddles(plan, n), n, n, block / (n << 1));
+
+            // Upper stages: process groups of stages column strip by column strip
+            for (size_t s=block; s < items; s <<= dsp::FFT_GROUP_RANK)
+            {
+                size_t last     = lsp_min(items, s << dsp::FFT_GROUP_RANK);
+                for (size_t off=0; off < items; off += last)
+                    for (size_t c=0; c < s; c += dsp::FFT_STRIP_SIZE)
+                        for (size_t n=s; n < last; n <<= 1)
+                            for (size_t r=c; r < n; r += s)
+                                butterfly(&dst[(off + r) << 1], &dsp::fft_plan_twiddles(plan, n)[r], n, dsp::FFT_STRIP_SIZE, last / (n << 1));
+            }
+        }
+
+        static inline void plan_butterflies(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, plan_butterfly_t butterfly)
+        {
+            size_t items    = size_t(1) << plan->rank;
+            size_t block    = lsp_min(items, size_t(1) << dsp::FFT_BLOCK_RANK);
+
+            // Lower stages: process each block of data with all stages before switching to the next block
+            for (size_t off=0; off < items; off += block)
+                for (size_t n=4; n < block; n <<= 1)
+                    butterfly(&dst_re[off], &dst_im[off], dsp::fft_plan_twiddles(plan, n), n, n, block / (n << 1));
+
+            // Upper stages: process groups of stages column strip by column strip
+            for (size_t s=block; s < items; s <<= dsp::FFT_GROUP_RANK)
+            {
+                size_t last     = lsp_min(items, s << dsp::FFT_GROUP_RANK);
+                for (size_t off=0; off < items; off += last)
+                    for (size_t c=0; c < s; c += dsp::FFT_STRIP_SIZE)
+                        for (size_t n=s; n < last; n <<= 1)
+                            for (size_t r=c; r < n; r += s)
+                                butterfly(&dst_re[off + r], &dst_im[off + r], &dsp::fft_plan_twiddles(plan, n)[r], n, dsp::FFT_STRIP_SIZE, last / (n << 1));
+            }
+        }
+
+        void plan_direct_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                direct_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_direct(dst_re, dst_im, src_re, src_im, rank);
+
+            plan_butterflies(plan, dst_re, dst_im, plan_butterfly_direct);
+        }
+
+        void plan_reverse_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                reverse_fft(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_reverse(dst_re, dst_im, src_re, src_im, rank);
+
+            plan_butterflies(plan, dst_re, dst_im, plan_butterfly_reverse);
+
+            dsp::normalize_fft2(dst_re, dst_im, rank);
+        }
+
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_direct_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_direct(dst, src, rank);
+
+            plan_packed_butterflies(plan, dst, plan_packed_butterfly_direct);
+
+            packed_fft_repack(dst, rank);
+        }
+
+        void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src)
+        {
+            size_t rank     = plan->rank;
+            if (rank <= 2)
+            {
+                packed_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            packed_scramble_reverse(dst, src, rank);
+
+            plan_packed_butterflies(plan, dst, plan_packed_butterfly_reverse);
+
+            packed_fft_repack_normalize(dst, rank);
+        }
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_FFTPLAN_H_ */
@@ -673,6 +673,220 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+    /*
+     * Process four independent lanes of the channel-parallel bank:
+     *  H - pointer to the filter memory of the lanes, coefficients are stored at LSP_DSP_BIQUAD_XN_SOFF
+     *  S, P, N - source pointer, destination pointer and number of frames, modified by the pass
+     *  D1 - offset of the second delay of the lanes
+     *  B0, B1, B2, A1, A2 - offsets of coefficient rows
+     *  STEP - size of the frame in bytes
+     */
+    #define BIQUAD_CN_PASS(H, S, P, N, D1, B0, B1, B2, A1, A2, STEP) \
+        ARCH_X86_ASM \
+        ( \
+            __ASM_EMIT("test        %[n], %[n]") \
+            __ASM_EMIT("jz          2f") \
+            \
+            /* Load delay buffer */ \
+            __ASM_EMIT("movaps      0x00(%[h]), %%xmm6")                        /* xmm6     = d0 */ \
+            __ASM_EMIT("movaps      " D1 "(%[h]), %%xmm7")                      /* xmm7     = d1 */ \
+            \
+            __ASM_EMIT("1:") \
+            __ASM_EMIT("movups      (%[src]), %%xmm0")                          /* xmm0     = s */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")                            /* xmm1     = s */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2")                            /* xmm2     = s */ \
+            __ASM_EMIT("mulps       " B0 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm0")  /* xmm0     = b0*s */ \
+            __ASM_EMIT("mulps       " B1 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm1")  /* xmm1     = b1*s */ \
+            __ASM_EMIT("mulps       " B2 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm2")  /* xmm2     = b2*s */ \
+            __ASM_EMIT("addps       %%xmm6, %%xmm0")                            /* xmm0     = s2 = b0*s + d0 */ \
+            __ASM_EMIT("addps       %%xmm7, %%xmm1")                            /* xmm1     = b1*s + d1 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm6")                            /* xmm6     = s2 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm7")                            /* xmm7     = s2 */ \
+            __ASM_EMIT("mulps       " A1 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm6")  /* xmm6     = a1*s2 */ \
+            __ASM_EMIT("mulps       " A2 " + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm7")  /* xmm7     = a2*s2 */ \
+            __ASM_EMIT("movups      %%xmm0, (%[dst])")                          /* *dst     = s2 */ \
+            __ASM_EMIT("addps       %%xmm1, %%xmm6")                            /* xmm6     = d0' = b1*s + a1*s2 + d1 */ \
+            __ASM_EMIT("addps       %%xmm2, %%xmm7")                            /* xmm7     = d1' = b2*s + a2*s2 */ \
+            __ASM_EMIT("add         $" STEP ", %[src]") \
+            __ASM_EMIT("add         $" STEP ", %[dst]") \
+            __ASM_EMIT("dec         %[n]") \
+            __ASM_EMIT("jnz         1b") \
+            \
+            /* Store delay buffer */ \
+            __ASM_EMIT("movaps      %%xmm6, 0x00(%[h])") \
+            __ASM_EMIT("movaps      %%xmm7, " D1 "(%[h])") \
+            \
+            __ASM_EMIT("2:") \
+            \
+            : [dst] "+r" (P), [src] "+r" (S), [n] "+r" (N) \
+            : [h] "r" (H) \
+            : "cc", "memory", \
+              "%xmm0", "%xmm1", "%xmm2", \
+              "%xmm6", "%xmm7" \
+        )
+
+        void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            BIQUAD_CN_PASS(f, src, dst, count, "0x10",
+                "0x00", "0x10", "0x20", "0x30", "0x40", "0x10");
+        }
+
+        void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            // Each half of the bank is four independent lanes, process them one after another
+            for (size_t i=0; i<2; ++i)
+            {
+                float *h        = &f->d[i*4];
+                const float *s  = &src[i*4];
+                float *p        = &dst[i*4];
+                size_t n        = count;
+
+                BIQUAD_CN_PASS(h, s, p, n, "0x20",
+                    "0x00", "0x20", "0x40", "0x60", "0x80", "0x20");
+            }
+        }
+
+        void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f)
+        {
+            // Each quarter of the frame is four independent lanes of one of two banks
+            for (size_t i=0; i<4; ++i)
+            {
+                float *h        = &f[i >> 1].d[(i & 1)*4];
+                const float *s  = &src[i*4];
+                float *p        = &dst[i*4];
+                size_t n        = count;
+
+                BIQUAD_CN_PASS(h, s, p, n, "0x20",
+                    "0x00", "0x20", "0x40", "0x60", "0x80", "0x40");
+            }
+        }
+
+    #undef BIQUAD_CN_PASS
+
+    /*
+     * Process one frame of four lanes stored in the register X:
+     *  h - pointer to the filter memory of the lanes, xmm6 = d0, xmm7 = d1
+     *  xmm3, xmm5 - temporary registers
+     */
+    #define BIQUAD_S4_STEP(X) \
+        __ASM_EMIT("movaps      %%" X ", %%xmm3") \
+        __ASM_EMIT("movaps      %%" X ", %%xmm5") \
+        __ASM_EMIT("mulps       0x20 + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm3")    /* xmm3     = b1*s */ \
+        __ASM_EMIT("mulps       0x40 + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm5")    /* xmm5     = b2*s */ \
+        __ASM_EMIT("mulps       0x00 + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%" X)      /* X        = b0*s */ \
+        __ASM_EMIT("addps       %%xmm7, %%xmm3")                            /* xmm3     = b1*s + d1 */ \
+        __ASM_EMIT("addps       %%xmm6, %%" X)                              /* X        = s2 = b0*s + d0 */ \
+        __ASM_EMIT("movaps      %%" X ", %%xmm6") \
+        __ASM_EMIT("movaps      %%" X ", %%xmm7") \
+        __ASM_EMIT("mulps       0x60 + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm6")    /* xmm6     = a1*s2 */ \
+        __ASM_EMIT("mulps       0x80 + " LSP_DSP_BIQUAD_XN_SOFF "(%[h]), %%xmm7")    /* xmm7     = a2*s2 */ \
+        __ASM_EMIT("addps       %%xmm3, %%xmm6")                            /* xmm6     = d0' = b1*s + a1*s2 + d1 */ \
+        __ASM_EMIT("addps       %%xmm5, %%xmm7")                            /* xmm7     = d1' = b2*s + a2*s2 */
+
+        void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f)
+        {
+            const size_t step   = stride * sizeof(float);
+            const size_t blocks = count & ~size_t(3);
+
+            // Each half of the bank is four independent lanes: four rows of four samples
+            // are loaded from the chunks and transposed to four frames in registers
+            for (size_t i=0; (blocks > 0) && (i<2); ++i)
+            {
+                float *h        = &f->d[i*4];
+                const float *s  = &src[i*4*stride];
+                float *p        = &dst[i*4*stride];
+                size_t n        = blocks;
+                IF_ARCH_X86(size_t tmp);
+
+                ARCH_X86_ASM
+                (
+                    // Load delay buffer
+                    __ASM_EMIT("movaps      0x00(%[h]), %%xmm6")                        // xmm6     = d0
+                    __ASM_EMIT("movaps      0x20(%[h]), %%xmm7")                        // xmm7     = d1
+
+                    __ASM_EMIT("1:")
+                    // Load rows a, b, c, d and transpose them to frames
+                    __ASM_EMIT("lea         (%[src], %[step], 2), %[tmp]")
+                    __ASM_EMIT("movups      (%[src]), %%xmm0")                          // xmm0     = a0 a1 a2 a3
+                    __ASM_EMIT("movups      (%[src], %[step]), %%xmm1")                 // xmm1     = b0 b1 b2 b3
+                    __ASM_EMIT("movups      (%[tmp]), %%xmm2")                          // xmm2     = c0 c1 c2 c3
+                    __ASM_EMIT("movups      (%[tmp], %[step]), %%xmm3")                 // xmm3     = d0 d1 d2 d3
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                            // xmm0     = a0 b0 a1 b1
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                            // xmm4     = a2 b2 a3 b3
+                    __ASM_EMIT("movaps      %%xmm2, %%xmm1")
+                    __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                            // xmm2     = c0 d0 c1 d1
+                    __ASM_EMIT("unpckhps    %%xmm3, %%xmm1")                            // xmm1     = c2 d2 c3 d3
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm3")
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                            // xmm0     = a0 b0 c0 d0
+                    __ASM_EMIT("movhlps     %%xmm3, %%xmm2")                            // xmm2     = a1 b1 c1 d1
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm3")
+                    __ASM_EMIT("movlhps     %%xmm1, %%xmm4")                            // xmm4     = a2 b2 c2 d2
+                    __ASM_EMIT("movhlps     %%xmm3, %%xmm1")                            // xmm1     = a3 b3 c3 d3
+
+                    // Process frames
+                    BIQUAD_S4_STEP("xmm0")
+                    BIQUAD_S4_STEP("xmm2")
+                    BIQUAD_S4_STEP("xmm4")
+                    BIQUAD_S4_STEP("xmm1")
+
+                    // Transpose frames back to rows a, b, c, d and store them
+                    __ASM_EMIT("lea         (%[dst], %[step], 2), %[tmp]")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm3")
+                    __ASM_EMIT("unpcklps    %%xmm2, %%xmm0")                            // xmm0     = a0 a1 b0 b1
+                    __ASM_EMIT("unpckhps    %%xmm2, %%xmm3")                            // xmm3     = c0 c1 d0 d1
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm2")
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm4")                            // xmm4     = a2 a3 b2 b3
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm2")                            // xmm2     = c2 c3 d2 d3
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+                    __ASM_EMIT("movlhps     %%xmm4, %%xmm0")                            // xmm0     = a0 a1 a2 a3
+                    __ASM_EMIT("movhlps     %%xmm1, %%xmm4")                            // xmm4     = b0 b1 b2 b3
+                    __ASM_EMIT("movaps      %%xmm3, %%xmm1")
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm3")                            // xmm3     = c0 c1 c2 c3
+                    __ASM_EMIT("movhlps     %%xmm1, %%xmm2")                            // xmm2     = d0 d1 d2 d3
+                    __ASM_EMIT("movups      %%xmm0, (%[dst])")
+                    __ASM_EMIT("movups      %%xmm4, (%[dst], %[step])")
+                    __ASM_EMIT("movups      %%xmm3, (%[tmp])")
+                    __ASM_EMIT("movups      %%xmm2, (%[tmp], %[step])")
+
+                    __ASM_EMIT("add         $0x10, %[src]")
+                    __ASM_EMIT("add         $0x10, %[dst]")
+                    __ASM_EMIT64("sub       $4, %[n]")
+                    __ASM_EMIT32("subl      $4, %[n]")
+                    __ASM_EMIT("jnz         1b")
+
+                    // Store delay buffer
+                    __ASM_EMIT("movaps      %%xmm6, 0x00(%[h])")
+                    __ASM_EMIT("movaps      %%xmm7, 0x20(%[h])")
+
+                    : [dst] "+r" (p), [src] "+r" (s), [n] X86_PGREG (n),
+                      [tmp] "=&r" (tmp)
+                    : [h] "r" (h), [step] "r" (step)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+
+            // Process the tail of each chunk as the interleaved frames
+            const size_t tail   = count - blocks;
+            if (tail > 0)
+            {
+                float buf[4 * 8] __lsp_aligned16;
+                for (size_t j=0; j<8; ++j)
+                    for (size_t i=0; i<tail; ++i)
+                        buf[i*8 + j]    = src[j*stride + blocks + i];
+
+                biquad_process_c8(buf, buf, tail, f);
+
+                for (size_t j=0; j<8; ++j)
+                    for (size_t i=0; i<tail; ++i)
+                        dst[j*stride + blocks + i]  = buf[i*8 + j];
+            }
+        }
+
+    #undef BIQUAD_S4_STEP
     }
 }
 
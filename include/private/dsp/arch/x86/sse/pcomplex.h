@@ -286,6 +286,77 @@ namespace lsp
             );
         }
 
+        void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count)
+        {
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xorps       %%xmm6, %%xmm6")
+                __ASM_EMIT("xorps       %%xmm7, %%xmm7")
+                /* 8x blocks */
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movups      0x00(%[src]), %%xmm0")  /* xmm0  = s0  s1  s2  s3  */
+                __ASM_EMIT("movups      0x10(%[src]), %%xmm1")  /* xmm1  = s4  s5  s6  s7  */
+                __ASM_EMIT("movups      0x00(%[w]), %%xmm2")    /* xmm2  = w0  w1  w2  w3  */
+                __ASM_EMIT("movups      0x10(%[w]), %%xmm3")    /* xmm3  = w4  w5  w6  w7  */
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")        /* xmm0  = r0  r1  r2  r3  */
+                __ASM_EMIT("mulps       %%xmm3, %%xmm1")        /* xmm1  = r4  r5  r6  r7  */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm0")        /* xmm0  = r0  0   r1  0   */
+                __ASM_EMIT("unpcklps    %%xmm7, %%xmm1")        /* xmm1  = r4  0   r5  0   */
+                __ASM_EMIT("unpckhps    %%xmm6, %%xmm4")        /* xmm4  = r2  0   r3  0   */
+                __ASM_EMIT("unpckhps    %%xmm7, %%xmm5")        /* xmm5  = r6  0   r7  0   */
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm4, 0x10(%[dst])")
+                __ASM_EMIT("movups      %%xmm1, 0x20(%[dst])")
+                __ASM_EMIT("movups      %%xmm5, 0x30(%[dst])")
+                __ASM_EMIT("add         $0x20, %[src]")
+                __ASM_EMIT("add         $0x20, %[w]")
+                __ASM_EMIT("add         $0x40, %[dst]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                /* 4x block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movups      0x00(%[src]), %%xmm0")
+                __ASM_EMIT("movups      0x00(%[w]), %%xmm2")
+                __ASM_EMIT("mulps       %%xmm2, %%xmm0")
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+                __ASM_EMIT("unpcklps    %%xmm6, %%xmm0")
+                __ASM_EMIT("unpckhps    %%xmm7, %%xmm4")
+                __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("movups      %%xmm4, 0x10(%[dst])")
+                __ASM_EMIT("add         $0x10, %[src]")
+                __ASM_EMIT("add         $0x10, %[w]")
+                __ASM_EMIT("add         $0x20, %[dst]")
+                __ASM_EMIT("sub         $4, %[count]")
+                /* 1x blocks */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $3, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("5:")
+                __ASM_EMIT("movss       0x00(%[src]), %%xmm0")
+                __ASM_EMIT("mulss       0x00(%[w]), %%xmm0")
+                __ASM_EMIT("movlps      %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add         $0x04, %[src]")
+                __ASM_EMIT("add         $0x04, %[w]")
+                __ASM_EMIT("add         $0x08, %[dst]")
+                __ASM_EMIT("dec         %[count]")
+                __ASM_EMIT("jge         5b")
+                /* End of routine */
+                __ASM_EMIT("6:")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [w] "+r" (w), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
         void pcomplex_c2r(float *dst, const float *src, size_t count)
         {
             #define complex_to_real_core(MV_DST, MV_SRC) \
@@ -2600,6 +2600,105 @@ namespace lsp
                   "%xmm4", "%xmm5", "%xmm6", "%xmm7"
             );
         }
+
+        void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count)
+        {
+            size_t stride   = factor * sizeof(float);
+            const float *s, *s3, *kp;
+            size_t n;
+
+            // Compute 4 output samples at once, each output sample reads its own row of input
+            for ( ; count >= 4; count -= 4)
+            {
+                s               = src;
+                kp              = k;
+                n               = taps;
+
+                ARCH_X86_ASM
+                (
+                    __ASM_EMIT("lea         (%[s], %[stride], 2), %[s3]")
+                    __ASM_EMIT("xorps       %%xmm0, %%xmm0")
+                    __ASM_EMIT("xorps       %%xmm1, %%xmm1")
+                    __ASM_EMIT("add         %[stride], %[s3]")                      // s3 = s + 3*stride
+                    __ASM_EMIT("xorps       %%xmm2, %%xmm2")
+                    __ASM_EMIT("xorps       %%xmm3, %%xmm3")
+                    // 4x blocks
+                    __ASM_EMIT("sub         $4, %[n]")
+                    __ASM_EMIT("jb          2f")
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movups      0x00(%[k]), %%xmm4")                    // xmm4 = k0 k1 k2 k3
+                    __ASM_EMIT("movups      0x00(%[s]), %%xmm5")                    // xmm5 = a0 a1 a2 a3
+                    __ASM_EMIT("movups      0x00(%[s], %[stride], 1), %%xmm6")      // xmm6 = b0 b1 b2 b3
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm0")
+                    __ASM_EMIT("addps       %%xmm6, %%xmm1")
+                    __ASM_EMIT("movups      0x00(%[s], %[stride], 2), %%xmm5")      // xmm5 = c0 c1 c2 c3
+                    __ASM_EMIT("movups      0x00(%[s3]), %%xmm6")                   // xmm6 = d0 d1 d2 d3
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+                    __ASM_EMIT("mulps       %%xmm4, %%xmm6")
+                    __ASM_EMIT("addps       %%xmm5, %%xmm2")
+                    __ASM_EMIT("addps       %%xmm6, %%xmm3")
+                    __ASM_EMIT("add         $0x10, %[k]")
+                    __ASM_EMIT("add         $0x10, %[s]")
+                    __ASM_EMIT("add         $0x10, %[s3]")
+                    __ASM_EMIT("sub         $4, %[n]")
+                    __ASM_EMIT("jae         1b")
+                    // 1x blocks
+                    __ASM_EMIT("2:")
+                    __ASM_EMIT("add         $3, %[n]")
+                    __ASM_EMIT("jl          4f")
+                    __ASM_EMIT("3:")
+                    __ASM_EMIT("movss       0x00(%[k]), %%xmm4")                    // xmm4 = k0
+                    __ASM_EMIT("movss       0x00(%[s]), %%xmm5")                    // xmm5 = a0
+                    __ASM_EMIT("movss       0x00(%[s], %[stride], 1), %%xmm6")      // xmm6 = b0
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm5")
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm6")
+                    __ASM_EMIT("addss       %%xmm5, %%xmm0")
+                    __ASM_EMIT("addss       %%xmm6, %%xmm1")
+                    __ASM_EMIT("movss       0x00(%[s], %[stride], 2), %%xmm5")      // xmm5 = c0
+                    __ASM_EMIT("movss       0x00(%[s3]), %%xmm6")                   // xmm6 = d0
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm5")
+                    __ASM_EMIT("mulss       %%xmm4, %%xmm6")
+                    __ASM_EMIT("addss       %%xmm5, %%xmm2")
+                    __ASM_EMIT("addss       %%xmm6, %%xmm3")
+                    __ASM_EMIT("add         $0x04, %[k]")
+                    __ASM_EMIT("add         $0x04, %[s]")
+                    __ASM_EMIT("add         $0x04, %[s3]")
+                    __ASM_EMIT("dec         %[n]")
+                    __ASM_EMIT("jge         3b")
+                    // Transpose and sum
+                    __ASM_EMIT("4:")
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")                        // xmm4 = a0 a1 a2 a3
+                    __ASM_EMIT("movaps      %%xmm2, %%xmm5")                        // xmm5 = c0 c1 c2 c3
+                    __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                        // xmm0 = a0 b0 a1 b1
+                    __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                        // xmm4 = a2 b2 a3 b3
+                    __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                        // xmm2 = c0 d0 c1 d1
+                    __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")                        // xmm5 = c2 d2 c3 d3
+                    __ASM_EMIT("addps       %%xmm4, %%xmm0")                        // xmm0 = a02 b02 a13 b13
+                    __ASM_EMIT("addps       %%xmm5, %%xmm2")                        // xmm2 = c02 d02 c13 d13
+                    __ASM_EMIT("movaps      %%xmm0, %%xmm4")                        // xmm4 = a02 b02 a13 b13
+                    __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                        // xmm0 = a02 b02 c02 d02
+                    __ASM_EMIT("movhlps     %%xmm4, %%xmm2")                        // xmm2 = a13 b13 c13 d13
+                    __ASM_EMIT("addps       %%xmm2, %%xmm0")                        // xmm0 = a b c d
+                    __ASM_EMIT("mov         %[dst], %[s3]")
+                    __ASM_EMIT("movups      %%xmm0, 0x00(%[s3])")
+
+                    : [s] "+r" (s), [s3] "=&r" (s3), [k] "+r" (kp), [n] "+r" (n)
+                    : [stride] "r" (stride), [dst] "m" (dst)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6"
+                );
+
+                dst            += 4;
+                src            += factor * 4;
+            }
+
+            // Tail
+            for ( ; count > 0; --count, ++dst, src += factor)
+                *dst            = h_dotp(k, src, taps);
+        }
     }
 }
 
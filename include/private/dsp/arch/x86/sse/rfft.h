@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_RFFT_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_RFFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+        static const float XRFFT_SMALL_W[] __lsp_aligned16 =
+        {
+            // cos(2*pi*k/16)
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f,
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            // sin(2*pi*k/16)
+            0.0000000000000000f, 0.3826834323650898f, 0.7071067811865475f, 0.9238795325112867f,
+            1.0000000000000000f, 0.9238795325112867f, 0.7071067811865475f, 0.3826834323650898f,
+            0.0000000000000000f, -0.3826834323650898f, -0.7071067811865475f, -0.9238795325112867f,
+            -1.0000000000000000f, -0.9238795325112867f, -0.7071067811865475f, -0.3826834323650898f
+        };
+
+        static void real_small_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[16];
+            size_t items    = size_t(1) << rank;
+            size_t shift    = 4 - rank;
+            for (size_t i=0; i<items; ++i)
+                buf[i]          = src[i];
+
+            for (size_t k=0; k <= (items >> 1); ++k)
+            {
+                float re        = 0.0f;
+                float im        = 0.0f;
+                for (size_t i=0; i<items; ++i)
+                {
+                    size_t idx      = ((k * i) << shift) & 0xf;
+                    re             += buf[i] * XRFFT_SMALL_W[idx];
+                    im             -= buf[i] * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[k*2]        = re;
+                dst[k*2 + 1]    = im;
+            }
+        }
+
+        static void real_small_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            float buf[18];
+            size_t items    = size_t(1) << rank;
+            size_t half     = items >> 1;
+            size_t shift    = 4 - rank;
+            float k         = 1.0f / items;
+            for (size_t i=0; i<=half; ++i)
+            {
+                buf[i*2]        = src[i*2];
+                buf[i*2 + 1]    = src[i*2 + 1];
+            }
+
+            for (size_t i=0; i<items; ++i)
+            {
+                float re        = 0.0f;
+                for (size_t j=0; j<items; ++j)
+                {
+                    size_t idx      = ((i * j) << shift) & 0xf;
+                    float xr        = (j <= half) ? buf[j*2] : buf[(items - j)*2];
+                    float xi        = (j <= half) ? buf[j*2 + 1] : -buf[(items - j)*2 + 1];
+                    re             += xr * XRFFT_SMALL_W[idx] - xi * XRFFT_SMALL_W[idx + 16];
+                }
+                dst[i]          = re * k;
+            }
+        }
+
+        /*
+         * Prepare the twiddle factors for the split stage:
+         *   tw[0..3]   = w_re[k..k+3] * 0.5
+         *   tw[4..7]   = w_im[k..k+3] * 0.5
+         *   tw[8..11]  = dw_re
+         *   tw[12..15] = dw_im
+         *   tw[16..19] = 0.5
+         */
+        static inline void real_fft_split_init(float *tw, size_t rank)
+        {
+            const float *iw_re  = &XFFT_A_RE[(rank - 3) << 2];
+            const float *iw_im  = &XFFT_A_IM[(rank - 3) << 2];
+            const float *dw_re  = &XFFT_W_RE[(rank - 3) << 2];
+            const float *dw_im  = &XFFT_W_IM[(rank - 3) << 2];
+
+            tw[0]           = iw_re[1] * 0.5f;
+            tw[1]           = iw_re[2] * 0.5f;
+            tw[2]           = iw_re[3] * 0.5f;
+            tw[3]           = dw_re[0] * 0.5f;
+            tw[4]           = iw_im[1] * 0.5f;
+            tw[5]           = iw_im[2] * 0.5f;
+            tw[6]           = iw_im[3] * 0.5f;
+            tw[7]           = dw_im[0] * 0.5f;
+
+            for (size_t i=0; i<4; ++i)
+            {
+                tw[i + 8]       = dw_re[i];
+                tw[i + 12]      = dw_im[i];
+                tw[i + 16]      = 0.5f;
+            }
+        }
+
+        #define RFFT_LOAD_PAIR(a, b) \
+            /* Load front and back blocks and de-interleave them */ \
+            __ASM_EMIT("movups      0x00(" a "), %%xmm0")           /* xmm0 = ar0 ai0 ar1 ai1 */ \
+            __ASM_EMIT("movups      0x10(" a "), %%xmm4")           /* xmm4 = ar2 ai2 ar3 ai3 */ \
+            __ASM_EMIT("movups      0x00(" b "), %%xmm2")           /* xmm2 = br3 bi3 br2 bi2 */ \
+            __ASM_EMIT("movups      0x10(" b "), %%xmm6")           /* xmm6 = br1 bi1 br0 bi0 */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1") \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3") \
+            __ASM_EMIT("shufps      $0x88, %%xmm4, %%xmm0")         /* xmm0 = ar0 ar1 ar2 ar3 */ \
+            __ASM_EMIT("shufps      $0xdd, %%xmm4, %%xmm1")         /* xmm1 = ai0 ai1 ai2 ai3 */ \
+            __ASM_EMIT("shufps      $0x88, %%xmm6, %%xmm2")         /* xmm2 = br3 br2 br1 br0 */ \
+            __ASM_EMIT("shufps      $0xdd, %%xmm6, %%xmm3")         /* xmm3 = bi3 bi2 bi1 bi0 */ \
+            __ASM_EMIT("shufps      $0x1b, %%xmm2, %%xmm2")         /* xmm2 = br0 br1 br2 br3 */ \
+            __ASM_EMIT("shufps      $0x1b, %%xmm3, %%xmm3")         /* xmm3 = bi0 bi1 bi2 bi3 */
+
+        #define RFFT_STORE_PAIR(a, b) \
+            /* Interleave front and back blocks and store them */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm6") \
+            __ASM_EMIT("movaps      %%xmm2, %%xmm7") \
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                /* xmm0 = ar0 ai0 ar1 ai1 */ \
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm6")                /* xmm6 = ar2 ai2 ar3 ai3 */ \
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                /* xmm2 = br0 bi0 br1 bi1 */ \
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm7")                /* xmm7 = br2 bi2 br3 bi3 */ \
+            __ASM_EMIT("shufps      $0x4e, %%xmm2, %%xmm2")         /* xmm2 = br1 bi1 br0 bi0 */ \
+            __ASM_EMIT("shufps      $0x4e, %%xmm7, %%xmm7")         /* xmm7 = br3 bi3 br2 bi2 */ \
+            __ASM_EMIT("movups      %%xmm0, 0x00(" a ")") \
+            __ASM_EMIT("movups      %%xmm6, 0x10(" a ")") \
+            __ASM_EMIT("movups      %%xmm7, 0x00(" b ")") \
+            __ASM_EMIT("movups      %%xmm2, 0x10(" b ")")
+
+        #define RFFT_ROTATE \
+            /* Rotate twiddle factors */ \
+            __ASM_EMIT("movaps      0x00(%[tw]), %%xmm0")           /* xmm0 = w_re */ \
+            __ASM_EMIT("movaps      0x10(%[tw]), %%xmm1")           /* xmm1 = w_im */ \
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2")                /* xmm2 = w_re */ \
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                /* xmm3 = w_im */ \
+            __ASM_EMIT("mulps       0x20(%[tw]), %%xmm0")           /* xmm0 = w_re*dw_re */ \
+            __ASM_EMIT("mulps       0x30(%[tw]), %%xmm1")           /* xmm1 = w_im*dw_im */ \
+            __ASM_EMIT("mulps       0x30(%[tw]), %%xmm2")           /* xmm2 = w_re*dw_im */ \
+            __ASM_EMIT("mulps       0x20(%[tw]), %%xmm3")           /* xmm3 = w_im*dw_re */ \
+            __ASM_EMIT("subps       %%xmm1, %%xmm0")                /* xmm0 = w_re*dw_re - w_im*dw_im */ \
+            __ASM_EMIT("addps       %%xmm3, %%xmm2")                /* xmm2 = w_re*dw_im + w_im*dw_re */ \
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[tw])") \
+            __ASM_EMIT("movaps      %%xmm2, 0x10(%[tw])")
+
+        void real_direct_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 3)
+            {
+                real_small_direct_fft(dst, src, rank);
+                return;
+            }
+
+            // Perform complex FFT of the half size
+            packed_direct_fft(dst, src, rank - 1);
+
+            // Compute the first and the last harmonics
+            size_t half     = size_t(1) << (rank - 1);
+            float re        = dst[0];
+            float im        = dst[1];
+            dst[0]          = re + im;
+            dst[1]          = 0.0f;
+            dst[half*2]     = re - im;
+            dst[half*2 + 1] = 0.0f;
+
+            // Process harmonic pairs k and M-k, the middle harmonic is processed by both
+            float tw[20] __lsp_aligned16;
+            real_fft_split_init(tw, rank);
+            size_t off      = 2 * sizeof(float);
+            size_t boff     = (half - 4) * 2 * sizeof(float);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                RFFT_LOAD_PAIR("%[dst], %[off]", "%[dst], %[boff]")
+
+                // Compute even and odd parts
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")                /* xmm4 = ar */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5 = ai */
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")                /* xmm0 = ar+br */
+                __ASM_EMIT("subps       %%xmm2, %%xmm4")                /* xmm4 = ar-br = 2*or */
+                __ASM_EMIT("subps       %%xmm3, %%xmm1")                /* xmm1 = ai-bi */
+                __ASM_EMIT("addps       %%xmm3, %%xmm5")                /* xmm5 = ai+bi = 2*oi */
+                __ASM_EMIT("mulps       0x40(%[tw]), %%xmm0")           /* xmm0 = er */
+                __ASM_EMIT("mulps       0x40(%[tw]), %%xmm1")           /* xmm1 = ei */
+
+                // Apply twiddle factors
+                __ASM_EMIT("movaps      %%xmm4, %%xmm2")                /* xmm2 = 2*or */
+                __ASM_EMIT("movaps      %%xmm5, %%xmm3")                /* xmm3 = 2*oi */
+                __ASM_EMIT("mulps       0x00(%[tw]), %%xmm2")           /* xmm2 = c*or */
+                __ASM_EMIT("mulps       0x10(%[tw]), %%xmm3")           /* xmm3 = s*oi */
+                __ASM_EMIT("mulps       0x10(%[tw]), %%xmm4")           /* xmm4 = s*or */
+                __ASM_EMIT("mulps       0x00(%[tw]), %%xmm5")           /* xmm5 = c*oi */
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")                /* xmm2 = tr = c*or + s*oi */
+                __ASM_EMIT("subps       %%xmm4, %%xmm5")                /* xmm5 = ti = c*oi - s*or */
+
+                // Compute the output
+                __ASM_EMIT("xorps       %%xmm3, %%xmm3")                /* xmm3 = 0 */
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")                /* xmm4 = er */
+                __ASM_EMIT("subps       %%xmm1, %%xmm3")                /* xmm3 = -ei */
+                __ASM_EMIT("addps       %%xmm5, %%xmm0")                /* xmm0 = er + ti */
+                __ASM_EMIT("subps       %%xmm2, %%xmm1")                /* xmm1 = ei - tr */
+                __ASM_EMIT("subps       %%xmm5, %%xmm4")                /* xmm4 = er - ti */
+                __ASM_EMIT("subps       %%xmm2, %%xmm3")                /* xmm3 = -ei - tr */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm2")                /* xmm2 = er - ti */
+                RFFT_STORE_PAIR("%[dst], %[off]", "%[dst], %[boff]")
+                RFFT_ROTATE
+
+                __ASM_EMIT("add         $0x20, %[off]")
+                __ASM_EMIT("sub         $0x20, %[boff]")
+                __ASM_EMIT("cmp         %[boff], %[off]")
+                __ASM_EMIT("jb          1b")
+
+                : [off] "+r" (off), [boff] "+r" (boff)
+                : [dst] "r" (dst), [tw] "r" (&tw[0])
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void real_reverse_fft(float *dst, const float *src, size_t rank)
+        {
+            // Check bounds
+            if (rank <= 3)
+            {
+                real_small_reverse_fft(dst, src, rank);
+                return;
+            }
+
+            // Compute the first harmonic
+            size_t half     = size_t(1) << (rank - 1);
+            float re        = src[0];
+            float im        = src[half*2];
+
+            // Process harmonic pairs k and M-k, the middle harmonic is processed by both
+            float tw[20] __lsp_aligned16;
+            real_fft_split_init(tw, rank);
+            size_t off      = 2 * sizeof(float);
+            size_t boff     = (half - 4) * 2 * sizeof(float);
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                RFFT_LOAD_PAIR("%[src], %[off]", "%[src], %[boff]")
+
+                // Compute even and odd parts
+                __ASM_EMIT("movaps      %%xmm0, %%xmm4")                /* xmm4 = ar */
+                __ASM_EMIT("movaps      %%xmm1, %%xmm5")                /* xmm5 = ai */
+                __ASM_EMIT("addps       %%xmm2, %%xmm0")                /* xmm0 = ar+br */
+                __ASM_EMIT("subps       %%xmm2, %%xmm4")                /* xmm4 = ar-br = 2*dr */
+                __ASM_EMIT("subps       %%xmm3, %%xmm1")                /* xmm1 = ai-bi */
+                __ASM_EMIT("addps       %%xmm3, %%xmm5")                /* xmm5 = ai+bi = 2*di */
+                __ASM_EMIT("mulps       0x40(%[tw]), %%xmm0")           /* xmm0 = er */
+                __ASM_EMIT("mulps       0x40(%[tw]), %%xmm1")           /* xmm1 = ei */
+
+                // Apply twiddle factors
+                __ASM_EMIT("movaps      %%xmm5, %%xmm2")                /* xmm2 = 2*di */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm3")                /* xmm3 = 2*dr */
+                __ASM_EMIT("mulps       0x00(%[tw]), %%xmm2")           /* xmm2 = c*di */
+                __ASM_EMIT("mulps       0x10(%[tw]), %%xmm3")           /* xmm3 = s*dr */
+                __ASM_EMIT("mulps       0x00(%[tw]), %%xmm4")           /* xmm4 = c*dr */
+                __ASM_EMIT("mulps       0x10(%[tw]), %%xmm5")           /* xmm5 = s*di */
+                __ASM_EMIT("addps       %%xmm3, %%xmm2")                /* xmm2 = -or = c*di + s*dr */
+                __ASM_EMIT("subps       %%xmm5, %%xmm4")                /* xmm4 = oi = c*dr - s*di */
+
+                // Compute the output
+                __ASM_EMIT("movaps      %%xmm0, %%xmm3")                /* xmm3 = er */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm5")                /* xmm5 = oi */
+                __ASM_EMIT("subps       %%xmm2, %%xmm0")                /* xmm0 = er + or */
+                __ASM_EMIT("addps       %%xmm2, %%xmm3")                /* xmm3 = er - or */
+                __ASM_EMIT("subps       %%xmm1, %%xmm4")                /* xmm4 = oi - ei */
+                __ASM_EMIT("addps       %%xmm5, %%xmm1")                /* xmm1 = ei + oi */
+                __ASM_EMIT("movaps      %%xmm3, %%xmm2")                /* xmm2 = er - or */
+                __ASM_EMIT("movaps      %%xmm4, %%xmm3")                /* xmm3 = oi - ei */
+                RFFT_STORE_PAIR("%[dst], %[off]", "%[dst], %[boff]")
+                RFFT_ROTATE
+
+                __ASM_EMIT("add         $0x20, %[off]")
+                __ASM_EMIT("sub         $0x20, %[boff]")
+                __ASM_EMIT("cmp         %[boff], %[off]")
+                __ASM_EMIT("jb          1b")
+
+                : [off] "+r" (off), [boff] "+r" (boff)
+                : [dst] "r" (dst), [src] "r" (src), [tw] "r" (&tw[0])
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            dst[0]          = (re + im) * 0.5f;
+            dst[1]          = (re - im) * 0.5f;
+
+            // Perform reverse complex FFT of the half size
+            packed_reverse_fft(dst, dst, rank - 1);
+        }
+
+        #undef RFFT_LOAD_PAIR
+        #undef RFFT_STORE_PAIR
+        #undef RFFT_ROTATE
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_RFFT_H_ */
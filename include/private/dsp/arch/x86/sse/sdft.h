@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_SDFT_H_
+#define PRIVATE_DSP_ARCH_X86_SSE_SDFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_IMPL */
+
+namespace lsp
+{
+    namespace sse
+    {
+    #define SDFT_X4_STEP(RE, IM, C, S, K, X) \
+        __ASM_EMIT("movaps      %%" RE ", %%xmm5")                  /* xmm5 = re */ \
+        __ASM_EMIT("movaps      %%" IM ", %%xmm6")                  /* xmm6 = im */ \
+        __ASM_EMIT("mulps       " C "(%[bank]), %%xmm5")            /* xmm5 = c*re */ \
+        __ASM_EMIT("mulps       " S "(%[bank]), %%xmm6")            /* xmm6 = s*im */ \
+        __ASM_EMIT("mulps       " S "(%[bank]), %%" RE)             /* re = s*re */ \
+        __ASM_EMIT("mulps       " C "(%[bank]), %%" IM)             /* im = c*im */ \
+        __ASM_EMIT("mulps       " K "(%[bank]), %%" X)              /* x = k*x */ \
+        __ASM_EMIT("subps       %%xmm6, %%xmm5")                    /* xmm5 = c*re - s*im */ \
+        __ASM_EMIT("addps       %%" RE ", %%" IM)                   /* im' = s*re + c*im */ \
+        __ASM_EMIT("addps       %%" X ", %%xmm5")                   /* xmm5 = c*re - s*im + k*x */ \
+        __ASM_EMIT("movaps      %%xmm5, %%" RE)                     /* re' = c*re - s*im + k*x */
+
+        void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count)
+        {
+            if (count <= 0)
+                return;
+
+            for (size_t banks = (bins + 7) >> 3; banks > 0; --banks, ++bank)
+            {
+                const float *s  = src;
+                size_t n        = count;
+
+                ARCH_X86_ASM
+                (
+                    // Load state
+                    __ASM_EMIT("movaps      0x00(%[bank]), %%xmm0")     /* xmm0 = re[0..3] */
+                    __ASM_EMIT("movaps      0x10(%[bank]), %%xmm1")     /* xmm1 = re[4..7] */
+                    __ASM_EMIT("movaps      0x20(%[bank]), %%xmm2")     /* xmm2 = im[0..3] */
+                    __ASM_EMIT("movaps      0x30(%[bank]), %%xmm3")     /* xmm3 = im[4..7] */
+
+                    // Process samples
+                    __ASM_EMIT("1:")
+                    __ASM_EMIT("movss       (%[src]), %%xmm4")          /* xmm4 = x */
+                    __ASM_EMIT("shufps      $0x00, %%xmm4, %%xmm4")     /* xmm4 = x x x x */
+                    __ASM_EMIT("movaps      %%xmm4, %%xmm7")            /* xmm7 = x x x x */
+                    SDFT_X4_STEP("xmm0", "xmm2", "0x40", "0x60", "0x80", "xmm4")
+                    SDFT_X4_STEP("xmm1", "xmm3", "0x50", "0x70", "0x90", "xmm7")
+                    __ASM_EMIT("add         $4, %[src]")
+                    __ASM_EMIT("dec         %[count]")
+                    __ASM_EMIT("jnz         1b")
+
+                    // Store state
+                    __ASM_EMIT("movaps      %%xmm0, 0x00(%[bank])")
+                    __ASM_EMIT("movaps      %%xmm1, 0x10(%[bank])")
+                    __ASM_EMIT("movaps      %%xmm2, 0x20(%[bank])")
+                    __ASM_EMIT("movaps      %%xmm3, 0x30(%[bank])")
+
+                    : [src] "+r" (s), [count] "+r" (n)
+                    : [bank] "r" (bank)
+                    : "cc", "memory",
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                );
+            }
+        }
+
+    #undef SDFT_X4_STEP
+
+    } /* namespace sse */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE_SDFT_H_ */
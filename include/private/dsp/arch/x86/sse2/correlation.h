@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_CORRELATION_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_CORRELATION_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+
+        void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count)
+        {
+            IF_ARCH_X86(
+                size_t off;
+            );
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("xorpd       %%xmm0, %%xmm0")                /* xv = 0 */
+                __ASM_EMIT("xorpd       %%xmm1, %%xmm1")                /* xa = 0 */
+                __ASM_EMIT("xorpd       %%xmm2, %%xmm2")                /* xb = 0 */
+                /* 4x blocks */
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movupd      0x00(%[a], %[off]), %%xmm3")    /* xmm3 = a0 */
+                __ASM_EMIT("movupd      0x10(%[a], %[off]), %%xmm4")    /* xmm4 = a1 */
+                __ASM_EMIT("movapd      %%xmm3, %%xmm7")                /* xmm7 = a0 */
+                __ASM_EMIT("movupd      0x00(%[b], %[off]), %%xmm5")    /* xmm5 = b0 */
+                __ASM_EMIT("movupd      0x10(%[b], %[off]), %%xmm6")    /* xmm6 = b1 */
+                __ASM_EMIT("mulpd       %%xmm5, %%xmm7")                /* xmm7 = a0*b0 */
+                __ASM_EMIT("mulpd       %%xmm3, %%xmm3")                /* xmm3 = a0*a0 */
+                __ASM_EMIT("mulpd       %%xmm5, %%xmm5")                /* xmm5 = b0*b0 */
+                __ASM_EMIT("addpd       %%xmm7, %%xmm0")                /* xmm0 = xv + a0*b0 */
+                __ASM_EMIT("addpd       %%xmm3, %%xmm1")                /* xmm1 = xa + a0*a0 */
+                __ASM_EMIT("movapd      %%xmm4, %%xmm7")                /* xmm7 = a1 */
+                __ASM_EMIT("addpd       %%xmm5, %%xmm2")                /* xmm2 = xb + b0*b0 */
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm7")                /* xmm7 = a1*b1 */
+                __ASM_EMIT("mulpd       %%xmm4, %%xmm4")                /* xmm4 = a1*a1 */
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm6")                /* xmm6 = b1*b1 */
+                __ASM_EMIT("addpd       %%xmm7, %%xmm0")                /* xmm0 = xv + a1*b1 */
+                __ASM_EMIT("addpd       %%xmm4, %%xmm1")                /* xmm1 = xa + a1*a1 */
+                __ASM_EMIT("addpd       %%xmm6, %%xmm2")                /* xmm2 = xb + b1*b1 */
+                __ASM_EMIT("add         $0x20, %[off]")                 /* ++off */
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                /* 2x block */
+                __ASM_EMIT("add         $2, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movupd      0x00(%[a], %[off]), %%xmm3")    /* xmm3 = a0 */
+                __ASM_EMIT("movupd      0x00(%[b], %[off]), %%xmm5")    /* xmm5 = b0 */
+                __ASM_EMIT("movapd      %%xmm3, %%xmm7")                /* xmm7 = a0 */
+                __ASM_EMIT("mulpd       %%xmm3, %%xmm3")                /* xmm3 = a0*a0 */
+                __ASM_EMIT("mulpd       %%xmm5, %%xmm7")                /* xmm7 = a0*b0 */
+                __ASM_EMIT("mulpd       %%xmm5, %%xmm5")                /* xmm5 = b0*b0 */
+                __ASM_EMIT("addpd       %%xmm7, %%xmm0")                /* xmm0 = xv + a0*b0 */
+                __ASM_EMIT("addpd       %%xmm3, %%xmm1")                /* xmm1 = xa + a0*a0 */
+                __ASM_EMIT("addpd       %%xmm5, %%xmm2")                /* xmm2 = xb + b0*b0 */
+                __ASM_EMIT("add         $0x10, %[off]")                 /* ++off */
+                __ASM_EMIT("sub         $2, %[count]")
+                __ASM_EMIT("4:")
+                /* Do horizontal sum */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm4")                /* xmm4 = xv0 xv1 */
+                __ASM_EMIT("movapd      %%xmm1, %%xmm5")                /* xmm5 = xa0 xa1 */
+                __ASM_EMIT("movapd      %%xmm2, %%xmm6")                /* xmm6 = xb0 xb1 */
+                __ASM_EMIT("unpckhpd    %%xmm4, %%xmm4")                /* xmm4 = xv1 xv1 */
+                __ASM_EMIT("unpckhpd    %%xmm5, %%xmm5")                /* xmm5 = xa1 xa1 */
+                __ASM_EMIT("unpckhpd    %%xmm6, %%xmm6")                /* xmm6 = xb1 xb1 */
+                __ASM_EMIT("addsd       %%xmm4, %%xmm0")                /* xmm0 = xv0+xv1 */
+                __ASM_EMIT("addsd       %%xmm5, %%xmm1")                /* xmm1 = xa0+xa1 */
+                __ASM_EMIT("addsd       %%xmm6, %%xmm2")                /* xmm2 = xb0+xb1 */
+                /* 1x block */
+                __ASM_EMIT("add         $1, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("movsd       0x00(%[a], %[off]), %%xmm3")    /* xmm3 = a0 */
+                __ASM_EMIT("movsd       0x00(%[b], %[off]), %%xmm5")    /* xmm5 = b0 */
+                __ASM_EMIT("movapd      %%xmm3, %%xmm7")                /* xmm7 = a0 */
+                __ASM_EMIT("mulsd       %%xmm3, %%xmm3")                /* xmm3 = a0*a0 */
+                __ASM_EMIT("mulsd       %%xmm5, %%xmm7")                /* xmm7 = a0*b0 */
+                __ASM_EMIT("mulsd       %%xmm5, %%xmm5")                /* xmm5 = b0*b0 */
+                __ASM_EMIT("addsd       %%xmm7, %%xmm0")                /* xmm0 = xv + a0*b0 */
+                __ASM_EMIT("addsd       %%xmm3, %%xmm1")                /* xmm1 = xa + a0*a0 */
+                __ASM_EMIT("addsd       %%xmm5, %%xmm2")                /* xmm2 = xb + b0*b0 */
+                __ASM_EMIT("6:")
+                /* Store result */
+                __ASM_EMIT("addsd       0x00(%[corr]), %%xmm0")
+                __ASM_EMIT("addsd       0x08(%[corr]), %%xmm1")
+                __ASM_EMIT("addsd       0x10(%[corr]), %%xmm2")
+                __ASM_EMIT("movsd       %%xmm0, 0x00(%[corr])")
+                __ASM_EMIT("movsd       %%xmm1, 0x08(%[corr])")
+                __ASM_EMIT("movsd       %%xmm2, 0x10(%[corr])")
+
+                : [corr] "+r" (corr), [off] "=&r" (off), [count] "+r" (count)
+                : [a] "r" (a), [b] "r" (b)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        static const double corr_f64_const[] __lsp_aligned16 =
+        {
+            1e-18, 1e-18
+        };
+
+        void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+            const double *a_head, const double *b_head,
+            const double *a_tail, const double *b_tail,
+            size_t count)
+        {
+            IF_ARCH_I386(
+                void *ptr;
+            );
+
+            ARCH_X86_ASM
+            (
+                /* 2x blocks */
+                __ASM_EMIT32("subl      $2, %[count]")
+                __ASM_EMIT64("sub       $2, %[count]")
+                __ASM_EMIT("jb          2f")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movupd      0x00(%[a_head]), %%xmm0")       /* xmm0 = ah */
+                __ASM_EMIT("movupd      0x00(%[b_head]), %%xmm1")       /* xmm1 = bh */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm2")                /* xmm2 = ah */
+                __ASM_EMIT("movupd      0x00(%[a_tail]), %%xmm3")       /* xmm3 = at */
+                __ASM_EMIT("movupd      0x00(%[b_tail]), %%xmm4")       /* xmm4 = bt */
+                __ASM_EMIT("movapd      %%xmm3, %%xmm5")                /* xmm5 = at */
+                __ASM_EMIT("mulpd       %%xmm1, %%xmm2")                /* xmm2 = ah*bh */
+                __ASM_EMIT("mulpd       %%xmm0, %%xmm0")                /* xmm0 = ah*ah */
+                __ASM_EMIT("mulpd       %%xmm1, %%xmm1")                /* xmm1 = bh*bh */
+                __ASM_EMIT("mulpd       %%xmm4, %%xmm5")                /* xmm5 = at*bt */
+                __ASM_EMIT("mulpd       %%xmm3, %%xmm3")                /* xmm3 = at*at */
+                __ASM_EMIT("mulpd       %%xmm4, %%xmm4")                /* xmm4 = bt*bt */
+                __ASM_EMIT("subpd       %%xmm3, %%xmm0")                /* xmm0 = DA = ah*ah - at*at */
+                __ASM_EMIT("subpd       %%xmm4, %%xmm1")                /* xmm1 = DB = bh*bh - bt*bt */
+                __ASM_EMIT("subpd       %%xmm5, %%xmm2")                /* xmm2 = DV = ah*bh - at*bt */
+
+                __ASM_EMIT("movapd      %%xmm0, %%xmm3")                /* xmm3 = DA[0] DA[1] */
+                __ASM_EMIT("movapd      %%xmm1, %%xmm4")                /* xmm4 = DB[0] DB[1] */
+                __ASM_EMIT("movapd      %%xmm2, %%xmm5")                /* xmm5 = DV[0] DV[1] */
+                __ASM_EMIT("pslldq      $8, %%xmm3")                    /* xmm3 = 0 DA[0] */
+                __ASM_EMIT("pslldq      $8, %%xmm4")                    /* xmm4 = 0 DB[0] */
+                __ASM_EMIT("pslldq      $8, %%xmm5")                    /* xmm5 = 0 DV[0] */
+                __ASM_EMIT("addpd       %%xmm0, %%xmm3")                /* xmm3 = DA[0] DA[0]+DA[1] */
+                __ASM_EMIT("addpd       %%xmm1, %%xmm4")                /* xmm4 = DB[0] DB[0]+DB[1] */
+                __ASM_EMIT("addpd       %%xmm2, %%xmm5")                /* xmm5 = DV[0] DV[0]+DV[1] */
+
+                __ASM_EMIT32("mov       %[corr], %[ptr]")
+                __ASM_EMIT32("movsd     0x00(%[ptr]), %%xmm0")
+                __ASM_EMIT32("movsd     0x08(%[ptr]), %%xmm1")
+                __ASM_EMIT32("movsd     0x10(%[ptr]), %%xmm2")
+                __ASM_EMIT64("movsd     0x00(%[corr]), %%xmm0")
+                __ASM_EMIT64("movsd     0x08(%[corr]), %%xmm1")
+                __ASM_EMIT64("movsd     0x10(%[corr]), %%xmm2")
+
+                __ASM_EMIT("unpcklpd    %%xmm0, %%xmm0")                /* xmm0 = xv xv */
+                __ASM_EMIT("unpcklpd    %%xmm1, %%xmm1")                /* xmm1 = xa xa */
+                __ASM_EMIT("unpcklpd    %%xmm2, %%xmm2")                /* xmm2 = xb xb */
+                __ASM_EMIT("addpd       %%xmm3, %%xmm1")                /* xmm1 = BA = xa+DA[0] xa+DA[0]+DA[1] */
+                __ASM_EMIT("addpd       %%xmm4, %%xmm2")                /* xmm2 = BB = xb+DB[0] xb+DB[0]+DB[1] */
+                __ASM_EMIT("movapd      %%xmm1, %%xmm6")                /* xmm6 = BA */
+                __ASM_EMIT("addpd       %%xmm5, %%xmm0")                /* xmm0 = T = xv+DV[0] xv+DV[0]+DV[1] */
+                __ASM_EMIT("mulpd       %%xmm2, %%xmm1")                /* xmm1 = B = BA*BB */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm5")                /* xmm5 = T */
+                __ASM_EMIT("unpckhpd    %%xmm6, %%xmm6")                /* xmm6 = BA[1] BA[1] */
+                __ASM_EMIT("unpckhpd    %%xmm5, %%xmm5")                /* xmm5 = T[1] T[1] */
+                __ASM_EMIT("unpckhpd    %%xmm2, %%xmm2")                /* xmm2 = BB[1] BB[1] */
+
+                __ASM_EMIT32("movsd     %%xmm5, 0x00(%[ptr])")
+                __ASM_EMIT32("movsd     %%xmm6, 0x08(%[ptr])")
+                __ASM_EMIT32("movsd     %%xmm2, 0x10(%[ptr])")
+                __ASM_EMIT64("movsd     %%xmm5, 0x00(%[corr])")
+                __ASM_EMIT64("movsd     %%xmm6, 0x08(%[corr])")
+                __ASM_EMIT64("movsd     %%xmm2, 0x10(%[corr])")
+
+                __ASM_EMIT("sqrtpd      %%xmm1, %%xmm7")                /* xmm7 = sqrt(B) */
+                __ASM_EMIT("cmppd       $5, %[CORR_CC], %%xmm1")        /* xmm1 = B >= threshold */
+                __ASM_EMIT("divpd       %%xmm7, %%xmm0")                /* xmm0 = T/sqrt(B) */
+                __ASM_EMIT32("mov       %[dst], %[ptr]")
+                __ASM_EMIT("andpd       %%xmm1, %%xmm0")                /* xmm0 = (B >= threshold) ? T/sqrt(B) : 0 */
+                __ASM_EMIT("add         $0x10, %[a_head]")              /* ++a_head */
+                __ASM_EMIT("add         $0x10, %[b_head]")              /* ++b_head */
+                __ASM_EMIT32("movupd    %%xmm0, 0x00(%[ptr])")
+                __ASM_EMIT64("movupd    %%xmm0, 0x00(%[dst])")
+                __ASM_EMIT("add         $0x10, %[a_tail]")              /* ++a_tail */
+                __ASM_EMIT("add         $0x10, %[b_tail]")              /* ++b_tail */
+                __ASM_EMIT32("add       $0x10, %[ptr]")
+                __ASM_EMIT64("add       $0x10, %[dst]")
+                __ASM_EMIT32("mov       %[ptr], %[dst]")
+                __ASM_EMIT32("subl      $2, %[count]")
+                __ASM_EMIT64("sub       $2, %[count]")
+                __ASM_EMIT("jae         1b")
+                __ASM_EMIT("2:")
+                /* 1x block */
+                __ASM_EMIT32("addl      $1, %[count]")
+                __ASM_EMIT64("add       $1, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movsd       0x00(%[a_head]), %%xmm0")       /* xmm0 = ah */
+                __ASM_EMIT("movsd       0x00(%[b_head]), %%xmm1")       /* xmm1 = bh */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm2")                /* xmm2 = ah */
+                __ASM_EMIT("movsd       0x00(%[a_tail]), %%xmm3")       /* xmm3 = at */
+                __ASM_EMIT("movsd       0x00(%[b_tail]), %%xmm4")       /* xmm4 = bt */
+                __ASM_EMIT("movapd      %%xmm3, %%xmm5")                /* xmm5 = at */
+                __ASM_EMIT("mulsd       %%xmm1, %%xmm2")                /* xmm2 = ah*bh */
+                __ASM_EMIT("mulsd       %%xmm0, %%xmm0")                /* xmm0 = ah*ah */
+                __ASM_EMIT("mulsd       %%xmm1, %%xmm1")                /* xmm1 = bh*bh */
+                __ASM_EMIT("mulsd       %%xmm4, %%xmm5")                /* xmm5 = at*bt */
+                __ASM_EMIT("mulsd       %%xmm3, %%xmm3")                /* xmm3 = at*at */
+                __ASM_EMIT("mulsd       %%xmm4, %%xmm4")                /* xmm4 = bt*bt */
+                __ASM_EMIT("subsd       %%xmm3, %%xmm0")                /* xmm0 = DA = ah*ah - at*at */
+                __ASM_EMIT("subsd       %%xmm4, %%xmm1")                /* xmm1 = DB = bh*bh - bt*bt */
+                __ASM_EMIT("subsd       %%xmm5, %%xmm2")                /* xmm2 = DV = ah*bh - at*bt */
+
+                __ASM_EMIT32("mov       %[corr], %[ptr]")
+                __ASM_EMIT32("movsd     0x00(%[ptr]), %%xmm3")
+                __ASM_EMIT32("movsd     0x08(%[ptr]), %%xmm4")
+                __ASM_EMIT32("movsd     0x10(%[ptr]), %%xmm5")
+                __ASM_EMIT64("movsd     0x00(%[corr]), %%xmm3")
+                __ASM_EMIT64("movsd     0x08(%[corr]), %%xmm4")
+                __ASM_EMIT64("movsd     0x10(%[corr]), %%xmm5")
+
+                __ASM_EMIT("addsd       %%xmm4, %%xmm0")                /* xmm0 = BA = xa+DA */
+                __ASM_EMIT("addsd       %%xmm3, %%xmm2")                /* xmm2 = T = xv+DV */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm3")                /* xmm3 = BA */
+                __ASM_EMIT("addsd       %%xmm5, %%xmm1")                /* xmm1 = BB = xb+DB */
+                __ASM_EMIT("mulsd       %%xmm1, %%xmm3")                /* xmm3 = B = BA*BB */
+
+                __ASM_EMIT32("movsd     %%xmm2, 0x00(%[ptr])")
+                __ASM_EMIT32("movsd     %%xmm0, 0x08(%[ptr])")
+                __ASM_EMIT32("movsd     %%xmm1, 0x10(%[ptr])")
+                __ASM_EMIT64("movsd     %%xmm2, 0x00(%[corr])")
+                __ASM_EMIT64("movsd     %%xmm0, 0x08(%[corr])")
+                __ASM_EMIT64("movsd     %%xmm1, 0x10(%[corr])")
+
+                __ASM_EMIT("sqrtsd      %%xmm3, %%xmm7")                /* xmm7 = sqrt(B) */
+                __ASM_EMIT("cmpsd       $5, %[CORR_CC], %%xmm3")        /* xmm3 = B >= threshold */
+                __ASM_EMIT("divsd       %%xmm7, %%xmm2")                /* xmm2 = T/sqrt(B) */
+                __ASM_EMIT32("mov       %[dst], %[ptr]")
+                __ASM_EMIT("andpd       %%xmm3, %%xmm2")                /* xmm2 = (B >= threshold) ? T/sqrt(B) : 0 */
+                __ASM_EMIT32("movsd     %%xmm2, 0x00(%[ptr])")
+                __ASM_EMIT64("movsd     %%xmm2, 0x00(%[dst])")
+                __ASM_EMIT("4:")
+
+                : __IF_32(
+                    [ptr] "=&r" (ptr),
+                    [corr] "+m" (corr), [dst] "+m" (dst),
+                    [a_head] "+r" (a_head), [b_head] "+r" (b_head),
+                    [a_tail] "+r" (a_tail), [b_tail] "+r" (b_tail),
+                    [count] "+m" (count)
+                  )
+                  __IF_64(
+                    [dst] "+r" (dst),
+                    [a_head] "+r" (a_head), [b_head] "+r" (b_head),
+                    [a_tail] "+r" (a_tail), [b_tail] "+r" (b_tail),
+                    [count] "+r" (count)
+                  )
+                : __IF_64( [corr] "r" (corr), )
+                  [CORR_CC] "o" (corr_f64_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_CORRELATION_H_ */
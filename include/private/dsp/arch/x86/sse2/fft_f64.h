@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_FFT_F64_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_FFT_F64_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        // Maximum number of twiddle factor rotations before computing it from the exact value
+        static constexpr size_t FFT_F64_RESEED      = 0x100;
+
+        // Rotation step of twiddle factors for the butterfly of size N: cos(pi/N), sin(pi/N)
+        static const double XFFT_F64_DW[] __lsp_aligned16 =
+        {
+            -1.0, 0.0,                                     // N = 2^0
+            0.0, 1.0,                                      // N = 2^1
+            0.7071067811865476, 0.7071067811865476,        // N = 2^2
+            0.9238795325112867, 0.3826834323650898,        // N = 2^3
+            0.9807852804032304, 0.19509032201612828,       // N = 2^4
+            0.9951847266721969, 0.0980171403295606,        // N = 2^5
+            0.9987954562051724, 0.049067674327418015,      // N = 2^6
+            0.9996988186962042, 0.024541228522912288,      // N = 2^7
+            0.9999247018391445, 0.012271538285719925,      // N = 2^8
+            0.9999811752826011, 0.006135884649154475,      // N = 2^9
+            0.9999952938095762, 0.003067956762965976,      // N = 2^10
+            0.9999988234517019, 0.0015339801862847657,     // N = 2^11
+            0.9999997058628822, 0.0007669903187427045,     // N = 2^12
+            0.9999999264657179, 0.00038349518757139556,    // N = 2^13
+            0.9999999816164293, 0.00019174759731070332,    // N = 2^14
+            0.9999999954041073, 9.587379909597734e-05,     // N = 2^15
+            0.9999999988510269, 4.793689960306688e-05,     // N = 2^16
+            0.9999999997127567, 2.396844980841822e-05,     // N = 2^17
+            0.9999999999281892, 1.1984224905069707e-05,    // N = 2^18
+            0.9999999999820472, 5.9921124526424275e-06,    // N = 2^19
+            0.9999999999955118, 2.996056226334661e-06,     // N = 2^20
+            0.999999999998878, 1.4980281131690111e-06,     // N = 2^21
+            0.9999999999997194, 7.490140565847157e-07,     // N = 2^22
+            0.9999999999999298, 3.7450702829238413e-07,    // N = 2^23
+            0.9999999999999825, 1.8725351414619535e-07,    // N = 2^24
+            0.9999999999999957, 9.362675707309808e-08,     // N = 2^25
+            0.9999999999999989, 4.6813378536549095e-08,    // N = 2^26
+            0.9999999999999998, 2.3406689268274554e-08,    // N = 2^27
+            0.9999999999999999, 1.1703344634137277e-08,    // N = 2^28
+            1.0, 5.8516723170686385e-09,                   // N = 2^29
+            1.0, 2.9258361585343192e-09,                   // N = 2^30
+            1.0, 1.4629180792671596e-09,                   // N = 2^31
+        };
+
+        static void scramble_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            size_t items    = size_t(1) << rank;
+
+            if ((dst_re == src_re) || (dst_im == src_im))
+            {
+                // First copy data, then swap elements at bit-reversed positions
+                if (dst_re != src_re)
+                    ::memmove(dst_re, src_re, items * sizeof(double));
+                if (dst_im != src_im)
+                    ::memmove(dst_im, src_im, items * sizeof(double));
+
+                for (size_t i = 1; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    if (i >= j)
+                        continue;
+
+                    double re       = dst_re[i];
+                    double im       = dst_im[i];
+                    dst_re[i]       = dst_re[j];
+                    dst_im[i]       = dst_im[j];
+                    dst_re[j]       = re;
+                    dst_im[j]       = im;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < items; ++i)
+                {
+                    size_t j        = reverse_bits(uint32_t(i), rank);
+                    dst_re[i]       = src_re[j];
+                    dst_im[i]       = src_im[j];
+                }
+            }
+        }
+
+        static void butterfly_fft_f64(double *dst_re, double *dst_im, size_t rank, double dir)
+        {
+            size_t items    = size_t(1) << rank;
+            size_t count    = items;
+            double *re      = dst_re;
+            double *im      = dst_im;
+            double w[8] __lsp_aligned16;
+
+            // First stage: butterflies of size 2, two pairs per iteration
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movupd      0x00(%[re]), %%xmm0")               /* xmm0 = r0 r1 */
+                __ASM_EMIT("movupd      0x10(%[re]), %%xmm2")               /* xmm2 = r2 r3 */
+                __ASM_EMIT("movupd      0x00(%[im]), %%xmm4")               /* xmm4 = i0 i1 */
+                __ASM_EMIT("movupd      0x10(%[im]), %%xmm6")               /* xmm6 = i2 i3 */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm1")                    /* xmm1 = r0 r1 */
+                __ASM_EMIT("movapd      %%xmm4, %%xmm5")                    /* xmm5 = i0 i1 */
+                __ASM_EMIT("unpcklpd    %%xmm2, %%xmm0")                    /* xmm0 = r0 r2 */
+                __ASM_EMIT("unpckhpd    %%xmm2, %%xmm1")                    /* xmm1 = r1 r3 */
+                __ASM_EMIT("unpcklpd    %%xmm6, %%xmm4")                    /* xmm4 = i0 i2 */
+                __ASM_EMIT("unpckhpd    %%xmm6, %%xmm5")                    /* xmm5 = i1 i3 */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm2")                    /* xmm2 = r0 r2 */
+                __ASM_EMIT("movapd      %%xmm4, %%xmm6")                    /* xmm6 = i0 i2 */
+                __ASM_EMIT("addpd       %%xmm1, %%xmm0")                    /* xmm0 = r0+r1 r2+r3 */
+                __ASM_EMIT("subpd       %%xmm1, %%xmm2")                    /* xmm2 = r0-r1 r2-r3 */
+                __ASM_EMIT("addpd       %%xmm5, %%xmm4")                    /* xmm4 = i0+i1 i2+i3 */
+                __ASM_EMIT("subpd       %%xmm5, %%xmm6")                    /* xmm6 = i0-i1 i2-i3 */
+                __ASM_EMIT("movapd      %%xmm0, %%xmm1")                    /* xmm1 = r0+r1 r2+r3 */
+                __ASM_EMIT("movapd      %%xmm4, %%xmm5")                    /* xmm5 = i0+i1 i2+i3 */
+                __ASM_EMIT("unpcklpd    %%xmm2, %%xmm0")                    /* xmm0 = r0+r1 r0-r1 */
+                __ASM_EMIT("unpckhpd    %%xmm2, %%xmm1")                    /* xmm1 = r2+r3 r2-r3 */
+                __ASM_EMIT("unpcklpd    %%xmm6, %%xmm4")                    /* xmm4 = i0+i1 i0-i1 */
+                __ASM_EMIT("unpckhpd    %%xmm6, %%xmm5")                    /* xmm5 = i2+i3 i2-i3 */
+                __ASM_EMIT("movupd      %%xmm0, 0x00(%[re])")
+                __ASM_EMIT("movupd      %%xmm1, 0x10(%[re])")
+                __ASM_EMIT("movupd      %%xmm4, 0x00(%[im])")
+                __ASM_EMIT("movupd      %%xmm5, 0x10(%[im])")
+                __ASM_EMIT("add         $0x20, %[re]")
+                __ASM_EMIT("add         $0x20, %[im]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [re] "+r" (re), [im] "+r" (im), [count] "+r" (count)
+                :
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            // Next stages: two butterflies per iteration
+            for (size_t k = 1; k < rank; ++k)
+            {
+                size_t n        = size_t(1) << k;
+
+                // Rotation step for two butterflies
+                w[4]            = XFFT_F64_DW[k*2 - 2];
+                w[5]            = w[4];
+                w[6]            = dir * XFFT_F64_DW[k*2 - 1];
+                w[7]            = w[6];
+
+                // Twiddle factors are rotated at most FFT_F64_RESEED times and then computed from exact value,
+                // so the rounding error does not grow with the size of the butterfly
+                for (size_t j0 = 0; j0 < n; j0 += FFT_F64_RESEED)
+                {
+                    size_t len      = lsp_min(n - j0, FFT_F64_RESEED);
+                    size_t skip     = ((n << 1) - len) * sizeof(double);
+                    size_t blocks   = items >> (k + 1);
+
+                    // Twiddle factors for j = j0, j0 + 1
+                    for (size_t j=0; j<2; ++j)
+                    {
+                        double angle    = (M_PI * double(j0 + j)) / double(n);
+                        w[j]            = cos(angle);
+                        w[j + 2]        = dir * sin(angle);
+                    }
+                    re              = &dst_re[j0];
+                    im              = &dst_im[j0];
+
+                    ARCH_X86_ASM
+                    (
+                        __ASM_EMIT("1:")
+                        __ASM_EMIT("movapd      0x00(%[w]), %%xmm6")                /* xmm6 = wr */
+                        __ASM_EMIT("movapd      0x10(%[w]), %%xmm7")                /* xmm7 = wi */
+                        __ASM_EMIT("mov         %[len], %[count]")                  /* count = len */
+                        __ASM_EMIT("2:")
+                        __ASM_EMIT("movupd      0x00(%[re], %[n], 8), %%xmm0")      /* xmm0 = br */
+                        __ASM_EMIT("movupd      0x00(%[im], %[n], 8), %%xmm1")      /* xmm1 = bi */
+                        __ASM_EMIT("movapd      %%xmm0, %%xmm2")                    /* xmm2 = br */
+                        __ASM_EMIT("movapd      %%xmm1, %%xmm3")                    /* xmm3 = bi */
+                        __ASM_EMIT("mulpd       %%xmm6, %%xmm0")                    /* xmm0 = wr*br */
+                        __ASM_EMIT("mulpd       %%xmm7, %%xmm3")                    /* xmm3 = wi*bi */
+                        __ASM_EMIT("mulpd       %%xmm6, %%xmm1")                    /* xmm1 = wr*bi */
+                        __ASM_EMIT("mulpd       %%xmm7, %%xmm2")                    /* xmm2 = wi*br */
+                        __ASM_EMIT("subpd       %%xmm3, %%xmm0")                    /* xmm0 = cr = wr*br - wi*bi */
+                        __ASM_EMIT("addpd       %%xmm2, %%xmm1")                    /* xmm1 = ci = wr*bi + wi*br */
+                        __ASM_EMIT("movupd      0x00(%[re]), %%xmm4")               /* xmm4 = ar */
+                        __ASM_EMIT("movupd      0x00(%[im]), %%xmm5")               /* xmm5 = ai */
+                        __ASM_EMIT("movapd      %%xmm4, %%xmm2")                    /* xmm2 = ar */
+                        __ASM_EMIT("movapd      %%xmm5, %%xmm3")                    /* xmm3 = ai */
+                        __ASM_EMIT("addpd       %%xmm0, %%xmm4")                    /* xmm4 = ar + cr */
+                        __ASM_EMIT("addpd       %%xmm1, %%xmm5")                    /* xmm5 = ai + ci */
+                        __ASM_EMIT("subpd       %%xmm0, %%xmm2")                    /* xmm2 = ar - cr */
+                        __ASM_EMIT("subpd       %%xmm1, %%xmm3")                    /* xmm3 = ai - ci */
+                        __ASM_EMIT("movupd      %%xmm4, 0x00(%[re])")
+                        __ASM_EMIT("movupd      %%xmm5, 0x00(%[im])")
+                        __ASM_EMIT("movupd      %%xmm2, 0x00(%[re], %[n], 8)")
+                        __ASM_EMIT("movupd      %%xmm3, 0x00(%[im], %[n], 8)")
+                        /* Rotate twiddle factors */
+                        __ASM_EMIT("movapd      %%xmm6, %%xmm0")                    /* xmm0 = wr */
+                        __ASM_EMIT("movapd      %%xmm7, %%xmm1")                    /* xmm1 = wi */
+                        __ASM_EMIT("mulpd       0x20(%[w]), %%xmm6")                /* xmm6 = wr*dr */
+                        __ASM_EMIT("mulpd       0x30(%[w]), %%xmm1")                /* xmm1 = wi*di */
+                        __ASM_EMIT("mulpd       0x30(%[w]), %%xmm0")                /* xmm0 = wr*di */
+                        __ASM_EMIT("mulpd       0x20(%[w]), %%xmm7")                /* xmm7 = wi*dr */
+                        __ASM_EMIT("subpd       %%xmm1, %%xmm6")                    /* xmm6 = wr*dr - wi*di */
+                        __ASM_EMIT("addpd       %%xmm0, %%xmm7")                    /* xmm7 = wr*di + wi*dr */
+                        __ASM_EMIT("add         $0x10, %[re]")
+                        __ASM_EMIT("add         $0x10, %[im]")
+                        __ASM_EMIT("sub         $2, %[count]")
+                        __ASM_EMIT("jnz         2b")
+                        /* Move to the same butterflies of the next block */
+                        __ASM_EMIT("add         %[skip], %[re]")
+                        __ASM_EMIT("add         %[skip], %[im]")
+                        __ASM_EMIT("dec         %[blocks]")
+                        __ASM_EMIT("jnz         1b")
+
+                        : [re] "+r" (re), [im] "+r" (im),
+                          [count] "=&r" (count), [blocks] "+rm" (blocks)
+                        : [n] "r" (n), [w] "r" (w),
+                          [len] "rm" (len), [skip] "rm" (skip)
+                        : "cc", "memory",
+                          "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                          "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+                    );
+                }
+            }
+        }
+
+        static void small_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank <= 0)
+            {
+                dst_re[0]       = src_re[0];
+                dst_im[0]       = src_im[0];
+                return;
+            }
+
+            double r0 = src_re[0], r1 = src_re[1];
+            double i0 = src_im[0], i1 = src_im[1];
+            dst_re[0]       = r0 + r1;
+            dst_re[1]       = r0 - r1;
+            dst_im[0]       = i0 + i1;
+            dst_im[1]       = i0 - i1;
+        }
+
+        void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, -1.0);
+        }
+
+        void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank)
+        {
+            if (rank < 2)
+            {
+                small_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+                if (rank > 0)
+                {
+                    dst_re[0]      *= 0.5;
+                    dst_re[1]      *= 0.5;
+                    dst_im[0]      *= 0.5;
+                    dst_im[1]      *= 0.5;
+                }
+                return;
+            }
+
+            scramble_fft_f64(dst_re, dst_im, src_re, src_im, rank);
+            butterfly_fft_f64(dst_re, dst_im, rank, 1.0);
+
+            // Normalize the result
+            size_t count    = size_t(1) << rank;
+            double k[2] __lsp_aligned16;
+            k[0]            = 1.0 / double(count);
+            k[1]            = k[0];
+
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("movapd      %[k], %%xmm0")
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movupd      0x00(%[re]), %%xmm1")
+                __ASM_EMIT("movupd      0x10(%[re]), %%xmm2")
+                __ASM_EMIT("movupd      0x00(%[im]), %%xmm3")
+                __ASM_EMIT("movupd      0x10(%[im]), %%xmm4")
+                __ASM_EMIT("mulpd       %%xmm0, %%xmm1")
+                __ASM_EMIT("mulpd       %%xmm0, %%xmm2")
+                __ASM_EMIT("mulpd       %%xmm0, %%xmm3")
+                __ASM_EMIT("mulpd       %%xmm0, %%xmm4")
+                __ASM_EMIT("movupd      %%xmm1, 0x00(%[re])")
+                __ASM_EMIT("movupd      %%xmm2, 0x10(%[re])")
+                __ASM_EMIT("movupd      %%xmm3, 0x00(%[im])")
+                __ASM_EMIT("movupd      %%xmm4, 0x10(%[im])")
+                __ASM_EMIT("add         $0x20, %[re]")
+                __ASM_EMIT("add         $0x20, %[im]")
+                __ASM_EMIT("sub         $4, %[count]")
+                __ASM_EMIT("jnz         1b")
+
+                : [re] "+r" (dst_re), [im] "+r" (dst_im), [count] "+r" (count)
+                : [k] "m" (k)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4"
+            );
+        }
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_FFT_F64_H_ */
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_STATIC_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_STATIC_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+    /*
+     * Scalar step of one filter: xmm0 = s, xmm1 = s' on output.
+     * Arguments are the string offsets of coefficients and of the d0/d1 memory cells.
+     */
+    #define BIQUAD_F64_X1_STEP(B0, B1, B2, A1, A2, D0, D1) \
+        __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B0 "(%[f]), %%xmm1")    /* xmm1 = b0 */ \
+        __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B1 "(%[f]), %%xmm2")    /* xmm2 = b1 */ \
+        __ASM_EMIT("mulsd       %%xmm0, %%xmm1")                                /* xmm1 = b0*s */ \
+        __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B2 "(%[f]), %%xmm3")    /* xmm3 = b2 */ \
+        __ASM_EMIT("mulsd       %%xmm0, %%xmm2")                                /* xmm2 = b1*s */ \
+        __ASM_EMIT("addsd       " D0 "(%[f]), %%xmm1")                          /* xmm1 = s' = b0*s + d0 */ \
+        __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A1 "(%[f]), %%xmm4")    /* xmm4 = a1 */ \
+        __ASM_EMIT("mulsd       %%xmm0, %%xmm3")                                /* xmm3 = b2*s */ \
+        __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A2 "(%[f]), %%xmm5")    /* xmm5 = a2 */ \
+        __ASM_EMIT("mulsd       %%xmm1, %%xmm4")                                /* xmm4 = a1*s' */ \
+        __ASM_EMIT("mulsd       %%xmm1, %%xmm5")                                /* xmm5 = a2*s' */ \
+        __ASM_EMIT("addsd       %%xmm4, %%xmm2")                                /* xmm2 = b1*s + a1*s' */ \
+        __ASM_EMIT("addsd       %%xmm5, %%xmm3")                                /* xmm3 = d1' = b2*s + a2*s' */ \
+        __ASM_EMIT("addsd       " D1 "(%[f]), %%xmm2")                          /* xmm2 = d0' = d1 + b1*s + a1*s' */ \
+        __ASM_EMIT("movsd       %%xmm2, " D0 "(%[f])") \
+        __ASM_EMIT("movsd       %%xmm3, " D1 "(%[f])")
+
+    /*
+     * One pass of two cascaded filters processed as a pipeline: the first filter
+     * of the pair gets the input sample, the second one gets the delayed output
+     * of the first filter. The state of the pair is kept in xmm6 (d0) and xmm7 (d1).
+     */
+    #define BIQUAD_F64_X2_PASS(B0, B1, B2, A1, A2, D0, D1, B0H, B1H, B2H, A1H, A2H, D0H, D1H) \
+        /* First filter only */ \
+        __ASM_EMIT("movsd       0x00(%[src]), %%xmm0")                          /* xmm0 = s */ \
+        BIQUAD_F64_X1_STEP(B0, B1, B2, A1, A2, D0, D1) \
+        __ASM_EMIT("add         $0x08, %[src]")                                 /* ++src */ \
+        __ASM_EMIT("dec         %[count]") \
+        __ASM_EMIT("jz          2f") \
+        /* Both filters */ \
+        __ASM_EMIT("movapd      " D0 "(%[f]), %%xmm6")                          /* xmm6 = d0 e0 */ \
+        __ASM_EMIT("movapd      " D1 "(%[f]), %%xmm7")                          /* xmm7 = d1 e1 */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("movapd      %%xmm1, %%xmm0")                                /* xmm0 = r ? */ \
+        __ASM_EMIT("unpcklpd    %%xmm0, %%xmm0")                                /* xmm0 = r r */ \
+        __ASM_EMIT("movlpd      0x00(%[src]), %%xmm0")                          /* xmm0 = s r */ \
+        __ASM_EMIT("movapd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B0 "(%[f]), %%xmm1")    /* xmm1 = b0 */ \
+        __ASM_EMIT("movapd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B1 "(%[f]), %%xmm2")    /* xmm2 = b1 */ \
+        __ASM_EMIT("mulpd       %%xmm0, %%xmm1")                                /* xmm1 = b0*s */ \
+        __ASM_EMIT("movapd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " B2 "(%[f]), %%xmm3")    /* xmm3 = b2 */ \
+        __ASM_EMIT("mulpd       %%xmm0, %%xmm2")                                /* xmm2 = b1*s */ \
+        __ASM_EMIT("addpd       %%xmm6, %%xmm1")                                /* xmm1 = s' = b0*s + d0 */ \
+        __ASM_EMIT("movapd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A1 "(%[f]), %%xmm4")    /* xmm4 = a1 */ \
+        __ASM_EMIT("mulpd       %%xmm0, %%xmm3")                                /* xmm3 = b2*s */ \
+        __ASM_EMIT("movapd      " LSP_DSP_BIQUAD_F64_XN_SOFF " + " A2 "(%[f]), %%xmm5")    /* xmm5 = a2 */ \
+        __ASM_EMIT("mulpd       %%xmm1, %%xmm4")                                /* xmm4 = a1*s' */ \
+        __ASM_EMIT("mulpd       %%xmm1, %%xmm5")                                /* xmm5 = a2*s' */ \
+        __ASM_EMIT("addpd       %%xmm4, %%xmm2")                                /* xmm2 = b1*s + a1*s' */ \
+        __ASM_EMIT("addpd       %%xmm5, %%xmm3")                                /* xmm3 = b2*s + a2*s' */ \
+        __ASM_EMIT("movapd      %%xmm7, %%xmm6")                                /* xmm6 = d1 */ \
+        __ASM_EMIT("movapd      %%xmm3, %%xmm7")                                /* xmm7 = d1' = b2*s + a2*s' */ \
+        __ASM_EMIT("addpd       %%xmm2, %%xmm6")                                /* xmm6 = d0' = d1 + b1*s + a1*s' */ \
+        __ASM_EMIT("movhpd      %%xmm1, 0x00(%[dst])")                          /* *dst = r' */ \
+        __ASM_EMIT("add         $0x08, %[src]")                                 /* ++src */ \
+        __ASM_EMIT("add         $0x08, %[dst]")                                 /* ++dst */ \
+        __ASM_EMIT("dec         %[count]") \
+        __ASM_EMIT("jnz         1b") \
+        __ASM_EMIT("movapd      %%xmm6, " D0 "(%[f])") \
+        __ASM_EMIT("movapd      %%xmm7, " D1 "(%[f])") \
+        /* Second filter only */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("movapd      %%xmm1, %%xmm0")                                /* xmm0 = r */ \
+        BIQUAD_F64_X1_STEP(B0H, B1H, B2H, A1H, A2H, D0H, D1H) \
+        __ASM_EMIT("movsd       %%xmm1, 0x00(%[dst])")                          /* *dst = r' */ \
+        __ASM_EMIT("add         $0x08, %[dst]")                                 /* ++dst */
+
+        void biquad_process_x1_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            IF_ARCH_X86(size_t off);
+
+            ARCH_X86_ASM
+            (
+                // Check count
+                __ASM_EMIT("test        %[count], %[count]")
+                __ASM_EMIT("jz          2f")
+
+                // Load permanent data
+                __ASM_EMIT("movsd       0x00(%[f]), %%xmm6")                            // xmm6 = d0
+                __ASM_EMIT("xor         %[off], %[off]")
+                __ASM_EMIT("movsd       0x08(%[f]), %%xmm7")                            // xmm7 = d1
+
+                // Start loop
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movsd       (%[src], %[off], 8), %%xmm0")                   // xmm0 = s
+                __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + 0x00(%[f]), %%xmm1")   // xmm1 = b0
+                __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + 0x08(%[f]), %%xmm2")   // xmm2 = b1
+                __ASM_EMIT("mulsd       %%xmm0, %%xmm1")                                // xmm1 = b0*s
+                __ASM_EMIT("movsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + 0x18(%[f]), %%xmm3")   // xmm3 = a1
+                __ASM_EMIT("mulsd       %%xmm0, %%xmm2")                                // xmm2 = b1*s
+                __ASM_EMIT("addsd       %%xmm6, %%xmm1")                                // xmm1 = s' = b0*s + d0
+                __ASM_EMIT("mulsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + 0x10(%[f]), %%xmm0")   // xmm0 = b2*s
+                __ASM_EMIT("movsd       %%xmm1, (%[dst], %[off], 8)")                   // *dst = s'
+                __ASM_EMIT("movapd      %%xmm7, %%xmm6")                                // xmm6 = d1
+                __ASM_EMIT("mulsd       %%xmm1, %%xmm3")                                // xmm3 = a1*s'
+                __ASM_EMIT("add         $1, %[off]")
+                __ASM_EMIT("mulsd       " LSP_DSP_BIQUAD_F64_XN_SOFF " + 0x20(%[f]), %%xmm1")   // xmm1 = a2*s'
+                __ASM_EMIT("addsd       %%xmm3, %%xmm2")                                // xmm2 = b1*s + a1*s'
+                __ASM_EMIT("addsd       %%xmm0, %%xmm1")                                // xmm1 = d1' = b2*s + a2*s'
+                __ASM_EMIT("cmp         %[count], %[off]")
+                __ASM_EMIT("addsd       %%xmm2, %%xmm6")                                // xmm6 = d0' = d1 + b1*s + a1*s'
+                __ASM_EMIT("movapd      %%xmm1, %%xmm7")                                // xmm7 = d1'
+                __ASM_EMIT("jb          1b")
+
+                // Store the updated buffer state
+                __ASM_EMIT("movsd       %%xmm6, 0x00(%[f])")
+                __ASM_EMIT("movsd       %%xmm7, 0x08(%[f])")
+
+                // Exit label
+                __ASM_EMIT("2:")
+
+                : [off] "=&r"(off)
+                : [dst] "r" (dst), [src] "r" (src),
+                  [count] "r" (count),
+                  [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm6", "%xmm7"
+            );
+        }
+
+        void biquad_process_x2_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            ARCH_X86_ASM
+            (
+                BIQUAD_F64_X2_PASS(
+                    "0x00", "0x10", "0x20", "0x30", "0x40", "0x00", "0x10",
+                    "0x08", "0x18", "0x28", "0x38", "0x48", "0x08", "0x18")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        /*
+         * The x4 and x8 banks are cascades, so they are computed as sequential
+         * passes of the x2 pipeline, the first pass reads the source buffer and
+         * all next passes process the destination buffer in-place.
+         */
+        void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            double *dp      = dst;
+            size_t n        = count;
+
+            ARCH_X86_ASM
+            (
+                BIQUAD_F64_X2_PASS(
+                    "0x00", "0x20", "0x40", "0x60", "0x80", "0x00", "0x20",
+                    "0x08", "0x28", "0x48", "0x68", "0x88", "0x08", "0x28")
+
+                : [dst] "+r" (dp), [src] "+r" (src), [count] "+r" (n)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            src             = dst;
+            ARCH_X86_ASM
+            (
+                BIQUAD_F64_X2_PASS(
+                    "0x10", "0x30", "0x50", "0x70", "0x90", "0x10", "0x30",
+                    "0x18", "0x38", "0x58", "0x78", "0x98", "0x18", "0x38")
+
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [f] "r" (f)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+        }
+
+        void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f)
+        {
+            if (count <= 0)
+                return;
+
+            double *dp;
+            size_t n;
+
+            #define BIQUAD_F64_X8_PASS(S, B0, B1, B2, A1, A2, D0, D1, B0H, B1H, B2H, A1H, A2H, D0H, D1H) \
+                dp              = dst; \
+                n               = count; \
+                ARCH_X86_ASM \
+                ( \
+                    BIQUAD_F64_X2_PASS(B0, B1, B2, A1, A2, D0, D1, B0H, B1H, B2H, A1H, A2H, D0H, D1H) \
+                    : [dst] "+r" (dp), [src] "+r" (S), [count] "+r" (n) \
+                    : [f] "r" (f) \
+                    : "cc", "memory", \
+                      "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+                      "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+                );
+
+            const double *sp = dst;
+
+            BIQUAD_F64_X8_PASS(src,
+                "0x00", "0x40", "0x80", "0xc0", "0x100", "0x00", "0x40",
+                "0x08", "0x48", "0x88", "0xc8", "0x108", "0x08", "0x48")
+            BIQUAD_F64_X8_PASS(sp,
+                "0x10", "0x50", "0x90", "0xd0", "0x110", "0x10", "0x50",
+                "0x18", "0x58", "0x98", "0xd8", "0x118", "0x18", "0x58")
+            sp              = dst;
+            BIQUAD_F64_X8_PASS(sp,
+                "0x20", "0x60", "0xa0", "0xe0", "0x120", "0x20", "0x60",
+                "0x28", "0x68", "0xa8", "0xe8", "0x128", "0x28", "0x68")
+            sp              = dst;
+            BIQUAD_F64_X8_PASS(sp,
+                "0x30", "0x70", "0xb0", "0xf0", "0x130", "0x30", "0x70",
+                "0x38", "0x78", "0xb8", "0xf8", "0x138", "0x38", "0x78")
+
+            #undef BIQUAD_F64_X8_PASS
+        }
+
+    #undef BIQUAD_F64_X2_PASS
+    #undef BIQUAD_F64_X1_STEP
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_FILTERS_STATIC_H_ */
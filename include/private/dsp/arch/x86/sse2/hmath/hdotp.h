@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_HMATH_HDOTP_H_
+#define PRIVATE_DSP_ARCH_X86_SSE2_HMATH_HDOTP_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_IMPL */
+
+namespace lsp
+{
+    namespace sse2
+    {
+        double h_dotp_f64(const double *a, const double *b, size_t count)
+        {
+            IF_ARCH_X86(double result);
+            ARCH_X86_ASM
+            (
+                __ASM_EMIT("xorpd       %%xmm0, %%xmm0")
+                __ASM_EMIT("xorpd       %%xmm1, %%xmm1")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jl          2f")
+
+                /* x8 Blocks */
+                __ASM_EMIT("1:")
+                __ASM_EMIT("movupd      0x00(%[a]), %%xmm2")
+                __ASM_EMIT("movupd      0x10(%[a]), %%xmm3")
+                __ASM_EMIT("movupd      0x20(%[a]), %%xmm4")
+                __ASM_EMIT("movupd      0x30(%[a]), %%xmm5")
+                __ASM_EMIT("movupd      0x00(%[b]), %%xmm6")
+                __ASM_EMIT("movupd      0x10(%[b]), %%xmm7")
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm2")
+                __ASM_EMIT("mulpd       %%xmm7, %%xmm3")
+                __ASM_EMIT("movupd      0x20(%[b]), %%xmm6")
+                __ASM_EMIT("movupd      0x30(%[b]), %%xmm7")
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm4")
+                __ASM_EMIT("mulpd       %%xmm7, %%xmm5")
+                __ASM_EMIT("addpd       %%xmm2, %%xmm0")
+                __ASM_EMIT("addpd       %%xmm3, %%xmm1")
+                __ASM_EMIT("addpd       %%xmm4, %%xmm0")
+                __ASM_EMIT("addpd       %%xmm5, %%xmm1")
+                __ASM_EMIT("add         $0x40, %[a]")
+                __ASM_EMIT("add         $0x40, %[b]")
+                __ASM_EMIT("sub         $8, %[count]")
+                __ASM_EMIT("jae         1b")
+                /* x4 Block */
+                __ASM_EMIT("2:")
+                __ASM_EMIT("add         $4, %[count]")
+                __ASM_EMIT("jl          4f")
+                __ASM_EMIT("movupd      0x00(%[a]), %%xmm2")
+                __ASM_EMIT("movupd      0x10(%[a]), %%xmm3")
+                __ASM_EMIT("movupd      0x00(%[b]), %%xmm6")
+                __ASM_EMIT("movupd      0x10(%[b]), %%xmm7")
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm2")
+                __ASM_EMIT("mulpd       %%xmm7, %%xmm3")
+                __ASM_EMIT("addpd       %%xmm2, %%xmm0")
+                __ASM_EMIT("addpd       %%xmm3, %%xmm1")
+                __ASM_EMIT("add         $0x20, %[a]")
+                __ASM_EMIT("add         $0x20, %[b]")
+                __ASM_EMIT("sub         $4, %[count]")
+                /* x2 Block */
+                __ASM_EMIT("4:")
+                __ASM_EMIT("add         $2, %[count]")
+                __ASM_EMIT("jl          6f")
+                __ASM_EMIT("movupd      0x00(%[a]), %%xmm2")
+                __ASM_EMIT("movupd      0x00(%[b]), %%xmm6")
+                __ASM_EMIT("mulpd       %%xmm6, %%xmm2")
+                __ASM_EMIT("addpd       %%xmm2, %%xmm0")
+                __ASM_EMIT("add         $0x10, %[a]")
+                __ASM_EMIT("add         $0x10, %[b]")
+                __ASM_EMIT("sub         $2, %[count]")
+                /* x1 Block */
+                __ASM_EMIT("6:")
+                __ASM_EMIT("addpd       %%xmm1, %%xmm0")
+                __ASM_EMIT("movapd      %%xmm0, %%xmm1")
+                __ASM_EMIT("unpckhpd    %%xmm1, %%xmm1")
+                __ASM_EMIT("addsd       %%xmm1, %%xmm0")
+                __ASM_EMIT("add         $1, %[count]")
+                __ASM_EMIT("jl          8f")
+                __ASM_EMIT("movsd       0x00(%[a]), %%xmm2")
+                __ASM_EMIT("mulsd       0x00(%[b]), %%xmm2")
+                __ASM_EMIT("addsd       %%xmm2, %%xmm0")
+                __ASM_EMIT("8:")
+
+                : [a] "+r" (a), [b] "+r" (b), [count] "+r" (count),
+                  "=Yz" (result)
+                :
+                : "cc", "memory",
+                  "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+            );
+
+            return result;
+        }
+    } /* namespace sse2 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE2_HMATH_HDOTP_H_ */
@@ -0,0 +1,583 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_DFT_H_
+#define PRIVATE_DSP_ARCH_X86_SSE3_DFT_H_
+
+#ifndef PRIVATE_DSP_ARCH_X86_SSE3_IMPL
+    #error "This header should not be included directly"
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_IMPL */
+
+#include <private/dsp/dft.h>
+
+namespace lsp
+{
+    namespace sse3
+    {
+        IF_ARCH_X86_64(
+            static const float dft_const[] __lsp_aligned16 =
+            {
+                0.0f, -0.0f, 0.0f, -0.0f,                   // Sign mask of imaginary parts
+                LSP_DSP_VEC4(-0.5000000000000000f),         // cos(2*pi/3)
+                LSP_DSP_VEC4(0.8660254037844386f),          // sin(2*pi/3)
+                LSP_DSP_VEC4(0.3090169943749474f),          // cos(2*pi/5)
+                LSP_DSP_VEC4(-0.8090169943749474f),         // cos(4*pi/5)
+                LSP_DSP_VEC4(0.9510565162951535f),          // sin(2*pi/5)
+                LSP_DSP_VEC4(0.5877852522924731f),          // sin(4*pi/5)
+                LSP_DSP_VEC4(0.6234898018587336f),          // cos(2*pi/7)
+                LSP_DSP_VEC4(-0.2225209339563144f),         // cos(4*pi/7)
+                LSP_DSP_VEC4(-0.9009688679024191f),         // cos(6*pi/7)
+                LSP_DSP_VEC4(0.7818314824680298f),          // sin(2*pi/7)
+                LSP_DSP_VEC4(0.9749279121818236f),          // sin(4*pi/7)
+                LSP_DSP_VEC4(0.4338837391175581f)           // sin(6*pi/7)
+            };
+        )
+
+    #define DFT_SIGN        "0x00(%[K])"
+    #define DFT_C3          "0x10(%[K])"
+    #define DFT_S3          "0x20(%[K])"
+    #define DFT_C5_1        "0x30(%[K])"
+    #define DFT_C5_2        "0x40(%[K])"
+    #define DFT_S5_1        "0x50(%[K])"
+    #define DFT_S5_2        "0x60(%[K])"
+    #define DFT_C7_1        "0x70(%[K])"
+    #define DFT_C7_2        "0x80(%[K])"
+    #define DFT_C7_3        "0x90(%[K])"
+    #define DFT_S7_1        "0xa0(%[K])"
+    #define DFT_S7_2        "0xb0(%[K])"
+    #define DFT_S7_3        "0xc0(%[K])"
+
+    /* Multiply X by the twiddle factor stored as { wr x4, wi x4 } at OFF(%[w]) */
+    #define DFT_TWIDDLE(X, T, OFF) \
+        __ASM_EMIT("movaps      %%" X ", %%" T) \
+        __ASM_EMIT("shufps      $0xb1, %%" T ", %%" T)              /* T    = ai ar */ \
+        __ASM_EMIT("mulps       " OFF "(%[w]), %%" X)               /* X    = ar*wr ai*wr */ \
+        __ASM_EMIT("mulps       " OFF "+0x10(%[w]), %%" T)          /* T    = ai*wi ar*wi */ \
+        __ASM_EMIT("addsubps    %%" T ", %%" X)                     /* X    = ar*wr-ai*wi ai*wr+ar*wi */
+
+    /* Multiply X by -i */
+    #define DFT_ROTATE(X) \
+        __ASM_EMIT("shufps      $0xb1, %%" X ", %%" X)              /* X    = ai ar */ \
+        __ASM_EMIT("xorps       " DFT_SIGN ", %%" X)                /* X    = ai -ar */
+
+    /* Butterfly loop: two complex numbers per iteration and one complex number as a tail */
+    #define DFT_BUTTERFLY_LOOP(BODY, ADVANCE) \
+        __ASM_EMIT("sub         $2, %[count]") \
+        __ASM_EMIT("jb          2f") \
+        __ASM_EMIT("1:") \
+        BODY("movups") \
+        ADVANCE \
+        __ASM_EMIT("sub         $2, %[count]") \
+        __ASM_EMIT("jae         1b") \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add         $1, %[count]") \
+        __ASM_EMIT("jl          4f") \
+        BODY("movlps") \
+        __ASM_EMIT("4:")
+
+    #define DFT_ADVANCE \
+        __ASM_EMIT("add         $0x10, %[src]") \
+        __ASM_EMIT("add         $0x10, %[dst]")
+
+    #define DFT_ADVANCE4 \
+        __ASM_EMIT("add         $0x10, %[src]") \
+        __ASM_EMIT("add         $0x10, %[dst]") \
+        __ASM_EMIT("add         $0x10, %[s4]") \
+        __ASM_EMIT("add         $0x10, %[d4]")
+
+    #define DFT_BUTTERFLY2_BODY(MV) \
+        __ASM_EMIT(MV "      0x00(%[src]), %%xmm0")                 /* xmm0 = a0 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is]), %%xmm1")          /* xmm1 = s1 */ \
+        DFT_TWIDDLE("xmm1", "xmm2", "0x00")                         /* xmm1 = a1 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+        __ASM_EMIT("addps       %%xmm1, %%xmm0")                    /* xmm0 = a0 + a1 */ \
+        __ASM_EMIT("subps       %%xmm1, %%xmm2")                    /* xmm2 = a0 - a1 */ \
+        __ASM_EMIT(MV "      %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT(MV "      %%xmm2, 0x00(%[dst], %[os])")
+
+    #define DFT_BUTTERFLY3_BODY(MV) \
+        __ASM_EMIT(MV "      0x00(%[src]), %%xmm0")                 /* xmm0 = a0 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is]), %%xmm1")          /* xmm1 = s1 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is], 2), %%xmm2")       /* xmm2 = s2 */ \
+        DFT_TWIDDLE("xmm1", "xmm3", "0x00")                         /* xmm1 = a1 */ \
+        DFT_TWIDDLE("xmm2", "xmm4", "0x20")                         /* xmm2 = a2 */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm3") \
+        __ASM_EMIT("addps       %%xmm2, %%xmm3")                    /* xmm3 = t1 = a1 + a2 */ \
+        __ASM_EMIT("subps       %%xmm2, %%xmm1")                    /* xmm1 = t2 = a1 - a2 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+        __ASM_EMIT("addps       %%xmm3, %%xmm2")                    /* xmm2 = d0 = a0 + t1 */ \
+        __ASM_EMIT("mulps       " DFT_C3 ", %%xmm3") \
+        __ASM_EMIT("addps       %%xmm3, %%xmm0")                    /* xmm0 = m = a0 + t1*c */ \
+        __ASM_EMIT("mulps       " DFT_S3 ", %%xmm1")                /* xmm1 = n = t2*s */ \
+        DFT_ROTATE("xmm1")                                          /* xmm1 = -i*n */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm3") \
+        __ASM_EMIT("addps       %%xmm1, %%xmm0")                    /* xmm0 = d1 = m - i*n */ \
+        __ASM_EMIT("subps       %%xmm1, %%xmm3")                    /* xmm3 = d2 = m + i*n */ \
+        __ASM_EMIT(MV "      %%xmm2, 0x00(%[dst])") \
+        __ASM_EMIT(MV "      %%xmm0, 0x00(%[dst], %[os])") \
+        __ASM_EMIT(MV "      %%xmm3, 0x00(%[dst], %[os], 2)")
+
+    #define DFT_BUTTERFLY4_BODY(MV) \
+        __ASM_EMIT(MV "      0x00(%[src]), %%xmm0")                 /* xmm0 = a0 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is]), %%xmm1")          /* xmm1 = s1 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is], 2), %%xmm2")       /* xmm2 = s2 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is3]), %%xmm3")         /* xmm3 = s3 */ \
+        DFT_TWIDDLE("xmm1", "xmm4", "0x00")                         /* xmm1 = a1 */ \
+        DFT_TWIDDLE("xmm2", "xmm5", "0x20")                         /* xmm2 = a2 */ \
+        DFT_TWIDDLE("xmm3", "xmm6", "0x40")                         /* xmm3 = a3 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+        __ASM_EMIT("addps       %%xmm2, %%xmm0")                    /* xmm0 = t0 = a0 + a2 */ \
+        __ASM_EMIT("subps       %%xmm2, %%xmm4")                    /* xmm4 = t1 = a0 - a2 */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm5") \
+        __ASM_EMIT("addps       %%xmm3, %%xmm1")                    /* xmm1 = t2 = a1 + a3 */ \
+        __ASM_EMIT("subps       %%xmm3, %%xmm5")                    /* xmm5 = t3 = a1 - a3 */ \
+        DFT_ROTATE("xmm5")                                          /* xmm5 = -i*t3 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm2") \
+        __ASM_EMIT("addps       %%xmm1, %%xmm0")                    /* xmm0 = d0 = t0 + t2 */ \
+        __ASM_EMIT("subps       %%xmm1, %%xmm2")                    /* xmm2 = d2 = t0 - t2 */ \
+        __ASM_EMIT("movaps      %%xmm4, %%xmm3") \
+        __ASM_EMIT("addps       %%xmm5, %%xmm4")                    /* xmm4 = d1 = t1 - i*t3 */ \
+        __ASM_EMIT("subps       %%xmm5, %%xmm3")                    /* xmm3 = d3 = t1 + i*t3 */ \
+        __ASM_EMIT(MV "      %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT(MV "      %%xmm4, 0x00(%[dst], %[os])") \
+        __ASM_EMIT(MV "      %%xmm2, 0x00(%[dst], %[os], 2)") \
+        __ASM_EMIT(MV "      %%xmm3, 0x00(%[dst], %[os3])")
+
+    #define DFT_BUTTERFLY5_BODY(MV) \
+        __ASM_EMIT(MV "      0x00(%[src]), %%xmm0")                 /* xmm0 = a0 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is]), %%xmm1")          /* xmm1 = s1 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is], 2), %%xmm2")       /* xmm2 = s2 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is3]), %%xmm3")         /* xmm3 = s3 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is], 4), %%xmm4")       /* xmm4 = s4 */ \
+        DFT_TWIDDLE("xmm1", "xmm5", "0x00")                         /* xmm1 = a1 */ \
+        DFT_TWIDDLE("xmm2", "xmm6", "0x20")                         /* xmm2 = a2 */ \
+        DFT_TWIDDLE("xmm3", "xmm7", "0x40")                         /* xmm3 = a3 */ \
+        DFT_TWIDDLE("xmm4", "xmm8", "0x60")                         /* xmm4 = a4 */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm5") \
+        __ASM_EMIT("addps       %%xmm4, %%xmm5")                    /* xmm5 = t1 = a1 + a4 */ \
+        __ASM_EMIT("subps       %%xmm4, %%xmm1")                    /* xmm1 = t3 = a1 - a4 */ \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm6") \
+        __ASM_EMIT("addps       %%xmm3, %%xmm6")                    /* xmm6 = t2 = a2 + a3 */ \
+        __ASM_EMIT("subps       %%xmm3, %%xmm2")                    /* xmm2 = t4 = a2 - a3 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm7") \
+        __ASM_EMIT("addps       %%xmm5, %%xmm7") \
+        __ASM_EMIT("addps       %%xmm6, %%xmm7")                    /* xmm7 = d0 = a0 + t1 + t2 */ \
+        __ASM_EMIT(MV "      %%xmm7, 0x00(%[dst])") \
+        __ASM_EMIT("movaps      %%xmm5, %%xmm3") \
+        __ASM_EMIT("movaps      %%xmm6, %%xmm4") \
+        __ASM_EMIT("mulps       " DFT_C5_1 ", %%xmm3") \
+        __ASM_EMIT("mulps       " DFT_C5_2 ", %%xmm4") \
+        __ASM_EMIT("addps       %%xmm4, %%xmm3") \
+        __ASM_EMIT("addps       %%xmm0, %%xmm3")                    /* xmm3 = m1 = a0 + t1*c1 + t2*c2 */ \
+        __ASM_EMIT("mulps       " DFT_C5_2 ", %%xmm5") \
+        __ASM_EMIT("mulps       " DFT_C5_1 ", %%xmm6") \
+        __ASM_EMIT("addps       %%xmm6, %%xmm5") \
+        __ASM_EMIT("addps       %%xmm0, %%xmm5")                    /* xmm5 = m2 = a0 + t1*c2 + t2*c1 */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm4") \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm6") \
+        __ASM_EMIT("mulps       " DFT_S5_1 ", %%xmm4") \
+        __ASM_EMIT("mulps       " DFT_S5_2 ", %%xmm6") \
+        __ASM_EMIT("addps       %%xmm6, %%xmm4")                    /* xmm4 = n1 = t3*s1 + t4*s2 */ \
+        __ASM_EMIT("mulps       " DFT_S5_2 ", %%xmm1") \
+        __ASM_EMIT("mulps       " DFT_S5_1 ", %%xmm2") \
+        __ASM_EMIT("subps       %%xmm2, %%xmm1")                    /* xmm1 = n2 = t3*s2 - t4*s1 */ \
+        DFT_ROTATE("xmm4")                                          /* xmm4 = -i*n1 */ \
+        DFT_ROTATE("xmm1")                                          /* xmm1 = -i*n2 */ \
+        __ASM_EMIT("movaps      %%xmm3, %%xmm0") \
+        __ASM_EMIT("addps       %%xmm4, %%xmm3")                    /* xmm3 = d1 = m1 - i*n1 */ \
+        __ASM_EMIT("subps       %%xmm4, %%xmm0")                    /* xmm0 = d4 = m1 + i*n1 */ \
+        __ASM_EMIT("movaps      %%xmm5, %%xmm2") \
+        __ASM_EMIT("addps       %%xmm1, %%xmm5")                    /* xmm5 = d2 = m2 - i*n2 */ \
+        __ASM_EMIT("subps       %%xmm1, %%xmm2")                    /* xmm2 = d3 = m2 + i*n2 */ \
+        __ASM_EMIT(MV "      %%xmm3, 0x00(%[dst], %[os])") \
+        __ASM_EMIT(MV "      %%xmm5, 0x00(%[dst], %[os], 2)") \
+        __ASM_EMIT(MV "      %%xmm2, 0x00(%[dst], %[os3])") \
+        __ASM_EMIT(MV "      %%xmm0, 0x00(%[dst], %[os], 4)")
+
+    /* Compute xmm4 = m = a0 + p1*CA + p2*CB + p3*CC, xmm8 = n = q1*SA +/- q2*SB +/- q3*SC */
+    #define DFT_BUTTERFLY7_PAIR(CA, CB, CC, SA, OPB, SB, OPC, SC) \
+        __ASM_EMIT("movaps      %%xmm7, %%xmm4") \
+        __ASM_EMIT("movaps      %%xmm6, %%xmm8") \
+        __ASM_EMIT("mulps       " CA ", %%xmm4") \
+        __ASM_EMIT("mulps       " CB ", %%xmm8") \
+        __ASM_EMIT("addps       %%xmm8, %%xmm4") \
+        __ASM_EMIT("movaps      %%xmm5, %%xmm8") \
+        __ASM_EMIT("mulps       " CC ", %%xmm8") \
+        __ASM_EMIT("addps       %%xmm8, %%xmm4") \
+        __ASM_EMIT("addps       %%xmm0, %%xmm4")                    /* xmm4 = m */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm8") \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm9") \
+        __ASM_EMIT("mulps       " SA ", %%xmm8") \
+        __ASM_EMIT("mulps       " SB ", %%xmm9") \
+        __ASM_EMIT(OPB "       %%xmm9, %%xmm8") \
+        __ASM_EMIT("movaps      %%xmm3, %%xmm9") \
+        __ASM_EMIT("mulps       " SC ", %%xmm9") \
+        __ASM_EMIT(OPC "       %%xmm9, %%xmm8")                     /* xmm8 = n */ \
+        DFT_ROTATE("xmm8")                                          /* xmm8 = -i*n */ \
+        __ASM_EMIT("movaps      %%xmm4, %%xmm9") \
+        __ASM_EMIT("addps       %%xmm8, %%xmm4")                    /* xmm4 = m - i*n */ \
+        __ASM_EMIT("subps       %%xmm8, %%xmm9")                    /* xmm9 = m + i*n */
+
+    #define DFT_BUTTERFLY7_BODY(MV) \
+        __ASM_EMIT(MV "      0x00(%[src]), %%xmm0")                 /* xmm0 = a0 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is]), %%xmm1")          /* xmm1 = s1 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is], 2), %%xmm2")       /* xmm2 = s2 */ \
+        __ASM_EMIT(MV "      0x00(%[src], %[is3]), %%xmm3")         /* xmm3 = s3 */ \
+        __ASM_EMIT(MV "      0x00(%[s4]), %%xmm4")                  /* xmm4 = s4 */ \
+        __ASM_EMIT(MV "      0x00(%[s4], %[is]), %%xmm5")           /* xmm5 = s5 */ \
+        __ASM_EMIT(MV "      0x00(%[s4], %[is], 2), %%xmm6")        /* xmm6 = s6 */ \
+        DFT_TWIDDLE("xmm1", "xmm7", "0x00")                         /* xmm1 = a1 */ \
+        DFT_TWIDDLE("xmm2", "xmm7", "0x20")                         /* xmm2 = a2 */ \
+        DFT_TWIDDLE("xmm3", "xmm7", "0x40")                         /* xmm3 = a3 */ \
+        DFT_TWIDDLE("xmm4", "xmm7", "0x60")                         /* xmm4 = a4 */ \
+        DFT_TWIDDLE("xmm5", "xmm7", "0x80")                         /* xmm5 = a5 */ \
+        DFT_TWIDDLE("xmm6", "xmm7", "0xa0")                         /* xmm6 = a6 */ \
+        __ASM_EMIT("movaps      %%xmm1, %%xmm7") \
+        __ASM_EMIT("addps       %%xmm6, %%xmm7")                    /* xmm7 = p1 = a1 + a6 */ \
+        __ASM_EMIT("subps       %%xmm6, %%xmm1")                    /* xmm1 = q1 = a1 - a6 */ \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm6") \
+        __ASM_EMIT("addps       %%xmm5, %%xmm6")                    /* xmm6 = p2 = a2 + a5 */ \
+        __ASM_EMIT("subps       %%xmm5, %%xmm2")                    /* xmm2 = q2 = a2 - a5 */ \
+        __ASM_EMIT("movaps      %%xmm3, %%xmm5") \
+        __ASM_EMIT("addps       %%xmm4, %%xmm5")                    /* xmm5 = p3 = a3 + a4 */ \
+        __ASM_EMIT("subps       %%xmm4, %%xmm3")                    /* xmm3 = q3 = a3 - a4 */ \
+        __ASM_EMIT("movaps      %%xmm0, %%xmm4") \
+        __ASM_EMIT("addps       %%xmm7, %%xmm4") \
+        __ASM_EMIT("addps       %%xmm6, %%xmm4") \
+        __ASM_EMIT("addps       %%xmm5, %%xmm4")                    /* xmm4 = d0 = a0 + p1 + p2 + p3 */ \
+        __ASM_EMIT(MV "      %%xmm4, 0x00(%[dst])") \
+        DFT_BUTTERFLY7_PAIR(DFT_C7_1, DFT_C7_2, DFT_C7_3, DFT_S7_1, "addps", DFT_S7_2, "addps", DFT_S7_3) \
+        __ASM_EMIT(MV "      %%xmm4, 0x00(%[dst], %[os])")          /* d1 */ \
+        __ASM_EMIT(MV "      %%xmm9, 0x00(%[d4], %[os], 2)")        /* d6 */ \
+        DFT_BUTTERFLY7_PAIR(DFT_C7_2, DFT_C7_3, DFT_C7_1, DFT_S7_2, "subps", DFT_S7_3, "subps", DFT_S7_1) \
+        __ASM_EMIT(MV "      %%xmm4, 0x00(%[dst], %[os], 2)")       /* d2 */ \
+        __ASM_EMIT(MV "      %%xmm9, 0x00(%[d4], %[os])")           /* d5 */ \
+        DFT_BUTTERFLY7_PAIR(DFT_C7_3, DFT_C7_1, DFT_C7_2, DFT_S7_3, "subps", DFT_S7_1, "addps", DFT_S7_2) \
+        __ASM_EMIT(MV "      %%xmm4, 0x00(%[dst], %[os3])")         /* d3 */ \
+        __ASM_EMIT(MV "      %%xmm9, 0x00(%[d4])")                  /* d4 */
+
+        /*
+         * Mixed-radix butterflies, the layout of data is the same to the generic
+         * implementation. Twiddle factors are passed as pre-broadcasted vectors:
+         * { wr, wr, wr, wr, wi, wi, wi, wi } for each of (radix - 1) factors.
+         */
+        static void x64_dft_butterfly2(float *dst, size_t stride, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86_64(
+                size_t is   = count * sizeof(float) * 2;
+                size_t os   = stride * sizeof(float);
+            );
+
+            ARCH_X86_64_ASM
+            (
+                DFT_BUTTERFLY_LOOP(DFT_BUTTERFLY2_BODY, DFT_ADVANCE)
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [is] "r" (is), [os] "r" (os),
+                  [w] "r" (w)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2"
+            );
+        }
+
+        static void x64_dft_butterfly3(float *dst, size_t stride, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86_64(
+                size_t is   = count * sizeof(float) * 2;
+                size_t os   = stride * sizeof(float);
+            );
+
+            ARCH_X86_64_ASM
+            (
+                DFT_BUTTERFLY_LOOP(DFT_BUTTERFLY3_BODY, DFT_ADVANCE)
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [is] "r" (is), [os] "r" (os),
+                  [w] "r" (w), [K] "r" (dft_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4"
+            );
+        }
+
+        static void x64_dft_butterfly4(float *dst, size_t stride, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86_64(
+                size_t is   = count * sizeof(float) * 2;
+                size_t os   = stride * sizeof(float);
+            );
+
+            ARCH_X86_64_ASM
+            (
+                DFT_BUTTERFLY_LOOP(DFT_BUTTERFLY4_BODY, DFT_ADVANCE)
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [is] "r" (is), [os] "r" (os),
+                  [is3] "r" (is * 3), [os3] "r" (os * 3),
+                  [w] "r" (w), [K] "r" (dft_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6"
+            );
+        }
+
+        static void x64_dft_butterfly5(float *dst, size_t stride, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86_64(
+                size_t is   = count * sizeof(float) * 2;
+                size_t os   = stride * sizeof(float);
+            );
+
+            ARCH_X86_64_ASM
+            (
+                DFT_BUTTERFLY_LOOP(DFT_BUTTERFLY5_BODY, DFT_ADVANCE)
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+                : [is] "r" (is), [os] "r" (os),
+                  [is3] "r" (is * 3), [os3] "r" (os * 3),
+                  [w] "r" (w), [K] "r" (dft_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8"
+            );
+        }
+
+        static void x64_dft_butterfly7(float *dst, size_t stride, const float *src, const float *w, size_t count)
+        {
+            IF_ARCH_X86_64(
+                size_t is   = count * sizeof(float) * 2;
+                size_t os   = stride * sizeof(float);
+                const float *s4 = &src[count * 8];
+                float *d4   = &dst[stride * 4];
+            );
+
+            ARCH_X86_64_ASM
+            (
+                DFT_BUTTERFLY_LOOP(DFT_BUTTERFLY7_BODY, DFT_ADVANCE4)
+                : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+                  [d4] "+r" (d4), [s4] "+r" (s4)
+                : [is] "r" (is), [os] "r" (os),
+                  [is3] "r" (is * 3), [os3] "r" (os * 3),
+                  [w] "r" (w), [K] "r" (dft_const)
+                : "cc", "memory",
+                  "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+                  "%xmm4", "%xmm5", "%xmm6", "%xmm7",
+                  "%xmm8", "%xmm9"
+            );
+        }
+
+    #undef DFT_BUTTERFLY7_BODY
+    #undef DFT_BUTTERFLY7_PAIR
+    #undef DFT_BUTTERFLY5_BODY
+    #undef DFT_BUTTERFLY4_BODY
+    #undef DFT_BUTTERFLY3_BODY
+    #undef DFT_BUTTERFLY2_BODY
+    #undef DFT_ADVANCE4
+    #undef DFT_ADVANCE
+    #undef DFT_BUTTERFLY_LOOP
+    #undef DFT_ROTATE
+    #undef DFT_TWIDDLE
+    #undef DFT_S7_3
+    #undef DFT_S7_2
+    #undef DFT_S7_1
+    #undef DFT_C7_3
+    #undef DFT_C7_2
+    #undef DFT_C7_1
+    #undef DFT_S5_2
+    #undef DFT_S5_1
+    #undef DFT_C5_2
+    #undef DFT_C5_1
+    #undef DFT_S3
+    #undef DFT_C3
+    #undef DFT_SIGN
+
+        static void x64_dft_bluestein(dsp::dft_plan_t *plan, float *dst, const float *src, bool reverse)
+        {
+            size_t n            = plan->size;
+            float *buf          = plan->buf;
+            const float *c      = plan->chirp;
+
+            // Reverse transform is computed as conj(DFT(conj(x))) / N
+            if (reverse)
+            {
+                for (size_t i=0; i<n; ++i)
+                {
+                    float re            = src[i*2];
+                    float im            = -src[i*2+1];
+                    buf[i*2]            = re*c[i*2] - im*c[i*2+1];
+                    buf[i*2+1]          = re*c[i*2+1] + im*c[i*2];
+                }
+            }
+            else
+                dsp::pcomplex_mul3(buf, src, c, n);
+            dsp::fill_zero(&buf[n*2], (plan->bsize - n) * 2);
+
+            // Perform the convolution with the conjugate chirp
+            dsp::packed_direct_dft(plan->conv, plan->spec, buf);
+            dsp::pcomplex_mul2(plan->spec, plan->kernel, plan->bsize);
+            dsp::packed_reverse_dft(plan->conv, buf, plan->spec);
+
+            if (reverse)
+            {
+                float k             = 1.0f / n;
+                for (size_t i=0; i<n; ++i)
+                {
+                    float re            = buf[i*2]*c[i*2] - buf[i*2+1]*c[i*2+1];
+                    float im            = buf[i*2]*c[i*2+1] + buf[i*2+1]*c[i*2];
+                    dst[i*2]            = re * k;
+                    dst[i*2+1]          = -im * k;
+                }
+            }
+            else
+                dsp::pcomplex_mul3(dst, buf, c, n);
+        }
+
+        static void x64_dft_execute(dsp::dft_plan_t *plan, float *dst, const float *src, bool reverse)
+        {
+            if (plan->bsize > 0)
+            {
+                x64_dft_bluestein(plan, dst, src, reverse);
+                return;
+            }
+
+            size_t n1           = size_t(1) << plan->rank;
+            size_t rows         = plan->rows;
+            size_t row_size     = n1 * 2;
+            if (plan->nstages == 0)
+            {
+                if (reverse)
+                    dsp::packed_reverse_fft(dst, src, plan->rank);
+                else
+                    dsp::packed_direct_fft(dst, src, plan->rank);
+                return;
+            }
+
+            // Select buffers so that the last pass stores data to the destination
+            size_t passes       = plan->nstages + ((n1 > 1) ? 1 : 0);
+            float *a            = (passes & 1) ? plan->tmp : dst;
+            float *b            = (passes & 1) ? dst : plan->tmp;
+            if (a == src)
+            {
+                a                   = b;
+                b                   = dst;
+            }
+
+            // Gather columns into rows: row[n2][n1] = x[n1*rows + n2]
+            float sign          = (reverse) ? -1.0f : 1.0f;
+            for (size_t i=0; i<rows; ++i)
+            {
+                float *row          = &a[i * row_size];
+                const float *s      = &src[i*2];
+                for (size_t j=0; j<n1; ++j, s += rows*2)
+                {
+                    row[j*2]            = s[0];
+                    row[j*2+1]          = s[1] * sign;
+                }
+            }
+
+            // Transform rows and apply four-step twiddle factors
+            if (n1 > 1)
+            {
+                dsp::packed_direct_fft(b, a, plan->rank);
+                for (size_t i=1; i<rows; ++i)
+                {
+                    float *row          = &b[i * row_size];
+                    dsp::packed_direct_fft(row, &a[i * row_size], plan->rank);
+                    dsp::pcomplex_mul2(row, &plan->tw[i * row_size], n1);
+                }
+
+                float *t            = a;
+                a                   = b;
+                b                   = t;
+            }
+
+            // Perform mixed-radix stages on columns
+            float w[48] __lsp_aligned16;
+
+            for (size_t i=0; i<plan->nstages; ++i)
+            {
+                const dsp::dft_stage_t *st  = &plan->stages[i];
+                size_t p            = st->radix;
+                size_t count        = st->residues * n1;
+                size_t in_step      = count * p * 2;
+                size_t out_step     = count * 2;
+                size_t stride       = st->length * count * 2;
+                const float *tw     = st->tw;
+
+                for (size_t j=0; j<st->length; ++j)
+                {
+                    const float *s      = &a[j * in_step];
+                    float *d            = &b[j * out_step];
+
+                    // Broadcast twiddle factors
+                    for (size_t t=0; t<p-1; ++t, tw += 2)
+                    {
+                        float *v            = &w[t * 8];
+                        v[0]                = tw[0];
+                        v[1]                = tw[0];
+                        v[2]                = tw[0];
+                        v[3]                = tw[0];
+                        v[4]                = tw[1];
+                        v[5]                = tw[1];
+                        v[6]                = tw[1];
+                        v[7]                = tw[1];
+                    }
+
+                    switch (p)
+                    {
+                        case 2: x64_dft_butterfly2(d, stride, s, w, count); break;
+                        case 3: x64_dft_butterfly3(d, stride, s, w, count); break;
+                        case 4: x64_dft_butterfly4(d, stride, s, w, count); break;
+                        case 5: x64_dft_butterfly5(d, stride, s, w, count); break;
+                        default: x64_dft_butterfly7(d, stride, s, w, count); break;
+                    }
+                }
+
+                float *t            = a;
+                a                   = b;
+                b                   = t;
+            }
+
+            // Copy data if the last stage has been performed to the temporary buffer
+            if (a != dst)
+                dsp::copy(dst, a, plan->size * 2);
+
+            if (reverse)
+            {
+                float k             = 1.0f / plan->size;
+                for (size_t i=0, n=plan->size*2; i<n; i += 2)
+                {
+                    dst[i]              = dst[i] * k;
+                    dst[i+1]            = -dst[i+1] * k;
+                }
+            }
+        }
+
+        void x64_packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src)
+        {
+            x64_dft_execute(plan, dst, src, false);
+        }
+
+        void x64_packed_reverse_dft(dsp::dft_plan_t *plan, float *dst, const float *src)
+        {
+            x64_dft_execute(plan, dst, src, true);
+        }
+    } /* namespace sse3 */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_ARCH_X86_SSE3_DFT_H_ */
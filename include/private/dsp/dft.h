@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_DFT_H_
+#define PRIVATE_DSP_DFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /**
+         * Single mixed-radix stage of the DFT plan
+         */
+        typedef struct dft_stage_t
+        {
+            size_t      radix;          // Radix of the stage
+            size_t      length;         // Length of the sub-transforms before the stage
+            size_t      residues;       // Number of residues after the stage
+            float      *tw;             // Twiddle factors: length * (radix - 1) complex numbers
+        } dft_stage_t;
+
+        /**
+         * The DFT plan, shared between all architecture-specific implementations
+         */
+        struct dft_plan_t
+        {
+            size_t              size;           // Size of the transform
+            size_t              rank;           // Rank of the power-of-two part processed by packed FFT
+            size_t              rows;           // Size of the part processed by mixed-radix stages
+            size_t              nstages;        // Number of mixed-radix stages
+            size_t              bsize;          // Size of the Bluestein convolution
+            uint8_t            *data;           // Allocated data
+            float              *tw;             // Four-step twiddle factors: rows * 2^rank complex numbers
+            float              *tmp;            // Temporary buffer: size complex numbers
+            float              *chirp;          // Bluestein chirp: size complex numbers
+            float              *kernel;         // Bluestein kernel spectrum: bsize complex numbers
+            float              *buf;            // Bluestein convolution buffer: bsize complex numbers
+            float              *spec;           // Bluestein convolution spectrum: bsize complex numbers
+            dft_plan_t         *conv;           // Nested plan for the Bluestein convolution
+            dft_stage_t         stages[64];
+        };
+    } /* namespace dsp */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_DFT_H_ */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_FFT_H_
+#define PRIVATE_DSP_FFT_H_
+
+#include <lsp-plug.in/dsp/common/types.h>
+
+namespace lsp
+{
+    namespace dsp
+    {
+        /*
+         * Large transforms do not fit into the cache, so plan butterflies are not applied
+         * stage by stage over the whole buffer:
+         *   - all stages that fit into a block of 2^FFT_BLOCK_RANK complex numbers are applied
+         *     to the block before switching to the next block;
+         *   - the remaining stages are applied in groups of FFT_GROUP_RANK stages, each group
+         *     processes columns of FFT_STRIP_SIZE complex numbers of all rows it joins.
+         */
+        static constexpr size_t FFT_BLOCK_RANK      = 13;
+        static constexpr size_t FFT_GROUP_RANK      = 3;
+        static constexpr size_t FFT_STRIP_SIZE      = 256;
+
+        /**
+         * The FFT plan, shared between all architecture-specific implementations.
+         *
+         * Twiddle factors of the butterfly stage that joins two halves of N complex
+         * numbers are stored at the float offset 2*N - 8 of the table as N cosines
+         * followed by N sines of the angle pi*j/N, so any SIMD register width up to N
+         * can load the factors without shuffling. The first stage of the table
+         * has N = 4.
+         */
+        struct fft_plan_t
+        {
+            size_t              rank;           // Rank of the transform
+            uint8_t            *data;           // Allocated data
+            float              *tw;             // Twiddle factors: 2^(rank+1) - 8 floats
+            uint32_t           *rev;            // Bit-reversal permutation: 2^rank indices
+        };
+
+        /**
+         * Get twiddle factors of the plan stage that joins two halves of n complex numbers
+         *
+         * @param plan the FFT plan of rank 3 or higher
+         * @param n half size of the stage, power of two from 4 to 2^(rank-1)
+         * @return n cosines followed by n sines of the angle pi*j/n
+         */
+        static inline const float *fft_plan_twiddles(const fft_plan_t *plan, size_t n)
+        {
+            return &plan->tw[(n << 1) - 8];
+        }
+    } /* namespace dsp */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_FFT_H_ */
@@ -66,11 +66,29 @@ namespace lsp
     #include <private/dsp/arch/generic/filters/dynamic.h>
     #include <private/dsp/arch/generic/filters/transform.h>
     #include <private/dsp/arch/generic/filters/transfer.h>
+    #include <private/dsp/arch/generic/filters/design.h>
+    #include <private/dsp/arch/generic/hilbert.h>
 
     #include <private/dsp/arch/generic/fft.h>
+    #include <private/dsp/arch/generic/rfft.h>
+    #include <private/dsp/arch/generic/fft_f64.h>
+    #include <private/dsp/arch/generic/fftplan.h>
+    #include <private/dsp/arch/generic/fftbatch.h>
+    #include <private/dsp/arch/generic/dft.h>
     #include <private/dsp/arch/generic/fastconv.h>
+    #include <private/dsp/arch/generic/sdft.h>
+    #include <private/dsp/arch/generic/convolver.h>
+    #include <private/dsp/arch/generic/fir.h>
+    #include <private/dsp/arch/generic/hconvolver.h>
+    #include <private/dsp/arch/generic/mconvolver.h>
+    #include <private/dsp/arch/generic/parallel.h>
     #include <private/dsp/arch/generic/float.h>
     #include <private/dsp/arch/generic/resampling.h>
+    #include <private/dsp/arch/generic/resampler.h>
+    #include <private/dsp/arch/generic/stft.h>
+    #include <private/dsp/arch/generic/xcorr.h>
+    #include <private/dsp/arch/generic/window.h>
+    #include <private/dsp/arch/generic/spectrum.h>
     #include <private/dsp/arch/generic/msmatrix.h>
     #include <private/dsp/arch/generic/smath.h>
     #include <private/dsp/arch/generic/mix.h>
@@ -263,6 +281,8 @@ namespace lsp
             EXPORT1(h_dotp);
             EXPORT1(h_sqr_dotp);
             EXPORT1(h_abs_dotp);
+            EXPORT1(h_sum_f64);
+            EXPORT1(h_dotp_f64);
 
             EXPORT1(fmadd_k3);
             EXPORT1(fmsub_k3);
@@ -320,6 +340,26 @@ namespace lsp
             EXPORT1(packed_direct_fft);
             EXPORT1(reverse_fft);
             EXPORT1(packed_reverse_fft);
+            EXPORT1(real_direct_fft);
+            EXPORT1(real_reverse_fft);
+            EXPORT1(direct_fft_f64);
+            EXPORT1(reverse_fft_f64);
+            EXPORT1(fft_plan_create);
+            EXPORT1(fft_plan_destroy);
+            EXPORT1(fft_plan_rank);
+            EXPORT1(plan_direct_fft);
+            EXPORT1(plan_reverse_fft);
+            EXPORT1(plan_packed_direct_fft);
+            EXPORT1(plan_packed_reverse_fft);
+            EXPORT1(plan_packed_direct_fft_batch);
+            EXPORT1(plan_packed_reverse_fft_batch);
+            EXPORT1(plan_packed_direct_fft_batch_ptr);
+            EXPORT1(plan_packed_reverse_fft_batch_ptr);
+            EXPORT1(dft_plan_create);
+            EXPORT1(dft_plan_destroy);
+            EXPORT1(dft_plan_size);
+            EXPORT1(packed_direct_dft);
+            EXPORT1(packed_reverse_dft);
             EXPORT1(normalize_fft3);
             EXPORT1(normalize_fft2);
             EXPORT1(center_fft);
@@ -330,6 +370,48 @@ namespace lsp
             EXPORT1(fastconv_parse_apply);
             EXPORT1(fastconv_restore);
             EXPORT1(fastconv_apply);
+            EXPORT1(fastconv_fmadd);
+
+            EXPORT1(sdft_init);
+            EXPORT1(sdft_reset);
+            EXPORT1(sdft_process);
+            EXPORT1(sdft_amplitude);
+            EXPORT1(plan_fastconv_parse);
+            EXPORT1(plan_fastconv_parse_apply);
+            EXPORT1(plan_fastconv_restore);
+            EXPORT1(plan_fastconv_apply);
+
+            EXPORT1(convolver_create);
+            EXPORT1(convolver_destroy);
+            EXPORT1(convolver_reset);
+            EXPORT1(convolver_latency);
+            EXPORT1(convolver_process);
+
+            EXPORT1(fir_create);
+            EXPORT1(fir_destroy);
+            EXPORT1(fir_reset);
+            EXPORT1(fir_process);
+            EXPORT1(fir_design_linear);
+            EXPORT1(fir_design_minimum);
+            EXPORT1(fir_minimum_phase);
+
+            EXPORT1(hconvolver_create);
+            EXPORT1(hconvolver_destroy);
+            EXPORT1(hconvolver_reset);
+            EXPORT1(hconvolver_process);
+
+            EXPORT1(mconvolver_create);
+            EXPORT1(mconvolver_destroy);
+            EXPORT1(mconvolver_reset);
+            EXPORT1(mconvolver_latency);
+            EXPORT1(mconvolver_process);
+
+            EXPORT1(workers_create);
+            EXPORT1(workers_destroy);
+            EXPORT1(workers_threads);
+            EXPORT1(parallel_packed_direct_fft);
+            EXPORT1(parallel_packed_reverse_fft);
+            EXPORT1(parallel_convolve);
 
             EXPORT1(complex_mul2);
             EXPORT1(complex_mul3);
@@ -352,6 +434,7 @@ namespace lsp
             EXPORT1(pcomplex_rcp2);
             EXPORT1(pcomplex_fill_ri);
             EXPORT1(pcomplex_r2c);
+            EXPORT1(pcomplex_r2c_mul3);
             EXPORT1(pcomplex_c2r);
             EXPORT1(pcomplex_mod);
             EXPORT1(pcomplex_arg);
@@ -383,11 +466,37 @@ namespace lsp
             EXPORT1(biquad_process_x2);
             EXPORT1(biquad_process_x4);
             EXPORT1(biquad_process_x8);
+            EXPORT1(biquad_process_x16);
+            EXPORT1(biquad_process_c4);
+            EXPORT1(biquad_process_c8);
+            EXPORT1(biquad_process_c16);
+            EXPORT1(biquad_process_s8);
+            EXPORT1(biquad_process_imc);
+            EXPORT1(biquad_process_mc);
+            EXPORT1(biquad_process_x1_bp);
+            EXPORT1(biquad_process_x1_f64);
+            EXPORT1(biquad_process_x2_f64);
+            EXPORT1(biquad_process_x4_f64);
+            EXPORT1(biquad_process_x8_f64);
 
             EXPORT1(dyn_biquad_process_x1);
             EXPORT1(dyn_biquad_process_x2);
             EXPORT1(dyn_biquad_process_x4);
             EXPORT1(dyn_biquad_process_x8);
+            EXPORT1(dyn_biquad_process_x16);
+
+            EXPORT1(dyn_biquad_design_x1);
+            EXPORT1(dyn_biquad_design_x2);
+            EXPORT1(dyn_biquad_design_x4);
+            EXPORT1(dyn_biquad_design_x8);
+            EXPORT1(dyn_biquad_design_x16);
+
+            EXPORT1(filter_design_cascades);
+            EXPORT1(filter_design_bilinear);
+
+            EXPORT1(hilbert_init);
+            EXPORT1(hilbert_process);
+            EXPORT1(hilbert_fft);
 
             EXPORT1(filter_transfer_calc_ri);
             EXPORT1(filter_transfer_apply_ri);
@@ -398,6 +507,11 @@ namespace lsp
             EXPORT1(bilinear_transform_x2);
             EXPORT1(bilinear_transform_x4);
             EXPORT1(bilinear_transform_x8);
+            EXPORT1(bilinear_transform_x16);
+            EXPORT1(bilinear_transform_x1_f64);
+            EXPORT1(bilinear_transform_x2_f64);
+            EXPORT1(bilinear_transform_x4_f64);
+            EXPORT1(bilinear_transform_x8_f64);
 
             EXPORT1(matched_transform_x1);
             EXPORT1(matched_transform_x2);
@@ -468,6 +582,78 @@ namespace lsp
             EXPORT1(downsample_6x);
             EXPORT1(downsample_8x);
 
+            EXPORT1(fir_decimate);
+
+            EXPORT1(lanczos_decimate_2x2);
+            EXPORT1(lanczos_decimate_2x3);
+            EXPORT1(lanczos_decimate_2x4);
+            EXPORT2(lanczos_decimate_2x12bit, lanczos_decimate_2x4);
+            EXPORT1(lanczos_decimate_2x16bit);
+            EXPORT1(lanczos_decimate_2x24bit);
+
+            EXPORT1(lanczos_decimate_3x2);
+            EXPORT1(lanczos_decimate_3x3);
+            EXPORT1(lanczos_decimate_3x4);
+            EXPORT2(lanczos_decimate_3x12bit, lanczos_decimate_3x4);
+            EXPORT1(lanczos_decimate_3x16bit);
+            EXPORT1(lanczos_decimate_3x24bit);
+
+            EXPORT1(lanczos_decimate_4x2);
+            EXPORT1(lanczos_decimate_4x3);
+            EXPORT1(lanczos_decimate_4x4);
+            EXPORT2(lanczos_decimate_4x12bit, lanczos_decimate_4x4);
+            EXPORT1(lanczos_decimate_4x16bit);
+            EXPORT1(lanczos_decimate_4x24bit);
+
+            EXPORT1(lanczos_decimate_6x2);
+            EXPORT1(lanczos_decimate_6x3);
+            EXPORT1(lanczos_decimate_6x4);
+            EXPORT2(lanczos_decimate_6x12bit, lanczos_decimate_6x4);
+            EXPORT1(lanczos_decimate_6x16bit);
+            EXPORT1(lanczos_decimate_6x24bit);
+
+            EXPORT1(lanczos_decimate_8x2);
+            EXPORT1(lanczos_decimate_8x3);
+            EXPORT1(lanczos_decimate_8x4);
+            EXPORT2(lanczos_decimate_8x12bit, lanczos_decimate_8x4);
+            EXPORT1(lanczos_decimate_8x16bit);
+            EXPORT1(lanczos_decimate_8x24bit);
+
+            EXPORT1(resampler_create);
+            EXPORT1(resampler_destroy);
+            EXPORT1(resampler_reset);
+            EXPORT1(resampler_set_ratio);
+            EXPORT1(resampler_get_ratio);
+            EXPORT1(resampler_latency);
+            EXPORT1(resampler_max_output);
+            EXPORT1(resampler_process);
+
+            EXPORT1(stft_create);
+            EXPORT1(stft_destroy);
+            EXPORT1(stft_reset);
+            EXPORT1(stft_latency);
+            EXPORT1(stft_spectrum);
+            EXPORT1(stft_process);
+
+            EXPORT1(xcorr_create);
+            EXPORT1(xcorr_destroy);
+            EXPORT1(xcorr_reset);
+            EXPORT1(xcorr_process);
+            EXPORT1(xcorr_estimate);
+
+            EXPORT1(window_cosine_sum);
+            EXPORT1(window_sine);
+            EXPORT1(window_hann);
+            EXPORT1(window_hamming);
+            EXPORT1(window_blackman);
+            EXPORT1(window_blackman_harris);
+            EXPORT1(window_nuttall);
+            EXPORT1(window_flat_top);
+            EXPORT1(window_kaiser);
+
+            EXPORT1(spectrum_log_map);
+            EXPORT1(spectrum_display);
+
             // 3D math
             EXPORT1(init_point_xyz);
             EXPORT1(init_point);
@@ -578,6 +764,8 @@ namespace lsp
             EXPORT1(convolve);
             EXPORT1(corr_init);
             EXPORT1(corr_incr);
+            EXPORT1(corr_init_f64);
+            EXPORT1(corr_incr_f64);
 
             EXPORT1(base64_enc);
             EXPORT1(base64_dec);
@@ -26,6 +26,7 @@
     #include <lsp-plug.in/dsp/dsp.h>
     #include <lsp-plug.in/common/bits.h>
     #include <lsp-plug.in/stdlib/math.h>
+    #include <lsp-plug.in/stdlib/string.h>
 
     // Test framework
     #ifdef LSP_TESTING
@@ -59,8 +60,13 @@
         #include <private/dsp/arch/x86/avx/search/minmax.h>
 
         #include <private/dsp/arch/x86/avx/fft.h>
+        #include <private/dsp/arch/x86/avx/fft_f64.h>
         #include <private/dsp/arch/x86/avx/pfft.h>
+        #include <private/dsp/arch/x86/avx/rfft.h>
+        #include <private/dsp/arch/x86/avx/fftplan.h>
+        #include <private/dsp/arch/x86/avx/fftbatch.h>
         #include <private/dsp/arch/x86/avx/fastconv.h>
+        #include <private/dsp/arch/x86/avx/sdft.h>
 
         #include <private/dsp/arch/x86/avx/filters/static.h>
         #include <private/dsp/arch/x86/avx/filters/dynamic.h>
@@ -295,6 +301,7 @@
                 CEXPORT1(favx, pcomplex_rcp2);
 
                 CEXPORT1(favx, pcomplex_r2c);
+                CEXPORT1(favx, pcomplex_r2c_mul3);
                 CEXPORT1(favx, pcomplex_r2c_add2);
                 CEXPORT1(favx, pcomplex_r2c_sub2);
                 CEXPORT1(favx, pcomplex_r2c_rsub2);
@@ -307,6 +314,12 @@
                 CEXPORT1(favx, biquad_process_x2);
                 CEXPORT1(favx, biquad_process_x4);
                 EXPORT2_X64(biquad_process_x8, x64_biquad_process_x8);
+                CEXPORT1(favx, biquad_process_c4);
+                CEXPORT1(favx, biquad_process_c8);
+                CEXPORT1(favx, biquad_process_c16);
+                CEXPORT2_X64(favx, biquad_process_s8, x64_biquad_process_s8);
+                CEXPORT1(favx, biquad_process_x4_f64);
+                CEXPORT1(favx, biquad_process_x8_f64);
 
                 CEXPORT1(favx, dyn_biquad_process_x1);
                 CEXPORT1(favx, dyn_biquad_process_x2);
@@ -321,10 +334,12 @@
                 CEXPORT1(favx, h_sum);
                 CEXPORT1(favx, h_sqr_sum);
                 CEXPORT1(favx, h_abs_sum);
+                CEXPORT1(favx, h_sum_f64);
 
                 CEXPORT1(favx, h_dotp);
                 CEXPORT1(favx, h_sqr_dotp);
                 CEXPORT1(favx, h_abs_dotp);
+                CEXPORT1(favx, h_dotp_f64);
 
                 CEXPORT1(favx, mix2);
                 CEXPORT1(favx, mix_copy2);
@@ -358,16 +373,29 @@
 
                 CEXPORT1(favx, direct_fft);
                 CEXPORT1(favx, reverse_fft);
+                CEXPORT1(favx, direct_fft_f64);
+                CEXPORT1(favx, reverse_fft_f64);
                 CEXPORT1(favx, normalize_fft2);
                 CEXPORT1(favx, normalize_fft3);
 
                 CEXPORT1(favx, packed_direct_fft);
                 CEXPORT1(favx, packed_reverse_fft);
+                CEXPORT1(favx, real_direct_fft);
+                CEXPORT1(favx, real_reverse_fft);
+                CEXPORT1(favx, plan_packed_direct_fft);
+                CEXPORT1(favx, plan_packed_reverse_fft);
+                CEXPORT1(favx, plan_packed_direct_fft_batch);
+                CEXPORT1(favx, plan_packed_reverse_fft_batch);
+                CEXPORT1(favx, plan_packed_direct_fft_batch_ptr);
+                CEXPORT1(favx, plan_packed_reverse_fft_batch_ptr);
 
                 CEXPORT1(favx, fastconv_parse);
                 CEXPORT1(favx, fastconv_restore);
                 CEXPORT1(favx, fastconv_apply);
                 CEXPORT1(favx, fastconv_parse_apply);
+                CEXPORT1(favx, fastconv_fmadd);
+
+                CEXPORT1(favx, sdft_process);
 
                 CEXPORT1(favx, filter_transfer_calc_ri);
                 CEXPORT1(favx, filter_transfer_apply_ri);
@@ -404,10 +432,13 @@
                 CEXPORT1(favx, downsample_4x);
                 CEXPORT1(favx, downsample_6x);
                 CEXPORT1(favx, downsample_8x);
+                CEXPORT1(favx, fir_decimate);
 
                 CEXPORT1(favx, convolve);
                 CEXPORT1(favx, corr_init);
                 CEXPORT1(favx, corr_incr);
+                CEXPORT1(favx, corr_init_f64);
+                CEXPORT1(favx, corr_incr_f64);
 
                 CEXPORT1(favx, lin_inter_set);
                 CEXPORT1(favx, lin_inter_mul2);
@@ -553,19 +584,33 @@
 
                     CEXPORT2(favx, direct_fft, direct_fft_fma3);
                     CEXPORT2(favx, reverse_fft, reverse_fft_fma3);
+                    CEXPORT2(favx, direct_fft_f64, direct_fft_f64_fma3);
+                    CEXPORT2(favx, reverse_fft_f64, reverse_fft_f64_fma3);
                     CEXPORT2(favx, packed_direct_fft, packed_direct_fft_fma3);
                     CEXPORT2(favx, packed_reverse_fft, packed_reverse_fft_fma3);
+                    CEXPORT2(favx, real_direct_fft, real_direct_fft_fma3);
+                    CEXPORT2(favx, real_reverse_fft, real_reverse_fft_fma3);
+                    CEXPORT2(favx, plan_packed_direct_fft, plan_packed_direct_fft_fma3);
+                    CEXPORT2(favx, plan_packed_reverse_fft, plan_packed_reverse_fft_fma3);
+                    CEXPORT2(favx, plan_packed_direct_fft_batch, plan_packed_direct_fft_batch_fma3);
+                    CEXPORT2(favx, plan_packed_reverse_fft_batch, plan_packed_reverse_fft_batch_fma3);
+                    CEXPORT2(favx, plan_packed_direct_fft_batch_ptr, plan_packed_direct_fft_batch_ptr_fma3);
+                    CEXPORT2(favx, plan_packed_reverse_fft_batch_ptr, plan_packed_reverse_fft_batch_ptr_fma3);
 
                     CEXPORT2(favx, fastconv_parse, fastconv_parse_fma3);
                     CEXPORT2(favx, fastconv_restore, fastconv_restore_fma3);
                     CEXPORT2(favx, fastconv_apply, fastconv_apply_fma3);
                     CEXPORT2(favx, fastconv_parse_apply, fastconv_parse_apply_fma3);
+                    CEXPORT2(favx, fastconv_fmadd, fastconv_fmadd_fma3);
+                    CEXPORT2(favx, sdft_process, sdft_process_fma3);
 
                     CEXPORT2(favx, filter_transfer_calc_ri, filter_transfer_calc_ri_fma3);
                     CEXPORT2(favx, filter_transfer_apply_ri, filter_transfer_apply_ri_fma3);
                     CEXPORT2(favx, filter_transfer_calc_pc, filter_transfer_calc_pc_fma3);
                     CEXPORT2(favx, filter_transfer_apply_pc, filter_transfer_apply_pc_fma3);
 
+                    CEXPORT2(favx, fir_decimate, fir_decimate_fma3);
+
                     CEXPORT2(favx, convolve, convolve_fma3);
                     CEXPORT2(favx, corr_init, corr_init_fma3);
                     CEXPORT2(favx, corr_incr, corr_incr_fma3);
@@ -576,6 +621,12 @@
                     CEXPORT2(favx, biquad_process_x2, biquad_process_x2_fma3);
                     CEXPORT2(favx, biquad_process_x4, biquad_process_x4_fma3);
                     CEXPORT2(ffma, biquad_process_x8, biquad_process_x8_fma3);
+                    CEXPORT2(favx, biquad_process_c4, biquad_process_c4_fma3);
+                    CEXPORT2(favx, biquad_process_c8, biquad_process_c8_fma3);
+                    CEXPORT2(favx, biquad_process_c16, biquad_process_c16_fma3);
+                    CEXPORT2_X64(favx, biquad_process_s8, x64_biquad_process_s8_fma3);
+                    CEXPORT2(favx, biquad_process_x4_f64, biquad_process_x4_f64_fma3);
+                    CEXPORT2(favx, biquad_process_x8_f64, biquad_process_x8_f64_fma3);
 
                     CEXPORT2(ffma, dyn_biquad_process_x1, dyn_biquad_process_x1_fma3);
                     CEXPORT2(favx, dyn_biquad_process_x2, dyn_biquad_process_x2_fma3);
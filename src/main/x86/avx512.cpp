@@ -48,6 +48,7 @@
         #include <private/dsp/arch/x86/avx512/dynamics.h>
         #include <private/dsp/arch/x86/avx512/float.h>
         #include <private/dsp/arch/x86/avx512/fft.h>
+        #include <private/dsp/arch/x86/avx512/filters.h>
         #include <private/dsp/arch/x86/avx512/graphics/axis.h>
         #include <private/dsp/arch/x86/avx512/hmath.h>
         #include <private/dsp/arch/x86/avx512/msmatrix.h>
@@ -56,6 +57,7 @@
         #include <private/dsp/arch/x86/avx512/search.h>
         #include <private/dsp/arch/x86/avx512/mix.h>
         #include <private/dsp/arch/x86/avx512/pan.h>
+        #include <private/dsp/arch/x86/avx512/resampling.h>
 
         #include <private/dsp/arch/x86/avx512/correlation.h>
     #undef PRIVATE_DSP_ARCH_X86_AVX512_IMPL
@@ -281,6 +283,7 @@
                 CEXPORT1(vl, pcomplex_rdiv2);
                 CEXPORT1(vl, pcomplex_div3);
                 CEXPORT1(vl, pcomplex_r2c);
+                CEXPORT1(vl, pcomplex_r2c_mul3);
                 CEXPORT1(vl, pcomplex_r2c_add2);
                 CEXPORT1(vl, pcomplex_r2c_rsub2);
                 CEXPORT1(vl, pcomplex_r2c_sub2);
@@ -330,6 +333,8 @@
                 CEXPORT1(vl, corr_init);
                 CEXPORT1(vl, corr_incr);
 
+                CEXPORT1(vl, fir_decimate);
+
                 CEXPORT1(vl, depan_lin);
                 CEXPORT1(vl, depan_eqpow);
 
@@ -346,15 +351,24 @@
                 CEXPORT1(vl, h_sum);
                 CEXPORT1(vl, h_sqr_sum);
                 CEXPORT1(vl, h_abs_sum);
+                CEXPORT1(vl, h_sum_f64);
 
                 CEXPORT1(vl, h_dotp);
                 CEXPORT1(vl, h_sqr_dotp);
                 CEXPORT1(vl, h_abs_dotp);
+                CEXPORT1(vl, h_dotp_f64);
 
                 CEXPORT1(vl, direct_fft);
                 CEXPORT1(vl, reverse_fft);
                 CEXPORT1(vl, normalize_fft2);
                 CEXPORT1(vl, normalize_fft3);
+
+                CEXPORT2_X64(vl, biquad_process_x8, x64_biquad_process_x8);
+                CEXPORT2_X64(vl, biquad_process_x16, x64_biquad_process_x16);
+                CEXPORT2_X64(vl, biquad_process_c16, x64_biquad_process_c16);
+                CEXPORT2_X64(vl, dyn_biquad_process_x8, x64_dyn_biquad_process_x8);
+                CEXPORT2_X64(vl, dyn_biquad_process_x16, x64_dyn_biquad_process_x16);
+                CEXPORT2_X64(vl, bilinear_transform_x16, x64_bilinear_transform_x16);
             }
         } /* namespace avx2 */
     } /* namespace lsp */
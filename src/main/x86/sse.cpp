@@ -58,7 +58,11 @@
         #include <private/dsp/arch/x86/sse/smath.h>
 
         #include <private/dsp/arch/x86/sse/fft.h>
+        #include <private/dsp/arch/x86/sse/rfft.h>
+        #include <private/dsp/arch/x86/sse/fftplan.h>
+        #include <private/dsp/arch/x86/sse/fftbatch.h>
         #include <private/dsp/arch/x86/sse/fastconv.h>
+        #include <private/dsp/arch/x86/sse/sdft.h>
         #include <private/dsp/arch/x86/sse/graphics.h>
         #include <private/dsp/arch/x86/sse/msmatrix.h>
         #include <private/dsp/arch/x86/sse/resampling.h>
@@ -298,6 +302,16 @@
                 EXPORT1(normalize_fft3);
                 EXPORT1(packed_direct_fft);
                 EXPORT1(packed_reverse_fft);
+                EXPORT1(real_direct_fft);
+                EXPORT1(real_reverse_fft);
+                EXPORT1(plan_direct_fft);
+                EXPORT1(plan_reverse_fft);
+                EXPORT1(plan_packed_direct_fft);
+                EXPORT1(plan_packed_reverse_fft);
+                EXPORT1(plan_packed_direct_fft_batch);
+                EXPORT1(plan_packed_reverse_fft_batch);
+                EXPORT1(plan_packed_direct_fft_batch_ptr);
+                EXPORT1(plan_packed_reverse_fft_batch_ptr);
         //            EXPORT1(center_fft);
         //            EXPORT1(combine_fft);
 
@@ -305,6 +319,9 @@
                 EXPORT1(fastconv_parse_apply);
                 EXPORT1(fastconv_restore);
                 EXPORT1(fastconv_apply);
+                EXPORT1(fastconv_fmadd);
+
+                EXPORT1(sdft_process);
 
                 EXPORT1(complex_mul2);
                 EXPORT1(complex_mul3);
@@ -323,6 +340,7 @@
                 EXPORT1(pcomplex_rcp1);
                 EXPORT1(pcomplex_rcp2);
                 EXPORT1(pcomplex_r2c);
+                EXPORT1(pcomplex_r2c_mul3);
                 EXPORT1(pcomplex_c2r);
                 EXPORT1(pcomplex_mod);
                 EXPORT1(pcomplex_corr);
@@ -347,6 +365,10 @@
                 EXPORT1(biquad_process_x2);
                 EXPORT1(biquad_process_x4);
                 EXPORT1(biquad_process_x8);
+                EXPORT1(biquad_process_c4);
+                EXPORT1(biquad_process_c8);
+                EXPORT1(biquad_process_c16);
+                EXPORT1(biquad_process_s8);
 
                 EXPORT1(dyn_biquad_process_x1);
                 EXPORT1(dyn_biquad_process_x2);
@@ -397,6 +419,7 @@
                 EXPORT1(downsample_4x);
                 EXPORT1(downsample_6x);
                 EXPORT1(downsample_8x);
+                EXPORT1(fir_decimate);
 
                 // 3D Math
                 EXPORT1(init_point_xyz);
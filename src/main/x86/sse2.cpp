@@ -26,6 +26,7 @@
     #include <lsp-plug.in/dsp/dsp.h>
     #include <lsp-plug.in/common/bits.h>
     #include <lsp-plug.in/stdlib/math.h>
+    #include <lsp-plug.in/stdlib/string.h>
 
     // Test framework
     #ifdef LSP_TESTING
@@ -46,6 +47,13 @@
 
         #include <private/dsp/arch/x86/sse2/float.h>
 
+        #include <private/dsp/arch/x86/sse2/hmath/hsum.h>
+        #include <private/dsp/arch/x86/sse2/hmath/hdotp.h>
+
+        #include <private/dsp/arch/x86/sse2/correlation.h>
+        #include <private/dsp/arch/x86/sse2/fft_f64.h>
+        #include <private/dsp/arch/x86/sse2/filters/static.h>
+
         #include <private/dsp/arch/x86/sse2/search/iminmax.h>
 
         #include <private/dsp/arch/x86/sse2/graphics/axis.h>
@@ -129,6 +137,20 @@
 
                 EXPORT1(lanczos1);
 
+                EXPORT1(h_sum_f64);
+                EXPORT1(h_dotp_f64);
+
+                EXPORT1(corr_init_f64);
+                EXPORT1(corr_incr_f64);
+
+                EXPORT1(direct_fft_f64);
+                EXPORT1(reverse_fft_f64);
+
+                EXPORT1(biquad_process_x1_f64);
+                EXPORT1(biquad_process_x2_f64);
+                EXPORT1(biquad_process_x4_f64);
+                EXPORT1(biquad_process_x8_f64);
+
                 EXPORT1(min_index);
                 EXPORT1(max_index);
                 EXPORT1(minmax_index);
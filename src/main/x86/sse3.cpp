@@ -47,6 +47,7 @@
         #include <private/dsp/arch/x86/sse3/filters/dynamic.h>
         #include <private/dsp/arch/x86/sse3/filters/transform.h>
         #include <private/dsp/arch/x86/sse3/pcomplex.h>
+        #include <private/dsp/arch/x86/sse3/dft.h>
         #include <private/dsp/arch/x86/sse3/3dmath.h>
         #include <private/dsp/arch/x86/sse3/correlation.h>
     #undef PRIVATE_DSP_ARCH_X86_SSE3_IMPL
@@ -99,6 +100,8 @@
                 EXPORT2_X64(axis_apply_log2, x64_axis_apply_log2);
                 EXPORT2_X64(pcomplex_mul2, x64_pcomplex_mul2);
                 EXPORT2_X64(pcomplex_mul3, x64_pcomplex_mul3);
+                EXPORT2_X64(packed_direct_dft, x64_packed_direct_dft);
+                EXPORT2_X64(packed_reverse_dft, x64_packed_reverse_dft);
 
                 EXPORT2_X64(rgba32_to_bgra32, x64_rgba32_to_bgra32);
 
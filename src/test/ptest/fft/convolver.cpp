@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_IR_RANK     12
+#define MAX_IR_RANK     16
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::convolver_t *convolver_create(const float *ir, size_t length, size_t rank, size_t max_rank);
+        void convolver_destroy(dsp::convolver_t *cv);
+        void convolver_process(dsp::convolver_t *cv, float *dst, const float *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for partitioned convolver
+PTEST_BEGIN("dsp.fft", convolver, 10, 1000)
+
+    void call(const char *label, float *out, const float *in, const float *ir, size_t length, size_t rank, size_t max_rank)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d (rank %d..%d)", label, int(length), int(rank), int(max_rank));
+        printf("Testing %s...\n", buf);
+
+        dsp::convolver_t *cv = generic::convolver_create(ir, length, rank, max_rank);
+        if (cv == NULL)
+            return;
+
+        PTEST_LOOP(buf,
+            generic::convolver_process(cv, out, in, BUF_SIZE);
+        );
+
+        generic::convolver_destroy(cv);
+    }
+
+    PTEST_MAIN
+    {
+        size_t ir_size  = 1 << MAX_IR_RANK;
+        size_t alloc    = ir_size + BUF_SIZE * 2;
+
+        uint8_t *data   = NULL;
+        float *ir       = alloc_aligned<float>(data, alloc, 64);
+        float *in       = &ir[ir_size];
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < alloc; ++i)
+            ir[i]           = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_IR_RANK; rank <= MAX_IR_RANK; ++rank)
+        {
+            size_t length   = 1 << rank;
+
+            call("uniform", out, in, ir, length, 8, 8);
+            call("uniform", out, in, ir, length, 11, 11);
+            call("non-uniform", out, in, ir, length, 8, 11);
+            call("non-uniform", out, in, ir, length, 8, 14);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
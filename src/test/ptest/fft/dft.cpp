@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MAX_SIZE        65536
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::dft_plan_t *dft_plan_create(size_t size);
+        void dft_plan_destroy(dsp::dft_plan_t *plan);
+        void packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    typedef void (* packed_dft_t)(dsp::dft_plan_t *plan, float *dst, const float *src);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for DFT of arbitrary size compared to the power-of-two sizes
+PTEST_BEGIN("dsp.fft", dft, 10, 1000)
+
+    void call(const char *label, float *dst, const float *src, size_t size, packed_dft_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        dsp::dft_plan_t *plan = generic::dft_plan_create(size);
+        if (plan == NULL)
+            return;
+        lsp_finally { generic::dft_plan_destroy(plan); };
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(size));
+        printf("Testing %s samples ...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(plan, dst, src);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        static const size_t sizes[] =
+        {
+            480, 512, 960, 1000, 1021, 1024, 1920, 2048,
+            3000, 4096, 44100, 48000, 65536
+        };
+
+        uint8_t *data   = NULL;
+
+        float *src      = alloc_aligned<float>(data, MAX_SIZE * 4, 64);
+        float *dst      = &src[MAX_SIZE * 2];
+
+        for (size_t i=0; i < MAX_SIZE * 2; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+
+        #define CALL(func) \
+            call(#func, dst, src, sizes[i], func)
+
+        for (size_t i=0; i < sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            CALL(generic::packed_direct_dft);
+            IF_ARCH_X86_64(CALL(sse3::x64_packed_direct_dft));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
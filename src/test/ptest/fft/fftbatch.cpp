@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        6
+#define MAX_RANK        12
+#define CHANNELS        64
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+        }
+
+        namespace avx
+        {
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_direct_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_direct_fft_batch_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+        }
+    )
+
+    typedef void (* plan_packed_direct_fft_t) (const dsp::fft_plan_t *plan, float *dst, const float *src);
+    typedef void (* plan_packed_direct_fft_batch_t) (const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for batched FFT: CHANNELS transforms of the same rank
+PTEST_BEGIN("dsp.fft", fftbatch, 10, 1000)
+
+    void call(const char *label, float *dst, const float *src, const dsp::fft_plan_t *plan, size_t rank, plan_packed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        size_t stride   = size_t(2) << rank;
+        snprintf(buf, sizeof(buf), "%s %d x %d", label, int(CHANNELS), int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<CHANNELS; ++i)
+                fft(plan, &dst[i * stride], &src[i * stride]);
+        )
+    }
+
+    void call(const char *label, float *dst, const float *src, const dsp::fft_plan_t *plan, size_t rank, plan_packed_direct_fft_batch_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        size_t stride   = size_t(2) << rank;
+        snprintf(buf, sizeof(buf), "%s %d x %d", label, int(CHANNELS), int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, dst, src, stride, CHANNELS);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = (size_t(2) << MAX_RANK) * CHANNELS;
+
+        uint8_t *data   = NULL;
+        float *sig      = alloc_aligned<float>(data, buf_size * 2, 64);
+        float *spc      = &sig[buf_size];
+        lsp_finally { free_aligned(data); };
+
+        for (size_t i=0; i < buf_size; ++i)
+            sig[i]          = randf(-1.0f, 1.0f);
+
+        #define CALL(func) \
+            call(#func, spc, sig, plan, i, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            dsp::fft_plan_t *plan = generic::fft_plan_create(i);
+            if (plan == NULL)
+                continue;
+            lsp_finally { generic::fft_plan_destroy(plan); };
+
+            CALL(generic::plan_packed_direct_fft);
+            CALL(generic::plan_packed_direct_fft_batch);
+            IF_ARCH_X86(CALL(sse::plan_packed_direct_fft));
+            IF_ARCH_X86(CALL(sse::plan_packed_direct_fft_batch));
+            IF_ARCH_X86(CALL(avx::plan_packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::plan_packed_direct_fft_batch));
+            IF_ARCH_X86(CALL(avx::plan_packed_direct_fft_fma3));
+            IF_ARCH_X86(CALL(avx::plan_packed_direct_fft_batch_fma3));
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
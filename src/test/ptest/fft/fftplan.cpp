@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 12
+#define MAX_RANK 22
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_direct_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    typedef void (* packed_direct_fft_t) (float *dst, const float *src, size_t rank);
+    typedef void (* plan_packed_direct_fft_t) (const dsp::fft_plan_t *plan, float *dst, const float *src);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for FFT with precomputed plan
+PTEST_BEGIN("dsp.fft", fftplan, 10, 1000)
+
+    void call(const char *label, float *dst, const float *src, size_t rank, packed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(dst, src, rank);
+        )
+    }
+
+    void call(const char *label, float *dst, const float *src, const dsp::fft_plan_t *plan, size_t rank, plan_packed_direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(plan, dst, src);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t fft_size = 1 << MAX_RANK;
+
+        uint8_t *data   = NULL;
+
+        float *sig      = alloc_aligned<float>(data, fft_size * 4, 64);
+        float *spc      = &sig[fft_size * 2];
+        lsp_finally { free_aligned(data); };
+
+        for (size_t i=0; i < fft_size; ++i)
+        {
+            sig[i*2]        = randf(0.0f, 1.0f);
+            sig[i*2+1]      = 0.0f;
+        }
+
+        #define CALL(func) \
+            call(#func, spc, sig, i, func)
+        #define PCALL(func) \
+            call(#func, spc, sig, plan, i, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            dsp::fft_plan_t *plan = generic::fft_plan_create(i);
+            if (plan == NULL)
+                continue;
+            lsp_finally { generic::fft_plan_destroy(plan); };
+
+            CALL(generic::packed_direct_fft);
+            PCALL(generic::plan_packed_direct_fft);
+            IF_ARCH_X86(CALL(sse::packed_direct_fft));
+            IF_ARCH_X86(PCALL(sse::plan_packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft));
+            IF_ARCH_X86(PCALL(avx::plan_packed_direct_fft));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_fma3));
+            IF_ARCH_X86(PCALL(avx::plan_packed_direct_fft_fma3));
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_IR_RANK     12
+#define MAX_IR_RANK     16
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::hconvolver_t *hconvolver_create(const float *ir, size_t length, size_t head, size_t max_rank);
+        void hconvolver_destroy(dsp::hconvolver_t *cv);
+        void hconvolver_process(dsp::hconvolver_t *cv, float *dst, const float *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for zero-latency hybrid convolver
+PTEST_BEGIN("dsp.fft", hconvolver, 10, 1000)
+
+    void call(float *out, const float *in, const float *ir, size_t length, size_t head, size_t max_rank, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%d x %d (head %d, max_rank %d)", int(length), int(block), int(head), int(max_rank));
+        printf("Testing %s...\n", buf);
+
+        dsp::hconvolver_t *cv = generic::hconvolver_create(ir, length, head, max_rank);
+        if (cv == NULL)
+            return;
+
+        PTEST_LOOP(buf,
+            for (size_t off=0; off < BUF_SIZE; off += block)
+                generic::hconvolver_process(cv, &out[off], &in[off], block);
+        );
+
+        generic::hconvolver_destroy(cv);
+    }
+
+    PTEST_MAIN
+    {
+        size_t ir_size  = 1 << MAX_IR_RANK;
+        size_t alloc    = ir_size + BUF_SIZE * 2;
+
+        uint8_t *data   = NULL;
+        float *ir       = alloc_aligned<float>(data, alloc, 64);
+        float *in       = &ir[ir_size];
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < alloc; ++i)
+            ir[i]           = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_IR_RANK; rank <= MAX_IR_RANK; ++rank)
+        {
+            size_t length   = 1 << rank;
+
+            call(out, in, ir, length, 64, 11, 64);
+            call(out, in, ir, length, 64, 14, 64);
+            call(out, in, ir, length, 256, 11, 256);
+            call(out, in, ir, length, 256, 14, 256);
+            call(out, in, ir, length, 256, 14, BUF_SIZE);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
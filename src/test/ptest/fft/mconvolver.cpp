@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        7
+#define MAX_RANK        11
+#define MAX_INPUTS      16
+#define MAX_OUTPUTS     32
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::mconvolver_t *mconvolver_create(const float * const *ir, size_t inputs, size_t outputs, size_t length, size_t rank);
+        void mconvolver_destroy(dsp::mconvolver_t *cv);
+        void mconvolver_process(dsp::mconvolver_t *cv, float * const *dst, const float * const *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for multi-input multi-output convolution matrix
+PTEST_BEGIN("dsp.fft", mconvolver, 10, 1000)
+
+    void call(float *out, const float *in, const float *ir, float *spec, float *tmp, size_t inputs, size_t outputs, size_t rank)
+    {
+        const size_t block  = size_t(1) << (rank - 1);
+        const size_t bins   = block << 2;
+        const size_t pairs  = inputs * outputs;
+
+        const float *vir[MAX_INPUTS * MAX_OUTPUTS];
+        const float *vin[MAX_INPUTS];
+        float *vout[MAX_OUTPUTS];
+        for (size_t i=0; i<pairs; ++i)
+            vir[i]          = &ir[i * block];
+        for (size_t i=0; i<inputs; ++i)
+            vin[i]          = &in[i * block];
+        for (size_t i=0; i<outputs; ++i)
+            vout[i]         = &out[i * block * 2];
+
+        // Convolution of each pair by fastconv_parse_apply() with single partition
+        char buf[80];
+        snprintf(buf, sizeof(buf), "pairwise %dx%d x %d", int(inputs), int(outputs), int(block));
+        printf("Testing %s...\n", buf);
+
+        for (size_t i=0; i<pairs; ++i)
+            dsp::fastconv_parse(&spec[i * bins], vir[i], rank);
+
+        PTEST_LOOP(buf,
+            for (size_t o=0; o<outputs; ++o)
+                for (size_t i=0; i<inputs; ++i)
+                    dsp::fastconv_parse_apply(vout[o], tmp, &spec[(o * inputs + i) * bins], vin[i], rank);
+        );
+
+        // Convolution by the matrix with shared input spectra
+        snprintf(buf, sizeof(buf), "matrix %dx%d x %d", int(inputs), int(outputs), int(block));
+        printf("Testing %s...\n", buf);
+
+        dsp::mconvolver_t *cv = generic::mconvolver_create(vir, inputs, outputs, block, rank);
+        if (cv == NULL)
+            return;
+
+        PTEST_LOOP(buf,
+            generic::mconvolver_process(cv, vout, vin, block);
+        );
+
+        generic::mconvolver_destroy(cv);
+    }
+
+    PTEST_MAIN
+    {
+        const size_t max_block  = size_t(1) << (MAX_RANK - 1);
+        const size_t pairs      = MAX_INPUTS * MAX_OUTPUTS;
+        size_t alloc            = max_block * (pairs + MAX_INPUTS + MAX_OUTPUTS * 2 + pairs * 4 + 4);
+
+        uint8_t *data   = NULL;
+        float *ir       = alloc_aligned<float>(data, alloc, 64);
+        float *in       = &ir[max_block * pairs];
+        float *out      = &in[max_block * MAX_INPUTS];
+        float *spec     = &out[max_block * MAX_OUTPUTS * 2];
+        float *tmp      = &spec[max_block * pairs * 4];
+
+        for (size_t i=0; i < alloc; ++i)
+            ir[i]           = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+        {
+            call(out, in, ir, spec, tmp, 2, 2, rank);
+            call(out, in, ir, spec, tmp, 4, 8, rank);
+            call(out, in, ir, spec, tmp, 16, 32, rank);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
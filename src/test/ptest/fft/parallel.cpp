@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        14
+#define MAX_RANK        22
+#define MAX_THREADS     4
+#define CONV_LENGTH     65536
+#define CONV_COUNT      (1 << 20)
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+
+        dsp::workers_t *workers_create(size_t threads);
+        void workers_destroy(dsp::workers_t *pool);
+        void parallel_packed_direct_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void parallel_convolve(dsp::workers_t *pool, float *dst, const float *src, const float *conv, size_t length, size_t count, size_t rank);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for parallel FFT and convolution
+PTEST_BEGIN("dsp.fft", parallel, 10, 100)
+
+    void call_fft(float *dst, const float *src, const dsp::fft_plan_t *plan, dsp::workers_t *pool, size_t threads, size_t rank)
+    {
+        char buf[80];
+        if (pool != NULL)
+            snprintf(buf, sizeof(buf), "parallel_packed_direct_fft %d threads x %d", int(threads), int(1 << rank));
+        else
+            snprintf(buf, sizeof(buf), "plan_packed_direct_fft x %d", int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        if (pool != NULL)
+        {
+            PTEST_LOOP(buf,
+                generic::parallel_packed_direct_fft(pool, plan, dst, src);
+            )
+        }
+        else
+        {
+            PTEST_LOOP(buf,
+                dsp::plan_packed_direct_fft(plan, dst, src);
+            )
+        }
+    }
+
+    void call_conv(float *dst, const float *src, const float *conv, dsp::workers_t *pool, size_t threads, size_t rank)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "parallel_convolve %d threads, rank=%d", int(threads), int(rank));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            generic::parallel_convolve(pool, dst, src, conv, CONV_LENGTH, CONV_COUNT, rank);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t fft_size = 1 << MAX_RANK;
+        size_t to_alloc = lsp_max(fft_size * 4, CONV_COUNT * 2 + CONV_LENGTH * 2);
+
+        uint8_t *data   = NULL;
+        float *sig      = alloc_aligned<float>(data, to_alloc, 64);
+        lsp_finally { free_aligned(data); };
+
+        for (size_t i=0; i < to_alloc; ++i)
+            sig[i]          = randf(-1.0f, 1.0f);
+
+        dsp::workers_t *pools[MAX_THREADS];
+        for (size_t i=0; i<MAX_THREADS; ++i)
+            pools[i]        = generic::workers_create(i + 1);
+        lsp_finally {
+            for (size_t i=0; i<MAX_THREADS; ++i)
+                generic::workers_destroy(pools[i]);
+        };
+
+        // Parallel FFT
+        float *spc      = &sig[fft_size * 2];
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            dsp::fft_plan_t *plan = generic::fft_plan_create(i);
+            if (plan == NULL)
+                continue;
+            lsp_finally { generic::fft_plan_destroy(plan); };
+
+            call_fft(spc, sig, plan, NULL, 1, i);
+            for (size_t j=0; j<MAX_THREADS; ++j)
+                if (pools[j] != NULL)
+                    call_fft(spc, sig, plan, pools[j], j + 1, i);
+            PTEST_SEPARATOR;
+        }
+
+        // Parallel convolution
+        float *conv     = &sig[CONV_COUNT];
+        float *dst      = &conv[CONV_LENGTH];
+        for (size_t rank=10; rank <= 14; rank += 2)
+        {
+            for (size_t j=0; j<MAX_THREADS; ++j)
+                if (pools[j] != NULL)
+                    call_conv(dst, sig, conv, pools[j], j + 1, rank);
+            PTEST_SEPARATOR;
+        }
+    }
+PTEST_END
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void real_direct_fft(float *dst, const float *src, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+        }
+
+        namespace avx
+        {
+            void packed_direct_fft(float *dst, const float *src, size_t rank);
+            void packed_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_direct_fft_fma3(float *dst, const float *src, size_t rank);
+        }
+    )
+
+    typedef void (* direct_fft_t) (float *dst, const float *src, size_t rank);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for real FFT compared to the complex FFT of the real signal
+PTEST_BEGIN("dsp.fft", rfft, 10, 1000)
+
+    void call(const char *label, float *dst, const float *src, size_t rank, direct_fft_t fft)
+    {
+        if (!PTEST_SUPPORTED(fft))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(1 << rank));
+        printf("Testing %s samples (rank = %d) ...\n", buf, int(rank));
+
+        PTEST_LOOP(buf,
+            fft(dst, src, rank);
+        )
+    }
+
+    PTEST_MAIN
+    {
+        size_t fft_size = 1 << MAX_RANK;
+
+        uint8_t *data   = NULL;
+
+        float *real     = alloc_aligned<float>(data, fft_size * 6 + 2, 64);
+        float *cplx     = &real[fft_size];
+        float *out      = &cplx[fft_size * 2];
+
+        for (size_t i=0; i < fft_size; ++i)
+        {
+            real[i]         = randf(0.0f, 1.0f);
+            cplx[i*2]       = real[i];
+            cplx[i*2+1]     = 0.0f;
+        }
+
+        #define CALL(func, src) \
+            call(#func, out, src, i, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            CALL(generic::packed_direct_fft, cplx);
+            CALL(generic::real_direct_fft, real);
+            IF_ARCH_X86(CALL(sse::packed_direct_fft, cplx));
+            IF_ARCH_X86(CALL(sse::real_direct_fft, real));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft, cplx));
+            IF_ARCH_X86(CALL(avx::real_direct_fft, real));
+            IF_ARCH_X86(CALL(avx::packed_direct_fft_fma3, cplx));
+            IF_ARCH_X86(CALL(avx::real_direct_fft_fma3, real));
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MAX_BINS        64
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        void sdft_init(dsp::sdft_x8_t *bank, const float *freq, float length, size_t bins);
+        void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+        }
+
+        namespace avx
+        {
+            void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+            void sdft_process_fma3(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+        }
+    )
+
+    typedef void (* sdft_process_t)(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for sliding DFT bank
+PTEST_BEGIN("dsp.fft", sdft, 5, 1000)
+
+    void call(const char *label, dsp::sdft_x8_t *bank, const float *src, size_t bins, sdft_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(bins));
+        printf("Testing %s bins...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(bank, src, bins, BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        uint8_t *bdata      = NULL;
+        float *src          = alloc_aligned<float>(data, BUF_SIZE + MAX_BINS, 64);
+        float *freq         = &src[BUF_SIZE];
+        dsp::sdft_x8_t *b   = alloc_aligned<dsp::sdft_x8_t>(bdata, MAX_BINS / 8, LSP_DSP_SDFT_ALIGN);
+
+        for (size_t i=0; i<BUF_SIZE; ++i)
+            src[i]              = randf(-1.0f, 1.0f);
+        for (size_t i=0; i<MAX_BINS; ++i)
+            freq[i]             = randf(0.0f, 0.5f);
+
+        #define CALL(func) \
+            call(#func, b, src, bins, func)
+
+        for (size_t bins=8; bins <= MAX_BINS; bins <<= 1)
+        {
+            generic::sdft_init(b, freq, 1000.0f, bins);
+
+            CALL(generic::sdft_process);
+            IF_ARCH_X86(CALL(sse::sdft_process));
+            IF_ARCH_X86(CALL(avx::sdft_process));
+            IF_ARCH_X86(CALL(avx::sdft_process_fma3));
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(bdata);
+        free_aligned(data);
+    }
+PTEST_END
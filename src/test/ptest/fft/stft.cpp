@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        14
+#define BUF_SIZE        4096
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::stft_t *stft_create(size_t rank, size_t hop, const float *window);
+        void stft_destroy(dsp::stft_t *st);
+        size_t stft_process(dsp::stft_t *st, float *dst, const float *src, size_t count, dsp::stft_callback_t func, void *arg);
+    }
+
+    // Typical hand-written STFT loop: shift the history, window the frame, transform,
+    // transform back, window again and overlap-add with separate passes over memory
+    typedef struct naive_stft_t
+    {
+        size_t      rank;
+        size_t      hop;
+        size_t      fill;
+        const float*wnd;
+        float      *in;
+        float      *ola;
+        float      *frame;
+        float      *spectrum;
+    } naive_stft_t;
+
+    static void naive_stft_process(naive_stft_t *st, float *dst, const float *src, size_t count)
+    {
+        const size_t n      = size_t(1) << st->rank;
+
+        while (count > 0)
+        {
+            size_t to_do        = lsp_min(count, st->hop - st->fill);
+            dsp::copy(&st->in[n - st->hop + st->fill], src, to_do);
+            dsp::copy(dst, &st->ola[st->fill], to_do);
+            st->fill           += to_do;
+            src                += to_do;
+            dst                += to_do;
+            count              -= to_do;
+            if (st->fill < st->hop)
+                break;
+
+            dsp::copy(st->frame, st->in, n);
+            dsp::mul2(st->frame, st->wnd, n);
+            dsp::real_direct_fft(st->spectrum, st->frame, st->rank);
+            dsp::real_reverse_fft(st->frame, st->spectrum, st->rank);
+            dsp::mul2(st->frame, st->wnd, n);
+            dsp::move(st->ola, &st->ola[st->hop], n - st->hop);
+            dsp::fill_zero(&st->ola[n - st->hop], st->hop);
+            dsp::add2(st->ola, st->frame, n);
+            dsp::move(st->in, &st->in[st->hop], n - st->hop);
+            st->fill            = 0;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for STFT engine
+PTEST_BEGIN("dsp.fft", stft, 10, 1000)
+
+    void call_naive(float *out, const float *in, float *buf, const float *wnd, size_t rank, size_t hop)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "naive rank=%d hop=%d", int(rank), int(hop));
+        printf("Testing %s...\n", label);
+
+        const size_t n      = size_t(1) << rank;
+        naive_stft_t st;
+        st.rank             = rank;
+        st.hop              = hop;
+        st.fill             = 0;
+        st.wnd              = wnd;
+        st.in               = buf;
+        st.ola              = &buf[n];
+        st.frame            = &buf[n * 2];
+        st.spectrum         = &buf[n * 3];
+        dsp::fill_zero(buf, n * 4 + 2);
+
+        PTEST_LOOP(label,
+            naive_stft_process(&st, out, in, BUF_SIZE);
+        );
+    }
+
+    void call_stft(float *out, const float *in, const float *wnd, size_t rank, size_t hop)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "stft rank=%d hop=%d", int(rank), int(hop));
+        printf("Testing %s...\n", label);
+
+        dsp::stft_t *st     = generic::stft_create(rank, hop, wnd);
+        if (st == NULL)
+            return;
+
+        PTEST_LOOP(label,
+            generic::stft_process(st, out, in, BUF_SIZE, NULL, NULL);
+        );
+
+        generic::stft_destroy(st);
+    }
+
+    PTEST_MAIN
+    {
+        size_t max_size = size_t(1) << MAX_RANK;
+        size_t alloc    = max_size * 6 + 2 + BUF_SIZE * 2;
+
+        uint8_t *data   = NULL;
+        float *wnd      = alloc_aligned<float>(data, alloc, 64);
+        float *buf      = &wnd[max_size];
+        float *in       = &buf[max_size * 4 + 2];
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; rank += 2)
+        {
+            size_t n        = size_t(1) << rank;
+            for (size_t i=0; i<n; ++i)
+                wnd[i]          = 0.5f - 0.5f * cosf(2.0f * M_PI * i / n);
+
+            call_naive(out, in, buf, wnd, rank, n >> 2);
+            call_stft(out, in, wnd, rank, n >> 2);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
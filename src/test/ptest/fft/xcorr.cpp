@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK    8
+#define MAX_RANK    14
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::xcorr_t *xcorr_create(size_t rank, size_t mode);
+        void xcorr_destroy(dsp::xcorr_t *xc);
+        size_t xcorr_process(dsp::xcorr_t *xc, const float *a, const float *b, size_t count);
+        float xcorr_estimate(dsp::xcorr_t *xc, float *corr);
+    }
+
+    // Direct computation of all lags of the frame with the dot product
+    static void direct_xcorr(float *corr, const float *a, const float *b, size_t m)
+    {
+        corr[0]     = 0.0f;
+        for (size_t i=1; i<m; ++i)
+        {
+            corr[m - i] = dsp::h_dotp(a, &b[i], m - i);
+            corr[m + i] = dsp::h_dotp(&a[i], b, m - i);
+        }
+        corr[m]     = dsp::h_dotp(a, b, m);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for cross-correlation engine
+PTEST_BEGIN("dsp.fft", xcorr, 5, 1000)
+
+    void call_direct(float *corr, const float *a, const float *b, size_t rank)
+    {
+        char buf[80];
+        size_t m = size_t(1) << (rank - 1);
+        snprintf(buf, sizeof(buf), "direct x %d", int(m));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            direct_xcorr(corr, a, b, m);
+            dsp::abs_max_index(corr, m * 2);
+        );
+    }
+
+    void call_xcorr(float *corr, const float *a, const float *b, size_t rank, size_t mode)
+    {
+        char buf[80];
+        size_t m = size_t(1) << (rank - 1);
+        snprintf(buf, sizeof(buf), "xcorr %s x %d", (mode == LSP_DSP_XCORR_PHAT) ? "phat" : "plain", int(m));
+        printf("Testing %s samples...\n", buf);
+
+        dsp::xcorr_t *xc = generic::xcorr_create(rank, mode);
+        if (xc == NULL)
+            return;
+
+        PTEST_LOOP(buf,
+            generic::xcorr_process(xc, a, b, m);
+            generic::xcorr_estimate(xc, corr);
+        );
+
+        generic::xcorr_destroy(xc);
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = size_t(1) << MAX_RANK;
+        uint8_t *data       = NULL;
+        float *a            = alloc_aligned<float>(data, buf_size * 3, 64);
+        float *b            = &a[buf_size];
+        float *corr         = &b[buf_size];
+
+        for (size_t i=0; i<buf_size*2; ++i)
+            a[i]                = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; rank += 2)
+        {
+            call_direct(corr, a, b, rank);
+            call_xcorr(corr, a, b, rank, LSP_DSP_XCORR_PLAIN);
+            call_xcorr(corr, a, b, rank, LSP_DSP_XCORR_PHAT);
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        12
+#define MAX_RANK        18
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x1_bp(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+        void biquad_process_mc(float * const *dst, const float * const *src, size_t channels, size_t count, dsp::biquad_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+        }
+
+        namespace avx
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x1_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+
+            IF_ARCH_X86_64(
+                void x64_biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+                void x64_biquad_process_s8_fma3(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+            )
+        }
+    )
+
+    typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_s8_t)(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+
+    // 2 zero, 2 pole hi-pass filter
+    static dsp::biquad_x1_t bq_normal = {
+        0.992303491f, -1.98460698f, 0.992303491f,
+        1.98398674f, -0.985227287f,
+        0.0f, 0.0f, 0.0f
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for block-parallel processing of the long buffer
+PTEST_BEGIN("dsp.filters", bp, 10, 1000)
+
+    void call(const char *text, float *out, const float *in, size_t count, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", text, int(count));
+        printf("Testing %s static filter on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad_t f __lsp_aligned64;
+        dsp::fill_zero(f.d, LSP_DSP_BIQUAD_D_ITEMS);
+        f.x1    = bq_normal;
+
+        PTEST_LOOP(buf,
+            process(out, in, count, &f);
+        );
+    }
+
+    void init_bank(dsp::biquad_t *f)
+    {
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+        for (size_t i=0; i<8; ++i)
+        {
+            f->x8.b0[i]     = bq_normal.b0;
+            f->x8.b1[i]     = bq_normal.b1;
+            f->x8.b2[i]     = bq_normal.b2;
+            f->x8.a1[i]     = bq_normal.a1;
+            f->x8.a2[i]     = bq_normal.a2;
+        }
+    }
+
+    // Zero-state pass over eight chunks of the buffer as the planar channels
+    void call_mc(const char *text, float *out, const float *in, size_t count)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", text, int(count));
+        printf("Testing %s static filter on input buffer of %d samples ...\n", text, int(count));
+
+        const size_t len    = count / 8;
+        dsp::biquad_t f __lsp_aligned64;
+        float *dp[8];
+        const float *sp[8];
+        init_bank(&f);
+        for (size_t j=0; j<8; ++j)
+        {
+            dp[j]           = &out[j * len];
+            sp[j]           = &in[j * len];
+        }
+
+        PTEST_LOOP(buf,
+            generic::biquad_process_mc(dp, sp, 8, len, &f);
+        );
+    }
+
+    // Zero-state pass over eight chunks of the buffer loaded with the stride
+    void call_s8(const char *text, float *out, const float *in, size_t count, biquad_process_s8_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", text, int(count));
+        printf("Testing %s static filter on input buffer of %d samples ...\n", text, int(count));
+
+        const size_t len    = count / 8;
+        dsp::biquad_t f __lsp_aligned64;
+        init_bank(&f);
+
+        PTEST_LOOP(buf,
+            process(out, in, len, len, &f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t items        = 1 << MAX_RANK;
+        float *out          = new float[items];
+        float *in           = new float[items];
+
+        for (size_t i=0; i<items; ++i)
+        {
+            in[i]               = (i & 1) ? 1.0f : -1.0f;
+            out[i]              = 0.0f;
+        }
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count        = 1 << i;
+
+            call("generic::biquad_process_x1", out, in, count, generic::biquad_process_x1);
+            IF_ARCH_X86(call("sse::biquad_process_x1", out, in, count, sse::biquad_process_x1));
+            IF_ARCH_X86(call("avx::biquad_process_x1", out, in, count, avx::biquad_process_x1));
+            IF_ARCH_X86(call("avx::biquad_process_x1_fma3", out, in, count, avx::biquad_process_x1_fma3));
+            call("generic::biquad_process_x1_bp", out, in, count, generic::biquad_process_x1_bp);
+            PTEST_SEPARATOR;
+
+            call_mc("generic::biquad_process_mc", out, in, count);
+            call_s8("generic::biquad_process_s8", out, in, count, generic::biquad_process_s8);
+            IF_ARCH_X86(call_s8("sse::biquad_process_s8", out, in, count, sse::biquad_process_s8));
+            IF_ARCH_X86_64(call_s8("avx::x64_biquad_process_s8", out, in, count, avx::x64_biquad_process_s8));
+            IF_ARCH_X86_64(call_s8("avx::x64_biquad_process_s8_fma3", out, in, count, avx::x64_biquad_process_s8_fma3));
+            PTEST_SEPARATOR;
+        }
+
+        delete [] out;
+        delete [] in;
+    }
+
+PTEST_END
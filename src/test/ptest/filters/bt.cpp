@@ -34,6 +34,7 @@ namespace lsp
         void bilinear_transform_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         void bilinear_transform_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         void bilinear_transform_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+        void bilinear_transform_x16(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     }
 
     IF_ARCH_X86(
@@ -59,6 +60,13 @@ namespace lsp
             void bilinear_transform_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
             void x64_bilinear_transform_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_bilinear_transform_x16(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -85,6 +93,7 @@ namespace lsp
     typedef void (* bilinear_transform_x2_t)(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     typedef void (* bilinear_transform_x4_t)(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     typedef void (* bilinear_transform_x8_t)(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+    typedef void (* bilinear_transform_x16_t)(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
 
     static const dsp::f_cascade_t test_c =
     {
@@ -187,6 +196,29 @@ PTEST_BEGIN("dsp.filters", bt, 10, 10000)
         free_aligned(p2);
     }
 
+    void call(const char * label, size_t count, bilinear_transform_x16_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s bilinear transform on buffer size %d ...\n", label, int(count));
+
+        count += 15;
+        void *p1 = NULL, *p2 = NULL;
+        dsp::biquad_x16_t *dst = alloc_aligned<dsp::biquad_x16_t>(p1, count, 64);
+        dsp::f_cascade_t *src = alloc_aligned<dsp::f_cascade_t>(p2, count*16, 64);
+
+        for (size_t i=0; i<count*16; ++i)
+            src[i]  = test_c;
+
+        PTEST_LOOP(label,
+            func(dst, src, 1.0f, count);
+        );
+
+        free_aligned(p1);
+        free_aligned(p2);
+    }
+
     PTEST_MAIN
     {
         #define CALL(func) \
@@ -220,6 +252,10 @@ PTEST_BEGIN("dsp.filters", bt, 10, 10000)
         IF_ARCH_ARM(CALL(neon_d32::bilinear_transform_x8));
         IF_ARCH_AARCH64(CALL(asimd::bilinear_transform_x8));
         PTEST_SEPARATOR;
+
+        CALL(generic::bilinear_transform_x16);
+        IF_ARCH_X86_64(CALL(avx512::x64_bilinear_transform_x16));
+        PTEST_SEPARATOR;
     }
 
 PTEST_END
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <math.h>
+
+#define MIN_BANDS       8
+#define MAX_BANDS       128
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t filter_design_cascades(dsp::f_cascade_t *dst, const dsp::filter_params_t *p, size_t count);
+        size_t filter_design_bilinear(dsp::f_cascade_t *dst, const dsp::filter_params_t *p, size_t count, size_t lanes);
+    }
+
+    // Design of the equalizer band by band, each band is transformed separately
+    static void design_naive(dsp::biquad_x1_t *bf, dsp::f_cascade_t *c, const dsp::filter_params_t *p, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            size_t n    = generic::filter_design_cascades(c, &p[i], 1);
+            dsp::bilinear_transform_x1(bf, c, 1.0f / tanf(M_PI * p[i].freq), n);
+            bf         += n;
+        }
+    }
+
+    // Design of the equalizer with the single transform of all bands
+    static void design_batch(dsp::biquad_x8_t *bf, dsp::f_cascade_t *c, const dsp::filter_params_t *p, size_t count)
+    {
+        size_t n    = generic::filter_design_bilinear(c, p, count, 8);
+        dsp::bilinear_transform_x8(bf, c, 1.0f, n >> 3);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for batch filter design
+PTEST_BEGIN("dsp.filters", design, 10, 10000)
+
+    PTEST_MAIN
+    {
+        char buf[80];
+
+        void *p1 = NULL, *p2 = NULL, *p3 = NULL;
+        dsp::filter_params_t *p = alloc_aligned<dsp::filter_params_t>(p1, MAX_BANDS, 64);
+        dsp::f_cascade_t *c     = alloc_aligned<dsp::f_cascade_t>(p2, MAX_BANDS + 8, 64);
+        dsp::biquad_x8_t *bf    = alloc_aligned<dsp::biquad_x8_t>(p3, MAX_BANDS, 64);
+
+        // Parametric equalizer: peaking bands with shelving filters at the edges
+        for (size_t i=0; i<MAX_BANDS; ++i)
+        {
+            p[i].type       = LSP_DSP_FILTER_PEAK;
+            p[i].slope      = 1;
+            p[i].freq       = 0.0005f * expf(i * logf(900.0f) / MAX_BANDS);
+            p[i].gain       = 0.5f + (i % 7) * 0.25f;
+            p[i].q          = 2.0f;
+        }
+        p[0].type               = LSP_DSP_FILTER_LOSHELF;
+        p[MAX_BANDS - 1].type   = LSP_DSP_FILTER_HISHELF;
+
+        for (size_t bands=MIN_BANDS; bands <= MAX_BANDS; bands <<= 1)
+        {
+            snprintf(buf, sizeof(buf), "naive x %d", int(bands));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                design_naive(reinterpret_cast<dsp::biquad_x1_t *>(bf), c, p, bands);
+            );
+
+            snprintf(buf, sizeof(buf), "batch x %d", int(bands));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                design_batch(bf, c, p, bands);
+            );
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(p1);
+        free_aligned(p2);
+        free_aligned(p3);
+    }
+
+PTEST_END
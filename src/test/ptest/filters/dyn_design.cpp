@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <math.h>
+
+#define MIN_RANK        6
+#define MAX_RANK        12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void dyn_biquad_design_x1(dsp::biquad_x1_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x8(dsp::biquad_x8_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x16(dsp::biquad_x16_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+    }
+
+    // Per-sample design of the peaking filter from the analog prototype
+    static void design_naive(dsp::biquad_x1_t *bf, const dsp::dyn_filter_params_t *p, size_t count)
+    {
+        dsp::f_cascade_t c;
+        c.t[3]      = 0.0f;
+        c.b[3]      = 0.0f;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float a     = sqrtf(p->gain[i]);
+            float kf    = 1.0f / tanf(M_PI * p->freq[i]);
+            c.t[0]      = 1.0f;
+            c.t[1]      = a / p->q[i];
+            c.t[2]      = 1.0f;
+            c.b[0]      = 1.0f;
+            c.b[1]      = 1.0f / (a * p->q[i]);
+            c.b[2]      = 1.0f;
+
+            dsp::bilinear_transform_x1(&bf[i], &c, kf, 1);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for design of dynamic filters
+PTEST_BEGIN("dsp.filters", dyn_design, 10, 1000)
+
+    void make_params(dsp::dyn_filter_params_t *p, float *f, float *g, float *q, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float x     = float(i) / float(count);
+            f[i]        = 0.01f + 0.3f * x;
+            g[i]        = 0.5f + 3.5f * x;
+            q[i]        = 0.5f + 4.0f * x;
+        }
+
+        p->freq     = f;
+        p->gain     = g;
+        p->q        = q;
+        p->k_freq   = 0.0f;
+        p->k_gain   = 0.0f;
+        p->k_q      = 0.0f;
+        p->type     = LSP_DSP_FILTER_PEAK;
+    }
+
+    PTEST_MAIN
+    {
+        size_t count    = size_t(1) << MAX_RANK;
+        char buf[80];
+
+        void *ptr = NULL;
+        uint8_t *data   = alloc_aligned<uint8_t>(ptr,
+            count * 3 * sizeof(float) + (count + 15) * sizeof(dsp::biquad_x16_t), 64);
+        float *f        = reinterpret_cast<float *>(data);
+        float *g        = &f[count];
+        float *q        = &g[count];
+        void *bf        = &q[count];
+
+        dsp::dyn_filter_params_t p[16];
+        make_params(&p[0], f, g, q, count);
+        for (size_t i=1; i<16; ++i)
+            p[i]            = p[0];
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            count           = size_t(1) << i;
+
+            snprintf(buf, sizeof(buf), "naive x1 x %d", int(count));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                design_naive(static_cast<dsp::biquad_x1_t *>(bf), p, count);
+            );
+
+            snprintf(buf, sizeof(buf), "generic::dyn_biquad_design_x1 x %d", int(count));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                generic::dyn_biquad_design_x1(static_cast<dsp::biquad_x1_t *>(bf), p, count);
+            );
+
+            snprintf(buf, sizeof(buf), "generic::dyn_biquad_design_x8 x %d", int(count));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                generic::dyn_biquad_design_x8(static_cast<dsp::biquad_x8_t *>(bf), p, count);
+            );
+
+            snprintf(buf, sizeof(buf), "generic::dyn_biquad_design_x16 x %d", int(count));
+            printf("Testing %s...\n", buf);
+            PTEST_LOOP(buf,
+                generic::dyn_biquad_design_x16(static_cast<dsp::biquad_x16_t *>(bf), p, count);
+            );
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(ptr);
+    }
+
+PTEST_END
@@ -34,6 +34,7 @@ namespace lsp
         void dyn_biquad_process_x2(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f);
         void dyn_biquad_process_x4(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f);
         void dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+        void dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
     }
 
     IF_ARCH_X86(
@@ -64,6 +65,14 @@ namespace lsp
             void x64_dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
             void dyn_biquad_process_x8_fma3(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+                void x64_dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -90,6 +99,7 @@ namespace lsp
     typedef void (* dyn_biquad_process_x2_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f);
     typedef void (* dyn_biquad_process_x4_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f);
     typedef void (* dyn_biquad_process_x8_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+    typedef void (* dyn_biquad_process_x16_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
 
     static dsp::biquad_x1_t bq_normal = {
         1.0, 2.0, 1.0,
@@ -230,6 +240,69 @@ PTEST_BEGIN("dsp.filters", dynamic, 10, 1000)
         free_aligned(ptr);
     }
 
+    void process_2x8(const char *text, float *out, const float *in, size_t count, dyn_biquad_process_x8_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s dynamic filters on input buffer of %d samples ...\n", text, int(count));
+
+        float d[32] __lsp_aligned64;
+        for (size_t i=0; i<32; ++i)
+            d[i]     = 0.0;
+
+        void *ptr = NULL;
+        dsp::biquad_x8_t *f = alloc_aligned<dsp::biquad_x8_t>(ptr, count+7, 64);
+        for (size_t i=0; i<(count+7); ++i)
+        {
+            for (size_t j=0; j<8; ++j)
+            {
+                f[i].b0[j]  = bq_normal.b0;
+                f[i].b1[j]  = bq_normal.b1;
+                f[i].b2[j]  = bq_normal.b2;
+                f[i].a1[j]  = bq_normal.a1;
+                f[i].a2[j]  = bq_normal.a2;
+            }
+        }
+
+        PTEST_LOOP(text,
+            process(out, in, &d[0], count, f);
+            process(out, out, &d[16], count, f);
+        );
+
+        free_aligned(ptr);
+    }
+
+    void process_1x16(const char *text, float *out, const float *in, size_t count, dyn_biquad_process_x16_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s dynamic filters on input buffer of %d samples ...\n", text, int(count));
+
+        float d[32] __lsp_aligned64;
+        for (size_t i=0; i<32; ++i)
+            d[i]     = 0.0;
+
+        void *ptr = NULL;
+        dsp::biquad_x16_t *f = alloc_aligned<dsp::biquad_x16_t>(ptr, count+15, 64);
+        for (size_t i=0; i<(count+15); ++i)
+        {
+            for (size_t j=0; j<16; ++j)
+            {
+                f[i].b0[j]  = bq_normal.b0;
+                f[i].b1[j]  = bq_normal.b1;
+                f[i].b2[j]  = bq_normal.b2;
+                f[i].a1[j]  = bq_normal.a1;
+                f[i].a2[j]  = bq_normal.a2;
+            }
+        }
+
+        PTEST_LOOP(text,
+            process(out, in, d, count, f);
+        );
+
+        free_aligned(ptr);
+    }
+
     PTEST_MAIN
     {
         float *out          = new float[FTEST_BUF_SIZE];
@@ -270,10 +343,19 @@ PTEST_BEGIN("dsp.filters", dynamic, 10, 1000)
         IF_ARCH_X86(process_1x8("sse3::x64_dyn_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, sse3::x64_dyn_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::x64_dyn_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx::x64_dyn_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::dyn_biquad_process_x8_fma3 x1", out, in, FTEST_BUF_SIZE, avx::dyn_biquad_process_x8_fma3));
+        IF_ARCH_X86_64(process_1x8("avx512::x64_dyn_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx512::x64_dyn_biquad_process_x8));
         IF_ARCH_ARM(process_1x8("neon_d32::dyn_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, neon_d32::dyn_biquad_process_x8));
         IF_ARCH_AARCH64(process_1x8("asimd::dyn_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, asimd::dyn_biquad_process_x8));
         PTEST_SEPARATOR;
 
+        process_2x8("generic::dyn_biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, generic::dyn_biquad_process_x8);
+        IF_ARCH_X86(process_2x8("avx::x64_dyn_biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, avx::x64_dyn_biquad_process_x8));
+        IF_ARCH_X86(process_2x8("avx::dyn_biquad_process_x8_fma3 x2", out, in, FTEST_BUF_SIZE, avx::dyn_biquad_process_x8_fma3));
+        IF_ARCH_X86_64(process_2x8("avx512::x64_dyn_biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, avx512::x64_dyn_biquad_process_x8));
+        process_1x16("generic::dyn_biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, generic::dyn_biquad_process_x16);
+        IF_ARCH_X86_64(process_1x16("avx512::x64_dyn_biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, avx512::x64_dyn_biquad_process_x16));
+        PTEST_SEPARATOR;
+
         delete [] out;
         delete [] in;
     }
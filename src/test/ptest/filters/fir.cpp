@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_TAPS        8
+#define MAX_TAPS        1024
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fir_t *fir_create(const float *kernel, size_t taps);
+        void fir_destroy(dsp::fir_t *fir);
+        void fir_process(dsp::fir_t *fir, float *dst, const float *src, size_t count);
+    }
+
+    // Conventional approach: convolve into the buffer and shift the tail after each block
+    static void fir_shift(float *dst, float *buf, const float *src, const float *kernel, size_t taps, size_t count)
+    {
+        dsp::convolve(buf, src, kernel, taps, count);
+        dsp::copy(dst, buf, count);
+        dsp::move(buf, &buf[count], taps - 1);
+        dsp::fill_zero(&buf[taps - 1], count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for streaming FIR filter
+PTEST_BEGIN("dsp.filters", fir, 10, 1000)
+
+    void call(float *out, const float *in, const float *kernel, float *buf, size_t taps, size_t block)
+    {
+        char label[80];
+        snprintf(label, sizeof(label), "shift %d x %d", int(taps), int(block));
+        printf("Testing %s...\n", label);
+
+        dsp::fill_zero(buf, taps + BUF_SIZE);
+        PTEST_LOOP(label,
+            for (size_t off=0; off < BUF_SIZE; off += block)
+                fir_shift(&out[off], buf, &in[off], kernel, taps, block);
+        );
+
+        dsp::fir_t *fir = generic::fir_create(kernel, taps);
+        if (fir == NULL)
+            return;
+
+        snprintf(label, sizeof(label), "fir %d x %d", int(taps), int(block));
+        printf("Testing %s...\n", label);
+
+        PTEST_LOOP(label,
+            for (size_t off=0; off < BUF_SIZE; off += block)
+                generic::fir_process(fir, &out[off], &in[off], block);
+        );
+
+        generic::fir_destroy(fir);
+    }
+
+    PTEST_MAIN
+    {
+        size_t alloc    = MAX_TAPS * 2 + BUF_SIZE * 3;
+
+        uint8_t *data   = NULL;
+        float *kernel   = alloc_aligned<float>(data, alloc, 64);
+        float *in       = &kernel[MAX_TAPS];
+        float *out      = &in[BUF_SIZE];
+        float *buf      = &out[BUF_SIZE];
+
+        for (size_t i=0; i < alloc; ++i)
+            kernel[i]       = randf(-1.0f, 1.0f);
+
+        for (size_t taps=MIN_TAPS; taps <= MAX_TAPS; taps <<= 1)
+        {
+            call(out, in, kernel, buf, taps, 32);
+            call(out, in, kernel, buf, taps, BUF_SIZE);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        10
+#define MAX_RANK        16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_design_linear(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp);
+        void fir_design_minimum(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp);
+        void fir_minimum_phase(float *dst, const float *src, size_t count, size_t taps, size_t rank, float *tmp);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for FIR filter design
+PTEST_BEGIN("dsp.filters", fir_design, 5, 100)
+
+    void call(float *dst, const float *mag, const float *window, float *tmp, size_t rank)
+    {
+        const size_t n      = size_t(1) << rank;
+        const size_t taps   = n >> 1;
+        char buf[80];
+
+        snprintf(buf, sizeof(buf), "linear %d", int(taps));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            generic::fir_design_linear(dst, mag, window, taps, rank, tmp);
+        );
+
+        snprintf(buf, sizeof(buf), "minimum %d", int(taps));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            generic::fir_design_minimum(dst, mag, NULL, taps, rank, tmp);
+        );
+
+        snprintf(buf, sizeof(buf), "minimum phase %d", int(taps));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            generic::fir_minimum_phase(&dst[taps], dst, taps, taps, rank, tmp);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        const size_t n  = size_t(1) << MAX_RANK;
+        size_t alloc    = n * 7;
+
+        uint8_t *data   = NULL;
+        float *mag      = alloc_aligned<float>(data, alloc, 64);
+        float *window   = &mag[n];
+        float *dst      = &window[n];
+        float *tmp      = &dst[n];
+
+        for (size_t i=0; i < alloc; ++i)
+            mag[i]          = randf(0.0f, 1.0f);
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+        {
+            dsp::window_blackman(window, size_t(1) << (rank - 1), LSP_DSP_WINDOW_SYMMETRIC);
+            call(dst, mag, window, tmp, rank);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
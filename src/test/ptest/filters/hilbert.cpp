@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK        8
+#define MAX_RANK        12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void hilbert_init(dsp::hilbert_t *h);
+        void hilbert_process(float *dst_re, float *dst_im, const float *src, size_t count, dsp::hilbert_t *h);
+        void hilbert_fft(float *dst_re, float *dst_im, const float *src, size_t rank);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for Hilbert transformers
+PTEST_BEGIN("dsp.filters", hilbert, 5, 10000)
+
+    void call(float *re, float *im, const float *src, size_t rank)
+    {
+        const size_t count  = size_t(1) << rank;
+        char buf[80];
+
+        dsp::hilbert_t h __lsp_aligned64;
+        generic::hilbert_init(&h);
+
+        snprintf(buf, sizeof(buf), "iir x %d", int(count));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            generic::hilbert_process(re, im, src, count, &h);
+        );
+
+        snprintf(buf, sizeof(buf), "fft x %d", int(count));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            generic::hilbert_fft(re, im, src, rank);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        const size_t n  = size_t(1) << MAX_RANK;
+        size_t alloc    = n * 3;
+
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, alloc, 64);
+        float *re       = &src[n];
+        float *im       = &re[n];
+
+        for (size_t i=0; i < alloc; ++i)
+            src[i]          = randf(-1.0f, 1.0f);
+
+        for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+        {
+            call(re, im, src, rank);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define FTEST_BUF_SIZE  0x200
+#define CHANNELS        64
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_mc(float * const *dst, const float * const *src, size_t channels, size_t count, dsp::biquad_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        }
+
+        namespace avx
+        {
+            void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_x1_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c4_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            }
+        )
+    )
+
+    typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_mc_t)(float * const *dst, const float * const *src, size_t channels, size_t count, dsp::biquad_t *f);
+
+    static dsp::biquad_x1_t bq_normal = {
+        1.0, 2.0, 1.0,
+        -2.0, -1.0,
+        0.0, 0.0, 0.0
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for processing the same filter band on many channels
+PTEST_BEGIN("dsp.filters", multichannel, 10, 1000)
+
+    void init_bank(dsp::biquad_t *f)
+    {
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+        for (size_t i=0; i<8; ++i)
+        {
+            f->x8.b0[i]     = bq_normal.b0;
+            f->x8.b1[i]     = bq_normal.b1;
+            f->x8.b2[i]     = bq_normal.b2;
+            f->x8.a1[i]     = bq_normal.a1;
+            f->x8.a2[i]     = bq_normal.a2;
+        }
+    }
+
+    void init_narrow(dsp::biquad_t *f)
+    {
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+        for (size_t i=0; i<4; ++i)
+        {
+            f->x4.b0[i]     = bq_normal.b0;
+            f->x4.b1[i]     = bq_normal.b1;
+            f->x4.b2[i]     = bq_normal.b2;
+            f->x4.a1[i]     = bq_normal.a1;
+            f->x4.a2[i]     = bq_normal.a2;
+        }
+    }
+
+    void process_x1(const char *text, float *out, const float *in, size_t count, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+        dsp::biquad_t f[CHANNELS] __lsp_aligned64;
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            dsp::fill_zero(f[i].d, LSP_DSP_BIQUAD_D_ITEMS);
+            f[i].x1         = bq_normal;
+        }
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<CHANNELS; ++i)
+                process(&out[i * count], &in[i * count], count, &f[i]);
+        );
+    }
+
+    void process_cn(const char *text, float *out, const float *in, size_t count, size_t lanes, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+        // The c4 kernel uses one x4 bank per group, other kernels use one x8 bank per eight lanes
+        const size_t step   = (lanes + 7) / 8;
+        dsp::biquad_t f[CHANNELS / 4] __lsp_aligned64;
+        for (size_t i=0; i<CHANNELS / 4; ++i)
+        {
+            if (lanes == 4)
+                init_narrow(&f[i]);
+            else
+                init_bank(&f[i]);
+        }
+
+        PTEST_LOOP(text,
+            for (size_t i=0; i<CHANNELS / lanes; ++i)
+                process(&out[i * count * lanes], &in[i * count * lanes], count, &f[i * step]);
+        );
+    }
+
+    void process_mc(const char *text, float *out, const float *in, size_t count, biquad_process_mc_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+
+        printf("Testing %s on %d channels of %d samples ...\n", text, CHANNELS, int(count));
+
+        dsp::biquad_t f[CHANNELS / 8] __lsp_aligned64;
+        float *dst[CHANNELS];
+        const float *src[CHANNELS];
+        for (size_t i=0; i<CHANNELS / 8; ++i)
+            init_bank(&f[i]);
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            dst[i]          = &out[i * count];
+            src[i]          = &in[i * count];
+        }
+
+        PTEST_LOOP(text,
+            process(dst, src, CHANNELS, count, f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        const size_t items  = FTEST_BUF_SIZE * CHANNELS;
+        float *out          = new float[items];
+        float *in           = new float[items];
+
+        for (size_t i=0; i<items; ++i)
+        {
+            in[i]               = (i % 1) ? 1.0f : -1.0f;
+            out[i]              = 0.0f;
+        }
+
+        process_x1("generic::biquad_process_x1", out, in, FTEST_BUF_SIZE, generic::biquad_process_x1);
+        IF_ARCH_X86(process_x1("sse::biquad_process_x1", out, in, FTEST_BUF_SIZE, sse::biquad_process_x1));
+        IF_ARCH_X86(process_x1("avx::biquad_process_x1", out, in, FTEST_BUF_SIZE, avx::biquad_process_x1));
+        IF_ARCH_X86(process_x1("avx::biquad_process_x1_fma3", out, in, FTEST_BUF_SIZE, avx::biquad_process_x1_fma3));
+        PTEST_SEPARATOR;
+
+        process_cn("generic::biquad_process_c4", out, in, FTEST_BUF_SIZE, 4, generic::biquad_process_c4);
+        IF_ARCH_X86(process_cn("sse::biquad_process_c4", out, in, FTEST_BUF_SIZE, 4, sse::biquad_process_c4));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c4", out, in, FTEST_BUF_SIZE, 4, avx::biquad_process_c4));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c4_fma3", out, in, FTEST_BUF_SIZE, 4, avx::biquad_process_c4_fma3));
+        PTEST_SEPARATOR;
+
+        process_cn("generic::biquad_process_c8", out, in, FTEST_BUF_SIZE, 8, generic::biquad_process_c8);
+        IF_ARCH_X86(process_cn("sse::biquad_process_c8", out, in, FTEST_BUF_SIZE, 8, sse::biquad_process_c8));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c8", out, in, FTEST_BUF_SIZE, 8, avx::biquad_process_c8));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c8_fma3", out, in, FTEST_BUF_SIZE, 8, avx::biquad_process_c8_fma3));
+        PTEST_SEPARATOR;
+
+        process_cn("generic::biquad_process_c16", out, in, FTEST_BUF_SIZE, 16, generic::biquad_process_c16);
+        IF_ARCH_X86(process_cn("sse::biquad_process_c16", out, in, FTEST_BUF_SIZE, 16, sse::biquad_process_c16));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c16", out, in, FTEST_BUF_SIZE, 16, avx::biquad_process_c16));
+        IF_ARCH_X86(process_cn("avx::biquad_process_c16_fma3", out, in, FTEST_BUF_SIZE, 16, avx::biquad_process_c16_fma3));
+        IF_ARCH_X86_64(process_cn("avx512::x64_biquad_process_c16", out, in, FTEST_BUF_SIZE, 16, avx512::x64_biquad_process_c16));
+        PTEST_SEPARATOR;
+
+        process_mc("generic::biquad_process_mc", out, in, FTEST_BUF_SIZE, generic::biquad_process_mc);
+        PTEST_SEPARATOR;
+
+        delete [] out;
+        delete [] in;
+    }
+
+PTEST_END
@@ -33,6 +33,7 @@ namespace lsp
         void biquad_process_x2(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
     }
 
     IF_ARCH_X86(
@@ -63,6 +64,14 @@ namespace lsp
             void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
             void biquad_process_x8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+                void x64_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -86,6 +95,7 @@ namespace lsp
     )
 
     typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_x16_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
 
     static dsp::biquad_x1_t bq_normal = {
         1.0, 2.0, 1.0,
@@ -203,6 +213,59 @@ PTEST_BEGIN("dsp.filters", static, 10, 1000)
         );
     }
 
+    void process_2x8(const char *text, float *out, const float *in, size_t count, biquad_process_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s static filters on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad_t f __lsp_aligned64;
+        // Filters x 8
+        for (size_t i=0; i<8; ++i)
+        {
+            f.x8.b0[i]     = bq_normal.b0;
+            f.x8.b1[i]     = bq_normal.b1;
+            f.x8.b2[i]     = bq_normal.b2;
+            f.x8.a1[i]     = bq_normal.a1;
+            f.x8.a2[i]     = bq_normal.a2;
+        }
+
+        for (size_t i=0; i<16; ++i)
+            f.d[i]          = 0.0f;
+
+        PTEST_LOOP(text,
+            process(out, in, count, &f);
+            process(out, out, count, &f);
+        );
+    }
+
+    void process_1x16(const char *text, float *out, const float *in, size_t count, biquad_process_x16_t process)
+    {
+        if (!PTEST_SUPPORTED(process))
+            return;
+        printf("Testing %s static filters on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad_x16_t f __lsp_aligned64;
+        float d[32] __lsp_aligned64;
+
+        // Filters x 16
+        for (size_t i=0; i<16; ++i)
+        {
+            f.b0[i]         = bq_normal.b0;
+            f.b1[i]         = bq_normal.b1;
+            f.b2[i]         = bq_normal.b2;
+            f.a1[i]         = bq_normal.a1;
+            f.a2[i]         = bq_normal.a2;
+        }
+
+        for (size_t i=0; i<32; ++i)
+            d[i]            = 0.0f;
+
+        PTEST_LOOP(text,
+            process(out, in, d, count, &f);
+        );
+    }
+
     PTEST_MAIN
     {
         float *out          = new float[FTEST_BUF_SIZE];
@@ -243,10 +306,19 @@ PTEST_BEGIN("dsp.filters", static, 10, 1000)
         IF_ARCH_X86(process_1x8("sse3::x64_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, sse3::x64_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::x64_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx::x64_biquad_process_x8));
         IF_ARCH_X86(process_1x8("avx::biquad_process_x8_fma3 x1", out, in, FTEST_BUF_SIZE, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86_64(process_1x8("avx512::x64_biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, avx512::x64_biquad_process_x8));
         IF_ARCH_ARM(process_1x8("neon_d32::biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, neon_d32::biquad_process_x8));
         IF_ARCH_AARCH64(process_1x8("asimd::biquad_process_x8 x1", out, in, FTEST_BUF_SIZE, asimd::biquad_process_x8));
         PTEST_SEPARATOR;
 
+        process_2x8("generic::biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, generic::biquad_process_x8);
+        IF_ARCH_X86(process_2x8("avx::x64_biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, avx::x64_biquad_process_x8));
+        IF_ARCH_X86(process_2x8("avx::biquad_process_x8_fma3 x2", out, in, FTEST_BUF_SIZE, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86_64(process_2x8("avx512::x64_biquad_process_x8 x2", out, in, FTEST_BUF_SIZE, avx512::x64_biquad_process_x8));
+        process_1x16("generic::biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, generic::biquad_process_x16);
+        IF_ARCH_X86_64(process_1x16("avx512::x64_biquad_process_x16 x1", out, in, FTEST_BUF_SIZE, avx512::x64_biquad_process_x16));
+        PTEST_SEPARATOR;
+
         delete [] out;
         delete [] in;
     }
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define FTEST_BUF_SIZE 0x200
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x2_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void biquad_process_x1_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x2_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        }
+
+        namespace avx
+        {
+            void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x4_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        }
+    )
+
+    typedef void (* biquad_process_f64_t)(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for double-precision static biquad processing
+PTEST_BEGIN("dsp.filters", static_f64, 10, 1000)
+
+    void process(const char *text, double *out, const double *in, size_t count, size_t filters, biquad_process_f64_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        printf("Testing %s static filters on input buffer of %d samples ...\n", text, int(count));
+
+        dsp::biquad_f64_t f __lsp_aligned64;
+        double *c           = reinterpret_cast<double *>(&f.x1);
+
+        // Coefficients of each bank are stored as b0[n], b1[n], b2[n], a1[n], a2[n]
+        for (size_t i=0; i<sizeof(f.x8)/sizeof(double); ++i)
+            c[i]                = 0.0;
+        for (size_t i=0; i<filters; ++i)
+        {
+            c[i]                = 0.1;
+            c[i + filters]      = 0.2;
+            c[i + filters*2]    = 0.1;
+            c[i + filters*3]    = 0.7;
+            c[i + filters*4]    = -0.2;
+        }
+        for (size_t i=0; i<LSP_DSP_BIQUAD_D_ITEMS; ++i)
+            f.d[i]              = 0.0;
+
+        size_t passes       = 8 / filters;
+
+        PTEST_LOOP(text,
+            func(out, in, count, &f);
+            for (size_t i=1; i<passes; ++i)
+                func(out, out, count, &f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        double *out         = new double[FTEST_BUF_SIZE];
+        double *in          = new double[FTEST_BUF_SIZE];
+
+        for (size_t i=0; i<FTEST_BUF_SIZE; ++i)
+        {
+            in[i]               = (i % 2) ? 1.0 : -1.0;
+            out[i]              = 0.0;
+        }
+
+        #define CALL(func, filters) \
+            process(#func " x" #filters, out, in, FTEST_BUF_SIZE, filters, func)
+
+        CALL(generic::biquad_process_x1_f64, 1);
+        IF_ARCH_X86(CALL(sse2::biquad_process_x1_f64, 1));
+        PTEST_SEPARATOR;
+
+        CALL(generic::biquad_process_x2_f64, 2);
+        IF_ARCH_X86(CALL(sse2::biquad_process_x2_f64, 2));
+        PTEST_SEPARATOR;
+
+        CALL(generic::biquad_process_x4_f64, 4);
+        IF_ARCH_X86(CALL(sse2::biquad_process_x4_f64, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_x4_f64, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_x4_f64_fma3, 4));
+        PTEST_SEPARATOR;
+
+        CALL(generic::biquad_process_x8_f64, 8);
+        IF_ARCH_X86(CALL(sse2::biquad_process_x8_f64, 8));
+        IF_ARCH_X86(CALL(avx::biquad_process_x8_f64, 8));
+        IF_ARCH_X86(CALL(avx::biquad_process_x8_f64_fma3, 8));
+        PTEST_SEPARATOR;
+
+        delete [] out;
+        delete [] in;
+    }
+PTEST_END
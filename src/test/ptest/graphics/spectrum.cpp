@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK    10
+#define MAX_RANK    16
+#define WIDTH       1920
+
+namespace lsp
+{
+    namespace generic
+    {
+        void spectrum_log_map(uint32_t *map, float fmin, float fmax, float srate, size_t rank, size_t width);
+        void spectrum_display(float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width);
+    }
+
+    // Multi-pass processing: magnitude, decibels and per-column binning of the whole spectrum
+    static void multipass_display(float *peak, float *avg, float *tmp, const float *spec, const uint32_t *map, size_t smooth, size_t width)
+    {
+        const size_t bins   = lsp_max(map[width], map[width-1] + 1);
+        dsp::pcomplex_mod(tmp, spec, bins);
+        dsp::limit1(tmp, LSP_DSP_AMPLIFICATION_THRESH, 1e+10f, bins);
+        dsp::logd1(tmp, bins);
+        dsp::mul_k2(tmp, 20.0f, bins);
+
+        for (size_t i=0; i<width; ++i)
+        {
+            size_t first        = map[i];
+            size_t last         = lsp_max(size_t(map[i+1]), first + 1);
+            float vmax          = tmp[first];
+            float vsum          = 0.0f;
+            for (size_t k=first; k<last; ++k)
+            {
+                vmax                = lsp_max(vmax, tmp[k]);
+                vsum               += tmp[k];
+            }
+            peak[i]             = vmax;
+            avg[i]              = vsum / (last - first);
+        }
+    }
+
+    typedef void (* spectrum_display_t)(float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for spectrum display
+PTEST_BEGIN("dsp.graphics", spectrum, 5, 1000)
+
+    void call(const char *label, float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t rank, spectrum_display_t func)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d, smooth=%d", label, int(1 << rank), int(smooth));
+        printf("Testing %s bins...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(peak, avg, spec, map, smooth, WIDTH);
+        );
+    }
+
+    void call_multipass(float *peak, float *avg, float *tmp, const float *spec, const uint32_t *map, size_t rank)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "multipass x %d", int(1 << rank));
+        printf("Testing %s bins...\n", buf);
+
+        PTEST_LOOP(buf,
+            multipass_display(peak, avg, tmp, spec, map, 0, WIDTH);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size     = 1 << MAX_RANK;
+        uint8_t *data       = NULL;
+        float *spec         = alloc_aligned<float>(data, buf_size * 3 + WIDTH * 2 + WIDTH + 1, 64);
+        float *tmp          = &spec[buf_size * 2];
+        float *peak         = &tmp[buf_size];
+        float *avg          = &peak[WIDTH];
+        uint32_t *map       = reinterpret_cast<uint32_t *>(&avg[WIDTH]);
+
+        for (size_t i=0; i<buf_size*2; ++i)
+            spec[i]             = randf(-1.0f, 1.0f);
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            generic::spectrum_log_map(map, 10.0f, 24000.0f, 48000.0f, i, WIDTH);
+
+            call_multipass(peak, avg, tmp, spec, map, i);
+            call("generic::spectrum_display", peak, avg, spec, map, 0, i, generic::spectrum_display);
+            call("generic::spectrum_display", peak, avg, spec, map, 40, i, generic::spectrum_display);
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 6
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count);
+        }
+
+        namespace avx
+        {
+            void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count);
+        }
+
+        namespace avx512
+        {
+            void pcomplex_r2c_mul3(float *dst, const float *src, const float *w, size_t count);
+        }
+    )
+
+    typedef void (* pcomplex_r2c_op3_t)(float *dst, const float *src, const float *w, size_t count);
+
+    // Windowing and conversion as two separate passes over memory
+    static void pcomplex_r2c_mul3_split(float *dst, const float *src, const float *w, size_t count)
+    {
+        dsp::mul3(&dst[count], src, w, count);
+        dsp::pcomplex_r2c(dst, &dst[count], count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for windowing with conversion to packed complex
+PTEST_BEGIN("dsp.pcomplex", r2c_mul3, 5, 1000)
+
+    void call(const char *label, float *dst, const float *src, const float *w, size_t count, pcomplex_r2c_op3_t op)
+    {
+        if (!PTEST_SUPPORTED(op))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(count));
+        printf("Testing %s numbers...\n", buf);
+
+        PTEST_LOOP(buf,
+            op(dst, src, w, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, buf_size*4, 64);
+        float *in       = &out[buf_size*2];
+        float *w        = &in[buf_size];
+
+        randomize_sign(out, buf_size*4);
+
+        #define CALL(func) \
+            call(#func, out, in, w, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            CALL(pcomplex_r2c_mul3_split);
+            CALL(generic::pcomplex_r2c_mul3);
+            IF_ARCH_X86(CALL(sse::pcomplex_r2c_mul3));
+            IF_ARCH_X86(CALL(avx::pcomplex_r2c_mul3));
+            IF_ARCH_X86(CALL(avx512::pcomplex_r2c_mul3));
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define RTEST_BUF_SIZE  0x400
+#define RTEST_MAX_TAPS  0x400
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+            void fir_decimate_fma3(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+
+        namespace avx512
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+    )
+
+    typedef void (* fir_decimate_t)(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for decimating FIR filter
+PTEST_BEGIN("dsp.resampling", decimation, 5, 100)
+
+    void call(float *out, const float *in, const float *k, size_t taps, size_t factor, const char *text, fir_decimate_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x%d taps=%d", text, int(factor), int(taps));
+        printf("Testing %s decimation for %d -> %d samples ...\n", buf, int(RTEST_BUF_SIZE * factor), int(RTEST_BUF_SIZE));
+
+        PTEST_LOOP(buf,
+            func(out, in, k, taps, factor, RTEST_BUF_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        float *out          = new float[RTEST_BUF_SIZE];
+        float *in           = new float[RTEST_BUF_SIZE*8 + RTEST_MAX_TAPS];
+        float *k            = new float[RTEST_MAX_TAPS];
+
+        // Prepare data
+        for (size_t i=0; i<RTEST_BUF_SIZE*8 + RTEST_MAX_TAPS; ++i)
+            in[i]               = float(rand()) / RAND_MAX;
+        for (size_t i=0; i<RTEST_MAX_TAPS; ++i)
+            k[i]                = float(rand()) / RAND_MAX;
+
+        #define CALL(func, taps, factor) \
+            call(out, in, k, taps, factor, #func, func);
+
+        size_t taps[]       = { 15, 39, 127, 991 };
+        size_t factors[]    = { 2, 4, 8 };
+
+        for (size_t i=0; i<sizeof(factors)/sizeof(factors[0]); ++i)
+            for (size_t j=0; j<sizeof(taps)/sizeof(taps[0]); ++j)
+            {
+                CALL(generic::fir_decimate, taps[j], factors[i]);
+                IF_ARCH_X86(CALL(sse::fir_decimate, taps[j], factors[i]));
+                IF_ARCH_X86(CALL(avx::fir_decimate, taps[j], factors[i]));
+                IF_ARCH_X86(CALL(avx::fir_decimate_fma3, taps[j], factors[i]));
+                IF_ARCH_X86(CALL(avx512::fir_decimate, taps[j], factors[i]));
+                PTEST_SEPARATOR;
+            }
+
+        delete [] out;
+        delete [] in;
+        delete [] k;
+    }
+
+PTEST_END
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define BUF_SIZE        1024
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::resampler_t *resampler_create(size_t in_rate, size_t out_rate, size_t lobes);
+        void resampler_destroy(dsp::resampler_t *rs);
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio);
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for arbitrary-ratio resampler
+PTEST_BEGIN("dsp.resampling", resampler, 10, 1000)
+
+    void call(float *out, const float *in, size_t in_rate, size_t out_rate, size_t lobes, bool drift)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%d -> %d, %d lobes%s",
+            int(in_rate), int(out_rate), int(lobes), (drift) ? ", drift" : "");
+        printf("Testing %s...\n", buf);
+
+        dsp::resampler_t *rs = generic::resampler_create(in_rate, out_rate, lobes);
+        if (rs == NULL)
+            return;
+        if (drift)
+            generic::resampler_set_ratio(rs, double(out_rate) / double(in_rate) * 1.0001);
+
+        PTEST_LOOP(buf,
+            generic::resampler_process(rs, out, in, BUF_SIZE);
+        );
+
+        generic::resampler_destroy(rs);
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 6, 64);
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = randf(-1.0f, 1.0f);
+
+        for (size_t lobes=4; lobes <= 32; lobes <<= 1)
+        {
+            call(out, in, 44100, 48000, lobes, false);
+            call(out, in, 44100, 48000, lobes, true);
+            call(out, in, 48000, 44100, lobes, false);
+            call(out, in, 48000, 96000, lobes, false);
+            call(out, in, 96000, 48000, lobes, false);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
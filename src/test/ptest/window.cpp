@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void window_hann(float *dst, size_t count, size_t mode);
+        void window_blackman_harris(float *dst, size_t count, size_t mode);
+        void window_kaiser(float *dst, float beta, size_t count, size_t mode);
+    }
+
+    // Scalar window generation with the standard library functions
+    static void scalar_hann(float *dst, size_t count, size_t mode)
+    {
+        const float k = 2.0f * M_PI / count;
+        for (size_t i=0; i<count; ++i)
+            dst[i]      = 0.5f - 0.5f * cosf(k * i);
+    }
+
+    static void scalar_blackman_harris(float *dst, size_t count, size_t mode)
+    {
+        const float k = 2.0f * M_PI / count;
+        for (size_t i=0; i<count; ++i)
+            dst[i]      = 0.35875f - 0.48829f * cosf(k * i) + 0.14128f * cosf(2.0f * k * i) - 0.01168f * cosf(3.0f * k * i);
+    }
+
+    static void kaiser(float *dst, size_t count, size_t mode)
+    {
+        generic::window_kaiser(dst, 8.6f, count, mode);
+    }
+
+    typedef void (* window_func_t)(float *dst, size_t count, size_t mode);
+}
+
+//-----------------------------------------------------------------------------
+// Performance test for window generators
+PTEST_BEGIN("dsp", window, 5, 1000)
+
+    void call(const char *label, float *dst, size_t count, window_func_t func)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d", label, int(count));
+        printf("Testing %s samples...\n", buf);
+
+        PTEST_LOOP(buf,
+            func(dst, count, LSP_DSP_WINDOW_PERIODIC);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *out      = alloc_aligned<float>(data, buf_size, 64);
+
+        #define CALL(func) \
+            call(#func, out, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 2)
+        {
+            size_t count = 1 << i;
+
+            CALL(scalar_hann);
+            CALL(generic::window_hann);
+            CALL(scalar_blackman_harris);
+            CALL(generic::window_blackman_harris);
+            CALL(kaiser);
+
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
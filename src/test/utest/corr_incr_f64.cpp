@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define TOLERANCE       1e-10
+
+namespace lsp
+{
+    namespace generic
+    {
+        void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count);
+        void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+            const double *a_head, const double *b_head,
+            const double *a_tail, const double *b_tail,
+            size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+                const double *a_head, const double *b_head,
+                const double *a_tail, const double *b_tail,
+                size_t count);
+        }
+
+        namespace avx
+        {
+            void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+                const double *a_head, const double *b_head,
+                const double *a_tail, const double *b_tail,
+                size_t count);
+        }
+    )
+
+    static void corr_incr_f64(dsp::correlation_f64_t *corr, double *dst,
+        const double *a_head, const double *b_head,
+        const double *a_tail, const double *b_tail,
+        size_t count)
+    {
+        double vv   = corr->v;
+        double va   = corr->a;
+        double vb   = corr->b;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            double ah   = a_head[i];
+            double bh   = b_head[i];
+            double at   = a_tail[i];
+            double bt   = b_tail[i];
+
+            vv         += ah*bh - at*bt;
+            va         += ah*ah - at*at;
+            vb         += bh*bh - bt*bt;
+            double d    = va * vb;
+
+            dst[i]      = (d >= 1e-18) ? vv / sqrt(d) : 0.0;
+        }
+
+        corr->v     = vv;
+        corr->a     = va;
+        corr->b     = vb;
+    }
+
+    typedef void (* corr_incr_f64_t)(dsp::correlation_f64_t *corr, double *dst,
+        const double *a_head, const double *b_head,
+        const double *a_tail, const double *b_tail,
+        size_t count);
+
+    static bool f64_equals(double a, double b, double tol)
+    {
+        return fabs(a - b) <= tol * lsp_max(1.0, lsp_max(fabs(a), fabs(b)));
+    }
+}
+
+UTEST_BEGIN("dsp", corr_incr_f64)
+    void call(const char *label, size_t align, corr_incr_f64_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x07; ++mask)
+        {
+            UTEST_FOREACH(tail, 0x80, 0x1ff)
+            {
+                UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 24, 32, 33, 64, 47, 0x80, 0x1ff)
+                {
+                    size_t len      = tail + count + 1;
+                    uint8_t *data   = NULL;
+                    double *a       = alloc_aligned<double>(data, len * 2 + count * 2 + 4, align);
+                    UTEST_ASSERT(a != NULL);
+                    lsp_finally { free_aligned(data); };
+                    double *b       = &a[len + 1];
+                    double *dst1    = &b[len + 1];
+                    double *dst2    = &dst1[count + 1];
+                    a              += (mask & 0x01);
+                    b              += (mask & 0x02) >> 1;
+                    dst1           += (mask & 0x04) >> 2;
+                    dst2           += (mask & 0x04) >> 2;
+
+                    for (size_t i=0; i<len; ++i)
+                    {
+                        a[i]            = double(rand()) / RAND_MAX * 2.0 - 1.0;
+                        b[i]            = double(rand()) / RAND_MAX * 2.0 - 1.0;
+                    }
+
+                    dsp::correlation_f64_t corr_a, corr_b;
+                    corr_a.v = 0.0;
+                    corr_a.a = 0.0;
+                    corr_a.b = 0.0;
+                    generic::corr_init_f64(&corr_a, a, b, tail);
+                    corr_b = corr_a;
+
+                    printf("Tesing %s correlation tail=%d on buffer count=%d mask=0x%x\n", label, int(tail), int(count), int(mask));
+
+                    const double *a_tail = a;
+                    const double *b_tail = b;
+                    const double *a_head = &a_tail[tail];
+                    const double *b_head = &b_tail[tail];
+
+                    corr_incr_f64(&corr_a, dst1, a_head, b_head, a_tail, b_tail, count);
+                    func(&corr_b, dst2, a_head, b_head, a_tail, b_tail, count);
+
+                    // Compare buffers
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        if (!f64_equals(dst1[i], dst2[i], TOLERANCE))
+                            UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d, value=%.16f vs %.16f",
+                                label, int(i), dst1[i], dst2[i]);
+                    }
+
+                    // Compare state
+                    if ((!f64_equals(corr_a.v, corr_b.v, TOLERANCE)) ||
+                        (!f64_equals(corr_a.a, corr_b.a, TOLERANCE)) ||
+                        (!f64_equals(corr_a.b, corr_b.b, TOLERANCE)))
+                    {
+                        UTEST_FAIL_MSG("Correlation state differs a={%f, %f, %f}, b={%f, %f, %f}",
+                            corr_a.v, corr_a.a, corr_a.b,
+                            corr_b.v, corr_b.a, corr_b.b);
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        CALL(generic::corr_incr_f64, 16);
+        IF_ARCH_X86(CALL(sse2::corr_incr_f64, 16));
+        IF_ARCH_X86(CALL(avx::corr_incr_f64, 32));
+    }
+UTEST_END
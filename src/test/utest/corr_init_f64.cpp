@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define TOLERANCE       1e-12
+
+namespace lsp
+{
+    namespace generic
+    {
+        void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count);
+        }
+
+        namespace avx
+        {
+            void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count);
+        }
+    )
+
+    static void corr_init_f64(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count)
+    {
+        double vv   = 0.0;
+        double va   = 0.0;
+        double vb   = 0.0;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            vv         += a[i] * b[i];
+            va         += a[i] * a[i];
+            vb         += b[i] * b[i];
+        }
+
+        corr->v    += vv;
+        corr->a    += va;
+        corr->b    += vb;
+    }
+
+    typedef void (* corr_init_f64_t)(dsp::correlation_f64_t *corr, const double *a, const double *b, size_t count);
+
+    static bool f64_equals(double a, double b, double tol)
+    {
+        return fabs(a - b) <= tol * lsp_max(1.0, lsp_max(fabs(a), fabs(b)));
+    }
+}
+
+UTEST_BEGIN("dsp", corr_init_f64)
+    void call(const char *label, size_t align, corr_init_f64_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        for (size_t mask=0; mask <= 0x03; ++mask)
+        {
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 24, 32, 33, 64, 47, 0x80, 0x1ff)
+            {
+                uint8_t *data   = NULL;
+                double *a       = alloc_aligned<double>(data, count * 2 + 2, align);
+                UTEST_ASSERT(a != NULL);
+                lsp_finally { free_aligned(data); };
+                double *b       = &a[count + 1];
+                a              += (mask & 0x01);
+                b              += (mask & 0x02) >> 1;
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    a[i]            = double(rand()) / RAND_MAX * 2.0 - 1.0;
+                    b[i]            = double(rand()) / RAND_MAX * 2.0 - 1.0;
+                }
+
+                dsp::correlation_f64_t corr_a, corr_b;
+                corr_a.v = 0.1;
+                corr_a.a = 0.2;
+                corr_a.b = 0.3;
+                corr_b.v = 0.1;
+                corr_b.a = 0.2;
+                corr_b.b = 0.3;
+
+                printf("Tesing %s corr_init on buffer count=%d mask=0x%x\n", label, int(count), int(mask));
+
+                corr_init_f64(&corr_a, a, b, count);
+                func(&corr_b, a, b, count);
+
+                // Compare state
+                if ((!f64_equals(corr_a.v, corr_b.v, TOLERANCE)) ||
+                    (!f64_equals(corr_a.a, corr_b.a, TOLERANCE)) ||
+                    (!f64_equals(corr_a.b, corr_b.b, TOLERANCE)))
+                {
+                    UTEST_FAIL_MSG("Correlation state differs a={%.16f, %.16f, %.16f}, b={%.16f, %.16f, %.16f}",
+                        corr_a.v, corr_a.a, corr_a.b,
+                        corr_b.v, corr_b.a, corr_b.b);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, align) \
+            call(#func, align, func)
+
+        CALL(generic::corr_init_f64, 16);
+        IF_ARCH_X86(CALL(sse2::corr_init_f64, 16));
+        IF_ARCH_X86(CALL(avx::corr_init_f64, 32));
+    }
+
+UTEST_END;
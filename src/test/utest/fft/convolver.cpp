@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::convolver_t *convolver_create(const float *ir, size_t length, size_t rank, size_t max_rank);
+        void convolver_destroy(dsp::convolver_t *cv);
+        void convolver_reset(dsp::convolver_t *cv);
+        size_t convolver_latency(const dsp::convolver_t *cv);
+        void convolver_process(dsp::convolver_t *cv, float *dst, const float *src, size_t count);
+    }
+
+    static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; (j<length) && ((i + j) < count); ++j)
+                dst[i+j] += src[i] * conv[j];
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", convolver)
+
+    void call(const char *label, size_t align, size_t length, size_t rank, size_t max_rank, bool in_place)
+    {
+        printf("Testing %s: length=%d, rank=%d, max_rank=%d, in_place=%s\n",
+            label, int(length), int(rank), int(max_rank), (in_place) ? "true" : "false");
+
+        dsp::convolver_t *cv = generic::convolver_create(NULL, length, rank, max_rank);
+        UTEST_ASSERT(cv == NULL);
+
+        FloatBuffer ir(length, align, false);
+        cv = generic::convolver_create(ir, length, rank, max_rank);
+        UTEST_ASSERT(cv != NULL);
+        lsp_finally { generic::convolver_destroy(cv); };
+
+        size_t latency  = generic::convolver_latency(cv);
+        UTEST_ASSERT(latency == size_t(1) << (rank - 1));
+
+        size_t count    = length + latency * 8 + 1;
+        FloatBuffer src(count, align, false);
+        FloatBuffer dst1(count, align, false);
+        FloatBuffer dst2(count, align, false);
+
+        // Compute reference output
+        dst1.fill_zero();
+        convolve(&dst1[latency], src, ir, length, count - latency);
+
+        // Do the same twice to check that reset works properly
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            // Process the data by blocks of variable size
+            if (in_place)
+                dsp::copy(dst2, src, count);
+            for (size_t off=0, step=1; off < count; step = (step * 7 + 3) % 97 + 1)
+            {
+                size_t to_do    = lsp_min(count - off, step);
+                generic::convolver_process(cv, &dst2[off], (in_place) ? &dst2[off] : &src[off], to_do);
+                off            += to_do;
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(ir.valid(), "IR buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            // Compare buffers
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                ssize_t diff = dst2.last_diff();
+                UTEST_FAIL_MSG("Output of convolver differs at sample %d (%.6f vs %.6f), pass=%d",
+                    int(diff), dst1.get(diff), dst2.get(diff), int(pass));
+            }
+
+            generic::convolver_reset(cv);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        UTEST_ASSERT(generic::convolver_create(NULL, 0, LSP_DSP_CONVOLVER_RANK_MIN - 1, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::convolver_create(NULL, 0, LSP_DSP_CONVOLVER_RANK_MIN + 1, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::convolver_create(NULL, 0, LSP_DSP_CONVOLVER_RANK_MIN, LSP_DSP_CONVOLVER_RANK_MAX + 1) == NULL);
+
+        UTEST_FOREACH(length, 1, 15, 16, 17, 100, 256, 1000, 4096, 10000)
+        {
+            // Uniform partitioning
+            call("uniform", 16, length, 5, 5, false);
+            call("uniform", 16, length, 7, 7, true);
+
+            // Non-uniform partitioning
+            call("non-uniform", 16, length, 5, 8, false);
+            call("non-uniform", 16, length, 6, 10, true);
+            call("non-uniform", 16, length, 5, LSP_DSP_CONVOLVER_RANK_MAX, false);
+        }
+    }
+
+UTEST_END;
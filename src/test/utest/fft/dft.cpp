@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::dft_plan_t *dft_plan_create(size_t size);
+        void dft_plan_destroy(dsp::dft_plan_t *plan);
+        size_t dft_plan_size(const dsp::dft_plan_t *plan);
+        void packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+        void packed_reverse_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+    }
+
+    IF_ARCH_X86_64(
+        namespace sse3
+        {
+            void x64_packed_direct_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+            void x64_packed_reverse_dft(dsp::dft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    typedef void (* packed_dft_t)(dsp::dft_plan_t *plan, float *dst, const float *src);
+
+    static void naive_dft(float *dst, const float *src, size_t size)
+    {
+        for (size_t k=0; k<size; ++k)
+        {
+            double re = 0.0, im = 0.0;
+            for (size_t n=0; n<size; ++n)
+            {
+                double a    = (2.0 * M_PI * ((uint64_t(n) * uint64_t(k)) % size)) / size;
+                double c    = cos(a), s = -sin(a);
+                re         += src[n*2] * c - src[n*2+1] * s;
+                im         += src[n*2] * s + src[n*2+1] * c;
+            }
+            dst[k*2]    = re;
+            dst[k*2+1]  = im;
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", dft)
+
+    void check_naive(size_t size, bool in_place)
+    {
+        printf("Testing DFT of size=%d against naive DFT, in_place=%s...\n",
+            int(size), (in_place) ? "true" : "false");
+
+        dsp::dft_plan_t *plan = generic::dft_plan_create(size);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::dft_plan_destroy(plan); };
+        UTEST_ASSERT(generic::dft_plan_size(plan) == size);
+
+        FloatBuffer src(size * 2, 64, true);
+        FloatBuffer dst1(size * 2, 64, true);
+        FloatBuffer dst2(size * 2, 64, true);
+        FloatBuffer sig(size * 2, 64, true);
+
+        naive_dft(dst1, src, size);
+        if (in_place)
+        {
+            dsp::copy(dst2, src, size * 2);
+            generic::packed_direct_dft(plan, dst2, dst2);
+        }
+        else
+            generic::packed_direct_dft(plan, dst2, src);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src ");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Direct DFT of size=%d differs at sample %d (%.5f vs %.5f)",
+                int(size), int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+        }
+
+        // Reverse transform should restore the original signal
+        if (in_place)
+        {
+            dsp::copy(sig, dst2, size * 2);
+            generic::packed_reverse_dft(plan, sig, sig);
+        }
+        else
+            generic::packed_reverse_dft(plan, sig, dst2);
+
+        UTEST_ASSERT_MSG(sig.valid(), "Signal buffer corrupted");
+        if (!src.equals_adaptive(sig, TOLERANCE))
+        {
+            src.dump("src ");
+            sig.dump("sig ");
+            UTEST_FAIL_MSG("Reverse DFT of size=%d differs at sample %d (%.5f vs %.5f)",
+                int(size), int(src.last_diff()), src.get(src.last_diff()), sig.get(src.last_diff()));
+        }
+    }
+
+    void check_fft(size_t rank)
+    {
+        size_t size = size_t(1) << rank;
+        printf("Testing DFT of size=%d against FFT...\n", int(size));
+
+        dsp::dft_plan_t *plan = generic::dft_plan_create(size);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::dft_plan_destroy(plan); };
+
+        FloatBuffer src(size * 2, 64, true);
+        FloatBuffer dst1(size * 2, 64, true);
+        FloatBuffer dst2(size * 2, 64, true);
+
+        generic::packed_direct_fft(dst1, src, rank);
+        generic::packed_direct_dft(plan, dst2, src);
+
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            UTEST_FAIL_MSG("DFT of size=%d differs from FFT at sample %d (%.5f vs %.5f)",
+                int(size), int(dst1.last_diff()), dst1.get(dst1.last_diff()), dst2.get(dst1.last_diff()));
+        }
+    }
+
+    void check_reverse(size_t size)
+    {
+        printf("Testing direct and reverse DFT of size=%d...\n", int(size));
+
+        dsp::dft_plan_t *plan = generic::dft_plan_create(size);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::dft_plan_destroy(plan); };
+
+        FloatBuffer src(size * 2, 64, true);
+        FloatBuffer dst(size * 2, 64, true);
+
+        generic::packed_direct_dft(plan, dst, src);
+        generic::packed_reverse_dft(plan, dst, dst);
+
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        if (!src.equals_adaptive(dst, TOLERANCE))
+        {
+            UTEST_FAIL_MSG("Reverse DFT of size=%d differs at sample %d (%.5f vs %.5f)",
+                int(size), int(src.last_diff()), src.get(src.last_diff()), dst.get(src.last_diff()));
+        }
+    }
+
+    void call(const char *label, size_t align, packed_dft_t func1, packed_dft_t func2, const size_t *sizes, size_t count)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                size_t size     = sizes[i];
+                dsp::dft_plan_t *plan = generic::dft_plan_create(size);
+                UTEST_ASSERT(plan != NULL);
+                lsp_finally { generic::dft_plan_destroy(plan); };
+
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(size * 2, align, mask & 0x01);
+                    FloatBuffer dst1(size * 2, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for size=%d, mask=0x%x, same=%s...\n", label, int(size), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, size * 2);
+                        dsp::copy(dst2, src, size * 2);
+                        func1(plan, dst1, dst1);
+                        func2(plan, dst2, dst2);
+                    }
+                    else
+                    {
+                        func1(plan, dst1, src);
+                        func2(plan, dst2, src);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        ssize_t diff = dst1.last_diff();
+                        src.dump("src ");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1.get(diff), dst2.get(diff));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const size_t sizes[] =
+        {
+            1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 15, 16, 21, 25, 30, 35, 45, 49, 60, 64,
+            105, 120, 240, 343, 480, 625, 960, 1000, 1920,
+            11, 13, 17, 22, 97, 130, 1021
+        };
+
+        UTEST_ASSERT(generic::dft_plan_create(0) == NULL);
+
+        for (size_t i=0; i<sizeof(sizes)/sizeof(size_t); ++i)
+        {
+            check_naive(sizes[i], false);
+            check_naive(sizes[i], true);
+        }
+
+        for (size_t rank=0; rank<=16; ++rank)
+            check_fft(rank);
+
+        check_reverse(size_t(1) << 17);
+        check_reverse(size_t(3) << 17);
+        check_reverse(44100);
+        check_reverse(48000);
+        check_reverse(65537);
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func, sizes, sizeof(sizes)/sizeof(size_t))
+
+        IF_ARCH_X86_64(CALL(generic::packed_direct_dft, sse3::x64_packed_direct_dft, 16));
+        IF_ARCH_X86_64(CALL(generic::packed_reverse_dft, sse3::x64_packed_reverse_dft, 16));
+    }
+UTEST_END;
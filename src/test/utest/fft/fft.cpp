@@ -25,6 +25,7 @@
 #include <lsp-plug.in/test-fw/FloatBuffer.h>
 
 #define TOLERANCE       5e-2
+#define MAX_RANK        17      // Maximum rank supported by FFT functions without plan
 
 namespace lsp
 {
@@ -89,7 +90,7 @@ UTEST_BEGIN("dsp.fft", fft)
 
         for (int same=0; same<2; ++same)
         {
-            for (size_t rank=2; rank<=16; ++rank)
+            for (size_t rank=2; rank<=MAX_RANK; ++rank)
             {
                 size_t count = 1 << rank;
                 for (size_t mask=0; mask <= 0x0f; ++mask)
@@ -127,7 +128,9 @@ UTEST_BEGIN("dsp.fft", fft)
                     UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
 
                     // Compare buffers
-                    if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                    // The rounding error of the twiddle rotation grows with the rank
+                    float tol = (rank > 16) ? TOLERANCE * 4 : TOLERANCE;
+                    if ((!dst1_re.equals_adaptive(dst2_re, tol)) || (!dst1_im.equals_adaptive(dst2_im, tol)))
                     {
                         src_re.dump("src_re ");
                         src_im.dump("src_im ");
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define MIN_RANK        0
+#define MAX_RANK        12
+#define TOLERANCE       1e-11
+#define TONE_RANK       18
+#define TONE_TOLERANCE  2e-9
+
+namespace lsp
+{
+    namespace generic
+    {
+        void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+        void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+            void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+        }
+
+        namespace avx
+        {
+            void direct_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+            void reverse_fft_f64(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+            void direct_fft_f64_fma3(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+            void reverse_fft_f64_fma3(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+        }
+    )
+
+    typedef void (* fft_f64_t)(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t rank);
+
+    // Reference DFT computed with extended precision
+    static void naive_dft(double *dst_re, double *dst_im, const double *src_re, const double *src_im, size_t size)
+    {
+        for (size_t k=0; k<size; ++k)
+        {
+            long double re = 0.0, im = 0.0;
+            for (size_t n=0; n<size; ++n)
+            {
+                long double a   = (2.0L * M_PI * ((uint64_t(n) * uint64_t(k)) % size)) / size;
+                long double c   = cosl(a), s = -sinl(a);
+                re             += src_re[n] * c - src_im[n] * s;
+                im             += src_re[n] * s + src_im[n] * c;
+            }
+            dst_re[k]   = re;
+            dst_im[k]   = im;
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", fft_f64)
+
+    void check(const char *label, fft_f64_t direct, fft_f64_t reverse, bool in_place)
+    {
+        if (!UTEST_SUPPORTED(direct))
+            return;
+        if (!UTEST_SUPPORTED(reverse))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; ++rank)
+        {
+            size_t size     = size_t(1) << rank;
+            printf("Testing %s on rank=%d, in_place=%s...\n", label, int(rank), (in_place) ? "true" : "false");
+
+            uint8_t *data   = NULL;
+            double *src_re  = alloc_aligned<double>(data, size * 8, 64);
+            UTEST_ASSERT(src_re != NULL);
+            lsp_finally { free_aligned(data); };
+            double *src_im  = &src_re[size];
+            double *ref_re  = &src_im[size];
+            double *ref_im  = &ref_re[size];
+            double *dst_re  = &ref_im[size];
+            double *dst_im  = &dst_re[size];
+            double *sig_re  = &dst_im[size];
+            double *sig_im  = &sig_re[size];
+
+            for (size_t i=0; i<size; ++i)
+            {
+                src_re[i]       = double(rand()) / RAND_MAX * 2.0 - 1.0;
+                src_im[i]       = double(rand()) / RAND_MAX * 2.0 - 1.0;
+            }
+            naive_dft(ref_re, ref_im, src_re, src_im, size);
+
+            // Direct transform
+            if (in_place)
+            {
+                for (size_t i=0; i<size; ++i)
+                {
+                    dst_re[i]       = src_re[i];
+                    dst_im[i]       = src_im[i];
+                }
+                direct(dst_re, dst_im, dst_re, dst_im, rank);
+            }
+            else
+                direct(dst_re, dst_im, src_re, src_im, rank);
+
+            double tol      = TOLERANCE * (rank + 1) * sqrt(double(size));
+            for (size_t i=0; i<size; ++i)
+            {
+                if ((fabs(ref_re[i] - dst_re[i]) > tol) || (fabs(ref_im[i] - dst_im[i]) > tol))
+                    UTEST_FAIL_MSG("Direct FFT of rank=%d differs at sample %d: {%.16f, %.16f} vs {%.16f, %.16f}",
+                        int(rank), int(i), ref_re[i], ref_im[i], dst_re[i], dst_im[i]);
+            }
+
+            // Reverse transform should restore the original signal
+            if (in_place)
+            {
+                for (size_t i=0; i<size; ++i)
+                {
+                    sig_re[i]       = dst_re[i];
+                    sig_im[i]       = dst_im[i];
+                }
+                reverse(sig_re, sig_im, sig_re, sig_im, rank);
+            }
+            else
+                reverse(sig_re, sig_im, dst_re, dst_im, rank);
+
+            for (size_t i=0; i<size; ++i)
+            {
+                if ((fabs(src_re[i] - sig_re[i]) > TOLERANCE * (rank + 1)) || (fabs(src_im[i] - sig_im[i]) > TOLERANCE * (rank + 1)))
+                    UTEST_FAIL_MSG("Reverse FFT of rank=%d differs at sample %d: {%.16f, %.16f} vs {%.16f, %.16f}",
+                        int(rank), int(i), src_re[i], src_im[i], sig_re[i], sig_im[i]);
+            }
+        }
+    }
+
+    // Transform of the complex tone at high rank should be a single peak of height N,
+    // checks that the error of twiddle factors does not grow with the size of the butterfly
+    void check_tone(const char *label, fft_f64_t direct)
+    {
+        if (!UTEST_SUPPORTED(direct))
+            return;
+
+        size_t size     = size_t(1) << TONE_RANK;
+        size_t bin      = size / 3;
+        printf("Testing %s on tone of rank=%d...\n", label, int(TONE_RANK));
+
+        uint8_t *data   = NULL;
+        double *src_re  = alloc_aligned<double>(data, size * 4, 64);
+        UTEST_ASSERT(src_re != NULL);
+        lsp_finally { free_aligned(data); };
+        double *src_im  = &src_re[size];
+        double *dst_re  = &src_im[size];
+        double *dst_im  = &dst_re[size];
+
+        for (size_t i=0; i<size; ++i)
+        {
+            long double a   = (2.0L * M_PI * ((uint64_t(i) * uint64_t(bin)) % size)) / size;
+            src_re[i]       = cosl(a);
+            src_im[i]       = sinl(a);
+        }
+
+        direct(dst_re, dst_im, src_re, src_im, TONE_RANK);
+
+        double err      = 0.0;
+        for (size_t i=0; i<size; ++i)
+        {
+            double re       = (i == bin) ? dst_re[i] - double(size) : dst_re[i];
+            err             = lsp_max(err, fabs(re));
+            err             = lsp_max(err, fabs(dst_im[i]));
+        }
+
+        printf("  maximum error: %g\n", err);
+        UTEST_ASSERT_MSG(err <= TONE_TOLERANCE, "Maximum error %g of tone transform exceeds %g", err, TONE_TOLERANCE);
+    }
+
+    UTEST_MAIN
+    {
+        check_tone("generic::direct_fft_f64", generic::direct_fft_f64);
+        IF_ARCH_X86(check_tone("sse2::direct_fft_f64", sse2::direct_fft_f64));
+        IF_ARCH_X86(check_tone("avx::direct_fft_f64", avx::direct_fft_f64));
+        IF_ARCH_X86(check_tone("avx::direct_fft_f64_fma3", avx::direct_fft_f64_fma3));
+
+        #define CALL(direct, reverse) \
+            check(#direct, direct, reverse, false); \
+            check(#direct, direct, reverse, true);
+
+        CALL(generic::direct_fft_f64, generic::reverse_fft_f64);
+        IF_ARCH_X86(CALL(sse2::direct_fft_f64, sse2::reverse_fft_f64));
+        IF_ARCH_X86(CALL(avx::direct_fft_f64, avx::reverse_fft_f64));
+        IF_ARCH_X86(CALL(avx::direct_fft_f64_fma3, avx::reverse_fft_f64_fma3));
+    }
+UTEST_END
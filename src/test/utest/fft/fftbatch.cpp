@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-4
+#define MAX_RANK        11
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+        void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+        void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+        void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+        void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+            void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+        }
+
+        namespace avx
+        {
+            void plan_packed_direct_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_reverse_fft_batch(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_direct_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+            void plan_packed_reverse_fft_batch_ptr(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+
+            void plan_packed_direct_fft_batch_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_reverse_fft_batch_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+            void plan_packed_direct_fft_batch_ptr_fma3(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+            void plan_packed_reverse_fft_batch_ptr_fma3(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+        }
+    )
+
+    typedef void (* plan_packed_fft_t)(const dsp::fft_plan_t *plan, float *dst, const float *src);
+    typedef void (* plan_packed_fft_batch_t)(const dsp::fft_plan_t *plan, float *dst, const float *src, size_t stride, size_t count);
+    typedef void (* plan_packed_fft_batch_ptr_t)(const dsp::fft_plan_t *plan, float * const *dst, const float * const *src, size_t count);
+}
+
+UTEST_BEGIN("dsp.fft", fftbatch)
+
+    void call(const char *label, size_t align, plan_packed_fft_t func1, plan_packed_fft_batch_t func2, plan_packed_fft_batch_ptr_t func3)
+    {
+        if (!UTEST_SUPPORTED(func2))
+            return;
+        if (!UTEST_SUPPORTED(func3))
+            return;
+
+        for (size_t rank=0; rank<=MAX_RANK; ++rank)
+        {
+            size_t items    = size_t(1) << rank;
+            dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+            UTEST_ASSERT(plan != NULL);
+            lsp_finally { generic::fft_plan_destroy(plan); };
+
+            UTEST_FOREACH(count, 1, 3, 4, 7, 8, 9, 17)
+            {
+                for (int same=0; same < 2; ++same)
+                {
+                    printf("Testing '%s' for rank=%d, count=%d, same=%s...\n",
+                        label, int(rank), int(count), (same) ? "true" : "false");
+
+                    size_t stride   = items * 2 + 6;
+                    FloatBuffer src(stride * count, align, false);
+                    FloatBuffer dst1(stride * count, align, false);
+                    FloatBuffer dst2(dst1);
+                    FloatBuffer dst3(dst1);
+
+                    float *vdst[32];
+                    const float *vsrc[32];
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        // Reverse the order of buffers for the pointer-based function
+                        vdst[i]         = &dst3[(count - i - 1) * stride];
+                        vsrc[i]         = (same) ? vdst[i] : &src[(count - i - 1) * stride];
+                    }
+
+                    if (same)
+                    {
+                        dst1.copy(src);
+                        dst2.copy(src);
+                        dst3.copy(src);
+                        for (size_t i=0; i<count; ++i)
+                            func1(plan, &dst1[i * stride], &dst1[i * stride]);
+                        func2(plan, dst2, dst2, stride, count);
+                    }
+                    else
+                    {
+                        for (size_t i=0; i<count; ++i)
+                            func1(plan, &dst1[i * stride], &src[i * stride]);
+                        func2(plan, dst2, src, stride, count);
+                    }
+                    func3(plan, vdst, vsrc, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                    UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of strided batch for test '%s' differs at sample %d",
+                                label, int(dst1.last_diff()));
+                    }
+                    if (!dst1.equals_adaptive(dst3, TOLERANCE))
+                    {
+                        dst1.dump("dst1");
+                        dst3.dump("dst3");
+                        UTEST_FAIL_MSG("Output of pointer batch for test '%s' differs at sample %d",
+                                label, int(dst1.last_diff()));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(ref, func, func_ptr, align) \
+            call(#func, align, ref, func, func_ptr)
+
+        CALL(generic::plan_packed_direct_fft, generic::plan_packed_direct_fft_batch, generic::plan_packed_direct_fft_batch_ptr, 16);
+        CALL(generic::plan_packed_reverse_fft, generic::plan_packed_reverse_fft_batch, generic::plan_packed_reverse_fft_batch_ptr, 16);
+
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, sse::plan_packed_direct_fft_batch, sse::plan_packed_direct_fft_batch_ptr, 16));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, sse::plan_packed_reverse_fft_batch, sse::plan_packed_reverse_fft_batch_ptr, 16));
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, avx::plan_packed_direct_fft_batch, avx::plan_packed_direct_fft_batch_ptr, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, avx::plan_packed_reverse_fft_batch, avx::plan_packed_reverse_fft_batch_ptr, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, avx::plan_packed_direct_fft_batch_fma3, avx::plan_packed_direct_fft_batch_ptr_fma3, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, avx::plan_packed_reverse_fft_batch_fma3, avx::plan_packed_reverse_fft_batch_ptr_fma3, 32));
+    }
+
+UTEST_END;
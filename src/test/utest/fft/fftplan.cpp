@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+#define MAX_RANK        17
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+        size_t fft_plan_rank(const dsp::fft_plan_t *plan);
+
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+
+        void plan_direct_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void plan_reverse_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+        void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+        void plan_fastconv_parse(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void plan_fastconv_restore(const dsp::fft_plan_t *plan, float *dst, float *src);
+        void plan_fastconv_apply(const dsp::fft_plan_t *plan, float *dst, float *tmp, const float *c1, const float *c2);
+        void plan_fastconv_parse_apply(const dsp::fft_plan_t *plan, float *dst, float *tmp, const float *c, const float *src);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void plan_direct_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void plan_reverse_fft(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+
+        namespace avx
+        {
+            void plan_packed_direct_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_reverse_fft(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_direct_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+            void plan_packed_reverse_fft_fma3(const dsp::fft_plan_t *plan, float *dst, const float *src);
+        }
+    )
+
+    typedef void (* plan_fft_t)(const dsp::fft_plan_t *plan, float *dst_re, float *dst_im, const float *src_re, const float *src_im);
+    typedef void (* plan_packed_fft_t)(const dsp::fft_plan_t *plan, float *dst, const float *src);
+
+    static void reference_fft(double *dst, const float *src, size_t rank)
+    {
+        size_t items    = size_t(1) << rank;
+
+        // Bit-reversal permutation
+        for (size_t i=0; i<items; ++i)
+        {
+            size_t j        = 0;
+            for (size_t k=0; k<rank; ++k)
+                j              |= ((i >> k) & 1) << (rank - k - 1);
+            dst[j*2]        = src[i*2];
+            dst[j*2+1]      = src[i*2+1];
+        }
+
+        // Radix-2 butterflies with directly computed twiddle factors
+        for (size_t n=1; n<items; n <<= 1)
+        {
+            for (size_t k=0; k<n; ++k)
+            {
+                double w_re     = cos((M_PI * k) / n);
+                double w_im     = -sin((M_PI * k) / n);
+
+                for (size_t p=k; p<items; p += (n << 1))
+                {
+                    double *a       = &dst[p*2];
+                    double *b       = &dst[(p + n)*2];
+                    double c_re     = w_re * b[0] - w_im * b[1];
+                    double c_im     = w_re * b[1] + w_im * b[0];
+                    b[0]            = a[0] - c_re;
+                    b[1]            = a[1] - c_im;
+                    a[0]           += c_re;
+                    a[1]           += c_im;
+                }
+            }
+        }
+    }
+
+    static double max_error(const double *ref, const float *v, size_t count)
+    {
+        double err = 0.0, amp = 0.0;
+        for (size_t i=0; i<count; ++i)
+        {
+            err     = lsp_max(err, fabs(ref[i] - v[i]));
+            amp     = lsp_max(amp, fabs(ref[i]));
+        }
+        return (amp > 0.0) ? err / amp : err;
+    }
+}
+
+UTEST_BEGIN("dsp.fft", fftplan)
+
+    void check_accuracy(size_t rank)
+    {
+        size_t items    = size_t(1) << rank;
+
+        dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::fft_plan_destroy(plan); };
+        UTEST_ASSERT(generic::fft_plan_rank(plan) == rank);
+
+        FloatBuffer src(items * 2, 16, true);
+        FloatBuffer dst1(items * 2, 16, true);
+        FloatBuffer dst2(items * 2, 16, true);
+        FloatBuffer sig(items * 2, 16, true);
+        double *ref     = new double[items * 2];
+        lsp_finally { delete [] ref; };
+
+        reference_fft(ref, src, rank);
+        generic::packed_direct_fft(dst1, src, rank);
+        generic::plan_packed_direct_fft(plan, dst2, src);
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        double err1     = max_error(ref, dst1, items * 2);
+        double err2     = max_error(ref, dst2, items * 2);
+        printf("Relative error of FFT for rank=%d: regular=%.3e, plan=%.3e\n", int(rank), err1, err2);
+        UTEST_ASSERT_MSG(err2 < 1e-5, "Too high relative error of plan FFT for rank=%d: %e", int(rank), err2);
+
+        // Check the transform of separate real and imaginary parts
+        FloatBuffer re(items, 16, true);
+        FloatBuffer im(items, 16, true);
+        for (size_t i=0; i<items; ++i)
+        {
+            re[i]       = src[i*2];
+            im[i]       = src[i*2+1];
+        }
+        generic::plan_direct_fft(plan, re, im, re, im);
+        UTEST_ASSERT_MSG(re.valid(), "Real part buffer corrupted");
+        UTEST_ASSERT_MSG(im.valid(), "Imaginary part buffer corrupted");
+        for (size_t i=0; i<items; ++i)
+        {
+            dst1[i*2]   = re[i];
+            dst1[i*2+1] = im[i];
+        }
+        err1            = max_error(ref, dst1, items * 2);
+        UTEST_ASSERT_MSG(err1 < 1e-5, "Too high relative error of split plan FFT for rank=%d: %e", int(rank), err1);
+
+        // Check that reverse transform restores the signal
+        generic::plan_packed_reverse_fft(plan, sig, dst2);
+        UTEST_ASSERT_MSG(sig.valid(), "Signal buffer corrupted");
+        if (!src.equals_adaptive(sig, TOLERANCE))
+        {
+            src.dump("src ");
+            sig.dump("sig ");
+            UTEST_FAIL_MSG("Reverse plan transform differs at sample %d for rank=%d",
+                    int(src.last_diff()), int(rank));
+        }
+    }
+
+    void check_fastconv(size_t rank)
+    {
+        printf("Testing plan fast convolution for rank=%d...\n", int(rank));
+
+        size_t items    = size_t(1) << rank;
+        size_t half     = items >> 1;
+
+        dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::fft_plan_destroy(plan); };
+
+        FloatBuffer s1(half, 16, true);
+        FloatBuffer s2(half, 16, true);
+        FloatBuffer c1(items * 2, 16, true);
+        FloatBuffer c2(items * 2, 16, true);
+        FloatBuffer tmp(items * 2, 16, true);
+        FloatBuffer dst1(items, 16, true);
+        FloatBuffer dst2(items, 16, true);
+
+        // Reference: direct convolution, applied twice
+        for (size_t i=0; i<items; ++i)
+        {
+            double v = 0.0;
+            for (size_t j=0; j<half; ++j)
+            {
+                if ((i >= j) && ((i - j) < half))
+                    v          += double(s1[j]) * double(s2[i - j]);
+            }
+            dst1[i]     = v * 2.0;
+        }
+
+        // Plan fast convolution
+        dst2.fill_zero();
+        generic::plan_fastconv_parse(plan, c1, s1);
+        generic::plan_fastconv_parse_apply(plan, dst2, tmp, c1, s2);
+        generic::plan_fastconv_parse(plan, c2, s2);
+        generic::plan_fastconv_apply(plan, dst2, tmp, c1, c2);
+
+        UTEST_ASSERT_MSG(c1.valid(), "Convolution buffer 1 corrupted");
+        UTEST_ASSERT_MSG(c2.valid(), "Convolution buffer 2 corrupted");
+        UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of plan fast convolution differs at sample %d for rank=%d",
+                    int(dst1.last_diff()), int(rank));
+        }
+
+        // Parse and restore should keep the signal
+        generic::plan_fastconv_parse(plan, c1, s1);
+        generic::plan_fastconv_restore(plan, dst2, c1);
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        for (size_t i=0; i<items; ++i)
+        {
+            float v = (i < half) ? s1[i] : 0.0f;
+            if (fabs(dst2[i] - v) > TOLERANCE)
+                UTEST_FAIL_MSG("Restored signal differs at sample %d for rank=%d (%.5f vs %.5f)",
+                        int(i), int(rank), v, dst2[i]);
+        }
+    }
+
+    void call(const char *label, size_t align, plan_packed_fft_t func1, plan_packed_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t rank=0; rank<=MAX_RANK; ++rank)
+            {
+                size_t items    = size_t(1) << rank;
+                dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+                UTEST_ASSERT(plan != NULL);
+                lsp_finally { generic::fft_plan_destroy(plan); };
+
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(items * 2, align, mask & 0x01);
+                    FloatBuffer dst1(items * 2, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, items * 2);
+                        dsp::copy(dst2, src, items * 2);
+                        func1(plan, dst1, dst1);
+                        func2(plan, dst2, dst2);
+                    }
+                    else
+                    {
+                        func1(plan, dst1, src);
+                        func2(plan, dst2, src);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        ssize_t diff = dst1.last_diff();
+                        src.dump("src ");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1.get(diff), dst2.get(diff));
+                    }
+                }
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, plan_fft_t func1, plan_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t rank=0; rank<=MAX_RANK; ++rank)
+            {
+                size_t items    = size_t(1) << rank;
+                dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+                UTEST_ASSERT(plan != NULL);
+                lsp_finally { generic::fft_plan_destroy(plan); };
+
+                for (size_t mask=0; mask <= 0x0f; ++mask)
+                {
+                    FloatBuffer src_re(items, align, mask & 0x01);
+                    FloatBuffer src_im(items, align, mask & 0x02);
+                    FloatBuffer dst1_re(items, align, mask & 0x04);
+                    FloatBuffer dst1_im(items, align, mask & 0x08);
+                    FloatBuffer dst2_re(dst1_re);
+                    FloatBuffer dst2_im(dst1_im);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1_re, src_re, items);
+                        dsp::copy(dst1_im, src_im, items);
+                        dsp::copy(dst2_re, src_re, items);
+                        dsp::copy(dst2_im, src_im, items);
+                        func1(plan, dst1_re, dst1_im, dst1_re, dst1_im);
+                        func2(plan, dst2_re, dst2_im, dst2_re, dst2_im);
+                    }
+                    else
+                    {
+                        func1(plan, dst1_re, dst1_im, src_re, src_im);
+                        func2(plan, dst2_re, dst2_im, src_re, src_im);
+                    }
+
+                    UTEST_ASSERT_MSG(src_re.valid(), "Source buffer RE corrupted");
+                    UTEST_ASSERT_MSG(src_im.valid(), "Source buffer IM corrupted");
+                    UTEST_ASSERT_MSG(dst1_re.valid(), "Destination buffer 1 RE corrupted");
+                    UTEST_ASSERT_MSG(dst1_im.valid(), "Destination buffer 1 IM corrupted");
+                    UTEST_ASSERT_MSG(dst2_re.valid(), "Destination buffer 2 RE corrupted");
+                    UTEST_ASSERT_MSG(dst2_im.valid(), "Destination buffer 2 IM corrupted");
+
+                    // Compare buffers
+                    if ((!dst1_re.equals_adaptive(dst2_re, TOLERANCE)) || (!dst1_im.equals_adaptive(dst2_im, TOLERANCE)))
+                    {
+                        src_re.dump("src_re ");
+                        src_im.dump("src_im ");
+                        dst1_re.dump("dst1_re");
+                        dst1_im.dump("dst1_im");
+                        dst2_re.dump("dst2_re");
+                        dst2_im.dump("dst2_im");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                    }
+                }
+            }
+        }
+    }
+
+    void check_fastconv_rank0()
+    {
+        printf("Testing plan fast convolution for rank=0...\n");
+
+        dsp::fft_plan_t *plan = generic::fft_plan_create(0);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::fft_plan_destroy(plan); };
+
+        // The plan of rank 0 should be rejected without touching the buffers
+        FloatBuffer src(4, 16, true);
+        FloatBuffer c(4, 16, true);
+        FloatBuffer tmp(4, 16, true);
+        FloatBuffer dst(4, 16, true);
+        FloatBuffer tmp_copy(tmp);
+        FloatBuffer dst_copy(dst);
+
+        generic::plan_fastconv_parse(plan, tmp, src);
+        generic::plan_fastconv_parse_apply(plan, dst, tmp, c, src);
+        generic::plan_fastconv_apply(plan, dst, tmp, c, c);
+        generic::plan_fastconv_restore(plan, dst, tmp);
+
+        UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        UTEST_ASSERT_MSG(tmp.equals_absolute(tmp_copy), "Temporary buffer modified for rank=0");
+        UTEST_ASSERT_MSG(dst.equals_absolute(dst_copy), "Destination buffer modified for rank=0");
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_ASSERT(generic::fft_plan_create(64) == NULL);
+
+        check_fastconv_rank0();
+
+        for (size_t rank=0; rank<=MAX_RANK; ++rank)
+            check_accuracy(rank);
+        for (size_t rank=1; rank<=12; ++rank)
+            check_fastconv(rank);
+
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::plan_direct_fft, sse::plan_direct_fft, 16));
+        IF_ARCH_X86(CALL(generic::plan_reverse_fft, sse::plan_reverse_fft, 16));
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, sse::plan_packed_direct_fft, 16));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, sse::plan_packed_reverse_fft, 16));
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, avx::plan_packed_direct_fft, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, avx::plan_packed_reverse_fft, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_direct_fft, avx::plan_packed_direct_fft_fma3, 32));
+        IF_ARCH_X86(CALL(generic::plan_packed_reverse_fft, avx::plan_packed_reverse_fft_fma3, 32));
+    }
+UTEST_END;
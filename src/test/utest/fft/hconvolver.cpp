@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::hconvolver_t *hconvolver_create(const float *ir, size_t length, size_t head, size_t max_rank);
+        void hconvolver_destroy(dsp::hconvolver_t *cv);
+        void hconvolver_reset(dsp::hconvolver_t *cv);
+        void hconvolver_process(dsp::hconvolver_t *cv, float *dst, const float *src, size_t count);
+    }
+
+    static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; (j<length) && ((i + j) < count); ++j)
+                dst[i+j] += src[i] * conv[j];
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", hconvolver)
+
+    void call(size_t align, size_t length, size_t head, size_t max_rank, bool in_place)
+    {
+        printf("Testing length=%d, head=%d, max_rank=%d, in_place=%s\n",
+            int(length), int(head), int(max_rank), (in_place) ? "true" : "false");
+
+        FloatBuffer ir(length, align, false);
+        dsp::hconvolver_t *cv = generic::hconvolver_create(ir, length, head, max_rank);
+        UTEST_ASSERT(cv != NULL);
+        lsp_finally { generic::hconvolver_destroy(cv); };
+
+        size_t count    = length + head * 4 + 3001;
+        FloatBuffer src(count, align, false);
+        FloatBuffer dst1(count, align, false);
+        FloatBuffer dst2(count, align, false);
+
+        // Compute reference output without latency
+        dst1.fill_zero();
+        convolve(dst1, src, ir, length, count);
+
+        // Do the same twice to check that reset works properly
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            // Process the data by blocks of variable size
+            if (in_place)
+                dsp::copy(dst2, src, count);
+            for (size_t off=0, step=1; off < count; step = (step * 7 + 3) % 1531 + 1)
+            {
+                size_t to_do    = lsp_min(count - off, step);
+                generic::hconvolver_process(cv, &dst2[off], (in_place) ? &dst2[off] : &src[off], to_do);
+                off            += to_do;
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(ir.valid(), "IR buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            // Compare buffers
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                ssize_t diff = dst2.last_diff();
+                UTEST_FAIL_MSG("Output of convolver differs at sample %d (%.6f vs %.6f), pass=%d",
+                    int(diff), dst1.get(diff), dst2.get(diff), int(pass));
+            }
+
+            generic::hconvolver_reset(cv);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        FloatBuffer ir(16, 16, false);
+        UTEST_ASSERT(generic::hconvolver_create(NULL, 16, 64, 8) == NULL);
+        UTEST_ASSERT(generic::hconvolver_create(ir, 0, 64, 8) == NULL);
+        UTEST_ASSERT(generic::hconvolver_create(ir, 16, LSP_DSP_HCONVOLVER_HEAD_MIN - 1, 8) == NULL);
+        UTEST_ASSERT(generic::hconvolver_create(ir, 16, LSP_DSP_HCONVOLVER_HEAD_MAX + 1, LSP_DSP_CONVOLVER_RANK_MAX) == NULL);
+        UTEST_ASSERT(generic::hconvolver_create(ir, 16, 64, 6) == NULL);
+        UTEST_ASSERT(generic::hconvolver_create(ir, 16, 64, LSP_DSP_CONVOLVER_RANK_MAX + 1) == NULL);
+
+        UTEST_FOREACH(length, 1, 15, 16, 17, 100, 256, 1000, 4096, 10000)
+        {
+            call(16, length, 16, 5, false);
+            call(16, length, 64, 7, true);
+            call(16, length, 100, 10, false);
+            call(16, length, 256, 12, true);
+            call(16, length, 1000, LSP_DSP_CONVOLVER_RANK_MAX, false);
+        }
+    }
+
+UTEST_END;
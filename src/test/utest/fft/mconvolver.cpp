@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-3
+#define MAX_CHANNELS 8
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::mconvolver_t *mconvolver_create(const float * const *ir, size_t inputs, size_t outputs, size_t length, size_t rank);
+        void mconvolver_destroy(dsp::mconvolver_t *cv);
+        void mconvolver_reset(dsp::mconvolver_t *cv);
+        size_t mconvolver_latency(const dsp::mconvolver_t *cv);
+        void mconvolver_process(dsp::mconvolver_t *cv, float * const *dst, const float * const *src, size_t count);
+    }
+
+    static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; (j<length) && ((i + j) < count); ++j)
+                dst[i+j] += src[i] * conv[j];
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", mconvolver)
+
+    void call(size_t align, size_t inputs, size_t outputs, size_t length, size_t rank, bool in_place)
+    {
+        printf("Testing %dx%d: length=%d, rank=%d, in_place=%s\n",
+            int(inputs), int(outputs), int(length), int(rank), (in_place) ? "true" : "false");
+
+        // Prepare impulse responses, every third pair is not mixed
+        const size_t pairs  = inputs * outputs;
+        FloatBuffer irdata(length * pairs, align, false);
+        const float *ir[MAX_CHANNELS * MAX_CHANNELS];
+        for (size_t i=0; i<pairs; ++i)
+            ir[i]           = ((i % 3) != 2) ? &irdata[i * length] : NULL;
+
+        dsp::mconvolver_t *cv = generic::mconvolver_create(ir, inputs, outputs, length, rank);
+        UTEST_ASSERT(cv != NULL);
+        lsp_finally { generic::mconvolver_destroy(cv); };
+
+        size_t latency  = generic::mconvolver_latency(cv);
+        UTEST_ASSERT(latency == size_t(1) << (rank - 1));
+
+        // Compute reference output
+        size_t count    = length + latency * 8 + 1;
+        FloatBuffer src(count * inputs, align, false);
+        FloatBuffer dst1(count * outputs, align, false);
+        FloatBuffer dst2(count * lsp_max(inputs, outputs), align, false);
+
+        dst1.fill_zero();
+        for (size_t o=0; o<outputs; ++o)
+            for (size_t i=0; i<inputs; ++i)
+            {
+                if (ir[o * inputs + i] != NULL)
+                    convolve(&dst1[o * count + latency], &src[i * count], ir[o * inputs + i], length, count - latency);
+            }
+
+        // Do the same twice to check that reset works properly
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            // Process the data by blocks of variable size, in-place processing shares buffers
+            float *vdst[MAX_CHANNELS];
+            const float *vsrc[MAX_CHANNELS];
+
+            if (in_place)
+                dsp::copy(dst2, src, count * inputs);
+            for (size_t off=0, step=1; off < count; step = (step * 7 + 3) % 97 + 1)
+            {
+                size_t to_do    = lsp_min(count - off, step);
+                for (size_t i=0; i<inputs; ++i)
+                    vsrc[i]         = (in_place) ? &dst2[i * count + off] : &src[i * count + off];
+                for (size_t o=0; o<outputs; ++o)
+                    vdst[o]         = &dst2[o * count + off];
+
+                generic::mconvolver_process(cv, vdst, vsrc, to_do);
+                off            += to_do;
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(irdata.valid(), "IR buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            // Compare buffers
+            for (size_t o=0; o<outputs; ++o)
+            {
+                const float *a  = &dst1[o * count];
+                const float *b  = &dst2[o * count];
+                for (size_t i=0; i<count; ++i)
+                {
+                    if (!float_equals_adaptive(a[i], b[i], TOLERANCE))
+                        UTEST_FAIL_MSG("Output %d differs at sample %d (%.6f vs %.6f), pass=%d",
+                            int(o), int(i), a[i], b[i], int(pass));
+                }
+            }
+
+            generic::mconvolver_reset(cv);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        FloatBuffer ir(16, 16, false);
+        const float *vir[1] = { ir };
+        UTEST_ASSERT(generic::mconvolver_create(NULL, 1, 1, 16, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::mconvolver_create(vir, 0, 1, 16, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::mconvolver_create(vir, 1, 0, 16, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::mconvolver_create(vir, 1, 1, 0, LSP_DSP_CONVOLVER_RANK_MIN) == NULL);
+        UTEST_ASSERT(generic::mconvolver_create(vir, 1, 1, 16, LSP_DSP_CONVOLVER_RANK_MIN - 1) == NULL);
+        UTEST_ASSERT(generic::mconvolver_create(vir, 1, 1, 16, LSP_DSP_CONVOLVER_RANK_MAX + 1) == NULL);
+
+        UTEST_FOREACH(length, 1, 15, 16, 17, 100, 256, 1000, 3000)
+        {
+            call(16, 1, 1, length, 5, false);
+            call(16, 2, 3, length, 6, true);
+            call(16, 4, 2, length, 7, false);
+            call(16, 3, 8, length, 8, true);
+            call(16, 8, 4, length, 5, false);
+        }
+    }
+
+UTEST_END;
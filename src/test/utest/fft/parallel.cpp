@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fft_plan_t *fft_plan_create(size_t rank);
+        void fft_plan_destroy(dsp::fft_plan_t *plan);
+
+        dsp::workers_t *workers_create(size_t threads);
+        void workers_destroy(dsp::workers_t *pool);
+        size_t workers_threads(const dsp::workers_t *pool);
+        void parallel_packed_direct_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void parallel_packed_reverse_fft(dsp::workers_t *pool, const dsp::fft_plan_t *plan, float *dst, const float *src);
+        void parallel_convolve(dsp::workers_t *pool, float *dst, const float *src, const float *conv, size_t length, size_t count, size_t rank);
+    }
+
+    static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<length; ++j)
+                dst[i+j] += src[i] * conv[j];
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.fft", parallel)
+
+    void check_fft(dsp::workers_t *pool, size_t rank, bool in_place)
+    {
+        printf("Testing parallel FFT: threads=%d, rank=%d, in_place=%s\n",
+            int(generic::workers_threads(pool)), int(rank), (in_place) ? "true" : "false");
+
+        size_t items    = size_t(1) << rank;
+        dsp::fft_plan_t *plan = generic::fft_plan_create(rank);
+        UTEST_ASSERT(plan != NULL);
+        lsp_finally { generic::fft_plan_destroy(plan); };
+
+        FloatBuffer src(items * 2, 16, true);
+        FloatBuffer dst1(items * 2, 16, true);
+        FloatBuffer dst2(items * 2, 16, true);
+
+        // Direct transform
+        dsp::plan_packed_direct_fft(plan, dst1, src);
+        if (in_place)
+        {
+            dst2.copy(src);
+            generic::parallel_packed_direct_fft(pool, plan, dst2, dst2);
+        }
+        else
+            generic::parallel_packed_direct_fft(pool, plan, dst2, src);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Direct parallel FFT differs at sample %d", int(dst1.last_diff()));
+        }
+
+        // Reverse transform
+        dsp::plan_packed_reverse_fft(plan, dst1, dst1);
+        generic::parallel_packed_reverse_fft(pool, plan, dst2, dst2);
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Reverse parallel FFT differs at sample %d", int(dst1.last_diff()));
+        }
+        if (!src.equals_adaptive(dst2, TOLERANCE))
+            UTEST_FAIL_MSG("Reverse parallel FFT does not restore the signal at sample %d", int(src.last_diff()));
+    }
+
+    void check_convolve(dsp::workers_t *pool, size_t length, size_t count, size_t rank)
+    {
+        printf("Testing parallel convolution: threads=%d, length=%d, count=%d, rank=%d\n",
+            int(generic::workers_threads(pool)), int(length), int(count), int(rank));
+
+        FloatBuffer src(count, 16, true);
+        FloatBuffer conv(length, 16, true);
+        FloatBuffer dst1(count + length - 1, 16, true);
+        FloatBuffer dst2(count + length - 1, 16, true);
+
+        dst1.randomize_sign();
+        dst2.copy(dst1);
+
+        convolve(dst1, src, conv, length, count);
+        generic::parallel_convolve(pool, dst2, src, conv, length, count, rank);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Parallel convolution differs at sample %d", int(dst1.last_diff()));
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        UTEST_ASSERT(generic::workers_create(0) == NULL);
+        UTEST_ASSERT(generic::workers_create(LSP_DSP_WORKERS_MAX + 1) == NULL);
+
+        UTEST_FOREACH(threads, 1, 2, 3, 4)
+        {
+            dsp::workers_t *pool = generic::workers_create(threads);
+            UTEST_ASSERT(pool != NULL);
+            lsp_finally { generic::workers_destroy(pool); };
+            UTEST_ASSERT(generic::workers_threads(pool) == threads);
+
+            for (size_t rank=6; rank<=18; rank += 3)
+            {
+                check_fft(pool, rank, false);
+                check_fft(pool, rank, true);
+            }
+            check_fft(pool, 13, false);
+            check_fft(pool, 14, true);
+
+            UTEST_FOREACH(length, 1, 16, 100, 1000, 5000)
+            {
+                check_convolve(pool, length, 1, 6);
+                check_convolve(pool, length, 777, 5);
+                check_convolve(pool, length, 4096, 8);
+                check_convolve(pool, length, 10000, 10);
+            }
+            check_convolve(pool, 100, 100, LSP_DSP_CONVOLVER_RANK_MAX + 1);
+        }
+    }
+
+UTEST_END;
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       5e-2
+#define MAX_RANK        16
+
+namespace lsp
+{
+    namespace generic
+    {
+        void packed_direct_fft(float *dst, const float *src, size_t rank);
+        void real_direct_fft(float *dst, const float *src, size_t rank);
+        void real_reverse_fft(float *dst, const float *src, size_t rank);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+        }
+
+        namespace avx
+        {
+            void real_direct_fft(float *dst, const float *src, size_t rank);
+            void real_reverse_fft(float *dst, const float *src, size_t rank);
+
+            void real_direct_fft_fma3(float *dst, const float *src, size_t rank);
+            void real_reverse_fft_fma3(float *dst, const float *src, size_t rank);
+        }
+    )
+}
+
+typedef void (* real_fft_t)(float *dst, const float *src, size_t rank);
+
+UTEST_BEGIN("dsp.fft", rfft)
+
+    void check_spectrum(const char *label, real_fft_t direct, real_fft_t reverse)
+    {
+        printf("Testing '%s' against complex FFT and reverse transform...\n", label);
+
+        for (size_t rank=1; rank<=MAX_RANK; ++rank)
+        {
+            size_t items = size_t(1) << rank;
+            FloatBuffer src(items, 16, true);
+            FloatBuffer cplx(items * 2, 16, true);
+            FloatBuffer dst1(items + 2, 16, true);
+            FloatBuffer dst2(items + 2, 16, true);
+            FloatBuffer sig(items, 16, true);
+
+            // Compute reference spectrum as complex FFT of the real signal
+            for (size_t i=0; i<items; ++i)
+            {
+                cplx[i*2]       = src[i];
+                cplx[i*2 + 1]   = 0.0f;
+            }
+            generic::packed_direct_fft(cplx, cplx, rank);
+            dsp::copy(dst1, cplx, items + 2);
+            dst1[1]         = 0.0f;
+            dst1[items + 1] = 0.0f;
+
+            // Compute real FFT
+            direct(dst2, src, rank);
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer corrupted");
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src ");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Spectrum of '%s' differs at sample %d for rank=%d",
+                        label, int(dst1.last_diff()), int(rank));
+            }
+
+            // Compute reverse real FFT and compare with the original signal
+            reverse(sig, dst2, rank);
+            UTEST_ASSERT_MSG(sig.valid(), "Signal buffer corrupted");
+            if (!src.equals_adaptive(sig, TOLERANCE))
+            {
+                src.dump("src ");
+                sig.dump("sig ");
+                UTEST_FAIL_MSG("Reverse transform of '%s' differs at sample %d for rank=%d",
+                        label, int(src.last_diff()), int(rank));
+            }
+        }
+    }
+
+    void call(const char *label, size_t align, bool reverse, real_fft_t func1, real_fft_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        for (int same=0; same < 2; ++same)
+        {
+            for (size_t rank=0; rank<=MAX_RANK; ++rank)
+            {
+                size_t items    = size_t(1) << rank;
+                size_t scount   = (reverse) ? items + 2 : items;
+
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    FloatBuffer src(scount, align, mask & 0x01);
+                    FloatBuffer dst1(items + 2, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    printf("Testing '%s' for rank=%d, mask=0x%x, same=%s...\n", label, int(rank), int(mask), (same) ? "true" : "false");
+
+                    if (same)
+                    {
+                        dsp::copy(dst1, src, scount);
+                        dsp::copy(dst2, src, scount);
+                        func1(dst1, dst1, rank);
+                        func2(dst2, dst2, rank);
+                    }
+                    else
+                    {
+                        func1(dst1, src, rank);
+                        func2(dst2, src, rank);
+                    }
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        ssize_t diff = dst1.last_diff();
+                        src.dump("src ");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d (%.5f vs %.5f)",
+                                label, int(diff), dst1.get(diff), dst2.get(diff));
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_spectrum("generic::real_direct_fft", generic::real_direct_fft, generic::real_reverse_fft);
+
+        #define CALL(generic, func, align, reverse) \
+            call(#func, align, reverse, generic, func)
+
+        IF_ARCH_X86(CALL(generic::real_direct_fft, sse::real_direct_fft, 16, false));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, sse::real_reverse_fft, 16, true));
+        IF_ARCH_X86(CALL(generic::real_direct_fft, avx::real_direct_fft, 32, false));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, avx::real_reverse_fft, 32, true));
+        IF_ARCH_X86(CALL(generic::real_direct_fft, avx::real_direct_fft_fma3, 32, false));
+        IF_ARCH_X86(CALL(generic::real_reverse_fft, avx::real_reverse_fft_fma3, 32, true));
+    }
+UTEST_END;
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void sdft_init(dsp::sdft_x8_t *bank, const float *freq, float length, size_t bins);
+        void sdft_reset(dsp::sdft_x8_t *bank, size_t bins);
+        void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+        void sdft_amplitude(float *dst, const dsp::sdft_x8_t *bank, size_t bins);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+        }
+
+        namespace avx
+        {
+            void sdft_process(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+            void sdft_process_fma3(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+        }
+    )
+
+    typedef void (* sdft_process_t)(dsp::sdft_x8_t *bank, const float *src, size_t bins, size_t count);
+}
+
+UTEST_BEGIN("dsp.fft", sdft)
+
+    void call(const char *text, sdft_process_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(bins, 1, 3, 8, 9, 16, 24, 33, 64)
+        {
+            printf("Testing %s for %d bins...\n", text, int(bins));
+
+            const size_t banks  = (bins + 7) >> 3;
+            const size_t count  = 1000;
+            uint8_t *data       = NULL;
+            dsp::sdft_x8_t *b1  = alloc_aligned<dsp::sdft_x8_t>(data, banks * 2, LSP_DSP_SDFT_ALIGN);
+            dsp::sdft_x8_t *b2  = &b1[banks];
+            FloatBuffer freq(bins);
+            FloatBuffer src(count);
+
+            for (size_t i=0; i<bins; ++i)
+                freq[i]             = randf(0.0f, 0.5f);
+            src.randomize_sign();
+
+            generic::sdft_init(b1, freq, 100.0f, bins);
+            generic::sdft_init(b2, freq, 100.0f, bins);
+
+            // Process by blocks of variable size
+            generic::sdft_process(b1, src, bins, count);
+            for (size_t off=0, block=0; off < count; block = (block * 5 + 3) % 37)
+            {
+                size_t to_do        = lsp_min(count - off, block);
+                func(b2, &src[off], bins, to_do);
+                off                += to_do;
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+
+            for (size_t i=0; i<banks; ++i)
+            {
+                for (size_t j=0; j<8; ++j)
+                {
+                    if ((fabsf(b1[i].re[j] - b2[i].re[j]) > 1e-4f) ||
+                        (fabsf(b1[i].im[j] - b2[i].im[j]) > 1e-4f))
+                        UTEST_FAIL_MSG("Bin %d differs: (%.6f, %.6f) vs (%.6f, %.6f)",
+                            int(i*8 + j), b1[i].re[j], b1[i].im[j], b2[i].re[j], b2[i].im[j]);
+                    if ((i*8 + j) >= bins)
+                    {
+                        UTEST_ASSERT_MSG((b2[i].re[j] == 0.0f) && (b2[i].im[j] == 0.0f),
+                            "Unused bin %d is not zero", int(i*8 + j));
+                    }
+                }
+            }
+
+            free_aligned(data);
+        }
+    }
+
+    void check_amplitude()
+    {
+        printf("Testing amplitude of sinusoids...\n");
+
+        const size_t bins   = 12;
+        const size_t count  = 20000;
+        uint8_t *data       = NULL;
+        dsp::sdft_x8_t *b   = alloc_aligned<dsp::sdft_x8_t>(data, 2, LSP_DSP_SDFT_ALIGN);
+        FloatBuffer freq(bins);
+        FloatBuffer src(count);
+        FloatBuffer amp(bins);
+
+        // Test signal is a sum of two sinusoids at bins 3 and 7
+        for (size_t i=0; i<bins; ++i)
+            freq[i]             = 0.01f + 0.035f * i;
+        for (size_t i=0; i<count; ++i)
+            src[i]              = 0.5f * cos(2.0 * M_PI * freq[3] * i + 0.3) + 0.25f * sin(2.0 * M_PI * freq[7] * i);
+
+        dsp::sdft_init(b, freq, 1000.0f, bins);
+        dsp::sdft_process(b, src, bins, count);
+        dsp::sdft_amplitude(amp, b, bins);
+
+        for (size_t i=0; i<bins; ++i)
+        {
+            float ref           = (i == 3) ? 0.5f : (i == 7) ? 0.25f : 0.0f;
+            if (fabsf(amp[i] - ref) > 1e-2f)
+                UTEST_FAIL_MSG("Amplitude of bin %d differs: %.6f vs %.6f", int(i), amp[i], ref);
+        }
+
+        // After the reset all bins should be zero
+        dsp::sdft_reset(b, bins);
+        dsp::sdft_amplitude(amp, b, bins);
+        for (size_t i=0; i<bins; ++i)
+            UTEST_ASSERT_MSG(amp[i] == 0.0f, "Bin %d is not zero after reset", int(i));
+
+        free_aligned(data);
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func) \
+            call(#func, func)
+
+        IF_ARCH_X86(CALL(sse::sdft_process));
+        IF_ARCH_X86(CALL(avx::sdft_process));
+        IF_ARCH_X86(CALL(avx::sdft_process_fma3));
+
+        check_amplitude();
+    }
+
+UTEST_END;
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::stft_t *stft_create(size_t rank, size_t hop, const float *window);
+        void stft_destroy(dsp::stft_t *st);
+        void stft_reset(dsp::stft_t *st);
+        size_t stft_latency(const dsp::stft_t *st);
+        const float *stft_spectrum(const dsp::stft_t *st);
+        size_t stft_process(dsp::stft_t *st, float *dst, const float *src, size_t count, dsp::stft_callback_t func, void *arg);
+    }
+
+    enum stft_window_t
+    {
+        W_RECT,
+        W_HANN,
+        W_SINE
+    };
+
+    static const char *stft_window_names[] = { "rect", "hann", "sine" };
+
+    static void stft_window(float *dst, stft_window_t type, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            switch (type)
+            {
+                case W_HANN:    dst[i] = 0.5f - 0.5f * cosf(2.0f * M_PI * i / n); break;
+                case W_SINE:    dst[i] = sinf(M_PI * (i + 0.5f) / n); break;
+                default:        dst[i] = 1.0f; break;
+            }
+        }
+    }
+
+    typedef struct stft_counter_t
+    {
+        size_t      frames;
+        size_t      rank;
+        bool        clear;
+    } stft_counter_t;
+
+    static void stft_count(void *arg, float *spectrum, size_t rank)
+    {
+        stft_counter_t *c   = static_cast<stft_counter_t *>(arg);
+        ++c->frames;
+        c->rank             = rank;
+        if (c->clear)
+            dsp::fill_zero(spectrum, (size_t(1) << rank) + 2);
+    }
+}
+
+UTEST_BEGIN("dsp.fft", stft)
+
+    void call(size_t rank, size_t hop, stft_window_t wtype, bool in_place)
+    {
+        const size_t n      = size_t(1) << rank;
+        const size_t count  = n * 8 + 77;
+
+        printf("Testing STFT rank=%d, hop=%d, window=%s, in_place=%s\n",
+            int(rank), int(hop), stft_window_names[wtype], (in_place) ? "true" : "false");
+
+        FloatBuffer wnd(n);
+        stft_window(wnd, wtype, n);
+
+        dsp::stft_t *st     = generic::stft_create(rank, hop, (wtype == W_RECT) ? NULL : wnd.data());
+        UTEST_ASSERT(st != NULL);
+        lsp_finally { generic::stft_destroy(st); };
+        UTEST_ASSERT(generic::stft_latency(st) == n);
+
+        FloatBuffer src(count);
+        FloatBuffer dst(count);
+        src.randomize_sign();
+        UTEST_ASSERT(wnd.valid());
+
+        // Process the data by blocks of variable size, the unmodified spectrum should give
+        // the delayed input signal
+        stft_counter_t c;
+        c.frames            = 0;
+        c.rank              = 0;
+        c.clear             = false;
+
+        size_t frames       = 0;
+        for (size_t off=0, block=1; off < count; block = (block * 7 + 3) % 331 + 1)
+        {
+            size_t to_do        = lsp_min(count - off, block);
+            if (in_place)
+            {
+                dsp::copy(&dst[off], &src[off], to_do);
+                frames             += generic::stft_process(st, &dst[off], &dst[off], to_do, stft_count, &c);
+            }
+            else
+                frames             += generic::stft_process(st, &dst[off], &src[off], to_do, stft_count, &c);
+            off                += to_do;
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        UTEST_ASSERT(c.rank == rank);
+        UTEST_ASSERT_MSG((frames == count / hop) && (c.frames == frames),
+            "Invalid number of frames: %d, %d, expected %d", int(frames), int(c.frames), int(count / hop));
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float ref           = (i >= n) ? src[i - n] : 0.0f;
+            if (fabsf(dst[i] - ref) > TOLERANCE)
+            {
+                src.dump("src");
+                dst.dump("dst");
+                UTEST_FAIL_MSG("Output differs at sample %d: %.6f vs %.6f", int(i), dst[i], ref);
+            }
+        }
+
+        // The spectrum of the last frame should match the spectrum of the windowed signal
+        FloatBuffer frame(n);
+        FloatBuffer spectrum(n + 2);
+        size_t last         = (count / hop) * hop;
+        for (size_t i=0; i<n; ++i)
+            frame[i]            = ((last + i) >= n) ? src[last + i - n] * wnd[i] : 0.0f;
+        dsp::real_direct_fft(spectrum, frame, rank);
+        const float *sp     = generic::stft_spectrum(st);
+        for (size_t i=0; i<n+2; ++i)
+        {
+            if (fabsf(sp[i] - spectrum[i]) > TOLERANCE * n)
+                UTEST_FAIL_MSG("Spectrum differs at index %d: %.6f vs %.6f", int(i), sp[i], spectrum[i]);
+        }
+
+        // Clearing the spectrum should produce silence after the tail of the previous frames
+        // is flushed, the analysis-only mode should not break the timing
+        generic::stft_reset(st);
+        c.clear             = true;
+        generic::stft_process(st, NULL, src, n, stft_count, &c);
+        generic::stft_process(st, dst, src, count, stft_count, &c);
+        UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+        for (size_t i=0; i<count; ++i)
+        {
+            if (dst[i] != 0.0f)
+                UTEST_FAIL_MSG("Output is not silent at sample %d: %.6f", int(i), dst[i]);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        UTEST_ASSERT(generic::stft_create(LSP_DSP_STFT_RANK_MIN - 1, 1, NULL) == NULL);
+        UTEST_ASSERT(generic::stft_create(LSP_DSP_STFT_RANK_MAX + 1, 1, NULL) == NULL);
+        UTEST_ASSERT(generic::stft_create(8, 0, NULL) == NULL);
+        UTEST_ASSERT(generic::stft_create(8, 257, NULL) == NULL);
+
+        call(2, 1, W_RECT, false);
+        call(2, 4, W_RECT, false);
+        call(3, 2, W_HANN, false);
+        call(4, 4, W_HANN, true);
+        call(8, 256, W_RECT, false);
+        call(8, 128, W_SINE, false);
+        call(8, 100, W_SINE, true);
+        call(10, 256, W_HANN, false);
+        call(10, 256, W_HANN, true);
+        call(12, 1024, W_SINE, false);
+        call(12, 333, W_HANN, false);
+    }
+
+UTEST_END;
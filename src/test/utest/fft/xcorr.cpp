@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::xcorr_t *xcorr_create(size_t rank, size_t mode);
+        void xcorr_destroy(dsp::xcorr_t *xc);
+        void xcorr_reset(dsp::xcorr_t *xc);
+        size_t xcorr_process(dsp::xcorr_t *xc, const float *a, const float *b, size_t count);
+        float xcorr_estimate(dsp::xcorr_t *xc, float *corr);
+    }
+}
+
+UTEST_BEGIN("dsp.fft", xcorr)
+
+    void check_function(size_t rank)
+    {
+        printf("Testing cross-correlation function rank=%d...\n", int(rank));
+
+        const size_t n      = size_t(1) << rank;
+        const size_t m      = n >> 1;
+        FloatBuffer a(m * 3), b(m * 3);
+        FloatBuffer corr(n);
+        a.randomize_sign();
+        b.randomize_sign();
+
+        dsp::xcorr_t *xc    = generic::xcorr_create(rank, LSP_DSP_XCORR_PLAIN);
+        UTEST_ASSERT(xc != NULL);
+
+        // Process three frames by blocks of variable size, the last frame is incomplete
+        size_t frames       = 0;
+        for (size_t off=0, block=1; off < (m * 3 - 1); block = (block * 7 + 5) % 61 + 1)
+        {
+            size_t to_do        = lsp_min(m * 3 - 1 - off, block);
+            frames             += generic::xcorr_process(xc, &a[off], &b[off], to_do);
+            off                += to_do;
+        }
+        UTEST_ASSERT_MSG(frames == 2, "Invalid number of frames: %d", int(frames));
+        generic::xcorr_estimate(xc, corr);
+        UTEST_ASSERT_MSG(corr.valid(), "Correlation buffer corrupted");
+
+        // Compare with the sum of direct linear cross-correlations of two frames
+        for (size_t i=0; i<n; ++i)
+        {
+            ssize_t lag         = ssize_t(i) - ssize_t(m);
+            double ref          = 0.0;
+            double norm         = 0.0;
+            for (size_t f=0; f<2; ++f)
+            {
+                const float *fa     = &a[f * m];
+                const float *fb     = &b[f * m];
+                for (ssize_t j=0; j<ssize_t(m); ++j)
+                {
+                    if (((j + lag) >= 0) && ((j + lag) < ssize_t(m)))
+                    {
+                        ref                += double(fa[j + lag]) * fb[j];
+                        norm               += fabs(double(fa[j + lag]) * fb[j]);
+                    }
+                }
+            }
+
+            if (fabs(corr[i] - ref) > 1e-4 * (norm + 1.0))
+                UTEST_FAIL_MSG("Correlation at lag %d differs: %.6f vs %.6f", int(lag), corr[i], ref);
+        }
+
+        generic::xcorr_destroy(xc);
+    }
+
+    void check_delay(size_t rank, size_t mode, float delay)
+    {
+        printf("Testing delay estimation rank=%d, mode=%d, delay=%.2f...\n", int(rank), int(mode), delay);
+
+        const size_t n      = size_t(1) << rank;
+        const size_t count  = n * 4;
+        FloatBuffer a(count), b(count);
+
+        // Broadband signal: sum of sinusoids with random frequencies and phases
+        for (size_t i=0; i<count; ++i)
+        {
+            a[i]                = 0.0f;
+            b[i]                = 0.0f;
+        }
+        for (size_t k=0; k<128; ++k)
+        {
+            double w            = M_PI * randf(0.01f, 0.95f);
+            double p            = 2.0 * M_PI * randf(0.0f, 1.0f);
+            for (size_t i=0; i<count; ++i)
+            {
+                a[i]               += sin(w * (double(i) - delay) + p);
+                b[i]               += sin(w * double(i) + p);
+            }
+        }
+
+        dsp::xcorr_t *xc    = generic::xcorr_create(rank, mode);
+        UTEST_ASSERT(xc != NULL);
+        UTEST_ASSERT(generic::xcorr_estimate(xc, NULL) == 0.0f);
+
+        size_t frames       = generic::xcorr_process(xc, a, b, count);
+        UTEST_ASSERT_MSG(frames == 8, "Invalid number of frames: %d", int(frames));
+
+        float est           = generic::xcorr_estimate(xc, NULL);
+        UTEST_ASSERT_MSG(fabsf(est - delay) < 0.3f, "Estimated delay %.3f differs from %.3f", est, delay);
+
+        // After reset the estimate should be zero
+        generic::xcorr_reset(xc);
+        UTEST_ASSERT(generic::xcorr_estimate(xc, NULL) == 0.0f);
+
+        generic::xcorr_destroy(xc);
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_ASSERT(generic::xcorr_create(LSP_DSP_XCORR_RANK_MIN - 1, LSP_DSP_XCORR_PLAIN) == NULL);
+        UTEST_ASSERT(generic::xcorr_create(LSP_DSP_XCORR_RANK_MAX + 1, LSP_DSP_XCORR_PLAIN) == NULL);
+        UTEST_ASSERT(generic::xcorr_create(8, 2) == NULL);
+
+        for (size_t rank=LSP_DSP_XCORR_RANK_MIN; rank <= 12; ++rank)
+            check_function(rank);
+
+        UTEST_FOREACH(rank, 8, 10, 12)
+        {
+            for (size_t mode=LSP_DSP_XCORR_PLAIN; mode <= LSP_DSP_XCORR_PHAT; ++mode)
+            {
+                check_delay(rank, mode, 0.0f);
+                check_delay(rank, mode, 5.0f);
+                check_delay(rank, mode, -17.0f);
+                check_delay(rank, mode, 3.4f);
+                check_delay(rank, mode, -9.75f);
+            }
+        }
+    }
+
+UTEST_END;
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <math.h>
+
+#define BUF_STEP        1031
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x1_bp(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+        }
+
+        IF_ARCH_X86_64(
+            namespace avx
+            {
+                void x64_biquad_process_s8(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+                void x64_biquad_process_s8_fma3(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+            }
+        )
+    )
+
+    typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_s8_t)(float *dst, const float *src, size_t stride, size_t count, dsp::biquad_t *f);
+}
+
+UTEST_BEGIN("dsp.filters", bp)
+
+    // Band-pass filter with the specified normalized frequency and quality
+    void init_filter(dsp::biquad_t *f, float freq, float q)
+    {
+        float w         = 2.0f * M_PI * freq;
+        float alpha     = sinf(w) * 0.5f / q;
+        float c         = cosf(w);
+        float n         = 1.0f / (1.0f + alpha);
+
+        dsp::biquad_x1_t *x1 = &f->x1;
+        x1->b0          = alpha * n;
+        x1->b1          = 0.0f;
+        x1->b2          = -alpha * n;
+        x1->a1          = 2.0f * c * n;
+        x1->a2          = (alpha - 1.0f) * n;
+        x1->p0          = 0.0f;
+        x1->p1          = 0.0f;
+        x1->p2          = 0.0f;
+
+        dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+    }
+
+    void check(const char *label, const FloatBuffer &src, const FloatBuffer &dst1, const FloatBuffer &dst2,
+        const dsp::biquad_t *f1, const dsp::biquad_t *f2)
+    {
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        for (size_t j=0; j<2; ++j)
+        {
+            if (float_equals_adaptive(f1->d[j], f2->d[j], TOLERANCE))
+                continue;
+            UTEST_FAIL_MSG("Filter memory items #%d for test '%s' differ: %.6f vs %.6f",
+                    int(j), label, f1->d[j], f2->d[j]);
+        }
+    }
+
+    void call(const char *label, biquad_process_t func, float freq, float q)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_t f1 __lsp_aligned64;
+        dsp::biquad_t f2 __lsp_aligned64;
+
+        UTEST_FOREACH(count, 0, 1, 16, 0x1ff, 0x200, 0x201, 0x7ff, 0x2000, 0x2001, 0x3fff, 10000, 0x12345)
+        {
+            printf("Testing %s on buffer size=%d, freq=%.4f, q=%.2f...\n", label, int(count), freq, q);
+
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            // Process the whole buffer
+            init_filter(&f1, freq, q);
+            init_filter(&f2, freq, q);
+            generic::biquad_process_x1(dst1, src, count, &f1);
+            func(dst2, src, count, &f2);
+            check(label, src, dst1, dst2, &f1, &f2);
+
+            // Process the buffer in-place by chunks to check that the filter memory is kept
+            init_filter(&f2, freq, q);
+            dst2.copy(src);
+            for (size_t i=0; i<count; )
+            {
+                size_t to_do    = lsp_min(count - i, size_t(BUF_STEP + (i & 0x3ff)));
+                func(dst2.data(i), dst2.data(i), to_do, &f2);
+                i              += to_do;
+            }
+            check(label, src, dst1, dst2, &f1, &f2);
+        }
+    }
+
+    void call_s8(const char *label, biquad_process_s8_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_t bank __lsp_aligned64;
+        dsp::biquad_t ref[8] __lsp_aligned64;
+
+        UTEST_FOREACH(count, 0, 1, 3, 4, 7, 8, 9, 16, 31, 0x40, 0x7f, 0x400)
+        {
+            UTEST_FOREACH(gap, 0, 5)
+            {
+                const size_t stride = count + gap;
+                printf("Testing %s on %d chunks of %d samples, stride=%d...\n", label, 8, int(count), int(stride));
+
+                FloatBuffer src(stride * 8);
+                FloatBuffer dst1(stride * 8);
+                FloatBuffer dst2(stride * 8);
+                src.randomize_sign();
+                dst1.copy(src);
+                dst2.copy(src);
+
+                // Reference: each chunk is processed by its own filter
+                dsp::fill_zero(bank.d, LSP_DSP_BIQUAD_D_ITEMS);
+                for (size_t j=0; j<8; ++j)
+                {
+                    init_filter(&ref[j], 0.01f + 0.05f * j, 0.5f + 0.3f * j);
+                    bank.x8.b0[j]   = ref[j].x1.b0;
+                    bank.x8.b1[j]   = ref[j].x1.b1;
+                    bank.x8.b2[j]   = ref[j].x1.b2;
+                    bank.x8.a1[j]   = ref[j].x1.a1;
+                    bank.x8.a2[j]   = ref[j].x1.a2;
+                    generic::biquad_process_x1(dst1.data(j * stride), src.data(j * stride), count, &ref[j]);
+                }
+
+                // Process in-place in two steps to check that the filter memory is kept
+                const size_t head   = count / 3;
+                func(dst2.data(), dst2.data(), stride, head, &bank);
+                func(dst2.data(head), dst2.data(head), stride, count - head, &bank);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t j=0; j<8; ++j)
+                {
+                    if ((!float_equals_adaptive(ref[j].d[0], bank.d[j], TOLERANCE)) ||
+                        (!float_equals_adaptive(ref[j].d[1], bank.d[j + 8], TOLERANCE)))
+                        UTEST_FAIL_MSG("Filter memory of chunk %d for test '%s' differs: {%.6f, %.6f} vs {%.6f, %.6f}",
+                                int(j), label, ref[j].d[0], ref[j].d[1], bank.d[j], bank.d[j + 8]);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, freq, q) \
+            call(#func, func, freq, q)
+
+        CALL(generic::biquad_process_x1_bp, 0.001f, 0.707f);    // Slowly decaying response
+        CALL(generic::biquad_process_x1_bp, 0.01f, 10.0f);      // Resonance
+        CALL(generic::biquad_process_x1_bp, 0.1f, 0.707f);      // Quickly decaying response
+        CALL(generic::biquad_process_x1_bp, 0.45f, 0.5f);       // Response decays to zero within the chunk
+
+        #undef CALL
+
+        #define CALL(func) \
+            call_s8(#func, func)
+
+        CALL(generic::biquad_process_s8);
+        IF_ARCH_X86(CALL(sse::biquad_process_s8));
+        IF_ARCH_X86_64(CALL(avx::x64_biquad_process_s8));
+        IF_ARCH_X86_64(CALL(avx::x64_biquad_process_s8_fma3));
+    }
+
+UTEST_END
@@ -23,11 +23,13 @@
 #include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/test-fw/utest.h>
 #include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/helpers.h>
 
 #define BIQUAD_X1_FLOATS    (sizeof(dsp::biquad_x1_t) / sizeof(float))
 #define BIQUAD_X2_FLOATS    (sizeof(dsp::biquad_x2_t) / sizeof(float))
 #define BIQUAD_X4_FLOATS    (sizeof(dsp::biquad_x4_t) / sizeof(float))
 #define BIQUAD_X8_FLOATS    (sizeof(dsp::biquad_x8_t) / sizeof(float))
+#define BIQUAD_X16_FLOATS   (sizeof(dsp::biquad_x16_t) / sizeof(float))
 #define CASCADE_FLOATS      (sizeof(dsp::f_cascade_t) / sizeof(float))
 
 namespace lsp
@@ -38,6 +40,7 @@ namespace lsp
         void bilinear_transform_x2(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         void bilinear_transform_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         void bilinear_transform_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+        void bilinear_transform_x16(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     }
 
     IF_ARCH_X86(
@@ -63,6 +66,13 @@ namespace lsp
             void bilinear_transform_x4(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
             void x64_bilinear_transform_x8(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_bilinear_transform_x16(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -89,6 +99,7 @@ namespace lsp
     typedef void (* bilinear_transform_x2_t)(dsp::biquad_x2_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     typedef void (* bilinear_transform_x4_t)(dsp::biquad_x4_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
     typedef void (* bilinear_transform_x8_t)(dsp::biquad_x8_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+    typedef void (* bilinear_transform_x16_t)(dsp::biquad_x16_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
 }
 
 UTEST_BEGIN("dsp.filters", bt)
@@ -265,6 +276,73 @@ UTEST_BEGIN("dsp.filters", bt)
         }
     }
 
+    void call(const char *text, bilinear_transform_x16_t f1, bilinear_transform_x16_t f2)
+    {
+        if (!UTEST_SUPPORTED(f1))
+            return;
+        if (!UTEST_SUPPORTED(f2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 16, 17, 0x1ff)
+        {
+            size_t filters = count + 15;
+            size_t cascades = filters * 16;
+            printf("Testing %s bilinear transformation, filters=%d, cascades=%d\n", text, int(filters), int(cascades));
+
+            FloatBuffer src(CASCADE_FLOATS * cascades, 64, true);
+            FloatBuffer dst1(BIQUAD_X16_FLOATS * filters, 64, true);
+            FloatBuffer dst2(dst1);
+            FloatBuffer ref(BIQUAD_X1_FLOATS * cascades, 64, true);
+
+            dsp::f_cascade_t *bc = src.data<dsp::f_cascade_t>();
+            for (size_t i=0; i<cascades; ++i)
+            {
+                float kt = i * 0.1;
+                float kb = i * 0.05;
+                bc[i].t[0] = 1 + kt; bc[i].t[1] = 2 + kt;  bc[i].t[2] = 1 - kt; bc[i].t[3] = 0;
+                bc[i].b[0] = 1 + kb; bc[i].b[1] = -2 + kb; bc[i].b[2] = 1 - kb; bc[i].b[3] = 0;
+            }
+
+            f1(dst1.data<dsp::biquad_x16_t>(), bc, 1.5f, filters);
+            f2(dst2.data<dsp::biquad_x16_t>(), bc, 1.5f, filters);
+            generic::bilinear_transform_x1(ref.data<dsp::biquad_x1_t>(), bc, 1.5f, cascades);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            UTEST_ASSERT_MSG(ref.valid(), "Reference buffer corrupted");
+
+            // Check the layout of the bank against the single-cascade transform
+            const dsp::biquad_x16_t *bf = dst1.data<dsp::biquad_x16_t>();
+            const dsp::biquad_x1_t *rf  = ref.data<dsp::biquad_x1_t>();
+            for (size_t i=0; i<cascades; ++i)
+            {
+                const dsp::biquad_x16_t *f  = &bf[i >> 4];
+                const dsp::biquad_x1_t *r   = &rf[i];
+                size_t j                    = i & 0x0f;
+                if ((!float_equals_relative(f->b0[j], r->b0, 1e-4f)) ||
+                    (!float_equals_relative(f->b1[j], r->b1, 1e-4f)) ||
+                    (!float_equals_relative(f->b2[j], r->b2, 1e-4f)) ||
+                    (!float_equals_relative(f->a1[j], r->a1, 1e-4f)) ||
+                    (!float_equals_relative(f->a2[j], r->a2, 1e-4f)))
+                {
+                    dst1.dump("dst1");
+                    ref.dump("ref");
+                    UTEST_FAIL_MSG("Layout of x16 bank for test '%s' differs at cascade %d", text, int(i));
+                }
+            }
+
+            if (!dst1.equals_relative(dst2, 1e-4f))
+            {
+                src.dump("src");
+                src.dump_hex("srch");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs", text);
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         #define CALL(generic, func) \
@@ -290,6 +368,8 @@ UTEST_BEGIN("dsp.filters", bt)
         IF_ARCH_X86(CALL(generic::bilinear_transform_x8, avx::x64_bilinear_transform_x8));
         IF_ARCH_ARM(CALL(generic::bilinear_transform_x8, neon_d32::bilinear_transform_x8));
         IF_ARCH_AARCH64(CALL(generic::bilinear_transform_x8, asimd::bilinear_transform_x8));
+
+        IF_ARCH_X86_64(CALL(generic::bilinear_transform_x16, avx512::x64_bilinear_transform_x16));
     }
 
 UTEST_END;
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#include <math.h>
+
+#define MAX_SLOPE       8
+#define MAX_FILTERS     0x50
+#define FREQ_POINTS     7
+#define TOLERANCE       1e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        size_t filter_design_cascades(dsp::f_cascade_t *dst, const dsp::filter_params_t *p, size_t count);
+        size_t filter_design_bilinear(dsp::f_cascade_t *dst, const dsp::filter_params_t *p, size_t count, size_t lanes);
+
+        void filter_transfer_calc_ri(float *re, float *im, const dsp::f_cascade_t *c, const float *freq, size_t count);
+        void filter_transfer_apply_ri(float *re, float *im, const dsp::f_cascade_t *c, const float *freq, size_t count);
+        void bilinear_transform_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+        void dyn_biquad_design_x1(dsp::biquad_x1_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+    }
+
+    static const float test_freq[FREQ_POINTS] = { 0.1f, 0.5f, 0.9f, 1.0f, 1.1f, 2.0f, 10.0f };
+
+    // Chebyshev polynom of the first kind
+    static double chebyshev(size_t n, double x)
+    {
+        if (fabs(x) <= 1.0)
+            return cos(n * acos(x));
+        return cosh(n * acosh(x));
+    }
+
+    // Expected squared magnitude of the analog filter at normalized frequency w
+    static double expected_magnitude(const dsp::filter_params_t *p, double w)
+    {
+        const size_t n  = 2 * p->slope;
+        const double g2 = double(p->gain) * p->gain;
+
+        switch (p->type)
+        {
+            case LSP_DSP_FILTER_BT_LOPASS:
+                return g2 / (1.0 + pow(w, 2 * n));
+            case LSP_DSP_FILTER_BT_HIPASS:
+                return g2 / (1.0 + pow(w, -2.0 * n));
+            case LSP_DSP_FILTER_LR_LOPASS:
+            {
+                double k = 1.0 + pow(w, n);
+                return g2 / (k * k);
+            }
+            case LSP_DSP_FILTER_LR_HIPASS:
+            {
+                double k = 1.0 + pow(w, -double(n));
+                return g2 / (k * k);
+            }
+            case LSP_DSP_FILTER_CH_LOPASS:
+            case LSP_DSP_FILTER_CH_HIPASS:
+            {
+                double e2   = pow(10.0, p->q * 0.1) - 1.0;
+                double t    = chebyshev(n, (p->type == LSP_DSP_FILTER_CH_LOPASS) ? w : 1.0 / w);
+                return g2 * (1.0 + e2) / (1.0 + e2 * t * t);
+            }
+            default:
+                break;
+        }
+
+        return 0.0;
+    }
+}
+
+UTEST_BEGIN("dsp.filters", design)
+
+    // Compute the transfer function of the chain of cascades
+    void transfer(float *re, float *im, const dsp::f_cascade_t *c, size_t cascades, const float *freq, size_t count)
+    {
+        generic::filter_transfer_calc_ri(re, im, c, freq, count);
+        for (size_t i=1; i<cascades; ++i)
+            generic::filter_transfer_apply_ri(re, im, &c[i], freq, count);
+    }
+
+    void test_high_order(uint32_t type, size_t slope)
+    {
+        printf("Testing high-order filter type=%d, slope=%d\n", int(type), int(slope));
+
+        dsp::f_cascade_t c[MAX_SLOPE];
+        dsp::filter_params_t p;
+        p.type      = type;
+        p.slope     = slope;
+        p.freq      = 0.1f;
+        p.gain      = 0.5f;
+        p.q         = 1.0f;
+
+        size_t n    = generic::filter_design_cascades(c, &p, 1);
+        UTEST_ASSERT_MSG(n == slope, "Invalid number of cascades: %d", int(n));
+
+        float re[FREQ_POINTS], im[FREQ_POINTS];
+        transfer(re, im, c, n, test_freq, FREQ_POINTS);
+        for (size_t i=0; i<FREQ_POINTS; ++i)
+        {
+            float a     = re[i]*re[i] + im[i]*im[i];
+            float b     = expected_magnitude(&p, test_freq[i]);
+            UTEST_ASSERT_MSG(float_equals_adaptive(a, b, TOLERANCE),
+                "Magnitude differs at frequency %.3f: %.6f vs %.6f", test_freq[i], a, b);
+        }
+    }
+
+    void test_crossover(size_t slope)
+    {
+        printf("Testing Linkwitz-Riley crossover slope=%d\n", int(slope));
+
+        dsp::f_cascade_t c[MAX_SLOPE * 2];
+        dsp::filter_params_t p[2];
+        for (size_t i=0; i<2; ++i)
+        {
+            p[i].type       = (i == 0) ? LSP_DSP_FILTER_LR_LOPASS : LSP_DSP_FILTER_LR_HIPASS;
+            p[i].slope      = slope;
+            p[i].freq       = 0.1f;
+            p[i].gain       = 1.0f;
+            p[i].q          = 0.0f;
+        }
+        size_t n    = generic::filter_design_cascades(c, p, 2);
+        UTEST_ASSERT_MSG(n == slope * 2, "Invalid number of cascades: %d", int(n));
+
+        // The sum of low-pass and high-pass with proper polarity is an all-pass filter
+        float lre[FREQ_POINTS], lim[FREQ_POINTS], hre[FREQ_POINTS], him[FREQ_POINTS];
+        transfer(lre, lim, c, slope, test_freq, FREQ_POINTS);
+        transfer(hre, him, &c[slope], slope, test_freq, FREQ_POINTS);
+        float k     = (slope & 1) ? -1.0f : 1.0f;
+        for (size_t i=0; i<FREQ_POINTS; ++i)
+        {
+            float re    = lre[i] + k * hre[i];
+            float im    = lim[i] + k * him[i];
+            float a     = sqrtf(re*re + im*im);
+            UTEST_ASSERT_MSG(float_equals_adaptive(a, 1.0f, TOLERANCE),
+                "Crossover magnitude at frequency %.3f is %.6f", test_freq[i], a);
+        }
+    }
+
+    void test_slope(uint32_t type, size_t slope)
+    {
+        printf("Testing second-order filter type=%d, slope=%d\n", int(type), int(slope));
+
+        dsp::f_cascade_t c[MAX_SLOPE];
+        dsp::filter_params_t p;
+        p.type      = type;
+        p.slope     = slope;
+        p.freq      = 0.1f;
+        p.gain      = 4.0f;
+        p.q         = 2.0f;
+
+        size_t n    = generic::filter_design_cascades(c, &p, 1);
+        UTEST_ASSERT_MSG(n == slope, "Invalid number of cascades: %d", int(n));
+
+        // Check the gain of the whole filter at the control frequency
+        const float f[3] = { 1e-4f, 1.0f, 1e+4f };
+        float re[3], im[3];
+        transfer(re, im, c, n, f, 3);
+        size_t idx  = (type == LSP_DSP_FILTER_PEAK) ? 1 : (type == LSP_DSP_FILTER_LOSHELF) ? 0 : 2;
+        float a     = sqrtf(re[idx]*re[idx] + im[idx]*im[idx]);
+        UTEST_ASSERT_MSG(float_equals_adaptive(a, p.gain, TOLERANCE),
+            "Gain of the filter is %.6f, expected %.6f", a, p.gain);
+    }
+
+    void make_filters(dsp::filter_params_t *p, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            p[i].type       = i % (LSP_DSP_FILTER_LR_HIPASS + 1);
+            p[i].slope      = (i * 7) % 5;
+            p[i].freq       = 0.005f + 0.45f * float((i * 13) % count) / float(count);
+            p[i].gain       = 0.1f + 0.2f * (i % 17);
+            p[i].q          = 0.5f + 0.25f * (i % 11);
+        }
+    }
+
+    void test_bilinear(size_t count, size_t lanes)
+    {
+        printf("Testing bilinear filter design count=%d, lanes=%d\n", int(count), int(lanes));
+
+        dsp::filter_params_t p[MAX_FILTERS];
+        dsp::f_cascade_t c1[MAX_FILTERS * MAX_SLOPE + 16];
+        dsp::f_cascade_t c2[MAX_FILTERS * MAX_SLOPE + 16];
+        dsp::biquad_x1_t f1, f2;
+        make_filters(p, count);
+
+        size_t n1   = generic::filter_design_cascades(c1, p, count);
+        size_t n2   = generic::filter_design_bilinear(c2, p, count, lanes);
+        UTEST_ASSERT_MSG((n2 % lanes) == 0, "Output is not aligned: %d", int(n2));
+        UTEST_ASSERT_MSG((n2 >= n1) && (n2 < n1 + lanes), "Invalid output size: %d vs %d", int(n2), int(n1));
+
+        // Pre-warped cascades should give the same digital filter with kf=1
+        dsp::f_cascade_t *c = c1;
+        size_t k = 0;
+        for (size_t i=0; i<count; ++i)
+        {
+            float kf    = 1.0f / tanf(M_PI * p[i].freq);
+            size_t cn   = lsp_max(p[i].slope, 1u);
+            for (size_t j=0; j<cn; ++j, ++c, ++k)
+            {
+                generic::bilinear_transform_x1(&f1, c, kf, 1);
+                generic::bilinear_transform_x1(&f2, &c2[k], 1.0f, 1);
+                const float *v1 = &f1.b0, *v2 = &f2.b0;
+                for (size_t m=0; m<5; ++m)
+                    UTEST_ASSERT_MSG(float_equals_adaptive(v1[m], v2[m], TOLERANCE),
+                        "Coefficient %d of cascade %d of filter %d differs: %.6f vs %.6f",
+                        int(m), int(j), int(i), v1[m], v2[m]);
+            }
+        }
+
+        // Padding should pass the signal unchanged
+        for (; k<n2; ++k)
+        {
+            generic::bilinear_transform_x1(&f2, &c2[k], 1.0f, 1);
+            UTEST_ASSERT_MSG((f2.b0 == 1.0f) && (f2.b1 == 0.0f) && (f2.b2 == 0.0f) &&
+                (f2.a1 == 0.0f) && (f2.a2 == 0.0f), "Invalid padding cascade %d", int(k));
+        }
+    }
+
+    void test_dynamic(uint32_t type)
+    {
+        printf("Testing consistency with dynamic filter design type=%d\n", int(type));
+
+        dsp::filter_params_t p[MAX_FILTERS];
+        dsp::f_cascade_t c[MAX_FILTERS];
+        dsp::biquad_x1_t f1, f2;
+        make_filters(p, MAX_FILTERS);
+
+        for (size_t i=0; i<MAX_FILTERS; ++i)
+        {
+            p[i].type       = type;
+            p[i].slope      = 1;
+        }
+        size_t n    = generic::filter_design_bilinear(c, p, MAX_FILTERS, 1);
+        UTEST_ASSERT_MSG(n == MAX_FILTERS, "Invalid number of cascades: %d", int(n));
+
+        for (size_t i=0; i<MAX_FILTERS; ++i)
+        {
+            dsp::dyn_filter_params_t dp;
+            dp.freq         = NULL;
+            dp.gain         = NULL;
+            dp.q            = NULL;
+            dp.k_freq       = p[i].freq;
+            dp.k_gain       = p[i].gain;
+            dp.k_q          = p[i].q;
+            dp.type         = type;
+
+            generic::bilinear_transform_x1(&f1, &c[i], 1.0f, 1);
+            generic::dyn_biquad_design_x1(&f2, &dp, 1);
+
+            const float *v1 = &f1.b0, *v2 = &f2.b0;
+            for (size_t m=0; m<5; ++m)
+                UTEST_ASSERT_MSG(float_equals_adaptive(v1[m], v2[m], TOLERANCE),
+                    "Coefficient %d of filter %d differs: %.6f vs %.6f",
+                    int(m), int(i), v1[m], v2[m]);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t slope=1; slope<=MAX_SLOPE; ++slope)
+        {
+            for (uint32_t type=LSP_DSP_FILTER_BT_LOPASS; type<=LSP_DSP_FILTER_LR_HIPASS; ++type)
+                test_high_order(type, slope);
+            test_crossover(slope);
+            test_slope(LSP_DSP_FILTER_PEAK, slope);
+            test_slope(LSP_DSP_FILTER_LOSHELF, slope);
+            test_slope(LSP_DSP_FILTER_HISHELF, slope);
+        }
+
+        for (uint32_t type=LSP_DSP_FILTER_LOPASS; type<=LSP_DSP_FILTER_HISHELF; ++type)
+            test_dynamic(type);
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 7, 16, 0x40, 0x41, MAX_FILTERS)
+        {
+            UTEST_FOREACH(lanes, 1, 2, 4, 8, 16)
+                test_bilinear(count, lanes);
+        }
+    }
+
+UTEST_END
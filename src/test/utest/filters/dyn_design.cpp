@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <math.h>
+
+#define TOLERANCE       1e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void bilinear_transform_x1(dsp::biquad_x1_t *bf, const dsp::f_cascade_t *bc, float kf, size_t count);
+
+        void dyn_biquad_design_x1(dsp::biquad_x1_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x2(dsp::biquad_x2_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x4(dsp::biquad_x4_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x8(dsp::biquad_x8_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+        void dyn_biquad_design_x16(dsp::biquad_x16_t *bf, const dsp::dyn_filter_params_t *p, size_t count);
+    }
+
+    // Analog prototype of the filter
+    static void make_cascade(dsp::f_cascade_t *c, uint32_t type, float g, float q)
+    {
+        float a     = sqrtf(g);
+        float sa    = sqrtf(a);
+
+        c->t[3]     = 0.0f;
+        c->b[3]     = 0.0f;
+        c->b[0]     = 1.0f;
+        c->b[1]     = 1.0f / q;
+        c->b[2]     = 1.0f;
+
+        switch (type)
+        {
+            case LSP_DSP_FILTER_LOPASS:
+                c->t[0] = g; c->t[1] = 0.0f; c->t[2] = 0.0f;
+                break;
+            case LSP_DSP_FILTER_HIPASS:
+                c->t[0] = 0.0f; c->t[1] = 0.0f; c->t[2] = g;
+                break;
+            case LSP_DSP_FILTER_BANDPASS:
+                c->t[0] = 0.0f; c->t[1] = g / q; c->t[2] = 0.0f;
+                break;
+            case LSP_DSP_FILTER_NOTCH:
+                c->t[0] = g; c->t[1] = 0.0f; c->t[2] = g;
+                break;
+            case LSP_DSP_FILTER_ALLPASS:
+                c->t[0] = g; c->t[1] = -g / q; c->t[2] = g;
+                break;
+            case LSP_DSP_FILTER_PEAK:
+                c->t[0] = 1.0f; c->t[1] = a / q; c->t[2] = 1.0f;
+                c->b[1] = 1.0f / (a * q);
+                break;
+            case LSP_DSP_FILTER_LOSHELF:
+                c->t[0] = a * a; c->t[1] = a * sa / q; c->t[2] = a;
+                c->b[0] = 1.0f; c->b[1] = sa / q; c->b[2] = a;
+                break;
+            case LSP_DSP_FILTER_HISHELF:
+                c->t[0] = a; c->t[1] = a * sa / q; c->t[2] = a * a;
+                c->b[0] = a; c->b[1] = sa / q; c->b[2] = 1.0f;
+                break;
+            default:
+                c->t[0] = 1.0f; c->t[1] = 0.0f; c->t[2] = 0.0f;
+                c->b[0] = 1.0f; c->b[1] = 0.0f; c->b[2] = 0.0f;
+                break;
+        }
+    }
+
+    // Reference design of the filter for the specific sample
+    static void design_reference(dsp::biquad_x1_t *bf, const dsp::dyn_filter_params_t *p, size_t i)
+    {
+        float f     = (p->freq != NULL) ? p->freq[i] : p->k_freq;
+        float g     = (p->gain != NULL) ? p->gain[i] : p->k_gain;
+        float q     = (p->q != NULL) ? p->q[i] : p->k_q;
+
+        dsp::f_cascade_t c;
+        make_cascade(&c, p->type, g, q);
+        generic::bilinear_transform_x1(bf, &c, 1.0f / tanf(M_PI * f), 1);
+    }
+}
+
+UTEST_BEGIN("dsp.filters", dyn_design)
+
+    void make_params(dsp::dyn_filter_params_t *p, FloatBuffer &f, FloatBuffer &g, FloatBuffer &q, uint32_t type, size_t mode)
+    {
+        const size_t count  = f.size();
+        for (size_t i=0; i<count; ++i)
+        {
+            float x     = (count > 1) ? float(i) / float(count - 1) : 0.0f;
+            f[i]        = 0.01f * expf(x * logf(40.0f));        // 0.01 .. 0.4
+            g[i]        = 0.1f * expf(x * logf(100.0f));        // -20 dB .. +20 dB
+            q[i]        = 0.5f + 4.5f * (1.0f - x);
+        }
+
+        p->freq     = (mode & 1) ? f.data<float>() : NULL;
+        p->gain     = (mode & 2) ? g.data<float>() : NULL;
+        p->q        = (mode & 4) ? q.data<float>() : NULL;
+        p->k_freq   = 0.1f + 0.02f * mode;
+        p->k_gain   = 0.25f + 0.5f * type;
+        p->k_q      = 0.7f + 0.3f * mode;
+        p->type     = type;
+    }
+
+    void check_cascade(const char *label, size_t i, const float *c, size_t step, const dsp::biquad_x1_t *r)
+    {
+        const float *rc = &r->b0;
+        for (size_t k=0; k<5; ++k)
+        {
+            UTEST_ASSERT_MSG(float_equals_adaptive(c[k*step], rc[k], TOLERANCE),
+                "%s: coefficient %d of sample %d differs: %.6f vs %.6f",
+                label, int(k), int(i), c[k*step], rc[k]);
+        }
+    }
+
+    void check_bypass(const char *label, size_t i, const float *c, size_t step)
+    {
+        UTEST_ASSERT_MSG(c[0] == 1.0f, "%s: invalid bypass cell at bank %d", label, int(i));
+        for (size_t k=1; k<5; ++k)
+            UTEST_ASSERT_MSG(c[k*step] == 0.0f, "%s: invalid bypass cell at bank %d", label, int(i));
+    }
+
+    void test_x1(uint32_t type, size_t mode, size_t count)
+    {
+        FloatBuffer f(count), g(count), q(count);
+        dsp::dyn_filter_params_t p;
+        make_params(&p, f, g, q, type, mode);
+
+        void *ptr = NULL;
+        dsp::biquad_x1_t *bf = alloc_aligned<dsp::biquad_x1_t>(ptr, count + 1, 64);
+        UTEST_ASSERT_MSG(bf != NULL, "Out of memory");
+        bf[count].b0    = 12345.0f;
+
+        generic::dyn_biquad_design_x1(bf, &p, count);
+        UTEST_ASSERT_MSG(bf[count].b0 == 12345.0f, "Filter buffer overflow");
+
+        dsp::biquad_x1_t ref;
+        for (size_t i=0; i<count; ++i)
+        {
+            design_reference(&ref, &p, i);
+            check_cascade("x1", i, &bf[i].b0, 1, &ref);
+            UTEST_ASSERT_MSG((bf[i].p0 == 0.0f) && (bf[i].p1 == 0.0f) && (bf[i].p2 == 0.0f),
+                "x1: non-zero padding at sample %d", int(i));
+        }
+
+        free_aligned(ptr);
+    }
+
+    template <class T>
+        void test_xn(const char *label, void (*func)(T *bf, const dsp::dyn_filter_params_t *p, size_t count),
+            size_t lanes, uint32_t type, size_t mode, size_t count)
+    {
+        FloatBuffer f(count), g(count), q(count);
+        dsp::dyn_filter_params_t p[16];
+        for (size_t j=0; j<lanes; ++j)
+            make_params(&p[j], f, g, q, (type + j) % 8, (mode + j) % 8);
+
+        const size_t banks  = count + lanes - 1;
+        const size_t stride = sizeof(T) / sizeof(float);
+        void *ptr = NULL;
+        T *bf = alloc_aligned<T>(ptr, banks + 1, 64);
+        UTEST_ASSERT_MSG(bf != NULL, "Out of memory");
+        float *v = reinterpret_cast<float *>(bf);
+        for (size_t i=0; i<(banks + 1) * stride; ++i)
+            v[i]    = 12345.0f;
+
+        func(bf, p, count);
+
+        dsp::biquad_x1_t ref;
+        for (size_t i=0; i<banks; ++i)
+        {
+            const float *c = &v[i * stride];
+            for (size_t j=0; j<lanes; ++j)
+            {
+                if ((i < j) || (i >= count + j))
+                    check_bypass(label, i, &c[j], lanes);
+                else
+                {
+                    design_reference(&ref, &p[j], i - j);
+                    check_cascade(label, i - j, &c[j], lanes, &ref);
+                }
+            }
+            for (size_t k=lanes*5; k<stride; ++k)
+                UTEST_ASSERT_MSG(c[k] == 0.0f, "%s: non-zero padding at bank %d", label, int(i));
+        }
+        for (size_t k=0; k<stride; ++k)
+            UTEST_ASSERT_MSG(v[banks * stride + k] == 12345.0f, "%s: filter buffer overflow", label);
+
+        free_aligned(ptr);
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_FOREACH(count, 0, 1, 2, 3, 7, 16, 0x1f, 0x100, 0x1ff, 0x345)
+        {
+            printf("Testing dynamic filter design for count=%d...\n", int(count));
+            for (uint32_t type=LSP_DSP_FILTER_LOPASS; type<=LSP_DSP_FILTER_HISHELF; ++type)
+            {
+                for (size_t mode=0; mode<8; ++mode)
+                {
+                    test_x1(type, mode, count);
+                    test_xn("x2", generic::dyn_biquad_design_x2, 2, type, mode, count);
+                    test_xn("x4", generic::dyn_biquad_design_x4, 4, type, mode, count);
+                }
+                test_xn("x8", generic::dyn_biquad_design_x8, 8, type, type, count);
+                test_xn("x16", generic::dyn_biquad_design_x16, 16, type, type, count);
+            }
+        }
+    }
+
+UTEST_END
@@ -37,6 +37,7 @@ namespace lsp
         void dyn_biquad_process_x2(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f);
         void dyn_biquad_process_x4(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f);
         void dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+        void dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
     }
 
     IF_ARCH_X86(
@@ -67,6 +68,14 @@ namespace lsp
             void x64_dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
             void dyn_biquad_process_x8_fma3(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_dyn_biquad_process_x8(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+                void x64_dyn_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -93,6 +102,7 @@ namespace lsp
     typedef void (* dyn_biquad_process_x2_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x2_t *f);
     typedef void (* dyn_biquad_process_x4_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x4_t *f);
     typedef void (* dyn_biquad_process_x8_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x8_t *f);
+    typedef void (* dyn_biquad_process_x16_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
 
     static dsp::biquad_x1_t bq_normal =
     {
@@ -370,6 +380,87 @@ UTEST_BEGIN("dsp.filters", dynamic)
         }
     }
 
+    void call(const char *label, dyn_biquad_process_x16_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        float d[LSP_DSP_BIQUAD_D_ITEMS * 2];
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0x1f, 0x40, 0x1ff)
+        {
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            // Initialize filters, the gain of each filter varies over time to check the bank indexing.
+            // Poles are damped to keep the cascade of 16 filters well-conditioned for float comparison
+            void *p1 = NULL, *p2 = NULL;
+            dsp::biquad_x1_t *f1 = alloc_aligned<dsp::biquad_x1_t>(p1, count, 64);
+            dsp::biquad_x16_t *f2 = alloc_aligned<dsp::biquad_x16_t>(p2, count+15, 64);
+            UTEST_ASSERT_MSG(f1 != NULL, "Out of memory while allocating f1");
+            UTEST_ASSERT_MSG(f2 != NULL, "Out of memory while allocating f2");
+
+            for (size_t i=0; i<(count+15); ++i)
+            {
+                for (size_t j=0; j<16; ++j)
+                {
+                    float k     = 1.0f + 0.01f * ((i*7 + j*3) % 17);
+                    f2[i].b0[j] = bq_normal.b0 * k;
+                    f2[i].b1[j] = bq_normal.b1 * k;
+                    f2[i].b2[j] = bq_normal.b2 * k;
+                    f2[i].a1[j] = bq_normal.a1 * 0.5f;
+                    f2[i].a2[j] = bq_normal.a2 * 0.5f;
+                }
+            }
+
+            // Apply processing: cascade j at sample i uses bank i+j
+            const float *ptr = src.data();
+            for (size_t j=0; j<16; ++j)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    const dsp::biquad_x16_t *bf = &f2[i+j];
+                    f1[i].b0    = bf->b0[j];
+                    f1[i].b1    = bf->b1[j];
+                    f1[i].b2    = bf->b2[j];
+                    f1[i].a1    = bf->a1[j];
+                    f1[i].a2    = bf->a2[j];
+                    f1[i].p0    = 0.0f;
+                    f1[i].p1    = 0.0f;
+                    f1[i].p2    = 0.0f;
+                }
+
+                dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS);
+                generic::dyn_biquad_process_x1(dst1, ptr, d, count, f1);
+                ptr = dst1.data();
+            }
+
+            dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS * 2);
+            func(dst2, src, d, count, f2);
+
+            // Perform validation
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+
+            free_aligned(p1);
+            free_aligned(p2);
+        }
+    }
+
     UTEST_MAIN
     {
         #define CALL(func) \
@@ -402,8 +493,12 @@ UTEST_BEGIN("dsp.filters", dynamic)
         IF_ARCH_X86(CALL(sse3::x64_dyn_biquad_process_x8));
         IF_ARCH_X86(CALL(avx::x64_dyn_biquad_process_x8));
         IF_ARCH_X86(CALL(avx::dyn_biquad_process_x8_fma3));
+        IF_ARCH_X86_64(CALL(avx512::x64_dyn_biquad_process_x8));
         IF_ARCH_ARM(CALL(neon_d32::dyn_biquad_process_x8));
         IF_ARCH_AARCH64(CALL(asimd::dyn_biquad_process_x8));
+
+        CALL(generic::dyn_biquad_process_x16);
+        IF_ARCH_X86_64(CALL(avx512::x64_dyn_biquad_process_x16));
     }
 
 UTEST_END
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE   1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::fir_t *fir_create(const float *kernel, size_t taps);
+        void fir_destroy(dsp::fir_t *fir);
+        void fir_reset(dsp::fir_t *fir);
+        void fir_process(dsp::fir_t *fir, float *dst, const float *src, size_t count);
+    }
+
+    static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; (j<length) && ((i + j) < count); ++j)
+                dst[i+j] += src[i] * conv[j];
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.filters", fir)
+
+    void call(const char *label, size_t align, size_t taps, size_t max_step, bool in_place)
+    {
+        printf("Testing %s: taps=%d, max_step=%d, in_place=%s\n",
+            label, int(taps), int(max_step), (in_place) ? "true" : "false");
+
+        FloatBuffer kernel(taps, align, false);
+        dsp::fir_t *fir = generic::fir_create(kernel, taps);
+        UTEST_ASSERT(fir != NULL);
+        lsp_finally { generic::fir_destroy(fir); };
+
+        size_t count    = taps + max_step * 8 + 1;
+        FloatBuffer src(count, align, false);
+        FloatBuffer dst1(count, align, false);
+        FloatBuffer dst2(count, align, false);
+
+        // Compute reference output
+        dst1.fill_zero();
+        convolve(dst1, src, kernel, taps, count);
+
+        // Do the same twice to check that reset works properly
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            // Process the data by blocks of variable size
+            if (in_place)
+                dsp::copy(dst2, src, count);
+            for (size_t off=0, step=1; off < count; step = (step * 7 + 3) % max_step + 1)
+            {
+                size_t to_do    = lsp_min(count - off, step);
+                generic::fir_process(fir, &dst2[off], (in_place) ? &dst2[off] : &src[off], to_do);
+                off            += to_do;
+            }
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(kernel.valid(), "Kernel buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            // Compare buffers
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                ssize_t diff = dst2.last_diff();
+                UTEST_FAIL_MSG("Output of FIR filter differs at sample %d (%.6f vs %.6f), pass=%d",
+                    int(diff), dst1.get(diff), dst2.get(diff), int(pass));
+            }
+
+            generic::fir_reset(fir);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        FloatBuffer kernel(16, 16, false);
+        UTEST_ASSERT(generic::fir_create(NULL, 16) == NULL);
+        UTEST_ASSERT(generic::fir_create(kernel, 0) == NULL);
+
+        UTEST_FOREACH(taps, 1, 2, 7, 16, 33, 100, 127, 128, 129, 300, 512, 1000, 2100)
+        {
+            // Small blocks: direct convolution only
+            call("small blocks", 16, taps, 97, false);
+            call("small blocks", 16, taps, 97, true);
+
+            // Large blocks: fast convolution for long kernels
+            call("large blocks", 16, taps, 9001, false);
+            call("large blocks", 16, taps, 9001, true);
+        }
+    }
+
+UTEST_END;
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <math.h>
+
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_design_linear(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp);
+        void fir_design_minimum(float *dst, const float *mag, const float *window, size_t taps, size_t rank, float *tmp);
+        void fir_minimum_phase(float *dst, const float *src, size_t count, size_t taps, size_t rank, float *tmp);
+    }
+
+    // Magnitude response of the peaking filter
+    static void make_magnitude(float *mag, size_t rank)
+    {
+        const size_t half = size_t(1) << (rank - 1);
+        for (size_t k=0; k<=half; ++k)
+        {
+            double f    = double(k) / double(half);
+            double d    = (f - 0.2) / 0.05;
+            mag[k]      = 0.25 + 3.0 * exp(-d * d);
+        }
+    }
+
+    // Linear-phase kernel computed by the inverse DFT
+    static void design_linear(float *dst, const float *mag, const float *window, size_t taps, size_t rank)
+    {
+        const size_t n      = size_t(1) << rank;
+        const size_t half   = n >> 1;
+        const double c      = (taps - 1) * 0.5;
+
+        for (size_t i=0; i<taps; ++i)
+        {
+            double t    = double(i) - c;
+            double s    = mag[0] + mag[half] * cos(M_PI * t);
+            for (size_t k=1; k<half; ++k)
+                s          += 2.0 * mag[k] * cos(2.0 * M_PI * k * t / n);
+            dst[i]      = s / n;
+            if (window != NULL)
+                dst[i]     *= window[i];
+        }
+    }
+
+    // Magnitude response of the kernel at the FFT frequencies
+    static double magnitude(const float *h, size_t taps, size_t k, size_t n)
+    {
+        double re = 0.0, im = 0.0;
+        for (size_t i=0; i<taps; ++i)
+        {
+            double a    = 2.0 * M_PI * ((k * i) % n) / n;
+            re         += h[i] * cos(a);
+            im         -= h[i] * sin(a);
+        }
+        return sqrt(re*re + im*im);
+    }
+
+    // Energy of the first samples of the kernel
+    static double energy(const float *h, size_t count)
+    {
+        double e = 0.0;
+        for (size_t i=0; i<count; ++i)
+            e          += double(h[i]) * h[i];
+        return e;
+    }
+}
+
+UTEST_BEGIN("dsp.filters", fir_design)
+
+    void test_linear(size_t taps, size_t rank, bool windowed)
+    {
+        printf("Testing linear-phase design taps=%d, rank=%d, window=%s\n",
+            int(taps), int(rank), (windowed) ? "true" : "false");
+
+        const size_t n  = size_t(1) << rank;
+        FloatBuffer mag((n >> 1) + 1, 16, false);
+        FloatBuffer window(taps, 16, false);
+        FloatBuffer tmp(n * 4, 16, false);
+        FloatBuffer dst1(taps, 16, false);
+        FloatBuffer dst2(taps, 16, false);
+
+        make_magnitude(mag, rank);
+        dsp::window_blackman(window, taps, LSP_DSP_WINDOW_SYMMETRIC);
+        const float *w  = (windowed) ? window.data<float>() : NULL;
+
+        design_linear(dst1, mag, w, taps, rank);
+        generic::fir_design_linear(dst2, mag, w, taps, rank, tmp);
+
+        UTEST_ASSERT_MSG(mag.valid(), "Magnitude buffer corrupted");
+        UTEST_ASSERT_MSG(window.valid(), "Window buffer corrupted");
+        UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst1.equals_absolute(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            ssize_t diff = dst2.last_diff();
+            UTEST_FAIL_MSG("Kernel differs at sample %d (%.6f vs %.6f)",
+                int(diff), dst1.get(diff), dst2.get(diff));
+        }
+
+        // The kernel should be symmetric
+        for (size_t i=0; i<taps/2; ++i)
+            UTEST_ASSERT_MSG(float_equals_absolute(dst2[i], dst2[taps - i - 1], TOLERANCE),
+                "Kernel is not symmetric at sample %d", int(i));
+    }
+
+    void check_minimum(const float *mag, const float *lin, const float *min, size_t taps, size_t rank)
+    {
+        const size_t n  = size_t(1) << rank;
+
+        // The magnitude response should be kept
+        for (size_t k=0; k<=(n >> 1); k += 7)
+        {
+            double m        = magnitude(min, taps, k, n);
+            UTEST_ASSERT_MSG(float_equals_adaptive(m, mag[k], 1e-2f),
+                "Magnitude differs at bin %d (%.6f vs %.6f)", int(k), m, mag[k]);
+        }
+
+        // The minimum-phase filter has the fastest growth of the energy
+        for (size_t i=1; i<=taps; ++i)
+        {
+            double e1       = energy(lin, i);
+            double e2       = energy(min, i);
+            UTEST_ASSERT_MSG(e2 >= e1 * (1.0 - 1e-3) - 1e-6,
+                "Energy of minimum-phase filter is lower at sample %d (%.6f vs %.6f)", int(i), e2, e1);
+        }
+    }
+
+    void test_minimum(size_t rank)
+    {
+        printf("Testing minimum-phase design rank=%d\n", int(rank));
+
+        const size_t n  = size_t(1) << rank;
+        FloatBuffer mag((n >> 1) + 1, 16, false);
+        FloatBuffer tmp(n * 4, 16, false);
+        FloatBuffer lin(n, 16, false);
+        FloatBuffer min1(n, 16, false);
+        FloatBuffer min2(n, 16, false);
+
+        make_magnitude(mag, rank);
+        generic::fir_design_linear(lin, mag, NULL, n - 1, rank, tmp);
+        lin[n - 1]      = 0.0f;
+        generic::fir_design_minimum(min1, mag, NULL, n, rank, tmp);
+        generic::fir_minimum_phase(min2, lin, n - 1, n, rank, tmp);
+
+        UTEST_ASSERT_MSG(mag.valid(), "Magnitude buffer corrupted");
+        UTEST_ASSERT_MSG(tmp.valid(), "Temporary buffer corrupted");
+        UTEST_ASSERT_MSG(lin.valid(), "Linear-phase buffer corrupted");
+        UTEST_ASSERT_MSG(min1.valid(), "Minimum-phase buffer 1 corrupted");
+        UTEST_ASSERT_MSG(min2.valid(), "Minimum-phase buffer 2 corrupted");
+
+        check_minimum(mag, lin, min1, n, rank);
+        check_minimum(mag, lin, min2, n, rank);
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_FOREACH(rank, 4, 6, 8, 10)
+        {
+            const size_t n = size_t(1) << rank;
+            const size_t taps[] = { 1, 2, 7, 8, n / 2 - 1, n / 2, n - 1, n };
+            for (size_t i=0; i<sizeof(taps)/sizeof(size_t); ++i)
+            {
+                test_linear(taps[i], rank, false);
+                test_linear(taps[i], rank, true);
+            }
+        }
+
+        UTEST_FOREACH(rank, 6, 8, 10, 12)
+            test_minimum(rank);
+    }
+
+UTEST_END;
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <math.h>
+
+#define TOLERANCE       1e-4
+#define SAMPLE_RATE     48000
+
+namespace lsp
+{
+    namespace generic
+    {
+        void hilbert_init(dsp::hilbert_t *h);
+        void hilbert_process(float *dst_re, float *dst_im, const float *src, size_t count, dsp::hilbert_t *h);
+        void hilbert_fft(float *dst_re, float *dst_im, const float *src, size_t rank);
+    }
+
+    // Chain of all-pass sections: y[n] = c*(x[n] + y[n-2]) - x[n-2]
+    static void allpass_chain(float *dst, const float *src, const double *c, size_t count)
+    {
+        double x[4][2], y[4][2];
+        for (size_t j=0; j<4; ++j)
+            x[j][0] = x[j][1] = y[j][0] = y[j][1] = 0.0;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            double s = src[i];
+            for (size_t j=0; j<4; ++j)
+            {
+                double r    = c[j] * (s + y[j][1]) - x[j][1];
+                x[j][1]     = x[j][0];
+                x[j][0]     = s;
+                y[j][1]     = y[j][0];
+                y[j][0]     = r;
+                s           = r;
+            }
+            dst[i]      = s;
+        }
+    }
+
+    static void hilbert(float *dst_re, float *dst_im, const float *src, size_t count)
+    {
+        static const double re[] = { 0.4021921162426, 0.8561710882420, 0.9722909545651, 0.9952884791278 };
+        static const double im[] = { 0.6923878000000, 0.9360654322959, 0.9882295226860, 0.9987488452737 };
+        double c_re[4], c_im[4];
+        for (size_t j=0; j<4; ++j)
+        {
+            c_re[j]     = re[j] * re[j];
+            c_im[j]     = im[j] * im[j];
+        }
+
+        allpass_chain(dst_re, src, c_re, count);
+        allpass_chain(&dst_im[1], src, c_im, count - 1);
+        dst_im[0]   = 0.0f;
+    }
+}
+
+UTEST_BEGIN("dsp.filters", hilbert)
+
+    void test_process(size_t count)
+    {
+        printf("Testing IIR Hilbert transformer on %d samples\n", int(count));
+
+        FloatBuffer src(count, 16, false);
+        FloatBuffer re1(count, 16, false);
+        FloatBuffer im1(count, 16, false);
+        FloatBuffer re2(count, 16, false);
+        FloatBuffer im2(count, 16, false);
+
+        hilbert(re1, im1, src, count);
+
+        // Process by blocks of variable size, real part is computed in-place
+        dsp::hilbert_t h __lsp_aligned64;
+        generic::hilbert_init(&h);
+        dsp::copy(re2, src, count);
+        for (size_t off=0, step=1; off < count; step = (step * 7 + 3) % 97 + 1)
+        {
+            size_t to_do    = lsp_min(count - off, step);
+            generic::hilbert_process(&re2[off], &im2[off], &re2[off], to_do, &h);
+            off            += to_do;
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(re1.valid(), "Real part buffer 1 corrupted");
+        UTEST_ASSERT_MSG(im1.valid(), "Imaginary part buffer 1 corrupted");
+        UTEST_ASSERT_MSG(re2.valid(), "Real part buffer 2 corrupted");
+        UTEST_ASSERT_MSG(im2.valid(), "Imaginary part buffer 2 corrupted");
+
+        if (!re1.equals_adaptive(re2, TOLERANCE))
+        {
+            ssize_t diff = re2.last_diff();
+            UTEST_FAIL_MSG("Real part differs at sample %d (%.6f vs %.6f)",
+                int(diff), re1.get(diff), re2.get(diff));
+        }
+        if (!im1.equals_adaptive(im2, TOLERANCE))
+        {
+            ssize_t diff = im2.last_diff();
+            UTEST_FAIL_MSG("Imaginary part differs at sample %d (%.6f vs %.6f)",
+                int(diff), im1.get(diff), im2.get(diff));
+        }
+    }
+
+    void test_quadrature(float freq)
+    {
+        printf("Testing quadrature of IIR Hilbert transformer at %.1f Hz\n", freq);
+
+        const size_t count  = SAMPLE_RATE;
+        const double w      = 2.0 * M_PI * freq / SAMPLE_RATE;
+        FloatBuffer src(count, 16, false);
+        FloatBuffer re(count, 16, false);
+        FloatBuffer im(count, 16, false);
+        FloatBuffer env(count, 16, false);
+
+        for (size_t i=0; i<count; ++i)
+            src[i]          = cos(w * i);
+
+        dsp::hilbert_t h __lsp_aligned64;
+        generic::hilbert_init(&h);
+        generic::hilbert_process(re, im, src, count, &h);
+        dsp::complex_mod(env, re, im, count);
+
+        // The envelope should be flat and the analytic signal should rotate counter-clockwise
+        for (size_t i=count/2; i<count-1; ++i)
+        {
+            UTEST_ASSERT_MSG(float_equals_absolute(env[i], 1.0f, 2e-2f),
+                "Envelope differs at sample %d: %.6f", int(i), env[i]);
+            float rot       = re[i] * im[i+1] - im[i] * re[i+1];
+            UTEST_ASSERT_MSG(rot > 0.0f, "Wrong rotation at sample %d: %.6f", int(i), rot);
+        }
+    }
+
+    void test_fft(size_t rank)
+    {
+        printf("Testing FFT Hilbert transformer rank=%d\n", int(rank));
+
+        const size_t n  = size_t(1) << rank;
+        FloatBuffer src(n, 16, false);
+        FloatBuffer re1(n, 16, false);
+        FloatBuffer im1(n, 16, false);
+        FloatBuffer re2(n, 16, false);
+        FloatBuffer im2(n, 16, false);
+
+        // Sum of harmonics with known Hilbert transform
+        src.fill_zero();
+        im1.fill_zero();
+        for (size_t k=1; k < (n >> 1); k = k * 3 + 1)
+        {
+            double a    = 1.0 / k;
+            double p    = 0.3 * k;
+            for (size_t i=0; i<n; ++i)
+            {
+                double phi  = 2.0 * M_PI * ((k * i) % n) / n + p;
+                src[i]     += a * cos(phi);
+                im1[i]     += a * sin(phi);
+            }
+        }
+        dsp::copy(re1, src, n);
+
+        generic::hilbert_fft(re2, im2, src, rank);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(re2.valid(), "Real part buffer corrupted");
+        UTEST_ASSERT_MSG(im2.valid(), "Imaginary part buffer corrupted");
+
+        if (!re1.equals_absolute(re2, 1e-3f))
+        {
+            ssize_t diff = re2.last_diff();
+            UTEST_FAIL_MSG("Real part differs at sample %d (%.6f vs %.6f)",
+                int(diff), re1.get(diff), re2.get(diff));
+        }
+        if (!im1.equals_absolute(im2, 1e-3f))
+        {
+            ssize_t diff = im2.last_diff();
+            UTEST_FAIL_MSG("Imaginary part differs at sample %d (%.6f vs %.6f)",
+                int(diff), im1.get(diff), im2.get(diff));
+        }
+
+        // In-place processing of the real part
+        generic::hilbert_fft(src, im2, src, rank);
+        UTEST_ASSERT_MSG(re1.equals_absolute(src, 1e-3f), "In-place real part differs");
+    }
+
+    UTEST_MAIN
+    {
+        UTEST_FOREACH(count, 1, 2, 3, 5, 16, 100, 1000, 10000)
+            test_process(count);
+
+        UTEST_FOREACH(freq, 50.0f, 440.0f, 1000.0f, 5000.0f, 12000.0f, 20000.0f)
+            test_quadrature(freq);
+
+        UTEST_FOREACH(rank, 2, 4, 8, 12)
+            test_fft(rank);
+    }
+
+UTEST_END;
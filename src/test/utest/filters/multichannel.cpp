@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#include <math.h>
+
+#define BUF_SIZE        1024
+#define BUF_STEP        37
+#define MAX_CHANNELS    64
+#define TOLERANCE       1e-4f
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_imc(float *dst, const float *src, size_t channels, size_t count, dsp::biquad_t *f);
+        void biquad_process_mc(float * const *dst, const float * const *src, size_t channels, size_t count, dsp::biquad_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        }
+
+        namespace avx
+        {
+            void biquad_process_c4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c4_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            void biquad_process_c16_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_biquad_process_c16(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+            }
+        )
+    )
+
+    typedef void (* biquad_process_cn_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+}
+
+UTEST_BEGIN("dsp.filters", multichannel)
+
+    // Low-pass filter with the cutoff frequency depending on the channel number
+    void init_channel(dsp::biquad_x1_t *x1, size_t channel)
+    {
+        float w         = 2.0f * M_PI * (0.01f + 0.007f * (channel % 61));
+        float alpha     = sinf(w) * 0.5f / (0.5f + 0.05f * (channel % 7));
+        float c         = cosf(w);
+        float n         = 1.0f / (1.0f + alpha);
+
+        x1->b0          = 0.5f * (1.0f - c) * n;
+        x1->b1          = (1.0f - c) * n;
+        x1->b2          = 0.5f * (1.0f - c) * n;
+        x1->a1          = 2.0f * c * n;
+        x1->a2          = (alpha - 1.0f) * n;
+        x1->p0          = 0.0f;
+        x1->p1          = 0.0f;
+        x1->p2          = 0.0f;
+    }
+
+    void init_banks(dsp::biquad_t *bank, dsp::biquad_t *ref, size_t channels)
+    {
+        size_t banks    = (channels + 7) >> 3;
+        for (size_t i=0; i<banks; ++i)
+        {
+            dsp::biquad_t *f    = &bank[i];
+            dsp::fill_zero(f->d, LSP_DSP_BIQUAD_D_ITEMS);
+            for (size_t j=0; j<8; ++j)
+            {
+                f->x8.b0[j]     = 0.0f;
+                f->x8.b1[j]     = 0.0f;
+                f->x8.b2[j]     = 0.0f;
+                f->x8.a1[j]     = 0.0f;
+                f->x8.a2[j]     = 0.0f;
+            }
+        }
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            dsp::biquad_t *r    = &ref[i];
+            dsp::biquad_t *f    = &bank[i >> 3];
+            size_t j            = i & 7;
+
+            dsp::fill_zero(r->d, LSP_DSP_BIQUAD_D_ITEMS);
+            init_channel(&r->x1, i);
+
+            f->x8.b0[j]         = r->x1.b0;
+            f->x8.b1[j]         = r->x1.b1;
+            f->x8.b2[j]         = r->x1.b2;
+            f->x8.a1[j]         = r->x1.a1;
+            f->x8.a2[j]         = r->x1.a2;
+        }
+    }
+
+    void check_memory(const char *label, const dsp::biquad_t *bank, const dsp::biquad_t *ref, size_t channels)
+    {
+        for (size_t i=0; i<channels; ++i)
+        {
+            const dsp::biquad_t *f  = &bank[i >> 3];
+            size_t j                = i & 7;
+
+            if ((!float_equals_absolute(ref[i].d[0], f->d[j], TOLERANCE)) ||
+                (!float_equals_absolute(ref[i].d[1], f->d[j + 8], TOLERANCE)))
+                UTEST_FAIL_MSG("Filter memory of channel %d for test '%s' differs: {%.6f, %.6f} vs {%.6f, %.6f}",
+                        int(i), label, ref[i].d[0], ref[i].d[1], f->d[j], f->d[j + 8]);
+        }
+    }
+
+    void init_narrow(dsp::biquad_t *bank, dsp::biquad_t *ref)
+    {
+        dsp::fill_zero(bank->d, LSP_DSP_BIQUAD_D_ITEMS);
+        for (size_t j=0; j<4; ++j)
+        {
+            dsp::biquad_t *r    = &ref[j];
+
+            dsp::fill_zero(r->d, LSP_DSP_BIQUAD_D_ITEMS);
+            init_channel(&r->x1, j);
+
+            bank->x4.b0[j]      = r->x1.b0;
+            bank->x4.b1[j]      = r->x1.b1;
+            bank->x4.b2[j]      = r->x1.b2;
+            bank->x4.a1[j]      = r->x1.a1;
+            bank->x4.a2[j]      = r->x1.a2;
+        }
+    }
+
+    void check_narrow(const char *label, const dsp::biquad_t *bank, const dsp::biquad_t *ref)
+    {
+        for (size_t j=0; j<4; ++j)
+        {
+            if ((!float_equals_absolute(ref[j].d[0], bank->d[j], TOLERANCE)) ||
+                (!float_equals_absolute(ref[j].d[1], bank->d[j + 4], TOLERANCE)))
+                UTEST_FAIL_MSG("Filter memory of channel %d for test '%s' differs: {%.6f, %.6f} vs {%.6f, %.6f}",
+                        int(j), label, ref[j].d[0], ref[j].d[1], bank->d[j], bank->d[j + 4]);
+        }
+    }
+
+    void call(const char *label, size_t lanes, biquad_process_cn_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_t bank[2] __lsp_aligned64;
+        dsp::biquad_t ref[16] __lsp_aligned64;
+
+        printf("Testing %s on buffer of %d frames...\n", label, BUF_SIZE);
+
+        FloatBuffer src(BUF_SIZE * lanes);
+        FloatBuffer dst1(BUF_SIZE * lanes);
+        FloatBuffer dst2(BUF_SIZE * lanes);
+        FloatBuffer tmp(BUF_SIZE);
+        src.randomize_sign();
+        dst2.copy(src);
+
+        // Reference: each channel is processed separately
+        if (lanes == 4)
+            init_narrow(bank, ref);
+        else
+            init_banks(bank, ref, lanes);
+        for (size_t j=0; j<lanes; ++j)
+        {
+            float *t = tmp.data();
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                t[i]        = src[i*lanes + j];
+            generic::biquad_process_x1(t, t, BUF_SIZE, &ref[j]);
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                dst1[i*lanes + j]   = t[i];
+        }
+
+        // Process in-place by chunks to check that the filter memory is kept
+        for (size_t i=0; i<BUF_SIZE; i += BUF_STEP)
+        {
+            size_t count = lsp_min(BUF_SIZE - i, size_t(BUF_STEP));
+            func(dst2.data(i * lanes), dst2.data(i * lanes), count, bank);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        if (lanes == 4)
+            check_narrow(label, bank, ref);
+        else
+            check_memory(label, bank, ref, lanes);
+    }
+
+    void call_mc(size_t channels, size_t count)
+    {
+        dsp::biquad_t bank[MAX_CHANNELS / 8] __lsp_aligned64;
+        dsp::biquad_t ref[MAX_CHANNELS] __lsp_aligned64;
+        float *dptr[MAX_CHANNELS];
+        const float *sptr[MAX_CHANNELS];
+
+        printf("Testing multichannel processing for %d channels, %d samples...\n", int(channels), int(count));
+
+        FloatBuffer src(count * channels);
+        FloatBuffer dst1(count * channels);
+        FloatBuffer dst2(count * channels);
+        FloatBuffer dst3(count * channels);
+        src.randomize_sign();
+        dst2.copy(src);
+
+        // Reference: each channel is processed separately
+        init_banks(bank, ref, channels);
+        for (size_t j=0; j<channels; ++j)
+            generic::biquad_process_x1(dst1.data(j * count), src.data(j * count), count, &ref[j]);
+
+        // Planar buffers, processed in-place
+        for (size_t j=0; j<channels; ++j)
+        {
+            dptr[j]     = dst2.data(j * count);
+            sptr[j]     = dptr[j];
+        }
+        generic::biquad_process_mc(dptr, sptr, channels, count, bank);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            UTEST_FAIL_MSG("Planar output for %d channels differs at sample %d: %.6f vs %.6f",
+                    int(channels), int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+        check_memory("biquad_process_mc", bank, ref, channels);
+
+        // Interleaved buffers
+        FloatBuffer isrc(count * channels);
+        FloatBuffer idst(count * channels);
+        for (size_t j=0; j<channels; ++j)
+            for (size_t i=0; i<count; ++i)
+                isrc[i*channels + j]    = src[j*count + i];
+
+        init_banks(bank, ref, channels);
+        generic::biquad_process_imc(idst, isrc, channels, count, bank);
+
+        for (size_t j=0; j<channels; ++j)
+            for (size_t i=0; i<count; ++i)
+                dst3[j*count + i]       = idst[i*channels + j];
+
+        UTEST_ASSERT_MSG(isrc.valid(), "Interleaved source buffer corrupted");
+        UTEST_ASSERT_MSG(idst.valid(), "Interleaved destination buffer corrupted");
+        UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+        if (!dst1.equals_adaptive(dst3, TOLERANCE))
+        {
+            UTEST_FAIL_MSG("Interleaved output for %d channels differs at sample %d: %.6f vs %.6f",
+                    int(channels), int(dst1.last_diff()), dst1.get_diff(), dst3.get_diff());
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, lanes) \
+            call(#func, lanes, func)
+
+        CALL(generic::biquad_process_c4, 4);
+        IF_ARCH_X86(CALL(sse::biquad_process_c4, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_c4, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_c4_fma3, 4));
+
+        CALL(generic::biquad_process_c8, 8);
+        IF_ARCH_X86(CALL(sse::biquad_process_c8, 8));
+        IF_ARCH_X86(CALL(avx::biquad_process_c8, 8));
+        IF_ARCH_X86(CALL(avx::biquad_process_c8_fma3, 8));
+
+        CALL(generic::biquad_process_c16, 16);
+        IF_ARCH_X86(CALL(sse::biquad_process_c16, 16));
+        IF_ARCH_X86(CALL(avx::biquad_process_c16, 16));
+        IF_ARCH_X86(CALL(avx::biquad_process_c16_fma3, 16));
+        IF_ARCH_X86_64(CALL(avx512::x64_biquad_process_c16, 16));
+
+        #undef CALL
+
+        static const size_t counts[] = { 0, 1, 7, 0x100, 0x1ff, BUF_SIZE };
+        UTEST_FOREACH(channels, 1, 3, 4, 5, 8, 12, 13, 16, 20, 29, 64)
+        {
+            for (size_t i=0; i<sizeof(counts)/sizeof(counts[0]); ++i)
+                call_mc(channels, counts[i]);
+        }
+    }
+
+UTEST_END;
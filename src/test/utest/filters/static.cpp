@@ -37,6 +37,7 @@ namespace lsp
         void biquad_process_x2(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x4(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         void biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+        void biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
     }
 
     IF_ARCH_X86(
@@ -67,6 +68,14 @@ namespace lsp
             void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
             void biquad_process_x8_fma3(float *dst, const float *src, size_t count, dsp::biquad_t *f);
         }
+
+        IF_ARCH_X86_64(
+            namespace avx512
+            {
+                void x64_biquad_process_x8(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+                void x64_biquad_process_x16(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
+            }
+        )
     )
 
     IF_ARCH_ARM(
@@ -90,6 +99,7 @@ namespace lsp
     )
 
     typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, dsp::biquad_t *f);
+    typedef void (* biquad_process_x16_t)(float *dst, const float *src, float *d, size_t count, const dsp::biquad_x16_t *f);
 }
 
 UTEST_BEGIN("dsp.filters", static)
@@ -240,6 +250,107 @@ UTEST_BEGIN("dsp.filters", static)
         }
     }
 
+    void call(const char *label, const dsp::biquad_x16_t *bf, biquad_process_x16_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_t f1;
+        float d[LSP_DSP_BIQUAD_D_ITEMS * 2];
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0x1f, 0x40, 0x1ff)
+        {
+            FloatBuffer src(count);
+            FloatBuffer dst1(count);
+            FloatBuffer dst2(count);
+            src.randomize_sign();
+
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            // Apply processing of each cascade separately
+            float *ptr = src.data();
+            for (size_t i=0; i<16; ++i)
+            {
+                dsp::biquad_x1_t *x1 = &f1.x1;
+                x1->b0      = bf->b0[i];
+                x1->b1      = bf->b1[i];
+                x1->b2      = bf->b2[i];
+                x1->a1      = bf->a1[i];
+                x1->a2      = bf->a2[i];
+                x1->p0      = 0.0f;
+                x1->p1      = 0.0f;
+                x1->p2      = 0.0f;
+
+                dsp::fill_zero(f1.d, LSP_DSP_BIQUAD_D_ITEMS);
+                generic::biquad_process_x1(dst1, ptr, count, &f1);
+                ptr = dst1.data();
+            }
+
+            dsp::fill_zero(d, LSP_DSP_BIQUAD_D_ITEMS * 2);
+            func(dst2, src, d, count, bf);
+
+            // Perform validation
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            if (!dst1.equals_adaptive(dst2, TOLERANCE))
+            {
+                src.dump("src");
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                        label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+            }
+        }
+    }
+
+    void call(const char *label, const dsp::biquad_x16_t *bf, biquad_process_x16_t func1, biquad_process_x16_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        printf("Testing %s on buffer size %d...\n", label, BUF_SIZE);
+
+        float d1[LSP_DSP_BIQUAD_D_ITEMS * 2], d2[LSP_DSP_BIQUAD_D_ITEMS * 2];
+        dsp::fill_zero(d1, LSP_DSP_BIQUAD_D_ITEMS * 2);
+        dsp::fill_zero(d2, LSP_DSP_BIQUAD_D_ITEMS * 2);
+
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        for (size_t i=0; i<BUF_SIZE; i += BUF_STEP)
+        {
+            size_t count = BUF_SIZE - i;
+            if (count > BUF_STEP)
+                count = BUF_STEP;
+            func1(dst1.data(i), src.data(i), d1, count, bf);
+            func2(dst2.data(i), src.data(i), d2, count, bf);
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            src.dump("src");
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        for (size_t j=0; j<LSP_DSP_BIQUAD_D_ITEMS * 2; ++j)
+        {
+            if (float_equals_absolute(d1[j], d2[j], TOLERANCE))
+                continue;
+            UTEST_FAIL_MSG("Filter memory items #%d for test '%s' differ: %.6f vs %.6f",
+                    int(j), label, d1[j], d2[j]);
+        }
+    }
 
     UTEST_MAIN
     {
@@ -273,6 +384,7 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(sse3::x64_biquad_process_x8, 8));
         IF_ARCH_X86(CALL(avx::x64_biquad_process_x8, 8));
         IF_ARCH_X86(CALL(avx::biquad_process_x8_fma3, 8));
+        IF_ARCH_X86_64(CALL(avx512::x64_biquad_process_x8, 8));
         IF_ARCH_ARM(CALL(neon_d32::biquad_process_x8, 8));
         IF_ARCH_AARCH64(CALL(asimd::biquad_process_x8, 8));
 
@@ -409,8 +521,33 @@ UTEST_BEGIN("dsp.filters", static)
         IF_ARCH_X86(CALL(generic::biquad_process_x8, sse3::x64_biquad_process_x8));
         IF_ARCH_X86(CALL(generic::biquad_process_x8, avx::x64_biquad_process_x8));
         IF_ARCH_X86(CALL(generic::biquad_process_x8, avx::biquad_process_x8_fma3));
+        IF_ARCH_X86_64(CALL(generic::biquad_process_x8, avx512::x64_biquad_process_x8));
         IF_ARCH_ARM(CALL(generic::biquad_process_x8, neon_d32::biquad_process_x8));
         IF_ARCH_AARCH64(CALL(generic::biquad_process_x8, asimd::biquad_process_x8));
+
+        // Prepare 32 zero, 32 pole filter from two copies of the 16 zero, 16 pole filter
+        dsp::biquad_x16_t x16 __lsp_aligned64;
+        for (size_t i=0; i<16; ++i)
+        {
+            x16.b0[i]   = x8->b0[i & 0x07];
+            x16.b1[i]   = x8->b1[i & 0x07];
+            x16.b2[i]   = x8->b2[i & 0x07];
+            x16.a1[i]   = x8->a1[i & 0x07];
+            x16.a2[i]   = x8->a2[i & 0x07];
+        }
+
+        #undef CALL
+        #define CALL(func) \
+            call(#func, &x16, func)
+
+        CALL(generic::biquad_process_x16);
+        IF_ARCH_X86_64(CALL(avx512::x64_biquad_process_x16));
+
+        #undef CALL
+        #define CALL(generic, func) \
+            call(#func, &x16, generic, func)
+
+        IF_ARCH_X86_64(CALL(generic::biquad_process_x16, avx512::x64_biquad_process_x16));
     }
 
 UTEST_END
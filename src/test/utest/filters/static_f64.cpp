@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#define TOLERANCE       1e-10
+
+namespace lsp
+{
+    namespace generic
+    {
+        void biquad_process_x1_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x2_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            void biquad_process_x1_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x2_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        }
+
+        namespace avx
+        {
+            void biquad_process_x4_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x4_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+            void biquad_process_x8_f64_fma3(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+        }
+    )
+
+    typedef void (* biquad_process_f64_t)(double *dst, const double *src, size_t count, dsp::biquad_f64_t *f);
+
+    // Reference implementation: single biquad section in transposed direct form II
+    static void biquad_process(double *dst, const double *src, size_t count, const double *c, double *d)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            double s    = src[i];
+            double r    = c[0]*s + d[0];
+            d[0]        = d[1] + c[1]*s + c[3]*r;
+            d[1]        = c[2]*s + c[4]*r;
+            dst[i]      = r;
+        }
+    }
+}
+
+UTEST_BEGIN("dsp.filters", static_f64)
+
+    void call(const char *label, biquad_process_f64_t func, size_t n)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        dsp::biquad_f64_t f;
+        double c[8][5], d[8][2];
+        double *b0, *b1, *b2, *a1, *a2;
+
+        switch (n)
+        {
+            case 1:
+                b0 = &f.x1.b0; b1 = &f.x1.b1; b2 = &f.x1.b2; a1 = &f.x1.a1; a2 = &f.x1.a2;
+                break;
+            case 2:
+                b0 = f.x2.b0; b1 = f.x2.b1; b2 = f.x2.b2; a1 = f.x2.a1; a2 = f.x2.a2;
+                break;
+            case 4:
+                b0 = f.x4.b0; b1 = f.x4.b1; b2 = f.x4.b2; a1 = f.x4.a1; a2 = f.x4.a2;
+                break;
+            default:
+                b0 = f.x8.b0; b1 = f.x8.b1; b2 = f.x8.b2; a1 = f.x8.a1; a2 = f.x8.a2;
+                break;
+        }
+
+        // Each filter of the bank gets its own stable pair of poles
+        for (size_t i=0; i<n; ++i)
+        {
+            double r    = 0.90 + 0.01 * i;
+            double w    = 0.1 * (i + 1);
+
+            c[i][0]     = 0.25 + 0.05 * i;
+            c[i][1]     = -0.4 + 0.03 * i;
+            c[i][2]     = 0.15 - 0.02 * i;
+            c[i][3]     = 2.0 * r * cos(w);
+            c[i][4]     = -r * r;
+
+            b0[i]       = c[i][0];
+            b1[i]       = c[i][1];
+            b2[i]       = c[i][2];
+            a1[i]       = c[i][3];
+            a2[i]       = c[i][4];
+        }
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0x1f, 0x40, 0x1ff)
+        {
+            uint8_t *data   = NULL;
+            double *src     = alloc_aligned<double>(data, count * 3 + 3, 64);
+            UTEST_ASSERT(src != NULL);
+            lsp_finally { free_aligned(data); };
+            double *dst1    = &src[count + 1];
+            double *dst2    = &dst1[count + 1];
+
+            for (size_t i=0; i<count; ++i)
+                src[i]          = double(rand()) / RAND_MAX * 2.0 - 1.0;
+
+            printf("Testing %s on input buffer size=%d...\n", label, int(count));
+
+            // Process the same data twice to check that the filter state is preserved
+            for (size_t i=0; i<LSP_DSP_BIQUAD_D_ITEMS; ++i)
+                f.d[i]          = 0.0;
+            for (size_t i=0; i<n; ++i)
+            {
+                d[i][0]         = 0.0;
+                d[i][1]         = 0.0;
+            }
+
+            for (size_t pass=0; pass<2; ++pass)
+            {
+                const double *ptr = src;
+                for (size_t i=0; i<n; ++i)
+                {
+                    biquad_process(dst1, ptr, count, c[i], d[i]);
+                    ptr             = dst1;
+                }
+
+                func(dst2, src, count, &f);
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    if (fabs(dst1[i] - dst2[i]) > TOLERANCE * lsp_max(1.0, fabs(dst1[i])))
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d pass %d: %.16f vs %.16f",
+                            label, int(i), int(pass), dst1[i], dst2[i]);
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(func, n) \
+            call(#func, func, n)
+
+        CALL(generic::biquad_process_x1_f64, 1);
+        CALL(generic::biquad_process_x2_f64, 2);
+        CALL(generic::biquad_process_x4_f64, 4);
+        CALL(generic::biquad_process_x8_f64, 8);
+
+        IF_ARCH_X86(CALL(sse2::biquad_process_x1_f64, 1));
+        IF_ARCH_X86(CALL(sse2::biquad_process_x2_f64, 2));
+        IF_ARCH_X86(CALL(sse2::biquad_process_x4_f64, 4));
+        IF_ARCH_X86(CALL(sse2::biquad_process_x8_f64, 8));
+
+        IF_ARCH_X86(CALL(avx::biquad_process_x4_f64, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_x4_f64_fma3, 4));
+        IF_ARCH_X86(CALL(avx::biquad_process_x8_f64, 8));
+        IF_ARCH_X86(CALL(avx::biquad_process_x8_f64_fma3, 8));
+    }
+UTEST_END
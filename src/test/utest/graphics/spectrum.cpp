@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       1e-3
+
+namespace lsp
+{
+    namespace generic
+    {
+        void spectrum_log_map(uint32_t *map, float fmin, float fmax, float srate, size_t rank, size_t width);
+        void spectrum_display(float *peak, float *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width);
+    }
+
+    static void spectrum_display_ref(double *peak, double *avg, const float *spec, const uint32_t *map, size_t smooth, size_t width)
+    {
+        double *pwr     = new double[width];
+        smooth          = lsp_min(smooth, size_t(LSP_DSP_SPECTRUM_SMOOTH_MAX));
+
+        for (size_t i=0; i<width; ++i)
+        {
+            size_t first    = map[i];
+            size_t last     = lsp_max(size_t(map[i+1]), first + 1);
+            double vmax     = 0.0, vsum = 0.0;
+            for (size_t k=first; k<last; ++k)
+            {
+                double p        = double(spec[k*2]) * spec[k*2] + double(spec[k*2+1]) * spec[k*2+1];
+                vmax            = lsp_max(vmax, p);
+                vsum           += p;
+            }
+            peak[i]         = vmax;
+            pwr[i]          = vsum / (last - first);
+        }
+
+        for (ssize_t i=0; i<ssize_t(width); ++i)
+        {
+            ssize_t lo      = lsp_max(i - ssize_t(smooth), ssize_t(0));
+            ssize_t hi      = lsp_min(i + ssize_t(smooth), ssize_t(width) - 1);
+            double vsum     = 0.0;
+            for (ssize_t k=lo; k<=hi; ++k)
+                vsum           += pwr[k];
+            avg[i]          = vsum / (hi - lo + 1);
+        }
+
+        const double thresh = LSP_DSP_AMPLIFICATION_THRESH * LSP_DSP_AMPLIFICATION_THRESH;
+        for (size_t i=0; i<width; ++i)
+        {
+            peak[i]         = 10.0 * log10(lsp_max(peak[i], thresh));
+            avg[i]          = 10.0 * log10(lsp_max(avg[i], thresh));
+        }
+
+        delete [] pwr;
+    }
+}
+
+UTEST_BEGIN("dsp.graphics", spectrum)
+
+    void check_map(size_t rank, size_t width, float fmin, float fmax, float srate)
+    {
+        printf("Testing log map rank=%d, width=%d, fmin=%.1f, fmax=%.1f...\n", int(rank), int(width), fmin, fmax);
+
+        uint32_t *map       = new uint32_t[width + 1];
+        generic::spectrum_log_map(map, fmin, fmax, srate, rank, width);
+
+        const size_t nyquist = size_t(1) << (rank - 1);
+        for (size_t i=0; i<=width; ++i)
+        {
+            double f            = fmin * pow(double(fmax) / fmin, double(i) / width);
+            double bin          = lsp_min(f * double(size_t(1) << rank) / srate, double(nyquist));
+            UTEST_ASSERT_MSG(map[i] <= nyquist, "Map index %d out of range: %d", int(i), int(map[i]));
+            UTEST_ASSERT_MSG(fabs(double(map[i]) - bin) <= 0.5 + 1e-3,
+                "Map index %d differs: %d vs %.3f", int(i), int(map[i]), bin);
+            if (i > 0)
+                UTEST_ASSERT_MSG(map[i] >= map[i-1], "Map is not monotonic at index %d", int(i));
+        }
+
+        delete [] map;
+    }
+
+    void check_display(size_t rank, size_t width, size_t smooth)
+    {
+        printf("Testing display rank=%d, width=%d, smooth=%d...\n", int(rank), int(width), int(smooth));
+
+        const size_t bins   = size_t(1) << rank;
+        FloatBuffer spec(bins * 2);
+        FloatBuffer peak(width), avg(width);
+        uint32_t *map       = new uint32_t[width + 1];
+        double *rpeak       = new double[width];
+        double *ravg        = new double[width];
+
+        for (size_t i=0; i<bins*2; ++i)
+            spec[i]             = randf(-1.0f, 1.0f) * powf(10.0f, randf(-6.0f, 0.0f));
+        for (size_t i=0; i<16; ++i)
+            spec[i]             = 0.0f; // Silent low-frequency bins
+
+        generic::spectrum_log_map(map, 10.0f, 24000.0f, 48000.0f, rank, width);
+        generic::spectrum_display(peak, avg, spec, map, smooth, width);
+        spectrum_display_ref(rpeak, ravg, spec, map, smooth, width);
+
+        UTEST_ASSERT_MSG(peak.valid(), "Peak buffer corrupted");
+        UTEST_ASSERT_MSG(avg.valid(), "Average buffer corrupted");
+
+        for (size_t i=0; i<width; ++i)
+        {
+            if (fabs(peak[i] - rpeak[i]) > TOLERANCE)
+                UTEST_FAIL_MSG("Peak level differs at column %d: %.6f vs %.6f", int(i), peak[i], rpeak[i]);
+            if (fabs(avg[i] - ravg[i]) > TOLERANCE)
+                UTEST_FAIL_MSG("Average level differs at column %d: %.6f vs %.6f", int(i), avg[i], ravg[i]);
+        }
+
+        delete [] ravg;
+        delete [] rpeak;
+        delete [] map;
+    }
+
+    UTEST_MAIN
+    {
+        check_map(10, 100, 20.0f, 20000.0f, 48000.0f);
+        check_map(15, 1920, 10.0f, 24000.0f, 48000.0f);
+        check_map(12, 640, 10.0f, 96000.0f, 96000.0f);
+
+        UTEST_FOREACH(rank, 8, 12, 15)
+        {
+            UTEST_FOREACH(width, 1, 2, 17, 640, 1920)
+            {
+                UTEST_FOREACH(smooth, 0, 1, 3, 40, 1500)
+                    check_display(rank, width, smooth);
+            }
+        }
+    }
+
+UTEST_END;
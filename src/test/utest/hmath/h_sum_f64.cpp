@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#ifndef TOLERANCE
+    #define TOLERANCE 1e-12
+#endif
+
+namespace lsp
+{
+    namespace generic
+    {
+        double h_sum_f64(const double *src, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse2
+        {
+            double h_sum_f64(const double *src, size_t count);
+        }
+
+        namespace avx
+        {
+            double h_sum_f64(const double *src, size_t count);
+        }
+
+        namespace avx512
+        {
+            double h_sum_f64(const double *src, size_t count);
+        }
+    )
+
+    typedef double (* h_sum_f64_t)(const double *src, size_t count);
+}
+
+UTEST_BEGIN("dsp.hmath", h_sum_f64)
+
+    void call(const char *label, size_t align, h_sum_f64_t func1, h_sum_f64_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                32, 64, 65, 100, 768, 999, 0x1fff)
+        {
+            for (size_t mask=0; mask <= 0x01; ++mask)
+            {
+                printf("Testing %s on input buffer of %d numbers, mask=0x%x...\n", label, int(count), int(mask));
+
+                uint8_t *data   = NULL;
+                double *src     = alloc_aligned<double>(data, count + 1, align);
+                UTEST_ASSERT(src != NULL);
+                lsp_finally { free_aligned(data); };
+                src            += mask;
+
+                for (size_t i=0; i<count; ++i)
+                    src[i]          = double(rand()) / RAND_MAX * 2.0 - 1.0;
+
+                // Call functions
+                double xa       = func1(src, count);
+                double xb       = func2(src, count);
+
+                // Compare results
+                if (fabs(xa - xb) > TOLERANCE * lsp_max(1.0, fabs(xa)))
+                    UTEST_FAIL_MSG("%s: Result of function 1 (%.16f) differs result of function 2 (%.16f)", label, xa, xb);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func);
+
+        IF_ARCH_X86(CALL(generic::h_sum_f64, sse2::h_sum_f64, 16));
+        IF_ARCH_X86(CALL(generic::h_sum_f64, avx::h_sum_f64, 32));
+        IF_ARCH_X86(CALL(generic::h_sum_f64, avx512::h_sum_f64, 64));
+    }
+UTEST_END
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+namespace lsp
+{
+    namespace generic
+    {
+        void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+
+        void lanczos_decimate_2x2(float *dst, const float *src, size_t count);
+        void lanczos_decimate_2x3(float *dst, const float *src, size_t count);
+        void lanczos_decimate_2x4(float *dst, const float *src, size_t count);
+        void lanczos_decimate_2x16bit(float *dst, const float *src, size_t count);
+        void lanczos_decimate_2x24bit(float *dst, const float *src, size_t count);
+
+        void lanczos_decimate_3x2(float *dst, const float *src, size_t count);
+        void lanczos_decimate_3x3(float *dst, const float *src, size_t count);
+        void lanczos_decimate_3x4(float *dst, const float *src, size_t count);
+        void lanczos_decimate_3x16bit(float *dst, const float *src, size_t count);
+        void lanczos_decimate_3x24bit(float *dst, const float *src, size_t count);
+
+        void lanczos_decimate_4x2(float *dst, const float *src, size_t count);
+        void lanczos_decimate_4x3(float *dst, const float *src, size_t count);
+        void lanczos_decimate_4x4(float *dst, const float *src, size_t count);
+        void lanczos_decimate_4x16bit(float *dst, const float *src, size_t count);
+        void lanczos_decimate_4x24bit(float *dst, const float *src, size_t count);
+
+        void lanczos_decimate_6x2(float *dst, const float *src, size_t count);
+        void lanczos_decimate_6x3(float *dst, const float *src, size_t count);
+        void lanczos_decimate_6x4(float *dst, const float *src, size_t count);
+        void lanczos_decimate_6x16bit(float *dst, const float *src, size_t count);
+        void lanczos_decimate_6x24bit(float *dst, const float *src, size_t count);
+
+        void lanczos_decimate_8x2(float *dst, const float *src, size_t count);
+        void lanczos_decimate_8x3(float *dst, const float *src, size_t count);
+        void lanczos_decimate_8x4(float *dst, const float *src, size_t count);
+        void lanczos_decimate_8x16bit(float *dst, const float *src, size_t count);
+        void lanczos_decimate_8x24bit(float *dst, const float *src, size_t count);
+    }
+
+    IF_ARCH_X86(
+        namespace sse
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+
+        namespace avx
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+            void fir_decimate_fma3(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+
+        namespace avx512
+        {
+            void fir_decimate(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+        }
+    )
+}
+
+typedef void (* fir_decimate_t)(float *dst, const float *src, const float *k, size_t taps, size_t factor, size_t count);
+typedef void (* lanczos_decimate_t)(float *dst, const float *src, size_t count);
+
+UTEST_BEGIN("dsp.resampling", decimation)
+
+    void call(const char *text, size_t align, fir_decimate_t func1, fir_decimate_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(taps, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 63, 64, 65, 127)
+        {
+            for (size_t factor=1; factor <= 8; ++factor)
+            {
+                printf("Testing %s for taps=%d, factor=%d...\n", text, int(taps), int(factor));
+
+                UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 33, 100)
+                {
+                    for (size_t mask=0; mask <= 0x07; ++mask)
+                    {
+                        FloatBuffer src(count * factor + taps, align, mask & 0x01);
+                        FloatBuffer k(taps, align, mask & 0x02);
+                        FloatBuffer dst1(count, align, mask & 0x04);
+                        FloatBuffer dst2(dst1);
+                        src.randomize_sign();
+                        k.randomize_sign();
+
+                        // Call functions
+                        func1(dst1, src, k, taps, factor, count);
+                        func2(dst2, src, k, taps, factor, count);
+
+                        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                        UTEST_ASSERT_MSG(k.valid(), "Kernel buffer corrupted");
+                        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                        // Compare buffers
+                        if (!dst1.equals_adaptive(dst2, 1e-4))
+                        {
+                            src.dump("src");
+                            k.dump("k");
+                            dst1.dump("dst1");
+                            dst2.dump("dst2");
+                            UTEST_FAIL_MSG("Output of functions for test '%s' differs", text);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void call(const char *text, lanczos_decimate_t func, size_t factor, size_t lobes, float tol)
+    {
+        printf("Testing %s...\n", text);
+
+        // The signal is a sine wave at 1/16 of the output Nyquist frequency
+        const size_t count  = 1024;
+        const size_t rsv    = LSP_DSP_RESAMPLING_RSV_SAMPLES;
+        const double w      = M_PI / double(16 * factor);
+        const size_t delay  = lobes - 1;
+
+        FloatBuffer src(rsv + count * factor, 16, false);
+        FloatBuffer dst1(count, 16, false);
+        FloatBuffer dst2(count, 16, false);
+
+        // Fill history and signal
+        for (size_t i=0; i<rsv + count * factor; ++i)
+            src[i]              = sin(w * (double(i) - double(rsv)));
+
+        // Process the whole buffer at once and by blocks of variable size
+        func(dst1, &src[rsv], count);
+        for (size_t off=0, block=1; off < count; block = (block * 5 + 3) % 97 + 1)
+        {
+            size_t to_do        = lsp_min(count - off, block);
+            func(&dst2[off], &src[rsv + off * factor], to_do);
+            off                += to_do;
+        }
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        for (size_t i=0; i<count; ++i)
+        {
+            if (fabsf(dst1[i] - dst2[i]) > 1e-5f)
+                UTEST_FAIL_MSG("Block processing output differs at sample %d: %.6f vs %.6f", int(i), dst1[i], dst2[i]);
+        }
+
+        // Compare with the delayed decimated signal
+        for (size_t i=0; i<count; ++i)
+        {
+            float ref           = sin(w * (double(i) - double(delay)) * factor);
+            if (fabsf(dst1[i] - ref) > tol)
+                UTEST_FAIL_MSG("Output differs from the ideal signal at sample %d: %.6f vs %.6f", int(i), dst1[i], ref);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(generic, func, align) \
+            call(#func, align, generic, func)
+
+        IF_ARCH_X86(CALL(generic::fir_decimate, sse::fir_decimate, 16));
+        IF_ARCH_X86(CALL(generic::fir_decimate, avx::fir_decimate, 32));
+        IF_ARCH_X86(CALL(generic::fir_decimate, avx::fir_decimate_fma3, 32));
+        IF_ARCH_X86(CALL(generic::fir_decimate, avx512::fir_decimate, 64));
+
+        #define DCALL(func, factor, lobes, tol) \
+            call(#func, func, factor, lobes, tol)
+
+        DCALL(generic::lanczos_decimate_2x2, 2, 2, 5e-2f);
+        DCALL(generic::lanczos_decimate_2x3, 2, 3, 2e-2f);
+        DCALL(generic::lanczos_decimate_2x4, 2, 4, 1e-2f);
+        DCALL(generic::lanczos_decimate_2x16bit, 2, 10, 2e-3f);
+        DCALL(generic::lanczos_decimate_2x24bit, 2, 62, 1e-4f);
+
+        DCALL(generic::lanczos_decimate_3x2, 3, 2, 5e-2f);
+        DCALL(generic::lanczos_decimate_3x3, 3, 3, 2e-2f);
+        DCALL(generic::lanczos_decimate_3x4, 3, 4, 1e-2f);
+        DCALL(generic::lanczos_decimate_3x16bit, 3, 10, 2e-3f);
+        DCALL(generic::lanczos_decimate_3x24bit, 3, 62, 1e-4f);
+
+        DCALL(generic::lanczos_decimate_4x2, 4, 2, 5e-2f);
+        DCALL(generic::lanczos_decimate_4x3, 4, 3, 2e-2f);
+        DCALL(generic::lanczos_decimate_4x4, 4, 4, 1e-2f);
+        DCALL(generic::lanczos_decimate_4x16bit, 4, 10, 2e-3f);
+        DCALL(generic::lanczos_decimate_4x24bit, 4, 62, 1e-4f);
+
+        DCALL(generic::lanczos_decimate_6x2, 6, 2, 5e-2f);
+        DCALL(generic::lanczos_decimate_6x3, 6, 3, 2e-2f);
+        DCALL(generic::lanczos_decimate_6x4, 6, 4, 1e-2f);
+        DCALL(generic::lanczos_decimate_6x16bit, 6, 10, 2e-3f);
+        DCALL(generic::lanczos_decimate_6x24bit, 6, 62, 1e-4f);
+
+        DCALL(generic::lanczos_decimate_8x2, 8, 2, 5e-2f);
+        DCALL(generic::lanczos_decimate_8x3, 8, 3, 2e-2f);
+        DCALL(generic::lanczos_decimate_8x4, 8, 4, 1e-2f);
+        DCALL(generic::lanczos_decimate_8x16bit, 8, 10, 2e-3f);
+        DCALL(generic::lanczos_decimate_8x24bit, 8, 62, 1e-4f);
+    }
+
+UTEST_END;
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       2e-3f
+
+namespace lsp
+{
+    namespace generic
+    {
+        dsp::resampler_t *resampler_create(size_t in_rate, size_t out_rate, size_t lobes);
+        void resampler_destroy(dsp::resampler_t *rs);
+        void resampler_reset(dsp::resampler_t *rs);
+        void resampler_set_ratio(dsp::resampler_t *rs, double ratio);
+        double resampler_get_ratio(const dsp::resampler_t *rs);
+        size_t resampler_latency(const dsp::resampler_t *rs);
+        size_t resampler_max_output(const dsp::resampler_t *rs, size_t count);
+        size_t resampler_process(dsp::resampler_t *rs, float *dst, const float *src, size_t count);
+    }
+}
+
+UTEST_BEGIN("dsp.resampling", resampler)
+
+    void call(size_t in_rate, size_t out_rate, size_t lobes, double drift)
+    {
+        printf("Testing resampler %d -> %d, lobes=%d, drift=%f\n",
+            int(in_rate), int(out_rate), int(lobes), drift);
+
+        dsp::resampler_t *rs = generic::resampler_create(in_rate, out_rate, lobes);
+        UTEST_ASSERT(rs != NULL);
+        lsp_finally { generic::resampler_destroy(rs); };
+
+        // The signal is a sine wave at 1/8 of the lowest Nyquist frequency
+        const size_t count  = 8192;
+        const double f      = double(lsp_min(in_rate, out_rate)) / 16.0;
+        const double w      = 2.0 * M_PI * f / double(in_rate);
+        const double ratio  = double(out_rate) / double(in_rate) * (1.0 + drift);
+
+        FloatBuffer src(count, 16, false);
+        for (size_t i=0; i<count; ++i)
+            src[i]              = sin(w * i);
+
+        size_t max_out      = generic::resampler_max_output(rs, count) * 2;
+        FloatBuffer dst1(max_out, 16, false);
+        FloatBuffer dst2(max_out, 16, false);
+
+        // Do the same twice to check that reset works properly
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            if (drift != 0.0)
+                generic::resampler_set_ratio(rs, ratio);
+            double step         = 1.0 / generic::resampler_get_ratio(rs);
+            UTEST_ASSERT(fabs(step * ratio - 1.0) < 1e-6);
+
+            // Process the whole buffer at once
+            size_t n1           = generic::resampler_process(rs, dst1, src, count);
+            UTEST_ASSERT(n1 <= generic::resampler_max_output(rs, count));
+            generic::resampler_reset(rs);
+            if (drift != 0.0)
+                generic::resampler_set_ratio(rs, ratio);
+
+            // Process the data by blocks of variable size
+            size_t n2           = 0;
+            for (size_t off=0, block=1; off < count; block = (block * 7 + 3) % 1537 + 1)
+            {
+                size_t to_do        = lsp_min(count - off, block);
+                size_t produced     = generic::resampler_process(rs, &dst2[n2], &src[off], to_do);
+                UTEST_ASSERT(produced <= generic::resampler_max_output(rs, to_do));
+                n2                 += produced;
+                off                += to_do;
+            }
+            generic::resampler_reset(rs);
+
+            UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+            // Streaming should produce exactly the same result
+            UTEST_ASSERT_MSG(n1 == n2, "Number of produced samples differs: %d vs %d", int(n1), int(n2));
+            size_t latency      = generic::resampler_latency(rs);
+            size_t expected     = size_t((count - latency) / step) + 1;
+            UTEST_ASSERT_MSG((n1 + 1 >= expected) && (n1 <= expected + 1),
+                "Unexpected number of produced samples: %d, expected %d", int(n1), int(expected));
+
+            for (size_t i=0; i<n1; ++i)
+            {
+                if (dst1[i] != dst2[i])
+                    UTEST_FAIL_MSG("Streaming output differs at sample %d: %.6f vs %.6f", int(i), dst1[i], dst2[i]);
+            }
+
+            // Compare with the ideal signal, skip the transient caused by the initial history
+            for (size_t i=0; i<n1; ++i)
+            {
+                double t            = i * step;
+                if (t < latency)
+                    continue;
+                float ref           = sin(w * t);
+                if (fabsf(dst1[i] - ref) > TOLERANCE)
+                    UTEST_FAIL_MSG("Output differs from the ideal signal at sample %d: %.6f vs %.6f", int(i), dst1[i], ref);
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Check invalid arguments
+        UTEST_ASSERT(generic::resampler_create(0, 48000, 8) == NULL);
+        UTEST_ASSERT(generic::resampler_create(48000, 0, 8) == NULL);
+        UTEST_ASSERT(generic::resampler_create(48000, 44100, LSP_DSP_RESAMPLER_LOBES_MIN - 1) == NULL);
+        UTEST_ASSERT(generic::resampler_create(48000, 44100, LSP_DSP_RESAMPLER_LOBES_MAX + 1) == NULL);
+        UTEST_ASSERT(generic::resampler_create(1, LSP_DSP_RESAMPLER_RATIO_MAX + 1, 8) == NULL);
+        UTEST_ASSERT(generic::resampler_create(LSP_DSP_RESAMPLER_RATIO_MAX + 1, 1, 8) == NULL);
+        UTEST_ASSERT(generic::resampler_create(1000, (LSP_DSP_RESAMPLER_RATIO_MAX + 1) * 1000, 8) == NULL);
+        UTEST_ASSERT(generic::resampler_create(size_t(-1), 1, 8) == NULL);
+
+        // Check the ratios at the bounds of the range
+        dsp::resampler_t *rs = generic::resampler_create(1, LSP_DSP_RESAMPLER_RATIO_MAX, 8);
+        UTEST_ASSERT(rs != NULL);
+        generic::resampler_destroy(rs);
+        rs = generic::resampler_create(LSP_DSP_RESAMPLER_RATIO_MAX, 1, 8);
+        UTEST_ASSERT(rs != NULL);
+        UTEST_ASSERT(generic::resampler_latency(rs) == LSP_DSP_RESAMPLER_RATIO_MAX * 8);
+        generic::resampler_destroy(rs);
+
+        call(48000, 48000, 8, 0.0);
+        call(44100, 48000, 8, 0.0);
+        call(48000, 44100, 8, 0.0);
+        call(48000, 96000, 16, 0.0);
+        call(96000, 48000, 16, 0.0);
+        call(44100, 192000, 8, 0.0);
+        call(44100, 48000, 8, 1e-4);
+        call(48000, 44100, 16, -2e-4);
+        call(48000, 48000, 8, 3e-3);
+        call(22050, 48001, 8, 0.0);
+    }
+
+UTEST_END;
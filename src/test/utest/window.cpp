@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-dsp-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+
+#define TOLERANCE       2e-5
+
+namespace lsp
+{
+    namespace generic
+    {
+        void window_cosine_sum(float *dst, const float *a, size_t terms, size_t count, size_t mode);
+        void window_sine(float *dst, size_t count, size_t mode);
+        void window_hann(float *dst, size_t count, size_t mode);
+        void window_hamming(float *dst, size_t count, size_t mode);
+        void window_blackman(float *dst, size_t count, size_t mode);
+        void window_blackman_harris(float *dst, size_t count, size_t mode);
+        void window_nuttall(float *dst, size_t count, size_t mode);
+        void window_flat_top(float *dst, size_t count, size_t mode);
+        void window_kaiser(float *dst, float beta, size_t count, size_t mode);
+    }
+
+    typedef void (* window_func_t)(float *dst, size_t count, size_t mode);
+
+    static const double hann_coeffs[]       = { 0.5, 0.5 };
+    static const double hamming_coeffs[]    = { 0.54, 0.46 };
+    static const double blackman_coeffs[]   = { 0.42, 0.5, 0.08 };
+    static const double bh_coeffs[]         = { 0.35875, 0.48829, 0.14128, 0.01168 };
+    static const double nuttall_coeffs[]    = { 0.355768, 0.487396, 0.144232, 0.012604 };
+    static const double flat_top_coeffs[]   = { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 };
+
+    static double cosine_sum(const double *a, size_t terms, size_t i, size_t period)
+    {
+        double s        = 0.0;
+        for (size_t m=0; m<terms; ++m)
+        {
+            double v        = a[m] * cos(2.0 * M_PI * double(m * i) / double(period));
+            s              += (m & 1) ? -v : v;
+        }
+        return s;
+    }
+
+    static double bessel_i0(double x)
+    {
+        double s        = 0.0;
+        double t        = 1.0;
+        for (size_t k=1; k<=200; ++k)
+        {
+            s              += t;
+            t              *= (x * 0.5 / double(k)) * (x * 0.5 / double(k));
+        }
+        return s;
+    }
+}
+
+UTEST_BEGIN("dsp", window)
+
+    void check(const char *text, const float *w, const double *ref, size_t count, size_t mode)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            if (fabs(w[i] - ref[i]) > TOLERANCE)
+                UTEST_FAIL_MSG("Window %s of %d samples (mode=%d) differs at sample %d: %.7f vs %.7f",
+                    text, int(count), int(mode), int(i), w[i], ref[i]);
+        }
+    }
+
+    void call(const char *text, window_func_t func, const double *a, size_t terms)
+    {
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 16, 255, 256, 257, 1000, 4096, 65536)
+        {
+            for (size_t mode=LSP_DSP_WINDOW_PERIODIC; mode <= LSP_DSP_WINDOW_SYMMETRIC; ++mode)
+            {
+                printf("Testing %s window of %d samples, mode=%d...\n", text, int(count), int(mode));
+
+                FloatBuffer w(count);
+                double *ref         = new double[count + 1];
+                size_t period       = (mode == LSP_DSP_WINDOW_SYMMETRIC) ? count - 1 : count;
+                for (size_t i=0; i<count; ++i)
+                {
+                    if (count <= 1)
+                        ref[i]              = 1.0;
+                    else if (a == NULL)
+                        ref[i]              = sin(M_PI * double(i) / double(period));
+                    else
+                        ref[i]              = cosine_sum(a, terms, i, period);
+                }
+
+                func(w, count, mode);
+                UTEST_ASSERT_MSG(w.valid(), "Window buffer corrupted");
+                check(text, w, ref, count, mode);
+
+                delete [] ref;
+            }
+        }
+    }
+
+    void call_kaiser(float beta)
+    {
+        UTEST_FOREACH(count, 0, 1, 2, 3, 16, 255, 256, 1000)
+        {
+            for (size_t mode=LSP_DSP_WINDOW_PERIODIC; mode <= LSP_DSP_WINDOW_SYMMETRIC; ++mode)
+            {
+                printf("Testing kaiser window of %d samples, beta=%.2f, mode=%d...\n", int(count), beta, int(mode));
+
+                FloatBuffer w(count);
+                double *ref         = new double[count + 1];
+                size_t period       = (mode == LSP_DSP_WINDOW_SYMMETRIC) ? count - 1 : count;
+                for (size_t i=0; i<count; ++i)
+                {
+                    double r            = 2.0 * double(i) / double(period) - 1.0;
+                    ref[i]              = (count <= 1) ? 1.0 : bessel_i0(beta * sqrt(lsp_max(1.0 - r*r, 0.0))) / bessel_i0(beta);
+                }
+
+                generic::window_kaiser(w, beta, count, mode);
+                UTEST_ASSERT_MSG(w.valid(), "Window buffer corrupted");
+                check("kaiser", w, ref, count, mode);
+
+                delete [] ref;
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        call("sine", generic::window_sine, NULL, 0);
+        call("hann", generic::window_hann, hann_coeffs, 2);
+        call("hamming", generic::window_hamming, hamming_coeffs, 2);
+        call("blackman", generic::window_blackman, blackman_coeffs, 3);
+        call("blackman_harris", generic::window_blackman_harris, bh_coeffs, 4);
+        call("nuttall", generic::window_nuttall, nuttall_coeffs, 4);
+        call("flat_top", generic::window_flat_top, flat_top_coeffs, 5);
+
+        call_kaiser(0.0f);
+        call_kaiser(4.0f);
+        call_kaiser(8.6f);
+        call_kaiser(20.0f);
+
+        // The generalized cosine window should match the specific one
+        FloatBuffer w1(1000), w2(1000);
+        const float a[] = { 0.5f, 0.5f };
+        generic::window_cosine_sum(w1, a, 2, 1000, LSP_DSP_WINDOW_SYMMETRIC);
+        generic::window_hann(w2, 1000, LSP_DSP_WINDOW_SYMMETRIC);
+        UTEST_ASSERT(w1.equals_absolute(w2));
+    }
+
+UTEST_END;